@@ -0,0 +1,33 @@
+# - Try to find liburing library and headers
+# Once done, this will define
+#
+#  LIBURING_FOUND - system has liburing
+#  LIBURING_INCLUDE_DIR - the liburing include directories
+#  LIBURING_LIBRARIES - link these to use liburing
+
+if (LIBURING_INCLUDE_DIR AND LIBURING_LIBRARIES)
+  set(LIBURING_FIND_QUIETLY TRUE)
+endif (LIBURING_INCLUDE_DIR AND LIBURING_LIBRARIES)
+
+# Include dir
+find_path(LIBURING_INCLUDE_DIR
+  NAMES liburing.h
+)
+
+# Library
+find_library(LIBURING_LIBRARY
+  NAMES uring
+)
+
+# handle the QUIETLY and REQUIRED arguments and set LIBURING_FOUND to TRUE if
+# all listed variables are TRUE
+INCLUDE(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(LibUring DEFAULT_MSG LIBURING_LIBRARY LIBURING_INCLUDE_DIR)
+
+IF(LIBURING_FOUND)
+   SET( LIBURING_LIBRARIES ${LIBURING_LIBRARY} )
+ELSE(LIBURING_FOUND)
+   SET( LIBURING_LIBRARIES )
+ENDIF(LIBURING_FOUND)
+
+MARK_AS_ADVANCED( LIBURING_LIBRARY LIBURING_INCLUDE_DIR )
@@ -32,23 +32,18 @@ sub base_type($) {
     return "UNKNOWN TYPE: $type";
 }
 
-sub print_insert($$) {
+sub parent_type($$) {
     my ($type, $name) = @_;
-    my $avp_type;
 
     if ($type =~ m/(Grouped|OctetString|Integer32|Integer64|Unsigned32|Unsigned64|Float32|Float64)/) {
-        $avp_type = "NULL";
+        return "NULL";
     } elsif ($type =~ m/Enumerated/) {
-        print "\t\tstruct dict_object		*type;\n";
-        print "\t\tstruct dict_type_data	 tdata = { AVP_TYPE_INTEGER32, \"" . ($vendor_name ? "$vendor_name/" : "") ."Enumerated($name)\", NULL, NULL, NULL };\n";
+        my $tname = ($vendor_name ? "$vendor_name/" : "") . "Enumerated($name)";
+        print "\t{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, \"$tname\", NULL, NULL, NULL }, NULL },\n";
         # XXX: add enumerated values
-        print "\t\tCHECK_dict_new(DICT_TYPE, &tdata, NULL, &type);\n";
-        $avp_type = "type";
-    } else {
-        $avp_type = "${type}_type";
+        return "\"$tname\"";
     }
-
-    print "\t\tCHECK_dict_new(DICT_AVP, &data, $avp_type, NULL);\n";
+    return "\"$type\"";
 }
 
 sub usage($) {
@@ -67,7 +62,8 @@ if (defined($opt_v)) {
 }
 
 print "\t/* The following is created automatically. Do not modify. */\n";
-print "\t/* Changes will be lost during the next update. Modify the source org file instead. */\n\n";
+print "\t/* Changes will be lost during the next update. Modify the source org file instead. */\n";
+print "\t/* These entries belong in a static struct dict_object_def table, passed to fd_dict_new_batch. */\n\n";
 
 while (<>) {
     my ($dummy, $name, $code, $section, $type, $must, $may, $shouldnot, $mustnot, $encr) = split /\|/;
@@ -83,14 +79,10 @@ while (<>) {
     $code =~ s/ *//g;
     $type =~ s/ *//g;
 
-    print "\t/* $name */\n\t{\n\t\tstruct dict_avp_data data = {\n";
-    print "\t\t\t$code,\t/* Code */\n";
-    print "\t\t\t$vendor,\t/* Vendor */\n";
-    print "\t\t\t\"$name\",\t/* Name */\n";
-    print "\t\t\t" . convert_must_to_flags("$must, $mustnot") . ",\t/* Fixed flags */\n";
-    print "\t\t\t" . convert_must_to_flags("$must") . ",\t/* Fixed flag values */\n";
-    print "\t\t\t" . base_type($type) . "\t/* base type of data */\n";
-    print "\t\t};\n";
-    print_insert($type, $name);
-    print "\t};\n\n";
+    print "\t/* $name */\n";
+    my $parent = parent_type($type, $name);
+    print "\t{ DICT_AVP, &(struct dict_avp_data){ $code, $vendor, \"$name\", ";
+    print convert_must_to_flags("$must, $mustnot") . ", ";
+    print convert_must_to_flags("$must") . ", ";
+    print base_type($type) . " }, $parent },\n\n";
 }
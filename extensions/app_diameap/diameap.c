@@ -70,11 +70,8 @@ void fd_ext_fini(void)
 	CHECK_FCT_DO(diameap_stop_server(),
 			{	TRACE_DEBUG(INFO,"%sStopping the server: Error occurred.",DIAMEAP_EXTENSION);});
 
-	if (db_conn)
-	{
-		TRACE_DEBUG(FULL,"%sDisconnecting from MySQL Server",DIAMEAP_EXTENSION);
-		diameap_mysql_disconnect();
-	}
+	TRACE_DEBUG(FULL,"%sDisconnecting from MySQL Server",DIAMEAP_EXTENSION);
+	diameap_mysql_disconnect();
 
 	TRACE_DEBUG(FULL,"%sUnloading EAP Methods plug-ins: Error occurred.",DIAMEAP_EXTENSION);
 	CHECK_FCT_DO(diameap_plugin_unload(),
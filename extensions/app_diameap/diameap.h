@@ -62,6 +62,9 @@ struct diameap_conf
 		char *user;
 		char *password;
 		char *database;
+		int pool_size; /* number of connections to the database */
+		int cache_size; /* max number of cached user records, 0 to disable the cache */
+		int cache_ttl; /* lifetime of a cached user record, in seconds */
 	}db;
 
 	u32 multi_round_time_out;
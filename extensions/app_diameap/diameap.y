@@ -81,6 +81,9 @@ int diameaplex(YYSTYPE *lvalp, YYLTYPE *llocp);
 %token 		AUTHORIZE
 %token 		MODE
 %token 		DIAMEAP_MYSQL
+%token 		DIAMEAP_MYSQL_POOL
+%token 		USER_CACHE_SIZE
+%token 		USER_CACHE_TTL
 %token		MAX_INVALID_EAP_PACKET
 %token		MULTI_ROUND_TIMEOUT
 %token		CHECK_USER_IDENTITY
@@ -91,6 +94,9 @@ confparams : 	/* empty */
 		| confparams EAPmethod
 		| confparams Authorize
 		| confparams DiamEAP_MySQL
+		| confparams DiamEAP_MySQL_Pool
+		| confparams User_Cache_Size
+		| confparams User_Cache_TTL
 		| confparams MAX_Invalid_EAP_Packet
 		| confparams Multi_Round_Timeout
 		| confparams Check_User_Identity
@@ -166,6 +172,21 @@ DiamEAP_MySQL :	DIAMEAP_MYSQL '=' iSTRING ',' iSTRING ',' iSTRING ',' iSTRING ';
 		}
 		;
 
+DiamEAP_MySQL_Pool : DIAMEAP_MYSQL_POOL '=' NUM ';'
+		{
+		config->db.pool_size=(int)$3;
+		};
+
+User_Cache_Size : USER_CACHE_SIZE '=' NUM ';'
+		{
+		config->db.cache_size=(int)$3;
+		};
+
+User_Cache_TTL : USER_CACHE_TTL '=' NUM ';'
+		{
+		config->db.cache_ttl=(int)$3;
+		};
+
 MAX_Invalid_EAP_Packet : MAX_INVALID_EAP_PACKET '=' NUM ';'
 		{
 		config->max_invalid_eap_packet=(int)$3;
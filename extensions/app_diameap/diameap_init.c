@@ -133,6 +133,9 @@ static int diameap_init_config(char * conffile)
 	diameap_config->diam_realm = strdup(fd_g_config->cnf_diamrlm);
 	diameap_config->max_invalid_eap_packet = 5;
 	diameap_config->multi_round_time_out = 30;
+	diameap_config->db.pool_size = 4;
+	diameap_config->db.cache_size = 0;
+	diameap_config->db.cache_ttl = 30;
 	check_user_identity = TRUE;
 
 	return 0;
@@ -343,24 +346,6 @@ int diameap_set_mysql_param(char * user, char * passwd, char * server,
 	return 0;
 }
 
-/* Connecting to MySQL Database */
-int diameap_mysql_connect(void)
-{
-	TRACE_ENTRY();
-	db_conn = mysql_init(NULL);
-	const my_bool mysql_reconnect_val=1;
-	mysql_options(db_conn,MYSQL_OPT_RECONNECT,&mysql_reconnect_val);
-	/* Connect to database */
-	if (!mysql_real_connect(db_conn, diameap_config->db.server,
-			diameap_config->db.user, diameap_config->db.password,
-			diameap_config->db.database, 0, NULL, 0))
-	{
-		TRACE_DEBUG(INFO,"%sConnection to MySQL Database Server failed: %s",DIAMEAP_EXTENSION, mysql_error(db_conn));
-		return errno;
-	}
-	return 0;
-}
-
 static void diameap_conf_dump(void)
 {
 
@@ -382,6 +367,11 @@ static void diameap_conf_dump(void)
 		fd_log_debug("\t\tUser .......:%s", diameap_config->db.user);
 		fd_log_debug("\t\tServer .....:%s", diameap_config->db.server);
 		fd_log_debug("\t\tDatabase....:%s", diameap_config->db.database);
+		fd_log_debug("\t\tConnections.:%d", diameap_config->db.pool_size);
+		if (diameap_config->db.cache_size > 0)
+			fd_log_debug("\t\tUsers cache.:%d entries, %d seconds", diameap_config->db.cache_size, diameap_config->db.cache_ttl);
+		else
+			fd_log_debug("\t\tUsers cache.:disabled");
 	}
 
 	fd_log_debug("\t-EAP Method Plugins.....: ");
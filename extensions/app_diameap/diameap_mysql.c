@@ -35,200 +35,516 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *****************************************************************************************************/
 
-#include "diameap_mysql.h"
+#include "diameap_common.h"
 
-static pthread_mutex_t db_cs_mutex =
-PTHREAD_MUTEX_INITIALIZER;
+/* Size of the buffers that receive the string columns of the result sets */
+#define DB_FIELD_LEN		1024
 
-int diameap_get_eap_user(struct eap_user * user, char * username)
+/* Number of hash buckets in the users cache */
+#define USER_CACHE_BUCKETS	256
+
+/* The queries, prepared once on each connection of the pool */
+static const char * user_query =
+	"SELECT id,username,password,eapmethod, vendor FROM users WHERE  users.username=? and users.active='Y' ";
+static const char * authe_query =
+	"SELECT `authe`.`attribute` ,`authe`.`value` FROM `authe` WHERE `authe`.`grp` IN ( SELECT `user_grp`.`grp` FROM `user_grp` WHERE `user_grp`.`user` = ? ) ";
+static const char * authz_query =
+	"SELECT `authz`.`attribute` , `authz`.`op` , `authz`.`value` FROM `authz` WHERE `authz`.`grp` IN ( SELECT `user_grp`.`grp` FROM `user_grp` WHERE `user_grp`.`user` = ? ) ";
+
+/* A connection of the pool, with its prepared statements */
+struct db_conn
 {
-	TRACE_ENTRY("%p %p",user,username);
-	if (db_conn == NULL)
+	MYSQL * mysql;
+	MYSQL_STMT * user_stmt; /* user_query */
+	MYSQL_STMT * authe_stmt; /* authe_query */
+	MYSQL_STMT * authz_stmt; /* authz_query */
+	struct db_conn * next; /* next idle connection */
+};
+
+/* The pool of connections to the MySQL Database */
+static struct db_conn * db_pool = NULL;
+static int db_pool_size = 0;
+static struct db_conn * db_idle = NULL;
+static pthread_mutex_t db_cs_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t db_cs_cond = PTHREAD_COND_INITIALIZER;
+
+/* A cached user record */
+struct user_cache_entry
+{
+	struct fd_list lru; /* link in user_cache_lru, most recently used first */
+	struct fd_list bucket; /* link in user_cache_buckets */
+	char * username; /* the key, as requested */
+	int id;
+	u8 * userid;
+	u16 useridLength;
+	u8 * password;
+	u16 passwordLength;
+	eap_type method;
+	u32 vendor;
+	time_t expire;
+};
+
+/* The users cache (LRU, entries expire after diameap_config->db.cache_ttl seconds) */
+static struct fd_list user_cache_buckets[USER_CACHE_BUCKETS];
+static struct fd_list user_cache_lru = FD_LIST_INITIALIZER(user_cache_lru);
+static int user_cache_count = 0;
+static pthread_mutex_t user_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+static void user_cache_free(struct user_cache_entry * e)
+{
+	fd_list_unlink(&e->lru);
+	fd_list_unlink(&e->bucket);
+	free(e->username);
+	free(e->userid);
+	free(e->password);
+	free(e);
+	user_cache_count--;
+}
+
+static struct fd_list * user_cache_bucket(char * username)
+{
+	return &user_cache_buckets[fd_os_hash((uint8_t *)username, strlen(username)) % USER_CACHE_BUCKETS];
+}
+
+/* Copy a valid cached record of username into user, return ENOENT if there is none */
+static int user_cache_fetch(struct eap_user * user, char * username)
+{
+	struct fd_list * li, * bucket;
+	int ret = ENOENT;
+
+	if (diameap_config->db.cache_size <= 0)
+		return ENOENT;
+
+	bucket = user_cache_bucket(username);
+
+	CHECK_POSIX(pthread_mutex_lock( &user_cache_mutex ));
+	for (li = bucket->next; li != bucket; li = li->next)
 	{
-		TRACE_DEBUG(INFO, "%sNot connected to the MySQL Database server.",DIAMEAP_EXTENSION);
+		struct user_cache_entry * e = li->o;
+		if (strcmp(e->username, username))
+			continue;
+
+		if (e->expire <= time(NULL))
+		{
+			user_cache_free(e);
+			break;
+		}
+
+		/* Move to the head of the LRU list */
+		fd_list_unlink(&e->lru);
+		fd_list_insert_after(&user_cache_lru, &e->lru);
+
+		user->id = e->id;
+		CHECK_MALLOC_DO(user->userid = malloc(e->useridLength + 1), { ret = ENOMEM; break; });
+		memcpy(user->userid, e->userid, e->useridLength + 1);
+		user->useridLength = e->useridLength;
+		CHECK_MALLOC_DO(user->password = malloc(e->passwordLength + 1), { ret = ENOMEM; break; });
+		memcpy(user->password, e->password, e->passwordLength + 1);
+		user->passwordLength = e->passwordLength;
+		user->proposed_eap_method = e->method;
+		user->proposed_eap_method_vendor = e->vendor;
+		ret = 0;
+		break;
+	}
+	CHECK_POSIX(pthread_mutex_unlock( &user_cache_mutex ));
 
-		return EINVAL;
+	return ret;
+}
+
+/* Save the record retrieved from the database, evicting the least recently used one when the cache is full */
+static int user_cache_store(struct eap_user * user, char * username)
+{
+	struct fd_list * li, * bucket;
+	struct user_cache_entry * e;
+
+	if (diameap_config->db.cache_size <= 0)
+		return 0;
 
+	CHECK_MALLOC(e = malloc(sizeof(struct user_cache_entry)));
+	memset(e, 0, sizeof(struct user_cache_entry));
+	fd_list_init(&e->lru, e);
+	fd_list_init(&e->bucket, e);
+	e->username = strdup(username);
+	e->userid = malloc(user->useridLength + 1);
+	e->password = malloc(user->passwordLength + 1);
+	if (!e->username || !e->userid || !e->password)
+	{
+		TRACE_DEBUG(INFO, "%sNot enough memory to cache user record.",DIAMEAP_EXTENSION);
+		free(e->username);
+		free(e->userid);
+		free(e->password);
+		free(e);
+		return ENOMEM;
 	}
-	mysql_thread_init();
+	e->id = user->id;
+	memcpy(e->userid, user->userid, user->useridLength + 1);
+	e->useridLength = user->useridLength;
+	memcpy(e->password, user->password, user->passwordLength + 1);
+	e->passwordLength = user->passwordLength;
+	e->method = user->proposed_eap_method;
+	e->vendor = user->proposed_eap_method_vendor;
+	e->expire = time(NULL) + diameap_config->db.cache_ttl;
+
+	bucket = user_cache_bucket(username);
+
+	CHECK_POSIX(pthread_mutex_lock( &user_cache_mutex ));
+	/* Another thread may have stored the same user meanwhile */
+	for (li = bucket->next; li != bucket; li = li->next)
+	{
+		struct user_cache_entry * old = li->o;
+		if (!strcmp(old->username, username))
+		{
+			user_cache_free(old);
+			break;
+		}
+	}
+	fd_list_insert_after(bucket, &e->bucket);
+	fd_list_insert_after(&user_cache_lru, &e->lru);
+	user_cache_count++;
+	while (user_cache_count > diameap_config->db.cache_size)
+		user_cache_free(user_cache_lru.prev->o);
+	CHECK_POSIX(pthread_mutex_unlock( &user_cache_mutex ));
 
-	MYSQL_RES *res;
-	MYSQL_ROW row;
-	char * query;
-	CHECK_MALLOC(query=(char *)malloc(sizeof(char)*255));
+	return 0;
+}
 
-	sprintf(
-			query,
-			"SELECT id,username,password,eapmethod, vendor FROM users WHERE  users.username='%s' and users.active='Y' ",
-			username);
+static void user_cache_purge(void)
+{
+	CHECK_POSIX_DO(pthread_mutex_lock( &user_cache_mutex ), );
+	while (!FD_IS_LIST_EMPTY(&user_cache_lru))
+		user_cache_free(user_cache_lru.next->o);
+	CHECK_POSIX_DO(pthread_mutex_unlock( &user_cache_mutex ), );
+}
 
-	CHECK_POSIX(pthread_mutex_lock( &db_cs_mutex ));
 
-	if (mysql_query(db_conn, query))
+static int db_stmt_prepare(MYSQL * mysql, MYSQL_STMT ** stmt, const char * query)
+{
+	CHECK_MALLOC(*stmt = mysql_stmt_init(mysql));
+	if (mysql_stmt_prepare(*stmt, query, strlen(query)))
 	{
-		CHECK_POSIX(pthread_mutex_unlock( &db_cs_mutex ));
-		TRACE_DEBUG(INFO, "%sQuery execution fail. %s",DIAMEAP_EXTENSION, mysql_error(db_conn));
-		mysql_thread_end();
-		free(query);
-		query = NULL;
+		TRACE_DEBUG(INFO, "%sUnable to prepare statement: %s",DIAMEAP_EXTENSION, mysql_stmt_error(*stmt));
+		mysql_stmt_close(*stmt);
+		*stmt = NULL;
 		return EINVAL;
 	}
+	return 0;
+}
 
-	res = mysql_store_result(db_conn);
+static void db_conn_close_stmts(struct db_conn * c)
+{
+	if (c->user_stmt)
+		mysql_stmt_close(c->user_stmt);
+	if (c->authe_stmt)
+		mysql_stmt_close(c->authe_stmt);
+	if (c->authz_stmt)
+		mysql_stmt_close(c->authz_stmt);
+	c->user_stmt = c->authe_stmt = c->authz_stmt = NULL;
+}
 
-	CHECK_POSIX(pthread_mutex_unlock( &db_cs_mutex ));
+/* (Re)create the prepared statements of a connection */
+static int db_conn_prepare(struct db_conn * c)
+{
+	db_conn_close_stmts(c);
+	CHECK_FCT(db_stmt_prepare(c->mysql, &c->user_stmt, user_query));
+	CHECK_FCT(db_stmt_prepare(c->mysql, &c->authe_stmt, authe_query));
+	CHECK_FCT(db_stmt_prepare(c->mysql, &c->authz_stmt, authz_query));
+	return 0;
+}
 
-	if ((row = mysql_fetch_row(res)) != NULL)
-	{
+/* Take an idle connection from the pool, waiting for one if they are all in use */
+static int db_conn_get(struct db_conn ** conn)
+{
+	int ret = 0;
 
-		user->id = atoi(row[0]);
-		CHECK_MALLOC(user->userid=malloc(strlen(row[1])+1));
-		memcpy(user->userid,row[1],strlen(row[1])+1);
-		user->useridLength = strlen(row[1]);
-		CHECK_MALLOC(user->password=malloc(strlen(row[2])+1));
-		memcpy(user->password, row[2],strlen(row[2])+1);
-		user->passwordLength = strlen(row[2]);
-		user->proposed_eap_method = atoi(row[3]);
-		user->proposed_eap_method_vendor = atoi(row[4]);
-
-		mysql_free_result(res);
-		mysql_thread_end();
-		free(query);
-		query = NULL;
-		return 0;
+	CHECK_POSIX(pthread_mutex_lock( &db_cs_mutex ));
+	pthread_cleanup_push(fd_cleanup_mutex, &db_cs_mutex);
+	while (db_pool && !db_idle)
+	{
+		CHECK_POSIX_DO(ret = pthread_cond_wait( &db_cs_cond, &db_cs_mutex ), break);
 	}
+	if (!ret)
+	{
+		if (db_idle)
+		{
+			*conn = db_idle;
+			db_idle = db_idle->next;
+		}
+		else
+		{
+			TRACE_DEBUG(INFO, "%sNot connected to the MySQL Database server.",DIAMEAP_EXTENSION);
+			ret = EINVAL;
+		}
+	}
+	pthread_cleanup_pop(0);
+	CHECK_POSIX(pthread_mutex_unlock( &db_cs_mutex ));
 
-	TRACE_DEBUG(INFO, "%sUser unavailable.",DIAMEAP_EXTENSION);
-	mysql_free_result(res);
-	mysql_thread_end();
-	free(query);
-	query = NULL;
-	return EINVAL;
-
+	return ret;
 }
 
-int diameap_authentication_get_attribs(struct eap_user *user,
-		struct fd_list * attribute_list)
+static void db_conn_release(struct db_conn * c)
 {
+	CHECK_POSIX_DO(pthread_mutex_lock( &db_cs_mutex ), );
+	c->next = db_idle;
+	db_idle = c;
+	CHECK_POSIX_DO(pthread_cond_signal( &db_cs_cond ), );
+	CHECK_POSIX_DO(pthread_mutex_unlock( &db_cs_mutex ), );
+}
 
-	TRACE_ENTRY("%p %p",user,attribute_list);
+/* Execute a prepared statement and buffer its result set. If the execution fails (e.g. the server
+ connection was lost and re-established by the client library), prepare the statements again and retry once. */
+static int db_stmt_exec(struct db_conn * c, MYSQL_STMT ** stmt, MYSQL_BIND * params, MYSQL_BIND * results)
+{
+	int retry = 1;
 
-	if (db_conn == NULL)
+	while (1)
 	{
-		TRACE_DEBUG(INFO, "%sNot connected to the MySQL Database server.",DIAMEAP_EXTENSION);
+		if (*stmt == NULL)
+		{
+			TRACE_DEBUG(INFO, "%sStatement not prepared on this connection.",DIAMEAP_EXTENSION);
+		}
+		else
+		{
+			if (!mysql_stmt_bind_param(*stmt, params) && !mysql_stmt_bind_result(*stmt, results)
+					&& !mysql_stmt_execute(*stmt) && !mysql_stmt_store_result(*stmt))
+				return 0;
+
+			TRACE_DEBUG(INFO, "%sQuery execution fail. %s",DIAMEAP_EXTENSION, mysql_stmt_error(*stmt));
+		}
+
+		if (!retry-- || mysql_ping(c->mysql))
+			return EINVAL;
+
+		CHECK_FCT(db_conn_prepare(c));
+	}
+}
 
-		return EINVAL;
+int diameap_get_eap_user(struct eap_user * user, char * username)
+{
+	struct db_conn * c;
+	MYSQL_BIND param[1], result[5];
+	unsigned long username_len, lengths[5];
+	int id = 0, method = 0, vendor = 0;
+	char userid[DB_FIELD_LEN], password[DB_FIELD_LEN];
+	int ret;
 
-	}
+	TRACE_ENTRY("%p %p",user,username);
+
+	if (user_cache_fetch(user, username) == 0)
+		return 0;
 
 	mysql_thread_init();
-	MYSQL_RES *res;
-	MYSQL_ROW row;
-	char * query;
-	CHECK_MALLOC(query=malloc(sizeof(char)*255));
 
-	sprintf(
-			query,
-			"SELECT `authe`.`attribute` ,`authe`.`value` FROM `authe` WHERE `authe`.`grp` IN ( SELECT `user_grp`.`grp` FROM `user_grp` WHERE `user_grp`.`user` = %d ) ",
-			user->id);
+	memset(param, 0, sizeof(param));
+	username_len = strlen(username);
+	param[0].buffer_type = MYSQL_TYPE_STRING;
+	param[0].buffer = username;
+	param[0].buffer_length = username_len;
+	param[0].length = &username_len;
+
+	memset(result, 0, sizeof(result));
+	result[0].buffer_type = MYSQL_TYPE_LONG;
+	result[0].buffer = &id;
+	result[1].buffer_type = MYSQL_TYPE_STRING;
+	result[1].buffer = userid;
+	result[1].buffer_length = sizeof(userid);
+	result[1].length = &lengths[1];
+	result[2].buffer_type = MYSQL_TYPE_STRING;
+	result[2].buffer = password;
+	result[2].buffer_length = sizeof(password);
+	result[2].length = &lengths[2];
+	result[3].buffer_type = MYSQL_TYPE_LONG;
+	result[3].buffer = &method;
+	result[4].buffer_type = MYSQL_TYPE_LONG;
+	result[4].buffer = &vendor;
+
+	CHECK_FCT_DO(ret = db_conn_get(&c), { mysql_thread_end(); return ret; });
+
+	ret = db_stmt_exec(c, &c->user_stmt, param, result);
+	if (!ret)
+	{
+		switch (mysql_stmt_fetch(c->user_stmt))
+		{
+			case 0:
+				break;
+			case MYSQL_NO_DATA:
+				TRACE_DEBUG(INFO, "%sUser unavailable.",DIAMEAP_EXTENSION);
+				ret = EINVAL;
+				break;
+			default:
+				TRACE_DEBUG(INFO, "%sUnable to fetch user record. %s",DIAMEAP_EXTENSION, mysql_stmt_error(c->user_stmt));
+				ret = EINVAL;
+		}
+		mysql_stmt_free_result(c->user_stmt);
+	}
 
-	CHECK_POSIX(pthread_mutex_lock( &db_cs_mutex ));
+	db_conn_release(c);
+	mysql_thread_end();
+
+	if (ret)
+		return ret;
+
+	/* The values longer than the buffers were truncated */
+	if (lengths[1] > sizeof(userid))
+		lengths[1] = sizeof(userid);
+	if (lengths[2] > sizeof(password))
+		lengths[2] = sizeof(password);
+
+	user->id = id;
+	CHECK_MALLOC(user->userid=malloc(lengths[1]+1));
+	memcpy(user->userid,userid,lengths[1]);
+	user->userid[lengths[1]] = '\0';
+	user->useridLength = lengths[1];
+	CHECK_MALLOC(user->password=malloc(lengths[2]+1));
+	memcpy(user->password,password,lengths[2]);
+	user->password[lengths[2]] = '\0';
+	user->passwordLength = lengths[2];
+	user->proposed_eap_method = method;
+	user->proposed_eap_method_vendor = vendor;
+
+	CHECK_FCT_DO(user_cache_store(user, username), /* continue */);
+
+	return 0;
+}
+
+/* Retrieve the authentication (authe) or authorization (authz, with op column) attributes of a user */
+static int diameap_get_attribs(struct eap_user *user, struct fd_list * attribute_list, int authz)
+{
+	struct db_conn * c;
+	MYSQL_STMT ** stmt;
+	MYSQL_BIND param[1], result[3];
+	unsigned long lengths[3];
+	char fields[3][DB_FIELD_LEN + 1];
+	int ncol = authz ? 3 : 2;
+	int i, ret;
+
+	mysql_thread_init();
+
+	memset(param, 0, sizeof(param));
+	param[0].buffer_type = MYSQL_TYPE_LONG;
+	param[0].buffer = &user->id;
 
-	if (mysql_query(db_conn, query))
+	memset(result, 0, sizeof(result));
+	for (i = 0; i < ncol; i++)
 	{
-		CHECK_POSIX(pthread_mutex_unlock( &db_cs_mutex ));
-		TRACE_DEBUG(INFO, "%sQuery execution fail. %s",DIAMEAP_EXTENSION, mysql_error(db_conn));
-		mysql_thread_end();
-		free(query);
-		query = NULL;
-		return EINVAL;
+		result[i].buffer_type = MYSQL_TYPE_STRING;
+		result[i].buffer = fields[i];
+		result[i].buffer_length = DB_FIELD_LEN;
+		result[i].length = &lengths[i];
 	}
 
-	res = mysql_store_result(db_conn);
-
-	CHECK_POSIX(pthread_mutex_unlock( &db_cs_mutex ));
+	CHECK_FCT_DO(ret = db_conn_get(&c), { mysql_thread_end(); return ret; });
 
-	while ((row = mysql_fetch_row(res)))
+	stmt = authz ? &c->authz_stmt : &c->authe_stmt;
+	ret = db_stmt_exec(c, stmt, param, result);
+	while (!ret)
 	{
 		struct auth_attribute * attribute;
-		CHECK_MALLOC(attribute = malloc(sizeof(struct auth_attribute)));
+		int fetch = mysql_stmt_fetch(*stmt);
+
+		if (fetch == MYSQL_NO_DATA)
+			break;
+		if (fetch)
+		{
+			TRACE_DEBUG(INFO, "%sUnable to fetch attribute. %s",DIAMEAP_EXTENSION, mysql_stmt_error(*stmt));
+			ret = EINVAL;
+			break;
+		}
+		for (i = 0; i < ncol; i++) {
+			/* lengths[i] is the length of the column value, which may have been truncated */
+			if (lengths[i] > DB_FIELD_LEN)
+				lengths[i] = DB_FIELD_LEN;
+			fields[i][lengths[i]] = '\0';
+		}
+
+		CHECK_MALLOC_DO(attribute = malloc(sizeof(struct auth_attribute)), { ret = ENOMEM; break; });
 		memset(attribute, 0, sizeof(struct auth_attribute));
 		fd_list_init(&attribute->chain, NULL);
-		attribute->attrib = strdup(row[0]);
-		attribute->op = NULL;
-		attribute->value = strdup(row[1]);
+		attribute->attrib = strdup(fields[0]);
+		attribute->op = authz ? strdup(fields[1]) : NULL;
+		attribute->value = strdup(fields[ncol - 1]);
 		fd_list_insert_before(attribute_list, &attribute->chain);
-
 	}
+	if (*stmt)
+		mysql_stmt_free_result(*stmt);
 
-	mysql_free_result(res);
+	db_conn_release(c);
 	mysql_thread_end();
-	free(query);
-	query = NULL;
-	return 0;
+	return ret;
 }
 
-int diameap_authorization_get_attribs(struct eap_user *user,
+int diameap_authentication_get_attribs(struct eap_user *user,
 		struct fd_list * attribute_list)
 {
 	TRACE_ENTRY("%p %p",user,attribute_list);
 
-	if (db_conn == NULL)
-	{
-		TRACE_DEBUG(INFO, "%sNot connected to the MySQL Database server.",DIAMEAP_EXTENSION);
+	return diameap_get_attribs(user, attribute_list, 0);
+}
 
-		return EINVAL;
+int diameap_authorization_get_attribs(struct eap_user *user,
+		struct fd_list * attribute_list)
+{
+	TRACE_ENTRY("%p %p",user,attribute_list);
 
-	}
+	return diameap_get_attribs(user, attribute_list, 1);
+}
 
-	mysql_thread_init();
+/* Connecting to MySQL Database: open the pool of connections and prepare the statements on each of them */
+int diameap_mysql_connect(void)
+{
+	int i;
 
-	MYSQL_RES *res;
-	MYSQL_ROW row;
-	char * query;
-	CHECK_MALLOC(query=malloc(sizeof(char)*255));
+	TRACE_ENTRY();
 
-	sprintf(
-			query,
-			"SELECT `authz`.`attribute` , `authz`.`op` , `authz`.`value` FROM `authz` WHERE `authz`.`grp` IN ( SELECT `user_grp`.`grp` FROM `user_grp` WHERE `user_grp`.`user` = %d ) ",
-			user->id);
+	for (i = 0; i < USER_CACHE_BUCKETS; i++)
+		fd_list_init(&user_cache_buckets[i], NULL);
 
-	CHECK_POSIX(pthread_mutex_lock( &db_cs_mutex ));
+	if (diameap_config->db.pool_size <= 0)
+		diameap_config->db.pool_size = 1;
 
-	if (mysql_query(db_conn, query))
-	{
-		CHECK_POSIX(pthread_mutex_unlock( &db_cs_mutex ));
-		TRACE_DEBUG(INFO, "%sQuery execution fail. %s",DIAMEAP_EXTENSION, mysql_error(db_conn));
-		mysql_thread_end();
-		free(query);
-		query = NULL;
-		return EINVAL;
-	}
-
-	res = mysql_store_result(db_conn);
-
-	CHECK_POSIX(pthread_mutex_unlock( &db_cs_mutex ));
+	CHECK_MALLOC(db_pool = calloc(diameap_config->db.pool_size, sizeof(struct db_conn)));
+	db_pool_size = diameap_config->db.pool_size;
 
-	while ((row = mysql_fetch_row(res)))
+	for (i = 0; i < db_pool_size; i++)
 	{
-		struct auth_attribute * attribute;
-		CHECK_MALLOC(attribute = malloc(sizeof(struct auth_attribute)));
-		memset(attribute, 0, sizeof(struct auth_attribute));
-		fd_list_init(&attribute->chain, NULL);
-		attribute->attrib = strdup(row[0]);
-		attribute->op = strdup(row[1]);
-		attribute->value = strdup(row[2]);
-		fd_list_insert_before(attribute_list, &attribute->chain);
+		struct db_conn * c = &db_pool[i];
+		const my_bool mysql_reconnect_val=1;
+
+		CHECK_MALLOC(c->mysql = mysql_init(NULL));
+		mysql_options(c->mysql,MYSQL_OPT_RECONNECT,&mysql_reconnect_val);
+		/* Connect to database */
+		if (!mysql_real_connect(c->mysql, diameap_config->db.server,
+				diameap_config->db.user, diameap_config->db.password,
+				diameap_config->db.database, 0, NULL, 0))
+		{
+			TRACE_DEBUG(INFO,"%sConnection to MySQL Database Server failed: %s",DIAMEAP_EXTENSION, mysql_error(c->mysql));
+			return errno;
+		}
+		CHECK_FCT(db_conn_prepare(c));
+
+		c->next = db_idle;
+		db_idle = c;
 	}
-
-	mysql_free_result(res);
-	mysql_thread_end();
-	free(query);
-	query = NULL;
 	return 0;
 }
 
 void diameap_mysql_disconnect()
 {
-	mysql_close(db_conn);
+	int i;
+
+	CHECK_POSIX_DO(pthread_mutex_lock( &db_cs_mutex ), );
+	for (i = 0; i < db_pool_size; i++)
+	{
+		db_conn_close_stmts(&db_pool[i]);
+		if (db_pool[i].mysql)
+			mysql_close(db_pool[i].mysql);
+	}
+	free(db_pool);
+	db_pool = NULL;
+	db_idle = NULL;
+	db_pool_size = 0;
+	CHECK_POSIX_DO(pthread_cond_broadcast( &db_cs_cond ), );
+	CHECK_POSIX_DO(pthread_mutex_unlock( &db_cs_mutex ), );
+
+	user_cache_purge();
 }
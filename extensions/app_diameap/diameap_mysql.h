@@ -42,17 +42,16 @@
 #include "libdiameap.h"
 #include <mysql.h>
 
-/* MySQL Database connection */
-MYSQL *db_conn;
-
 int diameap_get_eap_user(struct eap_user * user, char * username);
 
+/* Open the pool of connections to the MySQL Database */
 int diameap_mysql_connect();
 
 int diameap_mysql_reconnect();
 
 int diameap_set_mysql_param(char * user, char * passwd, char * server, char * database);
 
+/* Close the pool and flush the users cache */
 void diameap_mysql_disconnect();
 
 /* */
@@ -120,6 +120,15 @@ static void * mn_thr(void * arg)
 			CHECK_FCT_DO( fd_stat_getstats(STAT_P_TOSEND, p, &current_count, &limit_count, &highest_count, &total_count, &total, &blocking, &last), );
 			display_info("Outgoing", p->info.pi_diamid, current_count, limit_count, highest_count, total_count, &total, &blocking, &last);
 			
+			{
+				unsigned long long msgs = 0, calls = 0;
+				CHECK_FCT_DO( fd_peer_cnx_rcv_stats(p, &msgs, &calls), );
+				if (msgs) {
+					TRACE_DEBUG(INFO, "'Received'@'%s': %llu messages in %llu recv calls (%.2f calls/msg)",
+						p->info.pi_diamid, msgs, calls, (double)calls / msgs);
+				}
+			}
+			
 		}
 
 		CHECK_FCT_DO( pthread_rwlock_unlock(&fd_g_peers_rw), /* continue */ );
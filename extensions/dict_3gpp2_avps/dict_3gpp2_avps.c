@@ -43,6 +43,12 @@ const double _3gpp2_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,12 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_3gpp2_avps_defs[] = {
+	/* 3GPP2-BSID */
+	{ DICT_AVP, &(struct dict_avp_data){ 9010, 5535, "3GPP2-BSID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+};
+
 static int dict_3gpp2_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,35 +122,7 @@ static int dict_3gpp2_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* 3GPP2-BSID */
-		{
-			struct dict_avp_data data = {
-				9010,	/* Code */
-				5535,	/* Vendor */
-				"3GPP2-BSID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-
-	
-   }
+   CHECK_dict_new_batch( dict_3gpp2_avps_defs );
 
    /* Commands section */
    {
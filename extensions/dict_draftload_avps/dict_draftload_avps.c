@@ -43,6 +43,12 @@ const double draftload_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,86 +103,27 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_draftload_avps_defs[] = {
+	/* Load-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Load-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HOST", { .i32=0 } }, "Enumerated(Load-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PEER", { .i32=1 } }, "Enumerated(Load-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 651, 0, "Load-Type", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "Enumerated(Load-Type)" },
+	/* Load-Value */
+	{ DICT_AVP, &(struct dict_avp_data){ 652, 0, "Load-Value", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* SourceID */
+	{ DICT_AVP, &(struct dict_avp_data){ 649, 0, "SourceID", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* Load */
+	{ DICT_AVP, &(struct dict_avp_data){ 650, 0, "Load", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_draftload_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* Load-Type */
-		{
-			struct dict_avp_data data = {
-				651,	/* Code */
-				0,	/* Vendor */
-				"Load-Type",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Load-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "HOST", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PEER", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Load-Value */
-		{
-			struct dict_avp_data data = {
-				652,	/* Code */
-				0,	/* Vendor */
-				"Load-Value",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SourceID */
-		{
-			struct dict_avp_data data = {
-				649,	/* Code */
-				0,	/* Vendor */
-				"SourceID",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* Load */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				650,	/* Code */
-				0,	/* Vendor */
-				"Load",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_draftload_avps_defs );
 
    /* Commands section */
    {
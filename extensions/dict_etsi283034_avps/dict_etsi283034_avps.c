@@ -43,6 +43,12 @@ const double etsi283034_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,28 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_etsi283034_avps_defs[] = {
+	/* Address-Realm */
+	{ DICT_AVP, &(struct dict_avp_data){ 301, 13019, "Address-Realm", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Logical-Access-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 302, 13019, "Logical-Access-Id", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Physical-Access-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 303, 13019, "Physical-Access-Id", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Line-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 500, 13019, "Line-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Reservation-Priority */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "ETSI/Enumerated(Reservation-Priority)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_ONE", { .i32=1 } }, "ETSI/Enumerated(Reservation-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_TWO", { .i32=2 } }, "ETSI/Enumerated(Reservation-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_THREE", { .i32=3 } }, "ETSI/Enumerated(Reservation-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_FOUR", { .i32=4 } }, "ETSI/Enumerated(Reservation-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_FIVE", { .i32=5 } }, "ETSI/Enumerated(Reservation-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_SIX", { .i32=6 } }, "ETSI/Enumerated(Reservation-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_SEVEN", { .i32=7 } }, "ETSI/Enumerated(Reservation-Priority)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 458, 13019, "Reservation-Priority", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "ETSI/Enumerated(Reservation-Priority)" },
+};
+
 static int dict_etsi283034_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,101 +138,7 @@ static int dict_etsi283034_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* Address-Realm */
-		{
-			struct dict_avp_data data = {
-				301,	/* Code */
-				13019,	/* Vendor */
-				"Address-Realm",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Logical-Access-Id */
-		{
-			struct dict_avp_data data = {
-				302,	/* Code */
-				13019,	/* Vendor */
-				"Logical-Access-Id",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Physical-Access-Id */
-		{
-			struct dict_avp_data data = {
-				303,	/* Code */
-				13019,	/* Vendor */
-				"Physical-Access-Id",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Line-Identifier */
-		{
-			struct dict_avp_data data = {
-				500,	/* Code */
-				13019,	/* Vendor */
-				"Line-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Reservation-Priority */
-		{
-			struct dict_avp_data data = {
-				458,	/* Code */
-				13019,	/* Vendor */
-				"Reservation-Priority",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "ETSI/Enumerated(Reservation-Priority)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PRIORITY_ONE", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "PRIORITY_TWO", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "PRIORITY_THREE", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "PRIORITY_FOUR", { .i32=4 }};
-			struct dict_enumval_data        t_5 = { "PRIORITY_FIVE", { .i32=5 }};
-			struct dict_enumval_data        t_6 = { "PRIORITY_SIX", { .i32=6 }};
-			struct dict_enumval_data        t_7 = { "PRIORITY_SEVEN", { .i32=7 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-
-	
-   }
+   CHECK_dict_new_batch( dict_etsi283034_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double rfc4004_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,408 +103,80 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_rfc4004_avps_defs[] = {
+	/* MIP-Reg-Request */
+	{ DICT_AVP, &(struct dict_avp_data){ 320, 0, "MIP-Reg-Request", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP-Reg-Reply */
+	{ DICT_AVP, &(struct dict_avp_data){ 321, 0, "MIP-Reg-Reply", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP-Mobile-Node-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 333, 0, "MIP-Mobile-Node-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* MIP-Home-Agent-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 334, 0, "MIP-Home-Agent-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* MIP-Candidate-Home-Agent-Host */
+	{ DICT_AVP, &(struct dict_avp_data){ 336, 0, "MIP-Candidate-Home-Agent-Host", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* MIP-Feature-Vector */
+	{ DICT_AVP, &(struct dict_avp_data){ 337, 0, "MIP-Feature-Vector", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-Auth-Input-Data-Length */
+	{ DICT_AVP, &(struct dict_avp_data){ 338, 0, "MIP-Auth-Input-Data-Length", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-Authenticator-Length */
+	{ DICT_AVP, &(struct dict_avp_data){ 339, 0, "MIP-Authenticator-Length", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-Authenticator-Offset */
+	{ DICT_AVP, &(struct dict_avp_data){ 340, 0, "MIP-Authenticator-Offset", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-MN-AAA-SPI */
+	{ DICT_AVP, &(struct dict_avp_data){ 341, 0, "MIP-MN-AAA-SPI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-Filter-Rule */
+	{ DICT_AVP, &(struct dict_avp_data){ 342, 0, "MIP-Filter-Rule", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "IPFilterRule" },
+	/* MIP-FA-Challenge */
+	{ DICT_AVP, &(struct dict_avp_data){ 344, 0, "MIP-FA-Challenge", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP-Home-Agent-Host */
+	{ DICT_AVP, &(struct dict_avp_data){ 348, 0, "MIP-Home-Agent-Host", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* MIP-FA-to-HA-SPI */
+	{ DICT_AVP, &(struct dict_avp_data){ 318, 0, "MIP-FA-to-HA-SPI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-FA-to-MN-SPI */
+	{ DICT_AVP, &(struct dict_avp_data){ 319, 0, "MIP-FA-to-MN-SPI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-HA-to-FA-SPI */
+	{ DICT_AVP, &(struct dict_avp_data){ 323, 0, "MIP-HA-to-FA-SPI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-Nonce */
+	{ DICT_AVP, &(struct dict_avp_data){ 335, 0, "MIP-Nonce", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP-Session-Key */
+	{ DICT_AVP, &(struct dict_avp_data){ 343, 0, "MIP-Session-Key", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP-Algorithm-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(MIP-Algorithm-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HMAC-SHA-1", { .i32=2 } }, "Enumerated(MIP-Algorithm-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 345, 0, "MIP-Algorithm-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(MIP-Algorithm-Type)" },
+	/* MIP-Replay-Mode */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(MIP-Replay-Mode)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "None", { .i32=1 } }, "Enumerated(MIP-Replay-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Timestamps", { .i32=2 } }, "Enumerated(MIP-Replay-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Nonces", { .i32=3 } }, "Enumerated(MIP-Replay-Mode)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 346, 0, "MIP-Replay-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(MIP-Replay-Mode)" },
+	/* MIP-MSA-Lifetime */
+	{ DICT_AVP, &(struct dict_avp_data){ 367, 0, "MIP-MSA-Lifetime", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-FA-to-HA-MSA */
+	{ DICT_AVP, &(struct dict_avp_data){ 328, 0, "MIP-FA-to-HA-MSA", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MIP-MN-to-FA-MSA */
+	{ DICT_AVP, &(struct dict_avp_data){ 325, 0, "MIP-MN-to-FA-MSA", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MIP-Originating-Foreign-AAA */
+	{ DICT_AVP, &(struct dict_avp_data){ 347, 0, "MIP-Originating-Foreign-AAA", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MIP-HA-to-MN-MSA */
+	{ DICT_AVP, &(struct dict_avp_data){ 332, 0, "MIP-HA-to-MN-MSA", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MIP-MN-AAA-Auth */
+	{ DICT_AVP, &(struct dict_avp_data){ 322, 0, "MIP-MN-AAA-Auth", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MIP-FA-to-MN-MSA */
+	{ DICT_AVP, &(struct dict_avp_data){ 326, 0, "MIP-FA-to-MN-MSA", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MIP-HA-to-FA-MSA */
+	{ DICT_AVP, &(struct dict_avp_data){ 329, 0, "MIP-HA-to-FA-MSA", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MIP-MN-to-HA-MSA */
+	{ DICT_AVP, &(struct dict_avp_data){ 331, 0, "MIP-MN-to-HA-MSA", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_rfc4004_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* MIP-Reg-Request */
-		{
-			struct dict_avp_data data = {
-				320,	/* Code */
-				0,	/* Vendor */
-				"MIP-Reg-Request",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Reg-Reply */
-		{
-			struct dict_avp_data data = {
-				321,	/* Code */
-				0,	/* Vendor */
-				"MIP-Reg-Reply",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Mobile-Node-Address */
-		{
-			struct dict_avp_data data = {
-				333,	/* Code */
-				0,	/* Vendor */
-				"MIP-Mobile-Node-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* MIP-Home-Agent-Address */
-		{
-			struct dict_avp_data data = {
-				334,	/* Code */
-				0,	/* Vendor */
-				"MIP-Home-Agent-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* MIP-Candidate-Home-Agent-Host */
-		{
-			struct dict_avp_data data = {
-				336,	/* Code */
-				0,	/* Vendor */
-				"MIP-Candidate-Home-Agent-Host",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* MIP-Feature-Vector */
-		{
-			struct dict_avp_data data = {
-				337,	/* Code */
-				0,	/* Vendor */
-				"MIP-Feature-Vector",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Auth-Input-Data-Length */
-		{
-			struct dict_avp_data data = {
-				338,	/* Code */
-				0,	/* Vendor */
-				"MIP-Auth-Input-Data-Length",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Authenticator-Length */
-		{
-			struct dict_avp_data data = {
-				339,	/* Code */
-				0,	/* Vendor */
-				"MIP-Authenticator-Length",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Authenticator-Offset */
-		{
-			struct dict_avp_data data = {
-				340,	/* Code */
-				0,	/* Vendor */
-				"MIP-Authenticator-Offset",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-MN-AAA-SPI */
-		{
-			struct dict_avp_data data = {
-				341,	/* Code */
-				0,	/* Vendor */
-				"MIP-MN-AAA-SPI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Filter-Rule */
-		{
-			struct dict_avp_data data = {
-				342,	/* Code */
-				0,	/* Vendor */
-				"MIP-Filter-Rule",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, IPFilterRule_type, NULL);
-		};
-		/* MIP-FA-Challenge */
-		{
-			struct dict_avp_data data = {
-				344,	/* Code */
-				0,	/* Vendor */
-				"MIP-FA-Challenge",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Home-Agent-Host */
-		{
-			struct dict_avp_data data = {
-				348,	/* Code */
-				0,	/* Vendor */
-				"MIP-Home-Agent-Host",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* MIP-FA-to-HA-SPI */
-		{
-			struct dict_avp_data data = {
-				318,	/* Code */
-				0,	/* Vendor */
-				"MIP-FA-to-HA-SPI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-FA-to-MN-SPI */
-		{
-			struct dict_avp_data data = {
-				319,	/* Code */
-				0,	/* Vendor */
-				"MIP-FA-to-MN-SPI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-HA-to-FA-SPI */
-		{
-			struct dict_avp_data data = {
-				323,	/* Code */
-				0,	/* Vendor */
-				"MIP-HA-to-FA-SPI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Nonce */
-		{
-			struct dict_avp_data data = {
-				335,	/* Code */
-				0,	/* Vendor */
-				"MIP-Nonce",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Session-Key */
-		{
-			struct dict_avp_data data = {
-				343,	/* Code */
-				0,	/* Vendor */
-				"MIP-Session-Key",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Algorithm-Type */
-		{
-			struct dict_avp_data data = {
-				345,	/* Code */
-				0,	/* Vendor */
-				"MIP-Algorithm-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(MIP-Algorithm-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "HMAC-SHA-1", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MIP-Replay-Mode */
-		{
-			struct dict_avp_data data = {
-				346,	/* Code */
-				0,	/* Vendor */
-				"MIP-Replay-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(MIP-Replay-Mode)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "None", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "Timestamps", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "Nonces", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MIP-MSA-Lifetime */
-		{
-			struct dict_avp_data data = {
-				367,	/* Code */
-				0,	/* Vendor */
-				"MIP-MSA-Lifetime",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-FA-to-HA-MSA */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				328,	/* Code */
-				0,	/* Vendor */
-				"MIP-FA-to-HA-MSA",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MIP-MN-to-FA-MSA */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				325,	/* Code */
-				0,	/* Vendor */
-				"MIP-MN-to-FA-MSA",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MIP-Originating-Foreign-AAA */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				347,	/* Code */
-				0,	/* Vendor */
-				"MIP-Originating-Foreign-AAA",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MIP-HA-to-MN-MSA */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				332,	/* Code */
-				0,	/* Vendor */
-				"MIP-HA-to-MN-MSA",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MIP-MN-AAA-Auth */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				322,	/* Code */
-				0,	/* Vendor */
-				"MIP-MN-AAA-Auth",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MIP-FA-to-MN-MSA */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				326,	/* Code */
-				0,	/* Vendor */
-				"MIP-FA-to-MN-MSA",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MIP-HA-to-FA-MSA */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				329,	/* Code */
-				0,	/* Vendor */
-				"MIP-HA-to-FA-MSA",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MIP-MN-to-HA-MSA */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				331,	/* Code */
-				0,	/* Vendor */
-				"MIP-MN-to-HA-MSA",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_rfc4004_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double rfc4006bis_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,1026 +103,212 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_rfc4006bis_avps_defs[] = {
+	/* CC-Correlation-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 411, 0, "CC-Correlation-Id", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* CC-Input-Octets */
+	{ DICT_AVP, &(struct dict_avp_data){ 412, 0, "CC-Input-Octets", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* CC-Output-Octets */
+	{ DICT_AVP, &(struct dict_avp_data){ 414, 0, "CC-Output-Octets", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* CC-Request-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 415, 0, "CC-Request-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* CC-Request-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(CC-Request-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INITIAL_REQUEST", { .i32=1 } }, "Enumerated(CC-Request-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UPDATE_REQUEST", { .i32=2 } }, "Enumerated(CC-Request-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TERMINATION_REQUEST", { .i32=3 } }, "Enumerated(CC-Request-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EVENT_REQUEST", { .i32=4 } }, "Enumerated(CC-Request-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 416, 0, "CC-Request-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(CC-Request-Type)" },
+	/* CC-Service-Specific-Units */
+	{ DICT_AVP, &(struct dict_avp_data){ 417, 0, "CC-Service-Specific-Units", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* CC-Session-Failover */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(CC-Session-Failover)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FAILOVER_NOT_SUPPORTED", { .i32=0 } }, "Enumerated(CC-Session-Failover)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FAILOVER_SUPPORTED", { .i32=1 } }, "Enumerated(CC-Session-Failover)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 418, 0, "CC-Session-Failover", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(CC-Session-Failover)" },
+	/* CC-Sub-Session-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 419, 0, "CC-Sub-Session-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* CC-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 420, 0, "CC-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* CC-Total-Octets */
+	{ DICT_AVP, &(struct dict_avp_data){ 421, 0, "CC-Total-Octets", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* CC-Unit-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(CC-Unit-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TIME", { .i32=0 } }, "Enumerated(CC-Unit-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MONEY", { .i32=1 } }, "Enumerated(CC-Unit-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TOTAL_OCTETS", { .i32=2 } }, "Enumerated(CC-Unit-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INPUT_OCTETS", { .i32=3 } }, "Enumerated(CC-Unit-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "OUTPUT_OCTETS", { .i32=4 } }, "Enumerated(CC-Unit-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SERVICE_SPECIFIC_UNITS", { .i32=5 } }, "Enumerated(CC-Unit-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 454, 0, "CC-Unit-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(CC-Unit-Type)" },
+	/* Check-Balance-Result */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Check-Balance-Result)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENOUGH_CREDIT", { .i32=0 } }, "Enumerated(Check-Balance-Result)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_CREDIT", { .i32=1 } }, "Enumerated(Check-Balance-Result)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 422, 0, "Check-Balance-Result", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Check-Balance-Result)" },
+	/* Cost-Unit */
+	{ DICT_AVP, &(struct dict_avp_data){ 424, 0, "Cost-Unit", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Credit-Control */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Credit-Control)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CREDIT_AUTHORIZATION", { .i32=0 } }, "Enumerated(Credit-Control)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RE_AUTHORIZATION", { .i32=1 } }, "Enumerated(Credit-Control)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 426, 0, "Credit-Control", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Credit-Control)" },
+	/* Credit-Control-Failure-Handling */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Credit-Control-Failure-Handling)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TERMINATE", { .i32=0 } }, "Enumerated(Credit-Control-Failure-Handling)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CONTINUE", { .i32=1 } }, "Enumerated(Credit-Control-Failure-Handling)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RETRY_AND_TERMINATE", { .i32=2 } }, "Enumerated(Credit-Control-Failure-Handling)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 427, 0, "Credit-Control-Failure-Handling", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Credit-Control-Failure-Handling)" },
+	/* Currency-Code */
+	{ DICT_AVP, &(struct dict_avp_data){ 425, 0, "Currency-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Direct-Debiting-Failure-Handling */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Direct-Debiting-Failure-Handling)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TERMINATE_OR_BUFFER", { .i32=0 } }, "Enumerated(Direct-Debiting-Failure-Handling)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CONTINUE", { .i32=1 } }, "Enumerated(Direct-Debiting-Failure-Handling)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 428, 0, "Direct-Debiting-Failure-Handling", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Direct-Debiting-Failure-Handling)" },
+	/* Exponent */
+	{ DICT_AVP, &(struct dict_avp_data){ 429, 0, "Exponent", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* Final-Unit-Action */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Final-Unit-Action)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TERMINATE", { .i32=0 } }, "Enumerated(Final-Unit-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REDIRECT", { .i32=1 } }, "Enumerated(Final-Unit-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESTRICT_ACCESS", { .i32=2 } }, "Enumerated(Final-Unit-Action)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 449, 0, "Final-Unit-Action", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Final-Unit-Action)" },
+	/* G-S-U-Pool-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 453, 0, "G-S-U-Pool-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Multiple-Services-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Multiple-Services-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MULTIPLE_SERVICES_NOT_SUPPORTED", { .i32=0 } }, "Enumerated(Multiple-Services-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MULTIPLE_SERVICES_SUPPORTED", { .i32=1 } }, "Enumerated(Multiple-Services-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 455, 0, "Multiple-Services-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Multiple-Services-Indicator)" },
+	/* Rating-Group */
+	{ DICT_AVP, &(struct dict_avp_data){ 432, 0, "Rating-Group", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Redirect-Address-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Redirect-Address-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPv4_Address", { .i32=0 } }, "Enumerated(Redirect-Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPv6_Address", { .i32=1 } }, "Enumerated(Redirect-Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "URL", { .i32=2 } }, "Enumerated(Redirect-Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SIP_URI", { .i32=3 } }, "Enumerated(Redirect-Address-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 433, 0, "Redirect-Address-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Redirect-Address-Type)" },
+	/* Redirect-Server-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 435, 0, "Redirect-Server-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Redirect-Address-IPAddress */
+	{ DICT_AVP, &(struct dict_avp_data){ 99996, 0, "Redirect-Address-IPAddress", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Redirect-Address-URL */
+	{ DICT_AVP, &(struct dict_avp_data){ 99997, 0, "Redirect-Address-URL", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Redirect-Address-SIP-URI */
+	{ DICT_AVP, &(struct dict_avp_data){ 99998, 0, "Redirect-Address-SIP-URI", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Requested-Action */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Requested-Action)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DIRECT_DEBITING", { .i32=0 } }, "Enumerated(Requested-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REFUND_ACCOUNT", { .i32=1 } }, "Enumerated(Requested-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHECK_BALANCE", { .i32=2 } }, "Enumerated(Requested-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRICE_ENQUIRY", { .i32=3 } }, "Enumerated(Requested-Action)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 436, 0, "Requested-Action", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Requested-Action)" },
+	/* Restriction-Filter-Rule */
+	{ DICT_AVP, &(struct dict_avp_data){ 438, 0, "Restriction-Filter-Rule", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "IPFilterRule" },
+	/* Service-Context-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 461, 0, "Service-Context-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Service-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 439, 0, "Service-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Service-Parameter-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 441, 0, "Service-Parameter-Type", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Service-Parameter-Value */
+	{ DICT_AVP, &(struct dict_avp_data){ 442, 0, "Service-Parameter-Value", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Subscription-Id-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 444, 0, "Subscription-Id-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Subscription-Id-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Subscription-Id-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "END_USER_E164", { .i32=0 } }, "Enumerated(Subscription-Id-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "END_USER_IMSI", { .i32=1 } }, "Enumerated(Subscription-Id-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "END_USER_SIP_URI", { .i32=2 } }, "Enumerated(Subscription-Id-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "END_USER_NAI", { .i32=3 } }, "Enumerated(Subscription-Id-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "END_USER_PRIVATE", { .i32=4 } }, "Enumerated(Subscription-Id-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 450, 0, "Subscription-Id-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Subscription-Id-Type)" },
+	/* Subscription-Id-E164 */
+	{ DICT_AVP, &(struct dict_avp_data){ 99990, 0, "Subscription-Id-E164", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Subscription-Id-IMSI */
+	{ DICT_AVP, &(struct dict_avp_data){ 99991, 0, "Subscription-Id-IMSI", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Subscription-Id-SIP-URI */
+	{ DICT_AVP, &(struct dict_avp_data){ 99992, 0, "Subscription-Id-SIP-URI", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Subscription-Id-NAI */
+	{ DICT_AVP, &(struct dict_avp_data){ 99993, 0, "Subscription-Id-NAI", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Subscription-Id-Private */
+	{ DICT_AVP, &(struct dict_avp_data){ 99994, 0, "Subscription-Id-Private", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Tariff-Change-Usage */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Tariff-Change-Usage)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNIT_BEFORE_TARIFF_CHANGE", { .i32=0 } }, "Enumerated(Tariff-Change-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNIT_AFTER_TARIFF_CHANGE", { .i32=1 } }, "Enumerated(Tariff-Change-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNIT_INDETERMINATE", { .i32=2 } }, "Enumerated(Tariff-Change-Usage)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 452, 0, "Tariff-Change-Usage", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Tariff-Change-Usage)" },
+	/* Tariff-Time-Change */
+	{ DICT_AVP, &(struct dict_avp_data){ 451, 0, "Tariff-Time-Change", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* User-Equipment-Info-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(User-Equipment-Info-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IMEISV", { .i32=0 } }, "Enumerated(User-Equipment-Info-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MAC", { .i32=1 } }, "Enumerated(User-Equipment-Info-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EUI64", { .i32=2 } }, "Enumerated(User-Equipment-Info-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MODIFIED_EUI64", { .i32=3 } }, "Enumerated(User-Equipment-Info-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 459, 0, "User-Equipment-Info-Type", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "Enumerated(User-Equipment-Info-Type)" },
+	/* User-Equipment-Info-Value */
+	{ DICT_AVP, &(struct dict_avp_data){ 460, 0, "User-Equipment-Info-Value", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* User-Equipment-Info-IMEISV */
+	{ DICT_AVP, &(struct dict_avp_data){ 99984, 0, "User-Equipment-Info-IMEISV", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* User-Equipment-Info-MAC */
+	{ DICT_AVP, &(struct dict_avp_data){ 99985, 0, "User-Equipment-Info-MAC", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* User-Equipment-Info-EUI64 */
+	{ DICT_AVP, &(struct dict_avp_data){ 99986, 0, "User-Equipment-Info-EUI64", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* User-Equipment-Info-ModifiedEUI64 */
+	{ DICT_AVP, &(struct dict_avp_data){ 99987, 0, "User-Equipment-Info-ModifiedEUI64", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* User-Equipment-Info-IMEI */
+	{ DICT_AVP, &(struct dict_avp_data){ 99988, 0, "User-Equipment-Info-IMEI", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Value-Digits */
+	{ DICT_AVP, &(struct dict_avp_data){ 447, 0, "Value-Digits", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER64 }, NULL },
+	/* Validity-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 448, 0, "Validity-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Subscription-Id-Extension */
+	{ DICT_AVP, &(struct dict_avp_data){ 99989, 0, "Subscription-Id-Extension", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Subscription-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 443, 0, "Subscription-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Service-Parameter-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 440, 0, "Service-Parameter-Info", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* User-Equipment-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 458, 0, "User-Equipment-Info", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Unit-Value */
+	{ DICT_AVP, &(struct dict_avp_data){ 445, 0, "Unit-Value", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Redirect-Server-Extension */
+	{ DICT_AVP, &(struct dict_avp_data){ 99995, 0, "Redirect-Server-Extension", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Redirect-Server */
+	{ DICT_AVP, &(struct dict_avp_data){ 434, 0, "Redirect-Server", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* User-Equipment-Info-Extension */
+	{ DICT_AVP, &(struct dict_avp_data){ 99983, 0, "User-Equipment-Info-Extension", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* G-S-U-Pool-Reference */
+	{ DICT_AVP, &(struct dict_avp_data){ 457, 0, "G-S-U-Pool-Reference", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Final-Unit-Indication */
+	{ DICT_AVP, &(struct dict_avp_data){ 430, 0, "Final-Unit-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* CC-Money */
+	{ DICT_AVP, &(struct dict_avp_data){ 413, 0, "CC-Money", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Cost-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 423, 0, "Cost-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Used-Service-Unit */
+	{ DICT_AVP, &(struct dict_avp_data){ 446, 0, "Used-Service-Unit", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Requested-Service-Unit */
+	{ DICT_AVP, &(struct dict_avp_data){ 437, 0, "Requested-Service-Unit", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Granted-Service-Unit */
+	{ DICT_AVP, &(struct dict_avp_data){ 431, 0, "Granted-Service-Unit", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* QoS-Final-Unit-Indication */
+	{ DICT_AVP, &(struct dict_avp_data){ 99999, 0, "QoS-Final-Unit-Indication", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Multiple-Services-Credit-Control */
+	{ DICT_AVP, &(struct dict_avp_data){ 456, 0, "Multiple-Services-Credit-Control", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_rfc4006bis_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* CC-Correlation-Id */
-		{
-			struct dict_avp_data data = {
-				411,	/* Code */
-				0,	/* Vendor */
-				"CC-Correlation-Id",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CC-Input-Octets */
-		{
-			struct dict_avp_data data = {
-				412,	/* Code */
-				0,	/* Vendor */
-				"CC-Input-Octets",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CC-Output-Octets */
-		{
-			struct dict_avp_data data = {
-				414,	/* Code */
-				0,	/* Vendor */
-				"CC-Output-Octets",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CC-Request-Number */
-		{
-			struct dict_avp_data data = {
-				415,	/* Code */
-				0,	/* Vendor */
-				"CC-Request-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CC-Request-Type */
-		{
-			struct dict_avp_data data = {
-				416,	/* Code */
-				0,	/* Vendor */
-				"CC-Request-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(CC-Request-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "INITIAL_REQUEST", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "UPDATE_REQUEST", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "TERMINATION_REQUEST", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "EVENT_REQUEST", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CC-Service-Specific-Units */
-		{
-			struct dict_avp_data data = {
-				417,	/* Code */
-				0,	/* Vendor */
-				"CC-Service-Specific-Units",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CC-Session-Failover */
-		{
-			struct dict_avp_data data = {
-				418,	/* Code */
-				0,	/* Vendor */
-				"CC-Session-Failover",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(CC-Session-Failover)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "FAILOVER_NOT_SUPPORTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "FAILOVER_SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CC-Sub-Session-Id */
-		{
-			struct dict_avp_data data = {
-				419,	/* Code */
-				0,	/* Vendor */
-				"CC-Sub-Session-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CC-Time */
-		{
-			struct dict_avp_data data = {
-				420,	/* Code */
-				0,	/* Vendor */
-				"CC-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CC-Total-Octets */
-		{
-			struct dict_avp_data data = {
-				421,	/* Code */
-				0,	/* Vendor */
-				"CC-Total-Octets",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CC-Unit-Type */
-		{
-			struct dict_avp_data data = {
-				454,	/* Code */
-				0,	/* Vendor */
-				"CC-Unit-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(CC-Unit-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "TIME", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "MONEY", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "TOTAL_OCTETS", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "INPUT_OCTETS", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "OUTPUT_OCTETS", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "SERVICE_SPECIFIC_UNITS", { .i32=5 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Check-Balance-Result */
-		{
-			struct dict_avp_data data = {
-				422,	/* Code */
-				0,	/* Vendor */
-				"Check-Balance-Result",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Check-Balance-Result)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ENOUGH_CREDIT", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NO_CREDIT", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Cost-Unit */
-		{
-			struct dict_avp_data data = {
-				424,	/* Code */
-				0,	/* Vendor */
-				"Cost-Unit",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Credit-Control */
-		{
-			struct dict_avp_data data = {
-				426,	/* Code */
-				0,	/* Vendor */
-				"Credit-Control",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Credit-Control)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CREDIT_AUTHORIZATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "RE_AUTHORIZATION", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Credit-Control-Failure-Handling */
-		{
-			struct dict_avp_data data = {
-				427,	/* Code */
-				0,	/* Vendor */
-				"Credit-Control-Failure-Handling",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Credit-Control-Failure-Handling)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "TERMINATE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CONTINUE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "RETRY_AND_TERMINATE", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Currency-Code */
-		{
-			struct dict_avp_data data = {
-				425,	/* Code */
-				0,	/* Vendor */
-				"Currency-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Direct-Debiting-Failure-Handling */
-		{
-			struct dict_avp_data data = {
-				428,	/* Code */
-				0,	/* Vendor */
-				"Direct-Debiting-Failure-Handling",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Direct-Debiting-Failure-Handling)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "TERMINATE_OR_BUFFER", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CONTINUE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Exponent */
-		{
-			struct dict_avp_data data = {
-				429,	/* Code */
-				0,	/* Vendor */
-				"Exponent",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Final-Unit-Action */
-		{
-			struct dict_avp_data data = {
-				449,	/* Code */
-				0,	/* Vendor */
-				"Final-Unit-Action",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Final-Unit-Action)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "TERMINATE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "REDIRECT", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "RESTRICT_ACCESS", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* G-S-U-Pool-Identifier */
-		{
-			struct dict_avp_data data = {
-				453,	/* Code */
-				0,	/* Vendor */
-				"G-S-U-Pool-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Multiple-Services-Indicator */
-		{
-			struct dict_avp_data data = {
-				455,	/* Code */
-				0,	/* Vendor */
-				"Multiple-Services-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Multiple-Services-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "MULTIPLE_SERVICES_NOT_SUPPORTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "MULTIPLE_SERVICES_SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Rating-Group */
-		{
-			struct dict_avp_data data = {
-				432,	/* Code */
-				0,	/* Vendor */
-				"Rating-Group",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Redirect-Address-Type */
-		{
-			struct dict_avp_data data = {
-				433,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Address-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Redirect-Address-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "IPv4_Address", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "IPv6_Address", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "URL", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "SIP_URI", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Redirect-Server-Address */
-		{
-			struct dict_avp_data data = {
-				435,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Server-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Redirect-Address-IPAddress */
-		{
-			struct dict_avp_data data = {
-				99996,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Address-IPAddress",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Redirect-Address-URL */
-		{
-			struct dict_avp_data data = {
-				99997,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Address-URL",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Redirect-Address-SIP-URI */
-		{
-			struct dict_avp_data data = {
-				99998,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Address-SIP-URI",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Requested-Action */
-		{
-			struct dict_avp_data data = {
-				436,	/* Code */
-				0,	/* Vendor */
-				"Requested-Action",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Requested-Action)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DIRECT_DEBITING", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "REFUND_ACCOUNT", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "CHECK_BALANCE", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "PRICE_ENQUIRY", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Restriction-Filter-Rule */
-		{
-			struct dict_avp_data data = {
-				438,	/* Code */
-				0,	/* Vendor */
-				"Restriction-Filter-Rule",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, IPFilterRule_type, NULL);
-		};
-		/* Service-Context-Id */
-		{
-			struct dict_avp_data data = {
-				461,	/* Code */
-				0,	/* Vendor */
-				"Service-Context-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Service-Identifier */
-		{
-			struct dict_avp_data data = {
-				439,	/* Code */
-				0,	/* Vendor */
-				"Service-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Service-Parameter-Type */
-		{
-			struct dict_avp_data data = {
-				441,	/* Code */
-				0,	/* Vendor */
-				"Service-Parameter-Type",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Service-Parameter-Value */
-		{
-			struct dict_avp_data data = {
-				442,	/* Code */
-				0,	/* Vendor */
-				"Service-Parameter-Value",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Subscription-Id-Data */
-		{
-			struct dict_avp_data data = {
-				444,	/* Code */
-				0,	/* Vendor */
-				"Subscription-Id-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Subscription-Id-Type */
-		{
-			struct dict_avp_data data = {
-				450,	/* Code */
-				0,	/* Vendor */
-				"Subscription-Id-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Subscription-Id-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "END_USER_E164", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "END_USER_IMSI", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "END_USER_SIP_URI", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "END_USER_NAI", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "END_USER_PRIVATE", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Subscription-Id-E164 */
-		{
-			struct dict_avp_data data = {
-				99990,	/* Code */
-				0,	/* Vendor */
-				"Subscription-Id-E164",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Subscription-Id-IMSI */
-		{
-			struct dict_avp_data data = {
-				99991,	/* Code */
-				0,	/* Vendor */
-				"Subscription-Id-IMSI",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Subscription-Id-SIP-URI */
-		{
-			struct dict_avp_data data = {
-				99992,	/* Code */
-				0,	/* Vendor */
-				"Subscription-Id-SIP-URI",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Subscription-Id-NAI */
-		{
-			struct dict_avp_data data = {
-				99993,	/* Code */
-				0,	/* Vendor */
-				"Subscription-Id-NAI",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Subscription-Id-Private */
-		{
-			struct dict_avp_data data = {
-				99994,	/* Code */
-				0,	/* Vendor */
-				"Subscription-Id-Private",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Tariff-Change-Usage */
-		{
-			struct dict_avp_data data = {
-				452,	/* Code */
-				0,	/* Vendor */
-				"Tariff-Change-Usage",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Tariff-Change-Usage)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UNIT_BEFORE_TARIFF_CHANGE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "UNIT_AFTER_TARIFF_CHANGE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "UNIT_INDETERMINATE", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Tariff-Time-Change */
-		{
-			struct dict_avp_data data = {
-				451,	/* Code */
-				0,	/* Vendor */
-				"Tariff-Time-Change",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* User-Equipment-Info-Type */
-		{
-			struct dict_avp_data data = {
-				459,	/* Code */
-				0,	/* Vendor */
-				"User-Equipment-Info-Type",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(User-Equipment-Info-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "IMEISV", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "MAC", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "EUI64", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "MODIFIED_EUI64", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* User-Equipment-Info-Value */
-		{
-			struct dict_avp_data data = {
-				460,	/* Code */
-				0,	/* Vendor */
-				"User-Equipment-Info-Value",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Equipment-Info-IMEISV */
-		{
-			struct dict_avp_data data = {
-				99984,	/* Code */
-				0,	/* Vendor */
-				"User-Equipment-Info-IMEISV",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Equipment-Info-MAC */
-		{
-			struct dict_avp_data data = {
-				99985,	/* Code */
-				0,	/* Vendor */
-				"User-Equipment-Info-MAC",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Equipment-Info-EUI64 */
-		{
-			struct dict_avp_data data = {
-				99986,	/* Code */
-				0,	/* Vendor */
-				"User-Equipment-Info-EUI64",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Equipment-Info-ModifiedEUI64 */
-		{
-			struct dict_avp_data data = {
-				99987,	/* Code */
-				0,	/* Vendor */
-				"User-Equipment-Info-ModifiedEUI64",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Equipment-Info-IMEI */
-		{
-			struct dict_avp_data data = {
-				99988,	/* Code */
-				0,	/* Vendor */
-				"User-Equipment-Info-IMEI",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Value-Digits */
-		{
-			struct dict_avp_data data = {
-				447,	/* Code */
-				0,	/* Vendor */
-				"Value-Digits",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Validity-Time */
-		{
-			struct dict_avp_data data = {
-				448,	/* Code */
-				0,	/* Vendor */
-				"Validity-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Subscription-Id-Extension */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				99989,	/* Code */
-				0,	/* Vendor */
-				"Subscription-Id-Extension",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Subscription-Id */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				443,	/* Code */
-				0,	/* Vendor */
-				"Subscription-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Service-Parameter-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				440,	/* Code */
-				0,	/* Vendor */
-				"Service-Parameter-Info",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* User-Equipment-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				458,	/* Code */
-				0,	/* Vendor */
-				"User-Equipment-Info",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Unit-Value */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				445,	/* Code */
-				0,	/* Vendor */
-				"Unit-Value",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Redirect-Server-Extension */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				99995,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Server-Extension",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Redirect-Server */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				434,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Server",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* User-Equipment-Info-Extension */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				99983,	/* Code */
-				0,	/* Vendor */
-				"User-Equipment-Info-Extension",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* G-S-U-Pool-Reference */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				457,	/* Code */
-				0,	/* Vendor */
-				"G-S-U-Pool-Reference",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Final-Unit-Indication */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				430,	/* Code */
-				0,	/* Vendor */
-				"Final-Unit-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* CC-Money */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				413,	/* Code */
-				0,	/* Vendor */
-				"CC-Money",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Cost-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				423,	/* Code */
-				0,	/* Vendor */
-				"Cost-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Used-Service-Unit */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				446,	/* Code */
-				0,	/* Vendor */
-				"Used-Service-Unit",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Requested-Service-Unit */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				437,	/* Code */
-				0,	/* Vendor */
-				"Requested-Service-Unit",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Granted-Service-Unit */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				431,	/* Code */
-				0,	/* Vendor */
-				"Granted-Service-Unit",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* QoS-Final-Unit-Indication */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				99999,	/* Code */
-				0,	/* Vendor */
-				"QoS-Final-Unit-Indication",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Multiple-Services-Credit-Control */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				456,	/* Code */
-				0,	/* Vendor */
-				"Multiple-Services-Credit-Control",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_rfc4006bis_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double rfc4072_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,88 +103,26 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_rfc4072_avps_defs[] = {
+	/* EAP-Payload */
+	{ DICT_AVP, &(struct dict_avp_data){ 462, 0, "EAP-Payload", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* EAP-Reissued-Payload */
+	{ DICT_AVP, &(struct dict_avp_data){ 463, 0, "EAP-Reissued-Payload", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* EAP-Master-Session-Key */
+	{ DICT_AVP, &(struct dict_avp_data){ 464, 0, "EAP-Master-Session-Key", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* EAP-Key-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 102, 0, "EAP-Key-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Accounting-EAP-Auth-Method */
+	{ DICT_AVP, &(struct dict_avp_data){ 465, 0, "Accounting-EAP-Auth-Method", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+};
+
 static int dict_rfc4072_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* EAP-Payload */
-		{
-			struct dict_avp_data data = {
-				462,	/* Code */
-				0,	/* Vendor */
-				"EAP-Payload",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* EAP-Reissued-Payload */
-		{
-			struct dict_avp_data data = {
-				463,	/* Code */
-				0,	/* Vendor */
-				"EAP-Reissued-Payload",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* EAP-Master-Session-Key */
-		{
-			struct dict_avp_data data = {
-				464,	/* Code */
-				0,	/* Vendor */
-				"EAP-Master-Session-Key",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* EAP-Key-Name */
-		{
-			struct dict_avp_data data = {
-				102,	/* Code */
-				0,	/* Vendor */
-				"EAP-Key-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Accounting-EAP-Auth-Method */
-		{
-			struct dict_avp_data data = {
-				465,	/* Code */
-				0,	/* Vendor */
-				"Accounting-EAP-Auth-Method",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-
-	
-   }
+   CHECK_dict_new_batch( dict_rfc4072_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double rfc4590_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,280 +103,58 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_rfc4590_avps_defs[] = {
+	/* Message-Authenticator */
+	{ DICT_AVP, &(struct dict_avp_data){ 80, 0, "Message-Authenticator", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Response */
+	{ DICT_AVP, &(struct dict_avp_data){ 103, 0, "Digest-Response", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Realm */
+	{ DICT_AVP, &(struct dict_avp_data){ 104, 0, "Digest-Realm", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Nonce */
+	{ DICT_AVP, &(struct dict_avp_data){ 105, 0, "Digest-Nonce", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Response-Auth */
+	{ DICT_AVP, &(struct dict_avp_data){ 106, 0, "Digest-Response-Auth", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Nextnonce */
+	{ DICT_AVP, &(struct dict_avp_data){ 107, 0, "Digest-Nextnonce", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Method */
+	{ DICT_AVP, &(struct dict_avp_data){ 108, 0, "Digest-Method", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-URI */
+	{ DICT_AVP, &(struct dict_avp_data){ 109, 0, "Digest-URI", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-QoP */
+	{ DICT_AVP, &(struct dict_avp_data){ 110, 0, "Digest-QoP", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Algorithm */
+	{ DICT_AVP, &(struct dict_avp_data){ 111, 0, "Digest-Algorithm", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Entity-Body-Hash */
+	{ DICT_AVP, &(struct dict_avp_data){ 112, 0, "Digest-Entity-Body-Hash", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-CNonce */
+	{ DICT_AVP, &(struct dict_avp_data){ 113, 0, "Digest-CNonce", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Nonce-Count */
+	{ DICT_AVP, &(struct dict_avp_data){ 114, 0, "Digest-Nonce-Count", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Username */
+	{ DICT_AVP, &(struct dict_avp_data){ 115, 0, "Digest-Username", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Opaque */
+	{ DICT_AVP, &(struct dict_avp_data){ 116, 0, "Digest-Opaque", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Auth-Param */
+	{ DICT_AVP, &(struct dict_avp_data){ 117, 0, "Digest-Auth-Param", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-AKA-Auts */
+	{ DICT_AVP, &(struct dict_avp_data){ 118, 0, "Digest-AKA-Auts", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Domain */
+	{ DICT_AVP, &(struct dict_avp_data){ 119, 0, "Digest-Domain", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-Stale */
+	{ DICT_AVP, &(struct dict_avp_data){ 120, 0, "Digest-Stale", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Digest-HA1 */
+	{ DICT_AVP, &(struct dict_avp_data){ 121, 0, "Digest-HA1", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SIP-AOR */
+	{ DICT_AVP, &(struct dict_avp_data){ 122, 0, "SIP-AOR", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+};
+
 static int dict_rfc4590_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* Message-Authenticator */
-		{
-			struct dict_avp_data data = {
-				80,	/* Code */
-				0,	/* Vendor */
-				"Message-Authenticator",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Response */
-		{
-			struct dict_avp_data data = {
-				103,	/* Code */
-				0,	/* Vendor */
-				"Digest-Response",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Realm */
-		{
-			struct dict_avp_data data = {
-				104,	/* Code */
-				0,	/* Vendor */
-				"Digest-Realm",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Nonce */
-		{
-			struct dict_avp_data data = {
-				105,	/* Code */
-				0,	/* Vendor */
-				"Digest-Nonce",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Response-Auth */
-		{
-			struct dict_avp_data data = {
-				106,	/* Code */
-				0,	/* Vendor */
-				"Digest-Response-Auth",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Nextnonce */
-		{
-			struct dict_avp_data data = {
-				107,	/* Code */
-				0,	/* Vendor */
-				"Digest-Nextnonce",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Method */
-		{
-			struct dict_avp_data data = {
-				108,	/* Code */
-				0,	/* Vendor */
-				"Digest-Method",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-URI */
-		{
-			struct dict_avp_data data = {
-				109,	/* Code */
-				0,	/* Vendor */
-				"Digest-URI",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-QoP */
-		{
-			struct dict_avp_data data = {
-				110,	/* Code */
-				0,	/* Vendor */
-				"Digest-QoP",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Algorithm */
-		{
-			struct dict_avp_data data = {
-				111,	/* Code */
-				0,	/* Vendor */
-				"Digest-Algorithm",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Entity-Body-Hash */
-		{
-			struct dict_avp_data data = {
-				112,	/* Code */
-				0,	/* Vendor */
-				"Digest-Entity-Body-Hash",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-CNonce */
-		{
-			struct dict_avp_data data = {
-				113,	/* Code */
-				0,	/* Vendor */
-				"Digest-CNonce",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Nonce-Count */
-		{
-			struct dict_avp_data data = {
-				114,	/* Code */
-				0,	/* Vendor */
-				"Digest-Nonce-Count",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Username */
-		{
-			struct dict_avp_data data = {
-				115,	/* Code */
-				0,	/* Vendor */
-				"Digest-Username",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Opaque */
-		{
-			struct dict_avp_data data = {
-				116,	/* Code */
-				0,	/* Vendor */
-				"Digest-Opaque",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Auth-Param */
-		{
-			struct dict_avp_data data = {
-				117,	/* Code */
-				0,	/* Vendor */
-				"Digest-Auth-Param",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-AKA-Auts */
-		{
-			struct dict_avp_data data = {
-				118,	/* Code */
-				0,	/* Vendor */
-				"Digest-AKA-Auts",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Domain */
-		{
-			struct dict_avp_data data = {
-				119,	/* Code */
-				0,	/* Vendor */
-				"Digest-Domain",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-Stale */
-		{
-			struct dict_avp_data data = {
-				120,	/* Code */
-				0,	/* Vendor */
-				"Digest-Stale",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Digest-HA1 */
-		{
-			struct dict_avp_data data = {
-				121,	/* Code */
-				0,	/* Vendor */
-				"Digest-HA1",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SIP-AOR */
-		{
-			struct dict_avp_data data = {
-				122,	/* Code */
-				0,	/* Vendor */
-				"SIP-AOR",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-
-	
-   }
+   CHECK_dict_new_batch( dict_rfc4590_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double rfc5447_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,66 +103,22 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_rfc5447_avps_defs[] = {
+	/* MIP6-Feature-Vector */
+	{ DICT_AVP, &(struct dict_avp_data){ 124, 0, "MIP6-Feature-Vector", AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP6-Home-Link-Prefix */
+	{ DICT_AVP, &(struct dict_avp_data){ 125, 0, "MIP6-Home-Link-Prefix", AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP6-Agent-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 486, 0, "MIP6-Agent-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_rfc5447_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* MIP6-Feature-Vector */
-		{
-			struct dict_avp_data data = {
-				124,	/* Code */
-				0,	/* Vendor */
-				"MIP6-Feature-Vector",	/* Name */
-				AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP6-Home-Link-Prefix */
-		{
-			struct dict_avp_data data = {
-				125,	/* Code */
-				0,	/* Vendor */
-				"MIP6-Home-Link-Prefix",	/* Name */
-				AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP6-Agent-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				486,	/* Code */
-				0,	/* Vendor */
-				"MIP6-Agent-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_rfc5447_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double rfc5778_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,134 +103,35 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_rfc5778_avps_defs[] = {
+	/* Service-Selection */
+	{ DICT_AVP, &(struct dict_avp_data){ 493, 0, "Service-Selection", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* MIP-MN-HA-SPI */
+	{ DICT_AVP, &(struct dict_avp_data){ 491, 0, "MIP-MN-HA-SPI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP-Careof-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 487, 0, "MIP-Careof-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* MIP-Authenticator */
+	{ DICT_AVP, &(struct dict_avp_data){ 488, 0, "MIP-Authenticator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP-MAC-Mobility-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 489, 0, "MIP-MAC-Mobility-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 490, 0, "MIP-Timestamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP6-Auth-Mode */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(MIP6-Auth-Mode)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MN_HA", { .i32=1 } }, "Enumerated(MIP6-Auth-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MN_AAA", { .i32=2 } }, "Enumerated(MIP6-Auth-Mode)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 494, 0, "MIP6-Auth-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(MIP6-Auth-Mode)" },
+	/* MIP-MN-HA-MSA */
+	{ DICT_AVP, &(struct dict_avp_data){ 492, 0, "MIP-MN-HA-MSA", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_rfc5778_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* Service-Selection */
-		{
-			struct dict_avp_data data = {
-				493,	/* Code */
-				0,	/* Vendor */
-				"Service-Selection",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* MIP-MN-HA-SPI */
-		{
-			struct dict_avp_data data = {
-				491,	/* Code */
-				0,	/* Vendor */
-				"MIP-MN-HA-SPI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Careof-Address */
-		{
-			struct dict_avp_data data = {
-				487,	/* Code */
-				0,	/* Vendor */
-				"MIP-Careof-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* MIP-Authenticator */
-		{
-			struct dict_avp_data data = {
-				488,	/* Code */
-				0,	/* Vendor */
-				"MIP-Authenticator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-MAC-Mobility-Data */
-		{
-			struct dict_avp_data data = {
-				489,	/* Code */
-				0,	/* Vendor */
-				"MIP-MAC-Mobility-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-Timestamp */
-		{
-			struct dict_avp_data data = {
-				490,	/* Code */
-				0,	/* Vendor */
-				"MIP-Timestamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP6-Auth-Mode */
-		{
-			struct dict_avp_data data = {
-				494,	/* Code */
-				0,	/* Vendor */
-				"MIP6-Auth-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(MIP6-Auth-Mode)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "MN_HA", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "MN_AAA", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MIP-MN-HA-MSA */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				492,	/* Code */
-				0,	/* Vendor */
-				"MIP-MN-HA-MSA",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_rfc5778_avps_defs );
 
    /* Commands section */
    {
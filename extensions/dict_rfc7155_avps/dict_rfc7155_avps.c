@@ -43,6 +43,12 @@ const double rfc7155_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,332 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_rfc7155_avps_defs[] = {
+	/* NAS-Port */
+	{ DICT_AVP, &(struct dict_avp_data){ 5, 0, "NAS-Port", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* NAS-Port-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 87, 0, "NAS-Port-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* NAS-Port-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(NAS-Port-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ASYNC", { .i32=0 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SYNC", { .i32=1 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ISDN_SYNC", { .i32=2 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ISDN_ASYNC_V120", { .i32=3 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ISDN_ASYNC_V110", { .i32=4 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VIRTUAL", { .i32=5 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PIAFS", { .i32=6 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HDLC_CLEAR_CHANNEL", { .i32=7 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "X25", { .i32=8 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "X75", { .i32=9 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "G.3_FAX", { .i32=10 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SDSL_SYMMETRIC_DSL", { .i32=11 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IDSL_ISDN_DIGITAL_SUBSCRIBER_LINE", { .i32=14 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ETHERNET", { .i32=15 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "XDSL_DIGITAL_SUBSCRIBER_LINE_OF_UNKNOWN_TYPE", { .i32=16 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CABLE", { .i32=17 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WIRELESS_OTHER", { .i32=18 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WIRELESS_IEEE_802.11", { .i32=19 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TOKEN_RING", { .i32=20 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FDDI", { .i32=21 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WIRELESS_CDMA2000", { .i32=22 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WIRELESS_UMTS", { .i32=23 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WIRELESS_1X_EV", { .i32=24 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IAPP", { .i32=25 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FTTP_FIBER_TO_THE_PREMISES", { .i32=26 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WIRELESS_IEEE_802.16", { .i32=27 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WIRELESS_IEEE_802.20", { .i32=28 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WIRELESS_IEEE_802.22", { .i32=29 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PPPOA_PPP_OVER_ATM", { .i32=30 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PPPOEOA_PPP_OVER_ETHERNET_OVER_ATM", { .i32=31 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PPPOEOE_PPP_OVER_ETHERNET_OVER_ETHERNET", { .i32=32 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PPPOEOVLAN_PPP_OVER_ETHERNET_OVER_VLAN", { .i32=33 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PPPOEOQINQ_PPP_OVER_ETHERNET_OVER_IEEE_802.1QINQ", { .i32=34 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "XPON_PASSIVE_OPTICAL_NETWORK", { .i32=35 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WIRELESS_XGP", { .i32=36 } }, "Enumerated(NAS-Port-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 61, 0, "NAS-Port-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(NAS-Port-Type)" },
+	/* Called-Station-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 30, 0, "Called-Station-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Calling-Station-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 31, 0, "Calling-Station-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Connect-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 77, 0, "Connect-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Originating-Line-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 94, 0, "Originating-Line-Info", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Reply-Message */
+	{ DICT_AVP, &(struct dict_avp_data){ 18, 0, "Reply-Message", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* User-Password */
+	{ DICT_AVP, &(struct dict_avp_data){ 2, 0, "User-Password", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Password-Retry */
+	{ DICT_AVP, &(struct dict_avp_data){ 75, 0, "Password-Retry", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Prompt */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Prompt)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_ECHO", { .i32=0 } }, "Enumerated(Prompt)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ECHO", { .i32=1 } }, "Enumerated(Prompt)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 76, 0, "Prompt", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Prompt)" },
+	/* CHAP-Algorithm */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(CHAP-Algorithm)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHAP_WITH_MD5", { .i32=5 } }, "Enumerated(CHAP-Algorithm)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 403, 0, "CHAP-Algorithm", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(CHAP-Algorithm)" },
+	/* CHAP-Ident */
+	{ DICT_AVP, &(struct dict_avp_data){ 404, 0, "CHAP-Ident", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* CHAP-Response */
+	{ DICT_AVP, &(struct dict_avp_data){ 405, 0, "CHAP-Response", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* CHAP-Challenge */
+	{ DICT_AVP, &(struct dict_avp_data){ 60, 0, "CHAP-Challenge", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* ARAP-Password */
+	{ DICT_AVP, &(struct dict_avp_data){ 70, 0, "ARAP-Password", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* ARAP-Challenge-Response */
+	{ DICT_AVP, &(struct dict_avp_data){ 84, 0, "ARAP-Challenge-Response", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* ARAP-Security */
+	{ DICT_AVP, &(struct dict_avp_data){ 73, 0, "ARAP-Security", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* ARAP-Security-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 74, 0, "ARAP-Security-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Service-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Service-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNKNOWN", { .i32=0 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LOGIN", { .i32=1 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FRAMED", { .i32=2 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CALLBACK_LOGIN", { .i32=3 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CALLBACK_FRAMED", { .i32=4 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "OUTBOUND", { .i32=5 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ADMINISTRATIVE", { .i32=6 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NAS_PROMPT", { .i32=7 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AUTHENTICATE_ONLY", { .i32=8 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CALLBACK_NAS_PROMPT", { .i32=9 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CALL_CHECK", { .i32=10 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CALLBACK_ADMINISTRATIVE", { .i32=11 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VOICE", { .i32=12 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FAX", { .i32=13 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MODEM_RELAY", { .i32=14 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IAPP_REGISTER", { .i32=15 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IAPP_AP_CHECK", { .i32=16 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AUTHORIZE_ONLY", { .i32=17 } }, "Enumerated(Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FRAMED_MANAGEMENT", { .i32=18 } }, "Enumerated(Service-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 6, 0, "Service-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Service-Type)" },
+	/* Callback-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 19, 0, "Callback-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Callback-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 20, 0, "Callback-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Idle-Timeout */
+	{ DICT_AVP, &(struct dict_avp_data){ 28, 0, "Idle-Timeout", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Port-Limit */
+	{ DICT_AVP, &(struct dict_avp_data){ 62, 0, "Port-Limit", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* NAS-Filter-Rule */
+	{ DICT_AVP, &(struct dict_avp_data){ 400, 0, "NAS-Filter-Rule", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "IPFilterRule" },
+	/* Filter-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 11, 0, "Filter-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Configuration-Token */
+	{ DICT_AVP, &(struct dict_avp_data){ 78, 0, "Configuration-Token", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* QoS-Filter-Rule */
+	{ DICT_AVP, &(struct dict_avp_data){ 407, 0, "QoS-Filter-Rule", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "QoSFilterRule" },
+	/* Framed-Protocol */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Framed-Protocol)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PPP", { .i32=1 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SLIP", { .i32=2 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ARAP", { .i32=3 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GANDALF", { .i32=4 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "XYLOGICS", { .i32=5 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "X.75", { .i32=6 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPRS_PDP_CONTEXT", { .i32=7 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ASCEND_ARA", { .i32=255 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MPP", { .i32=256 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EURAW", { .i32=257 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EUUI", { .i32=258 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "X25", { .i32=259 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "COMB", { .i32=260 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FR", { .i32=261 } }, "Enumerated(Framed-Protocol)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 7, 0, "Framed-Protocol", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Framed-Protocol)" },
+	/* Framed-Routing */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Framed-Routing)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NONE", { .i32=0 } }, "Enumerated(Framed-Routing)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SEND_ROUTING_PACKETS", { .i32=1 } }, "Enumerated(Framed-Routing)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LISTEN_FOR_ROUTING_PACKETS", { .i32=2 } }, "Enumerated(Framed-Routing)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SEND_AND_LISTEN", { .i32=3 } }, "Enumerated(Framed-Routing)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 10, 0, "Framed-Routing", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Framed-Routing)" },
+	/* Framed-MTU */
+	{ DICT_AVP, &(struct dict_avp_data){ 12, 0, "Framed-MTU", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Framed-Compression */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Framed-Compression)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NONE", { .i32=0 } }, "Enumerated(Framed-Compression)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPX_HEADER_COMPRESSION", { .i32=2 } }, "Enumerated(Framed-Compression)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "STAC_LZS_COMPRESSION", { .i32=3 } }, "Enumerated(Framed-Compression)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 13, 0, "Framed-Compression", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Framed-Compression)" },
+	/* Framed-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 8, 0, "Framed-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Framed-IP-Netmask */
+	{ DICT_AVP, &(struct dict_avp_data){ 9, 0, "Framed-IP-Netmask", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Framed-Route */
+	{ DICT_AVP, &(struct dict_avp_data){ 22, 0, "Framed-Route", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Framed-Pool */
+	{ DICT_AVP, &(struct dict_avp_data){ 88, 0, "Framed-Pool", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Framed-Interface-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 96, 0, "Framed-Interface-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* Framed-IPv6-Prefix */
+	{ DICT_AVP, &(struct dict_avp_data){ 97, 0, "Framed-IPv6-Prefix", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Framed-IPv6-Route */
+	{ DICT_AVP, &(struct dict_avp_data){ 99, 0, "Framed-IPv6-Route", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Framed-IPv6-Pool */
+	{ DICT_AVP, &(struct dict_avp_data){ 100, 0, "Framed-IPv6-Pool", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Framed-IPX-Network */
+	{ DICT_AVP, &(struct dict_avp_data){ 23, 0, "Framed-IPX-Network", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Framed-Appletalk-Link */
+	{ DICT_AVP, &(struct dict_avp_data){ 37, 0, "Framed-Appletalk-Link", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Framed-Appletalk-Network */
+	{ DICT_AVP, &(struct dict_avp_data){ 38, 0, "Framed-Appletalk-Network", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Framed-Appletalk-Zone */
+	{ DICT_AVP, &(struct dict_avp_data){ 39, 0, "Framed-Appletalk-Zone", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* ARAP-Features */
+	{ DICT_AVP, &(struct dict_avp_data){ 71, 0, "ARAP-Features", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* ARAP-Zone-Access */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(ARAP-Zone-Access)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ONLY_ALLOW_ACCESS_TO_DEFAULT_ZONE", { .i32=1 } }, "Enumerated(ARAP-Zone-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USE_ZONE_FILTER_INCLUSIVELY", { .i32=2 } }, "Enumerated(ARAP-Zone-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USE_ZONE_FILTER_EXCLUSIVELY", { .i32=3 } }, "Enumerated(ARAP-Zone-Access)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 72, 0, "ARAP-Zone-Access", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(ARAP-Zone-Access)" },
+	/* Login-IP-Host */
+	{ DICT_AVP, &(struct dict_avp_data){ 14, 0, "Login-IP-Host", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Login-IPv6-Host */
+	{ DICT_AVP, &(struct dict_avp_data){ 98, 0, "Login-IPv6-Host", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Login-Service */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Login-Service)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TELNET", { .i32=0 } }, "Enumerated(Login-Service)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RLOGIN", { .i32=1 } }, "Enumerated(Login-Service)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TCP_CLEAR", { .i32=2 } }, "Enumerated(Login-Service)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PORTMASTER", { .i32=3 } }, "Enumerated(Login-Service)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LAT", { .i32=4 } }, "Enumerated(Login-Service)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "X25_PAD", { .i32=5 } }, "Enumerated(Login-Service)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "X25_T3POS", { .i32=6 } }, "Enumerated(Login-Service)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNASSIGNED", { .i32=7 } }, "Enumerated(Login-Service)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 15, 0, "Login-Service", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Login-Service)" },
+	/* Login-TCP-Port */
+	{ DICT_AVP, &(struct dict_avp_data){ 16, 0, "Login-TCP-Port", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Login-LAT-Service */
+	{ DICT_AVP, &(struct dict_avp_data){ 34, 0, "Login-LAT-Service", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Login-LAT-Node */
+	{ DICT_AVP, &(struct dict_avp_data){ 35, 0, "Login-LAT-Node", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Login-LAT-Group */
+	{ DICT_AVP, &(struct dict_avp_data){ 36, 0, "Login-LAT-Group", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Login-LAT-Port */
+	{ DICT_AVP, &(struct dict_avp_data){ 63, 0, "Login-LAT-Port", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Tunnel-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Tunnel-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PPTP", { .i32=1 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "L2F", { .i32=2 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "L2TP", { .i32=3 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ATMP", { .i32=4 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VTP", { .i32=5 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AH", { .i32=6 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IP_IP_ENCAP", { .i32=7 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MIN_IP_IP", { .i32=8 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ESP", { .i32=9 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GRE", { .i32=10 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DVS", { .i32=11 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IP_IN_IP_TUNNELING", { .i32=12 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VLAN", { .i32=13 } }, "Enumerated(Tunnel-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 64, 0, "Tunnel-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Tunnel-Type)" },
+	/* Tunnel-Medium-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Tunnel-Medium-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPV4", { .i32=1 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPV6", { .i32=2 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NSAP", { .i32=3 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HDLC", { .i32=4 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BBN", { .i32=5 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IEEE_802", { .i32=6 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "E_163", { .i32=7 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "E_164", { .i32=8 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "F_69", { .i32=9 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "X_121", { .i32=10 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPX", { .i32=11 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "APPLETALK_802", { .i32=12 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DECNET4", { .i32=13 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VINES", { .i32=14 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "E_164_NSAP", { .i32=15 } }, "Enumerated(Tunnel-Medium-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 65, 0, "Tunnel-Medium-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Tunnel-Medium-Type)" },
+	/* Tunnel-Client-Endpoint */
+	{ DICT_AVP, &(struct dict_avp_data){ 66, 0, "Tunnel-Client-Endpoint", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Tunnel-Server-Endpoint */
+	{ DICT_AVP, &(struct dict_avp_data){ 67, 0, "Tunnel-Server-Endpoint", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Tunnel-Password */
+	{ DICT_AVP, &(struct dict_avp_data){ 69, 0, "Tunnel-Password", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Tunnel-Private-Group-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 81, 0, "Tunnel-Private-Group-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Tunnel-Assignment-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 82, 0, "Tunnel-Assignment-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Tunnel-Preference */
+	{ DICT_AVP, &(struct dict_avp_data){ 83, 0, "Tunnel-Preference", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Tunnel-Client-Auth-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 90, 0, "Tunnel-Client-Auth-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Tunnel-Server-Auth-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 91, 0, "Tunnel-Server-Auth-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Accounting-Input-Octets */
+	{ DICT_AVP, &(struct dict_avp_data){ 363, 0, "Accounting-Input-Octets", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* Accounting-Output-Octets */
+	{ DICT_AVP, &(struct dict_avp_data){ 364, 0, "Accounting-Output-Octets", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* Accounting-Input-Packets */
+	{ DICT_AVP, &(struct dict_avp_data){ 365, 0, "Accounting-Input-Packets", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* Accounting-Output-Packets */
+	{ DICT_AVP, &(struct dict_avp_data){ 366, 0, "Accounting-Output-Packets", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* Acct-Session-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 46, 0, "Acct-Session-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Acct-Authentic */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Acct-Authentic)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NONE", { .i32=0 } }, "Enumerated(Acct-Authentic)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RADIUS", { .i32=1 } }, "Enumerated(Acct-Authentic)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LOCAL", { .i32=2 } }, "Enumerated(Acct-Authentic)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REMOTE", { .i32=3 } }, "Enumerated(Acct-Authentic)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DIAMETER", { .i32=4 } }, "Enumerated(Acct-Authentic)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 45, 0, "Acct-Authentic", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Acct-Authentic)" },
+	/* Accounting-Auth-Method */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Accounting-Auth-Method)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PAP", { .i32=1 } }, "Enumerated(Accounting-Auth-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHAP", { .i32=2 } }, "Enumerated(Accounting-Auth-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MS_CHAP_1", { .i32=3 } }, "Enumerated(Accounting-Auth-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MS_CHAP_2", { .i32=4 } }, "Enumerated(Accounting-Auth-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EAP", { .i32=5 } }, "Enumerated(Accounting-Auth-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNDEFINED", { .i32=6 } }, "Enumerated(Accounting-Auth-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NONE", { .i32=7 } }, "Enumerated(Accounting-Auth-Method)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 406, 0, "Accounting-Auth-Method", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Accounting-Auth-Method)" },
+	/* Acct-Delay-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 41, 0, "Acct-Delay-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Acct-Link-Count */
+	{ DICT_AVP, &(struct dict_avp_data){ 51, 0, "Acct-Link-Count", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Acct-Tunnel-Connection */
+	{ DICT_AVP, &(struct dict_avp_data){ 68, 0, "Acct-Tunnel-Connection", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Acct-Tunnel-Packets-Lost */
+	{ DICT_AVP, &(struct dict_avp_data){ 86, 0, "Acct-Tunnel-Packets-Lost", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* NAS-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 32, 0, "NAS-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* NAS-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 4, 0, "NAS-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* NAS-IPv6-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 95, 0, "NAS-IPv6-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Origin-AAA-Protocol */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Origin-AAA-Protocol)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RADIUS", { .i32=1 } }, "Enumerated(Origin-AAA-Protocol)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 408, 0, "Origin-AAA-Protocol", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Origin-AAA-Protocol)" },
+	/* State */
+	{ DICT_AVP, &(struct dict_avp_data){ 24, 0, "State", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Redirect-Host */
+	{ DICT_AVP, &(struct dict_avp_data){ 292, 0, "Redirect-Host", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterURI" },
+	/* Redirect-Host-Usage */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Redirect-Host-Usage)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DONT_CACHE", { .i32=0 } }, "Enumerated(Redirect-Host-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ALL_SESSION", { .i32=1 } }, "Enumerated(Redirect-Host-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ALL_REALM", { .i32=2 } }, "Enumerated(Redirect-Host-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REALM_AND_APPLICATION", { .i32=3 } }, "Enumerated(Redirect-Host-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ALL_APPLICATION", { .i32=4 } }, "Enumerated(Redirect-Host-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ALL_HOST", { .i32=5 } }, "Enumerated(Redirect-Host-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ALL_USER", { .i32=6 } }, "Enumerated(Redirect-Host-Usage)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 261, 0, "Redirect-Host-Usage", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "Enumerated(Redirect-Host-Usage)" },
+	/* Redirect-Max-Cache-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 262, 0, "Redirect-Max-Cache-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Tunneling */
+	{ DICT_AVP, &(struct dict_avp_data){ 401, 0, "Tunneling", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* CHAP-Auth */
+	{ DICT_AVP, &(struct dict_avp_data){ 402, 0, "CHAP-Auth", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_rfc7155_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -112,1383 +444,7 @@ static int dict_rfc7155_avps_load_defs(char * conffile)
 	}
 	
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-		struct dict_object * QoSFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "QoSFilterRule", &QoSFilterRule_type);
-		/* NAS-Port */
-		{
-			struct dict_avp_data data = {
-				5,	/* Code */
-				0,	/* Vendor */
-				"NAS-Port",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* NAS-Port-Id */
-		{
-			struct dict_avp_data data = {
-				87,	/* Code */
-				0,	/* Vendor */
-				"NAS-Port-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* NAS-Port-Type */
-		{
-			struct dict_avp_data data = {
-				61,	/* Code */
-				0,	/* Vendor */
-				"NAS-Port-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(NAS-Port-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ASYNC", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SYNC", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "ISDN_SYNC", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "ISDN_ASYNC_V120", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "ISDN_ASYNC_V110", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "VIRTUAL", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "PIAFS", { .i32=6 }};
-			struct dict_enumval_data        t_8 = { "HDLC_CLEAR_CHANNEL", { .i32=7 }};
-			struct dict_enumval_data        t_9 = { "X25", { .i32=8 }};
-			struct dict_enumval_data        t_10 = { "X75", { .i32=9 }};
-			struct dict_enumval_data        t_11 = { "G.3_FAX", { .i32=10 }};
-			struct dict_enumval_data        t_12 = { "SDSL_SYMMETRIC_DSL", { .i32=11 }};
-			struct dict_enumval_data        t_13 = { "IDSL_ISDN_DIGITAL_SUBSCRIBER_LINE", { .i32=14 }};
-			struct dict_enumval_data        t_14 = { "ETHERNET", { .i32=15 }};
-			struct dict_enumval_data        t_15 = { "XDSL_DIGITAL_SUBSCRIBER_LINE_OF_UNKNOWN_TYPE", { .i32=16 }};
-			struct dict_enumval_data        t_16 = { "CABLE", { .i32=17 }};
-			struct dict_enumval_data        t_17 = { "WIRELESS_OTHER", { .i32=18 }};
-			struct dict_enumval_data        t_18 = { "WIRELESS_IEEE_802.11", { .i32=19 }};
-			struct dict_enumval_data        t_19 = { "TOKEN_RING", { .i32=20 }};
-			struct dict_enumval_data        t_20 = { "FDDI", { .i32=21 }};
-			struct dict_enumval_data        t_21 = { "WIRELESS_CDMA2000", { .i32=22 }};
-			struct dict_enumval_data        t_22 = { "WIRELESS_UMTS", { .i32=23 }};
-			struct dict_enumval_data        t_23 = { "WIRELESS_1X_EV", { .i32=24 }};
-			struct dict_enumval_data        t_24 = { "IAPP", { .i32=25 }};
-			struct dict_enumval_data        t_25 = { "FTTP_FIBER_TO_THE_PREMISES", { .i32=26 }};
-			struct dict_enumval_data        t_26 = { "WIRELESS_IEEE_802.16", { .i32=27 }};
-			struct dict_enumval_data        t_27 = { "WIRELESS_IEEE_802.20", { .i32=28 }};
-			struct dict_enumval_data        t_28 = { "WIRELESS_IEEE_802.22", { .i32=29 }};
-			struct dict_enumval_data        t_29 = { "PPPOA_PPP_OVER_ATM", { .i32=30 }};
-			struct dict_enumval_data        t_30 = { "PPPOEOA_PPP_OVER_ETHERNET_OVER_ATM", { .i32=31 }};
-			struct dict_enumval_data        t_31 = { "PPPOEOE_PPP_OVER_ETHERNET_OVER_ETHERNET", { .i32=32 }};
-			struct dict_enumval_data        t_32 = { "PPPOEOVLAN_PPP_OVER_ETHERNET_OVER_VLAN", { .i32=33 }};
-			struct dict_enumval_data        t_33 = { "PPPOEOQINQ_PPP_OVER_ETHERNET_OVER_IEEE_802.1QINQ", { .i32=34 }};
-			struct dict_enumval_data        t_34 = { "XPON_PASSIVE_OPTICAL_NETWORK", { .i32=35 }};
-			struct dict_enumval_data        t_35 = { "WIRELESS_XGP", { .i32=36 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_17, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_18, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_19, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_20, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_21, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_22, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_23, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_24, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_25, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_26, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_27, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_28, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_29, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_30, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_31, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_32, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_33, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_34, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_35, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Called-Station-Id */
-		{
-			struct dict_avp_data data = {
-				30,	/* Code */
-				0,	/* Vendor */
-				"Called-Station-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Calling-Station-Id */
-		{
-			struct dict_avp_data data = {
-				31,	/* Code */
-				0,	/* Vendor */
-				"Calling-Station-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Connect-Info */
-		{
-			struct dict_avp_data data = {
-				77,	/* Code */
-				0,	/* Vendor */
-				"Connect-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Originating-Line-Info */
-		{
-			struct dict_avp_data data = {
-				94,	/* Code */
-				0,	/* Vendor */
-				"Originating-Line-Info",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Reply-Message */
-		{
-			struct dict_avp_data data = {
-				18,	/* Code */
-				0,	/* Vendor */
-				"Reply-Message",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* User-Password */
-		{
-			struct dict_avp_data data = {
-				2,	/* Code */
-				0,	/* Vendor */
-				"User-Password",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Password-Retry */
-		{
-			struct dict_avp_data data = {
-				75,	/* Code */
-				0,	/* Vendor */
-				"Password-Retry",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Prompt */
-		{
-			struct dict_avp_data data = {
-				76,	/* Code */
-				0,	/* Vendor */
-				"Prompt",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Prompt)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NO_ECHO", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ECHO", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CHAP-Algorithm */
-		{
-			struct dict_avp_data data = {
-				403,	/* Code */
-				0,	/* Vendor */
-				"CHAP-Algorithm",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(CHAP-Algorithm)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CHAP_WITH_MD5", { .i32=5 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CHAP-Ident */
-		{
-			struct dict_avp_data data = {
-				404,	/* Code */
-				0,	/* Vendor */
-				"CHAP-Ident",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CHAP-Response */
-		{
-			struct dict_avp_data data = {
-				405,	/* Code */
-				0,	/* Vendor */
-				"CHAP-Response",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CHAP-Challenge */
-		{
-			struct dict_avp_data data = {
-				60,	/* Code */
-				0,	/* Vendor */
-				"CHAP-Challenge",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ARAP-Password */
-		{
-			struct dict_avp_data data = {
-				70,	/* Code */
-				0,	/* Vendor */
-				"ARAP-Password",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ARAP-Challenge-Response */
-		{
-			struct dict_avp_data data = {
-				84,	/* Code */
-				0,	/* Vendor */
-				"ARAP-Challenge-Response",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ARAP-Security */
-		{
-			struct dict_avp_data data = {
-				73,	/* Code */
-				0,	/* Vendor */
-				"ARAP-Security",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ARAP-Security-Data */
-		{
-			struct dict_avp_data data = {
-				74,	/* Code */
-				0,	/* Vendor */
-				"ARAP-Security-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Service-Type */
-		{
-			struct dict_avp_data data = {
-				6,	/* Code */
-				0,	/* Vendor */
-				"Service-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Service-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UNKNOWN", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "LOGIN", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "FRAMED", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "CALLBACK_LOGIN", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "CALLBACK_FRAMED", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "OUTBOUND", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "ADMINISTRATIVE", { .i32=6 }};
-			struct dict_enumval_data        t_8 = { "NAS_PROMPT", { .i32=7 }};
-			struct dict_enumval_data        t_9 = { "AUTHENTICATE_ONLY", { .i32=8 }};
-			struct dict_enumval_data        t_10 = { "CALLBACK_NAS_PROMPT", { .i32=9 }};
-			struct dict_enumval_data        t_11 = { "CALL_CHECK", { .i32=10 }};
-			struct dict_enumval_data        t_12 = { "CALLBACK_ADMINISTRATIVE", { .i32=11 }};
-			struct dict_enumval_data        t_13 = { "VOICE", { .i32=12 }};
-			struct dict_enumval_data        t_14 = { "FAX", { .i32=13 }};
-			struct dict_enumval_data        t_15 = { "MODEM_RELAY", { .i32=14 }};
-			struct dict_enumval_data        t_16 = { "IAPP_REGISTER", { .i32=15 }};
-			struct dict_enumval_data        t_17 = { "IAPP_AP_CHECK", { .i32=16 }};
-			struct dict_enumval_data        t_18 = { "AUTHORIZE_ONLY", { .i32=17 }};
-			struct dict_enumval_data        t_19 = { "FRAMED_MANAGEMENT", { .i32=18 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_17, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_18, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_19, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Callback-Number */
-		{
-			struct dict_avp_data data = {
-				19,	/* Code */
-				0,	/* Vendor */
-				"Callback-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Callback-Id */
-		{
-			struct dict_avp_data data = {
-				20,	/* Code */
-				0,	/* Vendor */
-				"Callback-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Idle-Timeout */
-		{
-			struct dict_avp_data data = {
-				28,	/* Code */
-				0,	/* Vendor */
-				"Idle-Timeout",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Port-Limit */
-		{
-			struct dict_avp_data data = {
-				62,	/* Code */
-				0,	/* Vendor */
-				"Port-Limit",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* NAS-Filter-Rule */
-		{
-			struct dict_avp_data data = {
-				400,	/* Code */
-				0,	/* Vendor */
-				"NAS-Filter-Rule",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, IPFilterRule_type, NULL);
-		};
-		/* Filter-Id */
-		{
-			struct dict_avp_data data = {
-				11,	/* Code */
-				0,	/* Vendor */
-				"Filter-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Configuration-Token */
-		{
-			struct dict_avp_data data = {
-				78,	/* Code */
-				0,	/* Vendor */
-				"Configuration-Token",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* QoS-Filter-Rule */
-		{
-			struct dict_avp_data data = {
-				407,	/* Code */
-				0,	/* Vendor */
-				"QoS-Filter-Rule",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, QoSFilterRule_type, NULL);
-		};
-		/* Framed-Protocol */
-		{
-			struct dict_avp_data data = {
-				7,	/* Code */
-				0,	/* Vendor */
-				"Framed-Protocol",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Framed-Protocol)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PPP", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "SLIP", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "ARAP", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "GANDALF", { .i32=4 }};
-			struct dict_enumval_data        t_5 = { "XYLOGICS", { .i32=5 }};
-			struct dict_enumval_data        t_6 = { "X.75", { .i32=6 }};
-			struct dict_enumval_data        t_7 = { "GPRS_PDP_CONTEXT", { .i32=7 }};
-			struct dict_enumval_data        t_8 = { "ASCEND_ARA", { .i32=255 }};
-			struct dict_enumval_data        t_9 = { "MPP", { .i32=256 }};
-			struct dict_enumval_data        t_10 = { "EURAW", { .i32=257 }};
-			struct dict_enumval_data        t_11 = { "EUUI", { .i32=258 }};
-			struct dict_enumval_data        t_12 = { "X25", { .i32=259 }};
-			struct dict_enumval_data        t_13 = { "COMB", { .i32=260 }};
-			struct dict_enumval_data        t_14 = { "FR", { .i32=261 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Framed-Routing */
-		{
-			struct dict_avp_data data = {
-				10,	/* Code */
-				0,	/* Vendor */
-				"Framed-Routing",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Framed-Routing)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NONE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SEND_ROUTING_PACKETS", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "LISTEN_FOR_ROUTING_PACKETS", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "SEND_AND_LISTEN", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Framed-MTU */
-		{
-			struct dict_avp_data data = {
-				12,	/* Code */
-				0,	/* Vendor */
-				"Framed-MTU",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Framed-Compression */
-		{
-			struct dict_avp_data data = {
-				13,	/* Code */
-				0,	/* Vendor */
-				"Framed-Compression",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Framed-Compression)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NONE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "IPX_HEADER_COMPRESSION", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "STAC_LZS_COMPRESSION", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Framed-IP-Address */
-		{
-			struct dict_avp_data data = {
-				8,	/* Code */
-				0,	/* Vendor */
-				"Framed-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Framed-IP-Netmask */
-		{
-			struct dict_avp_data data = {
-				9,	/* Code */
-				0,	/* Vendor */
-				"Framed-IP-Netmask",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Framed-Route */
-		{
-			struct dict_avp_data data = {
-				22,	/* Code */
-				0,	/* Vendor */
-				"Framed-Route",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Framed-Pool */
-		{
-			struct dict_avp_data data = {
-				88,	/* Code */
-				0,	/* Vendor */
-				"Framed-Pool",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Framed-Interface-Id */
-		{
-			struct dict_avp_data data = {
-				96,	/* Code */
-				0,	/* Vendor */
-				"Framed-Interface-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Framed-IPv6-Prefix */
-		{
-			struct dict_avp_data data = {
-				97,	/* Code */
-				0,	/* Vendor */
-				"Framed-IPv6-Prefix",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Framed-IPv6-Route */
-		{
-			struct dict_avp_data data = {
-				99,	/* Code */
-				0,	/* Vendor */
-				"Framed-IPv6-Route",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Framed-IPv6-Pool */
-		{
-			struct dict_avp_data data = {
-				100,	/* Code */
-				0,	/* Vendor */
-				"Framed-IPv6-Pool",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Framed-IPX-Network */
-		{
-			struct dict_avp_data data = {
-				23,	/* Code */
-				0,	/* Vendor */
-				"Framed-IPX-Network",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Framed-Appletalk-Link */
-		{
-			struct dict_avp_data data = {
-				37,	/* Code */
-				0,	/* Vendor */
-				"Framed-Appletalk-Link",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Framed-Appletalk-Network */
-		{
-			struct dict_avp_data data = {
-				38,	/* Code */
-				0,	/* Vendor */
-				"Framed-Appletalk-Network",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Framed-Appletalk-Zone */
-		{
-			struct dict_avp_data data = {
-				39,	/* Code */
-				0,	/* Vendor */
-				"Framed-Appletalk-Zone",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ARAP-Features */
-		{
-			struct dict_avp_data data = {
-				71,	/* Code */
-				0,	/* Vendor */
-				"ARAP-Features",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ARAP-Zone-Access */
-		{
-			struct dict_avp_data data = {
-				72,	/* Code */
-				0,	/* Vendor */
-				"ARAP-Zone-Access",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(ARAP-Zone-Access)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ONLY_ALLOW_ACCESS_TO_DEFAULT_ZONE", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "USE_ZONE_FILTER_INCLUSIVELY", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "USE_ZONE_FILTER_EXCLUSIVELY", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Login-IP-Host */
-		{
-			struct dict_avp_data data = {
-				14,	/* Code */
-				0,	/* Vendor */
-				"Login-IP-Host",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Login-IPv6-Host */
-		{
-			struct dict_avp_data data = {
-				98,	/* Code */
-				0,	/* Vendor */
-				"Login-IPv6-Host",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Login-Service */
-		{
-			struct dict_avp_data data = {
-				15,	/* Code */
-				0,	/* Vendor */
-				"Login-Service",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Login-Service)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "TELNET", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "RLOGIN", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "TCP_CLEAR", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "PORTMASTER", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "LAT", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "X25_PAD", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "X25_T3POS", { .i32=6 }};
-			struct dict_enumval_data        t_8 = { "UNASSIGNED", { .i32=7 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Login-TCP-Port */
-		{
-			struct dict_avp_data data = {
-				16,	/* Code */
-				0,	/* Vendor */
-				"Login-TCP-Port",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Login-LAT-Service */
-		{
-			struct dict_avp_data data = {
-				34,	/* Code */
-				0,	/* Vendor */
-				"Login-LAT-Service",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Login-LAT-Node */
-		{
-			struct dict_avp_data data = {
-				35,	/* Code */
-				0,	/* Vendor */
-				"Login-LAT-Node",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Login-LAT-Group */
-		{
-			struct dict_avp_data data = {
-				36,	/* Code */
-				0,	/* Vendor */
-				"Login-LAT-Group",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Login-LAT-Port */
-		{
-			struct dict_avp_data data = {
-				63,	/* Code */
-				0,	/* Vendor */
-				"Login-LAT-Port",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Tunnel-Type */
-		{
-			struct dict_avp_data data = {
-				64,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Tunnel-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PPTP", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "L2F", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "L2TP", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "ATMP", { .i32=4 }};
-			struct dict_enumval_data        t_5 = { "VTP", { .i32=5 }};
-			struct dict_enumval_data        t_6 = { "AH", { .i32=6 }};
-			struct dict_enumval_data        t_7 = { "IP_IP_ENCAP", { .i32=7 }};
-			struct dict_enumval_data        t_8 = { "MIN_IP_IP", { .i32=8 }};
-			struct dict_enumval_data        t_9 = { "ESP", { .i32=9 }};
-			struct dict_enumval_data        t_10 = { "GRE", { .i32=10 }};
-			struct dict_enumval_data        t_11 = { "DVS", { .i32=11 }};
-			struct dict_enumval_data        t_12 = { "IP_IN_IP_TUNNELING", { .i32=12 }};
-			struct dict_enumval_data        t_13 = { "VLAN", { .i32=13 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Tunnel-Medium-Type */
-		{
-			struct dict_avp_data data = {
-				65,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Medium-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Tunnel-Medium-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "IPV4", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "IPV6", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "NSAP", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "HDLC", { .i32=4 }};
-			struct dict_enumval_data        t_5 = { "BBN", { .i32=5 }};
-			struct dict_enumval_data        t_6 = { "IEEE_802", { .i32=6 }};
-			struct dict_enumval_data        t_7 = { "E_163", { .i32=7 }};
-			struct dict_enumval_data        t_8 = { "E_164", { .i32=8 }};
-			struct dict_enumval_data        t_9 = { "F_69", { .i32=9 }};
-			struct dict_enumval_data        t_10 = { "X_121", { .i32=10 }};
-			struct dict_enumval_data        t_11 = { "IPX", { .i32=11 }};
-			struct dict_enumval_data        t_12 = { "APPLETALK_802", { .i32=12 }};
-			struct dict_enumval_data        t_13 = { "DECNET4", { .i32=13 }};
-			struct dict_enumval_data        t_14 = { "VINES", { .i32=14 }};
-			struct dict_enumval_data        t_15 = { "E_164_NSAP", { .i32=15 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Tunnel-Client-Endpoint */
-		{
-			struct dict_avp_data data = {
-				66,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Client-Endpoint",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Tunnel-Server-Endpoint */
-		{
-			struct dict_avp_data data = {
-				67,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Server-Endpoint",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Tunnel-Password */
-		{
-			struct dict_avp_data data = {
-				69,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Password",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Tunnel-Private-Group-Id */
-		{
-			struct dict_avp_data data = {
-				81,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Private-Group-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Tunnel-Assignment-Id */
-		{
-			struct dict_avp_data data = {
-				82,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Assignment-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Tunnel-Preference */
-		{
-			struct dict_avp_data data = {
-				83,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Preference",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Tunnel-Client-Auth-Id */
-		{
-			struct dict_avp_data data = {
-				90,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Client-Auth-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Tunnel-Server-Auth-Id */
-		{
-			struct dict_avp_data data = {
-				91,	/* Code */
-				0,	/* Vendor */
-				"Tunnel-Server-Auth-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Accounting-Input-Octets */
-		{
-			struct dict_avp_data data = {
-				363,	/* Code */
-				0,	/* Vendor */
-				"Accounting-Input-Octets",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Accounting-Output-Octets */
-		{
-			struct dict_avp_data data = {
-				364,	/* Code */
-				0,	/* Vendor */
-				"Accounting-Output-Octets",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Accounting-Input-Packets */
-		{
-			struct dict_avp_data data = {
-				365,	/* Code */
-				0,	/* Vendor */
-				"Accounting-Input-Packets",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Accounting-Output-Packets */
-		{
-			struct dict_avp_data data = {
-				366,	/* Code */
-				0,	/* Vendor */
-				"Accounting-Output-Packets",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Acct-Session-Time */
-		{
-			struct dict_avp_data data = {
-				46,	/* Code */
-				0,	/* Vendor */
-				"Acct-Session-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Acct-Authentic */
-		{
-			struct dict_avp_data data = {
-				45,	/* Code */
-				0,	/* Vendor */
-				"Acct-Authentic",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Acct-Authentic)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NONE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "RADIUS", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "LOCAL", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "REMOTE", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "DIAMETER", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Accounting-Auth-Method */
-		{
-			struct dict_avp_data data = {
-				406,	/* Code */
-				0,	/* Vendor */
-				"Accounting-Auth-Method",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Accounting-Auth-Method)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PAP", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "CHAP", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "MS_CHAP_1", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "MS_CHAP_2", { .i32=4 }};
-			struct dict_enumval_data        t_5 = { "EAP", { .i32=5 }};
-			struct dict_enumval_data        t_6 = { "UNDEFINED", { .i32=6 }};
-			struct dict_enumval_data        t_7 = { "NONE", { .i32=7 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Acct-Delay-Time */
-		{
-			struct dict_avp_data data = {
-				41,	/* Code */
-				0,	/* Vendor */
-				"Acct-Delay-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Acct-Link-Count */
-		{
-			struct dict_avp_data data = {
-				51,	/* Code */
-				0,	/* Vendor */
-				"Acct-Link-Count",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Acct-Tunnel-Connection */
-		{
-			struct dict_avp_data data = {
-				68,	/* Code */
-				0,	/* Vendor */
-				"Acct-Tunnel-Connection",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Acct-Tunnel-Packets-Lost */
-		{
-			struct dict_avp_data data = {
-				86,	/* Code */
-				0,	/* Vendor */
-				"Acct-Tunnel-Packets-Lost",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* NAS-Identifier */
-		{
-			struct dict_avp_data data = {
-				32,	/* Code */
-				0,	/* Vendor */
-				"NAS-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* NAS-IP-Address */
-		{
-			struct dict_avp_data data = {
-				4,	/* Code */
-				0,	/* Vendor */
-				"NAS-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* NAS-IPv6-Address */
-		{
-			struct dict_avp_data data = {
-				95,	/* Code */
-				0,	/* Vendor */
-				"NAS-IPv6-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Origin-AAA-Protocol */
-		{
-			struct dict_avp_data data = {
-				408,	/* Code */
-				0,	/* Vendor */
-				"Origin-AAA-Protocol",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Origin-AAA-Protocol)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "RADIUS", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* State */
-		{
-			struct dict_avp_data data = {
-				24,	/* Code */
-				0,	/* Vendor */
-				"State",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Redirect-Host */
-		{
-			struct dict_avp_data data = {
-				292,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Host",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterURI_type, NULL);
-		};
-		/* Redirect-Host-Usage */
-		{
-			struct dict_avp_data data = {
-				261,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Host-Usage",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(Redirect-Host-Usage)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DONT_CACHE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ALL_SESSION", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "ALL_REALM", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "REALM_AND_APPLICATION", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "ALL_APPLICATION", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "ALL_HOST", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "ALL_USER", { .i32=6 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Redirect-Max-Cache-Time */
-		{
-			struct dict_avp_data data = {
-				262,	/* Code */
-				0,	/* Vendor */
-				"Redirect-Max-Cache-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Tunneling */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				401,	/* Code */
-				0,	/* Vendor */
-				"Tunneling",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* CHAP-Auth */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				402,	/* Code */
-				0,	/* Vendor */
-				"CHAP-Auth",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_rfc7155_avps_defs );
 
    /* Commands section */
    {
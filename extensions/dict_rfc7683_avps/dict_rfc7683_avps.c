@@ -43,6 +43,12 @@ const double rfc7683_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,128 +103,35 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_rfc7683_avps_defs[] = {
+	/* OC-Feature-Vector */
+	{ DICT_AVP, &(struct dict_avp_data){ 622, 0, "OC-Feature-Vector", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* OC-Sequence-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 624, 0, "OC-Sequence-Number", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* OC-Validity-Duration */
+	{ DICT_AVP, &(struct dict_avp_data){ 625, 0, "OC-Validity-Duration", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* OC-Report-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(OC-Report-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HOST_REPORT", { .i32=0 } }, "Enumerated(OC-Report-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REALM_REPORT", { .i32=1 } }, "Enumerated(OC-Report-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Texas", { .i32=75034 } }, "Enumerated(OC-Report-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CA", { .i32=95134 } }, "Enumerated(OC-Report-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 626, 0, "OC-Report-Type", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "Enumerated(OC-Report-Type)" },
+	/* OC-Reduction-Percentage */
+	{ DICT_AVP, &(struct dict_avp_data){ 627, 0, "OC-Reduction-Percentage", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* OC-Supported-Features */
+	{ DICT_AVP, &(struct dict_avp_data){ 621, 0, "OC-Supported-Features", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* OC-OLR */
+	{ DICT_AVP, &(struct dict_avp_data){ 623, 0, "OC-OLR", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_rfc7683_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* OC-Feature-Vector */
-		{
-			struct dict_avp_data data = {
-				622,	/* Code */
-				0,	/* Vendor */
-				"OC-Feature-Vector",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* OC-Sequence-Number */
-		{
-			struct dict_avp_data data = {
-				624,	/* Code */
-				0,	/* Vendor */
-				"OC-Sequence-Number",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* OC-Validity-Duration */
-		{
-			struct dict_avp_data data = {
-				625,	/* Code */
-				0,	/* Vendor */
-				"OC-Validity-Duration",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* OC-Report-Type */
-		{
-			struct dict_avp_data data = {
-				626,	/* Code */
-				0,	/* Vendor */
-				"OC-Report-Type",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(OC-Report-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "HOST_REPORT", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "REALM_REPORT", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Texas", { .i32=75034 }};
-			struct dict_enumval_data        t_4 = { "CA", { .i32=95134 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* OC-Reduction-Percentage */
-		{
-			struct dict_avp_data data = {
-				627,	/* Code */
-				0,	/* Vendor */
-				"OC-Reduction-Percentage",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* OC-Supported-Features */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				621,	/* Code */
-				0,	/* Vendor */
-				"OC-Supported-Features",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* OC-OLR */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				623,	/* Code */
-				0,	/* Vendor */
-				"OC-OLR",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_rfc7683_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double rfc7944_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,76 +103,35 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_rfc7944_avps_defs[] = {
+	/* DRMP */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(DRMP)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_15", { .i32=15 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_14", { .i32=14 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_13", { .i32=13 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_12", { .i32=12 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_11", { .i32=11 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_10", { .i32=10 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_9", { .i32=9 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_8", { .i32=8 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_7", { .i32=7 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_6", { .i32=6 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_5", { .i32=5 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_4", { .i32=4 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_3", { .i32=3 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_2", { .i32=2 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_1", { .i32=1 } }, "Enumerated(DRMP)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_0", { .i32=0 } }, "Enumerated(DRMP)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 301, 0, "DRMP", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "Enumerated(DRMP)" },
+};
+
 static int dict_rfc7944_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* DRMP */
-		{
-			struct dict_avp_data data = {
-				301,	/* Code */
-				0,	/* Vendor */
-				"DRMP",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "Enumerated(DRMP)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PRIORITY_15", { .i32=15 }};
-			struct dict_enumval_data        t_2 = { "PRIORITY_14", { .i32=14 }};
-			struct dict_enumval_data        t_3 = { "PRIORITY_13", { .i32=13 }};
-			struct dict_enumval_data        t_4 = { "PRIORITY_12", { .i32=12 }};
-			struct dict_enumval_data        t_5 = { "PRIORITY_11", { .i32=11 }};
-			struct dict_enumval_data        t_6 = { "PRIORITY_10", { .i32=10 }};
-			struct dict_enumval_data        t_7 = { "PRIORITY_9", { .i32=9 }};
-			struct dict_enumval_data        t_8 = { "PRIORITY_8", { .i32=8 }};
-			struct dict_enumval_data        t_9 = { "PRIORITY_7", { .i32=7 }};
-			struct dict_enumval_data        t_10 = { "PRIORITY_6", { .i32=6 }};
-			struct dict_enumval_data        t_11 = { "PRIORITY_5", { .i32=5 }};
-			struct dict_enumval_data        t_12 = { "PRIORITY_4", { .i32=4 }};
-			struct dict_enumval_data        t_13 = { "PRIORITY_3", { .i32=3 }};
-			struct dict_enumval_data        t_14 = { "PRIORITY_2", { .i32=2 }};
-			struct dict_enumval_data        t_15 = { "PRIORITY_1", { .i32=1 }};
-			struct dict_enumval_data        t_16 = { "PRIORITY_0", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-
-	
-   }
+   CHECK_dict_new_batch( dict_rfc7944_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double ts29061_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,177 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29061_avps_defs[] = {
+	/* 3GPP-IMSI */
+	{ DICT_AVP, &(struct dict_avp_data){ 1, 10415, "3GPP-IMSI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* 3GPP-Charging-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 2, 10415, "3GPP-Charging-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-PDP-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(3GPP-PDP-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Ipv4", { .i32=0 } }, "3GPP/Enumerated(3GPP-PDP-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PPP", { .i32=1 } }, "3GPP/Enumerated(3GPP-PDP-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Ipv6", { .i32=2 } }, "3GPP/Enumerated(3GPP-PDP-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Ipv4v6", { .i32=3 } }, "3GPP/Enumerated(3GPP-PDP-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Non-IP", { .i32=4 } }, "3GPP/Enumerated(3GPP-PDP-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3, 10415, "3GPP-PDP-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(3GPP-PDP-Type)" },
+	/* 3GPP-CG-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 4, 10415, "3GPP-CG-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-GPRS-Negotiated-QoS-Profile */
+	{ DICT_AVP, &(struct dict_avp_data){ 5, 10415, "3GPP-GPRS-Negotiated-QoS-Profile", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* 3GPP-SGSN-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 6, 10415, "3GPP-SGSN-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-GGSN-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 7, 10415, "3GPP-GGSN-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-IMSI-MCC-MNC */
+	{ DICT_AVP, &(struct dict_avp_data){ 8, 10415, "3GPP-IMSI-MCC-MNC", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* 3GPP-GGSN-MCC-MNC */
+	{ DICT_AVP, &(struct dict_avp_data){ 9, 10415, "3GPP-GGSN-MCC-MNC", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* 3GPP-NSAPI */
+	{ DICT_AVP, &(struct dict_avp_data){ 10, 10415, "3GPP-NSAPI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-Selection-Mode */
+	{ DICT_AVP, &(struct dict_avp_data){ 12, 10415, "3GPP-Selection-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* 3GPP-Charging-Characteristics */
+	{ DICT_AVP, &(struct dict_avp_data){ 13, 10415, "3GPP-Charging-Characteristics", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* 3GPP-CG-Ipv6-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 14, 10415, "3GPP-CG-Ipv6-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-SGSN-Ipv6-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 15, 10415, "3GPP-SGSN-Ipv6-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-GGSN-Ipv6-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 16, 10415, "3GPP-GGSN-Ipv6-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-Ipv6-DNS-Servers */
+	{ DICT_AVP, &(struct dict_avp_data){ 17, 10415, "3GPP-Ipv6-DNS-Servers", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-SGSN-MCC-MNC */
+	{ DICT_AVP, &(struct dict_avp_data){ 18, 10415, "3GPP-SGSN-MCC-MNC", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* 3GPP-IMEISV */
+	{ DICT_AVP, &(struct dict_avp_data){ 20, 10415, "3GPP-IMEISV", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-RAT-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 21, 10415, "3GPP-RAT-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-User-Location-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 22, 10415, "3GPP-User-Location-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-MS-TimeZone */
+	{ DICT_AVP, &(struct dict_avp_data){ 23, 10415, "3GPP-MS-TimeZone", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-CAMEL-Charging-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 24, 10415, "3GPP-CAMEL-Charging-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-Packet-Filter */
+	{ DICT_AVP, &(struct dict_avp_data){ 25, 10415, "3GPP-Packet-Filter", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-Negotiated-DSCP */
+	{ DICT_AVP, &(struct dict_avp_data){ 26, 10415, "3GPP-Negotiated-DSCP", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-Allocate-IP-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 27, 10415, "3GPP-Allocate-IP-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* TWAN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 29, 10415, "TWAN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP-User-Location-Info-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 30, 10415, "3GPP-User-Location-Info-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* TMGI */
+	{ DICT_AVP, &(struct dict_avp_data){ 900, 10415, "TMGI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Required-MBMS-Bearer-Capabilities */
+	{ DICT_AVP, &(struct dict_avp_data){ 901, 10415, "Required-MBMS-Bearer-Capabilities", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* MBMS-StartStop-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-StartStop-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "START", { .i32=0 } }, "3GPP/Enumerated(MBMS-StartStop-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "STOP", { .i32=1 } }, "3GPP/Enumerated(MBMS-StartStop-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UPDATE", { .i32=2 } }, "3GPP/Enumerated(MBMS-StartStop-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HEARTBEAT", { .i32=3 } }, "3GPP/Enumerated(MBMS-StartStop-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 902, 10415, "MBMS-StartStop-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-StartStop-Indication)" },
+	/* MBMS-Service-Area */
+	{ DICT_AVP, &(struct dict_avp_data){ 903, 10415, "MBMS-Service-Area", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-Session-Duration */
+	{ DICT_AVP, &(struct dict_avp_data){ 904, 10415, "MBMS-Session-Duration", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Alternative-APN */
+	{ DICT_AVP, &(struct dict_avp_data){ 905, 10415, "Alternative-APN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* MBMS-Service-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-Service-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MULTICAST", { .i32=0 } }, "3GPP/Enumerated(MBMS-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BROADCAST", { .i32=1 } }, "3GPP/Enumerated(MBMS-Service-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 906, 10415, "MBMS-Service-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-Service-Type)" },
+	/* MBMS-2G-3G-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-2G-3G-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "G_AND_3G", { .i32=2 } }, "3GPP/Enumerated(MBMS-2G-3G-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 907, 10415, "MBMS-2G-3G-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-2G-3G-Indicator)" },
+	/* MBMS-Session-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 908, 10415, "MBMS-Session-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* RAI */
+	{ DICT_AVP, &(struct dict_avp_data){ 909, 10415, "RAI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Additional-MBMS-Trace-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 910, 10415, "Additional-MBMS-Trace-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-Time-To-Data-Transfer */
+	{ DICT_AVP, &(struct dict_avp_data){ 911, 10415, "MBMS-Time-To-Data-Transfer", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-Session-Repetition-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 912, 10415, "MBMS-Session-Repetition-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-Required-QoS */
+	{ DICT_AVP, &(struct dict_avp_data){ 913, 10415, "MBMS-Required-QoS", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* MBMS-Counting-Information */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-Counting-Information)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "COUNTING_NOT_APPLICABLE", { .i32=0 } }, "3GPP/Enumerated(MBMS-Counting-Information)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "COUNTING_APPLICABLE", { .i32=1 } }, "3GPP/Enumerated(MBMS-Counting-Information)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 914, 10415, "MBMS-Counting-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-Counting-Information)" },
+	/* MBMS-User-Data-Mode-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-User-Data-Mode-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Unicast", { .i32=0 } }, "3GPP/Enumerated(MBMS-User-Data-Mode-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Multicast_and_Unicast", { .i32=1 } }, "3GPP/Enumerated(MBMS-User-Data-Mode-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 915, 10415, "MBMS-User-Data-Mode-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-User-Data-Mode-Indication)" },
+	/* MBMS-GGSN-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 916, 10415, "MBMS-GGSN-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-GGSN-Ipv6-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 917, 10415, "MBMS-GGSN-Ipv6-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-BMSC-SSM-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 918, 10415, "MBMS-BMSC-SSM-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-BMSC-SSM-Ipv6-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 919, 10415, "MBMS-BMSC-SSM-Ipv6-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-Flow-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 920, 10415, "MBMS-Flow-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* CN-IP-Multicast-Distribution */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(CN-IP-Multicast-Distribution)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_IP_MULTICAST", { .i32=0 } }, "3GPP/Enumerated(CN-IP-Multicast-Distribution)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IP_MULTICAST", { .i32=1 } }, "3GPP/Enumerated(CN-IP-Multicast-Distribution)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 921, 10415, "CN-IP-Multicast-Distribution", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(CN-IP-Multicast-Distribution)" },
+	/* MBMS-HC-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-HC-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "General", { .i32=0 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Re_Auth_Request_Command", { .i32=1 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Usage_of_RADIUS_at_the_Pk_Reference_Point", { .i32=18 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Usage_of_Diameter_on_Mz_interface", { .i32=19 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RE_Auth_Answer_Command", { .i32=2 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Usage_of_Diameter_on_SGmb_interface", { .i32=20 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Session_Termination_Request_Command", { .i32=3 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Session_Termination_Answer_Command", { .i32=4 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Abort_Session_Request_Command", { .i32=5 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Abort_Session_Answer_Command", { .i32=6 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Gmb_specific_Experimental_Result_Code_AVP_values", { .i32=8 } }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 922, 10415, "MBMS-HC-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-HC-Indicator)" },
+	/* MBMS-Access-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-Access-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UTRAN", { .i32=0 } }, "3GPP/Enumerated(MBMS-Access-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "E_UTRAN", { .i32=1 } }, "3GPP/Enumerated(MBMS-Access-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UTRAN_AND_E_UTRAN", { .i32=2 } }, "3GPP/Enumerated(MBMS-Access-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 923, 10415, "MBMS-Access-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-Access-Indicator)" },
+	/* MBMS-GW-SSM-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 924, 10415, "MBMS-GW-SSM-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-GW-SSM-Ipv6-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 925, 10415, "MBMS-GW-SSM-Ipv6-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-BMSC-SSM-UDP-Port */
+	{ DICT_AVP, &(struct dict_avp_data){ 926, 10415, "MBMS-BMSC-SSM-UDP-Port", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-GW-UDP-Port */
+	{ DICT_AVP, &(struct dict_avp_data){ 927, 10415, "MBMS-GW-UDP-Port", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MBMS-GW-UDP-Port-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-GW-UDP-Port-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UDP_PORT_REQUIRED", { .i32=1 } }, "3GPP/Enumerated(MBMS-GW-UDP-Port-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 928, 10415, "MBMS-GW-UDP-Port-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-GW-UDP-Port-Indicator)" },
+	/* MBMS-Data-Transfer-Start */
+	{ DICT_AVP, &(struct dict_avp_data){ 929, 10415, "MBMS-Data-Transfer-Start", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* MBMS-Data-Transfer-Stop */
+	{ DICT_AVP, &(struct dict_avp_data){ 930, 10415, "MBMS-Data-Transfer-Stop", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* MBMS-Flag */
+	{ DICT_AVP, &(struct dict_avp_data){ 931, 10415, "MBMS-Flag", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Restart-Counter */
+	{ DICT_AVP, &(struct dict_avp_data){ 932, 10415, "Restart-Counter", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Diagnostic-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 933, 10415, "Diagnostic-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MBMS-Cell-List */
+	{ DICT_AVP, &(struct dict_avp_data){ 934, 10415, "MBMS-Cell-List", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+};
+
 static int dict_ts29061_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,873 +287,7 @@ static int dict_ts29061_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* 3GPP-IMSI */
-		{
-			struct dict_avp_data data = {
-				1,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-IMSI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* 3GPP-Charging-Id */
-		{
-			struct dict_avp_data data = {
-				2,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-Charging-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-PDP-Type */
-		{
-			struct dict_avp_data data = {
-				3,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-PDP-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(3GPP-PDP-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Ipv4", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PPP", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Ipv6", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "Ipv4v6", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "Non-IP", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* 3GPP-CG-Address */
-		{
-			struct dict_avp_data data = {
-				4,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-CG-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-GPRS-Negotiated-QoS-Profile */
-		{
-			struct dict_avp_data data = {
-				5,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-GPRS-Negotiated-QoS-Profile",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* 3GPP-SGSN-Address */
-		{
-			struct dict_avp_data data = {
-				6,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-SGSN-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-GGSN-Address */
-		{
-			struct dict_avp_data data = {
-				7,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-GGSN-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-IMSI-MCC-MNC */
-		{
-			struct dict_avp_data data = {
-				8,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-IMSI-MCC-MNC",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* 3GPP-GGSN-MCC-MNC */
-		{
-			struct dict_avp_data data = {
-				9,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-GGSN-MCC-MNC",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* 3GPP-NSAPI */
-		{
-			struct dict_avp_data data = {
-				10,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-NSAPI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-Selection-Mode */
-		{
-			struct dict_avp_data data = {
-				12,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-Selection-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* 3GPP-Charging-Characteristics */
-		{
-			struct dict_avp_data data = {
-				13,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-Charging-Characteristics",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* 3GPP-CG-Ipv6-Address */
-		{
-			struct dict_avp_data data = {
-				14,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-CG-Ipv6-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-SGSN-Ipv6-Address */
-		{
-			struct dict_avp_data data = {
-				15,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-SGSN-Ipv6-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-GGSN-Ipv6-Address */
-		{
-			struct dict_avp_data data = {
-				16,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-GGSN-Ipv6-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-Ipv6-DNS-Servers */
-		{
-			struct dict_avp_data data = {
-				17,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-Ipv6-DNS-Servers",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-SGSN-MCC-MNC */
-		{
-			struct dict_avp_data data = {
-				18,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-SGSN-MCC-MNC",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* 3GPP-IMEISV */
-		{
-			struct dict_avp_data data = {
-				20,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-IMEISV",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-RAT-Type */
-		{
-			struct dict_avp_data data = {
-				21,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-RAT-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-User-Location-Info */
-		{
-			struct dict_avp_data data = {
-				22,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-User-Location-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-MS-TimeZone */
-		{
-			struct dict_avp_data data = {
-				23,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-MS-TimeZone",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-CAMEL-Charging-Info */
-		{
-			struct dict_avp_data data = {
-				24,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-CAMEL-Charging-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-Packet-Filter */
-		{
-			struct dict_avp_data data = {
-				25,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-Packet-Filter",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-Negotiated-DSCP */
-		{
-			struct dict_avp_data data = {
-				26,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-Negotiated-DSCP",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-Allocate-IP-Type */
-		{
-			struct dict_avp_data data = {
-				27,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-Allocate-IP-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TWAN-Identifier */
-		{
-			struct dict_avp_data data = {
-				29,	/* Code */
-				10415,	/* Vendor */
-				"TWAN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP-User-Location-Info-Time */
-		{
-			struct dict_avp_data data = {
-				30,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-User-Location-Info-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TMGI */
-		{
-			struct dict_avp_data data = {
-				900,	/* Code */
-				10415,	/* Vendor */
-				"TMGI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Required-MBMS-Bearer-Capabilities */
-		{
-			struct dict_avp_data data = {
-				901,	/* Code */
-				10415,	/* Vendor */
-				"Required-MBMS-Bearer-Capabilities",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* MBMS-StartStop-Indication */
-		{
-			struct dict_avp_data data = {
-				902,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-StartStop-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-StartStop-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "START", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "STOP", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "UPDATE", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "HEARTBEAT", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-Service-Area */
-		{
-			struct dict_avp_data data = {
-				903,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Service-Area",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-Session-Duration */
-		{
-			struct dict_avp_data data = {
-				904,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Session-Duration",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Alternative-APN */
-		{
-			struct dict_avp_data data = {
-				905,	/* Code */
-				10415,	/* Vendor */
-				"Alternative-APN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* MBMS-Service-Type */
-		{
-			struct dict_avp_data data = {
-				906,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Service-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-Service-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "MULTICAST", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "BROADCAST", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-2G-3G-Indicator */
-		{
-			struct dict_avp_data data = {
-				907,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-2G-3G-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-2G-3G-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "G_AND_3G", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-Session-Identity */
-		{
-			struct dict_avp_data data = {
-				908,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Session-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* RAI */
-		{
-			struct dict_avp_data data = {
-				909,	/* Code */
-				10415,	/* Vendor */
-				"RAI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Additional-MBMS-Trace-Info */
-		{
-			struct dict_avp_data data = {
-				910,	/* Code */
-				10415,	/* Vendor */
-				"Additional-MBMS-Trace-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-Time-To-Data-Transfer */
-		{
-			struct dict_avp_data data = {
-				911,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Time-To-Data-Transfer",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-Session-Repetition-Number */
-		{
-			struct dict_avp_data data = {
-				912,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Session-Repetition-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-Required-QoS */
-		{
-			struct dict_avp_data data = {
-				913,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Required-QoS",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* MBMS-Counting-Information */
-		{
-			struct dict_avp_data data = {
-				914,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Counting-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-Counting-Information)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "COUNTING_NOT_APPLICABLE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "COUNTING_APPLICABLE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-User-Data-Mode-Indication */
-		{
-			struct dict_avp_data data = {
-				915,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-User-Data-Mode-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-User-Data-Mode-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Unicast", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Multicast_and_Unicast", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-GGSN-Address */
-		{
-			struct dict_avp_data data = {
-				916,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-GGSN-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-GGSN-Ipv6-Address */
-		{
-			struct dict_avp_data data = {
-				917,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-GGSN-Ipv6-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-BMSC-SSM-IP-Address */
-		{
-			struct dict_avp_data data = {
-				918,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-BMSC-SSM-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-BMSC-SSM-Ipv6-Address */
-		{
-			struct dict_avp_data data = {
-				919,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-BMSC-SSM-Ipv6-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-Flow-Identifier */
-		{
-			struct dict_avp_data data = {
-				920,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Flow-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CN-IP-Multicast-Distribution */
-		{
-			struct dict_avp_data data = {
-				921,	/* Code */
-				10415,	/* Vendor */
-				"CN-IP-Multicast-Distribution",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(CN-IP-Multicast-Distribution)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NO_IP_MULTICAST", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "IP_MULTICAST", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-HC-Indicator */
-		{
-			struct dict_avp_data data = {
-				922,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-HC-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-HC-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "General", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Re_Auth_Request_Command", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Usage_of_RADIUS_at_the_Pk_Reference_Point", { .i32=18 }};
-			struct dict_enumval_data        t_4 = { "Usage_of_Diameter_on_Mz_interface", { .i32=19 }};
-			struct dict_enumval_data        t_5 = { "RE_Auth_Answer_Command", { .i32=2 }};
-			struct dict_enumval_data        t_6 = { "Usage_of_Diameter_on_SGmb_interface", { .i32=20 }};
-			struct dict_enumval_data        t_7 = { "Session_Termination_Request_Command", { .i32=3 }};
-			struct dict_enumval_data        t_8 = { "Session_Termination_Answer_Command", { .i32=4 }};
-			struct dict_enumval_data        t_9 = { "Abort_Session_Request_Command", { .i32=5 }};
-			struct dict_enumval_data        t_10 = { "Abort_Session_Answer_Command", { .i32=6 }};
-			struct dict_enumval_data        t_11 = { "Gmb_specific_Experimental_Result_Code_AVP_values", { .i32=8 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-Access-Indicator */
-		{
-			struct dict_avp_data data = {
-				923,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Access-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-Access-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UTRAN", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "E_UTRAN", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "UTRAN_AND_E_UTRAN", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-GW-SSM-IP-Address */
-		{
-			struct dict_avp_data data = {
-				924,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-GW-SSM-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-GW-SSM-Ipv6-Address */
-		{
-			struct dict_avp_data data = {
-				925,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-GW-SSM-Ipv6-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-BMSC-SSM-UDP-Port */
-		{
-			struct dict_avp_data data = {
-				926,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-BMSC-SSM-UDP-Port",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-GW-UDP-Port */
-		{
-			struct dict_avp_data data = {
-				927,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-GW-UDP-Port",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-GW-UDP-Port-Indicator */
-		{
-			struct dict_avp_data data = {
-				928,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-GW-UDP-Port-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-GW-UDP-Port-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UDP_PORT_REQUIRED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-Data-Transfer-Start */
-		{
-			struct dict_avp_data data = {
-				929,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Data-Transfer-Start",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-Data-Transfer-Stop */
-		{
-			struct dict_avp_data data = {
-				930,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Data-Transfer-Stop",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-Flag */
-		{
-			struct dict_avp_data data = {
-				931,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Flag",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Restart-Counter */
-		{
-			struct dict_avp_data data = {
-				932,	/* Code */
-				10415,	/* Vendor */
-				"Restart-Counter",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Diagnostic-Info */
-		{
-			struct dict_avp_data data = {
-				933,	/* Code */
-				10415,	/* Vendor */
-				"Diagnostic-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBMS-Cell-List */
-		{
-			struct dict_avp_data data = {
-				934,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Cell-List",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29061_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double ts29128_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,52 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29128_avps_defs[] = {
+	/* Cause-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 4301, 10415, "Cause-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* S1AP-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 4302, 10415, "S1AP-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* RANAP-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 4303, 10415, "RANAP-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* BSSGP-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 4309, 10415, "BSSGP-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* GMM-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 4304, 10415, "GMM-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SM-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 4305, 10415, "SM-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* UE-Count */
+	{ DICT_AVP, &(struct dict_avp_data){ 4308, 10415, "UE-Count", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Connection-Action */
+	{ DICT_AVP, &(struct dict_avp_data){ 4314, 10415, "Connection-Action", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Non-IP-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 4315, 10415, "Non-IP-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Uplink-Rate-Limit */
+	{ DICT_AVP, &(struct dict_avp_data){ 4311, 10415, "Uplink-Rate-Limit", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Downlink-Rate-Limit */
+	{ DICT_AVP, &(struct dict_avp_data){ 4312, 10415, "Downlink-Rate-Limit", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Extended-PCO */
+	{ DICT_AVP, &(struct dict_avp_data){ 4313, 10415, "Extended-PCO", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SCEF-Wait-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 4316, 10415, "SCEF-Wait-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* CMR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 4317, 10415, "CMR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Counter-Value */
+	{ DICT_AVP, &(struct dict_avp_data){ 4319, 10415, "Counter-Value", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* RRC-Counter-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 4320, 10415, "RRC-Counter-Timestamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Communication-Failure-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 4300, 10415, "Communication-Failure-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* RRC-Cause-Counter */
+	{ DICT_AVP, &(struct dict_avp_data){ 4318, 10415, "RRC-Cause-Counter", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Serving-PLMN-Rate-Control */
+	{ DICT_AVP, &(struct dict_avp_data){ 4310, 10415, "Serving-PLMN-Rate-Control", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Number-Of-UE-Per-Location-Report */
+	{ DICT_AVP, &(struct dict_avp_data){ 4307, 10415, "Number-Of-UE-Per-Location-Report", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Number-Of-UE-Per-Location-Configuration */
+	{ DICT_AVP, &(struct dict_avp_data){ 4306, 10415, "Number-Of-UE-Per-Location-Configuration", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29128_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,285 +162,7 @@ static int dict_ts29128_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* Cause-Type */
-		{
-			struct dict_avp_data data = {
-				4301,	/* Code */
-				10415,	/* Vendor */
-				"Cause-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* S1AP-Cause */
-		{
-			struct dict_avp_data data = {
-				4302,	/* Code */
-				10415,	/* Vendor */
-				"S1AP-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* RANAP-Cause */
-		{
-			struct dict_avp_data data = {
-				4303,	/* Code */
-				10415,	/* Vendor */
-				"RANAP-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* BSSGP-Cause */
-		{
-			struct dict_avp_data data = {
-				4309,	/* Code */
-				10415,	/* Vendor */
-				"BSSGP-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* GMM-Cause */
-		{
-			struct dict_avp_data data = {
-				4304,	/* Code */
-				10415,	/* Vendor */
-				"GMM-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Cause */
-		{
-			struct dict_avp_data data = {
-				4305,	/* Code */
-				10415,	/* Vendor */
-				"SM-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* UE-Count */
-		{
-			struct dict_avp_data data = {
-				4308,	/* Code */
-				10415,	/* Vendor */
-				"UE-Count",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Connection-Action */
-		{
-			struct dict_avp_data data = {
-				4314,	/* Code */
-				10415,	/* Vendor */
-				"Connection-Action",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Non-IP-Data */
-		{
-			struct dict_avp_data data = {
-				4315,	/* Code */
-				10415,	/* Vendor */
-				"Non-IP-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Uplink-Rate-Limit */
-		{
-			struct dict_avp_data data = {
-				4311,	/* Code */
-				10415,	/* Vendor */
-				"Uplink-Rate-Limit",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Downlink-Rate-Limit */
-		{
-			struct dict_avp_data data = {
-				4312,	/* Code */
-				10415,	/* Vendor */
-				"Downlink-Rate-Limit",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Extended-PCO */
-		{
-			struct dict_avp_data data = {
-				4313,	/* Code */
-				10415,	/* Vendor */
-				"Extended-PCO",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SCEF-Wait-Time */
-		{
-			struct dict_avp_data data = {
-				4316,	/* Code */
-				10415,	/* Vendor */
-				"SCEF-Wait-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* CMR-Flags */
-		{
-			struct dict_avp_data data = {
-				4317,	/* Code */
-				10415,	/* Vendor */
-				"CMR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Counter-Value */
-		{
-			struct dict_avp_data data = {
-				4319,	/* Code */
-				10415,	/* Vendor */
-				"Counter-Value",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* RRC-Counter-Timestamp */
-		{
-			struct dict_avp_data data = {
-				4320,	/* Code */
-				10415,	/* Vendor */
-				"RRC-Counter-Timestamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Communication-Failure-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				4300,	/* Code */
-				10415,	/* Vendor */
-				"Communication-Failure-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* RRC-Cause-Counter */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				4318,	/* Code */
-				10415,	/* Vendor */
-				"RRC-Cause-Counter",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Serving-PLMN-Rate-Control */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				4310,	/* Code */
-				10415,	/* Vendor */
-				"Serving-PLMN-Rate-Control",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Number-Of-UE-Per-Location-Report */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				4307,	/* Code */
-				10415,	/* Vendor */
-				"Number-Of-UE-Per-Location-Report",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Number-Of-UE-Per-Location-Configuration */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				4306,	/* Code */
-				10415,	/* Vendor */
-				"Number-Of-UE-Per-Location-Configuration",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29128_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double ts29173_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,34 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29173_avps_defs[] = {
+	/* LMSI */
+	{ DICT_AVP, &(struct dict_avp_data){ 2400, 10415, "LMSI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MME-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 2402, 10415, "MME-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* MSC-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 2403, 10415, "MSC-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* LCS-Capabilities-Sets */
+	{ DICT_AVP, &(struct dict_avp_data){ 2404, 10415, "LCS-Capabilities-Sets", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* GMLC-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2405, 10415, "GMLC-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* PPR-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2407, 10415, "PPR-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* MME-Realm */
+	{ DICT_AVP, &(struct dict_avp_data){ 2408, 10415, "MME-Realm", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* SGSN-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 2409, 10415, "SGSN-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* SGSN-Realm */
+	{ DICT_AVP, &(struct dict_avp_data){ 2410, 10415, "SGSN-Realm", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* RIA-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 2411, 10415, "RIA-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Additional-Serving-Node */
+	{ DICT_AVP, &(struct dict_avp_data){ 2406, 10415, "Additional-Serving-Node", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Serving-Node */
+	{ DICT_AVP, &(struct dict_avp_data){ 2401, 10415, "Serving-Node", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29173_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,171 +144,7 @@ static int dict_ts29173_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* LMSI */
-		{
-			struct dict_avp_data data = {
-				2400,	/* Code */
-				10415,	/* Vendor */
-				"LMSI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MME-Name */
-		{
-			struct dict_avp_data data = {
-				2402,	/* Code */
-				10415,	/* Vendor */
-				"MME-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* MSC-Number */
-		{
-			struct dict_avp_data data = {
-				2403,	/* Code */
-				10415,	/* Vendor */
-				"MSC-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* LCS-Capabilities-Sets */
-		{
-			struct dict_avp_data data = {
-				2404,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Capabilities-Sets",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* GMLC-Address */
-		{
-			struct dict_avp_data data = {
-				2405,	/* Code */
-				10415,	/* Vendor */
-				"GMLC-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* PPR-Address */
-		{
-			struct dict_avp_data data = {
-				2407,	/* Code */
-				10415,	/* Vendor */
-				"PPR-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* MME-Realm */
-		{
-			struct dict_avp_data data = {
-				2408,	/* Code */
-				10415,	/* Vendor */
-				"MME-Realm",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* SGSN-Name */
-		{
-			struct dict_avp_data data = {
-				2409,	/* Code */
-				10415,	/* Vendor */
-				"SGSN-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* SGSN-Realm */
-		{
-			struct dict_avp_data data = {
-				2410,	/* Code */
-				10415,	/* Vendor */
-				"SGSN-Realm",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* RIA-Flags */
-		{
-			struct dict_avp_data data = {
-				2411,	/* Code */
-				10415,	/* Vendor */
-				"RIA-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Additional-Serving-Node */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2406,	/* Code */
-				10415,	/* Vendor */
-				"Additional-Serving-Node",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Serving-Node */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2401,	/* Code */
-				10415,	/* Vendor */
-				"Serving-Node",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29173_avps_defs );
 
    /* Commands section */
    {
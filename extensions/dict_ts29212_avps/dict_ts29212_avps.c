@@ -43,6 +43,12 @@ const double ts29212_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,521 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29212_avps_defs[] = {
+	/* 3GPP-PS-Data-Off-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ACTIVE", { .i32=0 } }, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INACTIVE", { .i32=1 } }, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2847, 10415, "3GPP-PS-Data-Off-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)" },
+	/* Access-Availability-Change-Reason */
+	{ DICT_AVP, &(struct dict_avp_data){ 2833, 10415, "Access-Availability-Change-Reason", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* AN-GW-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1050, 10415, "AN-GW-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* AN-GW-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(AN-GW-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AN_GW_FAILED", { .i32=0 } }, "3GPP/Enumerated(AN-GW-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2811, 10415, "AN-GW-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(AN-GW-Status)" },
+	/* APN-Aggregate-Max-Bitrate-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 1040, 10415, "APN-Aggregate-Max-Bitrate-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* APN-Aggregate-Max-Bitrate-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 1041, 10415, "APN-Aggregate-Max-Bitrate-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Bearer-Control-Mode */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Bearer-Control-Mode)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_ONLY", { .i32=0 } }, "3GPP/Enumerated(Bearer-Control-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESERVED", { .i32=1 } }, "3GPP/Enumerated(Bearer-Control-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_NW", { .i32=2 } }, "3GPP/Enumerated(Bearer-Control-Mode)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1023, 10415, "Bearer-Control-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Bearer-Control-Mode)" },
+	/* Bearer-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 1020, 10415, "Bearer-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Bearer-Operation */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Bearer-Operation)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TERMINATION", { .i32=0 } }, "3GPP/Enumerated(Bearer-Operation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ESTABLISHMENT", { .i32=1 } }, "3GPP/Enumerated(Bearer-Operation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MODIFICATION", { .i32=2 } }, "3GPP/Enumerated(Bearer-Operation)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1021, 10415, "Bearer-Operation", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Bearer-Operation)" },
+	/* Bearer-Usage */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Bearer-Usage)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GENERAL", { .i32=0 } }, "3GPP/Enumerated(Bearer-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IMS_SIGNALLING", { .i32=1 } }, "3GPP/Enumerated(Bearer-Usage)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1000, 10415, "Bearer-Usage", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Bearer-Usage)" },
+	/* Charging-Correlation-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Charging-Correlation-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHARGING_IDENTIFIER_REQUIRED", { .i32=0 } }, "3GPP/Enumerated(Charging-Correlation-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1073, 10415, "Charging-Correlation-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Charging-Correlation-Indicator)" },
+	/* Charging-Rule-Base-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1004, 10415, "Charging-Rule-Base-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Charging-Rule-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1005, 10415, "Charging-Rule-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* CoA-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1035, 10415, "CoA-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Credit-Management-Status */
+	{ DICT_AVP, &(struct dict_avp_data){ 1082, 10415, "Credit-Management-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* CSG-Information-Reporting */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(CSG-Information-Reporting)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_CSG_CELL", { .i32=0 } }, "3GPP/Enumerated(CSG-Information-Reporting)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_CSG_SUBSCRIBED_HYBRID_CELL", { .i32=1 } }, "3GPP/Enumerated(CSG-Information-Reporting)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_CSG_UNSUBSCRIBED_HYBRID_CELL", { .i32=2 } }, "3GPP/Enumerated(CSG-Information-Reporting)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1071, 10415, "CSG-Information-Reporting", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(CSG-Information-Reporting)" },
+	/* Default-Access */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Default-Access)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPP_GPRS", { .i32=0 } }, "3GPP/Enumerated(Default-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DOCSIS", { .i32=1 } }, "3GPP/Enumerated(Default-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "xDSL", { .i32=2 } }, "3GPP/Enumerated(Default-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WiMAX", { .i32=3 } }, "3GPP/Enumerated(Default-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPP2", { .i32=4 } }, "3GPP/Enumerated(Default-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPP_EPS", { .i32=5 } }, "3GPP/Enumerated(Default-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Non_3GPP_EPS", { .i32=6 } }, "3GPP/Enumerated(Default-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FBA", { .i32=7 } }, "3GPP/Enumerated(Default-Access)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2829, 10415, "Default-Access", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Default-Access)" },
+	/* Default-Bearer-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Default-Bearer-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BIND_TO_DEF_BEARER", { .i32=0 } }, "3GPP/Enumerated(Default-Bearer-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BIND_TO_APPLICABLE_BEARER", { .i32=1 } }, "3GPP/Enumerated(Default-Bearer-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2844, 10415, "Default-Bearer-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Default-Bearer-Indication)" },
+	/* Default-QoS-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 2817, 10415, "Default-QoS-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Event-Trigger */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Event-Trigger)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SGSN_CHANGE", { .i32=0 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QOS_CHANGE", { .i32=1 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QOS_CHANGE_EXCEEDING_AUTHORIZATION", { .i32=11 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RAI_CHANGE", { .i32=12 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_LOCATION_CHANGE", { .i32=13 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_EVENT_TRIGGERS", { .i32=14 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "OUT_OF_CREDIT", { .i32=15 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REALLOCATION_OF_CREDIT", { .i32=16 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REVALIDATION_TIMEOUT", { .i32=17 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_IP_ADDRESS_ALLOCATE", { .i32=18 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_IP_ADDRESS_RELEASE", { .i32=19 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RAT_CHANGE", { .i32=2 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DEFAULT_EPS_BEARER_QOS_CHANGE", { .i32=20 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AN_GW_CHANGE", { .i32=21 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUCCESSFUL_RESOURCE_ALLOCATION", { .i32=22 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESOURCE_MODIFICATION_REQUEST", { .i32=23 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PGW_TRACE_CONTROL", { .i32=24 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_TIME_ZONE_CHANGE", { .i32=25 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TAI_CHANGE", { .i32=26 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ECGI_CHANGE", { .i32=27 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHARGING_CORRELATION_EXCHANGE", { .i32=28 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "APN_AMBR_MODIFICATION_FAILURE", { .i32=29 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TFT_CHANGE", { .i32=3 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_CSG_INFORMATION_CHANGE", { .i32=30 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USAGE_REPORT", { .i32=33 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DEFAULT_EPS_BEARER_QOS_MODIFICATION_FAILURE", { .i32=34 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_CSG_HYBRID_SUBSCRIBED_INFORMATION_CHANGE", { .i32=35 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HYBRID_UNSUBSCRIBED_INFORMATION_CHANGE", { .i32=36 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ROUTING_RULE_CHANGE", { .i32=37 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "APPLICATION_START", { .i32=39 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PLMN_CHANGE", { .i32=4 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "APPLICATION_STOP", { .i32=40 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CS_TO_PS_HANDOVER", { .i32=42 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_LOCAL_IP_ADDRESS_CHANGE", { .i32=43 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NB_LOCAL_IP_ADDRESS_CHANGE", { .i32=44 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ACCESS_NETWORK_INFO_REPORT", { .i32=45 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CREDIT_MANAGEMENT_SESSION_FAILURE", { .i32=46 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DEFAULT_QOS_CHANGE", { .i32=47 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_OF_UE_PRESENCE_IN_PRESENCE_REPORTING_AREA_REPORT", { .i32=48 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ADDITION_OF_ACCESS", { .i32=49 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LOSS_OF_BEARER", { .i32=5 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REMOVAL_OF_ACCESS", { .i32=50 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNAVAILABLITY_OF_ACCESS", { .i32=51 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AVAILABLITY_OF_ACCESS", { .i32=52 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESOURCE_RELEASE", { .i32=53 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENODEB_CHANGE", { .i32=54 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPP_PS_DATA_OFF_CHANGE", { .i32=55 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RECOVERY_OF_BEARER", { .i32=6 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IP_CAN_CHANGE", { .i32=7 } }, "3GPP/Enumerated(Event-Trigger)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1006, 10415, "Event-Trigger", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Event-Trigger)" },
+	/* Execution-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 2839, 10415, "Execution-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Flow-Direction */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Flow-Direction)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNSPECIFIED", { .i32=0 } }, "3GPP/Enumerated(Flow-Direction)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DOWNLINK", { .i32=1 } }, "3GPP/Enumerated(Flow-Direction)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UPLINK", { .i32=2 } }, "3GPP/Enumerated(Flow-Direction)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BIDIRECTIONAL", { .i32=3 } }, "3GPP/Enumerated(Flow-Direction)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1080, 10415, "Flow-Direction", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Flow-Direction)" },
+	/* Flow-Label */
+	{ DICT_AVP, &(struct dict_avp_data){ 1057, 10415, "Flow-Label", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Guaranteed-Bitrate-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 1025, 10415, "Guaranteed-Bitrate-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Guaranteed-Bitrate-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 1026, 10415, "Guaranteed-Bitrate-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* HeNB-Local-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2804, 10415, "HeNB-Local-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* IP-CAN-Session-Charging-Scope */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(IP-CAN-Session-Charging-Scope)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IP_CAN_SESSION_SCOPE", { .i32=0 } }, "3GPP/Enumerated(IP-CAN-Session-Charging-Scope)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2827, 10415, "IP-CAN-Session-Charging-Scope", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(IP-CAN-Session-Charging-Scope)" },
+	/* IP-CAN-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(IP-CAN-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPP_GPRS", { .i32=0 } }, "3GPP/Enumerated(IP-CAN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DOCSIS", { .i32=1 } }, "3GPP/Enumerated(IP-CAN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "xDSL", { .i32=2 } }, "3GPP/Enumerated(IP-CAN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WiMAX", { .i32=3 } }, "3GPP/Enumerated(IP-CAN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPP2", { .i32=4 } }, "3GPP/Enumerated(IP-CAN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPP_EPS", { .i32=5 } }, "3GPP/Enumerated(IP-CAN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Non_3GPP_EPS", { .i32=6 } }, "3GPP/Enumerated(IP-CAN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FBA", { .i32=7 } }, "3GPP/Enumerated(IP-CAN-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1027, 10415, "IP-CAN-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(IP-CAN-Type)" },
+	/* Metering-Method */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Metering-Method)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DURATION", { .i32=0 } }, "3GPP/Enumerated(Metering-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VOLUME", { .i32=1 } }, "3GPP/Enumerated(Metering-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DURATION_VOLUME", { .i32=2 } }, "3GPP/Enumerated(Metering-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EVENT", { .i32=3 } }, "3GPP/Enumerated(Metering-Method)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1007, 10415, "Metering-Method", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Metering-Method)" },
+	/* Monitoring-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 2828, 10415, "Monitoring-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Monitoring-Key */
+	{ DICT_AVP, &(struct dict_avp_data){ 1066, 10415, "Monitoring-Key", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Mute-Notification */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Mute-Notification)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MUTE_REQUIRED", { .i32=0 } }, "3GPP/Enumerated(Mute-Notification)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2809, 10415, "Mute-Notification", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Mute-Notification)" },
+	/* Monitoring-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 2810, 10415, "Monitoring-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* NBIFOM-Mode */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(NBIFOM-Mode)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_INITIATED", { .i32=0 } }, "3GPP/Enumerated(NBIFOM-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NETWORK_INITIATED", { .i32=1 } }, "3GPP/Enumerated(NBIFOM-Mode)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2830, 10415, "NBIFOM-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(NBIFOM-Mode)" },
+	/* NBIFOM-Support */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(NBIFOM-Support)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NBIFOM_NOT_SUPPORTED", { .i32=0 } }, "3GPP/Enumerated(NBIFOM-Support)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NBIFOM_SUPPORTED", { .i32=1 } }, "3GPP/Enumerated(NBIFOM-Support)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2831, 10415, "NBIFOM-Support", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(NBIFOM-Support)" },
+	/* NetLoc-Access-Support */
+	{ DICT_AVP, &(struct dict_avp_data){ 2824, 10415, "NetLoc-Access-Support", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Network-Request-Support */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Network-Request-Support)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NETWORK_REQUEST_NOT_SUPPORTED", { .i32=0 } }, "3GPP/Enumerated(Network-Request-Support)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NETWORK_REQUEST_SUPPORTED", { .i32=1 } }, "3GPP/Enumerated(Network-Request-Support)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1024, 10415, "Network-Request-Support", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Network-Request-Support)" },
+	/* Offline */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Offline)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DISABLE_OFFLINE", { .i32=0 } }, "3GPP/Enumerated(Offline)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENABLE_OFFLINE", { .i32=1 } }, "3GPP/Enumerated(Offline)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1008, 10415, "Offline", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Offline)" },
+	/* Online */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Online)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DISABLE_ONLINE", { .i32=0 } }, "3GPP/Enumerated(Online)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENABLE_ONLINE", { .i32=1 } }, "3GPP/Enumerated(Online)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1009, 10415, "Online", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Online)" },
+	/* Packet-Filter-Content */
+	{ DICT_AVP, &(struct dict_avp_data){ 1059, 10415, "Packet-Filter-Content", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "IPFilterRule" },
+	/* Packet-Filter-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 1060, 10415, "Packet-Filter-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Packet-Filter-Operation */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Packet-Filter-Operation)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DELETION", { .i32=0 } }, "3GPP/Enumerated(Packet-Filter-Operation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ADDITION", { .i32=1 } }, "3GPP/Enumerated(Packet-Filter-Operation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MODIFICATION", { .i32=2 } }, "3GPP/Enumerated(Packet-Filter-Operation)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1062, 10415, "Packet-Filter-Operation", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Packet-Filter-Operation)" },
+	/* Packet-Filter-Usage */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Packet-Filter-Usage)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SEND_TO_UE", { .i32=1 } }, "3GPP/Enumerated(Packet-Filter-Usage)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1072, 10415, "Packet-Filter-Usage", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Packet-Filter-Usage)" },
+	/* PCC-Rule-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PCC-Rule-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ACTIVE", { .i32=0 } }, "3GPP/Enumerated(PCC-Rule-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INACTIVE", { .i32=1 } }, "3GPP/Enumerated(PCC-Rule-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TEMPORARILY_INACTIVE", { .i32=2 } }, "3GPP/Enumerated(PCC-Rule-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1019, 10415, "PCC-Rule-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PCC-Rule-Status)" },
+	/* PDN-Connection-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1065, 10415, "PDN-Connection-ID", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Precedence */
+	{ DICT_AVP, &(struct dict_avp_data){ 1010, 10415, "Precedence", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Pre-emption-Capability */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Pre-emption-Capability)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRE_EMPTION_CAPABILITY_ENABLED", { .i32=0 } }, "3GPP/Enumerated(Pre-emption-Capability)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRE_EMPTION_CAPABILITY_DISABLED", { .i32=1 } }, "3GPP/Enumerated(Pre-emption-Capability)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1047, 10415, "Pre-emption-Capability", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Pre-emption-Capability)" },
+	/* Pre-emption-Vulnerability */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Pre-emption-Vulnerability)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRE_EMPTION_VULNERABILITY_ENABLED", { .i32=0 } }, "3GPP/Enumerated(Pre-emption-Vulnerability)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRE_EMPTION_VULNERABILITY_DISABLED", { .i32=1 } }, "3GPP/Enumerated(Pre-emption-Vulnerability)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1048, 10415, "Pre-emption-Vulnerability", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Pre-emption-Vulnerability)" },
+	/* Presence-Reporting-Area-Elements-List */
+	{ DICT_AVP, &(struct dict_avp_data){ 2820, 10415, "Presence-Reporting-Area-Elements-List", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Presence-Reporting-Area-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 2821, 10415, "Presence-Reporting-Area-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Presence-Reporting-Area-Status */
+	{ DICT_AVP, &(struct dict_avp_data){ 2823, 10415, "Presence-Reporting-Area-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Priority-Level */
+	{ DICT_AVP, &(struct dict_avp_data){ 1046, 10415, "Priority-Level", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* PS-to-CS-Session-Continuity */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PS-to-CS-Session-Continuity)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VIDEO_PS2CS_CONT_CANDIDATE", { .i32=0 } }, "3GPP/Enumerated(PS-to-CS-Session-Continuity)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1099, 10415, "PS-to-CS-Session-Continuity", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PS-to-CS-Session-Continuity)" },
+	/* QoS-Class-Identifier */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(QoS-Class-Identifier)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_1", { .i32=1 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_2", { .i32=2 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_3", { .i32=3 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_4", { .i32=4 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_5", { .i32=5 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_6", { .i32=6 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_65", { .i32=65 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_66", { .i32=66 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_69", { .i32=69 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_7", { .i32=7 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_70", { .i32=70 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_75", { .i32=75 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_79", { .i32=79 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_8", { .i32=8 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QCI_9", { .i32=9 } }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1028, 10415, "QoS-Class-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(QoS-Class-Identifier)" },
+	/* QoS-Negotiation */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(QoS-Negotiation)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_QoS_NEGOTIATION", { .i32=0 } }, "3GPP/Enumerated(QoS-Negotiation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QoS_NEGOTIATION_SUPPORTED", { .i32=1 } }, "3GPP/Enumerated(QoS-Negotiation)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1029, 10415, "QoS-Negotiation", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(QoS-Negotiation)" },
+	/* QoS-Upgrade */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(QoS-Upgrade)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QoS_UPGRADE_NOT_SUPPORTED", { .i32=0 } }, "3GPP/Enumerated(QoS-Upgrade)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QoS_UPGRADE_SUPPORTED", { .i32=1 } }, "3GPP/Enumerated(QoS-Upgrade)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1030, 10415, "QoS-Upgrade", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(QoS-Upgrade)" },
+	/* RAN-NAS-Release-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 2819, 10415, "RAN-NAS-Release-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* RAN-Rule-Support */
+	{ DICT_AVP, &(struct dict_avp_data){ 2832, 10415, "RAN-Rule-Support", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* RAT-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(RAT-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WLAN", { .i32=0 } }, "3GPP/Enumerated(RAT-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VIRTUAL", { .i32=1 } }, "3GPP/Enumerated(RAT-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1032, 10415, "RAT-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(RAT-Type)" },
+	/* Redirect-Support */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Redirect-Support)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REDIRECTION_DISABLED", { .i32=0 } }, "3GPP/Enumerated(Redirect-Support)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REDIRECTION_ENABLED", { .i32=1 } }, "3GPP/Enumerated(Redirect-Support)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1086, 10415, "Redirect-Support", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Redirect-Support)" },
+	/* Removal-Of-Access */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Removal-Of-Access)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REMOVAL_OF_ACCESS", { .i32=0 } }, "3GPP/Enumerated(Removal-Of-Access)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2842, 10415, "Removal-Of-Access", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Removal-Of-Access)" },
+	/* Reporting-Level */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Reporting-Level)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SERVICE_IDENTIFIER_LEVEL", { .i32=0 } }, "3GPP/Enumerated(Reporting-Level)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RATING_GROUP_LEVEL", { .i32=1 } }, "3GPP/Enumerated(Reporting-Level)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SPONSORED_CONNECTIVITY_LEVEL", { .i32=2 } }, "3GPP/Enumerated(Reporting-Level)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1011, 10415, "Reporting-Level", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Reporting-Level)" },
+	/* Resource-Allocation-Notification */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Resource-Allocation-Notification)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENABLE_NOTIFICATION", { .i32=0 } }, "3GPP/Enumerated(Resource-Allocation-Notification)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1063, 10415, "Resource-Allocation-Notification", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Resource-Allocation-Notification)" },
+	/* Resource-Release-Notification */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Resource-Release-Notification)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENABLE_NOTIFICATION", { .i32=0 } }, "3GPP/Enumerated(Resource-Release-Notification)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2841, 10415, "Resource-Release-Notification", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Resource-Release-Notification)" },
+	/* Revalidation-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1042, 10415, "Revalidation-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Routing-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1079, 10415, "Routing-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Routing-Rule-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 1077, 10415, "Routing-Rule-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Routing-Rule-Failure-Code */
+	{ DICT_AVP, &(struct dict_avp_data){ 2834, 10415, "Routing-Rule-Failure-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Rule-Activation-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1043, 10415, "Rule-Activation-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Rule-Deactivation-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1044, 10415, "Rule-Deactivation-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Rule-Failure-Code */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Rule-Failure-Code)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNKNOWN_RULE_NAME", { .i32=1 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESOURCE_ALLOCATION_FAILURE", { .i32=10 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNSUCCESSFUL_QOS_VALIDATION", { .i32=11 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INCORRECT_FLOW_INFORMATION", { .i32=12 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PS_TO_CS_HANDOVER", { .i32=13 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TDF_APPLICATION_IDENTIFIER_ERROR", { .i32=14 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_BEARER_BOUND", { .i32=15 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FILTER_RESTRICTIONS", { .i32=16 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AN_GW_FAILED", { .i32=17 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MISSING_REDIRECT_SERVER_ADDRESS", { .i32=18 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CM_END_USER_SERVICE_DENIED", { .i32=19 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RATING_GROUP_ERROR", { .i32=2 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CM_CREDIT_CONTROL_NOT_APPLICABLE", { .i32=20 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CM_AUTHORIZATION_REJECTED", { .i32=21 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CM_USER_UNKNOWN", { .i32=22 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CM_RATING_FAILED", { .i32=23 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ROUTING_RULE_REJECTION", { .i32=24 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_NBIFOM_SUPPORT", { .i32=25 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SERVICE_IDENTIFIER_ERROR", { .i32=3 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GW_PCEF_MALFUNCTION", { .i32=4 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESOURCES_LIMITATION", { .i32=5 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MAX_NR_BEARERS_REACHED", { .i32=6 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNKNOWN_BEARER_ID", { .i32=7 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MISSING_BEARER_ID", { .i32=8 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MISSING_FLOW_INFORMATION", { .i32=9 } }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1031, 10415, "Rule-Failure-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Rule-Failure-Code)" },
+	/* Security-Parameter-Index */
+	{ DICT_AVP, &(struct dict_avp_data){ 1056, 10415, "Security-Parameter-Index", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Session-Release-Cause */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Session-Release-Cause)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNSPECIFIED_REASON", { .i32=0 } }, "3GPP/Enumerated(Session-Release-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_SUBSCRIPTION_REASON", { .i32=1 } }, "3GPP/Enumerated(Session-Release-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INSUFFICIENT_SERVER_RESOURCES", { .i32=2 } }, "3GPP/Enumerated(Session-Release-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IP_CAN_SESSION_TERMINATION", { .i32=3 } }, "3GPP/Enumerated(Session-Release-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_IP_ADDRESS_RELEASE", { .i32=4 } }, "3GPP/Enumerated(Session-Release-Cause)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1045, 10415, "Session-Release-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Session-Release-Cause)" },
+	/* TCP-Source-Port */
+	{ DICT_AVP, &(struct dict_avp_data){ 2843, 10415, "TCP-Source-Port", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* TDF-Application-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 1088, 10415, "TDF-Application-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* TDF-Application-Instance-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 2802, 10415, "TDF-Application-Instance-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* TDF-Destination-Host */
+	{ DICT_AVP, &(struct dict_avp_data){ 1089, 10415, "TDF-Destination-Host", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* TDF-Destination-Realm */
+	{ DICT_AVP, &(struct dict_avp_data){ 1090, 10415, "TDF-Destination-Realm", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* TDF-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1091, 10415, "TDF-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* TFT-Filter */
+	{ DICT_AVP, &(struct dict_avp_data){ 1012, 10415, "TFT-Filter", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "IPFilterRule" },
+	/* Traffic-Steering-Policy-Identifier-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 2836, 10415, "Traffic-Steering-Policy-Identifier-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Traffic-Steering-Policy-Identifier-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 2837, 10415, "Traffic-Steering-Policy-Identifier-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* ToS-Traffic-Class */
+	{ DICT_AVP, &(struct dict_avp_data){ 1014, 10415, "ToS-Traffic-Class", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Tunnel-Header-Filter */
+	{ DICT_AVP, &(struct dict_avp_data){ 1036, 10415, "Tunnel-Header-Filter", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "IPFilterRule" },
+	/* Tunnel-Header-Length */
+	{ DICT_AVP, &(struct dict_avp_data){ 1037, 10415, "Tunnel-Header-Length", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* UDP-Source-Port */
+	{ DICT_AVP, &(struct dict_avp_data){ 2806, 10415, "UDP-Source-Port", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* UE-Local-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2805, 10415, "UE-Local-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Usage-Monitoring-Level */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Usage-Monitoring-Level)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SESSION_LEVEL", { .i32=0 } }, "3GPP/Enumerated(Usage-Monitoring-Level)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PCC_RULE_LEVEL", { .i32=1 } }, "3GPP/Enumerated(Usage-Monitoring-Level)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ADC_RULE_LEVEL", { .i32=2 } }, "3GPP/Enumerated(Usage-Monitoring-Level)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1068, 10415, "Usage-Monitoring-Level", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Usage-Monitoring-Level)" },
+	/* Usage-Monitoring-Report */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Usage-Monitoring-Report)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USAGE_MONITORING_REPORT_REQUIRED", { .i32=0 } }, "3GPP/Enumerated(Usage-Monitoring-Report)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1069, 10415, "Usage-Monitoring-Report", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Usage-Monitoring-Report)" },
+	/* Usage-Monitoring-Support */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Usage-Monitoring-Support)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USAGE_MONITORING_DISABLED", { .i32=0 } }, "3GPP/Enumerated(Usage-Monitoring-Support)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1070, 10415, "Usage-Monitoring-Support", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Usage-Monitoring-Support)" },
+	/* User-Location-Info-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 2812, 10415, "User-Location-Info-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* PCSCF-Restoration-Indication */
+	{ DICT_AVP, &(struct dict_avp_data){ 2826, 10415, "PCSCF-Restoration-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* QoS-Rule-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1054, 10415, "QoS-Rule-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* QoS-Rule-Base-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1074, 10415, "QoS-Rule-Base-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Session-Linking-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Session-Linking-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_ONLY", { .i32=0 } }, "3GPP/Enumerated(Session-Linking-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESERVED", { .i32=1 } }, "3GPP/Enumerated(Session-Linking-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_NW", { .i32=2 } }, "3GPP/Enumerated(Session-Linking-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1064, 10415, "Session-Linking-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Session-Linking-Indicator)" },
+	/* ADC-Rule-Base-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1095, 10415, "ADC-Rule-Base-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* ADC-Rule-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1096, 10415, "ADC-Rule-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Request-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 2838, 10415, "Request-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* CS-Service-QoS-Request-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 2807, 10415, "CS-Service-QoS-Request-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* CS-Service-QoS-Request-Operation */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(CS-Service-QoS-Request-Operation)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DELETION", { .i32=0 } }, "3GPP/Enumerated(CS-Service-QoS-Request-Operation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MODIFICATION", { .i32=1 } }, "3GPP/Enumerated(CS-Service-QoS-Request-Operation)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2808, 10415, "CS-Service-QoS-Request-Operation", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(CS-Service-QoS-Request-Operation)" },
+	/* CS-Service-Resource-Failure-Cause */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(CS-Service-Resource-Failure-Cause)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESOURCE_RELEASED", { .i32=0 } }, "3GPP/Enumerated(CS-Service-Resource-Failure-Cause)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2814, 10415, "CS-Service-Resource-Failure-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(CS-Service-Resource-Failure-Cause)" },
+	/* CS-Service-Resource-Result-Operation */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(CS-Service-Resource-Result-Operation)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DELETION", { .i32=0 } }, "3GPP/Enumerated(CS-Service-Resource-Result-Operation)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2815, 10415, "CS-Service-Resource-Result-Operation", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(CS-Service-Resource-Result-Operation)" },
+	/* Charging-Rule-Remove */
+	{ DICT_AVP, &(struct dict_avp_data){ 1002, 10415, "Charging-Rule-Remove", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* QoS-Rule-Report */
+	{ DICT_AVP, &(struct dict_avp_data){ 1055, 10415, "QoS-Rule-Report", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Redirect-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1085, 10415, "Redirect-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* PRA-Remove */
+	{ DICT_AVP, &(struct dict_avp_data){ 2846, 10415, "PRA-Remove", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Flow-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1058, 10415, "Flow-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Tunnel-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1038, 10415, "Tunnel-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* TDF-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1087, 10415, "TDF-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Routing-Rule-Remove */
+	{ DICT_AVP, &(struct dict_avp_data){ 1075, 10415, "Routing-Rule-Remove", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* CS-Service-Resource-Report */
+	{ DICT_AVP, &(struct dict_avp_data){ 2813, 10415, "CS-Service-Resource-Report", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Presence-Reporting-Area-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2822, 10415, "Presence-Reporting-Area-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Conditional-APN-Aggregate-Max-Bitrate */
+	{ DICT_AVP, &(struct dict_avp_data){ 2818, 10415, "Conditional-APN-Aggregate-Max-Bitrate", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Access-Network-Charging-Identifier-Gx */
+	{ DICT_AVP, &(struct dict_avp_data){ 1022, 10415, "Access-Network-Charging-Identifier-Gx", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Allocation-Retention-Priority */
+	{ DICT_AVP, &(struct dict_avp_data){ 1034, 10415, "Allocation-Retention-Priority", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* QoS-Rule-Remove */
+	{ DICT_AVP, &(struct dict_avp_data){ 1052, 10415, "QoS-Rule-Remove", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Routing-Rule-Report */
+	{ DICT_AVP, &(struct dict_avp_data){ 2835, 10415, "Routing-Rule-Report", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* TFT-Packet-Filter-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1013, 10415, "TFT-Packet-Filter-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Fixed-User-Location-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 2825, 10415, "Fixed-User-Location-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Default-QoS-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2816, 10415, "Default-QoS-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Packet-Filter-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1061, 10415, "Packet-Filter-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Routing-Filter */
+	{ DICT_AVP, &(struct dict_avp_data){ 1078, 10415, "Routing-Filter", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* ADC-Rule-Remove */
+	{ DICT_AVP, &(struct dict_avp_data){ 1093, 10415, "ADC-Rule-Remove", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* QoS-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1016, 10415, "QoS-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* PRA-Install */
+	{ DICT_AVP, &(struct dict_avp_data){ 2845, 10415, "PRA-Install", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Routing-Rule-Definition */
+	{ DICT_AVP, &(struct dict_avp_data){ 1076, 10415, "Routing-Rule-Definition", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Default-EPS-Bearer-QoS */
+	{ DICT_AVP, &(struct dict_avp_data){ 1049, 10415, "Default-EPS-Bearer-QoS", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* CoA-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1039, 10415, "CoA-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Application-Detection-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1098, 10415, "Application-Detection-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Conditional-Policy-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2840, 10415, "Conditional-Policy-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Charging-Rule-Definition */
+	{ DICT_AVP, &(struct dict_avp_data){ 1003, 10415, "Charging-Rule-Definition", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Routing-Rule-Install */
+	{ DICT_AVP, &(struct dict_avp_data){ 1081, 10415, "Routing-Rule-Install", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* ADC-Rule-Definition */
+	{ DICT_AVP, &(struct dict_avp_data){ 1094, 10415, "ADC-Rule-Definition", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* ADC-Rule-Report */
+	{ DICT_AVP, &(struct dict_avp_data){ 1097, 10415, "ADC-Rule-Report", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* QoS-Rule-Definition */
+	{ DICT_AVP, &(struct dict_avp_data){ 1053, 10415, "QoS-Rule-Definition", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Charging-Rule-Report */
+	{ DICT_AVP, &(struct dict_avp_data){ 1018, 10415, "Charging-Rule-Report", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Event-Report-Indication */
+	{ DICT_AVP, &(struct dict_avp_data){ 1033, 10415, "Event-Report-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Charging-Rule-Install */
+	{ DICT_AVP, &(struct dict_avp_data){ 1001, 10415, "Charging-Rule-Install", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* QoS-Rule-Install */
+	{ DICT_AVP, &(struct dict_avp_data){ 1051, 10415, "QoS-Rule-Install", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* ADC-Rule-Install */
+	{ DICT_AVP, &(struct dict_avp_data){ 1092, 10415, "ADC-Rule-Install", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Usage-Monitoring-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1067, 10415, "Usage-Monitoring-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29212_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,2339 +631,7 @@ static int dict_ts29212_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* 3GPP-PS-Data-Off-Status */
-		{
-			struct dict_avp_data data = {
-				2847,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-PS-Data-Off-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ACTIVE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "INACTIVE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Access-Availability-Change-Reason */
-		{
-			struct dict_avp_data data = {
-				2833,	/* Code */
-				10415,	/* Vendor */
-				"Access-Availability-Change-Reason",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* AN-GW-Address */
-		{
-			struct dict_avp_data data = {
-				1050,	/* Code */
-				10415,	/* Vendor */
-				"AN-GW-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* AN-GW-Status */
-		{
-			struct dict_avp_data data = {
-				2811,	/* Code */
-				10415,	/* Vendor */
-				"AN-GW-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(AN-GW-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "AN_GW_FAILED", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* APN-Aggregate-Max-Bitrate-DL */
-		{
-			struct dict_avp_data data = {
-				1040,	/* Code */
-				10415,	/* Vendor */
-				"APN-Aggregate-Max-Bitrate-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* APN-Aggregate-Max-Bitrate-UL */
-		{
-			struct dict_avp_data data = {
-				1041,	/* Code */
-				10415,	/* Vendor */
-				"APN-Aggregate-Max-Bitrate-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Bearer-Control-Mode */
-		{
-			struct dict_avp_data data = {
-				1023,	/* Code */
-				10415,	/* Vendor */
-				"Bearer-Control-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Bearer-Control-Mode)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UE_ONLY", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "RESERVED", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "UE_NW", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Bearer-Identifier */
-		{
-			struct dict_avp_data data = {
-				1020,	/* Code */
-				10415,	/* Vendor */
-				"Bearer-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Bearer-Operation */
-		{
-			struct dict_avp_data data = {
-				1021,	/* Code */
-				10415,	/* Vendor */
-				"Bearer-Operation",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Bearer-Operation)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "TERMINATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ESTABLISHMENT", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "MODIFICATION", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Bearer-Usage */
-		{
-			struct dict_avp_data data = {
-				1000,	/* Code */
-				10415,	/* Vendor */
-				"Bearer-Usage",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Bearer-Usage)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "GENERAL", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "IMS_SIGNALLING", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Charging-Correlation-Indicator */
-		{
-			struct dict_avp_data data = {
-				1073,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Correlation-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Charging-Correlation-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CHARGING_IDENTIFIER_REQUIRED", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Charging-Rule-Base-Name */
-		{
-			struct dict_avp_data data = {
-				1004,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Rule-Base-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Charging-Rule-Name */
-		{
-			struct dict_avp_data data = {
-				1005,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Rule-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CoA-IP-Address */
-		{
-			struct dict_avp_data data = {
-				1035,	/* Code */
-				10415,	/* Vendor */
-				"CoA-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Credit-Management-Status */
-		{
-			struct dict_avp_data data = {
-				1082,	/* Code */
-				10415,	/* Vendor */
-				"Credit-Management-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CSG-Information-Reporting */
-		{
-			struct dict_avp_data data = {
-				1071,	/* Code */
-				10415,	/* Vendor */
-				"CSG-Information-Reporting",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(CSG-Information-Reporting)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CHANGE_CSG_CELL", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CHANGE_CSG_SUBSCRIBED_HYBRID_CELL", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "CHANGE_CSG_UNSUBSCRIBED_HYBRID_CELL", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Default-Access */
-		{
-			struct dict_avp_data data = {
-				2829,	/* Code */
-				10415,	/* Vendor */
-				"Default-Access",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Default-Access)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "GPP_GPRS", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "DOCSIS", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "xDSL", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "WiMAX", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "GPP2", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "GPP_EPS", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "Non_3GPP_EPS", { .i32=6 }};
-			struct dict_enumval_data        t_8 = { "FBA", { .i32=7 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Default-Bearer-Indication */
-		{
-			struct dict_avp_data data = {
-				2844,	/* Code */
-				10415,	/* Vendor */
-				"Default-Bearer-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Default-Bearer-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "BIND_TO_DEF_BEARER", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "BIND_TO_APPLICABLE_BEARER", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Default-QoS-Name */
-		{
-			struct dict_avp_data data = {
-				2817,	/* Code */
-				10415,	/* Vendor */
-				"Default-QoS-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Event-Trigger */
-		{
-			struct dict_avp_data data = {
-				1006,	/* Code */
-				10415,	/* Vendor */
-				"Event-Trigger",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Event-Trigger)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SGSN_CHANGE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "QOS_CHANGE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "QOS_CHANGE_EXCEEDING_AUTHORIZATION", { .i32=11 }};
-			struct dict_enumval_data        t_4 = { "RAI_CHANGE", { .i32=12 }};
-			struct dict_enumval_data        t_5 = { "USER_LOCATION_CHANGE", { .i32=13 }};
-			struct dict_enumval_data        t_6 = { "NO_EVENT_TRIGGERS", { .i32=14 }};
-			struct dict_enumval_data        t_7 = { "OUT_OF_CREDIT", { .i32=15 }};
-			struct dict_enumval_data        t_8 = { "REALLOCATION_OF_CREDIT", { .i32=16 }};
-			struct dict_enumval_data        t_9 = { "REVALIDATION_TIMEOUT", { .i32=17 }};
-			struct dict_enumval_data        t_10 = { "UE_IP_ADDRESS_ALLOCATE", { .i32=18 }};
-			struct dict_enumval_data        t_11 = { "UE_IP_ADDRESS_RELEASE", { .i32=19 }};
-			struct dict_enumval_data        t_12 = { "RAT_CHANGE", { .i32=2 }};
-			struct dict_enumval_data        t_13 = { "DEFAULT_EPS_BEARER_QOS_CHANGE", { .i32=20 }};
-			struct dict_enumval_data        t_14 = { "AN_GW_CHANGE", { .i32=21 }};
-			struct dict_enumval_data        t_15 = { "SUCCESSFUL_RESOURCE_ALLOCATION", { .i32=22 }};
-			struct dict_enumval_data        t_16 = { "RESOURCE_MODIFICATION_REQUEST", { .i32=23 }};
-			struct dict_enumval_data        t_17 = { "PGW_TRACE_CONTROL", { .i32=24 }};
-			struct dict_enumval_data        t_18 = { "UE_TIME_ZONE_CHANGE", { .i32=25 }};
-			struct dict_enumval_data        t_19 = { "TAI_CHANGE", { .i32=26 }};
-			struct dict_enumval_data        t_20 = { "ECGI_CHANGE", { .i32=27 }};
-			struct dict_enumval_data        t_21 = { "CHARGING_CORRELATION_EXCHANGE", { .i32=28 }};
-			struct dict_enumval_data        t_22 = { "APN_AMBR_MODIFICATION_FAILURE", { .i32=29 }};
-			struct dict_enumval_data        t_23 = { "TFT_CHANGE", { .i32=3 }};
-			struct dict_enumval_data        t_24 = { "USER_CSG_INFORMATION_CHANGE", { .i32=30 }};
-			struct dict_enumval_data        t_25 = { "USAGE_REPORT", { .i32=33 }};
-			struct dict_enumval_data        t_26 = { "DEFAULT_EPS_BEARER_QOS_MODIFICATION_FAILURE", { .i32=34 }};
-			struct dict_enumval_data        t_27 = { "USER_CSG_HYBRID_SUBSCRIBED_INFORMATION_CHANGE", { .i32=35 }};
-			struct dict_enumval_data        t_28 = { "HYBRID_UNSUBSCRIBED_INFORMATION_CHANGE", { .i32=36 }};
-			struct dict_enumval_data        t_29 = { "ROUTING_RULE_CHANGE", { .i32=37 }};
-			struct dict_enumval_data        t_30 = { "APPLICATION_START", { .i32=39 }};
-			struct dict_enumval_data        t_31 = { "PLMN_CHANGE", { .i32=4 }};
-			struct dict_enumval_data        t_32 = { "APPLICATION_STOP", { .i32=40 }};
-			struct dict_enumval_data        t_33 = { "CS_TO_PS_HANDOVER", { .i32=42 }};
-			struct dict_enumval_data        t_34 = { "UE_LOCAL_IP_ADDRESS_CHANGE", { .i32=43 }};
-			struct dict_enumval_data        t_35 = { "NB_LOCAL_IP_ADDRESS_CHANGE", { .i32=44 }};
-			struct dict_enumval_data        t_36 = { "ACCESS_NETWORK_INFO_REPORT", { .i32=45 }};
-			struct dict_enumval_data        t_37 = { "CREDIT_MANAGEMENT_SESSION_FAILURE", { .i32=46 }};
-			struct dict_enumval_data        t_38 = { "DEFAULT_QOS_CHANGE", { .i32=47 }};
-			struct dict_enumval_data        t_39 = { "CHANGE_OF_UE_PRESENCE_IN_PRESENCE_REPORTING_AREA_REPORT", { .i32=48 }};
-			struct dict_enumval_data        t_40 = { "ADDITION_OF_ACCESS", { .i32=49 }};
-			struct dict_enumval_data        t_41 = { "LOSS_OF_BEARER", { .i32=5 }};
-			struct dict_enumval_data        t_42 = { "REMOVAL_OF_ACCESS", { .i32=50 }};
-			struct dict_enumval_data        t_43 = { "UNAVAILABLITY_OF_ACCESS", { .i32=51 }};
-			struct dict_enumval_data        t_44 = { "AVAILABLITY_OF_ACCESS", { .i32=52 }};
-			struct dict_enumval_data        t_45 = { "RESOURCE_RELEASE", { .i32=53 }};
-			struct dict_enumval_data        t_46 = { "ENODEB_CHANGE", { .i32=54 }};
-			struct dict_enumval_data        t_47 = { "GPP_PS_DATA_OFF_CHANGE", { .i32=55 }};
-			struct dict_enumval_data        t_48 = { "RECOVERY_OF_BEARER", { .i32=6 }};
-			struct dict_enumval_data        t_49 = { "IP_CAN_CHANGE", { .i32=7 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_17, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_18, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_19, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_20, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_21, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_22, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_23, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_24, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_25, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_26, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_27, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_28, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_29, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_30, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_31, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_32, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_33, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_34, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_35, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_36, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_37, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_38, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_39, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_40, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_41, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_42, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_43, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_44, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_45, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_46, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_47, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_48, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_49, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Execution-Time */
-		{
-			struct dict_avp_data data = {
-				2839,	/* Code */
-				10415,	/* Vendor */
-				"Execution-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Flow-Direction */
-		{
-			struct dict_avp_data data = {
-				1080,	/* Code */
-				10415,	/* Vendor */
-				"Flow-Direction",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Flow-Direction)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UNSPECIFIED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "DOWNLINK", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "UPLINK", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "BIDIRECTIONAL", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Flow-Label */
-		{
-			struct dict_avp_data data = {
-				1057,	/* Code */
-				10415,	/* Vendor */
-				"Flow-Label",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Guaranteed-Bitrate-DL */
-		{
-			struct dict_avp_data data = {
-				1025,	/* Code */
-				10415,	/* Vendor */
-				"Guaranteed-Bitrate-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Guaranteed-Bitrate-UL */
-		{
-			struct dict_avp_data data = {
-				1026,	/* Code */
-				10415,	/* Vendor */
-				"Guaranteed-Bitrate-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* HeNB-Local-IP-Address */
-		{
-			struct dict_avp_data data = {
-				2804,	/* Code */
-				10415,	/* Vendor */
-				"HeNB-Local-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* IP-CAN-Session-Charging-Scope */
-		{
-			struct dict_avp_data data = {
-				2827,	/* Code */
-				10415,	/* Vendor */
-				"IP-CAN-Session-Charging-Scope",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(IP-CAN-Session-Charging-Scope)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "IP_CAN_SESSION_SCOPE", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* IP-CAN-Type */
-		{
-			struct dict_avp_data data = {
-				1027,	/* Code */
-				10415,	/* Vendor */
-				"IP-CAN-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(IP-CAN-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "GPP_GPRS", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "DOCSIS", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "xDSL", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "WiMAX", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "GPP2", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "GPP_EPS", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "Non_3GPP_EPS", { .i32=6 }};
-			struct dict_enumval_data        t_8 = { "FBA", { .i32=7 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Metering-Method */
-		{
-			struct dict_avp_data data = {
-				1007,	/* Code */
-				10415,	/* Vendor */
-				"Metering-Method",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Metering-Method)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DURATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "VOLUME", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "DURATION_VOLUME", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "EVENT", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Monitoring-Flags */
-		{
-			struct dict_avp_data data = {
-				2828,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Monitoring-Key */
-		{
-			struct dict_avp_data data = {
-				1066,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-Key",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Mute-Notification */
-		{
-			struct dict_avp_data data = {
-				2809,	/* Code */
-				10415,	/* Vendor */
-				"Mute-Notification",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Mute-Notification)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "MUTE_REQUIRED", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Monitoring-Time */
-		{
-			struct dict_avp_data data = {
-				2810,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* NBIFOM-Mode */
-		{
-			struct dict_avp_data data = {
-				2830,	/* Code */
-				10415,	/* Vendor */
-				"NBIFOM-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(NBIFOM-Mode)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UE_INITIATED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NETWORK_INITIATED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* NBIFOM-Support */
-		{
-			struct dict_avp_data data = {
-				2831,	/* Code */
-				10415,	/* Vendor */
-				"NBIFOM-Support",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(NBIFOM-Support)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NBIFOM_NOT_SUPPORTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NBIFOM_SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* NetLoc-Access-Support */
-		{
-			struct dict_avp_data data = {
-				2824,	/* Code */
-				10415,	/* Vendor */
-				"NetLoc-Access-Support",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Network-Request-Support */
-		{
-			struct dict_avp_data data = {
-				1024,	/* Code */
-				10415,	/* Vendor */
-				"Network-Request-Support",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Network-Request-Support)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NETWORK_REQUEST_NOT_SUPPORTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NETWORK_REQUEST_SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Offline */
-		{
-			struct dict_avp_data data = {
-				1008,	/* Code */
-				10415,	/* Vendor */
-				"Offline",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Offline)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DISABLE_OFFLINE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ENABLE_OFFLINE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Online */
-		{
-			struct dict_avp_data data = {
-				1009,	/* Code */
-				10415,	/* Vendor */
-				"Online",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Online)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DISABLE_ONLINE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ENABLE_ONLINE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Packet-Filter-Content */
-		{
-			struct dict_avp_data data = {
-				1059,	/* Code */
-				10415,	/* Vendor */
-				"Packet-Filter-Content",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, IPFilterRule_type, NULL);
-		};
-		/* Packet-Filter-Identifier */
-		{
-			struct dict_avp_data data = {
-				1060,	/* Code */
-				10415,	/* Vendor */
-				"Packet-Filter-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Packet-Filter-Operation */
-		{
-			struct dict_avp_data data = {
-				1062,	/* Code */
-				10415,	/* Vendor */
-				"Packet-Filter-Operation",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Packet-Filter-Operation)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DELETION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ADDITION", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "MODIFICATION", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Packet-Filter-Usage */
-		{
-			struct dict_avp_data data = {
-				1072,	/* Code */
-				10415,	/* Vendor */
-				"Packet-Filter-Usage",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Packet-Filter-Usage)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SEND_TO_UE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PCC-Rule-Status */
-		{
-			struct dict_avp_data data = {
-				1019,	/* Code */
-				10415,	/* Vendor */
-				"PCC-Rule-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PCC-Rule-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ACTIVE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "INACTIVE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "TEMPORARILY_INACTIVE", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PDN-Connection-ID */
-		{
-			struct dict_avp_data data = {
-				1065,	/* Code */
-				10415,	/* Vendor */
-				"PDN-Connection-ID",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Precedence */
-		{
-			struct dict_avp_data data = {
-				1010,	/* Code */
-				10415,	/* Vendor */
-				"Precedence",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Pre-emption-Capability */
-		{
-			struct dict_avp_data data = {
-				1047,	/* Code */
-				10415,	/* Vendor */
-				"Pre-emption-Capability",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Pre-emption-Capability)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PRE_EMPTION_CAPABILITY_ENABLED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PRE_EMPTION_CAPABILITY_DISABLED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Pre-emption-Vulnerability */
-		{
-			struct dict_avp_data data = {
-				1048,	/* Code */
-				10415,	/* Vendor */
-				"Pre-emption-Vulnerability",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Pre-emption-Vulnerability)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PRE_EMPTION_VULNERABILITY_ENABLED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PRE_EMPTION_VULNERABILITY_DISABLED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Presence-Reporting-Area-Elements-List */
-		{
-			struct dict_avp_data data = {
-				2820,	/* Code */
-				10415,	/* Vendor */
-				"Presence-Reporting-Area-Elements-List",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Presence-Reporting-Area-Identifier */
-		{
-			struct dict_avp_data data = {
-				2821,	/* Code */
-				10415,	/* Vendor */
-				"Presence-Reporting-Area-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Presence-Reporting-Area-Status */
-		{
-			struct dict_avp_data data = {
-				2823,	/* Code */
-				10415,	/* Vendor */
-				"Presence-Reporting-Area-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Priority-Level */
-		{
-			struct dict_avp_data data = {
-				1046,	/* Code */
-				10415,	/* Vendor */
-				"Priority-Level",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* PS-to-CS-Session-Continuity */
-		{
-			struct dict_avp_data data = {
-				1099,	/* Code */
-				10415,	/* Vendor */
-				"PS-to-CS-Session-Continuity",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PS-to-CS-Session-Continuity)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "VIDEO_PS2CS_CONT_CANDIDATE", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* QoS-Class-Identifier */
-		{
-			struct dict_avp_data data = {
-				1028,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Class-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(QoS-Class-Identifier)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "QCI_1", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "QCI_2", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "QCI_3", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "QCI_4", { .i32=4 }};
-			struct dict_enumval_data        t_5 = { "QCI_5", { .i32=5 }};
-			struct dict_enumval_data        t_6 = { "QCI_6", { .i32=6 }};
-			struct dict_enumval_data        t_7 = { "QCI_65", { .i32=65 }};
-			struct dict_enumval_data        t_8 = { "QCI_66", { .i32=66 }};
-			struct dict_enumval_data        t_9 = { "QCI_69", { .i32=69 }};
-			struct dict_enumval_data        t_10 = { "QCI_7", { .i32=7 }};
-			struct dict_enumval_data        t_11 = { "QCI_70", { .i32=70 }};
-			struct dict_enumval_data        t_12 = { "QCI_75", { .i32=75 }};
-			struct dict_enumval_data        t_13 = { "QCI_79", { .i32=79 }};
-			struct dict_enumval_data        t_14 = { "QCI_8", { .i32=8 }};
-			struct dict_enumval_data        t_15 = { "QCI_9", { .i32=9 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* QoS-Negotiation */
-		{
-			struct dict_avp_data data = {
-				1029,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Negotiation",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(QoS-Negotiation)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NO_QoS_NEGOTIATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "QoS_NEGOTIATION_SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* QoS-Upgrade */
-		{
-			struct dict_avp_data data = {
-				1030,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Upgrade",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(QoS-Upgrade)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "QoS_UPGRADE_NOT_SUPPORTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "QoS_UPGRADE_SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* RAN-NAS-Release-Cause */
-		{
-			struct dict_avp_data data = {
-				2819,	/* Code */
-				10415,	/* Vendor */
-				"RAN-NAS-Release-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* RAN-Rule-Support */
-		{
-			struct dict_avp_data data = {
-				2832,	/* Code */
-				10415,	/* Vendor */
-				"RAN-Rule-Support",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* RAT-Type */
-		{
-			struct dict_avp_data data = {
-				1032,	/* Code */
-				10415,	/* Vendor */
-				"RAT-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(RAT-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "WLAN", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "VIRTUAL", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Redirect-Support */
-		{
-			struct dict_avp_data data = {
-				1086,	/* Code */
-				10415,	/* Vendor */
-				"Redirect-Support",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Redirect-Support)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "REDIRECTION_DISABLED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "REDIRECTION_ENABLED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Removal-Of-Access */
-		{
-			struct dict_avp_data data = {
-				2842,	/* Code */
-				10415,	/* Vendor */
-				"Removal-Of-Access",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Removal-Of-Access)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "REMOVAL_OF_ACCESS", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Reporting-Level */
-		{
-			struct dict_avp_data data = {
-				1011,	/* Code */
-				10415,	/* Vendor */
-				"Reporting-Level",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Reporting-Level)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SERVICE_IDENTIFIER_LEVEL", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "RATING_GROUP_LEVEL", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "SPONSORED_CONNECTIVITY_LEVEL", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Resource-Allocation-Notification */
-		{
-			struct dict_avp_data data = {
-				1063,	/* Code */
-				10415,	/* Vendor */
-				"Resource-Allocation-Notification",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Resource-Allocation-Notification)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ENABLE_NOTIFICATION", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Resource-Release-Notification */
-		{
-			struct dict_avp_data data = {
-				2841,	/* Code */
-				10415,	/* Vendor */
-				"Resource-Release-Notification",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Resource-Release-Notification)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ENABLE_NOTIFICATION", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Revalidation-Time */
-		{
-			struct dict_avp_data data = {
-				1042,	/* Code */
-				10415,	/* Vendor */
-				"Revalidation-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Routing-IP-Address */
-		{
-			struct dict_avp_data data = {
-				1079,	/* Code */
-				10415,	/* Vendor */
-				"Routing-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Routing-Rule-Identifier */
-		{
-			struct dict_avp_data data = {
-				1077,	/* Code */
-				10415,	/* Vendor */
-				"Routing-Rule-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Routing-Rule-Failure-Code */
-		{
-			struct dict_avp_data data = {
-				2834,	/* Code */
-				10415,	/* Vendor */
-				"Routing-Rule-Failure-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Rule-Activation-Time */
-		{
-			struct dict_avp_data data = {
-				1043,	/* Code */
-				10415,	/* Vendor */
-				"Rule-Activation-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Rule-Deactivation-Time */
-		{
-			struct dict_avp_data data = {
-				1044,	/* Code */
-				10415,	/* Vendor */
-				"Rule-Deactivation-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Rule-Failure-Code */
-		{
-			struct dict_avp_data data = {
-				1031,	/* Code */
-				10415,	/* Vendor */
-				"Rule-Failure-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Rule-Failure-Code)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UNKNOWN_RULE_NAME", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "RESOURCE_ALLOCATION_FAILURE", { .i32=10 }};
-			struct dict_enumval_data        t_3 = { "UNSUCCESSFUL_QOS_VALIDATION", { .i32=11 }};
-			struct dict_enumval_data        t_4 = { "INCORRECT_FLOW_INFORMATION", { .i32=12 }};
-			struct dict_enumval_data        t_5 = { "PS_TO_CS_HANDOVER", { .i32=13 }};
-			struct dict_enumval_data        t_6 = { "TDF_APPLICATION_IDENTIFIER_ERROR", { .i32=14 }};
-			struct dict_enumval_data        t_7 = { "NO_BEARER_BOUND", { .i32=15 }};
-			struct dict_enumval_data        t_8 = { "FILTER_RESTRICTIONS", { .i32=16 }};
-			struct dict_enumval_data        t_9 = { "AN_GW_FAILED", { .i32=17 }};
-			struct dict_enumval_data        t_10 = { "MISSING_REDIRECT_SERVER_ADDRESS", { .i32=18 }};
-			struct dict_enumval_data        t_11 = { "CM_END_USER_SERVICE_DENIED", { .i32=19 }};
-			struct dict_enumval_data        t_12 = { "RATING_GROUP_ERROR", { .i32=2 }};
-			struct dict_enumval_data        t_13 = { "CM_CREDIT_CONTROL_NOT_APPLICABLE", { .i32=20 }};
-			struct dict_enumval_data        t_14 = { "CM_AUTHORIZATION_REJECTED", { .i32=21 }};
-			struct dict_enumval_data        t_15 = { "CM_USER_UNKNOWN", { .i32=22 }};
-			struct dict_enumval_data        t_16 = { "CM_RATING_FAILED", { .i32=23 }};
-			struct dict_enumval_data        t_17 = { "ROUTING_RULE_REJECTION", { .i32=24 }};
-			struct dict_enumval_data        t_18 = { "NO_NBIFOM_SUPPORT", { .i32=25 }};
-			struct dict_enumval_data        t_19 = { "SERVICE_IDENTIFIER_ERROR", { .i32=3 }};
-			struct dict_enumval_data        t_20 = { "GW_PCEF_MALFUNCTION", { .i32=4 }};
-			struct dict_enumval_data        t_21 = { "RESOURCES_LIMITATION", { .i32=5 }};
-			struct dict_enumval_data        t_22 = { "MAX_NR_BEARERS_REACHED", { .i32=6 }};
-			struct dict_enumval_data        t_23 = { "UNKNOWN_BEARER_ID", { .i32=7 }};
-			struct dict_enumval_data        t_24 = { "MISSING_BEARER_ID", { .i32=8 }};
-			struct dict_enumval_data        t_25 = { "MISSING_FLOW_INFORMATION", { .i32=9 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_17, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_18, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_19, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_20, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_21, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_22, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_23, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_24, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_25, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Security-Parameter-Index */
-		{
-			struct dict_avp_data data = {
-				1056,	/* Code */
-				10415,	/* Vendor */
-				"Security-Parameter-Index",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Session-Release-Cause */
-		{
-			struct dict_avp_data data = {
-				1045,	/* Code */
-				10415,	/* Vendor */
-				"Session-Release-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Session-Release-Cause)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UNSPECIFIED_REASON", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "UE_SUBSCRIPTION_REASON", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "INSUFFICIENT_SERVER_RESOURCES", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "IP_CAN_SESSION_TERMINATION", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "UE_IP_ADDRESS_RELEASE", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* TCP-Source-Port */
-		{
-			struct dict_avp_data data = {
-				2843,	/* Code */
-				10415,	/* Vendor */
-				"TCP-Source-Port",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TDF-Application-Identifier */
-		{
-			struct dict_avp_data data = {
-				1088,	/* Code */
-				10415,	/* Vendor */
-				"TDF-Application-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TDF-Application-Instance-Identifier */
-		{
-			struct dict_avp_data data = {
-				2802,	/* Code */
-				10415,	/* Vendor */
-				"TDF-Application-Instance-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TDF-Destination-Host */
-		{
-			struct dict_avp_data data = {
-				1089,	/* Code */
-				10415,	/* Vendor */
-				"TDF-Destination-Host",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* TDF-Destination-Realm */
-		{
-			struct dict_avp_data data = {
-				1090,	/* Code */
-				10415,	/* Vendor */
-				"TDF-Destination-Realm",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* TDF-IP-Address */
-		{
-			struct dict_avp_data data = {
-				1091,	/* Code */
-				10415,	/* Vendor */
-				"TDF-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* TFT-Filter */
-		{
-			struct dict_avp_data data = {
-				1012,	/* Code */
-				10415,	/* Vendor */
-				"TFT-Filter",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, IPFilterRule_type, NULL);
-		};
-		/* Traffic-Steering-Policy-Identifier-DL */
-		{
-			struct dict_avp_data data = {
-				2836,	/* Code */
-				10415,	/* Vendor */
-				"Traffic-Steering-Policy-Identifier-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Traffic-Steering-Policy-Identifier-UL */
-		{
-			struct dict_avp_data data = {
-				2837,	/* Code */
-				10415,	/* Vendor */
-				"Traffic-Steering-Policy-Identifier-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ToS-Traffic-Class */
-		{
-			struct dict_avp_data data = {
-				1014,	/* Code */
-				10415,	/* Vendor */
-				"ToS-Traffic-Class",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Tunnel-Header-Filter */
-		{
-			struct dict_avp_data data = {
-				1036,	/* Code */
-				10415,	/* Vendor */
-				"Tunnel-Header-Filter",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, IPFilterRule_type, NULL);
-		};
-		/* Tunnel-Header-Length */
-		{
-			struct dict_avp_data data = {
-				1037,	/* Code */
-				10415,	/* Vendor */
-				"Tunnel-Header-Length",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* UDP-Source-Port */
-		{
-			struct dict_avp_data data = {
-				2806,	/* Code */
-				10415,	/* Vendor */
-				"UDP-Source-Port",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* UE-Local-IP-Address */
-		{
-			struct dict_avp_data data = {
-				2805,	/* Code */
-				10415,	/* Vendor */
-				"UE-Local-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Usage-Monitoring-Level */
-		{
-			struct dict_avp_data data = {
-				1068,	/* Code */
-				10415,	/* Vendor */
-				"Usage-Monitoring-Level",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Usage-Monitoring-Level)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SESSION_LEVEL", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PCC_RULE_LEVEL", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "ADC_RULE_LEVEL", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Usage-Monitoring-Report */
-		{
-			struct dict_avp_data data = {
-				1069,	/* Code */
-				10415,	/* Vendor */
-				"Usage-Monitoring-Report",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Usage-Monitoring-Report)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "USAGE_MONITORING_REPORT_REQUIRED", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Usage-Monitoring-Support */
-		{
-			struct dict_avp_data data = {
-				1070,	/* Code */
-				10415,	/* Vendor */
-				"Usage-Monitoring-Support",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Usage-Monitoring-Support)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "USAGE_MONITORING_DISABLED", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* User-Location-Info-Time */
-		{
-			struct dict_avp_data data = {
-				2812,	/* Code */
-				10415,	/* Vendor */
-				"User-Location-Info-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* PCSCF-Restoration-Indication */
-		{
-			struct dict_avp_data data = {
-				2826,	/* Code */
-				10415,	/* Vendor */
-				"PCSCF-Restoration-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* QoS-Rule-Name */
-		{
-			struct dict_avp_data data = {
-				1054,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Rule-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* QoS-Rule-Base-Name */
-		{
-			struct dict_avp_data data = {
-				1074,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Rule-Base-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Session-Linking-Indicator */
-		{
-			struct dict_avp_data data = {
-				1064,	/* Code */
-				10415,	/* Vendor */
-				"Session-Linking-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Session-Linking-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UE_ONLY", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "RESERVED", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "UE_NW", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ADC-Rule-Base-Name */
-		{
-			struct dict_avp_data data = {
-				1095,	/* Code */
-				10415,	/* Vendor */
-				"ADC-Rule-Base-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* ADC-Rule-Name */
-		{
-			struct dict_avp_data data = {
-				1096,	/* Code */
-				10415,	/* Vendor */
-				"ADC-Rule-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Request-Type */
-		{
-			struct dict_avp_data data = {
-				2838,	/* Code */
-				10415,	/* Vendor */
-				"Request-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CS-Service-QoS-Request-Identifier */
-		{
-			struct dict_avp_data data = {
-				2807,	/* Code */
-				10415,	/* Vendor */
-				"CS-Service-QoS-Request-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CS-Service-QoS-Request-Operation */
-		{
-			struct dict_avp_data data = {
-				2808,	/* Code */
-				10415,	/* Vendor */
-				"CS-Service-QoS-Request-Operation",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(CS-Service-QoS-Request-Operation)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DELETION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "MODIFICATION", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CS-Service-Resource-Failure-Cause */
-		{
-			struct dict_avp_data data = {
-				2814,	/* Code */
-				10415,	/* Vendor */
-				"CS-Service-Resource-Failure-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(CS-Service-Resource-Failure-Cause)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "RESOURCE_RELEASED", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CS-Service-Resource-Result-Operation */
-		{
-			struct dict_avp_data data = {
-				2815,	/* Code */
-				10415,	/* Vendor */
-				"CS-Service-Resource-Result-Operation",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(CS-Service-Resource-Result-Operation)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DELETION", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Charging-Rule-Remove */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1002,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Rule-Remove",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* QoS-Rule-Report */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1055,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Rule-Report",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Redirect-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1085,	/* Code */
-				10415,	/* Vendor */
-				"Redirect-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* PRA-Remove */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2846,	/* Code */
-				10415,	/* Vendor */
-				"PRA-Remove",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Flow-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1058,	/* Code */
-				10415,	/* Vendor */
-				"Flow-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Tunnel-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1038,	/* Code */
-				10415,	/* Vendor */
-				"Tunnel-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* TDF-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1087,	/* Code */
-				10415,	/* Vendor */
-				"TDF-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Routing-Rule-Remove */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1075,	/* Code */
-				10415,	/* Vendor */
-				"Routing-Rule-Remove",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* CS-Service-Resource-Report */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2813,	/* Code */
-				10415,	/* Vendor */
-				"CS-Service-Resource-Report",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Presence-Reporting-Area-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2822,	/* Code */
-				10415,	/* Vendor */
-				"Presence-Reporting-Area-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Conditional-APN-Aggregate-Max-Bitrate */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2818,	/* Code */
-				10415,	/* Vendor */
-				"Conditional-APN-Aggregate-Max-Bitrate",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Access-Network-Charging-Identifier-Gx */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1022,	/* Code */
-				10415,	/* Vendor */
-				"Access-Network-Charging-Identifier-Gx",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Allocation-Retention-Priority */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1034,	/* Code */
-				10415,	/* Vendor */
-				"Allocation-Retention-Priority",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* QoS-Rule-Remove */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1052,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Rule-Remove",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Routing-Rule-Report */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2835,	/* Code */
-				10415,	/* Vendor */
-				"Routing-Rule-Report",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* TFT-Packet-Filter-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1013,	/* Code */
-				10415,	/* Vendor */
-				"TFT-Packet-Filter-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Fixed-User-Location-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2825,	/* Code */
-				10415,	/* Vendor */
-				"Fixed-User-Location-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Default-QoS-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2816,	/* Code */
-				10415,	/* Vendor */
-				"Default-QoS-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Packet-Filter-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1061,	/* Code */
-				10415,	/* Vendor */
-				"Packet-Filter-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Routing-Filter */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1078,	/* Code */
-				10415,	/* Vendor */
-				"Routing-Filter",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* ADC-Rule-Remove */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1093,	/* Code */
-				10415,	/* Vendor */
-				"ADC-Rule-Remove",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* QoS-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1016,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* PRA-Install */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2845,	/* Code */
-				10415,	/* Vendor */
-				"PRA-Install",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Routing-Rule-Definition */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1076,	/* Code */
-				10415,	/* Vendor */
-				"Routing-Rule-Definition",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Default-EPS-Bearer-QoS */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1049,	/* Code */
-				10415,	/* Vendor */
-				"Default-EPS-Bearer-QoS",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* CoA-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1039,	/* Code */
-				10415,	/* Vendor */
-				"CoA-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Application-Detection-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1098,	/* Code */
-				10415,	/* Vendor */
-				"Application-Detection-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Conditional-Policy-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2840,	/* Code */
-				10415,	/* Vendor */
-				"Conditional-Policy-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Charging-Rule-Definition */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1003,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Rule-Definition",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Routing-Rule-Install */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1081,	/* Code */
-				10415,	/* Vendor */
-				"Routing-Rule-Install",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* ADC-Rule-Definition */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1094,	/* Code */
-				10415,	/* Vendor */
-				"ADC-Rule-Definition",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* ADC-Rule-Report */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1097,	/* Code */
-				10415,	/* Vendor */
-				"ADC-Rule-Report",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* QoS-Rule-Definition */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1053,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Rule-Definition",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Charging-Rule-Report */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1018,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Rule-Report",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Event-Report-Indication */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1033,	/* Code */
-				10415,	/* Vendor */
-				"Event-Report-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Charging-Rule-Install */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1001,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Rule-Install",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* QoS-Rule-Install */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1051,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Rule-Install",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* ADC-Rule-Install */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1092,	/* Code */
-				10415,	/* Vendor */
-				"ADC-Rule-Install",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Usage-Monitoring-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1067,	/* Code */
-				10415,	/* Vendor */
-				"Usage-Monitoring-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29212_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double ts29214_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,184 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29214_avps_defs[] = {
+	/* Abort-Cause */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Abort-Cause)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BEARER_RELEASED", { .i32=0 } }, "3GPP/Enumerated(Abort-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INSUFFICIENT_SERVER_RESOURCES", { .i32=1 } }, "3GPP/Enumerated(Abort-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INSUFFICIENT_BEARER_RESOURCES", { .i32=2 } }, "3GPP/Enumerated(Abort-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PS_TO_CS_HANDOVER", { .i32=3 } }, "3GPP/Enumerated(Abort-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DISALLOWED", { .i32=4 } }, "3GPP/Enumerated(Abort-Cause)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 500, 10415, "Abort-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Abort-Cause)" },
+	/* Access-Network-Charging-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 501, 10415, "Access-Network-Charging-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Access-Network-Charging-Identifier-Value */
+	{ DICT_AVP, &(struct dict_avp_data){ 503, 10415, "Access-Network-Charging-Identifier-Value", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* AF-Application-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 504, 10415, "AF-Application-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* AF-Charging-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 505, 10415, "AF-Charging-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* AF-Requested-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 551, 10415, "AF-Requested-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* AF-Signalling-Protocol */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(AF-Signalling-Protocol)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_INFORMATION", { .i32=0 } }, "3GPP/Enumerated(AF-Signalling-Protocol)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SIP", { .i32=1 } }, "3GPP/Enumerated(AF-Signalling-Protocol)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 529, 10415, "AF-Signalling-Protocol", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(AF-Signalling-Protocol)" },
+	/* Application-Service-Provider-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 532, 10415, "Application-Service-Provider-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Pre-emption-Control-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 553, 10415, "Pre-emption-Control-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Codec-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 524, 10415, "Codec-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Content-Version */
+	{ DICT_AVP, &(struct dict_avp_data){ 552, 10415, "Content-Version", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* Extended-Max-Requested-BW-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 554, 10415, "Extended-Max-Requested-BW-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Extended-Max-Requested-BW-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 555, 10415, "Extended-Max-Requested-BW-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Extended-Max-Supported-BW-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 556, 10415, "Extended-Max-Supported-BW-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Extended-Max-Supported-BW-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 557, 10415, "Extended-Max-Supported-BW-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Flow-Description */
+	{ DICT_AVP, &(struct dict_avp_data){ 507, 10415, "Flow-Description", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "IPFilterRule" },
+	/* Flow-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 509, 10415, "Flow-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Flow-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Flow-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENABLED_UPLINK", { .i32=0 } }, "3GPP/Enumerated(Flow-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENABLED_DOWNLINK", { .i32=1 } }, "3GPP/Enumerated(Flow-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENABLED", { .i32=2 } }, "3GPP/Enumerated(Flow-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DISABLED", { .i32=3 } }, "3GPP/Enumerated(Flow-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REMOVED", { .i32=4 } }, "3GPP/Enumerated(Flow-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 511, 10415, "Flow-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Flow-Status)" },
+	/* Flow-Usage */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Flow-Usage)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_INFORMATION", { .i32=0 } }, "3GPP/Enumerated(Flow-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RTCP", { .i32=1 } }, "3GPP/Enumerated(Flow-Usage)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AF_SIGNALLING", { .i32=2 } }, "3GPP/Enumerated(Flow-Usage)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 512, 10415, "Flow-Usage", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Flow-Usage)" },
+	/* GCS-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 538, 10415, "GCS-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* IP-Domain-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 537, 10415, "IP-Domain-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Max-Requested-Bandwidth-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 515, 10415, "Max-Requested-Bandwidth-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Max-Requested-Bandwidth-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 516, 10415, "Max-Requested-Bandwidth-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Max-Supported-Bandwidth-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 543, 10415, "Max-Supported-Bandwidth-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Max-Supported-Bandwidth-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 544, 10415, "Max-Supported-Bandwidth-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MCPTT-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 547, 10415, "MCPTT-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Media-Component-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 518, 10415, "Media-Component-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Media-Component-Status */
+	{ DICT_AVP, &(struct dict_avp_data){ 549, 10415, "Media-Component-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Media-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Media-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AUDIO", { .i32=0 } }, "3GPP/Enumerated(Media-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VIDEO", { .i32=1 } }, "3GPP/Enumerated(Media-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DATA", { .i32=2 } }, "3GPP/Enumerated(Media-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "APPLICATION", { .i32=3 } }, "3GPP/Enumerated(Media-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CONTROL", { .i32=4 } }, "3GPP/Enumerated(Media-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TEXT", { .i32=5 } }, "3GPP/Enumerated(Media-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MESSAGE", { .i32=6 } }, "3GPP/Enumerated(Media-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 520, 10415, "Media-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Media-Type)" },
+	/* MPS-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 528, 10415, "MPS-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Min-Desired-Bandwidth-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 545, 10415, "Min-Desired-Bandwidth-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Min-Desired-Bandwidth-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 546, 10415, "Min-Desired-Bandwidth-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Min-Requested-Bandwidth-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 534, 10415, "Min-Requested-Bandwidth-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Min-Requested-Bandwidth-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 535, 10415, "Min-Requested-Bandwidth-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Priority-Sharing-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Priority-Sharing-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_SHARING_ENABLED", { .i32=0 } }, "3GPP/Enumerated(Priority-Sharing-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_SHARING_DISABLED", { .i32=1 } }, "3GPP/Enumerated(Priority-Sharing-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 550, 10415, "Priority-Sharing-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Priority-Sharing-Indicator)" },
+	/* RR-Bandwidth */
+	{ DICT_AVP, &(struct dict_avp_data){ 521, 10415, "RR-Bandwidth", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* RS-Bandwidth */
+	{ DICT_AVP, &(struct dict_avp_data){ 522, 10415, "RS-Bandwidth", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Service-Authorization-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 548, 10415, "Service-Authorization-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Service-URN */
+	{ DICT_AVP, &(struct dict_avp_data){ 525, 10415, "Service-URN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Service-Info-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Service-Info-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FINAL_SERVICE_INFORMATION", { .i32=0 } }, "3GPP/Enumerated(Service-Info-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRELIMINARY_SERVICE_INFORMATION", { .i32=1 } }, "3GPP/Enumerated(Service-Info-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 527, 10415, "Service-Info-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Service-Info-Status)" },
+	/* Sharing-Key-DL */
+	{ DICT_AVP, &(struct dict_avp_data){ 539, 10415, "Sharing-Key-DL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Sharing-Key-UL */
+	{ DICT_AVP, &(struct dict_avp_data){ 540, 10415, "Sharing-Key-UL", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Specific-Action */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Specific-Action)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Void", { .i32=0 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHARGING_CORRELATION_EXCHANGE", { .i32=1 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_LIMITED_PCC_DEPLOYMENT", { .i32=10 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USAGE_REPORT", { .i32=11 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ACCESS_NETWORK_INFO_REPORT", { .i32=12 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_RECOVERY_FROM_LIMITED_PCC_DEPLOYMENT", { .i32=13 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_ACCESS_NETWORK_INFO_REPORTING_FAILURE", { .i32=14 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_TRANSFER_POLICY_EXPIRED", { .i32=15 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PLMN_CHANGE", { .i32=16 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_LOSS_OF_BEARER", { .i32=2 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_RECOVERY_OF_BEARER", { .i32=3 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_RELEASE_OF_BEARER", { .i32=4 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Void2", { .i32=5 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IP_CAN_CHANGE", { .i32=6 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_OUT_OF_CREDIT", { .i32=7 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_SUCCESSFUL_RESOURCES_ALLOCATION", { .i32=8 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INDICATION_OF_FAILED_RESOURCES_ALLOCATION", { .i32=9 } }, "3GPP/Enumerated(Specific-Action)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 513, 10415, "Specific-Action", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Specific-Action)" },
+	/* SIP-Forking-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SIP-Forking-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SINGLE_DIALOGUE", { .i32=0 } }, "3GPP/Enumerated(SIP-Forking-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SEVERAL_DIALOGUES", { .i32=1 } }, "3GPP/Enumerated(SIP-Forking-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 523, 10415, "SIP-Forking-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SIP-Forking-Indication)" },
+	/* Sponsor-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 531, 10415, "Sponsor-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Sponsoring-Action */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Sponsoring-Action)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DISABLE_SPONSORING", { .i32=0 } }, "3GPP/Enumerated(Sponsoring-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENABLE_SPONSORING", { .i32=1 } }, "3GPP/Enumerated(Sponsoring-Action)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 542, 10415, "Sponsoring-Action", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Sponsoring-Action)" },
+	/* Required-Access-Info */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Required-Access-Info)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_LOCATION", { .i32=0 } }, "3GPP/Enumerated(Required-Access-Info)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MS_TIME_ZONE", { .i32=1 } }, "3GPP/Enumerated(Required-Access-Info)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 536, 10415, "Required-Access-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Required-Access-Info)" },
+	/* Rx-Request-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Rx-Request-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INITIAL_REQUEST", { .i32=0 } }, "3GPP/Enumerated(Rx-Request-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UPDATE_REQUEST", { .i32=1 } }, "3GPP/Enumerated(Rx-Request-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PCSCF_RESTORATION", { .i32=2 } }, "3GPP/Enumerated(Rx-Request-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 533, 10415, "Rx-Request-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Rx-Request-Type)" },
+	/* Retry-Interval */
+	{ DICT_AVP, &(struct dict_avp_data){ 541, 10415, "Retry-Interval", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Media-Sub-Component */
+	{ DICT_AVP, &(struct dict_avp_data){ 519, 10415, "Media-Sub-Component", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Flows */
+	{ DICT_AVP, &(struct dict_avp_data){ 510, 10415, "Flows", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Media-Component-Description */
+	{ DICT_AVP, &(struct dict_avp_data){ 517, 10415, "Media-Component-Description", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Access-Network-Charging-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 502, 10415, "Access-Network-Charging-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Acceptable-Service-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 526, 10415, "Acceptable-Service-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Sponsored-Connectivity-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 530, 10415, "Sponsored-Connectivity-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29214_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,847 +294,7 @@ static int dict_ts29214_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* Abort-Cause */
-		{
-			struct dict_avp_data data = {
-				500,	/* Code */
-				10415,	/* Vendor */
-				"Abort-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Abort-Cause)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "BEARER_RELEASED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "INSUFFICIENT_SERVER_RESOURCES", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "INSUFFICIENT_BEARER_RESOURCES", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "PS_TO_CS_HANDOVER", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "DISALLOWED", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Access-Network-Charging-Address */
-		{
-			struct dict_avp_data data = {
-				501,	/* Code */
-				10415,	/* Vendor */
-				"Access-Network-Charging-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Access-Network-Charging-Identifier-Value */
-		{
-			struct dict_avp_data data = {
-				503,	/* Code */
-				10415,	/* Vendor */
-				"Access-Network-Charging-Identifier-Value",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* AF-Application-Identifier */
-		{
-			struct dict_avp_data data = {
-				504,	/* Code */
-				10415,	/* Vendor */
-				"AF-Application-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* AF-Charging-Identifier */
-		{
-			struct dict_avp_data data = {
-				505,	/* Code */
-				10415,	/* Vendor */
-				"AF-Charging-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* AF-Requested-Data */
-		{
-			struct dict_avp_data data = {
-				551,	/* Code */
-				10415,	/* Vendor */
-				"AF-Requested-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* AF-Signalling-Protocol */
-		{
-			struct dict_avp_data data = {
-				529,	/* Code */
-				10415,	/* Vendor */
-				"AF-Signalling-Protocol",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(AF-Signalling-Protocol)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NO_INFORMATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SIP", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Application-Service-Provider-Identity */
-		{
-			struct dict_avp_data data = {
-				532,	/* Code */
-				10415,	/* Vendor */
-				"Application-Service-Provider-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Pre-emption-Control-Info */
-		{
-			struct dict_avp_data data = {
-				553,	/* Code */
-				10415,	/* Vendor */
-				"Pre-emption-Control-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Codec-Data */
-		{
-			struct dict_avp_data data = {
-				524,	/* Code */
-				10415,	/* Vendor */
-				"Codec-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Content-Version */
-		{
-			struct dict_avp_data data = {
-				552,	/* Code */
-				10415,	/* Vendor */
-				"Content-Version",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Extended-Max-Requested-BW-DL */
-		{
-			struct dict_avp_data data = {
-				554,	/* Code */
-				10415,	/* Vendor */
-				"Extended-Max-Requested-BW-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Extended-Max-Requested-BW-UL */
-		{
-			struct dict_avp_data data = {
-				555,	/* Code */
-				10415,	/* Vendor */
-				"Extended-Max-Requested-BW-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Extended-Max-Supported-BW-DL */
-		{
-			struct dict_avp_data data = {
-				556,	/* Code */
-				10415,	/* Vendor */
-				"Extended-Max-Supported-BW-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Extended-Max-Supported-BW-UL */
-		{
-			struct dict_avp_data data = {
-				557,	/* Code */
-				10415,	/* Vendor */
-				"Extended-Max-Supported-BW-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Flow-Description */
-		{
-			struct dict_avp_data data = {
-				507,	/* Code */
-				10415,	/* Vendor */
-				"Flow-Description",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, IPFilterRule_type, NULL);
-		};
-		/* Flow-Number */
-		{
-			struct dict_avp_data data = {
-				509,	/* Code */
-				10415,	/* Vendor */
-				"Flow-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Flow-Status */
-		{
-			struct dict_avp_data data = {
-				511,	/* Code */
-				10415,	/* Vendor */
-				"Flow-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Flow-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ENABLED_UPLINK", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ENABLED_DOWNLINK", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "ENABLED", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "DISABLED", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "REMOVED", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Flow-Usage */
-		{
-			struct dict_avp_data data = {
-				512,	/* Code */
-				10415,	/* Vendor */
-				"Flow-Usage",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Flow-Usage)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NO_INFORMATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "RTCP", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "AF_SIGNALLING", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* GCS-Identifier */
-		{
-			struct dict_avp_data data = {
-				538,	/* Code */
-				10415,	/* Vendor */
-				"GCS-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* IP-Domain-Id */
-		{
-			struct dict_avp_data data = {
-				537,	/* Code */
-				10415,	/* Vendor */
-				"IP-Domain-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Max-Requested-Bandwidth-DL */
-		{
-			struct dict_avp_data data = {
-				515,	/* Code */
-				10415,	/* Vendor */
-				"Max-Requested-Bandwidth-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Max-Requested-Bandwidth-UL */
-		{
-			struct dict_avp_data data = {
-				516,	/* Code */
-				10415,	/* Vendor */
-				"Max-Requested-Bandwidth-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Max-Supported-Bandwidth-DL */
-		{
-			struct dict_avp_data data = {
-				543,	/* Code */
-				10415,	/* Vendor */
-				"Max-Supported-Bandwidth-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Max-Supported-Bandwidth-UL */
-		{
-			struct dict_avp_data data = {
-				544,	/* Code */
-				10415,	/* Vendor */
-				"Max-Supported-Bandwidth-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MCPTT-Identifier */
-		{
-			struct dict_avp_data data = {
-				547,	/* Code */
-				10415,	/* Vendor */
-				"MCPTT-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Media-Component-Number */
-		{
-			struct dict_avp_data data = {
-				518,	/* Code */
-				10415,	/* Vendor */
-				"Media-Component-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Media-Component-Status */
-		{
-			struct dict_avp_data data = {
-				549,	/* Code */
-				10415,	/* Vendor */
-				"Media-Component-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Media-Type */
-		{
-			struct dict_avp_data data = {
-				520,	/* Code */
-				10415,	/* Vendor */
-				"Media-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Media-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "AUDIO", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "VIDEO", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "DATA", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "APPLICATION", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "CONTROL", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "TEXT", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "MESSAGE", { .i32=6 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MPS-Identifier */
-		{
-			struct dict_avp_data data = {
-				528,	/* Code */
-				10415,	/* Vendor */
-				"MPS-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Min-Desired-Bandwidth-DL */
-		{
-			struct dict_avp_data data = {
-				545,	/* Code */
-				10415,	/* Vendor */
-				"Min-Desired-Bandwidth-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Min-Desired-Bandwidth-UL */
-		{
-			struct dict_avp_data data = {
-				546,	/* Code */
-				10415,	/* Vendor */
-				"Min-Desired-Bandwidth-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Min-Requested-Bandwidth-DL */
-		{
-			struct dict_avp_data data = {
-				534,	/* Code */
-				10415,	/* Vendor */
-				"Min-Requested-Bandwidth-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Min-Requested-Bandwidth-UL */
-		{
-			struct dict_avp_data data = {
-				535,	/* Code */
-				10415,	/* Vendor */
-				"Min-Requested-Bandwidth-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Priority-Sharing-Indicator */
-		{
-			struct dict_avp_data data = {
-				550,	/* Code */
-				10415,	/* Vendor */
-				"Priority-Sharing-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Priority-Sharing-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PRIORITY_SHARING_ENABLED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PRIORITY_SHARING_DISABLED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* RR-Bandwidth */
-		{
-			struct dict_avp_data data = {
-				521,	/* Code */
-				10415,	/* Vendor */
-				"RR-Bandwidth",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* RS-Bandwidth */
-		{
-			struct dict_avp_data data = {
-				522,	/* Code */
-				10415,	/* Vendor */
-				"RS-Bandwidth",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Service-Authorization-Info */
-		{
-			struct dict_avp_data data = {
-				548,	/* Code */
-				10415,	/* Vendor */
-				"Service-Authorization-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Service-URN */
-		{
-			struct dict_avp_data data = {
-				525,	/* Code */
-				10415,	/* Vendor */
-				"Service-URN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Service-Info-Status */
-		{
-			struct dict_avp_data data = {
-				527,	/* Code */
-				10415,	/* Vendor */
-				"Service-Info-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Service-Info-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "FINAL_SERVICE_INFORMATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PRELIMINARY_SERVICE_INFORMATION", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Sharing-Key-DL */
-		{
-			struct dict_avp_data data = {
-				539,	/* Code */
-				10415,	/* Vendor */
-				"Sharing-Key-DL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Sharing-Key-UL */
-		{
-			struct dict_avp_data data = {
-				540,	/* Code */
-				10415,	/* Vendor */
-				"Sharing-Key-UL",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Specific-Action */
-		{
-			struct dict_avp_data data = {
-				513,	/* Code */
-				10415,	/* Vendor */
-				"Specific-Action",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Specific-Action)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Void", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CHARGING_CORRELATION_EXCHANGE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "INDICATION_OF_LIMITED_PCC_DEPLOYMENT", { .i32=10 }};
-			struct dict_enumval_data        t_4 = { "USAGE_REPORT", { .i32=11 }};
-			struct dict_enumval_data        t_5 = { "ACCESS_NETWORK_INFO_REPORT", { .i32=12 }};
-			struct dict_enumval_data        t_6 = { "INDICATION_OF_RECOVERY_FROM_LIMITED_PCC_DEPLOYMENT", { .i32=13 }};
-			struct dict_enumval_data        t_7 = { "INDICATION_OF_ACCESS_NETWORK_INFO_REPORTING_FAILURE", { .i32=14 }};
-			struct dict_enumval_data        t_8 = { "INDICATION_OF_TRANSFER_POLICY_EXPIRED", { .i32=15 }};
-			struct dict_enumval_data        t_9 = { "PLMN_CHANGE", { .i32=16 }};
-			struct dict_enumval_data        t_10 = { "INDICATION_OF_LOSS_OF_BEARER", { .i32=2 }};
-			struct dict_enumval_data        t_11 = { "INDICATION_OF_RECOVERY_OF_BEARER", { .i32=3 }};
-			struct dict_enumval_data        t_12 = { "INDICATION_OF_RELEASE_OF_BEARER", { .i32=4 }};
-			struct dict_enumval_data        t_13 = { "Void2", { .i32=5 }};
-			struct dict_enumval_data        t_14 = { "IP_CAN_CHANGE", { .i32=6 }};
-			struct dict_enumval_data        t_15 = { "INDICATION_OF_OUT_OF_CREDIT", { .i32=7 }};
-			struct dict_enumval_data        t_16 = { "INDICATION_OF_SUCCESSFUL_RESOURCES_ALLOCATION", { .i32=8 }};
-			struct dict_enumval_data        t_17 = { "INDICATION_OF_FAILED_RESOURCES_ALLOCATION", { .i32=9 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_17, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SIP-Forking-Indication */
-		{
-			struct dict_avp_data data = {
-				523,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Forking-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SIP-Forking-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SINGLE_DIALOGUE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SEVERAL_DIALOGUES", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Sponsor-Identity */
-		{
-			struct dict_avp_data data = {
-				531,	/* Code */
-				10415,	/* Vendor */
-				"Sponsor-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Sponsoring-Action */
-		{
-			struct dict_avp_data data = {
-				542,	/* Code */
-				10415,	/* Vendor */
-				"Sponsoring-Action",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Sponsoring-Action)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DISABLE_SPONSORING", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ENABLE_SPONSORING", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Required-Access-Info */
-		{
-			struct dict_avp_data data = {
-				536,	/* Code */
-				10415,	/* Vendor */
-				"Required-Access-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Required-Access-Info)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "USER_LOCATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "MS_TIME_ZONE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Rx-Request-Type */
-		{
-			struct dict_avp_data data = {
-				533,	/* Code */
-				10415,	/* Vendor */
-				"Rx-Request-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Rx-Request-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "INITIAL_REQUEST", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "UPDATE_REQUEST", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "PCSCF_RESTORATION", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Retry-Interval */
-		{
-			struct dict_avp_data data = {
-				541,	/* Code */
-				10415,	/* Vendor */
-				"Retry-Interval",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Media-Sub-Component */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				519,	/* Code */
-				10415,	/* Vendor */
-				"Media-Sub-Component",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Flows */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				510,	/* Code */
-				10415,	/* Vendor */
-				"Flows",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Media-Component-Description */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				517,	/* Code */
-				10415,	/* Vendor */
-				"Media-Component-Description",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Access-Network-Charging-Identifier */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				502,	/* Code */
-				10415,	/* Vendor */
-				"Access-Network-Charging-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Acceptable-Service-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				526,	/* Code */
-				10415,	/* Vendor */
-				"Acceptable-Service-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Sponsored-Connectivity-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				530,	/* Code */
-				10415,	/* Vendor */
-				"Sponsored-Connectivity-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29214_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double ts29215_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,39 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29215_avps_defs[] = {
+	/* DRA-Deployment */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(DRA-Deployment)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DRA_Deployed", { .i32=0 } }, "3GPP/Enumerated(DRA-Deployment)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2206, 10415, "DRA-Deployment", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(DRA-Deployment)" },
+	/* Multiple-BBERF-Action */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Multiple-BBERF-Action)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ESTABLISHMENT", { .i32=0 } }, "3GPP/Enumerated(Multiple-BBERF-Action)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TERMINATION", { .i32=1 } }, "3GPP/Enumerated(Multiple-BBERF-Action)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2204, 10415, "Multiple-BBERF-Action", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Multiple-BBERF-Action)" },
+	/* Subsession-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 2202, 10415, "Subsession-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Subsession-Operation */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subsession-Operation)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TERMINATION", { .i32=0 } }, "3GPP/Enumerated(Subsession-Operation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ESTABLISHMENT", { .i32=1 } }, "3GPP/Enumerated(Subsession-Operation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MODIFICATION", { .i32=2 } }, "3GPP/Enumerated(Subsession-Operation)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2203, 10415, "Subsession-Operation", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Subsession-Operation)" },
+	/* DRA-Binding */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(DRA-Binding)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DRA_BINDING_DELETION", { .i32=0 } }, "3GPP/Enumerated(DRA-Binding)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2208, 10415, "DRA-Binding", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(DRA-Binding)" },
+	/* PCRF-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2207, 10415, "PCRF-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* UE-Local-IPv6-Prefix */
+	{ DICT_AVP, &(struct dict_avp_data){ 2205, 10415, "UE-Local-IPv6-Prefix", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Subsession-Enforcement-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 2201, 10415, "Subsession-Enforcement-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Subsession-Decision-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 2200, 10415, "Subsession-Decision-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29215_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,165 +149,7 @@ static int dict_ts29215_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* DRA-Deployment */
-		{
-			struct dict_avp_data data = {
-				2206,	/* Code */
-				10415,	/* Vendor */
-				"DRA-Deployment",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(DRA-Deployment)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DRA_Deployed", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Multiple-BBERF-Action */
-		{
-			struct dict_avp_data data = {
-				2204,	/* Code */
-				10415,	/* Vendor */
-				"Multiple-BBERF-Action",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Multiple-BBERF-Action)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ESTABLISHMENT", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "TERMINATION", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Subsession-Id */
-		{
-			struct dict_avp_data data = {
-				2202,	/* Code */
-				10415,	/* Vendor */
-				"Subsession-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Subsession-Operation */
-		{
-			struct dict_avp_data data = {
-				2203,	/* Code */
-				10415,	/* Vendor */
-				"Subsession-Operation",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subsession-Operation)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "TERMINATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ESTABLISHMENT", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "MODIFICATION", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* DRA-Binding */
-		{
-			struct dict_avp_data data = {
-				2208,	/* Code */
-				10415,	/* Vendor */
-				"DRA-Binding",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(DRA-Binding)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DRA_BINDING_DELETION", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PCRF-Address */
-		{
-			struct dict_avp_data data = {
-				2207,	/* Code */
-				10415,	/* Vendor */
-				"PCRF-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* UE-Local-IPv6-Prefix */
-		{
-			struct dict_avp_data data = {
-				2205,	/* Code */
-				10415,	/* Vendor */
-				"UE-Local-IPv6-Prefix",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Subsession-Enforcement-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2201,	/* Code */
-				10415,	/* Vendor */
-				"Subsession-Enforcement-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Subsession-Decision-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2200,	/* Code */
-				10415,	/* Vendor */
-				"Subsession-Decision-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29215_avps_defs );
 
    /* Commands section */
    {
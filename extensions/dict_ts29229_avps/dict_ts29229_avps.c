@@ -43,6 +43,12 @@ const double ts29229_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,170 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29229_avps_defs[] = {
+	/* Visited-Network-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 600, 10415, "Visited-Network-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Public-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 601, 10415, "Public-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Server-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 602, 10415, "Server-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Mandatory-Capability */
+	{ DICT_AVP, &(struct dict_avp_data){ 604, 10415, "Mandatory-Capability", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Optional-Capability */
+	{ DICT_AVP, &(struct dict_avp_data){ 605, 10415, "Optional-Capability", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* User-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 606, 10415, "User-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SIP-Number-Auth-Items */
+	{ DICT_AVP, &(struct dict_avp_data){ 607, 10415, "SIP-Number-Auth-Items", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SIP-Authentication-Scheme */
+	{ DICT_AVP, &(struct dict_avp_data){ 608, 10415, "SIP-Authentication-Scheme", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* SIP-Authenticate */
+	{ DICT_AVP, &(struct dict_avp_data){ 609, 10415, "SIP-Authenticate", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SIP-Authorization */
+	{ DICT_AVP, &(struct dict_avp_data){ 610, 10415, "SIP-Authorization", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SIP-Authentication-Context */
+	{ DICT_AVP, &(struct dict_avp_data){ 611, 10415, "SIP-Authentication-Context", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SIP-Item-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 613, 10415, "SIP-Item-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Server-Assignment-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Server-Assignment-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_ASSIGNMENT", { .i32=0 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REGISTRATION", { .i32=1 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AUTHENTICATION_TIMEOUT", { .i32=10 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DEREGISTRATION_TOO_MUCH_DATA", { .i32=11 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AAA_USER_DATA_REQUEST", { .i32=12 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PGW_UPDATE", { .i32=13 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESTORATION", { .i32=14 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RE_REGISTRATION", { .i32=2 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNREGISTERED_USER", { .i32=3 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TIMEOUT_DEREGISTRATION", { .i32=4 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_DEREGISTRATION", { .i32=5 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TIMEOUT_DEREGISTRATION_STORE_SERVER_NAME", { .i32=6 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_DEREGISTRATION_STORE_SERVER_NAME", { .i32=7 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ADMINISTRATIVE_DEREGISTRATION", { .i32=8 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AUTHENTICATION_FAILURE", { .i32=9 } }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 614, 10415, "Server-Assignment-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Server-Assignment-Type)" },
+	/* Reason-Code */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Reason-Code)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PERMANENT_TERMINATION", { .i32=0 } }, "3GPP/Enumerated(Reason-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NEW_SERVER_ASSIGNED", { .i32=1 } }, "3GPP/Enumerated(Reason-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SERVER_CHANGE", { .i32=2 } }, "3GPP/Enumerated(Reason-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REMOVE_S_CSCF", { .i32=3 } }, "3GPP/Enumerated(Reason-Code)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 616, 10415, "Reason-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Reason-Code)" },
+	/* Reason-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 617, 10415, "Reason-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Primary-Event-Charging-Function-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 619, 10415, "Primary-Event-Charging-Function-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterURI" },
+	/* Secondary-Event-Charging-Function-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 620, 10415, "Secondary-Event-Charging-Function-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterURI" },
+	/* Primary-Charging-Collection-Function-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 621, 10415, "Primary-Charging-Collection-Function-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterURI" },
+	/* Secondary-Charging-Collection-Function-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 622, 10415, "Secondary-Charging-Collection-Function-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterURI" },
+	/* User-Authorization-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(User-Authorization-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REGISTRATION", { .i32=0 } }, "3GPP/Enumerated(User-Authorization-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DE_REGISTRATION", { .i32=1 } }, "3GPP/Enumerated(User-Authorization-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REGISTRATION_AND_CAPABILITIES", { .i32=2 } }, "3GPP/Enumerated(User-Authorization-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 623, 10415, "User-Authorization-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(User-Authorization-Type)" },
+	/* User-Data-Already-Available */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(User-Data-Already-Available)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_DATA_NOT_AVAILABLE", { .i32=0 } }, "3GPP/Enumerated(User-Data-Already-Available)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_DATA_ALREADY_AVAILABLE", { .i32=1 } }, "3GPP/Enumerated(User-Data-Already-Available)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 624, 10415, "User-Data-Already-Available", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(User-Data-Already-Available)" },
+	/* Confidentiality-Key */
+	{ DICT_AVP, &(struct dict_avp_data){ 625, 10415, "Confidentiality-Key", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Integrity-Key */
+	{ DICT_AVP, &(struct dict_avp_data){ 626, 10415, "Integrity-Key", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Feature-List-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 629, 10415, "Feature-List-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Feature-List */
+	{ DICT_AVP, &(struct dict_avp_data){ 630, 10415, "Feature-List", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Originating-Request */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Originating-Request)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ORIGINATING", { .i32=0 } }, "3GPP/Enumerated(Originating-Request)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 633, 10415, "Originating-Request", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Originating-Request)" },
+	/* Wildcarded-Public-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 634, 10415, "Wildcarded-Public-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* UAR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 637, 10415, "UAR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Loose-Route-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Loose-Route-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LOOSE_ROUTE_NOT_REQUIRED", { .i32=0 } }, "3GPP/Enumerated(Loose-Route-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LOOSE_ROUTE_REQUIRED", { .i32=1 } }, "3GPP/Enumerated(Loose-Route-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 638, 10415, "Loose-Route-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Loose-Route-Indication)" },
+	/* Path */
+	{ DICT_AVP, &(struct dict_avp_data){ 640, 10415, "Path", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Contact */
+	{ DICT_AVP, &(struct dict_avp_data){ 641, 10415, "Contact", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Call-ID-SIP-Header */
+	{ DICT_AVP, &(struct dict_avp_data){ 643, 10415, "Call-ID-SIP-Header", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* From-SIP-Header */
+	{ DICT_AVP, &(struct dict_avp_data){ 644, 10415, "From-SIP-Header", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* To-SIP-Header */
+	{ DICT_AVP, &(struct dict_avp_data){ 645, 10415, "To-SIP-Header", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Record-Route */
+	{ DICT_AVP, &(struct dict_avp_data){ 646, 10415, "Record-Route", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Multiple-Registration-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Multiple-Registration-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOT_MULTIPLE_REGISTRATION", { .i32=0 } }, "3GPP/Enumerated(Multiple-Registration-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MULTIPLE_REGISTRATION", { .i32=1 } }, "3GPP/Enumerated(Multiple-Registration-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 648, 10415, "Multiple-Registration-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Multiple-Registration-Indication)" },
+	/* Session-Priority */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Session-Priority)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_0", { .i32=0 } }, "3GPP/Enumerated(Session-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_1", { .i32=1 } }, "3GPP/Enumerated(Session-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_2", { .i32=2 } }, "3GPP/Enumerated(Session-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_3", { .i32=3 } }, "3GPP/Enumerated(Session-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIORITY_4", { .i32=4 } }, "3GPP/Enumerated(Session-Priority)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 650, 10415, "Session-Priority", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Session-Priority)" },
+	/* Priviledged-Sender-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Priviledged-Sender-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIVILEDGED_SENDER", { .i32=1 } }, "3GPP/Enumerated(Priviledged-Sender-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 652, 10415, "Priviledged-Sender-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Priviledged-Sender-Indication)" },
+	/* LIA-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 653, 10415, "LIA-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Initial-CSeq-Sequence-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 654, 10415, "Initial-CSeq-Sequence-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SAR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 655, 10415, "SAR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* WebRTC-Authentication-Function-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 657, 10415, "WebRTC-Authentication-Function-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* WebRTC-Web-Server-Function-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 658, 10415, "WebRTC-Web-Server-Function-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Wildcarded-IMPU */
+	{ DICT_AVP, &(struct dict_avp_data){ 636, 10415, "Wildcarded-IMPU", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Subscription-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 642, 10415, "Subscription-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Server-Capabilities */
+	{ DICT_AVP, &(struct dict_avp_data){ 603, 10415, "Server-Capabilities", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Associated-Registered-Identities */
+	{ DICT_AVP, &(struct dict_avp_data){ 647, 10415, "Associated-Registered-Identities", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* SIP-Digest-Authenticate */
+	{ DICT_AVP, &(struct dict_avp_data){ 635, 10415, "SIP-Digest-Authenticate", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Supported-Features */
+	{ DICT_AVP, &(struct dict_avp_data){ 628, 10415, "Supported-Features", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Allowed-WAF-WWSF-Identities */
+	{ DICT_AVP, &(struct dict_avp_data){ 656, 10415, "Allowed-WAF-WWSF-Identities", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Identity-with-Emergency-Registration */
+	{ DICT_AVP, &(struct dict_avp_data){ 651, 10415, "Identity-with-Emergency-Registration", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Associated-Identities */
+	{ DICT_AVP, &(struct dict_avp_data){ 632, 10415, "Associated-Identities", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Deregistration-Reason */
+	{ DICT_AVP, &(struct dict_avp_data){ 615, 10415, "Deregistration-Reason", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Charging-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 618, 10415, "Charging-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* SIP-Auth-Data-Item */
+	{ DICT_AVP, &(struct dict_avp_data){ 612, 10415, "SIP-Auth-Data-Item", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Restoration-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 649, 10415, "Restoration-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Supported-Applications */
+	{ DICT_AVP, &(struct dict_avp_data){ 631, 10415, "Supported-Applications", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* SCSCF-Restoration-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 639, 10415, "SCSCF-Restoration-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29229_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,853 +280,7 @@ static int dict_ts29229_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* Visited-Network-Identifier */
-		{
-			struct dict_avp_data data = {
-				600,	/* Code */
-				10415,	/* Vendor */
-				"Visited-Network-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Public-Identity */
-		{
-			struct dict_avp_data data = {
-				601,	/* Code */
-				10415,	/* Vendor */
-				"Public-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Server-Name */
-		{
-			struct dict_avp_data data = {
-				602,	/* Code */
-				10415,	/* Vendor */
-				"Server-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Mandatory-Capability */
-		{
-			struct dict_avp_data data = {
-				604,	/* Code */
-				10415,	/* Vendor */
-				"Mandatory-Capability",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Optional-Capability */
-		{
-			struct dict_avp_data data = {
-				605,	/* Code */
-				10415,	/* Vendor */
-				"Optional-Capability",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Data */
-		{
-			struct dict_avp_data data = {
-				606,	/* Code */
-				10415,	/* Vendor */
-				"User-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SIP-Number-Auth-Items */
-		{
-			struct dict_avp_data data = {
-				607,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Number-Auth-Items",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SIP-Authentication-Scheme */
-		{
-			struct dict_avp_data data = {
-				608,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Authentication-Scheme",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* SIP-Authenticate */
-		{
-			struct dict_avp_data data = {
-				609,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Authenticate",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SIP-Authorization */
-		{
-			struct dict_avp_data data = {
-				610,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Authorization",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SIP-Authentication-Context */
-		{
-			struct dict_avp_data data = {
-				611,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Authentication-Context",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SIP-Item-Number */
-		{
-			struct dict_avp_data data = {
-				613,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Item-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Server-Assignment-Type */
-		{
-			struct dict_avp_data data = {
-				614,	/* Code */
-				10415,	/* Vendor */
-				"Server-Assignment-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Server-Assignment-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NO_ASSIGNMENT", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "REGISTRATION", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "AUTHENTICATION_TIMEOUT", { .i32=10 }};
-			struct dict_enumval_data        t_4 = { "DEREGISTRATION_TOO_MUCH_DATA", { .i32=11 }};
-			struct dict_enumval_data        t_5 = { "AAA_USER_DATA_REQUEST", { .i32=12 }};
-			struct dict_enumval_data        t_6 = { "PGW_UPDATE", { .i32=13 }};
-			struct dict_enumval_data        t_7 = { "RESTORATION", { .i32=14 }};
-			struct dict_enumval_data        t_8 = { "RE_REGISTRATION", { .i32=2 }};
-			struct dict_enumval_data        t_9 = { "UNREGISTERED_USER", { .i32=3 }};
-			struct dict_enumval_data        t_10 = { "TIMEOUT_DEREGISTRATION", { .i32=4 }};
-			struct dict_enumval_data        t_11 = { "USER_DEREGISTRATION", { .i32=5 }};
-			struct dict_enumval_data        t_12 = { "TIMEOUT_DEREGISTRATION_STORE_SERVER_NAME", { .i32=6 }};
-			struct dict_enumval_data        t_13 = { "USER_DEREGISTRATION_STORE_SERVER_NAME", { .i32=7 }};
-			struct dict_enumval_data        t_14 = { "ADMINISTRATIVE_DEREGISTRATION", { .i32=8 }};
-			struct dict_enumval_data        t_15 = { "AUTHENTICATION_FAILURE", { .i32=9 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Reason-Code */
-		{
-			struct dict_avp_data data = {
-				616,	/* Code */
-				10415,	/* Vendor */
-				"Reason-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Reason-Code)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PERMANENT_TERMINATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NEW_SERVER_ASSIGNED", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "SERVER_CHANGE", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "REMOVE_S_CSCF", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Reason-Info */
-		{
-			struct dict_avp_data data = {
-				617,	/* Code */
-				10415,	/* Vendor */
-				"Reason-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Primary-Event-Charging-Function-Name */
-		{
-			struct dict_avp_data data = {
-				619,	/* Code */
-				10415,	/* Vendor */
-				"Primary-Event-Charging-Function-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterURI_type, NULL);
-		};
-		/* Secondary-Event-Charging-Function-Name */
-		{
-			struct dict_avp_data data = {
-				620,	/* Code */
-				10415,	/* Vendor */
-				"Secondary-Event-Charging-Function-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterURI_type, NULL);
-		};
-		/* Primary-Charging-Collection-Function-Name */
-		{
-			struct dict_avp_data data = {
-				621,	/* Code */
-				10415,	/* Vendor */
-				"Primary-Charging-Collection-Function-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterURI_type, NULL);
-		};
-		/* Secondary-Charging-Collection-Function-Name */
-		{
-			struct dict_avp_data data = {
-				622,	/* Code */
-				10415,	/* Vendor */
-				"Secondary-Charging-Collection-Function-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterURI_type, NULL);
-		};
-		/* User-Authorization-Type */
-		{
-			struct dict_avp_data data = {
-				623,	/* Code */
-				10415,	/* Vendor */
-				"User-Authorization-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(User-Authorization-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "REGISTRATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "DE_REGISTRATION", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "REGISTRATION_AND_CAPABILITIES", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* User-Data-Already-Available */
-		{
-			struct dict_avp_data data = {
-				624,	/* Code */
-				10415,	/* Vendor */
-				"User-Data-Already-Available",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(User-Data-Already-Available)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "USER_DATA_NOT_AVAILABLE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "USER_DATA_ALREADY_AVAILABLE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Confidentiality-Key */
-		{
-			struct dict_avp_data data = {
-				625,	/* Code */
-				10415,	/* Vendor */
-				"Confidentiality-Key",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Integrity-Key */
-		{
-			struct dict_avp_data data = {
-				626,	/* Code */
-				10415,	/* Vendor */
-				"Integrity-Key",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Feature-List-ID */
-		{
-			struct dict_avp_data data = {
-				629,	/* Code */
-				10415,	/* Vendor */
-				"Feature-List-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Feature-List */
-		{
-			struct dict_avp_data data = {
-				630,	/* Code */
-				10415,	/* Vendor */
-				"Feature-List",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Originating-Request */
-		{
-			struct dict_avp_data data = {
-				633,	/* Code */
-				10415,	/* Vendor */
-				"Originating-Request",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Originating-Request)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ORIGINATING", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Wildcarded-Public-Identity */
-		{
-			struct dict_avp_data data = {
-				634,	/* Code */
-				10415,	/* Vendor */
-				"Wildcarded-Public-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* UAR-Flags */
-		{
-			struct dict_avp_data data = {
-				637,	/* Code */
-				10415,	/* Vendor */
-				"UAR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Loose-Route-Indication */
-		{
-			struct dict_avp_data data = {
-				638,	/* Code */
-				10415,	/* Vendor */
-				"Loose-Route-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Loose-Route-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "LOOSE_ROUTE_NOT_REQUIRED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "LOOSE_ROUTE_REQUIRED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Path */
-		{
-			struct dict_avp_data data = {
-				640,	/* Code */
-				10415,	/* Vendor */
-				"Path",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Contact */
-		{
-			struct dict_avp_data data = {
-				641,	/* Code */
-				10415,	/* Vendor */
-				"Contact",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Call-ID-SIP-Header */
-		{
-			struct dict_avp_data data = {
-				643,	/* Code */
-				10415,	/* Vendor */
-				"Call-ID-SIP-Header",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* From-SIP-Header */
-		{
-			struct dict_avp_data data = {
-				644,	/* Code */
-				10415,	/* Vendor */
-				"From-SIP-Header",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* To-SIP-Header */
-		{
-			struct dict_avp_data data = {
-				645,	/* Code */
-				10415,	/* Vendor */
-				"To-SIP-Header",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Record-Route */
-		{
-			struct dict_avp_data data = {
-				646,	/* Code */
-				10415,	/* Vendor */
-				"Record-Route",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Multiple-Registration-Indication */
-		{
-			struct dict_avp_data data = {
-				648,	/* Code */
-				10415,	/* Vendor */
-				"Multiple-Registration-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Multiple-Registration-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NOT_MULTIPLE_REGISTRATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "MULTIPLE_REGISTRATION", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Session-Priority */
-		{
-			struct dict_avp_data data = {
-				650,	/* Code */
-				10415,	/* Vendor */
-				"Session-Priority",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Session-Priority)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PRIORITY_0", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PRIORITY_1", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "PRIORITY_2", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "PRIORITY_3", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "PRIORITY_4", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Priviledged-Sender-Indication */
-		{
-			struct dict_avp_data data = {
-				652,	/* Code */
-				10415,	/* Vendor */
-				"Priviledged-Sender-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Priviledged-Sender-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PRIVILEDGED_SENDER", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* LIA-Flags */
-		{
-			struct dict_avp_data data = {
-				653,	/* Code */
-				10415,	/* Vendor */
-				"LIA-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Initial-CSeq-Sequence-Number */
-		{
-			struct dict_avp_data data = {
-				654,	/* Code */
-				10415,	/* Vendor */
-				"Initial-CSeq-Sequence-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SAR-Flags */
-		{
-			struct dict_avp_data data = {
-				655,	/* Code */
-				10415,	/* Vendor */
-				"SAR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* WebRTC-Authentication-Function-Name */
-		{
-			struct dict_avp_data data = {
-				657,	/* Code */
-				10415,	/* Vendor */
-				"WebRTC-Authentication-Function-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* WebRTC-Web-Server-Function-Name */
-		{
-			struct dict_avp_data data = {
-				658,	/* Code */
-				10415,	/* Vendor */
-				"WebRTC-Web-Server-Function-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Wildcarded-IMPU */
-		{
-			struct dict_avp_data data = {
-				636,	/* Code */
-				10415,	/* Vendor */
-				"Wildcarded-IMPU",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Subscription-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				642,	/* Code */
-				10415,	/* Vendor */
-				"Subscription-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Server-Capabilities */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				603,	/* Code */
-				10415,	/* Vendor */
-				"Server-Capabilities",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Associated-Registered-Identities */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				647,	/* Code */
-				10415,	/* Vendor */
-				"Associated-Registered-Identities",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SIP-Digest-Authenticate */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				635,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Digest-Authenticate",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Supported-Features */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				628,	/* Code */
-				10415,	/* Vendor */
-				"Supported-Features",	/* Name */
-				AVP_FLAG_VENDOR,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Allowed-WAF-WWSF-Identities */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				656,	/* Code */
-				10415,	/* Vendor */
-				"Allowed-WAF-WWSF-Identities",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Identity-with-Emergency-Registration */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				651,	/* Code */
-				10415,	/* Vendor */
-				"Identity-with-Emergency-Registration",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Associated-Identities */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				632,	/* Code */
-				10415,	/* Vendor */
-				"Associated-Identities",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Deregistration-Reason */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				615,	/* Code */
-				10415,	/* Vendor */
-				"Deregistration-Reason",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Charging-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				618,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SIP-Auth-Data-Item */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				612,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Auth-Data-Item",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Restoration-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				649,	/* Code */
-				10415,	/* Vendor */
-				"Restoration-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Supported-Applications */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				631,	/* Code */
-				10415,	/* Vendor */
-				"Supported-Applications",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SCSCF-Restoration-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				639,	/* Code */
-				10415,	/* Vendor */
-				"SCSCF-Restoration-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29229_avps_defs );
 
    /* Commands section */
    {
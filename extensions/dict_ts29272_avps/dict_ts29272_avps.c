@@ -43,6 +43,12 @@ const double ts29272_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,565 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29272_avps_defs[] = {
+	/* IMEI */
+	{ DICT_AVP, &(struct dict_avp_data){ 1402, 10415, "IMEI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Software-Version */
+	{ DICT_AVP, &(struct dict_avp_data){ 1403, 10415, "Software-Version", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* QoS-Subscribed */
+	{ DICT_AVP, &(struct dict_avp_data){ 1404, 10415, "QoS-Subscribed", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* ULR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1405, 10415, "ULR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* ULA-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1406, 10415, "ULA-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Visited-PLMN-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1407, 10415, "Visited-PLMN-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Number-Of-Requested-Vectors */
+	{ DICT_AVP, &(struct dict_avp_data){ 1410, 10415, "Number-Of-Requested-Vectors", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Re-Synchronization-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1411, 10415, "Re-Synchronization-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Immediate-Response-Preferred */
+	{ DICT_AVP, &(struct dict_avp_data){ 1412, 10415, "Immediate-Response-Preferred", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Network-Access-Mode */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Network-Access-Mode)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PACKET_AND_CIRCUIT", { .i32=0 } }, "3GPP/Enumerated(Network-Access-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Reserved", { .i32=1 } }, "3GPP/Enumerated(Network-Access-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ONLY_PACKET", { .i32=2 } }, "3GPP/Enumerated(Network-Access-Mode)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1417, 10415, "Network-Access-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Network-Access-Mode)" },
+	/* HPLMN-ODB */
+	{ DICT_AVP, &(struct dict_avp_data){ 1418, 10415, "HPLMN-ODB", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Item-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 1419, 10415, "Item-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Cancellation-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Cancellation-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MME_UPDATE_PROCEDURE", { .i32=0 } }, "3GPP/Enumerated(Cancellation-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SGSN_UPDATE_PROCEDURE", { .i32=1 } }, "3GPP/Enumerated(Cancellation-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUBSCRIPTION_WITHDRAWAL", { .i32=2 } }, "3GPP/Enumerated(Cancellation-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UPDATE_PROCEDURE_IWF", { .i32=3 } }, "3GPP/Enumerated(Cancellation-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INITIAL_ATTACH_PROCEDURE", { .i32=4 } }, "3GPP/Enumerated(Cancellation-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1420, 10415, "Cancellation-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Cancellation-Type)" },
+	/* DSR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1421, 10415, "DSR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* DSA-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1422, 10415, "DSA-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Context-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 1423, 10415, "Context-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Subscriber-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subscriber-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SERVICE_GRANTED", { .i32=0 } }, "3GPP/Enumerated(Subscriber-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "OPERATOR_DETERMINED_BARRING", { .i32=1 } }, "3GPP/Enumerated(Subscriber-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1424, 10415, "Subscriber-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Subscriber-Status)" },
+	/* Operator-Determined-Barring */
+	{ DICT_AVP, &(struct dict_avp_data){ 1425, 10415, "Operator-Determined-Barring", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Access-Restriction-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1426, 10415, "Access-Restriction-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* APN-OI-Replacement */
+	{ DICT_AVP, &(struct dict_avp_data){ 1427, 10415, "APN-OI-Replacement", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* All-APN-Configurations-Included-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(All-APN-Configurations-Included-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "All_APN_CONFIGURATIONS_INCLUDED", { .i32=0 } }, "3GPP/Enumerated(All-APN-Configurations-Included-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MODIFIED_ADDED_APN_CONFIGURATIONS_INCLUDED", { .i32=1 } }, "3GPP/Enumerated(All-APN-Configurations-Included-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1428, 10415, "All-APN-Configurations-Included-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(All-APN-Configurations-Included-Indicator)" },
+	/* VPLMN-Dynamic-Address-Allowed */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(VPLMN-Dynamic-Address-Allowed)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOTALLOWED", { .i32=0 } }, "3GPP/Enumerated(VPLMN-Dynamic-Address-Allowed)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ALLOWED", { .i32=1 } }, "3GPP/Enumerated(VPLMN-Dynamic-Address-Allowed)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1432, 10415, "VPLMN-Dynamic-Address-Allowed", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(VPLMN-Dynamic-Address-Allowed)" },
+	/* STN-SR */
+	{ DICT_AVP, &(struct dict_avp_data){ 1433, 10415, "STN-SR", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Alert-Reason */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Alert-Reason)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_PRESENT", { .i32=0 } }, "3GPP/Enumerated(Alert-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_MEMORY_AVAILABLE", { .i32=1 } }, "3GPP/Enumerated(Alert-Reason)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1434, 10415, "Alert-Reason", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Alert-Reason)" },
+	/* CSG-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1437, 10415, "CSG-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* PDN-GW-Allocation-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PDN-GW-Allocation-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "STATIC", { .i32=0 } }, "3GPP/Enumerated(PDN-GW-Allocation-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DYNAMIC", { .i32=1 } }, "3GPP/Enumerated(PDN-GW-Allocation-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1438, 10415, "PDN-GW-Allocation-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PDN-GW-Allocation-Type)" },
+	/* Expiration-Date */
+	{ DICT_AVP, &(struct dict_avp_data){ 1439, 10415, "Expiration-Date", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* RAT-Frequency-Selection-Priority-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1440, 10415, "RAT-Frequency-Selection-Priority-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* IDA-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1441, 10415, "IDA-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* PUA-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1442, 10415, "PUA-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* NOR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1443, 10415, "NOR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* User-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1444, 10415, "User-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Equipment-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Equipment-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WHITELISTED", { .i32=0 } }, "3GPP/Enumerated(Equipment-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BLACKLISTED", { .i32=1 } }, "3GPP/Enumerated(Equipment-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GREYLISTED", { .i32=2 } }, "3GPP/Enumerated(Equipment-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1445, 10415, "Equipment-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Equipment-Status)" },
+	/* Regional-Subscription-Zone-Code */
+	{ DICT_AVP, &(struct dict_avp_data){ 1446, 10415, "Regional-Subscription-Zone-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* RAND */
+	{ DICT_AVP, &(struct dict_avp_data){ 1447, 10415, "RAND", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* XRES */
+	{ DICT_AVP, &(struct dict_avp_data){ 1448, 10415, "XRES", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* AUTN */
+	{ DICT_AVP, &(struct dict_avp_data){ 1449, 10415, "AUTN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* KASME */
+	{ DICT_AVP, &(struct dict_avp_data){ 1450, 10415, "KASME", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Trace-Collection-Entity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1452, 10415, "Trace-Collection-Entity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Kc */
+	{ DICT_AVP, &(struct dict_avp_data){ 1453, 10415, "Kc", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SRES */
+	{ DICT_AVP, &(struct dict_avp_data){ 1454, 10415, "SRES", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* PDN-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PDN-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPv4", { .i32=0 } }, "3GPP/Enumerated(PDN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPv6", { .i32=1 } }, "3GPP/Enumerated(PDN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPv4v6", { .i32=2 } }, "3GPP/Enumerated(PDN-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPv4_OR_IPv6", { .i32=3 } }, "3GPP/Enumerated(PDN-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1456, 10415, "PDN-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PDN-Type)" },
+	/* Roaming-Restricted-Due-To-Unsupported-Feature */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Roaming-Restricted-Due-To-Unsupported-Feature)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Roaming_Restricted_Due_To_Unsupported_Feature", { .i32=0 } }, "3GPP/Enumerated(Roaming-Restricted-Due-To-Unsupported-Feature)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1457, 10415, "Roaming-Restricted-Due-To-Unsupported-Feature", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Roaming-Restricted-Due-To-Unsupported-Feature)" },
+	/* Trace-Reference */
+	{ DICT_AVP, &(struct dict_avp_data){ 1459, 10415, "Trace-Reference", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Trace-Depth */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Trace-Depth)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPRS_Subscription_Data", { .i32=72 } }, "3GPP/Enumerated(Trace-Depth)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Complete_Data_List_Included_Indicator", { .i32=73 } }, "3GPP/Enumerated(Trace-Depth)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1462, 10415, "Trace-Depth", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Trace-Depth)" },
+	/* Trace-NE-Type-List */
+	{ DICT_AVP, &(struct dict_avp_data){ 1463, 10415, "Trace-NE-Type-List", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Trace-Interface-List */
+	{ DICT_AVP, &(struct dict_avp_data){ 1464, 10415, "Trace-Interface-List", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Trace-Event-List */
+	{ DICT_AVP, &(struct dict_avp_data){ 1465, 10415, "Trace-Event-List", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* OMC-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1466, 10415, "OMC-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Complete-Data-List-Included-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Complete-Data-List-Included-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "All_PDP_CONTEXTS_INCLUDED", { .i32=0 } }, "3GPP/Enumerated(Complete-Data-List-Included-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CONTEXTS_INCLUDED", { .i32=1 } }, "3GPP/Enumerated(Complete-Data-List-Included-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1468, 10415, "Complete-Data-List-Included-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Complete-Data-List-Included-Indicator)" },
+	/* PDP-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 1470, 10415, "PDP-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* 3GPP2-MEID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1471, 10415, "3GPP2-MEID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* GMLC-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 1474, 10415, "GMLC-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SS-Code */
+	{ DICT_AVP, &(struct dict_avp_data){ 1476, 10415, "SS-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SS-Status */
+	{ DICT_AVP, &(struct dict_avp_data){ 1477, 10415, "SS-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Notification-To-UE-User */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Notification-To-UE-User)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOTIFY_LOCATION_ALLOWED", { .i32=0 } }, "3GPP/Enumerated(Notification-To-UE-User)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOTIFYANDVERIFY_LOCATION_ALLOWED_IF_NO_RESPONSE", { .i32=1 } }, "3GPP/Enumerated(Notification-To-UE-User)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOTIFYANDVERIFY_LOCATION_NOT_ALLOWED_IF_NO_RESPONSE", { .i32=2 } }, "3GPP/Enumerated(Notification-To-UE-User)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LOCATION_NOT_ALLOWED", { .i32=3 } }, "3GPP/Enumerated(Notification-To-UE-User)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1478, 10415, "Notification-To-UE-User", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Notification-To-UE-User)" },
+	/* Client-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1480, 10415, "Client-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* GMLC-Restriction */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(GMLC-Restriction)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GMLC_LIST", { .i32=0 } }, "3GPP/Enumerated(GMLC-Restriction)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HOME_COUNTRY", { .i32=1 } }, "3GPP/Enumerated(GMLC-Restriction)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1481, 10415, "GMLC-Restriction", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(GMLC-Restriction)" },
+	/* PLMN-Client */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PLMN-Client)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BROADCAST_SERVICE", { .i32=0 } }, "3GPP/Enumerated(PLMN-Client)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "O_AND_M_HPLMN", { .i32=1 } }, "3GPP/Enumerated(PLMN-Client)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "O_AND_M_VPLMN", { .i32=2 } }, "3GPP/Enumerated(PLMN-Client)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ANONYMOUS_LOCATION", { .i32=3 } }, "3GPP/Enumerated(PLMN-Client)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TARGET_UE_SUBSCRIBED_SERVICE", { .i32=4 } }, "3GPP/Enumerated(PLMN-Client)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1482, 10415, "PLMN-Client", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PLMN-Client)" },
+	/* ServiceTypeIdentity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1484, 10415, "ServiceTypeIdentity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* TS-Code */
+	{ DICT_AVP, &(struct dict_avp_data){ 1487, 10415, "TS-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SGSN-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 1489, 10415, "SGSN-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* IDR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1490, 10415, "IDR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* ICS-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(ICS-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FALSE", { .i32=0 } }, "3GPP/Enumerated(ICS-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TRUE", { .i32=1 } }, "3GPP/Enumerated(ICS-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1491, 10415, "ICS-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(ICS-Indicator)" },
+	/* IMS-Voice-Over-PS-Sessions-Supported */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(IMS-Voice-Over-PS-Sessions-Supported)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOT_SUPPORTED", { .i32=0 } }, "3GPP/Enumerated(IMS-Voice-Over-PS-Sessions-Supported)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUPPORTED", { .i32=1 } }, "3GPP/Enumerated(IMS-Voice-Over-PS-Sessions-Supported)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1492, 10415, "IMS-Voice-Over-PS-Sessions-Supported", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(IMS-Voice-Over-PS-Sessions-Supported)" },
+	/* Homogeneous-Support-of-IMS-Voice-Over-PS-Sessions */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Homogeneous-Support-of-IMS-Voice-Over-PS-Sessions)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOT_SUPPORTED", { .i32=0 } }, "3GPP/Enumerated(Homogeneous-Support-of-IMS-Voice-Over-PS-Sessions)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUPPORTED", { .i32=1 } }, "3GPP/Enumerated(Homogeneous-Support-of-IMS-Voice-Over-PS-Sessions)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1493, 10415, "Homogeneous-Support-of-IMS-Voice-Over-PS-Sessions", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Homogeneous-Support-of-IMS-Voice-Over-PS-Sessions)" },
+	/* Last-UE-Activity-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1494, 10415, "Last-UE-Activity-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* User-State */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(User-State)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DETACHED", { .i32=0 } }, "3GPP/Enumerated(User-State)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ATTACHED_NOT_REACHABLE_FOR_PAGING", { .i32=1 } }, "3GPP/Enumerated(User-State)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ATTACHED_REACHABLE_FOR_PAGING", { .i32=2 } }, "3GPP/Enumerated(User-State)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CONNECTED_NOT_REACHABLE_FOR_PAGING", { .i32=3 } }, "3GPP/Enumerated(User-State)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CONNECTED_REACHABLE_FOR_PAGING", { .i32=4 } }, "3GPP/Enumerated(User-State)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RESERVED", { .i32=5 } }, "3GPP/Enumerated(User-State)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1499, 10415, "User-State", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(User-State)" },
+	/* E-UTRAN-Cell-Global-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1602, 10415, "E-UTRAN-Cell-Global-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Tracking-Area-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1603, 10415, "Tracking-Area-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Cell-Global-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1604, 10415, "Cell-Global-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Routing-Area-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1605, 10415, "Routing-Area-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Location-Area-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1606, 10415, "Location-Area-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Service-Area-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1607, 10415, "Service-Area-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Geographical-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1608, 10415, "Geographical-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Geodetic-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1609, 10415, "Geodetic-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Current-Location-Retrieved */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Current-Location-Retrieved)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ACTIVE_LOCATION_RETRIEVAL", { .i32=0 } }, "3GPP/Enumerated(Current-Location-Retrieved)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1610, 10415, "Current-Location-Retrieved", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Current-Location-Retrieved)" },
+	/* Age-Of-Location-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1611, 10415, "Age-Of-Location-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Error-Diagnostic */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Error-Diagnostic)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GPRS_DATA_SUBSCRIBED", { .i32=0 } }, "3GPP/Enumerated(Error-Diagnostic)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_GPRS_DATA_SUBSCRIBED", { .i32=1 } }, "3GPP/Enumerated(Error-Diagnostic)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ODB_ALL_APN", { .i32=2 } }, "3GPP/Enumerated(Error-Diagnostic)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ODB_HPLMN_APN", { .i32=3 } }, "3GPP/Enumerated(Error-Diagnostic)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ODB_VPLMN_APN", { .i32=4 } }, "3GPP/Enumerated(Error-Diagnostic)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1614, 10415, "Error-Diagnostic", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Error-Diagnostic)" },
+	/* Ext-PDP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1621, 10415, "Ext-PDP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* UE-SRVCC-Capability */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(UE-SRVCC-Capability)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_SRVCC_NOT_SUPPORTED", { .i32=0 } }, "3GPP/Enumerated(UE-SRVCC-Capability)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_SRVCC_SUPPORTED", { .i32=1 } }, "3GPP/Enumerated(UE-SRVCC-Capability)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1615, 10415, "UE-SRVCC-Capability", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(UE-SRVCC-Capability)" },
+	/* MPS-Priority */
+	{ DICT_AVP, &(struct dict_avp_data){ 1616, 10415, "MPS-Priority", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* VPLMN-LIPA-Allowed */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(VPLMN-LIPA-Allowed)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LIPA_NOTALLOWED", { .i32=0 } }, "3GPP/Enumerated(VPLMN-LIPA-Allowed)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LIPA_ALLOWED", { .i32=1 } }, "3GPP/Enumerated(VPLMN-LIPA-Allowed)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1617, 10415, "VPLMN-LIPA-Allowed", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(VPLMN-LIPA-Allowed)" },
+	/* LIPA-Permission */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(LIPA-Permission)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LIPA_PROHIBITED", { .i32=0 } }, "3GPP/Enumerated(LIPA-Permission)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LIPA_ONLY", { .i32=1 } }, "3GPP/Enumerated(LIPA-Permission)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LIPA_CONDITIONAL", { .i32=2 } }, "3GPP/Enumerated(LIPA-Permission)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1618, 10415, "LIPA-Permission", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(LIPA-Permission)" },
+	/* Subscribed-Periodic-RAU-TAU-Timer */
+	{ DICT_AVP, &(struct dict_avp_data){ 1619, 10415, "Subscribed-Periodic-RAU-TAU-Timer", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Ext-PDP-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 1620, 10415, "Ext-PDP-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SIPTO-Permission */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SIPTO-Permission)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ALLOWED", { .i32=0 } }, "3GPP/Enumerated(SIPTO-Permission)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOTALLOWED", { .i32=1 } }, "3GPP/Enumerated(SIPTO-Permission)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1613, 10415, "SIPTO-Permission", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SIPTO-Permission)" },
+	/* Job-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Job-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Area_Scope", { .i32=138 } }, "3GPP/Enumerated(Job-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "List_Of_Measurements", { .i32=139 } }, "3GPP/Enumerated(Job-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Reporting_Trigger", { .i32=140 } }, "3GPP/Enumerated(Job-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Report_Interval", { .i32=141 } }, "3GPP/Enumerated(Job-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1623, 10415, "Job-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Job-Type)" },
+	/* List-Of-Measurements */
+	{ DICT_AVP, &(struct dict_avp_data){ 1625, 10415, "List-Of-Measurements", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Reporting-Trigger */
+	{ DICT_AVP, &(struct dict_avp_data){ 1626, 10415, "Reporting-Trigger", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Report-Interval */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Report-Interval)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Report_Amount", { .i32=142 } }, "3GPP/Enumerated(Report-Interval)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1627, 10415, "Report-Interval", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Report-Interval)" },
+	/* Report-Amount */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Report-Amount)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Event_Threshold_RSRP", { .i32=143 } }, "3GPP/Enumerated(Report-Amount)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Event_Threshold_RSRQ", { .i32=144 } }, "3GPP/Enumerated(Report-Amount)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Logging_Interval", { .i32=145 } }, "3GPP/Enumerated(Report-Amount)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1628, 10415, "Report-Amount", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Report-Amount)" },
+	/* Event-Threshold-RSRP */
+	{ DICT_AVP, &(struct dict_avp_data){ 1629, 10415, "Event-Threshold-RSRP", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Event-Threshold-RSRQ */
+	{ DICT_AVP, &(struct dict_avp_data){ 1630, 10415, "Event-Threshold-RSRQ", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Logging-Interval */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Logging-Interval)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Logging_Duration", { .i32=146 } }, "3GPP/Enumerated(Logging-Interval)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1631, 10415, "Logging-Interval", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Logging-Interval)" },
+	/* Logging-Duration */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Logging-Duration)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Relay_Node_Indicator", { .i32=147 } }, "3GPP/Enumerated(Logging-Duration)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1632, 10415, "Logging-Duration", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Logging-Duration)" },
+	/* Relay-Node-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Relay-Node-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOT_RELAY_NODE", { .i32=0 } }, "3GPP/Enumerated(Relay-Node-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RELAY_NODE", { .i32=1 } }, "3GPP/Enumerated(Relay-Node-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1633, 10415, "Relay-Node-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Relay-Node-Indicator)" },
+	/* MDT-User-Consent */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MDT-User-Consent)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CONSENT_NOT_GIVEN", { .i32=0 } }, "3GPP/Enumerated(MDT-User-Consent)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CONSENT_GIVEN", { .i32=1 } }, "3GPP/Enumerated(MDT-User-Consent)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1634, 10415, "MDT-User-Consent", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MDT-User-Consent)" },
+	/* PUR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1635, 10415, "PUR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Subscribed-VSRVCC */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subscribed-VSRVCC)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VSRVCC_SUBSCRIBED", { .i32=0 } }, "3GPP/Enumerated(Subscribed-VSRVCC)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1636, 10415, "Subscribed-VSRVCC", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Subscribed-VSRVCC)" },
+	/* CLR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1638, 10415, "CLR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* UVR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1639, 10415, "UVR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* UVA-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1640, 10415, "UVA-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Time-Zone */
+	{ DICT_AVP, &(struct dict_avp_data){ 1642, 10415, "Time-Zone", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* A-MSISDN */
+	{ DICT_AVP, &(struct dict_avp_data){ 1643, 10415, "A-MSISDN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MME-Number-for-MT-SMS */
+	{ DICT_AVP, &(struct dict_avp_data){ 1645, 10415, "MME-Number-for-MT-SMS", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SMS-Register-Request */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SMS-Register-Request)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SMS_REGISTRATION_REQUIRED", { .i32=0 } }, "3GPP/Enumerated(SMS-Register-Request)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SMS_REGISTRATION_NOT_PREFERRED", { .i32=1 } }, "3GPP/Enumerated(SMS-Register-Request)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_PREFERENCE", { .i32=2 } }, "3GPP/Enumerated(SMS-Register-Request)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1648, 10415, "SMS-Register-Request", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SMS-Register-Request)" },
+	/* Daylight-Saving-Time */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Daylight-Saving-Time)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO_ADJUSTMENT", { .i32=0 } }, "3GPP/Enumerated(Daylight-Saving-Time)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PLUS_ONE_HOUR_ADJUSTMENT", { .i32=1 } }, "3GPP/Enumerated(Daylight-Saving-Time)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PLUS_TWO_HOURS_ADJUSTMENT", { .i32=2 } }, "3GPP/Enumerated(Daylight-Saving-Time)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1650, 10415, "Daylight-Saving-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Daylight-Saving-Time)" },
+	/* Subscription-Data-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1654, 10415, "Subscription-Data-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Measurement-Period-LTE */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Measurement-Period-LTE)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Measurement_Period_UMTS", { .i32=167 } }, "3GPP/Enumerated(Measurement-Period-LTE)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1655, 10415, "Measurement-Period-LTE", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Measurement-Period-LTE)" },
+	/* Measurement-Period-UMTS */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Measurement-Period-UMTS)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Collection_Period_RRM_LTE", { .i32=168 } }, "3GPP/Enumerated(Measurement-Period-UMTS)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1656, 10415, "Measurement-Period-UMTS", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Measurement-Period-UMTS)" },
+	/* Collection-Period-RRM-LTE */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Collection-Period-RRM-LTE)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Collection_Period_RRM_UMTS", { .i32=169 } }, "3GPP/Enumerated(Collection-Period-RRM-LTE)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1657, 10415, "Collection-Period-RRM-LTE", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Collection-Period-RRM-LTE)" },
+	/* Collection-Period-RRM-UMTS */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Collection-Period-RRM-UMTS)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Positioning_Method", { .i32=170 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Measurement_Quantity", { .i32=171 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Event_Threshold_Event_1F", { .i32=172 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Event_Threshold_Event_1I", { .i32=173 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Restoration_Priority", { .i32=174 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SGs_MME_Identity", { .i32=175 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SIPTO_Local_Network_Permission", { .i32=176 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Coupled_Node_Diameter_ID", { .i32=177 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "OC_Supported_Features", { .i32=178 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "OC_OLR", { .i32=179 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ProSe_Subscription_Data", { .i32=180 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WLAN_offloadability", { .i32=181 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WLAN_offloadability_EUTRAN", { .i32=182 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "WLAN_offloadability_UTRAN", { .i32=183 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Reset_ID", { .i32=184 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MDT_Allowed_PLMN_Id", { .i32=185 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Adjacent_PLMNs", { .i32=186 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Adjacent_Access_Restriction_Data", { .i32=187 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DL_Buffering_Suggested_Packet_Count", { .i32=188 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IMSI_Group_Id", { .i32=189 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Group_Service_Id", { .i32=190 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Group_PLMN_Id", { .i32=191 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Local_Group_Id", { .i32=192 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AESE_Communication_Pattern", { .i32=193 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Communication_Pattern_Set", { .i32=194 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Monitoring_Event_Configuration", { .i32=195 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Monitoring_Event_Report", { .i32=196 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_Reachability_Configuration", { .i32=197 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "eNodeB_Id", { .i32=198 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Supported_Services", { .i32=199 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Supported_Monitoring_Events", { .i32=200 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AIR_Flags", { .i32=201 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_Usage_Type", { .i32=202 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DRMP", { .i32=203 } }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1658, 10415, "Collection-Period-RRM-UMTS", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Collection-Period-RRM-UMTS)" },
+	/* Positioning-Method */
+	{ DICT_AVP, &(struct dict_avp_data){ 1659, 10415, "Positioning-Method", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Measurement-Quantity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1660, 10415, "Measurement-Quantity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Event-Threshold-Event-1F */
+	{ DICT_AVP, &(struct dict_avp_data){ 1661, 10415, "Event-Threshold-Event-1F", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, NULL },
+	/* Event-Threshold-Event-1I */
+	{ DICT_AVP, &(struct dict_avp_data){ 1662, 10415, "Event-Threshold-Event-1I", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, NULL },
+	/* Restoration-Priority */
+	{ DICT_AVP, &(struct dict_avp_data){ 1663, 10415, "Restoration-Priority", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SGs-MME-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1664, 10415, "SGs-MME-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* SIPTO-Local-Network-Permission */
+	{ DICT_AVP, &(struct dict_avp_data){ 1665, 10415, "SIPTO-Local-Network-Permission", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Coupled-Node-Diameter-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1666, 10415, "Coupled-Node-Diameter-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* WLAN-offloadability-EUTRAN */
+	{ DICT_AVP, &(struct dict_avp_data){ 1668, 10415, "WLAN-offloadability-EUTRAN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* WLAN-offloadability-UTRAN */
+	{ DICT_AVP, &(struct dict_avp_data){ 1669, 10415, "WLAN-offloadability-UTRAN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Reset-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1670, 10415, "Reset-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MDT-Allowed-PLMN-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1671, 10415, "MDT-Allowed-PLMN-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* DL-Buffering-Suggested-Packet-Count */
+	{ DICT_AVP, &(struct dict_avp_data){ 1674, 10415, "DL-Buffering-Suggested-Packet-Count", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, NULL },
+	/* Group-Service-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1676, 10415, "Group-Service-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Group-PLMN-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1677, 10415, "Group-PLMN-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Local-Group-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1678, 10415, "Local-Group-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* AIR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1679, 10415, "AIR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* UE-Usage-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 1680, 10415, "UE-Usage-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Non-IP-PDN-Type-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Non-IP-PDN-Type-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MAINTAIN_PDN_CONNECTION", { .i32=0 } }, "3GPP/Enumerated(Non-IP-PDN-Type-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DISCONNECT_PDN_CONNECTION_WITH_REACTIVATION_REQUEST", { .i32=1 } }, "3GPP/Enumerated(Non-IP-PDN-Type-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DISCONNECT_PDN_CONNECTION_WITHOUT_REACTIVATION_REQUEST", { .i32=2 } }, "3GPP/Enumerated(Non-IP-PDN-Type-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1681, 10415, "Non-IP-PDN-Type-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Non-IP-PDN-Type-Indicator)" },
+	/* Non-IP-Data-Delivery-Mechanism */
+	{ DICT_AVP, &(struct dict_avp_data){ 1682, 10415, "Non-IP-Data-Delivery-Mechanism", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Additional-Context-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 1683, 10415, "Additional-Context-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SCEF-Realm */
+	{ DICT_AVP, &(struct dict_avp_data){ 1684, 10415, "SCEF-Realm", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* Preferred-Data-Mode */
+	{ DICT_AVP, &(struct dict_avp_data){ 1686, 10415, "Preferred-Data-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* V2X-Permission */
+	{ DICT_AVP, &(struct dict_avp_data){ 1689, 10415, "V2X-Permission", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* PDN-Connection-Continuity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1690, 10415, "PDN-Connection-Continuity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* eDRX-Cycle-Length-Value */
+	{ DICT_AVP, &(struct dict_avp_data){ 1692, 10415, "eDRX-Cycle-Length-Value", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* UE-PC5-AMBR */
+	{ DICT_AVP, &(struct dict_avp_data){ 1693, 10415, "UE-PC5-AMBR", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MBSFN-Area-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1695, 10415, "MBSFN-Area-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Carrier-Frequency */
+	{ DICT_AVP, &(struct dict_avp_data){ 1696, 10415, "Carrier-Frequency", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* RDS-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(RDS-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DISABLED", { .i32=0 } }, "3GPP/Enumerated(RDS-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ENABLED", { .i32=1 } }, "3GPP/Enumerated(RDS-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1697, 10415, "RDS-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(RDS-Indicator)" },
+	/* Core-Network-Restrictions */
+	{ DICT_AVP, &(struct dict_avp_data){ 1704, 10415, "Core-Network-Restrictions", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Interworking-5GS-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Interworking-5GS-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOT_SUBSCRIBED", { .i32=0 } }, "3GPP/Enumerated(Interworking-5GS-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUBSCRIBED", { .i32=1 } }, "3GPP/Enumerated(Interworking-5GS-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1706, 10415, "Interworking-5GS-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Interworking-5GS-Indicator)" },
+	/* V2X-Subscription-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1688, 10415, "V2X-Subscription-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* E-UTRAN-Vector */
+	{ DICT_AVP, &(struct dict_avp_data){ 1414, 10415, "E-UTRAN-Vector", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* AMBR */
+	{ DICT_AVP, &(struct dict_avp_data){ 1435, 10415, "AMBR", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Adjacent-Access-Restriction-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1673, 10415, "Adjacent-Access-Restriction-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* GERAN-Vector */
+	{ DICT_AVP, &(struct dict_avp_data){ 1416, 10415, "GERAN-Vector", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* eDRX-Cycle-Length */
+	{ DICT_AVP, &(struct dict_avp_data){ 1691, 10415, "eDRX-Cycle-Length", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Area-Scope */
+	{ DICT_AVP, &(struct dict_avp_data){ 1624, 10415, "Area-Scope", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Call-Barring-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1488, 10415, "Call-Barring-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* CSG-Subscription-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1436, 10415, "CSG-Subscription-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* VPLMN-CSG-Subscription-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1641, 10415, "VPLMN-CSG-Subscription-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MBSFN-Area */
+	{ DICT_AVP, &(struct dict_avp_data){ 1694, 10415, "MBSFN-Area", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* MO-LR */
+	{ DICT_AVP, &(struct dict_avp_data){ 1485, 10415, "MO-LR", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* WLAN-offloadability */
+	{ DICT_AVP, &(struct dict_avp_data){ 1667, 10415, "WLAN-offloadability", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Equivalent-PLMN-List */
+	{ DICT_AVP, &(struct dict_avp_data){ 1637, 10415, "Equivalent-PLMN-List", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* UTRAN-Vector */
+	{ DICT_AVP, &(struct dict_avp_data){ 1415, 10415, "UTRAN-Vector", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Local-Time-Zone */
+	{ DICT_AVP, &(struct dict_avp_data){ 1649, 10415, "Local-Time-Zone", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* IMSI-Group-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1675, 10415, "IMSI-Group-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Terminal-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1401, 10415, "Terminal-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Teleservice-List */
+	{ DICT_AVP, &(struct dict_avp_data){ 1486, 10415, "Teleservice-List", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Service-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 1483, 10415, "Service-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Requested-UTRAN-GERAN-Authentication-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1409, 10415, "Requested-UTRAN-GERAN-Authentication-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Subscription-Data-Deletion */
+	{ DICT_AVP, &(struct dict_avp_data){ 1685, 10415, "Subscription-Data-Deletion", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* MME-User-State */
+	{ DICT_AVP, &(struct dict_avp_data){ 1497, 10415, "MME-User-State", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Requested-EUTRAN-Authentication-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1408, 10415, "Requested-EUTRAN-Authentication-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Adjacent-PLMNs */
+	{ DICT_AVP, &(struct dict_avp_data){ 1672, 10415, "Adjacent-PLMNs", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* SGSN-User-State */
+	{ DICT_AVP, &(struct dict_avp_data){ 1498, 10415, "SGSN-User-State", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* External-Client */
+	{ DICT_AVP, &(struct dict_avp_data){ 1479, 10415, "External-Client", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* EPS-User-State */
+	{ DICT_AVP, &(struct dict_avp_data){ 1495, 10415, "EPS-User-State", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* SGSN-Location-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1601, 10415, "SGSN-Location-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* LCS-PrivacyException */
+	{ DICT_AVP, &(struct dict_avp_data){ 1475, 10415, "LCS-PrivacyException", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MDT-Configuration */
+	{ DICT_AVP, &(struct dict_avp_data){ 1622, 10415, "MDT-Configuration", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Authentication-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1413, 10415, "Authentication-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Specific-APN-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1472, 10415, "Specific-APN-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* EPS-Subscribed-QoS-Profile */
+	{ DICT_AVP, &(struct dict_avp_data){ 1431, 10415, "EPS-Subscribed-QoS-Profile", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MME-Location-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1600, 10415, "MME-Location-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* PDP-Context */
+	{ DICT_AVP, &(struct dict_avp_data){ 1469, 10415, "PDP-Context", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Emergency-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1687, 10415, "Emergency-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* GPRS-Subscription-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1467, 10415, "GPRS-Subscription-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* APN-Configuration */
+	{ DICT_AVP, &(struct dict_avp_data){ 1430, 10415, "APN-Configuration", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* EPS-Location-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1496, 10415, "EPS-Location-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Trace-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1458, 10415, "Trace-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Active-APN */
+	{ DICT_AVP, &(struct dict_avp_data){ 1612, 10415, "Active-APN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* LCS-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1473, 10415, "LCS-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* APN-Configuration-Profile */
+	{ DICT_AVP, &(struct dict_avp_data){ 1429, 10415, "APN-Configuration-Profile", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Subscription-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1400, 10415, "Subscription-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29272_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,2827 +675,7 @@ static int dict_ts29272_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* IMEI */
-		{
-			struct dict_avp_data data = {
-				1402,	/* Code */
-				10415,	/* Vendor */
-				"IMEI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Software-Version */
-		{
-			struct dict_avp_data data = {
-				1403,	/* Code */
-				10415,	/* Vendor */
-				"Software-Version",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* QoS-Subscribed */
-		{
-			struct dict_avp_data data = {
-				1404,	/* Code */
-				10415,	/* Vendor */
-				"QoS-Subscribed",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ULR-Flags */
-		{
-			struct dict_avp_data data = {
-				1405,	/* Code */
-				10415,	/* Vendor */
-				"ULR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ULA-Flags */
-		{
-			struct dict_avp_data data = {
-				1406,	/* Code */
-				10415,	/* Vendor */
-				"ULA-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Visited-PLMN-Id */
-		{
-			struct dict_avp_data data = {
-				1407,	/* Code */
-				10415,	/* Vendor */
-				"Visited-PLMN-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Number-Of-Requested-Vectors */
-		{
-			struct dict_avp_data data = {
-				1410,	/* Code */
-				10415,	/* Vendor */
-				"Number-Of-Requested-Vectors",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Re-Synchronization-Info */
-		{
-			struct dict_avp_data data = {
-				1411,	/* Code */
-				10415,	/* Vendor */
-				"Re-Synchronization-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Immediate-Response-Preferred */
-		{
-			struct dict_avp_data data = {
-				1412,	/* Code */
-				10415,	/* Vendor */
-				"Immediate-Response-Preferred",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Network-Access-Mode */
-		{
-			struct dict_avp_data data = {
-				1417,	/* Code */
-				10415,	/* Vendor */
-				"Network-Access-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Network-Access-Mode)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PACKET_AND_CIRCUIT", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Reserved", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "ONLY_PACKET", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* HPLMN-ODB */
-		{
-			struct dict_avp_data data = {
-				1418,	/* Code */
-				10415,	/* Vendor */
-				"HPLMN-ODB",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Item-Number */
-		{
-			struct dict_avp_data data = {
-				1419,	/* Code */
-				10415,	/* Vendor */
-				"Item-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Cancellation-Type */
-		{
-			struct dict_avp_data data = {
-				1420,	/* Code */
-				10415,	/* Vendor */
-				"Cancellation-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Cancellation-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "MME_UPDATE_PROCEDURE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SGSN_UPDATE_PROCEDURE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "SUBSCRIPTION_WITHDRAWAL", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "UPDATE_PROCEDURE_IWF", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "INITIAL_ATTACH_PROCEDURE", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* DSR-Flags */
-		{
-			struct dict_avp_data data = {
-				1421,	/* Code */
-				10415,	/* Vendor */
-				"DSR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* DSA-Flags */
-		{
-			struct dict_avp_data data = {
-				1422,	/* Code */
-				10415,	/* Vendor */
-				"DSA-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Context-Identifier */
-		{
-			struct dict_avp_data data = {
-				1423,	/* Code */
-				10415,	/* Vendor */
-				"Context-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Subscriber-Status */
-		{
-			struct dict_avp_data data = {
-				1424,	/* Code */
-				10415,	/* Vendor */
-				"Subscriber-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subscriber-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SERVICE_GRANTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "OPERATOR_DETERMINED_BARRING", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Operator-Determined-Barring */
-		{
-			struct dict_avp_data data = {
-				1425,	/* Code */
-				10415,	/* Vendor */
-				"Operator-Determined-Barring",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Access-Restriction-Data */
-		{
-			struct dict_avp_data data = {
-				1426,	/* Code */
-				10415,	/* Vendor */
-				"Access-Restriction-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* APN-OI-Replacement */
-		{
-			struct dict_avp_data data = {
-				1427,	/* Code */
-				10415,	/* Vendor */
-				"APN-OI-Replacement",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* All-APN-Configurations-Included-Indicator */
-		{
-			struct dict_avp_data data = {
-				1428,	/* Code */
-				10415,	/* Vendor */
-				"All-APN-Configurations-Included-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(All-APN-Configurations-Included-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "All_APN_CONFIGURATIONS_INCLUDED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "MODIFIED_ADDED_APN_CONFIGURATIONS_INCLUDED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* VPLMN-Dynamic-Address-Allowed */
-		{
-			struct dict_avp_data data = {
-				1432,	/* Code */
-				10415,	/* Vendor */
-				"VPLMN-Dynamic-Address-Allowed",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(VPLMN-Dynamic-Address-Allowed)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NOTALLOWED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ALLOWED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* STN-SR */
-		{
-			struct dict_avp_data data = {
-				1433,	/* Code */
-				10415,	/* Vendor */
-				"STN-SR",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Alert-Reason */
-		{
-			struct dict_avp_data data = {
-				1434,	/* Code */
-				10415,	/* Vendor */
-				"Alert-Reason",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Alert-Reason)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UE_PRESENT", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "UE_MEMORY_AVAILABLE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CSG-Id */
-		{
-			struct dict_avp_data data = {
-				1437,	/* Code */
-				10415,	/* Vendor */
-				"CSG-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* PDN-GW-Allocation-Type */
-		{
-			struct dict_avp_data data = {
-				1438,	/* Code */
-				10415,	/* Vendor */
-				"PDN-GW-Allocation-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PDN-GW-Allocation-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "STATIC", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "DYNAMIC", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Expiration-Date */
-		{
-			struct dict_avp_data data = {
-				1439,	/* Code */
-				10415,	/* Vendor */
-				"Expiration-Date",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* RAT-Frequency-Selection-Priority-ID */
-		{
-			struct dict_avp_data data = {
-				1440,	/* Code */
-				10415,	/* Vendor */
-				"RAT-Frequency-Selection-Priority-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* IDA-Flags */
-		{
-			struct dict_avp_data data = {
-				1441,	/* Code */
-				10415,	/* Vendor */
-				"IDA-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* PUA-Flags */
-		{
-			struct dict_avp_data data = {
-				1442,	/* Code */
-				10415,	/* Vendor */
-				"PUA-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* NOR-Flags */
-		{
-			struct dict_avp_data data = {
-				1443,	/* Code */
-				10415,	/* Vendor */
-				"NOR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Id */
-		{
-			struct dict_avp_data data = {
-				1444,	/* Code */
-				10415,	/* Vendor */
-				"User-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Equipment-Status */
-		{
-			struct dict_avp_data data = {
-				1445,	/* Code */
-				10415,	/* Vendor */
-				"Equipment-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Equipment-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "WHITELISTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "BLACKLISTED", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "GREYLISTED", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Regional-Subscription-Zone-Code */
-		{
-			struct dict_avp_data data = {
-				1446,	/* Code */
-				10415,	/* Vendor */
-				"Regional-Subscription-Zone-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* RAND */
-		{
-			struct dict_avp_data data = {
-				1447,	/* Code */
-				10415,	/* Vendor */
-				"RAND",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* XRES */
-		{
-			struct dict_avp_data data = {
-				1448,	/* Code */
-				10415,	/* Vendor */
-				"XRES",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* AUTN */
-		{
-			struct dict_avp_data data = {
-				1449,	/* Code */
-				10415,	/* Vendor */
-				"AUTN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* KASME */
-		{
-			struct dict_avp_data data = {
-				1450,	/* Code */
-				10415,	/* Vendor */
-				"KASME",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Trace-Collection-Entity */
-		{
-			struct dict_avp_data data = {
-				1452,	/* Code */
-				10415,	/* Vendor */
-				"Trace-Collection-Entity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Kc */
-		{
-			struct dict_avp_data data = {
-				1453,	/* Code */
-				10415,	/* Vendor */
-				"Kc",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SRES */
-		{
-			struct dict_avp_data data = {
-				1454,	/* Code */
-				10415,	/* Vendor */
-				"SRES",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* PDN-Type */
-		{
-			struct dict_avp_data data = {
-				1456,	/* Code */
-				10415,	/* Vendor */
-				"PDN-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PDN-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "IPv4", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "IPv6", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "IPv4v6", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "IPv4_OR_IPv6", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Roaming-Restricted-Due-To-Unsupported-Feature */
-		{
-			struct dict_avp_data data = {
-				1457,	/* Code */
-				10415,	/* Vendor */
-				"Roaming-Restricted-Due-To-Unsupported-Feature",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Roaming-Restricted-Due-To-Unsupported-Feature)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Roaming_Restricted_Due_To_Unsupported_Feature", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Trace-Reference */
-		{
-			struct dict_avp_data data = {
-				1459,	/* Code */
-				10415,	/* Vendor */
-				"Trace-Reference",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Trace-Depth */
-		{
-			struct dict_avp_data data = {
-				1462,	/* Code */
-				10415,	/* Vendor */
-				"Trace-Depth",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Trace-Depth)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "GPRS_Subscription_Data", { .i32=72 }};
-			struct dict_enumval_data        t_2 = { "Complete_Data_List_Included_Indicator", { .i32=73 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Trace-NE-Type-List */
-		{
-			struct dict_avp_data data = {
-				1463,	/* Code */
-				10415,	/* Vendor */
-				"Trace-NE-Type-List",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Trace-Interface-List */
-		{
-			struct dict_avp_data data = {
-				1464,	/* Code */
-				10415,	/* Vendor */
-				"Trace-Interface-List",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Trace-Event-List */
-		{
-			struct dict_avp_data data = {
-				1465,	/* Code */
-				10415,	/* Vendor */
-				"Trace-Event-List",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* OMC-Id */
-		{
-			struct dict_avp_data data = {
-				1466,	/* Code */
-				10415,	/* Vendor */
-				"OMC-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Complete-Data-List-Included-Indicator */
-		{
-			struct dict_avp_data data = {
-				1468,	/* Code */
-				10415,	/* Vendor */
-				"Complete-Data-List-Included-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Complete-Data-List-Included-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "All_PDP_CONTEXTS_INCLUDED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CONTEXTS_INCLUDED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PDP-Type */
-		{
-			struct dict_avp_data data = {
-				1470,	/* Code */
-				10415,	/* Vendor */
-				"PDP-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* 3GPP2-MEID */
-		{
-			struct dict_avp_data data = {
-				1471,	/* Code */
-				10415,	/* Vendor */
-				"3GPP2-MEID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* GMLC-Number */
-		{
-			struct dict_avp_data data = {
-				1474,	/* Code */
-				10415,	/* Vendor */
-				"GMLC-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SS-Code */
-		{
-			struct dict_avp_data data = {
-				1476,	/* Code */
-				10415,	/* Vendor */
-				"SS-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SS-Status */
-		{
-			struct dict_avp_data data = {
-				1477,	/* Code */
-				10415,	/* Vendor */
-				"SS-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Notification-To-UE-User */
-		{
-			struct dict_avp_data data = {
-				1478,	/* Code */
-				10415,	/* Vendor */
-				"Notification-To-UE-User",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Notification-To-UE-User)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NOTIFY_LOCATION_ALLOWED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NOTIFYANDVERIFY_LOCATION_ALLOWED_IF_NO_RESPONSE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "NOTIFYANDVERIFY_LOCATION_NOT_ALLOWED_IF_NO_RESPONSE", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "LOCATION_NOT_ALLOWED", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Client-Identity */
-		{
-			struct dict_avp_data data = {
-				1480,	/* Code */
-				10415,	/* Vendor */
-				"Client-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* GMLC-Restriction */
-		{
-			struct dict_avp_data data = {
-				1481,	/* Code */
-				10415,	/* Vendor */
-				"GMLC-Restriction",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(GMLC-Restriction)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "GMLC_LIST", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "HOME_COUNTRY", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PLMN-Client */
-		{
-			struct dict_avp_data data = {
-				1482,	/* Code */
-				10415,	/* Vendor */
-				"PLMN-Client",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PLMN-Client)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "BROADCAST_SERVICE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "O_AND_M_HPLMN", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "O_AND_M_VPLMN", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "ANONYMOUS_LOCATION", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "TARGET_UE_SUBSCRIBED_SERVICE", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ServiceTypeIdentity */
-		{
-			struct dict_avp_data data = {
-				1484,	/* Code */
-				10415,	/* Vendor */
-				"ServiceTypeIdentity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TS-Code */
-		{
-			struct dict_avp_data data = {
-				1487,	/* Code */
-				10415,	/* Vendor */
-				"TS-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SGSN-Number */
-		{
-			struct dict_avp_data data = {
-				1489,	/* Code */
-				10415,	/* Vendor */
-				"SGSN-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* IDR-Flags */
-		{
-			struct dict_avp_data data = {
-				1490,	/* Code */
-				10415,	/* Vendor */
-				"IDR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ICS-Indicator */
-		{
-			struct dict_avp_data data = {
-				1491,	/* Code */
-				10415,	/* Vendor */
-				"ICS-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(ICS-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "FALSE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "TRUE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* IMS-Voice-Over-PS-Sessions-Supported */
-		{
-			struct dict_avp_data data = {
-				1492,	/* Code */
-				10415,	/* Vendor */
-				"IMS-Voice-Over-PS-Sessions-Supported",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(IMS-Voice-Over-PS-Sessions-Supported)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NOT_SUPPORTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Homogeneous-Support-of-IMS-Voice-Over-PS-Sessions */
-		{
-			struct dict_avp_data data = {
-				1493,	/* Code */
-				10415,	/* Vendor */
-				"Homogeneous-Support-of-IMS-Voice-Over-PS-Sessions",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Homogeneous-Support-of-IMS-Voice-Over-PS-Sessions)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NOT_SUPPORTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Last-UE-Activity-Time */
-		{
-			struct dict_avp_data data = {
-				1494,	/* Code */
-				10415,	/* Vendor */
-				"Last-UE-Activity-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* User-State */
-		{
-			struct dict_avp_data data = {
-				1499,	/* Code */
-				10415,	/* Vendor */
-				"User-State",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(User-State)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DETACHED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ATTACHED_NOT_REACHABLE_FOR_PAGING", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "ATTACHED_REACHABLE_FOR_PAGING", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "CONNECTED_NOT_REACHABLE_FOR_PAGING", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "CONNECTED_REACHABLE_FOR_PAGING", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "RESERVED", { .i32=5 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* E-UTRAN-Cell-Global-Identity */
-		{
-			struct dict_avp_data data = {
-				1602,	/* Code */
-				10415,	/* Vendor */
-				"E-UTRAN-Cell-Global-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Tracking-Area-Identity */
-		{
-			struct dict_avp_data data = {
-				1603,	/* Code */
-				10415,	/* Vendor */
-				"Tracking-Area-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Cell-Global-Identity */
-		{
-			struct dict_avp_data data = {
-				1604,	/* Code */
-				10415,	/* Vendor */
-				"Cell-Global-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Routing-Area-Identity */
-		{
-			struct dict_avp_data data = {
-				1605,	/* Code */
-				10415,	/* Vendor */
-				"Routing-Area-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Location-Area-Identity */
-		{
-			struct dict_avp_data data = {
-				1606,	/* Code */
-				10415,	/* Vendor */
-				"Location-Area-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Service-Area-Identity */
-		{
-			struct dict_avp_data data = {
-				1607,	/* Code */
-				10415,	/* Vendor */
-				"Service-Area-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Geographical-Information */
-		{
-			struct dict_avp_data data = {
-				1608,	/* Code */
-				10415,	/* Vendor */
-				"Geographical-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Geodetic-Information */
-		{
-			struct dict_avp_data data = {
-				1609,	/* Code */
-				10415,	/* Vendor */
-				"Geodetic-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Current-Location-Retrieved */
-		{
-			struct dict_avp_data data = {
-				1610,	/* Code */
-				10415,	/* Vendor */
-				"Current-Location-Retrieved",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Current-Location-Retrieved)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ACTIVE_LOCATION_RETRIEVAL", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Age-Of-Location-Information */
-		{
-			struct dict_avp_data data = {
-				1611,	/* Code */
-				10415,	/* Vendor */
-				"Age-Of-Location-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Error-Diagnostic */
-		{
-			struct dict_avp_data data = {
-				1614,	/* Code */
-				10415,	/* Vendor */
-				"Error-Diagnostic",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Error-Diagnostic)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "GPRS_DATA_SUBSCRIBED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NO_GPRS_DATA_SUBSCRIBED", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "ODB_ALL_APN", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "ODB_HPLMN_APN", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "ODB_VPLMN_APN", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Ext-PDP-Address */
-		{
-			struct dict_avp_data data = {
-				1621,	/* Code */
-				10415,	/* Vendor */
-				"Ext-PDP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* UE-SRVCC-Capability */
-		{
-			struct dict_avp_data data = {
-				1615,	/* Code */
-				10415,	/* Vendor */
-				"UE-SRVCC-Capability",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(UE-SRVCC-Capability)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UE_SRVCC_NOT_SUPPORTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "UE_SRVCC_SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MPS-Priority */
-		{
-			struct dict_avp_data data = {
-				1616,	/* Code */
-				10415,	/* Vendor */
-				"MPS-Priority",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* VPLMN-LIPA-Allowed */
-		{
-			struct dict_avp_data data = {
-				1617,	/* Code */
-				10415,	/* Vendor */
-				"VPLMN-LIPA-Allowed",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(VPLMN-LIPA-Allowed)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "LIPA_NOTALLOWED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "LIPA_ALLOWED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* LIPA-Permission */
-		{
-			struct dict_avp_data data = {
-				1618,	/* Code */
-				10415,	/* Vendor */
-				"LIPA-Permission",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(LIPA-Permission)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "LIPA_PROHIBITED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "LIPA_ONLY", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "LIPA_CONDITIONAL", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Subscribed-Periodic-RAU-TAU-Timer */
-		{
-			struct dict_avp_data data = {
-				1619,	/* Code */
-				10415,	/* Vendor */
-				"Subscribed-Periodic-RAU-TAU-Timer",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Ext-PDP-Type */
-		{
-			struct dict_avp_data data = {
-				1620,	/* Code */
-				10415,	/* Vendor */
-				"Ext-PDP-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SIPTO-Permission */
-		{
-			struct dict_avp_data data = {
-				1613,	/* Code */
-				10415,	/* Vendor */
-				"SIPTO-Permission",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SIPTO-Permission)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ALLOWED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NOTALLOWED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Job-Type */
-		{
-			struct dict_avp_data data = {
-				1623,	/* Code */
-				10415,	/* Vendor */
-				"Job-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Job-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Area_Scope", { .i32=138 }};
-			struct dict_enumval_data        t_2 = { "List_Of_Measurements", { .i32=139 }};
-			struct dict_enumval_data        t_3 = { "Reporting_Trigger", { .i32=140 }};
-			struct dict_enumval_data        t_4 = { "Report_Interval", { .i32=141 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* List-Of-Measurements */
-		{
-			struct dict_avp_data data = {
-				1625,	/* Code */
-				10415,	/* Vendor */
-				"List-Of-Measurements",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Reporting-Trigger */
-		{
-			struct dict_avp_data data = {
-				1626,	/* Code */
-				10415,	/* Vendor */
-				"Reporting-Trigger",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Report-Interval */
-		{
-			struct dict_avp_data data = {
-				1627,	/* Code */
-				10415,	/* Vendor */
-				"Report-Interval",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Report-Interval)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Report_Amount", { .i32=142 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Report-Amount */
-		{
-			struct dict_avp_data data = {
-				1628,	/* Code */
-				10415,	/* Vendor */
-				"Report-Amount",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Report-Amount)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Event_Threshold_RSRP", { .i32=143 }};
-			struct dict_enumval_data        t_2 = { "Event_Threshold_RSRQ", { .i32=144 }};
-			struct dict_enumval_data        t_3 = { "Logging_Interval", { .i32=145 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Event-Threshold-RSRP */
-		{
-			struct dict_avp_data data = {
-				1629,	/* Code */
-				10415,	/* Vendor */
-				"Event-Threshold-RSRP",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Event-Threshold-RSRQ */
-		{
-			struct dict_avp_data data = {
-				1630,	/* Code */
-				10415,	/* Vendor */
-				"Event-Threshold-RSRQ",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Logging-Interval */
-		{
-			struct dict_avp_data data = {
-				1631,	/* Code */
-				10415,	/* Vendor */
-				"Logging-Interval",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Logging-Interval)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Logging_Duration", { .i32=146 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Logging-Duration */
-		{
-			struct dict_avp_data data = {
-				1632,	/* Code */
-				10415,	/* Vendor */
-				"Logging-Duration",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Logging-Duration)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Relay_Node_Indicator", { .i32=147 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Relay-Node-Indicator */
-		{
-			struct dict_avp_data data = {
-				1633,	/* Code */
-				10415,	/* Vendor */
-				"Relay-Node-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Relay-Node-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NOT_RELAY_NODE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "RELAY_NODE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MDT-User-Consent */
-		{
-			struct dict_avp_data data = {
-				1634,	/* Code */
-				10415,	/* Vendor */
-				"MDT-User-Consent",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MDT-User-Consent)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CONSENT_NOT_GIVEN", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CONSENT_GIVEN", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PUR-Flags */
-		{
-			struct dict_avp_data data = {
-				1635,	/* Code */
-				10415,	/* Vendor */
-				"PUR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Subscribed-VSRVCC */
-		{
-			struct dict_avp_data data = {
-				1636,	/* Code */
-				10415,	/* Vendor */
-				"Subscribed-VSRVCC",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subscribed-VSRVCC)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "VSRVCC_SUBSCRIBED", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CLR-Flags */
-		{
-			struct dict_avp_data data = {
-				1638,	/* Code */
-				10415,	/* Vendor */
-				"CLR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* UVR-Flags */
-		{
-			struct dict_avp_data data = {
-				1639,	/* Code */
-				10415,	/* Vendor */
-				"UVR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* UVA-Flags */
-		{
-			struct dict_avp_data data = {
-				1640,	/* Code */
-				10415,	/* Vendor */
-				"UVA-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Time-Zone */
-		{
-			struct dict_avp_data data = {
-				1642,	/* Code */
-				10415,	/* Vendor */
-				"Time-Zone",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* A-MSISDN */
-		{
-			struct dict_avp_data data = {
-				1643,	/* Code */
-				10415,	/* Vendor */
-				"A-MSISDN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MME-Number-for-MT-SMS */
-		{
-			struct dict_avp_data data = {
-				1645,	/* Code */
-				10415,	/* Vendor */
-				"MME-Number-for-MT-SMS",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SMS-Register-Request */
-		{
-			struct dict_avp_data data = {
-				1648,	/* Code */
-				10415,	/* Vendor */
-				"SMS-Register-Request",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SMS-Register-Request)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SMS_REGISTRATION_REQUIRED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SMS_REGISTRATION_NOT_PREFERRED", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "NO_PREFERENCE", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Daylight-Saving-Time */
-		{
-			struct dict_avp_data data = {
-				1650,	/* Code */
-				10415,	/* Vendor */
-				"Daylight-Saving-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Daylight-Saving-Time)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NO_ADJUSTMENT", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PLUS_ONE_HOUR_ADJUSTMENT", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "PLUS_TWO_HOURS_ADJUSTMENT", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Subscription-Data-Flags */
-		{
-			struct dict_avp_data data = {
-				1654,	/* Code */
-				10415,	/* Vendor */
-				"Subscription-Data-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Measurement-Period-LTE */
-		{
-			struct dict_avp_data data = {
-				1655,	/* Code */
-				10415,	/* Vendor */
-				"Measurement-Period-LTE",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Measurement-Period-LTE)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Measurement_Period_UMTS", { .i32=167 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Measurement-Period-UMTS */
-		{
-			struct dict_avp_data data = {
-				1656,	/* Code */
-				10415,	/* Vendor */
-				"Measurement-Period-UMTS",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Measurement-Period-UMTS)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Collection_Period_RRM_LTE", { .i32=168 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Collection-Period-RRM-LTE */
-		{
-			struct dict_avp_data data = {
-				1657,	/* Code */
-				10415,	/* Vendor */
-				"Collection-Period-RRM-LTE",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Collection-Period-RRM-LTE)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Collection_Period_RRM_UMTS", { .i32=169 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Collection-Period-RRM-UMTS */
-		{
-			struct dict_avp_data data = {
-				1658,	/* Code */
-				10415,	/* Vendor */
-				"Collection-Period-RRM-UMTS",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Collection-Period-RRM-UMTS)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Positioning_Method", { .i32=170 }};
-			struct dict_enumval_data        t_2 = { "Measurement_Quantity", { .i32=171 }};
-			struct dict_enumval_data        t_3 = { "Event_Threshold_Event_1F", { .i32=172 }};
-			struct dict_enumval_data        t_4 = { "Event_Threshold_Event_1I", { .i32=173 }};
-			struct dict_enumval_data        t_5 = { "Restoration_Priority", { .i32=174 }};
-			struct dict_enumval_data        t_6 = { "SGs_MME_Identity", { .i32=175 }};
-			struct dict_enumval_data        t_7 = { "SIPTO_Local_Network_Permission", { .i32=176 }};
-			struct dict_enumval_data        t_8 = { "Coupled_Node_Diameter_ID", { .i32=177 }};
-			struct dict_enumval_data        t_9 = { "OC_Supported_Features", { .i32=178 }};
-			struct dict_enumval_data        t_10 = { "OC_OLR", { .i32=179 }};
-			struct dict_enumval_data        t_11 = { "ProSe_Subscription_Data", { .i32=180 }};
-			struct dict_enumval_data        t_12 = { "WLAN_offloadability", { .i32=181 }};
-			struct dict_enumval_data        t_13 = { "WLAN_offloadability_EUTRAN", { .i32=182 }};
-			struct dict_enumval_data        t_14 = { "WLAN_offloadability_UTRAN", { .i32=183 }};
-			struct dict_enumval_data        t_15 = { "Reset_ID", { .i32=184 }};
-			struct dict_enumval_data        t_16 = { "MDT_Allowed_PLMN_Id", { .i32=185 }};
-			struct dict_enumval_data        t_17 = { "Adjacent_PLMNs", { .i32=186 }};
-			struct dict_enumval_data        t_18 = { "Adjacent_Access_Restriction_Data", { .i32=187 }};
-			struct dict_enumval_data        t_19 = { "DL_Buffering_Suggested_Packet_Count", { .i32=188 }};
-			struct dict_enumval_data        t_20 = { "IMSI_Group_Id", { .i32=189 }};
-			struct dict_enumval_data        t_21 = { "Group_Service_Id", { .i32=190 }};
-			struct dict_enumval_data        t_22 = { "Group_PLMN_Id", { .i32=191 }};
-			struct dict_enumval_data        t_23 = { "Local_Group_Id", { .i32=192 }};
-			struct dict_enumval_data        t_24 = { "AESE_Communication_Pattern", { .i32=193 }};
-			struct dict_enumval_data        t_25 = { "Communication_Pattern_Set", { .i32=194 }};
-			struct dict_enumval_data        t_26 = { "Monitoring_Event_Configuration", { .i32=195 }};
-			struct dict_enumval_data        t_27 = { "Monitoring_Event_Report", { .i32=196 }};
-			struct dict_enumval_data        t_28 = { "UE_Reachability_Configuration", { .i32=197 }};
-			struct dict_enumval_data        t_29 = { "eNodeB_Id", { .i32=198 }};
-			struct dict_enumval_data        t_30 = { "Supported_Services", { .i32=199 }};
-			struct dict_enumval_data        t_31 = { "Supported_Monitoring_Events", { .i32=200 }};
-			struct dict_enumval_data        t_32 = { "AIR_Flags", { .i32=201 }};
-			struct dict_enumval_data        t_33 = { "UE_Usage_Type", { .i32=202 }};
-			struct dict_enumval_data        t_34 = { "DRMP", { .i32=203 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_17, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_18, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_19, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_20, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_21, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_22, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_23, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_24, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_25, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_26, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_27, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_28, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_29, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_30, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_31, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_32, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_33, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_34, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Positioning-Method */
-		{
-			struct dict_avp_data data = {
-				1659,	/* Code */
-				10415,	/* Vendor */
-				"Positioning-Method",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Measurement-Quantity */
-		{
-			struct dict_avp_data data = {
-				1660,	/* Code */
-				10415,	/* Vendor */
-				"Measurement-Quantity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Event-Threshold-Event-1F */
-		{
-			struct dict_avp_data data = {
-				1661,	/* Code */
-				10415,	/* Vendor */
-				"Event-Threshold-Event-1F",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Event-Threshold-Event-1I */
-		{
-			struct dict_avp_data data = {
-				1662,	/* Code */
-				10415,	/* Vendor */
-				"Event-Threshold-Event-1I",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Restoration-Priority */
-		{
-			struct dict_avp_data data = {
-				1663,	/* Code */
-				10415,	/* Vendor */
-				"Restoration-Priority",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SGs-MME-Identity */
-		{
-			struct dict_avp_data data = {
-				1664,	/* Code */
-				10415,	/* Vendor */
-				"SGs-MME-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* SIPTO-Local-Network-Permission */
-		{
-			struct dict_avp_data data = {
-				1665,	/* Code */
-				10415,	/* Vendor */
-				"SIPTO-Local-Network-Permission",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Coupled-Node-Diameter-ID */
-		{
-			struct dict_avp_data data = {
-				1666,	/* Code */
-				10415,	/* Vendor */
-				"Coupled-Node-Diameter-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* WLAN-offloadability-EUTRAN */
-		{
-			struct dict_avp_data data = {
-				1668,	/* Code */
-				10415,	/* Vendor */
-				"WLAN-offloadability-EUTRAN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* WLAN-offloadability-UTRAN */
-		{
-			struct dict_avp_data data = {
-				1669,	/* Code */
-				10415,	/* Vendor */
-				"WLAN-offloadability-UTRAN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Reset-ID */
-		{
-			struct dict_avp_data data = {
-				1670,	/* Code */
-				10415,	/* Vendor */
-				"Reset-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MDT-Allowed-PLMN-Id */
-		{
-			struct dict_avp_data data = {
-				1671,	/* Code */
-				10415,	/* Vendor */
-				"MDT-Allowed-PLMN-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* DL-Buffering-Suggested-Packet-Count */
-		{
-			struct dict_avp_data data = {
-				1674,	/* Code */
-				10415,	/* Vendor */
-				"DL-Buffering-Suggested-Packet-Count",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Group-Service-Id */
-		{
-			struct dict_avp_data data = {
-				1676,	/* Code */
-				10415,	/* Vendor */
-				"Group-Service-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Group-PLMN-Id */
-		{
-			struct dict_avp_data data = {
-				1677,	/* Code */
-				10415,	/* Vendor */
-				"Group-PLMN-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Local-Group-Id */
-		{
-			struct dict_avp_data data = {
-				1678,	/* Code */
-				10415,	/* Vendor */
-				"Local-Group-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* AIR-Flags */
-		{
-			struct dict_avp_data data = {
-				1679,	/* Code */
-				10415,	/* Vendor */
-				"AIR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* UE-Usage-Type */
-		{
-			struct dict_avp_data data = {
-				1680,	/* Code */
-				10415,	/* Vendor */
-				"UE-Usage-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Non-IP-PDN-Type-Indicator */
-		{
-			struct dict_avp_data data = {
-				1681,	/* Code */
-				10415,	/* Vendor */
-				"Non-IP-PDN-Type-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Non-IP-PDN-Type-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "MAINTAIN_PDN_CONNECTION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "DISCONNECT_PDN_CONNECTION_WITH_REACTIVATION_REQUEST", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "DISCONNECT_PDN_CONNECTION_WITHOUT_REACTIVATION_REQUEST", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Non-IP-Data-Delivery-Mechanism */
-		{
-			struct dict_avp_data data = {
-				1682,	/* Code */
-				10415,	/* Vendor */
-				"Non-IP-Data-Delivery-Mechanism",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Additional-Context-Identifier */
-		{
-			struct dict_avp_data data = {
-				1683,	/* Code */
-				10415,	/* Vendor */
-				"Additional-Context-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SCEF-Realm */
-		{
-			struct dict_avp_data data = {
-				1684,	/* Code */
-				10415,	/* Vendor */
-				"SCEF-Realm",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* Preferred-Data-Mode */
-		{
-			struct dict_avp_data data = {
-				1686,	/* Code */
-				10415,	/* Vendor */
-				"Preferred-Data-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* V2X-Permission */
-		{
-			struct dict_avp_data data = {
-				1689,	/* Code */
-				10415,	/* Vendor */
-				"V2X-Permission",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* PDN-Connection-Continuity */
-		{
-			struct dict_avp_data data = {
-				1690,	/* Code */
-				10415,	/* Vendor */
-				"PDN-Connection-Continuity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* eDRX-Cycle-Length-Value */
-		{
-			struct dict_avp_data data = {
-				1692,	/* Code */
-				10415,	/* Vendor */
-				"eDRX-Cycle-Length-Value",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* UE-PC5-AMBR */
-		{
-			struct dict_avp_data data = {
-				1693,	/* Code */
-				10415,	/* Vendor */
-				"UE-PC5-AMBR",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MBSFN-Area-ID */
-		{
-			struct dict_avp_data data = {
-				1695,	/* Code */
-				10415,	/* Vendor */
-				"MBSFN-Area-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Carrier-Frequency */
-		{
-			struct dict_avp_data data = {
-				1696,	/* Code */
-				10415,	/* Vendor */
-				"Carrier-Frequency",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* RDS-Indicator */
-		{
-			struct dict_avp_data data = {
-				1697,	/* Code */
-				10415,	/* Vendor */
-				"RDS-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(RDS-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DISABLED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ENABLED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Core-Network-Restrictions */
-		{
-			struct dict_avp_data data = {
-				1704,	/* Code */
-				10415,	/* Vendor */
-				"Core-Network-Restrictions",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Interworking-5GS-Indicator */
-		{
-			struct dict_avp_data data = {
-				1706,	/* Code */
-				10415,	/* Vendor */
-				"Interworking-5GS-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Interworking-5GS-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NOT_SUBSCRIBED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SUBSCRIBED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* V2X-Subscription-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1688,	/* Code */
-				10415,	/* Vendor */
-				"V2X-Subscription-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* E-UTRAN-Vector */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1414,	/* Code */
-				10415,	/* Vendor */
-				"E-UTRAN-Vector",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* AMBR */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1435,	/* Code */
-				10415,	/* Vendor */
-				"AMBR",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Adjacent-Access-Restriction-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1673,	/* Code */
-				10415,	/* Vendor */
-				"Adjacent-Access-Restriction-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* GERAN-Vector */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1416,	/* Code */
-				10415,	/* Vendor */
-				"GERAN-Vector",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* eDRX-Cycle-Length */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1691,	/* Code */
-				10415,	/* Vendor */
-				"eDRX-Cycle-Length",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Area-Scope */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1624,	/* Code */
-				10415,	/* Vendor */
-				"Area-Scope",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Call-Barring-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1488,	/* Code */
-				10415,	/* Vendor */
-				"Call-Barring-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* CSG-Subscription-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1436,	/* Code */
-				10415,	/* Vendor */
-				"CSG-Subscription-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* VPLMN-CSG-Subscription-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1641,	/* Code */
-				10415,	/* Vendor */
-				"VPLMN-CSG-Subscription-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MBSFN-Area */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1694,	/* Code */
-				10415,	/* Vendor */
-				"MBSFN-Area",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MO-LR */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1485,	/* Code */
-				10415,	/* Vendor */
-				"MO-LR",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* WLAN-offloadability */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1667,	/* Code */
-				10415,	/* Vendor */
-				"WLAN-offloadability",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Equivalent-PLMN-List */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1637,	/* Code */
-				10415,	/* Vendor */
-				"Equivalent-PLMN-List",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* UTRAN-Vector */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1415,	/* Code */
-				10415,	/* Vendor */
-				"UTRAN-Vector",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Local-Time-Zone */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1649,	/* Code */
-				10415,	/* Vendor */
-				"Local-Time-Zone",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* IMSI-Group-Id */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1675,	/* Code */
-				10415,	/* Vendor */
-				"IMSI-Group-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Terminal-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1401,	/* Code */
-				10415,	/* Vendor */
-				"Terminal-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Teleservice-List */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1486,	/* Code */
-				10415,	/* Vendor */
-				"Teleservice-List",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Service-Type */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1483,	/* Code */
-				10415,	/* Vendor */
-				"Service-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Requested-UTRAN-GERAN-Authentication-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1409,	/* Code */
-				10415,	/* Vendor */
-				"Requested-UTRAN-GERAN-Authentication-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Subscription-Data-Deletion */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1685,	/* Code */
-				10415,	/* Vendor */
-				"Subscription-Data-Deletion",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MME-User-State */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1497,	/* Code */
-				10415,	/* Vendor */
-				"MME-User-State",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Requested-EUTRAN-Authentication-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1408,	/* Code */
-				10415,	/* Vendor */
-				"Requested-EUTRAN-Authentication-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Adjacent-PLMNs */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1672,	/* Code */
-				10415,	/* Vendor */
-				"Adjacent-PLMNs",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SGSN-User-State */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1498,	/* Code */
-				10415,	/* Vendor */
-				"SGSN-User-State",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* External-Client */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1479,	/* Code */
-				10415,	/* Vendor */
-				"External-Client",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* EPS-User-State */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1495,	/* Code */
-				10415,	/* Vendor */
-				"EPS-User-State",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SGSN-Location-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1601,	/* Code */
-				10415,	/* Vendor */
-				"SGSN-Location-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* LCS-PrivacyException */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1475,	/* Code */
-				10415,	/* Vendor */
-				"LCS-PrivacyException",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MDT-Configuration */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1622,	/* Code */
-				10415,	/* Vendor */
-				"MDT-Configuration",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Authentication-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1413,	/* Code */
-				10415,	/* Vendor */
-				"Authentication-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Specific-APN-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1472,	/* Code */
-				10415,	/* Vendor */
-				"Specific-APN-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* EPS-Subscribed-QoS-Profile */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1431,	/* Code */
-				10415,	/* Vendor */
-				"EPS-Subscribed-QoS-Profile",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MME-Location-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1600,	/* Code */
-				10415,	/* Vendor */
-				"MME-Location-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* PDP-Context */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1469,	/* Code */
-				10415,	/* Vendor */
-				"PDP-Context",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Emergency-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1687,	/* Code */
-				10415,	/* Vendor */
-				"Emergency-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* GPRS-Subscription-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1467,	/* Code */
-				10415,	/* Vendor */
-				"GPRS-Subscription-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* APN-Configuration */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1430,	/* Code */
-				10415,	/* Vendor */
-				"APN-Configuration",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* EPS-Location-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1496,	/* Code */
-				10415,	/* Vendor */
-				"EPS-Location-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Trace-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1458,	/* Code */
-				10415,	/* Vendor */
-				"Trace-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Active-APN */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1612,	/* Code */
-				10415,	/* Vendor */
-				"Active-APN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* LCS-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1473,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* APN-Configuration-Profile */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1429,	/* Code */
-				10415,	/* Vendor */
-				"APN-Configuration-Profile",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Subscription-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1400,	/* Code */
-				10415,	/* Vendor */
-				"Subscription-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29272_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double ts29273_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,105 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29273_avps_defs[] = {
+	/* ANID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1504, 10415, "ANID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* AN-Trusted */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(AN-Trusted)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TRUSTED", { .i32=0 } }, "3GPP/Enumerated(AN-Trusted)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNTRUSTED", { .i32=1 } }, "3GPP/Enumerated(AN-Trusted)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1503, 10415, "AN-Trusted", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(AN-Trusted)" },
+	/* MIP-FA-RK */
+	{ DICT_AVP, &(struct dict_avp_data){ 1506, 10415, "MIP-FA-RK", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MIP-FA-RK-SPI */
+	{ DICT_AVP, &(struct dict_avp_data){ 1507, 10415, "MIP-FA-RK-SPI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Full-Network-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1516, 10415, "Full-Network-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Short-Network-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1517, 10415, "Short-Network-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Mobile-Node-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 506, 10415, "Mobile-Node-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* AAA-Failure-Indication */
+	{ DICT_AVP, &(struct dict_avp_data){ 1518, 10415, "AAA-Failure-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Transport-Access-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Transport-Access-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BBF", { .i32=0 } }, "3GPP/Enumerated(Transport-Access-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1519, 10415, "Transport-Access-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Transport-Access-Type)" },
+	/* Visited-Network-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 600, 10415, "Visited-Network-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* DER-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1520, 10415, "DER-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* DEA-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1521, 10415, "DEA-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SSID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1524, 10415, "SSID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* HESSID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1525, 10415, "HESSID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* TWAN-Connection-Mode */
+	{ DICT_AVP, &(struct dict_avp_data){ 1527, 10415, "TWAN-Connection-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Connectivity-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1529, 10415, "Connectivity-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* TWAN-PCO */
+	{ DICT_AVP, &(struct dict_avp_data){ 1530, 10415, "TWAN-PCO", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* TWAG-CP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1531, 10415, "TWAG-CP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* TWAG-UP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1532, 10415, "TWAG-UP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* TWAN-S2a-Failure-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 1533, 10415, "TWAN-S2a-Failure-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SM-Back-Off-Timer */
+	{ DICT_AVP, &(struct dict_avp_data){ 1534, 10415, "SM-Back-Off-Timer", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* WLCP-Key */
+	{ DICT_AVP, &(struct dict_avp_data){ 1535, 10415, "WLCP-Key", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Emergency-Services */
+	{ DICT_AVP, &(struct dict_avp_data){ 1538, 10415, "Emergency-Services", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* IMEI-Check-In-VPLMN-Result */
+	{ DICT_AVP, &(struct dict_avp_data){ 1540, 10415, "IMEI-Check-In-VPLMN-Result", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Non-3GPP-IP-Access */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Non-3GPP-IP-Access)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NON_3GPP_SUBSCRIPTION_ALLOWED", { .i32=0 } }, "3GPP/Enumerated(Non-3GPP-IP-Access)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NON_3GPP_SUBSCRIPTION_BARRED", { .i32=1 } }, "3GPP/Enumerated(Non-3GPP-IP-Access)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1501, 10415, "Non-3GPP-IP-Access", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Non-3GPP-IP-Access)" },
+	/* Non-3GPP-IP-Access-APN */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Non-3GPP-IP-Access-APN)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Non_3GPP_APNS_ENABLE", { .i32=0 } }, "3GPP/Enumerated(Non-3GPP-IP-Access-APN)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Non_3GPP_APNS_DISABLE", { .i32=1 } }, "3GPP/Enumerated(Non-3GPP-IP-Access-APN)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1502, 10415, "Non-3GPP-IP-Access-APN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Non-3GPP-IP-Access-APN)" },
+	/* PPR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1508, 10415, "PPR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* TWAN-Default-APN-Context-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1512, 10415, "TWAN-Default-APN-Context-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Access-Authorization-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 1511, 10415, "Access-Authorization-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Service-Selection */
+	{ DICT_AVP, &(struct dict_avp_data){ 493, 10415, "Service-Selection", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* 3GPP-AAA-Server-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 318, 10415, "3GPP-AAA-Server-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* ERP-Authorization */
+	{ DICT_AVP, &(struct dict_avp_data){ 1541, 10415, "ERP-Authorization", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MIP6-Feature-Vector */
+	{ DICT_AVP, &(struct dict_avp_data){ 124, 10415, "MIP6-Feature-Vector", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* Origination-Time-Stamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 1536, 10415, "Origination-Time-Stamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED64 }, NULL },
+	/* Maximum-Wait-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1537, 10415, "Maximum-Wait-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Access-Network-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1526, 10415, "Access-Network-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* MIP6-Agent-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 486, 10415, "MIP6-Agent-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* WLAN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 1509, 10415, "WLAN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* TWAN-Connectivity-Parameters */
+	{ DICT_AVP, &(struct dict_avp_data){ 1528, 10415, "TWAN-Connectivity-Parameters", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* TWAN-Access-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1510, 10415, "TWAN-Access-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Trace-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1505, 10415, "Trace-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Non-3GPP-User-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1500, 10415, "Non-3GPP-User-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29273_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,571 +215,7 @@ static int dict_ts29273_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* ANID */
-		{
-			struct dict_avp_data data = {
-				1504,	/* Code */
-				10415,	/* Vendor */
-				"ANID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* AN-Trusted */
-		{
-			struct dict_avp_data data = {
-				1503,	/* Code */
-				10415,	/* Vendor */
-				"AN-Trusted",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(AN-Trusted)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "TRUSTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "UNTRUSTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MIP-FA-RK */
-		{
-			struct dict_avp_data data = {
-				1506,	/* Code */
-				10415,	/* Vendor */
-				"MIP-FA-RK",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP-FA-RK-SPI */
-		{
-			struct dict_avp_data data = {
-				1507,	/* Code */
-				10415,	/* Vendor */
-				"MIP-FA-RK-SPI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Full-Network-Name */
-		{
-			struct dict_avp_data data = {
-				1516,	/* Code */
-				10415,	/* Vendor */
-				"Full-Network-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Short-Network-Name */
-		{
-			struct dict_avp_data data = {
-				1517,	/* Code */
-				10415,	/* Vendor */
-				"Short-Network-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Mobile-Node-Identifier */
-		{
-			struct dict_avp_data data = {
-				506,	/* Code */
-				10415,	/* Vendor */
-				"Mobile-Node-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* AAA-Failure-Indication */
-		{
-			struct dict_avp_data data = {
-				1518,	/* Code */
-				10415,	/* Vendor */
-				"AAA-Failure-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Transport-Access-Type */
-		{
-			struct dict_avp_data data = {
-				1519,	/* Code */
-				10415,	/* Vendor */
-				"Transport-Access-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Transport-Access-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "BBF", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Visited-Network-Identifier */
-		{
-			struct dict_avp_data data = {
-				600,	/* Code */
-				10415,	/* Vendor */
-				"Visited-Network-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* DER-Flags */
-		{
-			struct dict_avp_data data = {
-				1520,	/* Code */
-				10415,	/* Vendor */
-				"DER-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* DEA-Flags */
-		{
-			struct dict_avp_data data = {
-				1521,	/* Code */
-				10415,	/* Vendor */
-				"DEA-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SSID */
-		{
-			struct dict_avp_data data = {
-				1524,	/* Code */
-				10415,	/* Vendor */
-				"SSID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* HESSID */
-		{
-			struct dict_avp_data data = {
-				1525,	/* Code */
-				10415,	/* Vendor */
-				"HESSID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* TWAN-Connection-Mode */
-		{
-			struct dict_avp_data data = {
-				1527,	/* Code */
-				10415,	/* Vendor */
-				"TWAN-Connection-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Connectivity-Flags */
-		{
-			struct dict_avp_data data = {
-				1529,	/* Code */
-				10415,	/* Vendor */
-				"Connectivity-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TWAN-PCO */
-		{
-			struct dict_avp_data data = {
-				1530,	/* Code */
-				10415,	/* Vendor */
-				"TWAN-PCO",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TWAG-CP-Address */
-		{
-			struct dict_avp_data data = {
-				1531,	/* Code */
-				10415,	/* Vendor */
-				"TWAG-CP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* TWAG-UP-Address */
-		{
-			struct dict_avp_data data = {
-				1532,	/* Code */
-				10415,	/* Vendor */
-				"TWAG-UP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* TWAN-S2a-Failure-Cause */
-		{
-			struct dict_avp_data data = {
-				1533,	/* Code */
-				10415,	/* Vendor */
-				"TWAN-S2a-Failure-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Back-Off-Timer */
-		{
-			struct dict_avp_data data = {
-				1534,	/* Code */
-				10415,	/* Vendor */
-				"SM-Back-Off-Timer",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* WLCP-Key */
-		{
-			struct dict_avp_data data = {
-				1535,	/* Code */
-				10415,	/* Vendor */
-				"WLCP-Key",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Emergency-Services */
-		{
-			struct dict_avp_data data = {
-				1538,	/* Code */
-				10415,	/* Vendor */
-				"Emergency-Services",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* IMEI-Check-In-VPLMN-Result */
-		{
-			struct dict_avp_data data = {
-				1540,	/* Code */
-				10415,	/* Vendor */
-				"IMEI-Check-In-VPLMN-Result",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Non-3GPP-IP-Access */
-		{
-			struct dict_avp_data data = {
-				1501,	/* Code */
-				10415,	/* Vendor */
-				"Non-3GPP-IP-Access",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Non-3GPP-IP-Access)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NON_3GPP_SUBSCRIPTION_ALLOWED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NON_3GPP_SUBSCRIPTION_BARRED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Non-3GPP-IP-Access-APN */
-		{
-			struct dict_avp_data data = {
-				1502,	/* Code */
-				10415,	/* Vendor */
-				"Non-3GPP-IP-Access-APN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Non-3GPP-IP-Access-APN)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Non_3GPP_APNS_ENABLE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Non_3GPP_APNS_DISABLE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PPR-Flags */
-		{
-			struct dict_avp_data data = {
-				1508,	/* Code */
-				10415,	/* Vendor */
-				"PPR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TWAN-Default-APN-Context-Id */
-		{
-			struct dict_avp_data data = {
-				1512,	/* Code */
-				10415,	/* Vendor */
-				"TWAN-Default-APN-Context-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Access-Authorization-Flags */
-		{
-			struct dict_avp_data data = {
-				1511,	/* Code */
-				10415,	/* Vendor */
-				"Access-Authorization-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Service-Selection */
-		{
-			struct dict_avp_data data = {
-				493,	/* Code */
-				10415,	/* Vendor */
-				"Service-Selection",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* 3GPP-AAA-Server-Name */
-		{
-			struct dict_avp_data data = {
-				318,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-AAA-Server-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* ERP-Authorization */
-		{
-			struct dict_avp_data data = {
-				1541,	/* Code */
-				10415,	/* Vendor */
-				"ERP-Authorization",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MIP6-Feature-Vector */
-		{
-			struct dict_avp_data data = {
-				124,	/* Code */
-				10415,	/* Vendor */
-				"MIP6-Feature-Vector",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Origination-Time-Stamp */
-		{
-			struct dict_avp_data data = {
-				1536,	/* Code */
-				10415,	/* Vendor */
-				"Origination-Time-Stamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED64	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Maximum-Wait-Time */
-		{
-			struct dict_avp_data data = {
-				1537,	/* Code */
-				10415,	/* Vendor */
-				"Maximum-Wait-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Access-Network-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1526,	/* Code */
-				10415,	/* Vendor */
-				"Access-Network-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MIP6-Agent-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				486,	/* Code */
-				10415,	/* Vendor */
-				"MIP6-Agent-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* WLAN-Identifier */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1509,	/* Code */
-				10415,	/* Vendor */
-				"WLAN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* TWAN-Connectivity-Parameters */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1528,	/* Code */
-				10415,	/* Vendor */
-				"TWAN-Connectivity-Parameters",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* TWAN-Access-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1510,	/* Code */
-				10415,	/* Vendor */
-				"TWAN-Access-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Trace-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1505,	/* Code */
-				10415,	/* Vendor */
-				"Trace-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Non-3GPP-User-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1500,	/* Code */
-				10415,	/* Vendor */
-				"Non-3GPP-User-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29273_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double ts29329_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,113 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29329_avps_defs[] = {
+	/* MSISDN */
+	{ DICT_AVP, &(struct dict_avp_data){ 701, 10415, "MSISDN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* User-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 702, 10415, "User-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Data-Reference */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Data-Reference)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RepositoryData", { .i32=0 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IMSPublicIdentity", { .i32=10 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IMSUserState", { .i32=11 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "S_CSCFName", { .i32=12 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "InitialFilterCriteria", { .i32=13 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LocationInformation", { .i32=14 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UserState", { .i32=15 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ChargingInformation", { .i32=16 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MSISDN", { .i32=17 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PSIActivation", { .i32=18 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DSAI", { .i32=19 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ServiceLevelTraceInfo", { .i32=21 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPAddressSecureBindingInformation", { .i32=22 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ServicePriorityLevel", { .i32=23 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SMSRegistrationInfo", { .i32=24 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UEReachabilityForIP", { .i32=25 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TADSinformation", { .i32=26 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "STN_SR", { .i32=27 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_SRVCC_Capability", { .i32=28 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ExtendedPriority", { .i32=29 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CSRN", { .i32=30 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ReferenceLocationInformation", { .i32=31 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IMSI", { .i32=32 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IMSPrivateUserIdentity", { .i32=33 } }, "3GPP/Enumerated(Data-Reference)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 703, 10415, "Data-Reference", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Data-Reference)" },
+	/* Service-Indication */
+	{ DICT_AVP, &(struct dict_avp_data){ 704, 10415, "Service-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Subs-Req-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subs-Req-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Subscribe", { .i32=0 } }, "3GPP/Enumerated(Subs-Req-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Unsubscribe", { .i32=1 } }, "3GPP/Enumerated(Subs-Req-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 705, 10415, "Subs-Req-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Subs-Req-Type)" },
+	/* Requested-Domain */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Requested-Domain)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CS_Domain", { .i32=0 } }, "3GPP/Enumerated(Requested-Domain)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PS_Domain", { .i32=1 } }, "3GPP/Enumerated(Requested-Domain)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 706, 10415, "Requested-Domain", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Requested-Domain)" },
+	/* Current-Location */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Current-Location)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DoNotNeedInitiateActiveLocationRetrieval", { .i32=0 } }, "3GPP/Enumerated(Current-Location)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "InitiateActiveLocationRetrieval", { .i32=1 } }, "3GPP/Enumerated(Current-Location)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 707, 10415, "Current-Location", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Current-Location)" },
+	/* Identity-Set */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Identity-Set)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ALL_IDENTITIES", { .i32=0 } }, "3GPP/Enumerated(Identity-Set)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REGISTERED_IDENTITIES", { .i32=1 } }, "3GPP/Enumerated(Identity-Set)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IMPLICIT_IDENTITIES", { .i32=2 } }, "3GPP/Enumerated(Identity-Set)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ALIAS_IDENTITIES", { .i32=3 } }, "3GPP/Enumerated(Identity-Set)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 708, 10415, "Identity-Set", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Identity-Set)" },
+	/* Expiry-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 709, 10415, "Expiry-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Send-Data-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Send-Data-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_DATA_NOT_REQUESTED", { .i32=0 } }, "3GPP/Enumerated(Send-Data-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_DATA_REQUESTED", { .i32=1 } }, "3GPP/Enumerated(Send-Data-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 710, 10415, "Send-Data-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Send-Data-Indication)" },
+	/* DSAI-Tag */
+	{ DICT_AVP, &(struct dict_avp_data){ 711, 10415, "DSAI-Tag", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Wildcarded-Public-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 634, 10415, "Wildcarded-Public-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Wildcarded-IMPU */
+	{ DICT_AVP, &(struct dict_avp_data){ 636, 10415, "Wildcarded-IMPU", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* One-Time-Notification */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(One-Time-Notification)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ONE_TIME_NOTIFICATION_REQUESTED", { .i32=0 } }, "3GPP/Enumerated(One-Time-Notification)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IP", { .i32=25 } }, "3GPP/Enumerated(One-Time-Notification)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 712, 10415, "One-Time-Notification", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(One-Time-Notification)" },
+	/* Requested-Nodes */
+	{ DICT_AVP, &(struct dict_avp_data){ 713, 10415, "Requested-Nodes", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Serving-Node-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Serving-Node-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ONLY_SERVING_NODES_REQUIRED", { .i32=0 } }, "3GPP/Enumerated(Serving-Node-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 714, 10415, "Serving-Node-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Serving-Node-Indication)" },
+	/* Sequence-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 716, 10415, "Sequence-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Pre-paging-Supported */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Pre-paging-Supported)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PREPAGING_NOT_SUPPORTED", { .i32=0 } }, "3GPP/Enumerated(Pre-paging-Supported)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PREPAGING_SUPPORTED", { .i32=1 } }, "3GPP/Enumerated(Pre-paging-Supported)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 717, 10415, "Pre-paging-Supported", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Pre-paging-Supported)" },
+	/* Local-Time-Zone-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Local-Time-Zone-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ONLY_LOCAL_TIME_ZONE_REQUESTED", { .i32=0 } }, "3GPP/Enumerated(Local-Time-Zone-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LOCAL_TIME_ZONE_WITH_LOCATION_INFO_REQUESTED", { .i32=1 } }, "3GPP/Enumerated(Local-Time-Zone-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 718, 10415, "Local-Time-Zone-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Local-Time-Zone-Indication)" },
+	/* UDR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 719, 10415, "UDR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Call-Reference-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 721, 10415, "Call-Reference-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* AS-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 722, 10415, "AS-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* User-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 700, 10415, "User-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Call-Reference-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 720, 10415, "Call-Reference-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* Repository-Data-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 715, 10415, "Repository-Data-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29329_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,455 +223,7 @@ static int dict_ts29329_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* MSISDN */
-		{
-			struct dict_avp_data data = {
-				701,	/* Code */
-				10415,	/* Vendor */
-				"MSISDN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Data */
-		{
-			struct dict_avp_data data = {
-				702,	/* Code */
-				10415,	/* Vendor */
-				"User-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Data-Reference */
-		{
-			struct dict_avp_data data = {
-				703,	/* Code */
-				10415,	/* Vendor */
-				"Data-Reference",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Data-Reference)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "RepositoryData", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "IMSPublicIdentity", { .i32=10 }};
-			struct dict_enumval_data        t_3 = { "IMSUserState", { .i32=11 }};
-			struct dict_enumval_data        t_4 = { "S_CSCFName", { .i32=12 }};
-			struct dict_enumval_data        t_5 = { "InitialFilterCriteria", { .i32=13 }};
-			struct dict_enumval_data        t_6 = { "LocationInformation", { .i32=14 }};
-			struct dict_enumval_data        t_7 = { "UserState", { .i32=15 }};
-			struct dict_enumval_data        t_8 = { "ChargingInformation", { .i32=16 }};
-			struct dict_enumval_data        t_9 = { "MSISDN", { .i32=17 }};
-			struct dict_enumval_data        t_10 = { "PSIActivation", { .i32=18 }};
-			struct dict_enumval_data        t_11 = { "DSAI", { .i32=19 }};
-			struct dict_enumval_data        t_12 = { "ServiceLevelTraceInfo", { .i32=21 }};
-			struct dict_enumval_data        t_13 = { "IPAddressSecureBindingInformation", { .i32=22 }};
-			struct dict_enumval_data        t_14 = { "ServicePriorityLevel", { .i32=23 }};
-			struct dict_enumval_data        t_15 = { "SMSRegistrationInfo", { .i32=24 }};
-			struct dict_enumval_data        t_16 = { "UEReachabilityForIP", { .i32=25 }};
-			struct dict_enumval_data        t_17 = { "TADSinformation", { .i32=26 }};
-			struct dict_enumval_data        t_18 = { "STN_SR", { .i32=27 }};
-			struct dict_enumval_data        t_19 = { "UE_SRVCC_Capability", { .i32=28 }};
-			struct dict_enumval_data        t_20 = { "ExtendedPriority", { .i32=29 }};
-			struct dict_enumval_data        t_21 = { "CSRN", { .i32=30 }};
-			struct dict_enumval_data        t_22 = { "ReferenceLocationInformation", { .i32=31 }};
-			struct dict_enumval_data        t_23 = { "IMSI", { .i32=32 }};
-			struct dict_enumval_data        t_24 = { "IMSPrivateUserIdentity", { .i32=33 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_17, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_18, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_19, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_20, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_21, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_22, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_23, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_24, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Service-Indication */
-		{
-			struct dict_avp_data data = {
-				704,	/* Code */
-				10415,	/* Vendor */
-				"Service-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Subs-Req-Type */
-		{
-			struct dict_avp_data data = {
-				705,	/* Code */
-				10415,	/* Vendor */
-				"Subs-Req-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subs-Req-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Subscribe", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Unsubscribe", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Requested-Domain */
-		{
-			struct dict_avp_data data = {
-				706,	/* Code */
-				10415,	/* Vendor */
-				"Requested-Domain",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Requested-Domain)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CS_Domain", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PS_Domain", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Current-Location */
-		{
-			struct dict_avp_data data = {
-				707,	/* Code */
-				10415,	/* Vendor */
-				"Current-Location",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Current-Location)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DoNotNeedInitiateActiveLocationRetrieval", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "InitiateActiveLocationRetrieval", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Identity-Set */
-		{
-			struct dict_avp_data data = {
-				708,	/* Code */
-				10415,	/* Vendor */
-				"Identity-Set",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Identity-Set)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ALL_IDENTITIES", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "REGISTERED_IDENTITIES", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "IMPLICIT_IDENTITIES", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "ALIAS_IDENTITIES", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Expiry-Time */
-		{
-			struct dict_avp_data data = {
-				709,	/* Code */
-				10415,	/* Vendor */
-				"Expiry-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Send-Data-Indication */
-		{
-			struct dict_avp_data data = {
-				710,	/* Code */
-				10415,	/* Vendor */
-				"Send-Data-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Send-Data-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "USER_DATA_NOT_REQUESTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "USER_DATA_REQUESTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* DSAI-Tag */
-		{
-			struct dict_avp_data data = {
-				711,	/* Code */
-				10415,	/* Vendor */
-				"DSAI-Tag",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Wildcarded-Public-Identity */
-		{
-			struct dict_avp_data data = {
-				634,	/* Code */
-				10415,	/* Vendor */
-				"Wildcarded-Public-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Wildcarded-IMPU */
-		{
-			struct dict_avp_data data = {
-				636,	/* Code */
-				10415,	/* Vendor */
-				"Wildcarded-IMPU",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* One-Time-Notification */
-		{
-			struct dict_avp_data data = {
-				712,	/* Code */
-				10415,	/* Vendor */
-				"One-Time-Notification",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(One-Time-Notification)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ONE_TIME_NOTIFICATION_REQUESTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "IP", { .i32=25 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Requested-Nodes */
-		{
-			struct dict_avp_data data = {
-				713,	/* Code */
-				10415,	/* Vendor */
-				"Requested-Nodes",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Serving-Node-Indication */
-		{
-			struct dict_avp_data data = {
-				714,	/* Code */
-				10415,	/* Vendor */
-				"Serving-Node-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Serving-Node-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ONLY_SERVING_NODES_REQUIRED", { .i32=0 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Sequence-Number */
-		{
-			struct dict_avp_data data = {
-				716,	/* Code */
-				10415,	/* Vendor */
-				"Sequence-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Pre-paging-Supported */
-		{
-			struct dict_avp_data data = {
-				717,	/* Code */
-				10415,	/* Vendor */
-				"Pre-paging-Supported",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Pre-paging-Supported)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PREPAGING_NOT_SUPPORTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PREPAGING_SUPPORTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Local-Time-Zone-Indication */
-		{
-			struct dict_avp_data data = {
-				718,	/* Code */
-				10415,	/* Vendor */
-				"Local-Time-Zone-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Local-Time-Zone-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ONLY_LOCAL_TIME_ZONE_REQUESTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "LOCAL_TIME_ZONE_WITH_LOCATION_INFO_REQUESTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* UDR-Flags */
-		{
-			struct dict_avp_data data = {
-				719,	/* Code */
-				10415,	/* Vendor */
-				"UDR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Call-Reference-Number */
-		{
-			struct dict_avp_data data = {
-				721,	/* Code */
-				10415,	/* Vendor */
-				"Call-Reference-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* AS-Number */
-		{
-			struct dict_avp_data data = {
-				722,	/* Code */
-				10415,	/* Vendor */
-				"AS-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Identity */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				700,	/* Code */
-				10415,	/* Vendor */
-				"User-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Call-Reference-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				720,	/* Code */
-				10415,	/* Vendor */
-				"Call-Reference-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Repository-Data-ID */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				715,	/* Code */
-				10415,	/* Vendor */
-				"Repository-Data-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29329_avps_defs );
 
    /* Commands section */
    {
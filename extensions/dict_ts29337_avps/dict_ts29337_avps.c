@@ -43,6 +43,12 @@ const double ts29337_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,30 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29337_avps_defs[] = {
+	/* SM-Delivery-Outcome-T4 */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Delivery-Outcome-T4)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ABSENT_SUBSCRIBER", { .i32=0 } }, "3GPP/Enumerated(SM-Delivery-Outcome-T4)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_MEMORY_CAPACITY_EXCEEDED", { .i32=1 } }, "3GPP/Enumerated(SM-Delivery-Outcome-T4)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUCCESSFUL_TRANSFER", { .i32=2 } }, "3GPP/Enumerated(SM-Delivery-Outcome-T4)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VALIDITY_TIME_EXPIRED", { .i32=3 } }, "3GPP/Enumerated(SM-Delivery-Outcome-T4)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3200, 10415, "SM-Delivery-Outcome-T4", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SM-Delivery-Outcome-T4)" },
+	/* Absent-Subscriber-Diagnostic-T4 */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Absent-Subscriber-Diagnostic-T4)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ORIGINAL_MESSAGE_NOT_DELETED", { .i32=0 } }, "3GPP/Enumerated(Absent-Subscriber-Diagnostic-T4)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NEW_MESSAGE_NOT_STORED", { .i32=1 } }, "3GPP/Enumerated(Absent-Subscriber-Diagnostic-T4)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REPLACE", { .i32=2 } }, "3GPP/Enumerated(Absent-Subscriber-Diagnostic-T4)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_PURGED", { .i32=3 } }, "3GPP/Enumerated(Absent-Subscriber-Diagnostic-T4)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ROAMING_RESTRICTION", { .i32=4 } }, "3GPP/Enumerated(Absent-Subscriber-Diagnostic-T4)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNIDENTIFIED_SUBSCRIBER", { .i32=5 } }, "3GPP/Enumerated(Absent-Subscriber-Diagnostic-T4)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3201, 10415, "Absent-Subscriber-Diagnostic-T4", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Absent-Subscriber-Diagnostic-T4)" },
+	/* Trigger-Action */
+	{ DICT_AVP, &(struct dict_avp_data){ 3202, 10415, "Trigger-Action", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MTC-Error-Diagnostic */
+	{ DICT_AVP, &(struct dict_avp_data){ 3203, 10415, "MTC-Error-Diagnostic", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+};
+
 static int dict_ts29337_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,99 +140,7 @@ static int dict_ts29337_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* SM-Delivery-Outcome-T4 */
-		{
-			struct dict_avp_data data = {
-				3200,	/* Code */
-				10415,	/* Vendor */
-				"SM-Delivery-Outcome-T4",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Delivery-Outcome-T4)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ABSENT_SUBSCRIBER", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "UE_MEMORY_CAPACITY_EXCEEDED", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "SUCCESSFUL_TRANSFER", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "VALIDITY_TIME_EXPIRED", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Absent-Subscriber-Diagnostic-T4 */
-		{
-			struct dict_avp_data data = {
-				3201,	/* Code */
-				10415,	/* Vendor */
-				"Absent-Subscriber-Diagnostic-T4",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Absent-Subscriber-Diagnostic-T4)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ORIGINAL_MESSAGE_NOT_DELETED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NEW_MESSAGE_NOT_STORED", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "REPLACE", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "UE_PURGED", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "ROAMING_RESTRICTION", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "UNIDENTIFIED_SUBSCRIBER", { .i32=5 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Trigger-Action */
-		{
-			struct dict_avp_data data = {
-				3202,	/* Code */
-				10415,	/* Vendor */
-				"Trigger-Action",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MTC-Error-Diagnostic */
-		{
-			struct dict_avp_data data = {
-				3203,	/* Code */
-				10415,	/* Vendor */
-				"MTC-Error-Diagnostic",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29337_avps_defs );
 
    /* Commands section */
    {
@@ -43,6 +43,12 @@ const double ts29338_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,96 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29338_avps_defs[] = {
+	/* SM-RP-MTI */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-RP-MTI)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SM_DELIVER", { .i32=0 } }, "3GPP/Enumerated(SM-RP-MTI)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SM_STATUS_REPORT", { .i32=1 } }, "3GPP/Enumerated(SM-RP-MTI)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3308, 10415, "SM-RP-MTI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SM-RP-MTI)" },
+	/* SM-RP-SMEA */
+	{ DICT_AVP, &(struct dict_avp_data){ 3309, 10415, "SM-RP-SMEA", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SRR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 3310, 10415, "SRR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SM-Delivery-Not-Intended */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Delivery-Not-Intended)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ONLY_IMSI_REQUESTED", { .i32=0 } }, "3GPP/Enumerated(SM-Delivery-Not-Intended)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ONLY_MCC_MNC_REQUESTED", { .i32=1 } }, "3GPP/Enumerated(SM-Delivery-Not-Intended)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3311, 10415, "SM-Delivery-Not-Intended", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SM-Delivery-Not-Intended)" },
+	/* MWD-Status */
+	{ DICT_AVP, &(struct dict_avp_data){ 3312, 10415, "MWD-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MME-Absent-User-Diagnostic-SM */
+	{ DICT_AVP, &(struct dict_avp_data){ 3313, 10415, "MME-Absent-User-Diagnostic-SM", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* MSC-Absent-User-Diagnostic-SM */
+	{ DICT_AVP, &(struct dict_avp_data){ 3314, 10415, "MSC-Absent-User-Diagnostic-SM", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SGSN-Absent-User-Diagnostic-SM */
+	{ DICT_AVP, &(struct dict_avp_data){ 3315, 10415, "SGSN-Absent-User-Diagnostic-SM", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SM-Delivery-Cause */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Delivery-Cause)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MEMORY_CAPACITY_EXCEEDED", { .i32=0 } }, "3GPP/Enumerated(SM-Delivery-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ABSENT_USER", { .i32=1 } }, "3GPP/Enumerated(SM-Delivery-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUCCESSFUL_TRANSFER", { .i32=2 } }, "3GPP/Enumerated(SM-Delivery-Cause)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3321, 10415, "SM-Delivery-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SM-Delivery-Cause)" },
+	/* Absent-User-Diagnostic-SM */
+	{ DICT_AVP, &(struct dict_avp_data){ 3322, 10415, "Absent-User-Diagnostic-SM", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* RDR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 3323, 10415, "RDR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Maximum-UE-Availability-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 3329, 10415, "Maximum-UE-Availability-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* SMS-GMSC-Alert-Event */
+	{ DICT_AVP, &(struct dict_avp_data){ 3333, 10415, "SMS-GMSC-Alert-Event", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SC-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3300, 10415, "SC-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SM-RP-UI */
+	{ DICT_AVP, &(struct dict_avp_data){ 3301, 10415, "SM-RP-UI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* TFR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 3302, 10415, "TFR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SM-Enumerated-Delivery-Failure-Cause */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MEMORY_CAPACITY_EXCEEDED", { .i32=0 } }, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EQUIPMENT_PROTOCOL_ERROR", { .i32=1 } }, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EQUIPMENT_NOT_SM_EQUIPPED", { .i32=2 } }, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNKNOWN_SERVICE_CENTRE", { .i32=3 } }, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SC_CONGESTION", { .i32=4 } }, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INVALID_SME_ADDRESS", { .i32=5 } }, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USER_NOT_SC_USER", { .i32=6 } }, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3304, 10415, "SM-Enumerated-Delivery-Failure-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)" },
+	/* SM-Diagnostic-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 3305, 10415, "SM-Diagnostic-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SM-Delivery-Timer */
+	{ DICT_AVP, &(struct dict_avp_data){ 3306, 10415, "SM-Delivery-Timer", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SM-Delivery-Start-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 3307, 10415, "SM-Delivery-Start-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* HSS-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 3325, 10415, "HSS-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Originating-SIP-URI */
+	{ DICT_AVP, &(struct dict_avp_data){ 3326, 10415, "Originating-SIP-URI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Destination-SIP-URI */
+	{ DICT_AVP, &(struct dict_avp_data){ 3327, 10415, "Destination-SIP-URI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* OFR-Flags */
+	{ DICT_AVP, &(struct dict_avp_data){ 3328, 10415, "OFR-Flags", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Maximum-Retransmission-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 3330, 10415, "Maximum-Retransmission-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Requested-Retransmission-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 3331, 10415, "Requested-Retransmission-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* SMS-GMSC-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3332, 10415, "SMS-GMSC-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SGSN-SM-Delivery-Outcome */
+	{ DICT_AVP, &(struct dict_avp_data){ 3319, 10415, "SGSN-SM-Delivery-Outcome", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* SM-Delivery-Failure-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 3303, 10415, "SM-Delivery-Failure-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* SMSMI-Correlation-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 3324, 10415, "SMSMI-Correlation-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_GROUPED }, NULL },
+	/* IP-SM-GW-SM-Delivery-Outcome */
+	{ DICT_AVP, &(struct dict_avp_data){ 3320, 10415, "IP-SM-GW-SM-Delivery-Outcome", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MSC-SM-Delivery-Outcome */
+	{ DICT_AVP, &(struct dict_avp_data){ 3318, 10415, "MSC-SM-Delivery-Outcome", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MME-SM-Delivery-Outcome */
+	{ DICT_AVP, &(struct dict_avp_data){ 3317, 10415, "MME-SM-Delivery-Outcome", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* SM-Delivery-Outcome */
+	{ DICT_AVP, &(struct dict_avp_data){ 3316, 10415, "SM-Delivery-Outcome", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29338_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,489 +206,7 @@ static int dict_ts29338_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* SM-RP-MTI */
-		{
-			struct dict_avp_data data = {
-				3308,	/* Code */
-				10415,	/* Vendor */
-				"SM-RP-MTI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-RP-MTI)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SM_DELIVER", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SM_STATUS_REPORT", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SM-RP-SMEA */
-		{
-			struct dict_avp_data data = {
-				3309,	/* Code */
-				10415,	/* Vendor */
-				"SM-RP-SMEA",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SRR-Flags */
-		{
-			struct dict_avp_data data = {
-				3310,	/* Code */
-				10415,	/* Vendor */
-				"SRR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Delivery-Not-Intended */
-		{
-			struct dict_avp_data data = {
-				3311,	/* Code */
-				10415,	/* Vendor */
-				"SM-Delivery-Not-Intended",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Delivery-Not-Intended)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ONLY_IMSI_REQUESTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ONLY_MCC_MNC_REQUESTED", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MWD-Status */
-		{
-			struct dict_avp_data data = {
-				3312,	/* Code */
-				10415,	/* Vendor */
-				"MWD-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MME-Absent-User-Diagnostic-SM */
-		{
-			struct dict_avp_data data = {
-				3313,	/* Code */
-				10415,	/* Vendor */
-				"MME-Absent-User-Diagnostic-SM",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MSC-Absent-User-Diagnostic-SM */
-		{
-			struct dict_avp_data data = {
-				3314,	/* Code */
-				10415,	/* Vendor */
-				"MSC-Absent-User-Diagnostic-SM",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SGSN-Absent-User-Diagnostic-SM */
-		{
-			struct dict_avp_data data = {
-				3315,	/* Code */
-				10415,	/* Vendor */
-				"SGSN-Absent-User-Diagnostic-SM",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Delivery-Cause */
-		{
-			struct dict_avp_data data = {
-				3321,	/* Code */
-				10415,	/* Vendor */
-				"SM-Delivery-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Delivery-Cause)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "MEMORY_CAPACITY_EXCEEDED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ABSENT_USER", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "SUCCESSFUL_TRANSFER", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Absent-User-Diagnostic-SM */
-		{
-			struct dict_avp_data data = {
-				3322,	/* Code */
-				10415,	/* Vendor */
-				"Absent-User-Diagnostic-SM",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* RDR-Flags */
-		{
-			struct dict_avp_data data = {
-				3323,	/* Code */
-				10415,	/* Vendor */
-				"RDR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Maximum-UE-Availability-Time */
-		{
-			struct dict_avp_data data = {
-				3329,	/* Code */
-				10415,	/* Vendor */
-				"Maximum-UE-Availability-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* SMS-GMSC-Alert-Event */
-		{
-			struct dict_avp_data data = {
-				3333,	/* Code */
-				10415,	/* Vendor */
-				"SMS-GMSC-Alert-Event",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SC-Address */
-		{
-			struct dict_avp_data data = {
-				3300,	/* Code */
-				10415,	/* Vendor */
-				"SC-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-RP-UI */
-		{
-			struct dict_avp_data data = {
-				3301,	/* Code */
-				10415,	/* Vendor */
-				"SM-RP-UI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* TFR-Flags */
-		{
-			struct dict_avp_data data = {
-				3302,	/* Code */
-				10415,	/* Vendor */
-				"TFR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Enumerated-Delivery-Failure-Cause */
-		{
-			struct dict_avp_data data = {
-				3304,	/* Code */
-				10415,	/* Vendor */
-				"SM-Enumerated-Delivery-Failure-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Enumerated-Delivery-Failure-Cause)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "MEMORY_CAPACITY_EXCEEDED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "EQUIPMENT_PROTOCOL_ERROR", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "EQUIPMENT_NOT_SM_EQUIPPED", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "UNKNOWN_SERVICE_CENTRE", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "SC_CONGESTION", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "INVALID_SME_ADDRESS", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "USER_NOT_SC_USER", { .i32=6 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SM-Diagnostic-Info */
-		{
-			struct dict_avp_data data = {
-				3305,	/* Code */
-				10415,	/* Vendor */
-				"SM-Diagnostic-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Delivery-Timer */
-		{
-			struct dict_avp_data data = {
-				3306,	/* Code */
-				10415,	/* Vendor */
-				"SM-Delivery-Timer",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Delivery-Start-Time */
-		{
-			struct dict_avp_data data = {
-				3307,	/* Code */
-				10415,	/* Vendor */
-				"SM-Delivery-Start-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* HSS-ID */
-		{
-			struct dict_avp_data data = {
-				3325,	/* Code */
-				10415,	/* Vendor */
-				"HSS-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Originating-SIP-URI */
-		{
-			struct dict_avp_data data = {
-				3326,	/* Code */
-				10415,	/* Vendor */
-				"Originating-SIP-URI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Destination-SIP-URI */
-		{
-			struct dict_avp_data data = {
-				3327,	/* Code */
-				10415,	/* Vendor */
-				"Destination-SIP-URI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* OFR-Flags */
-		{
-			struct dict_avp_data data = {
-				3328,	/* Code */
-				10415,	/* Vendor */
-				"OFR-Flags",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Maximum-Retransmission-Time */
-		{
-			struct dict_avp_data data = {
-				3330,	/* Code */
-				10415,	/* Vendor */
-				"Maximum-Retransmission-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Requested-Retransmission-Time */
-		{
-			struct dict_avp_data data = {
-				3331,	/* Code */
-				10415,	/* Vendor */
-				"Requested-Retransmission-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* SMS-GMSC-Address */
-		{
-			struct dict_avp_data data = {
-				3332,	/* Code */
-				10415,	/* Vendor */
-				"SMS-GMSC-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SGSN-SM-Delivery-Outcome */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3319,	/* Code */
-				10415,	/* Vendor */
-				"SGSN-SM-Delivery-Outcome",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SM-Delivery-Failure-Cause */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3303,	/* Code */
-				10415,	/* Vendor */
-				"SM-Delivery-Failure-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SMSMI-Correlation-ID */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3324,	/* Code */
-				10415,	/* Vendor */
-				"SMSMI-Correlation-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* IP-SM-GW-SM-Delivery-Outcome */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3320,	/* Code */
-				10415,	/* Vendor */
-				"IP-SM-GW-SM-Delivery-Outcome",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MSC-SM-Delivery-Outcome */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3318,	/* Code */
-				10415,	/* Vendor */
-				"MSC-SM-Delivery-Outcome",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MME-SM-Delivery-Outcome */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3317,	/* Code */
-				10415,	/* Vendor */
-				"MME-SM-Delivery-Outcome",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SM-Delivery-Outcome */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3316,	/* Code */
-				10415,	/* Vendor */
-				"SM-Delivery-Outcome",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29338_avps_defs );
 
    /* Commands section */
    {
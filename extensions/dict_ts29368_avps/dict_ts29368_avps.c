@@ -43,6 +43,12 @@ const double ts29368_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,65 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts29368_avps_defs[] = {
+	/* Payload */
+	{ DICT_AVP, &(struct dict_avp_data){ 3004, 10415, "Payload", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Action-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Action-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Non_Priority", { .i32=0 } }, "3GPP/Enumerated(Action-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Priority", { .i32=1 } }, "3GPP/Enumerated(Action-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Report", { .i32=2 } }, "3GPP/Enumerated(Action-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Recall", { .i32=3 } }, "3GPP/Enumerated(Action-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Replace", { .i32=4 } }, "3GPP/Enumerated(Action-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Delivery", { .i32=5 } }, "3GPP/Enumerated(Action-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3005, 10415, "Action-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Action-Type)" },
+	/* Priority-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Priority-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Non-Priority", { .i32=0 } }, "3GPP/Enumerated(Priority-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Priority", { .i32=1 } }, "3GPP/Enumerated(Priority-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3006, 10415, "Priority-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Priority-Indication)" },
+	/* Reference-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 3007, 10415, "Reference-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Request-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Request-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUCCESS", { .i32=0 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INVPAYLOAD", { .i32=101 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INVEXTID", { .i32=102 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INVSCSID", { .i32=103 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INVPERIOD", { .i32=104 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOTAUTHORIZED", { .i32=105 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SERVICEUNAVAILABLE", { .i32=106 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PERMANENTERROR", { .i32=107 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QUOTAEXCEEDED", { .i32=108 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RATEEXCEEDED", { .i32=109 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REPLACEFAIL", { .i32=110 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RECALLFAIL", { .i32=111 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ORIGINALMESSAGESENT", { .i32=112 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TEMPORARYERROR", { .i32=201 } }, "3GPP/Enumerated(Request-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3008, 10415, "Request-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Request-Status)" },
+	/* Delivery-Outcome */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Delivery-Outcome)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUCCESS", { .i32=0 } }, "3GPP/Enumerated(Delivery-Outcome)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EXPIRED", { .i32=1 } }, "3GPP/Enumerated(Delivery-Outcome)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TEMPORARYERROR", { .i32=2 } }, "3GPP/Enumerated(Delivery-Outcome)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNDELIVERABLE", { .i32=3 } }, "3GPP/Enumerated(Delivery-Outcome)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNCONFIRMED", { .i32=4 } }, "3GPP/Enumerated(Delivery-Outcome)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3009, 10415, "Delivery-Outcome", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Delivery-Outcome)" },
+	/* Application-Port-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3010, 10415, "Application-Port-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Old-Reference-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 3011, 10415, "Old-Reference-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Feature-Supported-In-Final-Target */
+	{ DICT_AVP, &(struct dict_avp_data){ 3012, 10415, "Feature-Supported-In-Final-Target", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Trigger-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 3003, 10415, "Trigger-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Device-Notification */
+	{ DICT_AVP, &(struct dict_avp_data){ 3002, 10415, "Device-Notification", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Device-Action */
+	{ DICT_AVP, &(struct dict_avp_data){ 3001, 10415, "Device-Action", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts29368_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,243 +175,7 @@ static int dict_ts29368_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* Payload */
-		{
-			struct dict_avp_data data = {
-				3004,	/* Code */
-				10415,	/* Vendor */
-				"Payload",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Action-Type */
-		{
-			struct dict_avp_data data = {
-				3005,	/* Code */
-				10415,	/* Vendor */
-				"Action-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Action-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Non_Priority", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Priority", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Report", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "Recall", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "Replace", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "Delivery", { .i32=5 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Priority-Indication */
-		{
-			struct dict_avp_data data = {
-				3006,	/* Code */
-				10415,	/* Vendor */
-				"Priority-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Priority-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Non-Priority", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Priority", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Reference-Number */
-		{
-			struct dict_avp_data data = {
-				3007,	/* Code */
-				10415,	/* Vendor */
-				"Reference-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Request-Status */
-		{
-			struct dict_avp_data data = {
-				3008,	/* Code */
-				10415,	/* Vendor */
-				"Request-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Request-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SUCCESS", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "INVPAYLOAD", { .i32=101 }};
-			struct dict_enumval_data        t_3 = { "INVEXTID", { .i32=102 }};
-			struct dict_enumval_data        t_4 = { "INVSCSID", { .i32=103 }};
-			struct dict_enumval_data        t_5 = { "INVPERIOD", { .i32=104 }};
-			struct dict_enumval_data        t_6 = { "NOTAUTHORIZED", { .i32=105 }};
-			struct dict_enumval_data        t_7 = { "SERVICEUNAVAILABLE", { .i32=106 }};
-			struct dict_enumval_data        t_8 = { "PERMANENTERROR", { .i32=107 }};
-			struct dict_enumval_data        t_9 = { "QUOTAEXCEEDED", { .i32=108 }};
-			struct dict_enumval_data        t_10 = { "RATEEXCEEDED", { .i32=109 }};
-			struct dict_enumval_data        t_11 = { "REPLACEFAIL", { .i32=110 }};
-			struct dict_enumval_data        t_12 = { "RECALLFAIL", { .i32=111 }};
-			struct dict_enumval_data        t_13 = { "ORIGINALMESSAGESENT", { .i32=112 }};
-			struct dict_enumval_data        t_14 = { "TEMPORARYERROR", { .i32=201 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Delivery-Outcome */
-		{
-			struct dict_avp_data data = {
-				3009,	/* Code */
-				10415,	/* Vendor */
-				"Delivery-Outcome",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Delivery-Outcome)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SUCCESS", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "EXPIRED", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "TEMPORARYERROR", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "UNDELIVERABLE", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "UNCONFIRMED", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Application-Port-Identifier */
-		{
-			struct dict_avp_data data = {
-				3010,	/* Code */
-				10415,	/* Vendor */
-				"Application-Port-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Old-Reference-Number */
-		{
-			struct dict_avp_data data = {
-				3011,	/* Code */
-				10415,	/* Vendor */
-				"Old-Reference-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Feature-Supported-In-Final-Target */
-		{
-			struct dict_avp_data data = {
-				3012,	/* Code */
-				10415,	/* Vendor */
-				"Feature-Supported-In-Final-Target",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Trigger-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3003,	/* Code */
-				10415,	/* Vendor */
-				"Trigger-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Device-Notification */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3002,	/* Code */
-				10415,	/* Vendor */
-				"Device-Notification",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Device-Action */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3001,	/* Code */
-				10415,	/* Vendor */
-				"Device-Action",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts29368_avps_defs );
 
    /* Commands section */
    {
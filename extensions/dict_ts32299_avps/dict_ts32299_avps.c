@@ -43,6 +43,12 @@ const double ts32299_avps_gen_date = GEN_DATE;
 #define CHECK_dict_search( _type, _criteria, _what, _result )		\
     CHECK_FCT(  fd_dict_search( fd_g_config->cnf_dict, (_type), (_criteria), (_what), (_result), ENOENT) );
 
+#define CHECK_dict_new_batch( _defs )                                                     \
+{                                                                                         \
+    int _conflicts;                                                                       \
+    CHECK_FCT( fd_dict_new_batch( fd_g_config->cnf_dict, (_defs), sizeof(_defs) / sizeof((_defs)[0]), &_conflicts ) ); \
+}
+
 struct local_rules_definition {
     struct dict_avp_request avp_vendor_plus_name;
     enum rule_position	position;
@@ -97,6 +103,1227 @@ struct local_rules_definition {
     { _str_, 		{ .os = { .data = (unsigned char *)_val_, .len = _len_ }}}
 
 
+/* AVP section */
+static struct dict_object_def dict_ts32299_avps_defs[] = {
+	/* 3GPP-PS-Data-Off-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Active", { .i32=0 } }, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Inactive", { .i32=1 } }, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 4406, 10415, "3GPP-PS-Data-Off-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)" },
+	/* Access-Network-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1263, 10415, "Access-Network-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Access-Transfer-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Access-Transfer-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PS_to_CS_Transfer", { .i32=0 } }, "3GPP/Enumerated(Access-Transfer-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CS_to_PS_Transfer", { .i32=1 } }, "3GPP/Enumerated(Access-Transfer-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PS_to_PS_Transfer", { .i32=2 } }, "3GPP/Enumerated(Access-Transfer-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CS_to_CS_Transfer", { .i32=3 } }, "3GPP/Enumerated(Access-Transfer-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2710, 10415, "Access-Transfer-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Access-Transfer-Type)" },
+	/* Account-Expiration */
+	{ DICT_AVP, &(struct dict_avp_data){ 2309, 10415, "Account-Expiration", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Adaptations */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Adaptations)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Yes", { .i32=0 } }, "3GPP/Enumerated(Adaptations)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "No", { .i32=1 } }, "3GPP/Enumerated(Adaptations)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1217, 10415, "Adaptations", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Adaptations)" },
+	/* Additional-Exception-Reports */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Additional-Exception-Reports)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Not_allowed", { .i32=0 } }, "3GPP/Enumerated(Additional-Exception-Reports)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Allowed", { .i32=1 } }, "3GPP/Enumerated(Additional-Exception-Reports)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3936, 10415, "Additional-Exception-Reports", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Additional-Exception-Reports)" },
+	/* Additional-Type-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1205, 10415, "Additional-Type-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Address-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 897, 10415, "Address-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Addressee-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Addressee-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TO", { .i32=0 } }, "3GPP/Enumerated(Addressee-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CC", { .i32=1 } }, "3GPP/Enumerated(Addressee-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BCC", { .i32=2 } }, "3GPP/Enumerated(Addressee-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1208, 10415, "Addressee-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Addressee-Type)" },
+	/* Address-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Address-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "e_mail_address", { .i32=0 } }, "3GPP/Enumerated(Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MSISDN", { .i32=1 } }, "3GPP/Enumerated(Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPv4_Address", { .i32=2 } }, "3GPP/Enumerated(Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IPv6_Address", { .i32=3 } }, "3GPP/Enumerated(Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Numeric_Shortcode", { .i32=4 } }, "3GPP/Enumerated(Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Alphanumeric_Shortcode", { .i32=5 } }, "3GPP/Enumerated(Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Other", { .i32=6 } }, "3GPP/Enumerated(Address-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IMSI", { .i32=7 } }, "3GPP/Enumerated(Address-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 899, 10415, "Address-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Address-Type)" },
+	/* Alternate-Charged-Party-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1280, 10415, "Alternate-Charged-Party-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Announcement-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3905, 10415, "Announcement-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Announcement-Order */
+	{ DICT_AVP, &(struct dict_avp_data){ 3906, 10415, "Announcement-Order", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Announcing-UE-HPLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3426, 10415, "Announcing-UE-HPLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Announcing-UE-VPLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3427, 10415, "Announcing-UE-VPLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* AoC-Format */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(AoC-Format)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MONETARY", { .i32=0 } }, "3GPP/Enumerated(AoC-Format)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NON_MONETARY", { .i32=1 } }, "3GPP/Enumerated(AoC-Format)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CAI", { .i32=2 } }, "3GPP/Enumerated(AoC-Format)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2310, 10415, "AoC-Format", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(AoC-Format)" },
+	/* AoC-Request-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(AoC-Request-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AoC_NOT_REQUESTED", { .i32=0 } }, "3GPP/Enumerated(AoC-Request-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AoC_FULL", { .i32=1 } }, "3GPP/Enumerated(AoC-Request-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AoC_COST_ONLY", { .i32=2 } }, "3GPP/Enumerated(AoC-Request-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AoC_TARIFF_ONLY", { .i32=3 } }, "3GPP/Enumerated(AoC-Request-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2055, 10415, "AoC-Request-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(AoC-Request-Type)" },
+	/* AoC-Service-Obligatory-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(AoC-Service-Obligatory-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NON_BINDING", { .i32=0 } }, "3GPP/Enumerated(AoC-Service-Obligatory-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BINDING", { .i32=1 } }, "3GPP/Enumerated(AoC-Service-Obligatory-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2312, 10415, "AoC-Service-Obligatory-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(AoC-Service-Obligatory-Type)" },
+	/* AoC-Service-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(AoC-Service-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NONE", { .i32=0 } }, "3GPP/Enumerated(AoC-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AOC-S", { .i32=1 } }, "3GPP/Enumerated(AoC-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AOC-D", { .i32=2 } }, "3GPP/Enumerated(AoC-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AOC-E", { .i32=3 } }, "3GPP/Enumerated(AoC-Service-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2313, 10415, "AoC-Service-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(AoC-Service-Type)" },
+	/* Applic-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1218, 10415, "Applic-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Application-Provided-Called-Party-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 837, 10415, "Application-Provided-Called-Party-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Application-Server */
+	{ DICT_AVP, &(struct dict_avp_data){ 836, 10415, "Application-Server", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Application-Specific-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 3458, 10415, "Application-Specific-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Associated-Party-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2035, 10415, "Associated-Party-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Associated-URI */
+	{ DICT_AVP, &(struct dict_avp_data){ 856, 10415, "Associated-URI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Authorised-QoS */
+	{ DICT_AVP, &(struct dict_avp_data){ 849, 10415, "Authorised-QoS", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Aux-Applic-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1219, 10415, "Aux-Applic-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Base-Time-Interval */
+	{ DICT_AVP, &(struct dict_avp_data){ 1265, 10415, "Base-Time-Interval", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Bearer-Capability */
+	{ DICT_AVP, &(struct dict_avp_data){ 3412, 10415, "Bearer-Capability", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Bearer-Service */
+	{ DICT_AVP, &(struct dict_avp_data){ 854, 10415, "Bearer-Service", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* BSSID */
+	{ DICT_AVP, &(struct dict_avp_data){ 2716, 10415, "BSSID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Called-Asserted-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 1250, 10415, "Called-Asserted-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Called-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 3916, 10415, "Called-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Called-Party-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 832, 10415, "Called-Party-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Calling-Party-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 831, 10415, "Calling-Party-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Carrier-Select-Routing-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2023, 10415, "Carrier-Select-Routing-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Cause-Code */
+	{ DICT_AVP, &(struct dict_avp_data){ 861, 10415, "Cause-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* Cellular-Network-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 3924, 10415, "Cellular-Network-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* CG-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 846, 10415, "CG-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Change-Condition */
+	{ DICT_AVP, &(struct dict_avp_data){ 2037, 10415, "Change-Condition", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* Change-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 2038, 10415, "Change-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Charge-Reason-Code */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Charge-Reason-Code)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNKNOWN", { .i32=0 } }, "3GPP/Enumerated(Charge-Reason-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "USAGE", { .i32=1 } }, "3GPP/Enumerated(Charge-Reason-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "COMMUNICATION_ATTEMPT_CHARGE", { .i32=2 } }, "3GPP/Enumerated(Charge-Reason-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SETUP_CHARGE", { .i32=3 } }, "3GPP/Enumerated(Charge-Reason-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ADD_ON_CHARGE", { .i32=4 } }, "3GPP/Enumerated(Charge-Reason-Code)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2118, 10415, "Charge-Reason-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Charge-Reason-Code)" },
+	/* Charged-Party */
+	{ DICT_AVP, &(struct dict_avp_data){ 857, 10415, "Charged-Party", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Charging-Characteristics-Selection-Mode */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Charging-Characteristics-Selection-Mode)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Serving_Node_Supplied", { .i32=0 } }, "3GPP/Enumerated(Charging-Characteristics-Selection-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Subscription_specific", { .i32=1 } }, "3GPP/Enumerated(Charging-Characteristics-Selection-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "APN_specific", { .i32=2 } }, "3GPP/Enumerated(Charging-Characteristics-Selection-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Home_Default", { .i32=3 } }, "3GPP/Enumerated(Charging-Characteristics-Selection-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Roaming_Default", { .i32=4 } }, "3GPP/Enumerated(Charging-Characteristics-Selection-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Visiting_Default", { .i32=5 } }, "3GPP/Enumerated(Charging-Characteristics-Selection-Mode)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2066, 10415, "Charging-Characteristics-Selection-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Charging-Characteristics-Selection-Mode)" },
+	/* Charging-Per-IP-CAN-Session-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Charging-Per-IP-CAN-Session-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Inactive", { .i32=0 } }, "3GPP/Enumerated(Charging-Per-IP-CAN-Session-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Active", { .i32=1 } }, "3GPP/Enumerated(Charging-Per-IP-CAN-Session-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 4400, 10415, "Charging-Per-IP-CAN-Session-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Charging-Per-IP-CAN-Session-Indicator)" },
+	/* Class-Identifier */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Class-Identifier)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Personal", { .i32=0 } }, "3GPP/Enumerated(Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Advertisement", { .i32=1 } }, "3GPP/Enumerated(Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Informational", { .i32=2 } }, "3GPP/Enumerated(Class-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Auto", { .i32=3 } }, "3GPP/Enumerated(Class-Identifier)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1214, 10415, "Class-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Class-Identifier)" },
+	/* Client-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2018, 10415, "Client-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* CN-Operator-Selection-Entity */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(CN-Operator-Selection-Entity)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "The_Serving_Network_has_been_selected_by_the_UE", { .i32=0 } }, "3GPP/Enumerated(CN-Operator-Selection-Entity)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "The_Serving_Network_has_been_selected_by_the_network", { .i32=1 } }, "3GPP/Enumerated(CN-Operator-Selection-Entity)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3421, 10415, "CN-Operator-Selection-Entity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(CN-Operator-Selection-Entity)" },
+	/* Content-Class */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Content-Class)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "text", { .i32=0 } }, "3GPP/Enumerated(Content-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "image_basic", { .i32=1 } }, "3GPP/Enumerated(Content-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "image_rich", { .i32=2 } }, "3GPP/Enumerated(Content-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "video_basic", { .i32=3 } }, "3GPP/Enumerated(Content-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "video_rich", { .i32=4 } }, "3GPP/Enumerated(Content-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "megapixel", { .i32=5 } }, "3GPP/Enumerated(Content-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "content_basic", { .i32=6 } }, "3GPP/Enumerated(Content-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "content_rich", { .i32=7 } }, "3GPP/Enumerated(Content-Class)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1220, 10415, "Content-Class", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Content-Class)" },
+	/* Content-Disposition */
+	{ DICT_AVP, &(struct dict_avp_data){ 828, 10415, "Content-Disposition", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Content-Length */
+	{ DICT_AVP, &(struct dict_avp_data){ 827, 10415, "Content-Length", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Content-Size */
+	{ DICT_AVP, &(struct dict_avp_data){ 1206, 10415, "Content-Size", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Content-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 826, 10415, "Content-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Coverage-Status */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Coverage-Status)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Out_of_coverage", { .i32=0 } }, "3GPP/Enumerated(Coverage-Status)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "In_coverage", { .i32=1 } }, "3GPP/Enumerated(Coverage-Status)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3428, 10415, "Coverage-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Coverage-Status)" },
+	/* CP-CIoT-EPS-Optimisation-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(CP-CIoT-EPS-Optimisation-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Not_Apply", { .i32=0 } }, "3GPP/Enumerated(CP-CIoT-EPS-Optimisation-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Apply", { .i32=1 } }, "3GPP/Enumerated(CP-CIoT-EPS-Optimisation-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3930, 10415, "CP-CIoT-EPS-Optimisation-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(CP-CIoT-EPS-Optimisation-Indicator)" },
+	/* CSG-Access-Mode */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(CSG-Access-Mode)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Closed_mode", { .i32=0 } }, "3GPP/Enumerated(CSG-Access-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Hybrid_Mode", { .i32=1 } }, "3GPP/Enumerated(CSG-Access-Mode)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2317, 10415, "CSG-Access-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(CSG-Access-Mode)" },
+	/* CSG-Membership-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(CSG-Membership-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Not_CSG_member", { .i32=0 } }, "3GPP/Enumerated(CSG-Membership-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CSG_Member", { .i32=1 } }, "3GPP/Enumerated(CSG-Membership-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2318, 10415, "CSG-Membership-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(CSG-Membership-Indication)" },
+	/* CUG-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2304, 10415, "CUG-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Data-Coding-Scheme */
+	{ DICT_AVP, &(struct dict_avp_data){ 2001, 10415, "Data-Coding-Scheme", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* Deferred-Location-Event-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 1230, 10415, "Deferred-Location-Event-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Delivery-Report-Requested */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Delivery-Report-Requested)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "No", { .i32=0 } }, "3GPP/Enumerated(Delivery-Report-Requested)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Yes", { .i32=1 } }, "3GPP/Enumerated(Delivery-Report-Requested)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1216, 10415, "Delivery-Report-Requested", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Delivery-Report-Requested)" },
+	/* Diagnostics */
+	{ DICT_AVP, &(struct dict_avp_data){ 2039, 10415, "Diagnostics", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* Discoveree-UE-HPLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 4402, 10415, "Discoveree-UE-HPLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Discoveree-UE-VPLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 4403, 10415, "Discoveree-UE-VPLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Discoverer-UE-HPLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 4404, 10415, "Discoverer-UE-HPLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Discoverer-UE-VPLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 4405, 10415, "Discoverer-UE-VPLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Domain-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1200, 10415, "Domain-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* DRM-Content */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(DRM-Content)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "No", { .i32=0 } }, "3GPP/Enumerated(DRM-Content)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Yes", { .i32=1 } }, "3GPP/Enumerated(DRM-Content)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1221, 10415, "DRM-Content", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(DRM-Content)" },
+	/* Dynamic-Address-Flag */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Dynamic-Address-Flag)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Static", { .i32=0 } }, "3GPP/Enumerated(Dynamic-Address-Flag)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Dynamic", { .i32=1 } }, "3GPP/Enumerated(Dynamic-Address-Flag)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2051, 10415, "Dynamic-Address-Flag", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Dynamic-Address-Flag)" },
+	/* Dynamic-Address-Flag-Extension */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Dynamic-Address-Flag-Extension)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Static", { .i32=0 } }, "3GPP/Enumerated(Dynamic-Address-Flag-Extension)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Dynamic", { .i32=1 } }, "3GPP/Enumerated(Dynamic-Address-Flag-Extension)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2068, 10415, "Dynamic-Address-Flag-Extension", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Dynamic-Address-Flag-Extension)" },
+	/* Envelope-End-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1267, 10415, "Envelope-End-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Envelope-Reporting */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Envelope-Reporting)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DO_NOT_REPORT_ENVELOPES", { .i32=0 } }, "3GPP/Enumerated(Envelope-Reporting)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REPORT_ENVELOPES", { .i32=1 } }, "3GPP/Enumerated(Envelope-Reporting)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REPORT_ENVELOPES_WITH_VOLUME", { .i32=2 } }, "3GPP/Enumerated(Envelope-Reporting)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REPORT_ENVELOPES_WITH_EVENTS", { .i32=3 } }, "3GPP/Enumerated(Envelope-Reporting)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "REPORT_ENVELOPES_WITH_VOLUME_AND_EVENTS", { .i32=4 } }, "3GPP/Enumerated(Envelope-Reporting)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1268, 10415, "Envelope-Reporting", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Envelope-Reporting)" },
+	/* Envelope-Start-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1269, 10415, "Envelope-Start-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* EPDG-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3425, 10415, "EPDG-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Event */
+	{ DICT_AVP, &(struct dict_avp_data){ 825, 10415, "Event", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Event-Charging-TimeStamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 1258, 10415, "Event-Charging-TimeStamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Expires */
+	{ DICT_AVP, &(struct dict_avp_data){ 888, 10415, "Expires", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* File-Repair-Supported */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(File-Repair-Supported)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUPPORTED", { .i32=1 } }, "3GPP/Enumerated(File-Repair-Supported)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOT_SUPPORTED", { .i32=2 } }, "3GPP/Enumerated(File-Repair-Supported)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1224, 10415, "File-Repair-Supported", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(File-Repair-Supported)" },
+	/* Forwarding-Pending */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Forwarding-Pending)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Forwarding_not_pending", { .i32=0 } }, "3GPP/Enumerated(Forwarding-Pending)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Forwarding_pending", { .i32=1 } }, "3GPP/Enumerated(Forwarding-Pending)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3415, 10415, "Forwarding-Pending", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Forwarding-Pending)" },
+	/* From-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2708, 10415, "From-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* GGSN-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 847, 10415, "GGSN-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* IMS-Application-Reference-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 2601, 10415, "IMS-Application-Reference-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* IMS-Charging-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 841, 10415, "IMS-Charging-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* IMS-Communication-Service-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 1281, 10415, "IMS-Communication-Service-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* IMS-Emergency-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(IMS-Emergency-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Non_Emergency", { .i32=0 } }, "3GPP/Enumerated(IMS-Emergency-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Emergency", { .i32=1 } }, "3GPP/Enumerated(IMS-Emergency-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2322, 10415, "IMS-Emergency-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(IMS-Emergency-Indicator)" },
+	/* IMS-Visited-Network-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 2713, 10415, "IMS-Visited-Network-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* IMSI-Unauthenticated-Flag */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(IMSI-Unauthenticated-Flag)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Authenticated", { .i32=0 } }, "3GPP/Enumerated(IMSI-Unauthenticated-Flag)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Unauthenticated", { .i32=1 } }, "3GPP/Enumerated(IMSI-Unauthenticated-Flag)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2308, 10415, "IMSI-Unauthenticated-Flag", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(IMSI-Unauthenticated-Flag)" },
+	/* Incoming-Trunk-Group-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 852, 10415, "Incoming-Trunk-Group-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Initial-IMS-Charging-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 2321, 10415, "Initial-IMS-Charging-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Instance-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 3402, 10415, "Instance-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Interface-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 2003, 10415, "Interface-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Interface-Port */
+	{ DICT_AVP, &(struct dict_avp_data){ 2004, 10415, "Interface-Port", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Interface-Text */
+	{ DICT_AVP, &(struct dict_avp_data){ 2005, 10415, "Interface-Text", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Interface-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Interface-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Unknown", { .i32=0 } }, "3GPP/Enumerated(Interface-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MOBILE_ORIGINATING", { .i32=1 } }, "3GPP/Enumerated(Interface-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MOBILE_TERMINATING", { .i32=2 } }, "3GPP/Enumerated(Interface-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "APPLICATION_ORIGINATING", { .i32=3 } }, "3GPP/Enumerated(Interface-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "APPLICATION_TERMINATION", { .i32=4 } }, "3GPP/Enumerated(Interface-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2006, 10415, "Interface-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Interface-Type)" },
+	/* Inter-UE-Transfer */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Inter-UE-Transfer)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Intra_UE_transfer", { .i32=0 } }, "3GPP/Enumerated(Inter-UE-Transfer)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Inter_UE_transfer", { .i32=1 } }, "3GPP/Enumerated(Inter-UE-Transfer)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3902, 10415, "Inter-UE-Transfer", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Inter-UE-Transfer)" },
+	/* IP-Realm-Default-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(IP-Realm-Default-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Default_IP_Realm_Not_used", { .i32=0 } }, "3GPP/Enumerated(IP-Realm-Default-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Default_IP_realm_used", { .i32=1 } }, "3GPP/Enumerated(IP-Realm-Default-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2603, 10415, "IP-Realm-Default-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(IP-Realm-Default-Indication)" },
+	/* ISUP-Cause-Diagnostics */
+	{ DICT_AVP, &(struct dict_avp_data){ 3422, 10415, "ISUP-Cause-Diagnostics", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* ISUP-Cause-Location */
+	{ DICT_AVP, &(struct dict_avp_data){ 3423, 10415, "ISUP-Cause-Location", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* ISUP-Cause-Value */
+	{ DICT_AVP, &(struct dict_avp_data){ 3424, 10415, "ISUP-Cause-Value", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* ISUP-Location-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 3414, 10415, "ISUP-Location-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Language */
+	{ DICT_AVP, &(struct dict_avp_data){ 3914, 10415, "Language", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Layer-2-Group-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 3429, 10415, "Layer-2-Group-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* LCS-APN */
+	{ DICT_AVP, &(struct dict_avp_data){ 1231, 10415, "LCS-APN", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* LCS-Client-Dialed-By-MS */
+	{ DICT_AVP, &(struct dict_avp_data){ 1233, 10415, "LCS-Client-Dialed-By-MS", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* LCS-Client-External-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1234, 10415, "LCS-Client-External-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* LCS-Client-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(LCS-Client-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EMERGENCY_SERVICES", { .i32=0 } }, "3GPP/Enumerated(LCS-Client-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VALUE_ADDED_SERVICES", { .i32=1 } }, "3GPP/Enumerated(LCS-Client-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PLMN_OPERATOR_SERVICES", { .i32=2 } }, "3GPP/Enumerated(LCS-Client-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LAWFUL_INTERCEPT_SERVICES", { .i32=3 } }, "3GPP/Enumerated(LCS-Client-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1241, 10415, "LCS-Client-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(LCS-Client-Type)" },
+	/* LCS-Data-Coding-Scheme */
+	{ DICT_AVP, &(struct dict_avp_data){ 1236, 10415, "LCS-Data-Coding-Scheme", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* LCS-Format-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(LCS-Format-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "LOGICAL_NAME", { .i32=0 } }, "3GPP/Enumerated(LCS-Format-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EMAIL_ADDRESS", { .i32=1 } }, "3GPP/Enumerated(LCS-Format-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MSISDN", { .i32=2 } }, "3GPP/Enumerated(LCS-Format-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "URL", { .i32=3 } }, "3GPP/Enumerated(LCS-Format-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SIP_URL", { .i32=4 } }, "3GPP/Enumerated(LCS-Format-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1237, 10415, "LCS-Format-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(LCS-Format-Indicator)" },
+	/* LCS-Name-String */
+	{ DICT_AVP, &(struct dict_avp_data){ 1238, 10415, "LCS-Name-String", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* LCS-Requestor-ID-String */
+	{ DICT_AVP, &(struct dict_avp_data){ 1240, 10415, "LCS-Requestor-ID-String", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Local-GW-Inserted-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Local-GW-Inserted-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Local_GW_Not_Inserted", { .i32=0 } }, "3GPP/Enumerated(Local-GW-Inserted-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Local_GW_Inserted", { .i32=1 } }, "3GPP/Enumerated(Local-GW-Inserted-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2604, 10415, "Local-GW-Inserted-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Local-GW-Inserted-Indication)" },
+	/* Local-Sequence-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 2063, 10415, "Local-Sequence-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Location-Estimate */
+	{ DICT_AVP, &(struct dict_avp_data){ 1242, 10415, "Location-Estimate", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Location-Estimate-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Location-Estimate-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CURRENT_LOCATION", { .i32=0 } }, "3GPP/Enumerated(Location-Estimate-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CURRENT_LAST_KNOWN_LOCATION", { .i32=1 } }, "3GPP/Enumerated(Location-Estimate-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INITIAL_LOCATION", { .i32=2 } }, "3GPP/Enumerated(Location-Estimate-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ACTIVATE_DEFERRED_LOCATION", { .i32=3 } }, "3GPP/Enumerated(Location-Estimate-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CANCEL_DEFERRED_LOCATION", { .i32=4 } }, "3GPP/Enumerated(Location-Estimate-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1243, 10415, "Location-Estimate-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Location-Estimate-Type)" },
+	/* Low-Balance-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Low-Balance-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOT_APPLICABLE", { .i32=0 } }, "3GPP/Enumerated(Low-Balance-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "YES", { .i32=1 } }, "3GPP/Enumerated(Low-Balance-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2020, 10415, "Low-Balance-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Low-Balance-Indication)" },
+	/* Low-Priority-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Low-Priority-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NO", { .i32=0 } }, "3GPP/Enumerated(Low-Priority-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "YES", { .i32=1 } }, "3GPP/Enumerated(Low-Priority-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2602, 10415, "Low-Priority-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Low-Priority-Indicator)" },
+	/* MBMS-Charged-Party */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-Charged-Party)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Content_Provider", { .i32=0 } }, "3GPP/Enumerated(MBMS-Charged-Party)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Subscriber", { .i32=1 } }, "3GPP/Enumerated(MBMS-Charged-Party)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2323, 10415, "MBMS-Charged-Party", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-Charged-Party)" },
+	/* MBMS-GW-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2307, 10415, "MBMS-GW-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* MBMS-User-Service-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-User-Service-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DOWNLOAD", { .i32=1 } }, "3GPP/Enumerated(MBMS-User-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "STREAMING", { .i32=2 } }, "3GPP/Enumerated(MBMS-User-Service-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1225, 10415, "MBMS-User-Service-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MBMS-User-Service-Type)" },
+	/* Media-Initiator-Flag */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Media-Initiator-Flag)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "called_party", { .i32=0 } }, "3GPP/Enumerated(Media-Initiator-Flag)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "calling_party", { .i32=1 } }, "3GPP/Enumerated(Media-Initiator-Flag)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "unknown", { .i32=2 } }, "3GPP/Enumerated(Media-Initiator-Flag)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 882, 10415, "Media-Initiator-Flag", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Media-Initiator-Flag)" },
+	/* Media-Initiator-Party */
+	{ DICT_AVP, &(struct dict_avp_data){ 1288, 10415, "Media-Initiator-Party", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Message-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1210, 10415, "Message-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Message-Size */
+	{ DICT_AVP, &(struct dict_avp_data){ 1212, 10415, "Message-Size", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Message-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Message-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_send_req", { .i32=1 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_forward_req", { .i32=10 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_forward_conf", { .i32=11 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_mbox_store_conf", { .i32=12 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_mbox_view_conf", { .i32=13 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_mbox_upload_conf", { .i32=14 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_mbox_delete_conf", { .i32=15 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_send_conf", { .i32=2 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_notification_ind", { .i32=3 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_notifyresp_ind", { .i32=4 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_retrieve_conf", { .i32=5 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_acknowledge_ind", { .i32=6 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_delivery_ind", { .i32=7 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_read_rec_ind", { .i32=8 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "m_read_orig_ind", { .i32=9 } }, "3GPP/Enumerated(Message-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1211, 10415, "Message-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Message-Type)" },
+	/* MMBox-Storage-Requested */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(MMBox-Storage-Requested)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "No", { .i32=0 } }, "3GPP/Enumerated(MMBox-Storage-Requested)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Yes", { .i32=1 } }, "3GPP/Enumerated(MMBox-Storage-Requested)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1248, 10415, "MMBox-Storage-Requested", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(MMBox-Storage-Requested)" },
+	/* MMTel-SService-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 2031, 10415, "MMTel-SService-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Monitored-PLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3430, 10415, "Monitored-PLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Monitoring-Event-Configuration-Activity */
+	{ DICT_AVP, &(struct dict_avp_data){ 3919, 10415, "Monitoring-Event-Configuration-Activity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* Monitoring-Event-Functionality */
+	{ DICT_AVP, &(struct dict_avp_data){ 3922, 10415, "Monitoring-Event-Functionality", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* Monitoring-Event-Report-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 3923, 10415, "Monitoring-Event-Report-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Monitoring-UE-HPLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3431, 10415, "Monitoring-UE-HPLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Monitoring-UE-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3432, 10415, "Monitoring-UE-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Monitoring-UE-VPLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3433, 10415, "Monitoring-UE-VPLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* MSC-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3417, 10415, "MSC-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* MTC-IWF-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3406, 10415, "MTC-IWF-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Neighbour-Node-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2705, 10415, "Neighbour-Node-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Network-Call-Reference-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 3418, 10415, "Network-Call-Reference-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* NNI-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(NNI-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "non_roaming", { .i32=0 } }, "3GPP/Enumerated(NNI-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "roaming_without_loopback", { .i32=1 } }, "3GPP/Enumerated(NNI-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "roaming_with_loopback", { .i32=2 } }, "3GPP/Enumerated(NNI-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2704, 10415, "NNI-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(NNI-Type)" },
+	/* Node-Functionality */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Node-Functionality)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "S-CSCF", { .i32=0 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "P-CSCF", { .i32=1 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "I-CSCF", { .i32=2 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MRFC", { .i32=3 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MGCF", { .i32=4 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "BGCF", { .i32=5 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "AS", { .i32=6 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IBCF", { .i32=7 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "S-GW", { .i32=8 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "P-GW", { .i32=9 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HSGW", { .i32=10 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "E-CSCF", { .i32=11 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MME", { .i32=12 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TRF", { .i32=13 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TF", { .i32=14 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ATCF", { .i32=15 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Proxy-function", { .i32=16 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ePDG", { .i32=17 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TDF", { .i32=18 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TWAG", { .i32=19 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SCEF", { .i32=20 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IWK-SCEF", { .i32=21 } }, "3GPP/Enumerated(Node-Functionality)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 862, 10415, "Node-Functionality", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Node-Functionality)" },
+	/* Node-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 2064, 10415, "Node-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Number-Of-Diversions */
+	{ DICT_AVP, &(struct dict_avp_data){ 2034, 10415, "Number-Of-Diversions", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Number-Of-Messages-Sent */
+	{ DICT_AVP, &(struct dict_avp_data){ 2019, 10415, "Number-Of-Messages-Sent", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Number-Of-Participants */
+	{ DICT_AVP, &(struct dict_avp_data){ 885, 10415, "Number-Of-Participants", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Number-Of-Received-Talk-Bursts */
+	{ DICT_AVP, &(struct dict_avp_data){ 1282, 10415, "Number-Of-Received-Talk-Bursts", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Number-Of-Talk-Bursts */
+	{ DICT_AVP, &(struct dict_avp_data){ 1283, 10415, "Number-Of-Talk-Bursts", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Number-Portability-Routing-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2024, 10415, "Number-Portability-Routing-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Online-Charging-Flag */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Online-Charging-Flag)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ECF_address_not_provided", { .i32=0 } }, "3GPP/Enumerated(Online-Charging-Flag)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ECF_address_provided", { .i32=1 } }, "3GPP/Enumerated(Online-Charging-Flag)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2303, 10415, "Online-Charging-Flag", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Online-Charging-Flag)" },
+	/* Originating-IOI */
+	{ DICT_AVP, &(struct dict_avp_data){ 839, 10415, "Originating-IOI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Originator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Originator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Calling_Party", { .i32=0 } }, "3GPP/Enumerated(Originator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Called_Party", { .i32=1 } }, "3GPP/Enumerated(Originator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 864, 10415, "Originator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Originator)" },
+	/* Originator-SCCP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2008, 10415, "Originator-SCCP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Outgoing-Session-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 2320, 10415, "Outgoing-Session-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Outgoing-Trunk-Group-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 853, 10415, "Outgoing-Trunk-Group-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Participant-Access-Priority */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Participant-Access-Priority)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Pre_emptive_priority", { .i32=1 } }, "3GPP/Enumerated(Participant-Access-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "High_priority", { .i32=2 } }, "3GPP/Enumerated(Participant-Access-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Normal_priority", { .i32=3 } }, "3GPP/Enumerated(Participant-Access-Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Low_priority", { .i32=4 } }, "3GPP/Enumerated(Participant-Access-Priority)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1259, 10415, "Participant-Access-Priority", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Participant-Access-Priority)" },
+	/* Participant-Action-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Participant-Action-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CREATE_CONF", { .i32=0 } }, "3GPP/Enumerated(Participant-Action-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "JOIN_CONF", { .i32=1 } }, "3GPP/Enumerated(Participant-Action-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "INVITE_INTO_CONF", { .i32=2 } }, "3GPP/Enumerated(Participant-Action-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QUIT_CONF", { .i32=3 } }, "3GPP/Enumerated(Participant-Action-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2049, 10415, "Participant-Action-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Participant-Action-Type)" },
+	/* Participants-Involved */
+	{ DICT_AVP, &(struct dict_avp_data){ 887, 10415, "Participants-Involved", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* PC3-Control-Protocol-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 3434, 10415, "PC3-Control-Protocol-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* PC3-EPC-Control-Protocol-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 3435, 10415, "PC3-EPC-Control-Protocol-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* PDN-Connection-Charging-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 2050, 10415, "PDN-Connection-Charging-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* PDP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1227, 10415, "PDP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* PDP-Address-Prefix-Length */
+	{ DICT_AVP, &(struct dict_avp_data){ 2606, 10415, "PDP-Address-Prefix-Length", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* PDP-Context-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PDP-Context-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Primary", { .i32=0 } }, "3GPP/Enumerated(PDP-Context-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Secondary", { .i32=1 } }, "3GPP/Enumerated(PDP-Context-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1247, 10415, "PDP-Context-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PDP-Context-Type)" },
+	/* Play-Alternative */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Play-Alternative)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "served_party", { .i32=0 } }, "3GPP/Enumerated(Play-Alternative)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "remote_party", { .i32=1 } }, "3GPP/Enumerated(Play-Alternative)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3913, 10415, "Play-Alternative", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Play-Alternative)" },
+	/* PoC-Change-Condition */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Change-Condition)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ServiceChange", { .i32=0 } }, "3GPP/Enumerated(PoC-Change-Condition)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VolumeLimit", { .i32=1 } }, "3GPP/Enumerated(PoC-Change-Condition)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TimeLimit", { .i32=2 } }, "3GPP/Enumerated(PoC-Change-Condition)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NumberofTalkBurstLimit", { .i32=3 } }, "3GPP/Enumerated(PoC-Change-Condition)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NumberofActiveParticipants", { .i32=4 } }, "3GPP/Enumerated(PoC-Change-Condition)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TariffTime", { .i32=5 } }, "3GPP/Enumerated(PoC-Change-Condition)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1261, 10415, "PoC-Change-Condition", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PoC-Change-Condition)" },
+	/* PoC-Change-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1262, 10415, "PoC-Change-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* PoC-Controlling-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 858, 10415, "PoC-Controlling-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* PoC-Event-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Event-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Normal", { .i32=0 } }, "3GPP/Enumerated(PoC-Event-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Instant_Personal_Alert", { .i32=1 } }, "3GPP/Enumerated(PoC-Event-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PoC_Group_Advertisement", { .i32=2 } }, "3GPP/Enumerated(PoC-Event-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Early_Session_Setting_Up", { .i32=3 } }, "3GPP/Enumerated(PoC-Event-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PoC_Talk_Burst", { .i32=4 } }, "3GPP/Enumerated(PoC-Event-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2025, 10415, "PoC-Event-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PoC-Event-Type)" },
+	/* PoC-Group-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 859, 10415, "PoC-Group-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* PoC-Server-Role */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Server-Role)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Participating_PoC_Server", { .i32=0 } }, "3GPP/Enumerated(PoC-Server-Role)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Controlling_PoC_Server", { .i32=1 } }, "3GPP/Enumerated(PoC-Server-Role)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 883, 10415, "PoC-Server-Role", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PoC-Server-Role)" },
+	/* PoC-Session-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1229, 10415, "PoC-Session-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* PoC-Session-Initiation-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Session-Initiation-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Pre_established", { .i32=0 } }, "3GPP/Enumerated(PoC-Session-Initiation-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "On_demand", { .i32=1 } }, "3GPP/Enumerated(PoC-Session-Initiation-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1277, 10415, "PoC-Session-Initiation-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PoC-Session-Initiation-Type)" },
+	/* PoC-Session-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Session-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "1_to_1_PoC", { .i32=0 } }, "3GPP/Enumerated(PoC-Session-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Chat_PoC_Group", { .i32=1 } }, "3GPP/Enumerated(PoC-Session-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Pre_arranged_PoC_Group", { .i32=2 } }, "3GPP/Enumerated(PoC-Session-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Ad_hoc_PoC_Gropu", { .i32=3 } }, "3GPP/Enumerated(PoC-Session-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 884, 10415, "PoC-Session-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PoC-Session-Type)" },
+	/* PoC-User-Role-IDs */
+	{ DICT_AVP, &(struct dict_avp_data){ 1253, 10415, "PoC-User-Role-IDs", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* PoC-User-Role-Info-Units */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-User-Role-Info-Units)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Moderator", { .i32=1 } }, "3GPP/Enumerated(PoC-User-Role-Info-Units)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Dispatcher", { .i32=2 } }, "3GPP/Enumerated(PoC-User-Role-Info-Units)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Session_Owner", { .i32=3 } }, "3GPP/Enumerated(PoC-User-Role-Info-Units)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Session_Participant", { .i32=4 } }, "3GPP/Enumerated(PoC-User-Role-Info-Units)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1254, 10415, "PoC-User-Role-Info-Units", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PoC-User-Role-Info-Units)" },
+	/* Positioning-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 1245, 10415, "Positioning-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Preferred-AoC-Currency */
+	{ DICT_AVP, &(struct dict_avp_data){ 2315, 10415, "Preferred-AoC-Currency", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Priority */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Priority)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Low", { .i32=0 } }, "3GPP/Enumerated(Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Normal", { .i32=1 } }, "3GPP/Enumerated(Priority)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "High", { .i32=2 } }, "3GPP/Enumerated(Priority)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1209, 10415, "Priority", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Priority)" },
+	/* Privacy-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Privacy-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NOT_PRIVATE", { .i32=0 } }, "3GPP/Enumerated(Privacy-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PRIVATE", { .i32=1 } }, "3GPP/Enumerated(Privacy-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3915, 10415, "Privacy-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Privacy-Indicator)" },
+	/* ProSe-3rd-Party-Application-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 3440, 10415, "ProSe-3rd-Party-Application-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* ProSe-Direct-Discovery-Model */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Direct-Discovery-Model)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Model_A", { .i32=0 } }, "3GPP/Enumerated(ProSe-Direct-Discovery-Model)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Model_B", { .i32=1 } }, "3GPP/Enumerated(ProSe-Direct-Discovery-Model)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3442, 10415, "ProSe-Direct-Discovery-Model", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(ProSe-Direct-Discovery-Model)" },
+	/* ProSe-Event-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Event-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Annoucing", { .i32=0 } }, "3GPP/Enumerated(ProSe-Event-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Monitoring", { .i32=1 } }, "3GPP/Enumerated(ProSe-Event-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Match_Report", { .i32=2 } }, "3GPP/Enumerated(ProSe-Event-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3443, 10415, "ProSe-Event-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(ProSe-Event-Type)" },
+	/* ProSe-Function-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3444, 10415, "ProSe-Function-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* ProSe-Function-PLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3457, 10415, "ProSe-Function-PLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* ProSe-Functionality */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Functionality)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Direct_discovery", { .i32=0 } }, "3GPP/Enumerated(ProSe-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "EPC_level_discovery", { .i32=1 } }, "3GPP/Enumerated(ProSe-Functionality)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Direct_communication", { .i32=2 } }, "3GPP/Enumerated(ProSe-Functionality)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3445, 10415, "ProSe-Functionality", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(ProSe-Functionality)" },
+	/* ProSe-Group-IP-Multicast-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3446, 10415, "ProSe-Group-IP-Multicast-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* ProSe-Range-Class */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Range-Class)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Reserved", { .i32=0 } }, "3GPP/Enumerated(ProSe-Range-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "50_m", { .i32=1 } }, "3GPP/Enumerated(ProSe-Range-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "100_m", { .i32=2 } }, "3GPP/Enumerated(ProSe-Range-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Unused", { .i32=255 } }, "3GPP/Enumerated(ProSe-Range-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "200_m", { .i32=3 } }, "3GPP/Enumerated(ProSe-Range-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "500_m", { .i32=4 } }, "3GPP/Enumerated(ProSe-Range-Class)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "1000_m", { .i32=5 } }, "3GPP/Enumerated(ProSe-Range-Class)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3448, 10415, "ProSe-Range-Class", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(ProSe-Range-Class)" },
+	/* ProSe-Reason-For-Cancellation */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Reason-For-Cancellation)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Proximity_Alert_sent", { .i32=0 } }, "3GPP/Enumerated(ProSe-Reason-For-Cancellation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Time_expired_with_no_renewal", { .i32=1 } }, "3GPP/Enumerated(ProSe-Reason-For-Cancellation)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Requestor_cancellation", { .i32=2 } }, "3GPP/Enumerated(ProSe-Reason-For-Cancellation)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3449, 10415, "ProSe-Reason-For-Cancellation", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(ProSe-Reason-For-Cancellation)" },
+	/* ProSe-Request-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 3450, 10415, "ProSe-Request-Timestamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* ProSe-Role-Of-UE */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Role-Of-UE)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Announcing_UE", { .i32=0 } }, "3GPP/Enumerated(ProSe-Role-Of-UE)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Monitoring_UE", { .i32=1 } }, "3GPP/Enumerated(ProSe-Role-Of-UE)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Requestor_UE", { .i32=2 } }, "3GPP/Enumerated(ProSe-Role-Of-UE)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Requested_UE", { .i32=3 } }, "3GPP/Enumerated(ProSe-Role-Of-UE)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3451, 10415, "ProSe-Role-Of-UE", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(ProSe-Role-Of-UE)" },
+	/* ProSe-Source-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3452, 10415, "ProSe-Source-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* ProSe-UE-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 3453, 10415, "ProSe-UE-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Proximity-Alert-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Proximity-Alert-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Alert", { .i32=0 } }, "3GPP/Enumerated(Proximity-Alert-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "No_Alert", { .i32=1 } }, "3GPP/Enumerated(Proximity-Alert-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3454, 10415, "Proximity-Alert-Indication", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Proximity-Alert-Indication)" },
+	/* Proximity-Alert-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 3455, 10415, "Proximity-Alert-Timestamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Proximity-Cancellation-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 3456, 10415, "Proximity-Cancellation-Timestamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* PS-Append-Free-Format-Data */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(PS-Append-Free-Format-Data)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Append", { .i32=0 } }, "3GPP/Enumerated(PS-Append-Free-Format-Data)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Overwrite", { .i32=1 } }, "3GPP/Enumerated(PS-Append-Free-Format-Data)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 867, 10415, "PS-Append-Free-Format-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(PS-Append-Free-Format-Data)" },
+	/* PS-Free-Format-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 866, 10415, "PS-Free-Format-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Quota-Consumption-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 881, 10415, "Quota-Consumption-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Quota-Holding-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 871, 10415, "Quota-Holding-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Quota-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Quota-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QUOTA_IS_NOT_USED_DURING_PLAYBACK", { .i32=0 } }, "3GPP/Enumerated(Quota-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QUOTA_IS_USED_DURING_PLAYBACK", { .i32=1 } }, "3GPP/Enumerated(Quota-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3912, 10415, "Quota-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Quota-Indicator)" },
+	/* Radio-Frequency */
+	{ DICT_AVP, &(struct dict_avp_data){ 3462, 10415, "Radio-Frequency", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Radio-Parameter-Set-Values */
+	{ DICT_AVP, &(struct dict_avp_data){ 3464, 10415, "Radio-Parameter-Set-Values", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Radio-Resources-Indicator */
+	{ DICT_AVP, &(struct dict_avp_data){ 3465, 10415, "Radio-Resources-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, NULL },
+	/* Rate-Control-Max-Message-Size */
+	{ DICT_AVP, &(struct dict_avp_data){ 3937, 10415, "Rate-Control-Max-Message-Size", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Rate-Control-Max-Rate */
+	{ DICT_AVP, &(struct dict_avp_data){ 3938, 10415, "Rate-Control-Max-Rate", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Rate-Control-Time-Unit */
+	{ DICT_AVP, &(struct dict_avp_data){ 3939, 10415, "Rate-Control-Time-Unit", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Read-Reply-Report-Requested */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Read-Reply-Report-Requested)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "No", { .i32=0 } }, "3GPP/Enumerated(Read-Reply-Report-Requested)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Yes", { .i32=1 } }, "3GPP/Enumerated(Read-Reply-Report-Requested)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1222, 10415, "Read-Reply-Report-Requested", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Read-Reply-Report-Requested)" },
+	/* Reason-Header */
+	{ DICT_AVP, &(struct dict_avp_data){ 3401, 10415, "Reason-Header", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Received-Talk-Burst-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1284, 10415, "Received-Talk-Burst-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Received-Talk-Burst-Volume */
+	{ DICT_AVP, &(struct dict_avp_data){ 1285, 10415, "Received-Talk-Burst-Volume", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Recipient-SCCP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2010, 10415, "Recipient-SCCP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Refund-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2022, 10415, "Refund-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Related-IMS-Charging-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 2711, 10415, "Related-IMS-Charging-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Related-IMS-Charging-Identifier-Node */
+	{ DICT_AVP, &(struct dict_avp_data){ 2712, 10415, "Related-IMS-Charging-Identifier-Node", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Relationship-Mode */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Relationship-Mode)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "trusted", { .i32=0 } }, "3GPP/Enumerated(Relationship-Mode)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "non_trusted", { .i32=1 } }, "3GPP/Enumerated(Relationship-Mode)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2706, 10415, "Relationship-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Relationship-Mode)" },
+	/* Reply-Applic-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1223, 10415, "Reply-Applic-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Reply-Path-Requested */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Reply-Path-Requested)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "No_Reply_Path_Set", { .i32=0 } }, "3GPP/Enumerated(Reply-Path-Requested)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Reply_path_Set", { .i32=1 } }, "3GPP/Enumerated(Reply-Path-Requested)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2011, 10415, "Reply-Path-Requested", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Reply-Path-Requested)" },
+	/* Reporting-Reason */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Reporting-Reason)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "THRESHOLD", { .i32=0 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QHT", { .i32=1 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FINAL", { .i32=2 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "QUOTA_EXHAUSTED", { .i32=3 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VALIDITY_TIME", { .i32=4 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "OTHER_QUOTA_TYPE", { .i32=5 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "RATING_CONDITION_CHANGE", { .i32=6 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FORCED_REAUTHORISATION", { .i32=7 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "POOL_EXHAUSTED", { .i32=8 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNUSED_QUOTA_TIMER", { .i32=9 } }, "3GPP/Enumerated(Reporting-Reason)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 872, 10415, "Reporting-Reason", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Reporting-Reason)" },
+	/* Requested-Party-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1251, 10415, "Requested-Party-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Requested-PLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3436, 10415, "Requested-PLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Requestor-PLMN-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 3437, 10415, "Requestor-PLMN-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Role-Of-Node */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Role-Of-Node)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ORIGINATING_ROLE", { .i32=0 } }, "3GPP/Enumerated(Role-Of-Node)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TERMINATING_ROLE", { .i32=1 } }, "3GPP/Enumerated(Role-Of-Node)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FORWARDING_ROLE", { .i32=2 } }, "3GPP/Enumerated(Role-Of-Node)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 829, 10415, "Role-Of-Node", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Role-Of-Node)" },
+	/* Role-Of-ProSe-Function */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Role-Of-ProSe-Function)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "HPLMN", { .i32=0 } }, "3GPP/Enumerated(Role-Of-ProSe-Function)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VPLMN", { .i32=1 } }, "3GPP/Enumerated(Role-Of-ProSe-Function)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Local_PLMN", { .i32=2 } }, "3GPP/Enumerated(Role-Of-ProSe-Function)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3438, 10415, "Role-Of-ProSe-Function", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Role-Of-ProSe-Function)" },
+	/* Route-Header-Received */
+	{ DICT_AVP, &(struct dict_avp_data){ 3403, 10415, "Route-Header-Received", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Route-Header-Transmitted */
+	{ DICT_AVP, &(struct dict_avp_data){ 3404, 10415, "Route-Header-Transmitted", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* SCS-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3941, 10415, "SCS-Address", 0, 0, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* SCS-Realm */
+	{ DICT_AVP, &(struct dict_avp_data){ 3942, 10415, "SCS-Realm", 0, 0, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* SDP-Answer-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 1275, 10415, "SDP-Answer-Timestamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* SDP-Media-Description */
+	{ DICT_AVP, &(struct dict_avp_data){ 845, 10415, "SDP-Media-Description", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* SDP-Media-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 844, 10415, "SDP-Media-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* SDP-Offer-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 1274, 10415, "SDP-Offer-Timestamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* SDP-Session-Description */
+	{ DICT_AVP, &(struct dict_avp_data){ 842, 10415, "SDP-Session-Description", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* SDP-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SDP-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SDP_Offer", { .i32=0 } }, "3GPP/Enumerated(SDP-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SDP_Answer", { .i32=1 } }, "3GPP/Enumerated(SDP-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2036, 10415, "SDP-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SDP-Type)" },
+	/* Serving-Node-Identity */
+	{ DICT_AVP, &(struct dict_avp_data){ 3929, 10415, "Serving-Node-Identity", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "DiameterIdentity" },
+	/* Served-Party-IP-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 848, 10415, "Served-Party-IP-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Service-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 855, 10415, "Service-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Service-Mode */
+	{ DICT_AVP, &(struct dict_avp_data){ 2032, 10415, "Service-Mode", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Service-Specific-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 863, 10415, "Service-Specific-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Service-Specific-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 1257, 10415, "Service-Specific-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Serving-Node-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Serving-Node-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SGSN", { .i32=0 } }, "3GPP/Enumerated(Serving-Node-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PMIPSGW", { .i32=1 } }, "3GPP/Enumerated(Serving-Node-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "GTPSGW", { .i32=2 } }, "3GPP/Enumerated(Serving-Node-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ePDG", { .i32=3 } }, "3GPP/Enumerated(Serving-Node-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "hSGW", { .i32=4 } }, "3GPP/Enumerated(Serving-Node-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "MME", { .i32=5 } }, "3GPP/Enumerated(Serving-Node-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "TWAN", { .i32=6 } }, "3GPP/Enumerated(Serving-Node-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2047, 10415, "Serving-Node-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Serving-Node-Type)" },
+	/* Session-Direction */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Session-Direction)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "inbound", { .i32=0 } }, "3GPP/Enumerated(Session-Direction)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "outbound", { .i32=1 } }, "3GPP/Enumerated(Session-Direction)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2707, 10415, "Session-Direction", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Session-Direction)" },
+	/* SGi-PtP-Tunnelling-Method */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SGi-PtP-Tunnelling-Method)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UDP_IP_based", { .i32=0 } }, "3GPP/Enumerated(SGi-PtP-Tunnelling-Method)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Others", { .i32=1 } }, "3GPP/Enumerated(SGi-PtP-Tunnelling-Method)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3931, 10415, "SGi-PtP-Tunnelling-Method", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SGi-PtP-Tunnelling-Method)" },
+	/* SGSN-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1228, 10415, "SGSN-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* SGW-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2067, 10415, "SGW-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* SGW-Change */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SGW-Change)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ACR_Start_NOT_due_to_SGW_Change", { .i32=0 } }, "3GPP/Enumerated(SGW-Change)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "ACR_Start_due_to_SGW_Change", { .i32=1 } }, "3GPP/Enumerated(SGW-Change)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2065, 10415, "SGW-Change", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SGW-Change)" },
+	/* SIP-Method */
+	{ DICT_AVP, &(struct dict_avp_data){ 824, 10415, "SIP-Method", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* SIP-Request-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 834, 10415, "SIP-Request-Timestamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* SIP-Request-Timestamp-Fraction */
+	{ DICT_AVP, &(struct dict_avp_data){ 2301, 10415, "SIP-Request-Timestamp-Fraction", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SIP-Response-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 835, 10415, "SIP-Response-Timestamp", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* SIP-Response-Timestamp-Fraction */
+	{ DICT_AVP, &(struct dict_avp_data){ 2302, 10415, "SIP-Response-Timestamp-Fraction", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SM-Device-Trigger-Indicator */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Device-Trigger-Indicator)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Not_DeviceTrigger", { .i32=0 } }, "3GPP/Enumerated(SM-Device-Trigger-Indicator)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Device_Trigger", { .i32=1 } }, "3GPP/Enumerated(SM-Device-Trigger-Indicator)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3407, 10415, "SM-Device-Trigger-Indicator", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SM-Device-Trigger-Indicator)" },
+	/* SM-Discharge-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 2012, 10415, "SM-Discharge-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* SM-Message-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Message-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SUBMISSION", { .i32=0 } }, "3GPP/Enumerated(SM-Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DELIVERY_REPORT", { .i32=1 } }, "3GPP/Enumerated(SM-Message-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SM_Service_Request", { .i32=2 } }, "3GPP/Enumerated(SM-Message-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2007, 10415, "SM-Message-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SM-Message-Type)" },
+	/* SM-Protocol-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 2013, 10415, "SM-Protocol-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SM-Sequence-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 3408, 10415, "SM-Sequence-Number", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SM-Service-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Service-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_content_processing", { .i32=0 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_forwarding", { .i32=1 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_Deferred_Delivery", { .i32=10 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_Forwarding_multiple_subscriptions", { .i32=2 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_filtering", { .i32=3 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_receipt", { .i32=4 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_Network_Storage", { .i32=5 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_to_multiple_destinations", { .i32=6 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_Auto_Reply", { .i32=8 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "VAS4SMS_Short_Message_Personal_Signature", { .i32=9 } }, "3GPP/Enumerated(SM-Service-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2029, 10415, "SM-Service-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SM-Service-Type)" },
+	/* SM-Status */
+	{ DICT_AVP, &(struct dict_avp_data){ 2014, 10415, "SM-Status", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SM-User-Data-Header */
+	{ DICT_AVP, &(struct dict_avp_data){ 2015, 10415, "SM-User-Data-Header", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* SMS-Node */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(SMS-Node)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SMS_Router", { .i32=0 } }, "3GPP/Enumerated(SMS-Node)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "IP_SM_GW", { .i32=1 } }, "3GPP/Enumerated(SMS-Node)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SMS_Router_and_IP_SM_GW", { .i32=2 } }, "3GPP/Enumerated(SMS-Node)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SMS_SC", { .i32=3 } }, "3GPP/Enumerated(SMS-Node)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2016, 10415, "SMS-Node", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(SMS-Node)" },
+	/* SMS-Result */
+	{ DICT_AVP, &(struct dict_avp_data){ 3409, 10415, "SMS-Result", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* SMSC-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2017, 10415, "SMSC-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Start-of-Charging */
+	{ DICT_AVP, &(struct dict_avp_data){ 3419, 10415, "Start-of-Charging", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Start-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 2041, 10415, "Start-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Status-AS-Code */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Status-AS-Code)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "4xx", { .i32=0 } }, "3GPP/Enumerated(Status-AS-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "5xx", { .i32=1 } }, "3GPP/Enumerated(Status-AS-Code)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Timeout", { .i32=2 } }, "3GPP/Enumerated(Status-AS-Code)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2702, 10415, "Status-AS-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Status-AS-Code)" },
+	/* Stop-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 2042, 10415, "Stop-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Submission-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1202, 10415, "Submission-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Subscriber-Role */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subscriber-Role)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Originating", { .i32=0 } }, "3GPP/Enumerated(Subscriber-Role)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Terminating", { .i32=1 } }, "3GPP/Enumerated(Subscriber-Role)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2033, 10415, "Subscriber-Role", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Subscriber-Role)" },
+	/* TAD-Identifier */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(TAD-Identifier)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CS", { .i32=0 } }, "3GPP/Enumerated(TAD-Identifier)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "PS", { .i32=1 } }, "3GPP/Enumerated(TAD-Identifier)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2717, 10415, "TAD-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(TAD-Identifier)" },
+	/* Talk-Burst-Time */
+	{ DICT_AVP, &(struct dict_avp_data){ 1286, 10415, "Talk-Burst-Time", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Talk-Burst-Volume */
+	{ DICT_AVP, &(struct dict_avp_data){ 1287, 10415, "Talk-Burst-Volume", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Tariff-XML */
+	{ DICT_AVP, &(struct dict_avp_data){ 2306, 10415, "Tariff-XML", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Teleservice */
+	{ DICT_AVP, &(struct dict_avp_data){ 3413, 10415, "Teleservice", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Terminating-IOI */
+	{ DICT_AVP, &(struct dict_avp_data){ 840, 10415, "Terminating-IOI", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Time-First-Reception */
+	{ DICT_AVP, &(struct dict_avp_data){ 3466, 10415, "Time-First-Reception", 0, 0, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Time-First-Transmission */
+	{ DICT_AVP, &(struct dict_avp_data){ 3467, 10415, "Time-First-Transmission", 0, 0, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Time-First-Usage */
+	{ DICT_AVP, &(struct dict_avp_data){ 2043, 10415, "Time-First-Usage", 0, 0, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Time-Indicator */
+	{ DICT_AVP, &(struct dict_avp_data){ 3911, 10415, "Time-Indicator", 0, 0, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Time-Last-Usage */
+	{ DICT_AVP, &(struct dict_avp_data){ 2044, 10415, "Time-Last-Usage", 0, 0, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Time-Quota-Threshold */
+	{ DICT_AVP, &(struct dict_avp_data){ 868, 10415, "Time-Quota-Threshold", 0, 0, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Time-Quota-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Time-Quota-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "DISCRETE_TIME_PERIOD", { .i32=0 } }, "3GPP/Enumerated(Time-Quota-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CONTINUOUS_TIME_PERIOD", { .i32=1 } }, "3GPP/Enumerated(Time-Quota-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1271, 10415, "Time-Quota-Type", 0, 0, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Time-Quota-Type)" },
+	/* Time-Usage */
+	{ DICT_AVP, &(struct dict_avp_data){ 2045, 10415, "Time-Usage", 0, 0, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Token-Text */
+	{ DICT_AVP, &(struct dict_avp_data){ 1215, 10415, "Token-Text", 0, 0, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Transcoder-Inserted-Indication */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Transcoder-Inserted-Indication)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Transcoder_Not_Inserted", { .i32=0 } }, "3GPP/Enumerated(Transcoder-Inserted-Indication)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Transcoder_Inserted", { .i32=1 } }, "3GPP/Enumerated(Transcoder-Inserted-Indication)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 2605, 10415, "Transcoder-Inserted-Indication", 0, 0, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Transcoder-Inserted-Indication)" },
+	/* Transit-IOI-List */
+	{ DICT_AVP, &(struct dict_avp_data){ 2701, 10415, "Transit-IOI-List", 0, 0, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Trigger-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(Trigger-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_SGSN_IP_ADDRESS", { .i32=1 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_QOS", { .i32=2 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_LOCATION", { .i32=3 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_RAT", { .i32=4 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_UE_TIMEZONE", { .i32=5 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_TRAFFIC_CLASS", { .i32=10 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_RELIABILITY_CLASS", { .i32=11 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_DELAY_CLASS", { .i32=12 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_PEAK_THROUGHPUT", { .i32=13 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_PRECEDENCE_CLASS", { .i32=14 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_MEAN_THROUGHPUT", { .i32=15 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_MAXIMUM_BIT_RATE_FOR_UPLINK", { .i32=16 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_MAXIMUM_BIT_RATE_FOR_DOWNLINK", { .i32=17 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_RESIDUAL_BER", { .i32=18 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_SDU_ERROR_RATIO", { .i32=19 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_TRANSFER_DELAY", { .i32=20 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_TRAFFIC_HANDLING_PRIORITY", { .i32=21 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_GUARANTEED_BIT_RATE_FOR_UPLINK", { .i32=22 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_GUARANTEED_BIT_RATE_FOR_DOWNLINK", { .i32=23 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINQOS_APN_AGGREGATE_MAXIMUM_BIT_RATE", { .i32=24 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINLOCATION_MCC", { .i32=30 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINLOCATION_MNC", { .i32=31 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINLOCATION_RAC", { .i32=32 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINLOCATION_LAC", { .i32=33 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINLOCATION_CellId", { .i32=34 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINLOCATION_TAC", { .i32=35 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGEINLOCATION_ECGI", { .i32=36 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_MEDIA_COMPOSITION", { .i32=40 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_PARTICIPANTS_NMB", { .i32=50 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_THRSHLD_OF_PARTICIPANTS_NMB", { .i32=51 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_USER_PARTICIPATING_TYPE", { .i32=52 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_SERVICE_CONDITION", { .i32=60 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_SERVING_NODE", { .i32=61 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_ACCESS_FOR_A_SERVICE_DATA_FLOW", { .i32=62 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_USER_CSG_INFORMATION", { .i32=70 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_HYBRID_SUBSCRIBED_USER_CSG_INFORMATION", { .i32=71 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_HYBRID_UNSUBSCRIBED_USER_CSG_INFORMATION", { .i32=72 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_OF_UE_PRESENCE_IN_PRESENCE_REPORTING_AREA", { .i32=73 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_APN_RATE_CONTROL", { .i32=75 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "CHANGE_IN_3GPP_PS_DATA_OFF", { .i32=76 } }, "3GPP/Enumerated(Trigger-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 870, 10415, "Trigger-Type", 0, 0, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(Trigger-Type)" },
+	/* TWAG-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3903, 10415, "TWAG-Address", 0, 0, AVP_TYPE_OCTETSTRING }, "Address" },
+	/* Type-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 1204, 10415, "Type-Number", 0, 0, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* UNI-PDU-CP-Only-Flag */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(UNI-PDU-CP-Only-Flag)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNI_PDU_both_UP_CP", { .i32=0 } }, "3GPP/Enumerated(UNI-PDU-CP-Only-Flag)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UNI_PDU_CP_Only", { .i32=1 } }, "3GPP/Enumerated(UNI-PDU-CP-Only-Flag)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 3932, 10415, "UNI-PDU-CP-Only-Flag", 0, 0, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(UNI-PDU-CP-Only-Flag)" },
+	/* Unit-Quota-Threshold */
+	{ DICT_AVP, &(struct dict_avp_data){ 1226, 10415, "Unit-Quota-Threshold", 0, 0, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Usage-Information-Report-Sequence-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 3439, 10415, "Usage-Information-Report-Sequence-Number", 0, 0, AVP_TYPE_INTEGER32 }, NULL },
+	/* User-Participating-Type */
+	{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "3GPP/Enumerated(User-Participating-Type)", NULL, NULL, NULL }, NULL },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "Normal", { .i32=0 } }, "3GPP/Enumerated(User-Participating-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NW_PoC_Box", { .i32=1 } }, "3GPP/Enumerated(User-Participating-Type)" },
+	{ DICT_ENUMVAL, &(struct dict_enumval_data){ "UE_PoC_Box", { .i32=2 } }, "3GPP/Enumerated(User-Participating-Type)" },
+	{ DICT_AVP, &(struct dict_avp_data){ 1279, 10415, "User-Participating-Type", 0, 0, AVP_TYPE_INTEGER32 }, "3GPP/Enumerated(User-Participating-Type)" },
+	/* User-Session-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 830, 10415, "User-Session-Id", 0, 0, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* Variable-Part-Order */
+	{ DICT_AVP, &(struct dict_avp_data){ 3908, 10415, "Variable-Part-Order", 0, 0, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Variable-Part-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 3909, 10415, "Variable-Part-Type", 0, 0, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Variable-Part-Value */
+	{ DICT_AVP, &(struct dict_avp_data){ 3910, 10415, "Variable-Part-Value", 0, 0, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+	/* VLR-Number */
+	{ DICT_AVP, &(struct dict_avp_data){ 3420, 10415, "VLR-Number", 0, 0, AVP_TYPE_OCTETSTRING }, NULL },
+	/* Volume-Quota-Threshold */
+	{ DICT_AVP, &(struct dict_avp_data){ 869, 10415, "Volume-Quota-Threshold", 0, 0, AVP_TYPE_UNSIGNED32 }, NULL },
+	/* Submission-Timestamp */
+	{ DICT_AVP, &(struct dict_avp_data){ 9911, 10415, "Submission-Timestamp", 0, 0, AVP_TYPE_OCTETSTRING }, "Time" },
+	/* Scale-Factor */
+	{ DICT_AVP, &(struct dict_avp_data){ 2059, 10415, "Scale-Factor", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* SDP-Media-Component */
+	{ DICT_AVP, &(struct dict_avp_data){ 843, 10415, "SDP-Media-Component", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* UWAN-User-Location-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 3918, 10415, "UWAN-User-Location-Info", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Address-Domain */
+	{ DICT_AVP, &(struct dict_avp_data){ 898, 10415, "Address-Domain", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Location-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 3460, 10415, "Location-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MBMS-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 880, 10415, "MBMS-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* AoC-Service */
+	{ DICT_AVP, &(struct dict_avp_data){ 2311, 10415, "AoC-Service", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* ProSe-Direct-Communication-Transmission-Data-Container */
+	{ DICT_AVP, &(struct dict_avp_data){ 3441, 10415, "ProSe-Direct-Communication-Transmission-Data-Container", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* APN-Rate-Control-Downlink */
+	{ DICT_AVP, &(struct dict_avp_data){ 3934, 10415, "APN-Rate-Control-Downlink", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* PoC-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 879, 10415, "PoC-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Supplementary-Service */
+	{ DICT_AVP, &(struct dict_avp_data){ 2048, 10415, "Supplementary-Service", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Transmitter-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 3468, 10415, "Transmitter-Info", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Unit-Cost */
+	{ DICT_AVP, &(struct dict_avp_data){ 2061, 10415, "Unit-Cost", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Time-Stamps */
+	{ DICT_AVP, &(struct dict_avp_data){ 833, 10415, "Time-Stamps", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* NNI-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2703, 10415, "NNI-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Trigger */
+	{ DICT_AVP, &(struct dict_avp_data){ 1264, 10415, "Trigger", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Related-Trigger */
+	{ DICT_AVP, &(struct dict_avp_data){ 3926, 10415, "Related-Trigger", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Talk-Burst-Exchange */
+	{ DICT_AVP, &(struct dict_avp_data){ 1255, 10415, "Talk-Burst-Exchange", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Time-Quota-Mechanism */
+	{ DICT_AVP, &(struct dict_avp_data){ 1270, 10415, "Time-Quota-Mechanism", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Variable-Part */
+	{ DICT_AVP, &(struct dict_avp_data){ 3907, 10415, "Variable-Part", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Additional-Content-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1207, 10415, "Additional-Content-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* APN-Rate-Control-Uplink */
+	{ DICT_AVP, &(struct dict_avp_data){ 3935, 10415, "APN-Rate-Control-Uplink", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Basic-Service-Code */
+	{ DICT_AVP, &(struct dict_avp_data){ 3411, 10415, "Basic-Service-Code", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Event-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 823, 10415, "Event-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* ProSe-Direct-Communication-Reception-Data-Container */
+	{ DICT_AVP, &(struct dict_avp_data){ 3461, 10415, "ProSe-Direct-Communication-Reception-Data-Container", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Originator-Interface */
+	{ DICT_AVP, &(struct dict_avp_data){ 2009, 10415, "Originator-Interface", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Destination-Interface */
+	{ DICT_AVP, &(struct dict_avp_data){ 2002, 10415, "Destination-Interface", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* ISUP-Cause */
+	{ DICT_AVP, &(struct dict_avp_data){ 3416, 10415, "ISUP-Cause", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* LCS-Requestor-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 1239, 10415, "LCS-Requestor-ID", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* PS-Furnish-Charging-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 865, 10415, "PS-Furnish-Charging-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* User-CSG-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2319, 10415, "User-CSG-Information", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Called-Identity-Change */
+	{ DICT_AVP, &(struct dict_avp_data){ 3917, 10415, "Called-Identity-Change", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Service-Specific-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 1249, 10415, "Service-Specific-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Accumulated-Cost */
+	{ DICT_AVP, &(struct dict_avp_data){ 2052, 10415, "Accumulated-Cost", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* SCS-AS-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 3940, 10415, "SCS-AS-Address", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Message-Class */
+	{ DICT_AVP, &(struct dict_avp_data){ 1213, 10415, "Message-Class", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Location-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 1244, 10415, "Location-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Rate-Element */
+	{ DICT_AVP, &(struct dict_avp_data){ 2058, 10415, "Rate-Element", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Participant-Group */
+	{ DICT_AVP, &(struct dict_avp_data){ 1260, 10415, "Participant-Group", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Enhanced-Diagnostics */
+	{ DICT_AVP, &(struct dict_avp_data){ 3901, 10415, "Enhanced-Diagnostics", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Access-Network-Info-Change */
+	{ DICT_AVP, &(struct dict_avp_data){ 4401, 10415, "Access-Network-Info-Change", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* PoC-User-Role */
+	{ DICT_AVP, &(struct dict_avp_data){ 1252, 10415, "PoC-User-Role", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* LCS-Client-Name */
+	{ DICT_AVP, &(struct dict_avp_data){ 1235, 10415, "LCS-Client-Name", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Message-Body */
+	{ DICT_AVP, &(struct dict_avp_data){ 889, 10415, "Message-Body", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Radio-Parameter-Set-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 3463, 10415, "Radio-Parameter-Set-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* SM-Device-Trigger-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 3405, 10415, "SM-Device-Trigger-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* TWAN-User-Location-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 2714, 10415, "TWAN-User-Location-Info", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* VCS-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 3410, 10415, "VCS-Information", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Trunk-Group-ID */
+	{ DICT_AVP, &(struct dict_avp_data){ 851, 10415, "Trunk-Group-ID", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* Incremental-Cost */
+	{ DICT_AVP, &(struct dict_avp_data){ 2062, 10415, "Incremental-Cost", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* SDP-TimeStamps */
+	{ DICT_AVP, &(struct dict_avp_data){ 1273, 10415, "SDP-TimeStamps", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Inter-Operator-Identifier */
+	{ DICT_AVP, &(struct dict_avp_data){ 838, 10415, "Inter-Operator-Identifier", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* NIDD-Submission */
+	{ DICT_AVP, &(struct dict_avp_data){ 3928, 10415, "NIDD-Submission", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Application-Server-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 850, 10415, "Application-Server-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* CPDT-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 3927, 10415, "CPDT-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Envelope */
+	{ DICT_AVP, &(struct dict_avp_data){ 1266, 10415, "Envelope", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Related-Change-Condition-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 3925, 10415, "Related-Change-Condition-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* LCS-Client-Id */
+	{ DICT_AVP, &(struct dict_avp_data){ 1232, 10415, "LCS-Client-Id", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Early-Media-Description */
+	{ DICT_AVP, &(struct dict_avp_data){ 1272, 10415, "Early-Media-Description", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* AoC-Subscription-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2314, 10415, "AoC-Subscription-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Current-Tariff */
+	{ DICT_AVP, &(struct dict_avp_data){ 2056, 10415, "Current-Tariff", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* APN-Rate-Control */
+	{ DICT_AVP, &(struct dict_avp_data){ 3933, 10415, "APN-Rate-Control", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Access-Transfer-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2709, 10415, "Access-Transfer-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Recipient-Received-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2028, 10415, "Recipient-Received-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* AoC-Cost-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2053, 10415, "AoC-Cost-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Originator-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 886, 10415, "Originator-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Originator-Received-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 2027, 10415, "Originator-Received-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Remaining-Balance */
+	{ DICT_AVP, &(struct dict_avp_data){ 2021, 10415, "Remaining-Balance", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* AF-Correlation-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 1276, 10415, "AF-Correlation-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Recipient-Address */
+	{ DICT_AVP, &(struct dict_avp_data){ 1201, 10415, "Recipient-Address", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Next-Tariff */
+	{ DICT_AVP, &(struct dict_avp_data){ 2057, 10415, "Next-Tariff", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Coverage-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 3459, 10415, "Coverage-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Announcement-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 3904, 10415, "Announcement-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MM-Content-Type */
+	{ DICT_AVP, &(struct dict_avp_data){ 1203, 10415, "MM-Content-Type", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MMTel-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2030, 10415, "MMTel-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Service-Data-Container */
+	{ DICT_AVP, &(struct dict_avp_data){ 2040, 10415, "Service-Data-Container", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* MMS-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 877, 10415, "MMS-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Recipient-Info */
+	{ DICT_AVP, &(struct dict_avp_data){ 2026, 10415, "Recipient-Info", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Traffic-Data-Volumes */
+	{ DICT_AVP, &(struct dict_avp_data){ 2046, 10415, "Traffic-Data-Volumes", 0, 0, AVP_TYPE_GROUPED }, NULL },
+	/* LCS-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 878, 10415, "LCS-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Tariff-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2060, 10415, "Tariff-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* ProSe-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 3447, 10415, "ProSe-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* SMS-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2000, 10415, "SMS-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Real-Time-Tariff-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2305, 10415, "Real-Time-Tariff-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* AoC-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 2054, 10415, "AoC-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Monitoring-Event-Report-Data */
+	{ DICT_AVP, &(struct dict_avp_data){ 3920, 10415, "Monitoring-Event-Report-Data", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Offline-Charging */
+	{ DICT_AVP, &(struct dict_avp_data){ 1278, 10415, "Offline-Charging", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* IMS-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 876, 10415, "IMS-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Monitoring-Event-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 3921, 10415, "Monitoring-Event-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* PS-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 874, 10415, "PS-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+	/* Service-Information */
+	{ DICT_AVP, &(struct dict_avp_data){ 873, 10415, "Service-Information", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_TYPE_GROUPED }, NULL },
+};
+
 static int dict_ts32299_avps_load_defs(char * conffile)
 {
    TRACE_ENTRY("%p", conffile);
@@ -110,5917 +1337,7 @@ static int dict_ts32299_avps_load_defs(char * conffile)
 
 
    /* AVP section */
-   {
-		struct dict_object * Address_type;
-		struct dict_object * UTF8String_type;
-		struct dict_object * DiameterIdentity_type;
-		struct dict_object * DiameterURI_type;
-		struct dict_object * Time_type;
-		struct dict_object * IPFilterRule_type;
-
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Address", &Address_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "UTF8String", &UTF8String_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterIdentity", &DiameterIdentity_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "DiameterURI", &DiameterURI_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "Time", &Time_type);
-		CHECK_dict_search( DICT_TYPE, TYPE_BY_NAME, "IPFilterRule", &IPFilterRule_type);
-		/* 3GPP-PS-Data-Off-Status */
-		{
-			struct dict_avp_data data = {
-				4406,	/* Code */
-				10415,	/* Vendor */
-				"3GPP-PS-Data-Off-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(3GPP-PS-Data-Off-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Active", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Inactive", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Access-Network-Information */
-		{
-			struct dict_avp_data data = {
-				1263,	/* Code */
-				10415,	/* Vendor */
-				"Access-Network-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Access-Transfer-Type */
-		{
-			struct dict_avp_data data = {
-				2710,	/* Code */
-				10415,	/* Vendor */
-				"Access-Transfer-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Access-Transfer-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "PS_to_CS_Transfer", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CS_to_PS_Transfer", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "PS_to_PS_Transfer", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "CS_to_CS_Transfer", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Account-Expiration */
-		{
-			struct dict_avp_data data = {
-				2309,	/* Code */
-				10415,	/* Vendor */
-				"Account-Expiration",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Adaptations */
-		{
-			struct dict_avp_data data = {
-				1217,	/* Code */
-				10415,	/* Vendor */
-				"Adaptations",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Adaptations)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Yes", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "No", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Additional-Exception-Reports */
-		{
-			struct dict_avp_data data = {
-				3936,	/* Code */
-				10415,	/* Vendor */
-				"Additional-Exception-Reports",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Additional-Exception-Reports)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Not_allowed", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Allowed", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Additional-Type-Information */
-		{
-			struct dict_avp_data data = {
-				1205,	/* Code */
-				10415,	/* Vendor */
-				"Additional-Type-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Address-Data */
-		{
-			struct dict_avp_data data = {
-				897,	/* Code */
-				10415,	/* Vendor */
-				"Address-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Addressee-Type */
-		{
-			struct dict_avp_data data = {
-				1208,	/* Code */
-				10415,	/* Vendor */
-				"Addressee-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Addressee-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "TO", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CC", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "BCC", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Address-Type */
-		{
-			struct dict_avp_data data = {
-				899,	/* Code */
-				10415,	/* Vendor */
-				"Address-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Address-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "e_mail_address", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "MSISDN", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "IPv4_Address", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "IPv6_Address", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "Numeric_Shortcode", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "Alphanumeric_Shortcode", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "Other", { .i32=6 }};
-			struct dict_enumval_data        t_8 = { "IMSI", { .i32=7 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Alternate-Charged-Party-Address */
-		{
-			struct dict_avp_data data = {
-				1280,	/* Code */
-				10415,	/* Vendor */
-				"Alternate-Charged-Party-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Announcement-Identifier */
-		{
-			struct dict_avp_data data = {
-				3905,	/* Code */
-				10415,	/* Vendor */
-				"Announcement-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Announcement-Order */
-		{
-			struct dict_avp_data data = {
-				3906,	/* Code */
-				10415,	/* Vendor */
-				"Announcement-Order",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Announcing-UE-HPLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				3426,	/* Code */
-				10415,	/* Vendor */
-				"Announcing-UE-HPLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Announcing-UE-VPLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				3427,	/* Code */
-				10415,	/* Vendor */
-				"Announcing-UE-VPLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* AoC-Format */
-		{
-			struct dict_avp_data data = {
-				2310,	/* Code */
-				10415,	/* Vendor */
-				"AoC-Format",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(AoC-Format)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "MONETARY", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NON_MONETARY", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "CAI", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* AoC-Request-Type */
-		{
-			struct dict_avp_data data = {
-				2055,	/* Code */
-				10415,	/* Vendor */
-				"AoC-Request-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(AoC-Request-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "AoC_NOT_REQUESTED", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "AoC_FULL", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "AoC_COST_ONLY", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "AoC_TARIFF_ONLY", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* AoC-Service-Obligatory-Type */
-		{
-			struct dict_avp_data data = {
-				2312,	/* Code */
-				10415,	/* Vendor */
-				"AoC-Service-Obligatory-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(AoC-Service-Obligatory-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NON_BINDING", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "BINDING", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* AoC-Service-Type */
-		{
-			struct dict_avp_data data = {
-				2313,	/* Code */
-				10415,	/* Vendor */
-				"AoC-Service-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(AoC-Service-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NONE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "AOC-S", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "AOC-D", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "AOC-E", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Applic-ID */
-		{
-			struct dict_avp_data data = {
-				1218,	/* Code */
-				10415,	/* Vendor */
-				"Applic-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Application-Provided-Called-Party-Address */
-		{
-			struct dict_avp_data data = {
-				837,	/* Code */
-				10415,	/* Vendor */
-				"Application-Provided-Called-Party-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Application-Server */
-		{
-			struct dict_avp_data data = {
-				836,	/* Code */
-				10415,	/* Vendor */
-				"Application-Server",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Application-Specific-Data */
-		{
-			struct dict_avp_data data = {
-				3458,	/* Code */
-				10415,	/* Vendor */
-				"Application-Specific-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Associated-Party-Address */
-		{
-			struct dict_avp_data data = {
-				2035,	/* Code */
-				10415,	/* Vendor */
-				"Associated-Party-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Associated-URI */
-		{
-			struct dict_avp_data data = {
-				856,	/* Code */
-				10415,	/* Vendor */
-				"Associated-URI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Authorised-QoS */
-		{
-			struct dict_avp_data data = {
-				849,	/* Code */
-				10415,	/* Vendor */
-				"Authorised-QoS",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Aux-Applic-Info */
-		{
-			struct dict_avp_data data = {
-				1219,	/* Code */
-				10415,	/* Vendor */
-				"Aux-Applic-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Base-Time-Interval */
-		{
-			struct dict_avp_data data = {
-				1265,	/* Code */
-				10415,	/* Vendor */
-				"Base-Time-Interval",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Bearer-Capability */
-		{
-			struct dict_avp_data data = {
-				3412,	/* Code */
-				10415,	/* Vendor */
-				"Bearer-Capability",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Bearer-Service */
-		{
-			struct dict_avp_data data = {
-				854,	/* Code */
-				10415,	/* Vendor */
-				"Bearer-Service",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* BSSID */
-		{
-			struct dict_avp_data data = {
-				2716,	/* Code */
-				10415,	/* Vendor */
-				"BSSID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Called-Asserted-Identity */
-		{
-			struct dict_avp_data data = {
-				1250,	/* Code */
-				10415,	/* Vendor */
-				"Called-Asserted-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Called-Identity */
-		{
-			struct dict_avp_data data = {
-				3916,	/* Code */
-				10415,	/* Vendor */
-				"Called-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Called-Party-Address */
-		{
-			struct dict_avp_data data = {
-				832,	/* Code */
-				10415,	/* Vendor */
-				"Called-Party-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Calling-Party-Address */
-		{
-			struct dict_avp_data data = {
-				831,	/* Code */
-				10415,	/* Vendor */
-				"Calling-Party-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Carrier-Select-Routing-Information */
-		{
-			struct dict_avp_data data = {
-				2023,	/* Code */
-				10415,	/* Vendor */
-				"Carrier-Select-Routing-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Cause-Code */
-		{
-			struct dict_avp_data data = {
-				861,	/* Code */
-				10415,	/* Vendor */
-				"Cause-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Cellular-Network-Information */
-		{
-			struct dict_avp_data data = {
-				3924,	/* Code */
-				10415,	/* Vendor */
-				"Cellular-Network-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* CG-Address */
-		{
-			struct dict_avp_data data = {
-				846,	/* Code */
-				10415,	/* Vendor */
-				"CG-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Change-Condition */
-		{
-			struct dict_avp_data data = {
-				2037,	/* Code */
-				10415,	/* Vendor */
-				"Change-Condition",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Change-Time */
-		{
-			struct dict_avp_data data = {
-				2038,	/* Code */
-				10415,	/* Vendor */
-				"Change-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Charge-Reason-Code */
-		{
-			struct dict_avp_data data = {
-				2118,	/* Code */
-				10415,	/* Vendor */
-				"Charge-Reason-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Charge-Reason-Code)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UNKNOWN", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "USAGE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "COMMUNICATION_ATTEMPT_CHARGE", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "SETUP_CHARGE", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "ADD_ON_CHARGE", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Charged-Party */
-		{
-			struct dict_avp_data data = {
-				857,	/* Code */
-				10415,	/* Vendor */
-				"Charged-Party",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Charging-Characteristics-Selection-Mode */
-		{
-			struct dict_avp_data data = {
-				2066,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Characteristics-Selection-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Charging-Characteristics-Selection-Mode)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Serving_Node_Supplied", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Subscription_specific", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "APN_specific", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "Home_Default", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "Roaming_Default", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "Visiting_Default", { .i32=5 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Charging-Per-IP-CAN-Session-Indicator */
-		{
-			struct dict_avp_data data = {
-				4400,	/* Code */
-				10415,	/* Vendor */
-				"Charging-Per-IP-CAN-Session-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Charging-Per-IP-CAN-Session-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Inactive", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Active", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Class-Identifier */
-		{
-			struct dict_avp_data data = {
-				1214,	/* Code */
-				10415,	/* Vendor */
-				"Class-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Class-Identifier)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Personal", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Advertisement", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Informational", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "Auto", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Client-Address */
-		{
-			struct dict_avp_data data = {
-				2018,	/* Code */
-				10415,	/* Vendor */
-				"Client-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* CN-Operator-Selection-Entity */
-		{
-			struct dict_avp_data data = {
-				3421,	/* Code */
-				10415,	/* Vendor */
-				"CN-Operator-Selection-Entity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(CN-Operator-Selection-Entity)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "The_Serving_Network_has_been_selected_by_the_UE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "The_Serving_Network_has_been_selected_by_the_network", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Content-Class */
-		{
-			struct dict_avp_data data = {
-				1220,	/* Code */
-				10415,	/* Vendor */
-				"Content-Class",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Content-Class)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "text", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "image_basic", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "image_rich", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "video_basic", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "video_rich", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "megapixel", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "content_basic", { .i32=6 }};
-			struct dict_enumval_data        t_8 = { "content_rich", { .i32=7 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Content-Disposition */
-		{
-			struct dict_avp_data data = {
-				828,	/* Code */
-				10415,	/* Vendor */
-				"Content-Disposition",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Content-Length */
-		{
-			struct dict_avp_data data = {
-				827,	/* Code */
-				10415,	/* Vendor */
-				"Content-Length",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Content-Size */
-		{
-			struct dict_avp_data data = {
-				1206,	/* Code */
-				10415,	/* Vendor */
-				"Content-Size",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Content-Type */
-		{
-			struct dict_avp_data data = {
-				826,	/* Code */
-				10415,	/* Vendor */
-				"Content-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Coverage-Status */
-		{
-			struct dict_avp_data data = {
-				3428,	/* Code */
-				10415,	/* Vendor */
-				"Coverage-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Coverage-Status)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Out_of_coverage", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "In_coverage", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CP-CIoT-EPS-Optimisation-Indicator */
-		{
-			struct dict_avp_data data = {
-				3930,	/* Code */
-				10415,	/* Vendor */
-				"CP-CIoT-EPS-Optimisation-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(CP-CIoT-EPS-Optimisation-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Not_Apply", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Apply", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CSG-Access-Mode */
-		{
-			struct dict_avp_data data = {
-				2317,	/* Code */
-				10415,	/* Vendor */
-				"CSG-Access-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(CSG-Access-Mode)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Closed_mode", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Hybrid_Mode", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CSG-Membership-Indication */
-		{
-			struct dict_avp_data data = {
-				2318,	/* Code */
-				10415,	/* Vendor */
-				"CSG-Membership-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(CSG-Membership-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Not_CSG_member", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CSG_Member", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* CUG-Information */
-		{
-			struct dict_avp_data data = {
-				2304,	/* Code */
-				10415,	/* Vendor */
-				"CUG-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Data-Coding-Scheme */
-		{
-			struct dict_avp_data data = {
-				2001,	/* Code */
-				10415,	/* Vendor */
-				"Data-Coding-Scheme",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Deferred-Location-Event-Type */
-		{
-			struct dict_avp_data data = {
-				1230,	/* Code */
-				10415,	/* Vendor */
-				"Deferred-Location-Event-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Delivery-Report-Requested */
-		{
-			struct dict_avp_data data = {
-				1216,	/* Code */
-				10415,	/* Vendor */
-				"Delivery-Report-Requested",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Delivery-Report-Requested)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "No", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Yes", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Diagnostics */
-		{
-			struct dict_avp_data data = {
-				2039,	/* Code */
-				10415,	/* Vendor */
-				"Diagnostics",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Discoveree-UE-HPLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				4402,	/* Code */
-				10415,	/* Vendor */
-				"Discoveree-UE-HPLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Discoveree-UE-VPLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				4403,	/* Code */
-				10415,	/* Vendor */
-				"Discoveree-UE-VPLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Discoverer-UE-HPLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				4404,	/* Code */
-				10415,	/* Vendor */
-				"Discoverer-UE-HPLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Discoverer-UE-VPLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				4405,	/* Code */
-				10415,	/* Vendor */
-				"Discoverer-UE-VPLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Domain-Name */
-		{
-			struct dict_avp_data data = {
-				1200,	/* Code */
-				10415,	/* Vendor */
-				"Domain-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* DRM-Content */
-		{
-			struct dict_avp_data data = {
-				1221,	/* Code */
-				10415,	/* Vendor */
-				"DRM-Content",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(DRM-Content)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "No", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Yes", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Dynamic-Address-Flag */
-		{
-			struct dict_avp_data data = {
-				2051,	/* Code */
-				10415,	/* Vendor */
-				"Dynamic-Address-Flag",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Dynamic-Address-Flag)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Static", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Dynamic", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Dynamic-Address-Flag-Extension */
-		{
-			struct dict_avp_data data = {
-				2068,	/* Code */
-				10415,	/* Vendor */
-				"Dynamic-Address-Flag-Extension",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Dynamic-Address-Flag-Extension)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Static", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Dynamic", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Envelope-End-Time */
-		{
-			struct dict_avp_data data = {
-				1267,	/* Code */
-				10415,	/* Vendor */
-				"Envelope-End-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Envelope-Reporting */
-		{
-			struct dict_avp_data data = {
-				1268,	/* Code */
-				10415,	/* Vendor */
-				"Envelope-Reporting",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Envelope-Reporting)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DO_NOT_REPORT_ENVELOPES", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "REPORT_ENVELOPES", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "REPORT_ENVELOPES_WITH_VOLUME", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "REPORT_ENVELOPES_WITH_EVENTS", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "REPORT_ENVELOPES_WITH_VOLUME_AND_EVENTS", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Envelope-Start-Time */
-		{
-			struct dict_avp_data data = {
-				1269,	/* Code */
-				10415,	/* Vendor */
-				"Envelope-Start-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* EPDG-Address */
-		{
-			struct dict_avp_data data = {
-				3425,	/* Code */
-				10415,	/* Vendor */
-				"EPDG-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Event */
-		{
-			struct dict_avp_data data = {
-				825,	/* Code */
-				10415,	/* Vendor */
-				"Event",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Event-Charging-TimeStamp */
-		{
-			struct dict_avp_data data = {
-				1258,	/* Code */
-				10415,	/* Vendor */
-				"Event-Charging-TimeStamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Expires */
-		{
-			struct dict_avp_data data = {
-				888,	/* Code */
-				10415,	/* Vendor */
-				"Expires",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* File-Repair-Supported */
-		{
-			struct dict_avp_data data = {
-				1224,	/* Code */
-				10415,	/* Vendor */
-				"File-Repair-Supported",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(File-Repair-Supported)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SUPPORTED", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "NOT_SUPPORTED", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Forwarding-Pending */
-		{
-			struct dict_avp_data data = {
-				3415,	/* Code */
-				10415,	/* Vendor */
-				"Forwarding-Pending",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Forwarding-Pending)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Forwarding_not_pending", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Forwarding_pending", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* From-Address */
-		{
-			struct dict_avp_data data = {
-				2708,	/* Code */
-				10415,	/* Vendor */
-				"From-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* GGSN-Address */
-		{
-			struct dict_avp_data data = {
-				847,	/* Code */
-				10415,	/* Vendor */
-				"GGSN-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* IMS-Application-Reference-Identifier */
-		{
-			struct dict_avp_data data = {
-				2601,	/* Code */
-				10415,	/* Vendor */
-				"IMS-Application-Reference-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* IMS-Charging-Identifier */
-		{
-			struct dict_avp_data data = {
-				841,	/* Code */
-				10415,	/* Vendor */
-				"IMS-Charging-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* IMS-Communication-Service-Identifier */
-		{
-			struct dict_avp_data data = {
-				1281,	/* Code */
-				10415,	/* Vendor */
-				"IMS-Communication-Service-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* IMS-Emergency-Indicator */
-		{
-			struct dict_avp_data data = {
-				2322,	/* Code */
-				10415,	/* Vendor */
-				"IMS-Emergency-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(IMS-Emergency-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Non_Emergency", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Emergency", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* IMS-Visited-Network-Identifier */
-		{
-			struct dict_avp_data data = {
-				2713,	/* Code */
-				10415,	/* Vendor */
-				"IMS-Visited-Network-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* IMSI-Unauthenticated-Flag */
-		{
-			struct dict_avp_data data = {
-				2308,	/* Code */
-				10415,	/* Vendor */
-				"IMSI-Unauthenticated-Flag",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(IMSI-Unauthenticated-Flag)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Authenticated", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Unauthenticated", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Incoming-Trunk-Group-Id */
-		{
-			struct dict_avp_data data = {
-				852,	/* Code */
-				10415,	/* Vendor */
-				"Incoming-Trunk-Group-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Initial-IMS-Charging-Identifier */
-		{
-			struct dict_avp_data data = {
-				2321,	/* Code */
-				10415,	/* Vendor */
-				"Initial-IMS-Charging-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Instance-Id */
-		{
-			struct dict_avp_data data = {
-				3402,	/* Code */
-				10415,	/* Vendor */
-				"Instance-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Interface-Id */
-		{
-			struct dict_avp_data data = {
-				2003,	/* Code */
-				10415,	/* Vendor */
-				"Interface-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Interface-Port */
-		{
-			struct dict_avp_data data = {
-				2004,	/* Code */
-				10415,	/* Vendor */
-				"Interface-Port",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Interface-Text */
-		{
-			struct dict_avp_data data = {
-				2005,	/* Code */
-				10415,	/* Vendor */
-				"Interface-Text",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Interface-Type */
-		{
-			struct dict_avp_data data = {
-				2006,	/* Code */
-				10415,	/* Vendor */
-				"Interface-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Interface-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Unknown", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "MOBILE_ORIGINATING", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "MOBILE_TERMINATING", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "APPLICATION_ORIGINATING", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "APPLICATION_TERMINATION", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Inter-UE-Transfer */
-		{
-			struct dict_avp_data data = {
-				3902,	/* Code */
-				10415,	/* Vendor */
-				"Inter-UE-Transfer",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Inter-UE-Transfer)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Intra_UE_transfer", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Inter_UE_transfer", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* IP-Realm-Default-Indication */
-		{
-			struct dict_avp_data data = {
-				2603,	/* Code */
-				10415,	/* Vendor */
-				"IP-Realm-Default-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(IP-Realm-Default-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Default_IP_Realm_Not_used", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Default_IP_realm_used", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ISUP-Cause-Diagnostics */
-		{
-			struct dict_avp_data data = {
-				3422,	/* Code */
-				10415,	/* Vendor */
-				"ISUP-Cause-Diagnostics",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ISUP-Cause-Location */
-		{
-			struct dict_avp_data data = {
-				3423,	/* Code */
-				10415,	/* Vendor */
-				"ISUP-Cause-Location",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ISUP-Cause-Value */
-		{
-			struct dict_avp_data data = {
-				3424,	/* Code */
-				10415,	/* Vendor */
-				"ISUP-Cause-Value",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* ISUP-Location-Number */
-		{
-			struct dict_avp_data data = {
-				3414,	/* Code */
-				10415,	/* Vendor */
-				"ISUP-Location-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Language */
-		{
-			struct dict_avp_data data = {
-				3914,	/* Code */
-				10415,	/* Vendor */
-				"Language",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Layer-2-Group-ID */
-		{
-			struct dict_avp_data data = {
-				3429,	/* Code */
-				10415,	/* Vendor */
-				"Layer-2-Group-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* LCS-APN */
-		{
-			struct dict_avp_data data = {
-				1231,	/* Code */
-				10415,	/* Vendor */
-				"LCS-APN",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* LCS-Client-Dialed-By-MS */
-		{
-			struct dict_avp_data data = {
-				1233,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Client-Dialed-By-MS",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* LCS-Client-External-ID */
-		{
-			struct dict_avp_data data = {
-				1234,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Client-External-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* LCS-Client-Type */
-		{
-			struct dict_avp_data data = {
-				1241,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Client-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(LCS-Client-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "EMERGENCY_SERVICES", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "VALUE_ADDED_SERVICES", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "PLMN_OPERATOR_SERVICES", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "LAWFUL_INTERCEPT_SERVICES", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* LCS-Data-Coding-Scheme */
-		{
-			struct dict_avp_data data = {
-				1236,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Data-Coding-Scheme",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* LCS-Format-Indicator */
-		{
-			struct dict_avp_data data = {
-				1237,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Format-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(LCS-Format-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "LOGICAL_NAME", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "EMAIL_ADDRESS", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "MSISDN", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "URL", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "SIP_URL", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* LCS-Name-String */
-		{
-			struct dict_avp_data data = {
-				1238,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Name-String",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* LCS-Requestor-ID-String */
-		{
-			struct dict_avp_data data = {
-				1240,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Requestor-ID-String",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Local-GW-Inserted-Indication */
-		{
-			struct dict_avp_data data = {
-				2604,	/* Code */
-				10415,	/* Vendor */
-				"Local-GW-Inserted-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Local-GW-Inserted-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Local_GW_Not_Inserted", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Local_GW_Inserted", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Local-Sequence-Number */
-		{
-			struct dict_avp_data data = {
-				2063,	/* Code */
-				10415,	/* Vendor */
-				"Local-Sequence-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Location-Estimate */
-		{
-			struct dict_avp_data data = {
-				1242,	/* Code */
-				10415,	/* Vendor */
-				"Location-Estimate",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Location-Estimate-Type */
-		{
-			struct dict_avp_data data = {
-				1243,	/* Code */
-				10415,	/* Vendor */
-				"Location-Estimate-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Location-Estimate-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CURRENT_LOCATION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CURRENT_LAST_KNOWN_LOCATION", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "INITIAL_LOCATION", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "ACTIVATE_DEFERRED_LOCATION", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "CANCEL_DEFERRED_LOCATION", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Low-Balance-Indication */
-		{
-			struct dict_avp_data data = {
-				2020,	/* Code */
-				10415,	/* Vendor */
-				"Low-Balance-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Low-Balance-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NOT_APPLICABLE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "YES", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Low-Priority-Indicator */
-		{
-			struct dict_avp_data data = {
-				2602,	/* Code */
-				10415,	/* Vendor */
-				"Low-Priority-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Low-Priority-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NO", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "YES", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-Charged-Party */
-		{
-			struct dict_avp_data data = {
-				2323,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Charged-Party",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-Charged-Party)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Content_Provider", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Subscriber", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MBMS-GW-Address */
-		{
-			struct dict_avp_data data = {
-				2307,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-GW-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* MBMS-User-Service-Type */
-		{
-			struct dict_avp_data data = {
-				1225,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-User-Service-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MBMS-User-Service-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DOWNLOAD", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "STREAMING", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Media-Initiator-Flag */
-		{
-			struct dict_avp_data data = {
-				882,	/* Code */
-				10415,	/* Vendor */
-				"Media-Initiator-Flag",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Media-Initiator-Flag)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "called_party", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "calling_party", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "unknown", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Media-Initiator-Party */
-		{
-			struct dict_avp_data data = {
-				1288,	/* Code */
-				10415,	/* Vendor */
-				"Media-Initiator-Party",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Message-ID */
-		{
-			struct dict_avp_data data = {
-				1210,	/* Code */
-				10415,	/* Vendor */
-				"Message-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Message-Size */
-		{
-			struct dict_avp_data data = {
-				1212,	/* Code */
-				10415,	/* Vendor */
-				"Message-Size",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Message-Type */
-		{
-			struct dict_avp_data data = {
-				1211,	/* Code */
-				10415,	/* Vendor */
-				"Message-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Message-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "m_send_req", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "m_forward_req", { .i32=10 }};
-			struct dict_enumval_data        t_3 = { "m_forward_conf", { .i32=11 }};
-			struct dict_enumval_data        t_4 = { "m_mbox_store_conf", { .i32=12 }};
-			struct dict_enumval_data        t_5 = { "m_mbox_view_conf", { .i32=13 }};
-			struct dict_enumval_data        t_6 = { "m_mbox_upload_conf", { .i32=14 }};
-			struct dict_enumval_data        t_7 = { "m_mbox_delete_conf", { .i32=15 }};
-			struct dict_enumval_data        t_8 = { "m_send_conf", { .i32=2 }};
-			struct dict_enumval_data        t_9 = { "m_notification_ind", { .i32=3 }};
-			struct dict_enumval_data        t_10 = { "m_notifyresp_ind", { .i32=4 }};
-			struct dict_enumval_data        t_11 = { "m_retrieve_conf", { .i32=5 }};
-			struct dict_enumval_data        t_12 = { "m_acknowledge_ind", { .i32=6 }};
-			struct dict_enumval_data        t_13 = { "m_delivery_ind", { .i32=7 }};
-			struct dict_enumval_data        t_14 = { "m_read_rec_ind", { .i32=8 }};
-			struct dict_enumval_data        t_15 = { "m_read_orig_ind", { .i32=9 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MMBox-Storage-Requested */
-		{
-			struct dict_avp_data data = {
-				1248,	/* Code */
-				10415,	/* Vendor */
-				"MMBox-Storage-Requested",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(MMBox-Storage-Requested)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "No", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Yes", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* MMTel-SService-Type */
-		{
-			struct dict_avp_data data = {
-				2031,	/* Code */
-				10415,	/* Vendor */
-				"MMTel-SService-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Monitored-PLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				3430,	/* Code */
-				10415,	/* Vendor */
-				"Monitored-PLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Monitoring-Event-Configuration-Activity */
-		{
-			struct dict_avp_data data = {
-				3919,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-Event-Configuration-Activity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Monitoring-Event-Functionality */
-		{
-			struct dict_avp_data data = {
-				3922,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-Event-Functionality",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Monitoring-Event-Report-Number */
-		{
-			struct dict_avp_data data = {
-				3923,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-Event-Report-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Monitoring-UE-HPLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				3431,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-UE-HPLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Monitoring-UE-Identifier */
-		{
-			struct dict_avp_data data = {
-				3432,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-UE-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Monitoring-UE-VPLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				3433,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-UE-VPLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* MSC-Address */
-		{
-			struct dict_avp_data data = {
-				3417,	/* Code */
-				10415,	/* Vendor */
-				"MSC-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* MTC-IWF-Address */
-		{
-			struct dict_avp_data data = {
-				3406,	/* Code */
-				10415,	/* Vendor */
-				"MTC-IWF-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Neighbour-Node-Address */
-		{
-			struct dict_avp_data data = {
-				2705,	/* Code */
-				10415,	/* Vendor */
-				"Neighbour-Node-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Network-Call-Reference-Number */
-		{
-			struct dict_avp_data data = {
-				3418,	/* Code */
-				10415,	/* Vendor */
-				"Network-Call-Reference-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* NNI-Type */
-		{
-			struct dict_avp_data data = {
-				2704,	/* Code */
-				10415,	/* Vendor */
-				"NNI-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(NNI-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "non_roaming", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "roaming_without_loopback", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "roaming_with_loopback", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Node-Functionality */
-		{
-			struct dict_avp_data data = {
-				862,	/* Code */
-				10415,	/* Vendor */
-				"Node-Functionality",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Node-Functionality)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "S-CSCF", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "P-CSCF", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "I-CSCF", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "MRFC", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "MGCF", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "BGCF", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "AS", { .i32=6 }};
-			struct dict_enumval_data        t_8 = { "IBCF", { .i32=7 }};
-			struct dict_enumval_data        t_9 = { "S-GW", { .i32=8 }};
-			struct dict_enumval_data        t_10 = { "P-GW", { .i32=9 }};
-			struct dict_enumval_data        t_11 = { "HSGW", { .i32=10 }};
-			struct dict_enumval_data        t_12 = { "E-CSCF", { .i32=11 }};
-			struct dict_enumval_data        t_13 = { "MME", { .i32=12 }};
-			struct dict_enumval_data        t_14 = { "TRF", { .i32=13 }};
-			struct dict_enumval_data        t_15 = { "TF", { .i32=14 }};
-			struct dict_enumval_data        t_16 = { "ATCF", { .i32=15 }};
-			struct dict_enumval_data        t_17 = { "Proxy-function", { .i32=16 }};
-			struct dict_enumval_data        t_18 = { "ePDG", { .i32=17 }};
-			struct dict_enumval_data        t_19 = { "TDF", { .i32=18 }};
-			struct dict_enumval_data        t_20 = { "TWAG", { .i32=19 }};
-			struct dict_enumval_data        t_21 = { "SCEF", { .i32=20 }};
-			struct dict_enumval_data        t_22 = { "IWK-SCEF", { .i32=21 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_17, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_18, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_19, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_20, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_21, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_22, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Node-Id */
-		{
-			struct dict_avp_data data = {
-				2064,	/* Code */
-				10415,	/* Vendor */
-				"Node-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Number-Of-Diversions */
-		{
-			struct dict_avp_data data = {
-				2034,	/* Code */
-				10415,	/* Vendor */
-				"Number-Of-Diversions",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Number-Of-Messages-Sent */
-		{
-			struct dict_avp_data data = {
-				2019,	/* Code */
-				10415,	/* Vendor */
-				"Number-Of-Messages-Sent",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Number-Of-Participants */
-		{
-			struct dict_avp_data data = {
-				885,	/* Code */
-				10415,	/* Vendor */
-				"Number-Of-Participants",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Number-Of-Received-Talk-Bursts */
-		{
-			struct dict_avp_data data = {
-				1282,	/* Code */
-				10415,	/* Vendor */
-				"Number-Of-Received-Talk-Bursts",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Number-Of-Talk-Bursts */
-		{
-			struct dict_avp_data data = {
-				1283,	/* Code */
-				10415,	/* Vendor */
-				"Number-Of-Talk-Bursts",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Number-Portability-Routing-Information */
-		{
-			struct dict_avp_data data = {
-				2024,	/* Code */
-				10415,	/* Vendor */
-				"Number-Portability-Routing-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Online-Charging-Flag */
-		{
-			struct dict_avp_data data = {
-				2303,	/* Code */
-				10415,	/* Vendor */
-				"Online-Charging-Flag",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Online-Charging-Flag)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ECF_address_not_provided", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ECF_address_provided", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Originating-IOI */
-		{
-			struct dict_avp_data data = {
-				839,	/* Code */
-				10415,	/* Vendor */
-				"Originating-IOI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Originator */
-		{
-			struct dict_avp_data data = {
-				864,	/* Code */
-				10415,	/* Vendor */
-				"Originator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Originator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Calling_Party", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Called_Party", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Originator-SCCP-Address */
-		{
-			struct dict_avp_data data = {
-				2008,	/* Code */
-				10415,	/* Vendor */
-				"Originator-SCCP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Outgoing-Session-Id */
-		{
-			struct dict_avp_data data = {
-				2320,	/* Code */
-				10415,	/* Vendor */
-				"Outgoing-Session-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Outgoing-Trunk-Group-Id */
-		{
-			struct dict_avp_data data = {
-				853,	/* Code */
-				10415,	/* Vendor */
-				"Outgoing-Trunk-Group-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Participant-Access-Priority */
-		{
-			struct dict_avp_data data = {
-				1259,	/* Code */
-				10415,	/* Vendor */
-				"Participant-Access-Priority",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Participant-Access-Priority)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Pre_emptive_priority", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "High_priority", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "Normal_priority", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "Low_priority", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Participant-Action-Type */
-		{
-			struct dict_avp_data data = {
-				2049,	/* Code */
-				10415,	/* Vendor */
-				"Participant-Action-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Participant-Action-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CREATE_CONF", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "JOIN_CONF", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "INVITE_INTO_CONF", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "QUIT_CONF", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Participants-Involved */
-		{
-			struct dict_avp_data data = {
-				887,	/* Code */
-				10415,	/* Vendor */
-				"Participants-Involved",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* PC3-Control-Protocol-Cause */
-		{
-			struct dict_avp_data data = {
-				3434,	/* Code */
-				10415,	/* Vendor */
-				"PC3-Control-Protocol-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* PC3-EPC-Control-Protocol-Cause */
-		{
-			struct dict_avp_data data = {
-				3435,	/* Code */
-				10415,	/* Vendor */
-				"PC3-EPC-Control-Protocol-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* PDN-Connection-Charging-ID */
-		{
-			struct dict_avp_data data = {
-				2050,	/* Code */
-				10415,	/* Vendor */
-				"PDN-Connection-Charging-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* PDP-Address */
-		{
-			struct dict_avp_data data = {
-				1227,	/* Code */
-				10415,	/* Vendor */
-				"PDP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* PDP-Address-Prefix-Length */
-		{
-			struct dict_avp_data data = {
-				2606,	/* Code */
-				10415,	/* Vendor */
-				"PDP-Address-Prefix-Length",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* PDP-Context-Type */
-		{
-			struct dict_avp_data data = {
-				1247,	/* Code */
-				10415,	/* Vendor */
-				"PDP-Context-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PDP-Context-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Primary", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Secondary", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Play-Alternative */
-		{
-			struct dict_avp_data data = {
-				3913,	/* Code */
-				10415,	/* Vendor */
-				"Play-Alternative",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Play-Alternative)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "served_party", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "remote_party", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PoC-Change-Condition */
-		{
-			struct dict_avp_data data = {
-				1261,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Change-Condition",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Change-Condition)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ServiceChange", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "VolumeLimit", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "TimeLimit", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "NumberofTalkBurstLimit", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "NumberofActiveParticipants", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "TariffTime", { .i32=5 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PoC-Change-Time */
-		{
-			struct dict_avp_data data = {
-				1262,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Change-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* PoC-Controlling-Address */
-		{
-			struct dict_avp_data data = {
-				858,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Controlling-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* PoC-Event-Type */
-		{
-			struct dict_avp_data data = {
-				2025,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Event-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Event-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Normal", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Instant_Personal_Alert", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "PoC_Group_Advertisement", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "Early_Session_Setting_Up", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "PoC_Talk_Burst", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PoC-Group-Name */
-		{
-			struct dict_avp_data data = {
-				859,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Group-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* PoC-Server-Role */
-		{
-			struct dict_avp_data data = {
-				883,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Server-Role",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Server-Role)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Participating_PoC_Server", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Controlling_PoC_Server", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PoC-Session-Id */
-		{
-			struct dict_avp_data data = {
-				1229,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Session-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* PoC-Session-Initiation-Type */
-		{
-			struct dict_avp_data data = {
-				1277,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Session-Initiation-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Session-Initiation-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Pre_established", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "On_demand", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PoC-Session-Type */
-		{
-			struct dict_avp_data data = {
-				884,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Session-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-Session-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "1_to_1_PoC", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Chat_PoC_Group", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Pre_arranged_PoC_Group", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "Ad_hoc_PoC_Gropu", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PoC-User-Role-IDs */
-		{
-			struct dict_avp_data data = {
-				1253,	/* Code */
-				10415,	/* Vendor */
-				"PoC-User-Role-IDs",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* PoC-User-Role-Info-Units */
-		{
-			struct dict_avp_data data = {
-				1254,	/* Code */
-				10415,	/* Vendor */
-				"PoC-User-Role-Info-Units",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PoC-User-Role-Info-Units)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Moderator", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "Dispatcher", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "Session_Owner", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "Session_Participant", { .i32=4 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Positioning-Data */
-		{
-			struct dict_avp_data data = {
-				1245,	/* Code */
-				10415,	/* Vendor */
-				"Positioning-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Preferred-AoC-Currency */
-		{
-			struct dict_avp_data data = {
-				2315,	/* Code */
-				10415,	/* Vendor */
-				"Preferred-AoC-Currency",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Priority */
-		{
-			struct dict_avp_data data = {
-				1209,	/* Code */
-				10415,	/* Vendor */
-				"Priority",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Priority)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Low", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Normal", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "High", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Privacy-Indicator */
-		{
-			struct dict_avp_data data = {
-				3915,	/* Code */
-				10415,	/* Vendor */
-				"Privacy-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Privacy-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "NOT_PRIVATE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PRIVATE", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ProSe-3rd-Party-Application-ID */
-		{
-			struct dict_avp_data data = {
-				3440,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-3rd-Party-Application-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* ProSe-Direct-Discovery-Model */
-		{
-			struct dict_avp_data data = {
-				3442,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Direct-Discovery-Model",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Direct-Discovery-Model)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Model_A", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Model_B", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ProSe-Event-Type */
-		{
-			struct dict_avp_data data = {
-				3443,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Event-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Event-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Annoucing", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Monitoring", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Match_Report", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ProSe-Function-IP-Address */
-		{
-			struct dict_avp_data data = {
-				3444,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Function-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* ProSe-Function-PLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				3457,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Function-PLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* ProSe-Functionality */
-		{
-			struct dict_avp_data data = {
-				3445,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Functionality",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Functionality)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Direct_discovery", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "EPC_level_discovery", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Direct_communication", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ProSe-Group-IP-Multicast-Address */
-		{
-			struct dict_avp_data data = {
-				3446,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Group-IP-Multicast-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* ProSe-Range-Class */
-		{
-			struct dict_avp_data data = {
-				3448,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Range-Class",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Range-Class)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Reserved", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "50_m", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "100_m", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "Unused", { .i32=255 }};
-			struct dict_enumval_data        t_5 = { "200_m", { .i32=3 }};
-			struct dict_enumval_data        t_6 = { "500_m", { .i32=4 }};
-			struct dict_enumval_data        t_7 = { "1000_m", { .i32=5 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ProSe-Reason-For-Cancellation */
-		{
-			struct dict_avp_data data = {
-				3449,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Reason-For-Cancellation",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Reason-For-Cancellation)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Proximity_Alert_sent", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Time_expired_with_no_renewal", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Requestor_cancellation", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ProSe-Request-Timestamp */
-		{
-			struct dict_avp_data data = {
-				3450,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Request-Timestamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* ProSe-Role-Of-UE */
-		{
-			struct dict_avp_data data = {
-				3451,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Role-Of-UE",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(ProSe-Role-Of-UE)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Announcing_UE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Monitoring_UE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Requestor_UE", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "Requested_UE", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* ProSe-Source-IP-Address */
-		{
-			struct dict_avp_data data = {
-				3452,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Source-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* ProSe-UE-ID */
-		{
-			struct dict_avp_data data = {
-				3453,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-UE-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Proximity-Alert-Indication */
-		{
-			struct dict_avp_data data = {
-				3454,	/* Code */
-				10415,	/* Vendor */
-				"Proximity-Alert-Indication",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Proximity-Alert-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Alert", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "No_Alert", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Proximity-Alert-Timestamp */
-		{
-			struct dict_avp_data data = {
-				3455,	/* Code */
-				10415,	/* Vendor */
-				"Proximity-Alert-Timestamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Proximity-Cancellation-Timestamp */
-		{
-			struct dict_avp_data data = {
-				3456,	/* Code */
-				10415,	/* Vendor */
-				"Proximity-Cancellation-Timestamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* PS-Append-Free-Format-Data */
-		{
-			struct dict_avp_data data = {
-				867,	/* Code */
-				10415,	/* Vendor */
-				"PS-Append-Free-Format-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(PS-Append-Free-Format-Data)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Append", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Overwrite", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* PS-Free-Format-Data */
-		{
-			struct dict_avp_data data = {
-				866,	/* Code */
-				10415,	/* Vendor */
-				"PS-Free-Format-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Quota-Consumption-Time */
-		{
-			struct dict_avp_data data = {
-				881,	/* Code */
-				10415,	/* Vendor */
-				"Quota-Consumption-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Quota-Holding-Time */
-		{
-			struct dict_avp_data data = {
-				871,	/* Code */
-				10415,	/* Vendor */
-				"Quota-Holding-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Quota-Indicator */
-		{
-			struct dict_avp_data data = {
-				3912,	/* Code */
-				10415,	/* Vendor */
-				"Quota-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Quota-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "QUOTA_IS_NOT_USED_DURING_PLAYBACK", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "QUOTA_IS_USED_DURING_PLAYBACK", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Radio-Frequency */
-		{
-			struct dict_avp_data data = {
-				3462,	/* Code */
-				10415,	/* Vendor */
-				"Radio-Frequency",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Radio-Parameter-Set-Values */
-		{
-			struct dict_avp_data data = {
-				3464,	/* Code */
-				10415,	/* Vendor */
-				"Radio-Parameter-Set-Values",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Radio-Resources-Indicator */
-		{
-			struct dict_avp_data data = {
-				3465,	/* Code */
-				10415,	/* Vendor */
-				"Radio-Resources-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Rate-Control-Max-Message-Size */
-		{
-			struct dict_avp_data data = {
-				3937,	/* Code */
-				10415,	/* Vendor */
-				"Rate-Control-Max-Message-Size",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Rate-Control-Max-Rate */
-		{
-			struct dict_avp_data data = {
-				3938,	/* Code */
-				10415,	/* Vendor */
-				"Rate-Control-Max-Rate",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Rate-Control-Time-Unit */
-		{
-			struct dict_avp_data data = {
-				3939,	/* Code */
-				10415,	/* Vendor */
-				"Rate-Control-Time-Unit",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Read-Reply-Report-Requested */
-		{
-			struct dict_avp_data data = {
-				1222,	/* Code */
-				10415,	/* Vendor */
-				"Read-Reply-Report-Requested",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Read-Reply-Report-Requested)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "No", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Yes", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Reason-Header */
-		{
-			struct dict_avp_data data = {
-				3401,	/* Code */
-				10415,	/* Vendor */
-				"Reason-Header",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Received-Talk-Burst-Time */
-		{
-			struct dict_avp_data data = {
-				1284,	/* Code */
-				10415,	/* Vendor */
-				"Received-Talk-Burst-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Received-Talk-Burst-Volume */
-		{
-			struct dict_avp_data data = {
-				1285,	/* Code */
-				10415,	/* Vendor */
-				"Received-Talk-Burst-Volume",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Recipient-SCCP-Address */
-		{
-			struct dict_avp_data data = {
-				2010,	/* Code */
-				10415,	/* Vendor */
-				"Recipient-SCCP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Refund-Information */
-		{
-			struct dict_avp_data data = {
-				2022,	/* Code */
-				10415,	/* Vendor */
-				"Refund-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Related-IMS-Charging-Identifier */
-		{
-			struct dict_avp_data data = {
-				2711,	/* Code */
-				10415,	/* Vendor */
-				"Related-IMS-Charging-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Related-IMS-Charging-Identifier-Node */
-		{
-			struct dict_avp_data data = {
-				2712,	/* Code */
-				10415,	/* Vendor */
-				"Related-IMS-Charging-Identifier-Node",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Relationship-Mode */
-		{
-			struct dict_avp_data data = {
-				2706,	/* Code */
-				10415,	/* Vendor */
-				"Relationship-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Relationship-Mode)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "trusted", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "non_trusted", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Reply-Applic-ID */
-		{
-			struct dict_avp_data data = {
-				1223,	/* Code */
-				10415,	/* Vendor */
-				"Reply-Applic-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Reply-Path-Requested */
-		{
-			struct dict_avp_data data = {
-				2011,	/* Code */
-				10415,	/* Vendor */
-				"Reply-Path-Requested",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Reply-Path-Requested)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "No_Reply_Path_Set", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Reply_path_Set", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Reporting-Reason */
-		{
-			struct dict_avp_data data = {
-				872,	/* Code */
-				10415,	/* Vendor */
-				"Reporting-Reason",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Reporting-Reason)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "THRESHOLD", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "QHT", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "FINAL", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "QUOTA_EXHAUSTED", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "VALIDITY_TIME", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "OTHER_QUOTA_TYPE", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "RATING_CONDITION_CHANGE", { .i32=6 }};
-			struct dict_enumval_data        t_8 = { "FORCED_REAUTHORISATION", { .i32=7 }};
-			struct dict_enumval_data        t_9 = { "POOL_EXHAUSTED", { .i32=8 }};
-			struct dict_enumval_data        t_10 = { "UNUSED_QUOTA_TIMER", { .i32=9 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Requested-Party-Address */
-		{
-			struct dict_avp_data data = {
-				1251,	/* Code */
-				10415,	/* Vendor */
-				"Requested-Party-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Requested-PLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				3436,	/* Code */
-				10415,	/* Vendor */
-				"Requested-PLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Requestor-PLMN-Identifier */
-		{
-			struct dict_avp_data data = {
-				3437,	/* Code */
-				10415,	/* Vendor */
-				"Requestor-PLMN-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Role-Of-Node */
-		{
-			struct dict_avp_data data = {
-				829,	/* Code */
-				10415,	/* Vendor */
-				"Role-Of-Node",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Role-Of-Node)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ORIGINATING_ROLE", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "TERMINATING_ROLE", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "FORWARDING_ROLE", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Role-Of-ProSe-Function */
-		{
-			struct dict_avp_data data = {
-				3438,	/* Code */
-				10415,	/* Vendor */
-				"Role-Of-ProSe-Function",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Role-Of-ProSe-Function)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "HPLMN", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "VPLMN", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Local_PLMN", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Route-Header-Received */
-		{
-			struct dict_avp_data data = {
-				3403,	/* Code */
-				10415,	/* Vendor */
-				"Route-Header-Received",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Route-Header-Transmitted */
-		{
-			struct dict_avp_data data = {
-				3404,	/* Code */
-				10415,	/* Vendor */
-				"Route-Header-Transmitted",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* SCS-Address */
-		{
-			struct dict_avp_data data = {
-				3941,	/* Code */
-				10415,	/* Vendor */
-				"SCS-Address",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* SCS-Realm */
-		{
-			struct dict_avp_data data = {
-				3942,	/* Code */
-				10415,	/* Vendor */
-				"SCS-Realm",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* SDP-Answer-Timestamp */
-		{
-			struct dict_avp_data data = {
-				1275,	/* Code */
-				10415,	/* Vendor */
-				"SDP-Answer-Timestamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* SDP-Media-Description */
-		{
-			struct dict_avp_data data = {
-				845,	/* Code */
-				10415,	/* Vendor */
-				"SDP-Media-Description",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* SDP-Media-Name */
-		{
-			struct dict_avp_data data = {
-				844,	/* Code */
-				10415,	/* Vendor */
-				"SDP-Media-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* SDP-Offer-Timestamp */
-		{
-			struct dict_avp_data data = {
-				1274,	/* Code */
-				10415,	/* Vendor */
-				"SDP-Offer-Timestamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* SDP-Session-Description */
-		{
-			struct dict_avp_data data = {
-				842,	/* Code */
-				10415,	/* Vendor */
-				"SDP-Session-Description",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* SDP-Type */
-		{
-			struct dict_avp_data data = {
-				2036,	/* Code */
-				10415,	/* Vendor */
-				"SDP-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SDP-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SDP_Offer", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "SDP_Answer", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Serving-Node-Identity */
-		{
-			struct dict_avp_data data = {
-				3929,	/* Code */
-				10415,	/* Vendor */
-				"Serving-Node-Identity",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, DiameterIdentity_type, NULL);
-		};
-		/* Served-Party-IP-Address */
-		{
-			struct dict_avp_data data = {
-				848,	/* Code */
-				10415,	/* Vendor */
-				"Served-Party-IP-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Service-Id */
-		{
-			struct dict_avp_data data = {
-				855,	/* Code */
-				10415,	/* Vendor */
-				"Service-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Service-Mode */
-		{
-			struct dict_avp_data data = {
-				2032,	/* Code */
-				10415,	/* Vendor */
-				"Service-Mode",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Service-Specific-Data */
-		{
-			struct dict_avp_data data = {
-				863,	/* Code */
-				10415,	/* Vendor */
-				"Service-Specific-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Service-Specific-Type */
-		{
-			struct dict_avp_data data = {
-				1257,	/* Code */
-				10415,	/* Vendor */
-				"Service-Specific-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Serving-Node-Type */
-		{
-			struct dict_avp_data data = {
-				2047,	/* Code */
-				10415,	/* Vendor */
-				"Serving-Node-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Serving-Node-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SGSN", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PMIPSGW", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "GTPSGW", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "ePDG", { .i32=3 }};
-			struct dict_enumval_data        t_5 = { "hSGW", { .i32=4 }};
-			struct dict_enumval_data        t_6 = { "MME", { .i32=5 }};
-			struct dict_enumval_data        t_7 = { "TWAN", { .i32=6 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Session-Direction */
-		{
-			struct dict_avp_data data = {
-				2707,	/* Code */
-				10415,	/* Vendor */
-				"Session-Direction",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Session-Direction)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "inbound", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "outbound", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SGi-PtP-Tunnelling-Method */
-		{
-			struct dict_avp_data data = {
-				3931,	/* Code */
-				10415,	/* Vendor */
-				"SGi-PtP-Tunnelling-Method",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SGi-PtP-Tunnelling-Method)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UDP_IP_based", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Others", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SGSN-Address */
-		{
-			struct dict_avp_data data = {
-				1228,	/* Code */
-				10415,	/* Vendor */
-				"SGSN-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* SGW-Address */
-		{
-			struct dict_avp_data data = {
-				2067,	/* Code */
-				10415,	/* Vendor */
-				"SGW-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* SGW-Change */
-		{
-			struct dict_avp_data data = {
-				2065,	/* Code */
-				10415,	/* Vendor */
-				"SGW-Change",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SGW-Change)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "ACR_Start_NOT_due_to_SGW_Change", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "ACR_Start_due_to_SGW_Change", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SIP-Method */
-		{
-			struct dict_avp_data data = {
-				824,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Method",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* SIP-Request-Timestamp */
-		{
-			struct dict_avp_data data = {
-				834,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Request-Timestamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* SIP-Request-Timestamp-Fraction */
-		{
-			struct dict_avp_data data = {
-				2301,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Request-Timestamp-Fraction",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SIP-Response-Timestamp */
-		{
-			struct dict_avp_data data = {
-				835,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Response-Timestamp",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* SIP-Response-Timestamp-Fraction */
-		{
-			struct dict_avp_data data = {
-				2302,	/* Code */
-				10415,	/* Vendor */
-				"SIP-Response-Timestamp-Fraction",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Device-Trigger-Indicator */
-		{
-			struct dict_avp_data data = {
-				3407,	/* Code */
-				10415,	/* Vendor */
-				"SM-Device-Trigger-Indicator",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Device-Trigger-Indicator)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Not_DeviceTrigger", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Device_Trigger", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SM-Discharge-Time */
-		{
-			struct dict_avp_data data = {
-				2012,	/* Code */
-				10415,	/* Vendor */
-				"SM-Discharge-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* SM-Message-Type */
-		{
-			struct dict_avp_data data = {
-				2007,	/* Code */
-				10415,	/* Vendor */
-				"SM-Message-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Message-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SUBMISSION", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "DELIVERY_REPORT", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "SM_Service_Request", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SM-Protocol-ID */
-		{
-			struct dict_avp_data data = {
-				2013,	/* Code */
-				10415,	/* Vendor */
-				"SM-Protocol-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Sequence-Number */
-		{
-			struct dict_avp_data data = {
-				3408,	/* Code */
-				10415,	/* Vendor */
-				"SM-Sequence-Number",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-Service-Type */
-		{
-			struct dict_avp_data data = {
-				2029,	/* Code */
-				10415,	/* Vendor */
-				"SM-Service-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SM-Service-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "VAS4SMS_Short_Message_content_processing", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "VAS4SMS_Short_Message_forwarding", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "VAS4SMS_Short_Message_Deferred_Delivery", { .i32=10 }};
-			struct dict_enumval_data        t_4 = { "VAS4SMS_Short_Message_Forwarding_multiple_subscriptions", { .i32=2 }};
-			struct dict_enumval_data        t_5 = { "VAS4SMS_Short_Message_filtering", { .i32=3 }};
-			struct dict_enumval_data        t_6 = { "VAS4SMS_Short_Message_receipt", { .i32=4 }};
-			struct dict_enumval_data        t_7 = { "VAS4SMS_Short_Message_Network_Storage", { .i32=5 }};
-			struct dict_enumval_data        t_8 = { "VAS4SMS_Short_Message_to_multiple_destinations", { .i32=6 }};
-			struct dict_enumval_data        t_9 = { "VAS4SMS_Short_Message_Auto_Reply", { .i32=8 }};
-			struct dict_enumval_data        t_10 = { "VAS4SMS_Short_Message_Personal_Signature", { .i32=9 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SM-Status */
-		{
-			struct dict_avp_data data = {
-				2014,	/* Code */
-				10415,	/* Vendor */
-				"SM-Status",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SM-User-Data-Header */
-		{
-			struct dict_avp_data data = {
-				2015,	/* Code */
-				10415,	/* Vendor */
-				"SM-User-Data-Header",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SMS-Node */
-		{
-			struct dict_avp_data data = {
-				2016,	/* Code */
-				10415,	/* Vendor */
-				"SMS-Node",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(SMS-Node)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "SMS_Router", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "IP_SM_GW", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "SMS_Router_and_IP_SM_GW", { .i32=2 }};
-			struct dict_enumval_data        t_4 = { "SMS_SC", { .i32=3 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* SMS-Result */
-		{
-			struct dict_avp_data data = {
-				3409,	/* Code */
-				10415,	/* Vendor */
-				"SMS-Result",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* SMSC-Address */
-		{
-			struct dict_avp_data data = {
-				2017,	/* Code */
-				10415,	/* Vendor */
-				"SMSC-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Start-of-Charging */
-		{
-			struct dict_avp_data data = {
-				3419,	/* Code */
-				10415,	/* Vendor */
-				"Start-of-Charging",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Start-Time */
-		{
-			struct dict_avp_data data = {
-				2041,	/* Code */
-				10415,	/* Vendor */
-				"Start-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Status-AS-Code */
-		{
-			struct dict_avp_data data = {
-				2702,	/* Code */
-				10415,	/* Vendor */
-				"Status-AS-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Status-AS-Code)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "4xx", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "5xx", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "Timeout", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Stop-Time */
-		{
-			struct dict_avp_data data = {
-				2042,	/* Code */
-				10415,	/* Vendor */
-				"Stop-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Submission-Time */
-		{
-			struct dict_avp_data data = {
-				1202,	/* Code */
-				10415,	/* Vendor */
-				"Submission-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Subscriber-Role */
-		{
-			struct dict_avp_data data = {
-				2033,	/* Code */
-				10415,	/* Vendor */
-				"Subscriber-Role",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Subscriber-Role)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Originating", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Terminating", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* TAD-Identifier */
-		{
-			struct dict_avp_data data = {
-				2717,	/* Code */
-				10415,	/* Vendor */
-				"TAD-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(TAD-Identifier)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CS", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "PS", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Talk-Burst-Time */
-		{
-			struct dict_avp_data data = {
-				1286,	/* Code */
-				10415,	/* Vendor */
-				"Talk-Burst-Time",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Talk-Burst-Volume */
-		{
-			struct dict_avp_data data = {
-				1287,	/* Code */
-				10415,	/* Vendor */
-				"Talk-Burst-Volume",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Tariff-XML */
-		{
-			struct dict_avp_data data = {
-				2306,	/* Code */
-				10415,	/* Vendor */
-				"Tariff-XML",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Teleservice */
-		{
-			struct dict_avp_data data = {
-				3413,	/* Code */
-				10415,	/* Vendor */
-				"Teleservice",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Terminating-IOI */
-		{
-			struct dict_avp_data data = {
-				840,	/* Code */
-				10415,	/* Vendor */
-				"Terminating-IOI",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Time-First-Reception */
-		{
-			struct dict_avp_data data = {
-				3466,	/* Code */
-				10415,	/* Vendor */
-				"Time-First-Reception",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Time-First-Transmission */
-		{
-			struct dict_avp_data data = {
-				3467,	/* Code */
-				10415,	/* Vendor */
-				"Time-First-Transmission",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Time-First-Usage */
-		{
-			struct dict_avp_data data = {
-				2043,	/* Code */
-				10415,	/* Vendor */
-				"Time-First-Usage",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Time-Indicator */
-		{
-			struct dict_avp_data data = {
-				3911,	/* Code */
-				10415,	/* Vendor */
-				"Time-Indicator",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Time-Last-Usage */
-		{
-			struct dict_avp_data data = {
-				2044,	/* Code */
-				10415,	/* Vendor */
-				"Time-Last-Usage",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Time-Quota-Threshold */
-		{
-			struct dict_avp_data data = {
-				868,	/* Code */
-				10415,	/* Vendor */
-				"Time-Quota-Threshold",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Time-Quota-Type */
-		{
-			struct dict_avp_data data = {
-				1271,	/* Code */
-				10415,	/* Vendor */
-				"Time-Quota-Type",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Time-Quota-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "DISCRETE_TIME_PERIOD", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "CONTINUOUS_TIME_PERIOD", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Time-Usage */
-		{
-			struct dict_avp_data data = {
-				2045,	/* Code */
-				10415,	/* Vendor */
-				"Time-Usage",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Token-Text */
-		{
-			struct dict_avp_data data = {
-				1215,	/* Code */
-				10415,	/* Vendor */
-				"Token-Text",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Transcoder-Inserted-Indication */
-		{
-			struct dict_avp_data data = {
-				2605,	/* Code */
-				10415,	/* Vendor */
-				"Transcoder-Inserted-Indication",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Transcoder-Inserted-Indication)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Transcoder_Not_Inserted", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "Transcoder_Inserted", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Transit-IOI-List */
-		{
-			struct dict_avp_data data = {
-				2701,	/* Code */
-				10415,	/* Vendor */
-				"Transit-IOI-List",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Trigger-Type */
-		{
-			struct dict_avp_data data = {
-				870,	/* Code */
-				10415,	/* Vendor */
-				"Trigger-Type",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(Trigger-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "CHANGE_IN_SGSN_IP_ADDRESS", { .i32=1 }};
-			struct dict_enumval_data        t_2 = { "CHANGE_IN_QOS", { .i32=2 }};
-			struct dict_enumval_data        t_3 = { "CHANGE_IN_LOCATION", { .i32=3 }};
-			struct dict_enumval_data        t_4 = { "CHANGE_IN_RAT", { .i32=4 }};
-			struct dict_enumval_data        t_5 = { "CHANGE_IN_UE_TIMEZONE", { .i32=5 }};
-			struct dict_enumval_data        t_6 = { "CHANGEINQOS_TRAFFIC_CLASS", { .i32=10 }};
-			struct dict_enumval_data        t_7 = { "CHANGEINQOS_RELIABILITY_CLASS", { .i32=11 }};
-			struct dict_enumval_data        t_8 = { "CHANGEINQOS_DELAY_CLASS", { .i32=12 }};
-			struct dict_enumval_data        t_9 = { "CHANGEINQOS_PEAK_THROUGHPUT", { .i32=13 }};
-			struct dict_enumval_data        t_10 = { "CHANGEINQOS_PRECEDENCE_CLASS", { .i32=14 }};
-			struct dict_enumval_data        t_11 = { "CHANGEINQOS_MEAN_THROUGHPUT", { .i32=15 }};
-			struct dict_enumval_data        t_12 = { "CHANGEINQOS_MAXIMUM_BIT_RATE_FOR_UPLINK", { .i32=16 }};
-			struct dict_enumval_data        t_13 = { "CHANGEINQOS_MAXIMUM_BIT_RATE_FOR_DOWNLINK", { .i32=17 }};
-			struct dict_enumval_data        t_14 = { "CHANGEINQOS_RESIDUAL_BER", { .i32=18 }};
-			struct dict_enumval_data        t_15 = { "CHANGEINQOS_SDU_ERROR_RATIO", { .i32=19 }};
-			struct dict_enumval_data        t_16 = { "CHANGEINQOS_TRANSFER_DELAY", { .i32=20 }};
-			struct dict_enumval_data        t_17 = { "CHANGEINQOS_TRAFFIC_HANDLING_PRIORITY", { .i32=21 }};
-			struct dict_enumval_data        t_18 = { "CHANGEINQOS_GUARANTEED_BIT_RATE_FOR_UPLINK", { .i32=22 }};
-			struct dict_enumval_data        t_19 = { "CHANGEINQOS_GUARANTEED_BIT_RATE_FOR_DOWNLINK", { .i32=23 }};
-			struct dict_enumval_data        t_20 = { "CHANGEINQOS_APN_AGGREGATE_MAXIMUM_BIT_RATE", { .i32=24 }};
-			struct dict_enumval_data        t_21 = { "CHANGEINLOCATION_MCC", { .i32=30 }};
-			struct dict_enumval_data        t_22 = { "CHANGEINLOCATION_MNC", { .i32=31 }};
-			struct dict_enumval_data        t_23 = { "CHANGEINLOCATION_RAC", { .i32=32 }};
-			struct dict_enumval_data        t_24 = { "CHANGEINLOCATION_LAC", { .i32=33 }};
-			struct dict_enumval_data        t_25 = { "CHANGEINLOCATION_CellId", { .i32=34 }};
-			struct dict_enumval_data        t_26 = { "CHANGEINLOCATION_TAC", { .i32=35 }};
-			struct dict_enumval_data        t_27 = { "CHANGEINLOCATION_ECGI", { .i32=36 }};
-			struct dict_enumval_data        t_28 = { "CHANGE_IN_MEDIA_COMPOSITION", { .i32=40 }};
-			struct dict_enumval_data        t_29 = { "CHANGE_IN_PARTICIPANTS_NMB", { .i32=50 }};
-			struct dict_enumval_data        t_30 = { "CHANGE_IN_THRSHLD_OF_PARTICIPANTS_NMB", { .i32=51 }};
-			struct dict_enumval_data        t_31 = { "CHANGE_IN_USER_PARTICIPATING_TYPE", { .i32=52 }};
-			struct dict_enumval_data        t_32 = { "CHANGE_IN_SERVICE_CONDITION", { .i32=60 }};
-			struct dict_enumval_data        t_33 = { "CHANGE_IN_SERVING_NODE", { .i32=61 }};
-			struct dict_enumval_data        t_34 = { "CHANGE_IN_ACCESS_FOR_A_SERVICE_DATA_FLOW", { .i32=62 }};
-			struct dict_enumval_data        t_35 = { "CHANGE_IN_USER_CSG_INFORMATION", { .i32=70 }};
-			struct dict_enumval_data        t_36 = { "CHANGE_IN_HYBRID_SUBSCRIBED_USER_CSG_INFORMATION", { .i32=71 }};
-			struct dict_enumval_data        t_37 = { "CHANGE_IN_HYBRID_UNSUBSCRIBED_USER_CSG_INFORMATION", { .i32=72 }};
-			struct dict_enumval_data        t_38 = { "CHANGE_OF_UE_PRESENCE_IN_PRESENCE_REPORTING_AREA", { .i32=73 }};
-			struct dict_enumval_data        t_39 = { "CHANGE_IN_APN_RATE_CONTROL", { .i32=75 }};
-			struct dict_enumval_data        t_40 = { "CHANGE_IN_3GPP_PS_DATA_OFF", { .i32=76 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_4, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_5, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_6, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_7, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_8, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_9, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_10, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_11, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_12, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_13, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_14, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_15, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_16, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_17, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_18, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_19, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_20, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_21, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_22, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_23, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_24, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_25, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_26, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_27, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_28, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_29, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_30, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_31, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_32, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_33, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_34, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_35, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_36, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_37, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_38, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_39, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_40, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* TWAG-Address */
-		{
-			struct dict_avp_data data = {
-				3903,	/* Code */
-				10415,	/* Vendor */
-				"TWAG-Address",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Address_type, NULL);
-		};
-		/* Type-Number */
-		{
-			struct dict_avp_data data = {
-				1204,	/* Code */
-				10415,	/* Vendor */
-				"Type-Number",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* UNI-PDU-CP-Only-Flag */
-		{
-			struct dict_avp_data data = {
-				3932,	/* Code */
-				10415,	/* Vendor */
-				"UNI-PDU-CP-Only-Flag",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(UNI-PDU-CP-Only-Flag)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "UNI_PDU_both_UP_CP", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "UNI_PDU_CP_Only", { .i32=1 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* Unit-Quota-Threshold */
-		{
-			struct dict_avp_data data = {
-				1226,	/* Code */
-				10415,	/* Vendor */
-				"Unit-Quota-Threshold",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Usage-Information-Report-Sequence-Number */
-		{
-			struct dict_avp_data data = {
-				3439,	/* Code */
-				10415,	/* Vendor */
-				"Usage-Information-Report-Sequence-Number",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* User-Participating-Type */
-		{
-			struct dict_avp_data data = {
-				1279,	/* Code */
-				10415,	/* Vendor */
-				"User-Participating-Type",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_INTEGER32	/* base type of data */
-			};
-			struct dict_object        *type;
-			struct dict_type_data     tdata = { AVP_TYPE_INTEGER32, "3GPP/Enumerated(User-Participating-Type)", NULL, NULL, NULL };
-			struct dict_enumval_data        t_1 = { "Normal", { .i32=0 }};
-			struct dict_enumval_data        t_2 = { "NW_PoC_Box", { .i32=1 }};
-			struct dict_enumval_data        t_3 = { "UE_PoC_Box", { .i32=2 }};
-			/* Create the Enumerated type, and then the AVP */
-			CHECK_dict_new( DICT_TYPE, &tdata, NULL, &type);
-			CHECK_dict_new( DICT_ENUMVAL, &t_1, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_2, type, NULL);
-			CHECK_dict_new( DICT_ENUMVAL, &t_3, type, NULL);
-			CHECK_dict_new( DICT_AVP, &data, type, NULL);
-		};
-		/* User-Session-Id */
-		{
-			struct dict_avp_data data = {
-				830,	/* Code */
-				10415,	/* Vendor */
-				"User-Session-Id",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* Variable-Part-Order */
-		{
-			struct dict_avp_data data = {
-				3908,	/* Code */
-				10415,	/* Vendor */
-				"Variable-Part-Order",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Variable-Part-Type */
-		{
-			struct dict_avp_data data = {
-				3909,	/* Code */
-				10415,	/* Vendor */
-				"Variable-Part-Type",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Variable-Part-Value */
-		{
-			struct dict_avp_data data = {
-				3910,	/* Code */
-				10415,	/* Vendor */
-				"Variable-Part-Value",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, UTF8String_type, NULL);
-		};
-		/* VLR-Number */
-		{
-			struct dict_avp_data data = {
-				3420,	/* Code */
-				10415,	/* Vendor */
-				"VLR-Number",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Volume-Quota-Threshold */
-		{
-			struct dict_avp_data data = {
-				869,	/* Code */
-				10415,	/* Vendor */
-				"Volume-Quota-Threshold",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_UNSIGNED32	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, NULL, NULL);
-		};
-		/* Submission-Timestamp */
-		{
-			struct dict_avp_data data = {
-				9911,	/* Code */
-				10415,	/* Vendor */
-				"Submission-Timestamp",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_OCTETSTRING	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data, Time_type, NULL);
-		};
-		/* Scale-Factor */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2059,	/* Code */
-				10415,	/* Vendor */
-				"Scale-Factor",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SDP-Media-Component */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				843,	/* Code */
-				10415,	/* Vendor */
-				"SDP-Media-Component",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* UWAN-User-Location-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3918,	/* Code */
-				10415,	/* Vendor */
-				"UWAN-User-Location-Info",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Address-Domain */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				898,	/* Code */
-				10415,	/* Vendor */
-				"Address-Domain",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Location-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3460,	/* Code */
-				10415,	/* Vendor */
-				"Location-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MBMS-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				880,	/* Code */
-				10415,	/* Vendor */
-				"MBMS-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* AoC-Service */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2311,	/* Code */
-				10415,	/* Vendor */
-				"AoC-Service",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* ProSe-Direct-Communication-Transmission-Data-Container */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3441,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Direct-Communication-Transmission-Data-Container",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* APN-Rate-Control-Downlink */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3934,	/* Code */
-				10415,	/* Vendor */
-				"APN-Rate-Control-Downlink",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* PoC-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				879,	/* Code */
-				10415,	/* Vendor */
-				"PoC-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Supplementary-Service */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2048,	/* Code */
-				10415,	/* Vendor */
-				"Supplementary-Service",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Transmitter-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3468,	/* Code */
-				10415,	/* Vendor */
-				"Transmitter-Info",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Unit-Cost */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2061,	/* Code */
-				10415,	/* Vendor */
-				"Unit-Cost",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Time-Stamps */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				833,	/* Code */
-				10415,	/* Vendor */
-				"Time-Stamps",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* NNI-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2703,	/* Code */
-				10415,	/* Vendor */
-				"NNI-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Trigger */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1264,	/* Code */
-				10415,	/* Vendor */
-				"Trigger",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Related-Trigger */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3926,	/* Code */
-				10415,	/* Vendor */
-				"Related-Trigger",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Talk-Burst-Exchange */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1255,	/* Code */
-				10415,	/* Vendor */
-				"Talk-Burst-Exchange",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Time-Quota-Mechanism */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1270,	/* Code */
-				10415,	/* Vendor */
-				"Time-Quota-Mechanism",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Variable-Part */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3907,	/* Code */
-				10415,	/* Vendor */
-				"Variable-Part",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Additional-Content-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1207,	/* Code */
-				10415,	/* Vendor */
-				"Additional-Content-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* APN-Rate-Control-Uplink */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3935,	/* Code */
-				10415,	/* Vendor */
-				"APN-Rate-Control-Uplink",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Basic-Service-Code */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3411,	/* Code */
-				10415,	/* Vendor */
-				"Basic-Service-Code",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Event-Type */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				823,	/* Code */
-				10415,	/* Vendor */
-				"Event-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* ProSe-Direct-Communication-Reception-Data-Container */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3461,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Direct-Communication-Reception-Data-Container",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Originator-Interface */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2009,	/* Code */
-				10415,	/* Vendor */
-				"Originator-Interface",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Destination-Interface */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2002,	/* Code */
-				10415,	/* Vendor */
-				"Destination-Interface",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* ISUP-Cause */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3416,	/* Code */
-				10415,	/* Vendor */
-				"ISUP-Cause",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* LCS-Requestor-ID */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1239,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Requestor-ID",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* PS-Furnish-Charging-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				865,	/* Code */
-				10415,	/* Vendor */
-				"PS-Furnish-Charging-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* User-CSG-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2319,	/* Code */
-				10415,	/* Vendor */
-				"User-CSG-Information",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Called-Identity-Change */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3917,	/* Code */
-				10415,	/* Vendor */
-				"Called-Identity-Change",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Service-Specific-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1249,	/* Code */
-				10415,	/* Vendor */
-				"Service-Specific-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Accumulated-Cost */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2052,	/* Code */
-				10415,	/* Vendor */
-				"Accumulated-Cost",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SCS-AS-Address */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3940,	/* Code */
-				10415,	/* Vendor */
-				"SCS-AS-Address",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Message-Class */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1213,	/* Code */
-				10415,	/* Vendor */
-				"Message-Class",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Location-Type */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1244,	/* Code */
-				10415,	/* Vendor */
-				"Location-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Rate-Element */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2058,	/* Code */
-				10415,	/* Vendor */
-				"Rate-Element",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Participant-Group */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1260,	/* Code */
-				10415,	/* Vendor */
-				"Participant-Group",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Enhanced-Diagnostics */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3901,	/* Code */
-				10415,	/* Vendor */
-				"Enhanced-Diagnostics",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Access-Network-Info-Change */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				4401,	/* Code */
-				10415,	/* Vendor */
-				"Access-Network-Info-Change",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* PoC-User-Role */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1252,	/* Code */
-				10415,	/* Vendor */
-				"PoC-User-Role",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* LCS-Client-Name */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1235,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Client-Name",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Message-Body */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				889,	/* Code */
-				10415,	/* Vendor */
-				"Message-Body",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Radio-Parameter-Set-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3463,	/* Code */
-				10415,	/* Vendor */
-				"Radio-Parameter-Set-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SM-Device-Trigger-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3405,	/* Code */
-				10415,	/* Vendor */
-				"SM-Device-Trigger-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* TWAN-User-Location-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2714,	/* Code */
-				10415,	/* Vendor */
-				"TWAN-User-Location-Info",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* VCS-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3410,	/* Code */
-				10415,	/* Vendor */
-				"VCS-Information",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Trunk-Group-ID */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				851,	/* Code */
-				10415,	/* Vendor */
-				"Trunk-Group-ID",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Incremental-Cost */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2062,	/* Code */
-				10415,	/* Vendor */
-				"Incremental-Cost",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SDP-TimeStamps */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1273,	/* Code */
-				10415,	/* Vendor */
-				"SDP-TimeStamps",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Inter-Operator-Identifier */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				838,	/* Code */
-				10415,	/* Vendor */
-				"Inter-Operator-Identifier",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* NIDD-Submission */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3928,	/* Code */
-				10415,	/* Vendor */
-				"NIDD-Submission",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Application-Server-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				850,	/* Code */
-				10415,	/* Vendor */
-				"Application-Server-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* CPDT-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3927,	/* Code */
-				10415,	/* Vendor */
-				"CPDT-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Envelope */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1266,	/* Code */
-				10415,	/* Vendor */
-				"Envelope",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Related-Change-Condition-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3925,	/* Code */
-				10415,	/* Vendor */
-				"Related-Change-Condition-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* LCS-Client-Id */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1232,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Client-Id",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Early-Media-Description */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1272,	/* Code */
-				10415,	/* Vendor */
-				"Early-Media-Description",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* AoC-Subscription-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2314,	/* Code */
-				10415,	/* Vendor */
-				"AoC-Subscription-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Current-Tariff */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2056,	/* Code */
-				10415,	/* Vendor */
-				"Current-Tariff",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* APN-Rate-Control */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3933,	/* Code */
-				10415,	/* Vendor */
-				"APN-Rate-Control",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Access-Transfer-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2709,	/* Code */
-				10415,	/* Vendor */
-				"Access-Transfer-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Recipient-Received-Address */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2028,	/* Code */
-				10415,	/* Vendor */
-				"Recipient-Received-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* AoC-Cost-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2053,	/* Code */
-				10415,	/* Vendor */
-				"AoC-Cost-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Originator-Address */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				886,	/* Code */
-				10415,	/* Vendor */
-				"Originator-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Originator-Received-Address */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2027,	/* Code */
-				10415,	/* Vendor */
-				"Originator-Received-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Remaining-Balance */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2021,	/* Code */
-				10415,	/* Vendor */
-				"Remaining-Balance",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* AF-Correlation-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1276,	/* Code */
-				10415,	/* Vendor */
-				"AF-Correlation-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Recipient-Address */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1201,	/* Code */
-				10415,	/* Vendor */
-				"Recipient-Address",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Next-Tariff */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2057,	/* Code */
-				10415,	/* Vendor */
-				"Next-Tariff",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Coverage-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3459,	/* Code */
-				10415,	/* Vendor */
-				"Coverage-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Announcement-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3904,	/* Code */
-				10415,	/* Vendor */
-				"Announcement-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MM-Content-Type */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1203,	/* Code */
-				10415,	/* Vendor */
-				"MM-Content-Type",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MMTel-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2030,	/* Code */
-				10415,	/* Vendor */
-				"MMTel-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Service-Data-Container */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2040,	/* Code */
-				10415,	/* Vendor */
-				"Service-Data-Container",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* MMS-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				877,	/* Code */
-				10415,	/* Vendor */
-				"MMS-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Recipient-Info */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2026,	/* Code */
-				10415,	/* Vendor */
-				"Recipient-Info",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Traffic-Data-Volumes */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2046,	/* Code */
-				10415,	/* Vendor */
-				"Traffic-Data-Volumes",	/* Name */
-				0,	/* Fixed flags */
-				0,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* LCS-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				878,	/* Code */
-				10415,	/* Vendor */
-				"LCS-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Tariff-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2060,	/* Code */
-				10415,	/* Vendor */
-				"Tariff-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* ProSe-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3447,	/* Code */
-				10415,	/* Vendor */
-				"ProSe-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* SMS-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2000,	/* Code */
-				10415,	/* Vendor */
-				"SMS-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Real-Time-Tariff-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2305,	/* Code */
-				10415,	/* Vendor */
-				"Real-Time-Tariff-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* AoC-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				2054,	/* Code */
-				10415,	/* Vendor */
-				"AoC-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Monitoring-Event-Report-Data */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3920,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-Event-Report-Data",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Offline-Charging */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				1278,	/* Code */
-				10415,	/* Vendor */
-				"Offline-Charging",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* IMS-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				876,	/* Code */
-				10415,	/* Vendor */
-				"IMS-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Monitoring-Event-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				3921,	/* Code */
-				10415,	/* Vendor */
-				"Monitoring-Event-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* PS-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				874,	/* Code */
-				10415,	/* Vendor */
-				"PS-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-		/* Service-Information */
-		{
-			/* Grouped */
-			struct dict_object * avp;
-			struct dict_avp_data data = {
-				873,	/* Code */
-				10415,	/* Vendor */
-				"Service-Information",	/* Name */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flags */
-				AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY,	/* Fixed flag values */
-				AVP_TYPE_GROUPED	/* base type of data */
-			};
-			CHECK_dict_new( DICT_AVP, &data , NULL, &avp);
-		}
-
-	
-   }
+   CHECK_dict_new_batch( dict_ts32299_avps_defs );
 
    /* Commands section */
    {
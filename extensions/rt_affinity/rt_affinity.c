@@ -0,0 +1,117 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+/* 
+ * This extension sends all the requests of a session to the same peer, without storing any session state.
+ * The Session-Id (or another AVP, see rt_affinity.conf.sample) is hashed with the identity of each candidate
+ * with the best score, and the highest hash wins. The choice therefore only changes for the sessions of a peer
+ * that leaves the candidates, or for the sessions that a peer joining the candidates gets, i.e. about 1/N of them.
+ */
+
+#include "rt_affinity.h"
+
+/* The configuration structure */
+struct rtaff_conf rtaff_conf;
+
+/* The callback called on new messages */
+static int rtaff_out(void * cbdata, struct msg ** pmsg, struct fd_list * candidates)
+{
+	struct msg * msg = *pmsg;
+	struct avp * avp = NULL;
+	
+	TRACE_ENTRY("%p %p %p", cbdata, msg, candidates);
+	
+	CHECK_PARAMS(msg && candidates);
+	
+	/* Check if it is worth processing the message */
+	if (FD_IS_LIST_EMPTY(candidates)) {
+		return 0;
+	}
+	
+	/* Now search the AVP in the message; without it, the request is not part of a session */
+	CHECK_FCT( fd_msg_search_avp ( msg, rtaff_conf.avp, &avp ) );
+	if (avp != NULL) {
+		struct avp_hdr * ahdr = NULL;
+		CHECK_FCT( fd_msg_avp_hdr ( avp, &ahdr ) );
+		if (ahdr->avp_value != NULL) {
+			CHECK_FCT( rtaff_choose(ahdr->avp_value->os.data, ahdr->avp_value->os.len, candidates) );
+		}
+	}
+	
+	return 0;
+}
+
+/* handler */
+static struct fd_rt_out_hdl * rtaff_hdl = NULL;
+
+/* entry point */
+static int rtaff_entry(char * conffile)
+{
+	TRACE_ENTRY("%p", conffile);
+	
+	/* Initialize the configuration */
+	memset(&rtaff_conf, 0, sizeof(rtaff_conf));
+	
+	/* Parse the configuration file */
+	if (conffile) {
+		CHECK_FCT( rtaff_conf_handle(conffile) );
+	}
+	if (!rtaff_conf.avp) {
+		CHECK_FCT( fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME, "Session-Id", &rtaff_conf.avp, ENOENT ) );
+	}
+	
+	/* Register the callback. It chooses among the best candidates once the other callbacks have scored them. */
+	CHECK_FCT( fd_rt_out_register( rtaff_out, NULL, -1, &rtaff_hdl ) );
+	
+	/* We're done */
+	return 0;
+}
+
+/* Unload */
+void fd_ext_fini(void)
+{
+	TRACE_ENTRY();
+	
+	/* Unregister the cb */
+	CHECK_FCT_DO( fd_rt_out_unregister ( rtaff_hdl, NULL ), /* continue */ );
+	
+	/* Destroy the data */
+	rtaff_weight_fini();
+	
+	/* Done */
+	return ;
+}
+
+EXTENSION_ENTRY("rt_affinity", rtaff_entry);
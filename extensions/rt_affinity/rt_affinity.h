@@ -0,0 +1,62 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+/*
+ *  Session affinity routing: the requests of a session are sent to the same peer, as long as it is a candidate.
+ *  See the rt_affinity.conf.sample file for the format of the configuration file.
+ */
+ 
+/* FreeDiameter's common include file */
+#include <freeDiameter/extension.h>
+
+
+/* Parse the configuration file */
+int rtaff_conf_handle(char * conffile);
+
+/* The configuration structure */
+extern struct rtaff_conf {
+	struct dict_object * avp;	/* the AVP that identifies the session, Session-Id by default */
+} rtaff_conf;
+
+/* The weights of the peers (1 by default), the share of the sessions of a peer is proportional to its weight */
+#define RTAFF_MAX_WEIGHT	100
+int  rtaff_weight_add(char * diamid, int weight);
+unsigned int rtaff_weight_get(DiamId_t diamid, size_t diamidlen);
+void rtaff_weight_fini(void);
+
+/* Choose the peer of the session among the candidates with the best score, the others lose a point.
+ The key is hashed with each candidate identity (weighted rendezvous hashing), the highest hash wins: 
+ when a candidate leaves or joins, only the sessions that it had or gets are mapped differently. */
+int  rtaff_choose(uint8_t * key, size_t keylen, struct fd_list * candidates);
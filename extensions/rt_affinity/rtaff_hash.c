@@ -0,0 +1,191 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+/* The consistent hashing of the sessions over the candidates. */
+
+#include "rt_affinity.h"
+
+/* The weights, ordered by rtaff_idcmp */
+static struct rtaff_weight {
+	DiamId_t	diamid;
+	size_t		diamidlen;
+	unsigned int	weight;
+} * weights = NULL;
+static int weights_nb = 0;
+
+/* Diameter identities are compared case-insensitive */
+static int rtaff_idcmp(DiamId_t id1, size_t id1len, DiamId_t id2, size_t id2len)
+{
+	if (id1len != id2len)
+		return (id1len < id2len) ? -1 : 1;
+	return strncasecmp(id1, id2, id1len);
+}
+
+/* Called while parsing the configuration, before the callback is registered */
+int rtaff_weight_add(char * diamid, int weight)
+{
+	struct rtaff_weight * w;
+	size_t len = strlen(diamid);
+	int i;
+	
+	TRACE_ENTRY("%p %d", diamid, weight);
+	CHECK_PARAMS( (weight >= 0) && (weight <= RTAFF_MAX_WEIGHT) );
+	
+	for (i = 0; i < weights_nb; i++) {
+		int cmp = rtaff_idcmp(diamid, len, weights[i].diamid, weights[i].diamidlen);
+		if (cmp == 0) {
+			TRACE_DEBUG(INFO, "Weight of '%s' was %u, now %d", diamid, weights[i].weight, weight);
+			weights[i].weight = weight;
+			return 0;
+		}
+		if (cmp < 0)
+			break;
+	}
+	
+	CHECK_MALLOC( w = realloc(weights, (weights_nb + 1) * sizeof(struct rtaff_weight)) );
+	weights = w;
+	memmove(&weights[i + 1], &weights[i], (weights_nb - i) * sizeof(struct rtaff_weight));
+	CHECK_MALLOC( weights[i].diamid = strdup(diamid) );
+	weights[i].diamidlen = len;
+	weights[i].weight = weight;
+	weights_nb++;
+	
+	return 0;
+}
+
+unsigned int rtaff_weight_get(DiamId_t diamid, size_t diamidlen)
+{
+	int lo = 0, hi = weights_nb;
+	
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		int cmp = rtaff_idcmp(diamid, diamidlen, weights[mid].diamid, weights[mid].diamidlen);
+		if (cmp == 0)
+			return weights[mid].weight;
+		if (cmp < 0)
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+	
+	return 1;
+}
+
+void rtaff_weight_fini(void)
+{
+	int i;
+	for (i = 0; i < weights_nb; i++)
+		free(weights[i].diamid);
+	free(weights);
+	weights = NULL;
+	weights_nb = 0;
+}
+
+/* Mix the hashes of the key and of the peer (splitmix64 finalizer) */
+static uint64_t rtaff_mix(uint32_t key, uint32_t peer, uint32_t replica)
+{
+	uint64_t x = ((uint64_t)key << 32) ^ peer ^ ((uint64_t)replica << 16);
+	x += 0x9E3779B97F4A7C15ULL;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+}
+
+/* The hash of the key for a candidate. A peer of weight w gets the highest of w hashes: 
+ since the maximum of w uniform values is distributed as u^w, it wins a share w / (total of the weights) of the keys. 
+ A peer of weight 0 only gets the keys when all the candidates have a weight 0. */
+static uint64_t rtaff_hash(uint32_t keyhash, struct rtd_candidate * c)
+{
+	uint32_t peerhash = fd_os_hash((uint8_t *)c->diamid, c->diamidlen);
+	unsigned int w = rtaff_weight_get(c->diamid, c->diamidlen), i;
+	uint64_t h, max = 0;
+	
+	if (w == 0)
+		return rtaff_mix(keyhash, peerhash, 0) >> 1;
+	
+	for (i = 0; i < w; i++) {
+		h = (rtaff_mix(keyhash, peerhash, i) >> 1) | ((uint64_t)1 << 63); /* above the peers of weight 0 */
+		if (h > max)
+			max = h;
+	}
+	return max;
+}
+
+int rtaff_choose(uint8_t * key, size_t keylen, struct fd_list * candidates)
+{
+	struct fd_list * li;
+	struct rtd_candidate * best = NULL;
+	uint32_t keyhash;
+	uint64_t max = 0;
+	int max_score = -1, nb = 0;
+	
+	TRACE_ENTRY("%p %zd %p", key, keylen, candidates);
+	CHECK_PARAMS( key && candidates );
+	
+	/* Only the candidates with the best score are considered */
+	for (li = candidates->next; li != candidates; li = li->next) {
+		struct rtd_candidate * c = (struct rtd_candidate *) li;
+		if (max_score < c->score) {
+			max_score = c->score;
+			nb = 1;
+		} else if (c->score == max_score) {
+			nb++;
+		}
+	}
+	if ((max_score < 0) || (nb < 2))
+		return 0;
+	
+	keyhash = fd_os_hash(key, keylen);
+	for (li = candidates->next; li != candidates; li = li->next) {
+		struct rtd_candidate * c = (struct rtd_candidate *) li;
+		uint64_t h;
+		if (c->score != max_score)
+			continue;
+		h = rtaff_hash(keyhash, c);
+		if (!best || (h > max)) {
+			best = c;
+			max = h;
+		}
+	}
+	
+	for (li = candidates->next; li != candidates; li = li->next) {
+		struct rtd_candidate * c = (struct rtd_candidate *) li;
+		if ((c->score == max_score) && (c != best))
+			c->score--;
+	}
+	TRACE_DEBUG(FULL, "Session '%.*s' mapped to peer '%.*s'", (int)keylen, key, (int)best->diamidlen, best->diamid);
+	
+	return 0;
+}
@@ -77,6 +77,11 @@ static int rtd_entry(char * conffile)
 	/* Register the callback */
 	CHECK_FCT( fd_rt_out_register( rtd_out, NULL, 5, &rtd_hdl ) );
 	
+	/* Its scores can be saved in the routing cache unless some rules use the Origin-Host, Origin-Realm, User-Name or Session-Id */
+	if (rtd_cacheable()) {
+		CHECK_FCT( fd_rt_out_set_cacheable( rtd_hdl ) );
+	}
+	
 	/* We're done */
 	return 0;
 }
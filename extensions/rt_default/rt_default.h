@@ -82,5 +82,8 @@ int rtd_add(enum rtd_crit_type ct, char * criteria, enum rtd_targ_type tt, char
 /* Process a message & peer list through the rules repository, updating the scores */
 int rtd_process( struct msg * msg, struct fd_list * candidates );
 
+/* Check if the rules only depend on the Destination-Host and Destination-Realm of the messages */
+int rtd_cacheable(void);
+
 /* For debug: dump the rule repository */
 void rtd_dump(void);
@@ -389,6 +389,24 @@ int rtd_init(void)
 	return 0;
 }
 
+/* The rules depend only on the values of the routing cache key if they use no other criteria */
+int rtd_cacheable(void)
+{
+	struct fd_list * li;
+	int i;
+	
+	for (i = 0; i < RTD_TAR_MAX; i++) {
+		for (li = TARGETS[i].next; li != &TARGETS[i]; li = li->next) {
+			struct target * trg = (struct target *)li;
+			if (!FD_IS_LIST_EMPTY(&trg->rules[RTD_CRI_OH]) || !FD_IS_LIST_EMPTY(&trg->rules[RTD_CRI_OR])
+			 || !FD_IS_LIST_EMPTY(&trg->rules[RTD_CRI_UN]) || !FD_IS_LIST_EMPTY(&trg->rules[RTD_CRI_SI]))
+				return 0;
+		}
+	}
+	
+	return 1;
+}
+
 /* Destroy the module's data */
 void rtd_fini(void)
 {
@@ -29,16 +29,35 @@
 * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                                                             *
 *********************************************************************************************************/
 
-#include <freeDiameter/extension.h>
+#include "rt_load_balance.h"
 
 /*
  * Load balancing extension. Send request to least-loaded node.
  */
 
+static enum rtlb_policy policy = RTLB_LOG2;
+static __thread unsigned int seed; /* state of rand_r, each routing thread has its own */
+
+/* Read the load of a candidate. The candidates built from the active peers carry the peer object, the others are searched by identity */
+static int rtlb_getload(struct rtd_candidate * cand, struct fd_peer_load * load)
+{
+	struct peer_hdr *peer = cand->peer;
+	
+	if (!peer) {
+		CHECK_FCT(fd_peer_getbyid(cand->diamid, cand->diamidlen, 0, &peer));
+		if (!peer) {
+			/* The peer disappeared meanwhile, it is not loaded */
+			memset(load, 0, sizeof(struct fd_peer_load));
+			return 0;
+		}
+	}
+	CHECK_FCT(fd_peer_get_load(peer, load));
+	return 0;
+}
+
 /* The callback for load balancing the requests across the peers */
 static int rt_load_balancing(void * cbdata, struct msg ** pmsg, struct fd_list * candidates)
 {
-	struct fd_list *lic;
 	struct msg * msg = *pmsg;
 	
 	TRACE_ENTRY("%p %p %p", cbdata, msg, candidates);
@@ -48,30 +67,12 @@ static int rt_load_balancing(void * cbdata, struct msg ** pmsg, struct fd_list *
 	/* Check if it is worth processing the message */
 	if (FD_IS_LIST_EMPTY(candidates))
 		return 0;
+	
+	/* On the first call in this thread, seed with the time and the address of the thread's variable, so that the threads differ */
+	if (!seed)
+		seed = ((unsigned int)time(NULL) ^ (unsigned int)(unsigned long)&seed) ?: 1;
 
-	/* load balancing */
-	for (lic = candidates->next; lic != candidates; lic = lic->next) {
-		struct rtd_candidate * cand = (struct rtd_candidate *) lic;
-		struct peer_hdr *peer;
-		long to_receive, to_send, load;
-		int score;
-		CHECK_FCT(fd_peer_getbyid(cand->diamid, cand->diamidlen, 0, &peer));
-		CHECK_FCT(fd_peer_get_load_pending(peer, &to_receive, &to_send));
-                load = to_receive + to_send;
-		/* other routing mechanisms need to add to the
-		 * appropriate entries so their base value is high
-		 * enough that they are considered */
-
-		/* logarithmic scaling */
-                int load_log = 0;
-                while (load > 0) {
-                    load_log++;
-                    load /= 2;
-                }
-		score = cand->score;
-		cand->score -= load_log;
-		TRACE_DEBUG(FULL, "evaluated peer `%.*s', score was %d, now %d", (int)cand->diamidlen, cand->diamid, score, cand->score);
-	}
+	CHECK_FCT(rtlb_apply(policy, candidates, rtlb_getload, &seed));
 
 	return 0;
 }
@@ -82,10 +83,13 @@ static struct fd_rt_out_hdl * rt_load_balancing_hdl = NULL;
 /* entry point */
 static int rt_load_balance_entry(char * conffile)
 {
+	/* The parameter of the extension is the name of the policy */
+	CHECK_FCT(rtlb_policy_parse(conffile, &policy));
+	
 	/* Register the callback */
-	CHECK_FCT(fd_rt_out_register(rt_load_balancing, NULL, 10, &rt_load_balancing_hdl));
+	CHECK_FCT(fd_rt_out_register(rt_load_balancing, NULL, RTLB_PRIO(policy), &rt_load_balancing_hdl));
 
-	TRACE_DEBUG(INFO, "Extension 'Load Balancing' initialized");
+	TRACE_DEBUG(INFO, "Extension 'Load Balancing' initialized with the '%s' policy", rtlb_policy_name(policy));
 	return 0;
 }
 
@@ -0,0 +1,55 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*                                                                                                        *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.                                                                                   *
+*                                                                                                        *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:                                              *
+*                                                                                                        *
+* * Redistributions of source code must retain the above                                                 *
+*   copyright notice, this list of conditions and the                                                    *
+*   following disclaimer.                                                                                *
+*                                                                                                        *
+* * Redistributions in binary form must reproduce the above                                              *
+*   copyright notice, this list of conditions and the                                                    *
+*   following disclaimer in the documentation and/or other                                               *
+*   materials provided with the distribution.                                                            *
+*                                                                                                        *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT     *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS    *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                                                             *
+*********************************************************************************************************/
+
+/*
+ * Load balancing extension. The balancing policies are implemented in rtlb_policy.c,
+ * separately from the extension glue, so that they can be exercised on simulated peers (see tests/testrtlb.c).
+ */
+
+/* FreeDiameter's common include file */
+#include <freeDiameter/extension.h>
+
+/* The available policies. The policy is selected by the configuration file parameter of the extension, e.g.:
+	LoadExtension = "rt_load_balance.fdx" : "least";  */
+enum rtlb_policy {
+	RTLB_LOG2 = 0,	/* "log2" (default): all candidates are penalized by log2 of their load, at priority 10 */
+	RTLB_LEAST,	/* "least": among the best candidates, the least outstanding requests wins */
+	RTLB_P2C,	/* "p2c": among the best candidates, two are drawn at random, the least loaded of both wins */
+	RTLB_LATENCY	/* "latency": among the best candidates, the lowest average latency x (outstanding + 1) wins */
+};
+
+/* Parse the policy name (NULL means the default) */
+int rtlb_policy_parse(char * str, enum rtlb_policy * policy);
+const char * rtlb_policy_name(enum rtlb_policy policy);
+
+/* Priority of the callback: the log2 penalty is combined with the scores of the other extensions, the other policies choose among the best candidates once all the scores are set */
+#define RTLB_PRIO(_policy) (((_policy) == RTLB_LOG2) ? 10 : 0)
+
+/* Apply the policy to the candidates. getload reads the load of a candidate, seed is used for the random choices. */
+int rtlb_apply(enum rtlb_policy policy, struct fd_list * candidates, int (*getload)(struct rtd_candidate * cand, struct fd_peer_load * load), unsigned int * seed);
@@ -0,0 +1,228 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: Thomas Klausner <tk@giga.or.at>                                                                *
+*                                                                                                        *
+* Copyright (c) 2013, 2014 Thomas Klausner                                                               *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.                                                                                   *
+*                                                                                                        *
+* Written under contract by nfotex IT GmbH, http://nfotex.com/                                           *
+*                                                                                                        *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:                                              *
+*                                                                                                        *
+* * Redistributions of source code must retain the above                                                 *
+*   copyright notice, this list of conditions and the                                                    *
+*   following disclaimer.                                                                                *
+*                                                                                                        *
+* * Redistributions in binary form must reproduce the above                                              *
+*   copyright notice, this list of conditions and the                                                    *
+*   following disclaimer in the documentation and/or other                                               *
+*   materials provided with the distribution.                                                            *
+*                                                                                                        *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT     *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS    *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                                                             *
+*********************************************************************************************************/
+
+/*
+ * The balancing policies of the extension.
+ */
+
+#include "rt_load_balance.h"
+
+static struct {
+	char *			name;
+	enum rtlb_policy	policy;
+} policies[] = {
+	{ "log2",	RTLB_LOG2 },
+	{ "least",	RTLB_LEAST },
+	{ "p2c",	RTLB_P2C },
+	{ "latency",	RTLB_LATENCY }
+};
+
+int rtlb_policy_parse(char * str, enum rtlb_policy * policy)
+{
+	int i;
+	
+	CHECK_PARAMS(policy);
+	
+	if (!str || !*str) {
+		*policy = RTLB_LOG2;
+		return 0;
+	}
+	
+	for (i = 0; i < sizeof(policies) / sizeof(policies[0]); i++) {
+		if (!strcasecmp(str, policies[i].name)) {
+			*policy = policies[i].policy;
+			return 0;
+		}
+	}
+	
+	TRACE_ERROR("Unknown load balancing policy '%s', expected log2, least, p2c or latency", str);
+	return EINVAL;
+}
+
+const char * rtlb_policy_name(enum rtlb_policy policy)
+{
+	int i;
+	
+	for (i = 0; i < sizeof(policies) / sizeof(policies[0]); i++) {
+		if (policies[i].policy == policy)
+			return policies[i].name;
+	}
+	return "unknown";
+}
+
+/* The historical policy: the score of every candidate is decreased by the log2 of its load */
+static int rtlb_log2(struct fd_list * candidates, int (*getload)(struct rtd_candidate * cand, struct fd_peer_load * load))
+{
+	struct fd_list *lic;
+	
+	for (lic = candidates->next; lic != candidates; lic = lic->next) {
+		struct rtd_candidate * cand = (struct rtd_candidate *) lic;
+		struct fd_peer_load pl;
+		long load;
+		int score, load_log = 0;
+		
+		CHECK_FCT( (*getload)(cand, &pl) );
+		load = pl.to_receive + pl.to_send;
+		/* other routing mechanisms need to add to the
+		 * appropriate entries so their base value is high
+		 * enough that they are considered */
+		
+		/* logarithmic scaling */
+		while (load > 0) {
+			load_log++;
+			load /= 2;
+		}
+		score = cand->score;
+		cand->score -= load_log;
+		TRACE_DEBUG(FULL, "evaluated peer `%.*s', score was %d, now %d", (int)cand->diamidlen, cand->diamid, score, cand->score);
+	}
+	
+	return 0;
+}
+
+/* The candidates among which the policies choose */
+struct rtlb_best {
+	struct rtd_candidate *	cand;
+	double			cost;	/* the candidates with the lowest cost win */
+	uint32_t		latency;
+};
+
+/* Apply the policy */
+int rtlb_apply(enum rtlb_policy policy, struct fd_list * candidates, int (*getload)(struct rtd_candidate * cand, struct fd_peer_load * load), unsigned int * seed)
+{
+	struct fd_list *lic;
+	struct rtlb_best l_best[64], * best = l_best;
+	double min;
+	int max_score = -1, nb = 0, i, ret = 0;
+	
+	TRACE_ENTRY("%d %p %p %p", policy, candidates, getload, seed);
+	CHECK_PARAMS(candidates && getload && seed);
+	
+	if (policy == RTLB_LOG2)
+		return rtlb_log2(candidates, getload);
+	
+	/* The other policies only choose among the candidates with the best score */
+	for (lic = candidates->next; lic != candidates; lic = lic->next) {
+		struct rtd_candidate * cand = (struct rtd_candidate *) lic;
+		if (max_score < cand->score) {
+			max_score = cand->score;
+			nb = 1;
+		} else if (cand->score == max_score) {
+			nb++;
+		}
+	}
+	if ((max_score < 0) || (nb < 2))
+		return 0;
+	
+	if (nb > sizeof(l_best) / sizeof(l_best[0])) {
+		CHECK_MALLOC( best = malloc(nb * sizeof(struct rtlb_best)) );
+	}
+	i = 0;
+	for (lic = candidates->next; lic != candidates; lic = lic->next) {
+		struct rtd_candidate * cand = (struct rtd_candidate *) lic;
+		if (cand->score == max_score) {
+			best[i].cand = cand;
+			best[i].cost = 1;
+			best[i].latency = 0;
+			i++;
+		}
+	}
+	
+	switch (policy) {
+		case RTLB_P2C: {
+			/* Only the two drawn candidates are evaluated, the others lose */
+			int a = rand_r(seed) % nb, b = rand_r(seed) % (nb - 1);
+			struct fd_peer_load pla, plb;
+			if (b >= a)
+				b++;
+			CHECK_FCT_DO( ret = (*getload)(best[a].cand, &pla), goto out );
+			CHECK_FCT_DO( ret = (*getload)(best[b].cand, &plb), goto out );
+			if (pla.to_receive + pla.to_send <= plb.to_receive + plb.to_send)
+				best[a].cost = 0;
+			else
+				best[b].cost = 0;
+			break;
+		}
+		
+		case RTLB_LEAST:
+			for (i = 0; i < nb; i++) {
+				struct fd_peer_load pl;
+				CHECK_FCT_DO( ret = (*getload)(best[i].cand, &pl), goto out );
+				best[i].cost = pl.to_receive + pl.to_send;
+			}
+			break;
+		
+		case RTLB_LATENCY: {
+			/* The peers that did not answer yet count with the average latency of the others */
+			double sum = 0;
+			int known = 0;
+			for (i = 0; i < nb; i++) {
+				struct fd_peer_load pl;
+				CHECK_FCT_DO( ret = (*getload)(best[i].cand, &pl), goto out );
+				best[i].cost = pl.to_receive + pl.to_send + 1;
+				best[i].latency = pl.latency;
+				if (pl.latency) {
+					sum += pl.latency;
+					known++;
+				}
+			}
+			for (i = 0; i < nb; i++) {
+				if (best[i].latency)
+					best[i].cost *= best[i].latency;
+				else if (known)
+					best[i].cost *= sum / known;
+			}
+			break;
+		}
+		
+		default:
+			ASSERT(0);
+	}
+	
+	/* The candidates that cost more than the cheapest one lose a point; fd_rtd_candidate_reorder chooses randomly among the remaining ones */
+	min = best[0].cost;
+	for (i = 1; i < nb; i++) {
+		if (best[i].cost < min)
+			min = best[i].cost;
+	}
+	for (i = 0; i < nb; i++) {
+		if (best[i].cost > min) {
+			best[i].cand->score--;
+			TRACE_DEBUG(FULL, "peer `%.*s' not chosen by the '%s' policy, score is now %d", (int)best[i].cand->diamidlen, best[i].cand->diamid, rtlb_policy_name(policy), best[i].cand->score);
+		}
+	}
+	
+out:
+	if (best != l_best)
+		free(best);
+	return ret;
+}
@@ -90,17 +90,85 @@ static int my_sem_post(my_sem_t *s) {
 
 
 
+/* Latency histogram: exact buckets below TA_HIST_LINEAR us, then TA_HIST_SUB buckets per power of 2 (~3% precision) */
+#define TA_HIST_LINEAR	64
+#define TA_HIST_SUB	32
+#define TA_HIST_EXP	36	/* up to 2^36 us */
+#define TA_HIST_BUCKETS	(TA_HIST_LINEAR + (TA_HIST_EXP - 6) * TA_HIST_SUB)
+
+/* Statistics of one generator thread. The answer callbacks run in the dispatch threads, hence the lock. */
+struct ta_bench_thr {
+	pthread_t		thr;
+	int			idx;
+	pthread_mutex_t		lock;
+	unsigned long long	nb_sent;
+	unsigned long long	nb_recv;
+	unsigned long long	nb_errs;
+	unsigned long long	sum;	  /* sum of the answer times, in microseconds */
+	unsigned long		shortest;
+	unsigned long		longest;
+	unsigned long long	hist[TA_HIST_BUCKETS];
+};
+
 struct ta_mess_info {
 	int32_t		randval;	/* a random value to store in Test-AVP */
-	struct timespec ts;		/* Time of sending the message */
+	struct timespec ts;		/* Time of sending the message (scheduled time in open loop) */
+	struct ta_bench_thr * thr;	/* The generator which sent the message */
 };
 
 static my_sem_t ta_sem; /* To handle the concurrency */
 
+static struct ta_bench_thr * ta_thrs = NULL; /* ta_conf->bench_threads items */
+static struct timespec ta_bench_end; /* When the generators stop sending */
+static struct fd_msg_tmpl * ta_tmpl = NULL; /* The test messages */
+
+static int ta_hist_idx(unsigned long dur)
+{
+	int e = 6;
+	
+	if (dur < TA_HIST_LINEAR)
+		return dur;
+	while ((e < TA_HIST_EXP - 1) && (dur >> (e + 1)))
+		e++;
+	if (dur >> (e + 1))
+		return TA_HIST_BUCKETS - 1;
+	return TA_HIST_LINEAR + (e - 6) * TA_HIST_SUB + ((dur >> (e - 5)) & (TA_HIST_SUB - 1));
+}
+
+/* Middle of the range of values counted in a bucket */
+static unsigned long ta_hist_val(int idx)
+{
+	int e, sub;
+	if (idx < TA_HIST_LINEAR)
+		return idx;
+	e = (idx - TA_HIST_LINEAR) / TA_HIST_SUB + 6;
+	sub = (idx - TA_HIST_LINEAR) % TA_HIST_SUB;
+	return (1UL << e) + ((unsigned long)sub << (e - 5)) + (1UL << (e - 6));
+}
+
+static unsigned long ta_hist_percentile(unsigned long long * hist, unsigned long long count, double pct)
+{
+	unsigned long long rank, cum = 0;
+	int i;
+	
+	if (!count)
+		return 0;
+	rank = (unsigned long long)(count * pct / 100.0);
+	if (rank >= count)
+		rank = count - 1;
+	for (i = 0; i < TA_HIST_BUCKETS; i++) {
+		cum += hist[i];
+		if (cum > rank)
+			return ta_hist_val(i);
+	}
+	return ta_hist_val(TA_HIST_BUCKETS - 1);
+}
+
 /* Cb called when an answer is received */
 static void ta_cb_ans(void * data, struct msg ** msg)
 {
 	struct ta_mess_info * mi = (struct ta_mess_info *)data;
+	struct ta_bench_thr * t = mi->thr;
 	struct timespec ts;
 	struct avp * avp;
 	struct avp_hdr * hdr;
@@ -115,9 +183,9 @@ static void ta_cb_ans(void * data, struct msg ** msg)
 	}
 	if (!avp || !hdr || hdr->avp_value->i32 != 2001) {
 		/* error */
-		CHECK_POSIX_DO( pthread_mutex_lock(&ta_conf->stats_lock), );
-		ta_conf->stats.nb_errs++;
-		CHECK_POSIX_DO( pthread_mutex_unlock(&ta_conf->stats_lock), );
+		CHECK_POSIX_DO( pthread_mutex_lock(&t->lock), );
+		t->nb_errs++;
+		CHECK_POSIX_DO( pthread_mutex_unlock(&t->lock), );
 		goto end;
 	}
 	
@@ -131,25 +199,23 @@ static void ta_cb_ans(void * data, struct msg ** msg)
 	/* Compute how long it took */
 	dur = ((ts.tv_sec - mi->ts.tv_sec) * 1000000) + ((ts.tv_nsec - mi->ts.tv_nsec) / 1000);
 	
-	/* Add this value to the stats */
-	CHECK_POSIX_DO( pthread_mutex_lock(&ta_conf->stats_lock), );
+	/* Add this value to the stats of the generator */
+	CHECK_POSIX_DO( pthread_mutex_lock(&t->lock), );
 	
-	if (ta_conf->stats.nb_recv) {
-		/* Ponderate in the avg */
-		ta_conf->stats.avg = (ta_conf->stats.avg * ta_conf->stats.nb_recv + dur) / (ta_conf->stats.nb_recv + 1);
-		/* Min, max */
-		if (dur < ta_conf->stats.shortest)
-			ta_conf->stats.shortest = dur;
-		if (dur > ta_conf->stats.longest)
-			ta_conf->stats.longest = dur;
+	if (t->nb_recv) {
+		if (dur < t->shortest)
+			t->shortest = dur;
+		if (dur > t->longest)
+			t->longest = dur;
 	} else {
-		ta_conf->stats.shortest = dur;
-		ta_conf->stats.longest = dur;
-		ta_conf->stats.avg = dur;
+		t->shortest = dur;
+		t->longest = dur;
 	}
-	ta_conf->stats.nb_recv++;
+	t->sum += dur;
+	t->hist[ta_hist_idx(dur)]++;
+	t->nb_recv++;
 	
-	CHECK_POSIX_DO( pthread_mutex_unlock(&ta_conf->stats_lock), );
+	CHECK_POSIX_DO( pthread_mutex_unlock(&t->lock), );
 	
 end:	
 	/* Free the message */
@@ -164,106 +230,164 @@ end:
 	return;
 }
 
-/* Create a test message */
-static void ta_bench_test_message()
+/* Build the template of the test messages; only the Session-Id and Test-AVP values change from one request to the other */
+#define TEST_APP_SID_OPT  "app_testb"
+static int ta_bench_tmpl_new(void)
 {
 	struct msg * req = NULL;
 	struct avp * avp;
+	struct avp * fields[2];
 	union avp_value val;
-	struct ta_mess_info * mi = NULL;
-	
-	TRACE_DEBUG(FULL, "Creating a new message for sending.");
 	
 	/* Create the request */
-	CHECK_FCT_DO( fd_msg_new( ta_cmd_r, MSGFL_ALLOC_ETEID, &req ), goto out );
+	CHECK_FCT( fd_msg_new( ta_cmd_r, 0, &req ) );
 	
-	/* Create a new session */
-	#define TEST_APP_SID_OPT  "app_testb"
-	CHECK_FCT_DO( fd_msg_new_session( req, (os0_t)TEST_APP_SID_OPT, CONSTSTRLEN(TEST_APP_SID_OPT) ), goto out );
-	
-	/* Create the random value to store with the session */
-	mi = malloc(sizeof(struct ta_mess_info));
-	if (mi == NULL) {
-		fd_log_debug("malloc failed: %s", strerror(errno));
-		goto out;
+	/* The Session-Id, its value is set for each instance */
+	{
+		CHECK_FCT( fd_msg_avp_new ( ta_sess_id, 0, &avp ) );
+		val.os.data = (unsigned char *)TEST_APP_SID_OPT;
+		val.os.len  = CONSTSTRLEN(TEST_APP_SID_OPT);
+		CHECK_FCT( fd_msg_avp_setvalue( avp, &val ) );
+		CHECK_FCT( fd_msg_avp_add( req, MSG_BRW_FIRST_CHILD, avp ) );
+		fields[0] = avp;
 	}
 	
-	mi->randval = (int32_t)random();
-	
-	/* Now set all AVPs values */
-	
 	/* Set the Destination-Realm AVP */
 	{
-		CHECK_FCT_DO( fd_msg_avp_new ( ta_dest_realm, 0, &avp ), goto out  );
+		CHECK_FCT( fd_msg_avp_new ( ta_dest_realm, 0, &avp ) );
 		val.os.data = (unsigned char *)(ta_conf->dest_realm);
 		val.os.len  = strlen(ta_conf->dest_realm);
-		CHECK_FCT_DO( fd_msg_avp_setvalue( avp, &val ), goto out  );
-		CHECK_FCT_DO( fd_msg_avp_add( req, MSG_BRW_LAST_CHILD, avp ), goto out  );
+		CHECK_FCT( fd_msg_avp_setvalue( avp, &val ) );
+		CHECK_FCT( fd_msg_avp_add( req, MSG_BRW_LAST_CHILD, avp ) );
 	}
 	
 	/* Set the Destination-Host AVP if needed*/
 	if (ta_conf->dest_host) {
-		CHECK_FCT_DO( fd_msg_avp_new ( ta_dest_host, 0, &avp ), goto out  );
+		CHECK_FCT( fd_msg_avp_new ( ta_dest_host, 0, &avp ) );
 		val.os.data = (unsigned char *)(ta_conf->dest_host);
 		val.os.len  = strlen(ta_conf->dest_host);
-		CHECK_FCT_DO( fd_msg_avp_setvalue( avp, &val ), goto out  );
-		CHECK_FCT_DO( fd_msg_avp_add( req, MSG_BRW_LAST_CHILD, avp ), goto out  );
+		CHECK_FCT( fd_msg_avp_setvalue( avp, &val ) );
+		CHECK_FCT( fd_msg_avp_add( req, MSG_BRW_LAST_CHILD, avp ) );
 	}
 	
 	/* Set Origin-Host & Origin-Realm */
-	CHECK_FCT_DO( fd_msg_add_origin ( req, 0 ), goto out  );
+	CHECK_FCT( fd_msg_add_origin ( req, 0 ) );
 	
 	/* Set the User-Name AVP if needed*/
 	if (ta_conf->user_name) {
-		CHECK_FCT_DO( fd_msg_avp_new ( ta_user_name, 0, &avp ), goto out  );
+		CHECK_FCT( fd_msg_avp_new ( ta_user_name, 0, &avp ) );
 		val.os.data = (unsigned char *)(ta_conf->user_name);
 		val.os.len  = strlen(ta_conf->user_name);
-		CHECK_FCT_DO( fd_msg_avp_setvalue( avp, &val ), goto out  );
-		CHECK_FCT_DO( fd_msg_avp_add( req, MSG_BRW_LAST_CHILD, avp ), goto out  );
+		CHECK_FCT( fd_msg_avp_setvalue( avp, &val ) );
+		CHECK_FCT( fd_msg_avp_add( req, MSG_BRW_LAST_CHILD, avp ) );
 	}
 	
-	/* Set the Test-AVP AVP */
+	/* Set the Test-AVP AVP, its value is set for each instance */
 	{
-		CHECK_FCT_DO( fd_msg_avp_new ( ta_avp, 0, &avp ), goto out  );
-		val.i32 = mi->randval;
-		CHECK_FCT_DO( fd_msg_avp_setvalue( avp, &val ), goto out  );
-		CHECK_FCT_DO( fd_msg_avp_add( req, MSG_BRW_LAST_CHILD, avp ), goto out  );
+		CHECK_FCT( fd_msg_avp_new ( ta_avp, 0, &avp ) );
+		val.i32 = 0;
+		CHECK_FCT( fd_msg_avp_setvalue( avp, &val ) );
+		CHECK_FCT( fd_msg_avp_add( req, MSG_BRW_LAST_CHILD, avp ) );
+		fields[1] = avp;
 	}
 	
-	CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &mi->ts), goto out );
+	CHECK_FCT( fd_msg_tmpl_new( req, fields, 2, &ta_tmpl ) );
+	CHECK_FCT( fd_msg_free( req ) );
+	
+	return 0;
+}
+
+/* Create a test message */
+static void ta_bench_test_message(struct ta_bench_thr * t, struct timespec * sched)
+{
+	struct msg * req = NULL;
+	struct session * sess = NULL;
+	union avp_value val_sid, val_avp;
+	union avp_value * values[2] = { &val_sid, &val_avp };
+	struct ta_mess_info * mi = NULL;
+	
+	TRACE_DEBUG(FULL, "Creating a new message for sending.");
+	
+	/* Create a new session */
+	CHECK_FCT_DO( fd_sess_new( &sess, fd_g_config->cnf_diamid, fd_g_config->cnf_diamid_len, (os0_t)TEST_APP_SID_OPT, CONSTSTRLEN(TEST_APP_SID_OPT) ), goto out );
+	CHECK_FCT_DO( fd_sess_getsid( sess, &val_sid.os.data, &val_sid.os.len ), goto out );
+	
+	/* Create the random value to store with the session */
+	mi = malloc(sizeof(struct ta_mess_info));
+	if (mi == NULL) {
+		fd_log_debug("malloc failed: %s", strerror(errno));
+		goto out;
+	}
+	
+	mi->randval = (int32_t)random();
+	mi->thr = t;
+	val_avp.i32 = mi->randval;
+	
+	/* Create the request from the template, and save the session in it */
+	CHECK_FCT_DO( fd_msg_tmpl_instance( ta_tmpl, values, MSGFL_ALLOC_ETEID, &req ), goto out );
+	CHECK_FCT_DO( fd_msg_sess_set( req, sess ), goto out );
+	
+	if (sched) {
+		/* Open loop: measure from the scheduled time, so that the queueing delay is accounted */
+		memcpy(&mi->ts, sched, sizeof(struct timespec));
+	} else {
+		CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &mi->ts), goto out );
+	}
 	
 	/* Send the request */
 	CHECK_FCT_DO( fd_msg_send( &req, ta_cb_ans, mi ), goto out );
 	
 	/* Increment the counter */
-	CHECK_POSIX_DO( pthread_mutex_lock(&ta_conf->stats_lock), );
-	ta_conf->stats.nb_sent++;
-	CHECK_POSIX_DO( pthread_mutex_unlock(&ta_conf->stats_lock), );
+	CHECK_POSIX_DO( pthread_mutex_lock(&t->lock), );
+	t->nb_sent++;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&t->lock), );
 
 out:
 	return;
 }
 
-/* The function called when the signal is received */
-static void ta_bench_start() {
-	struct timespec end_time, now;
-	struct ta_stats start, end;
-	int nsec = 0;
+/* A generator thread: closed loop (bench_concur messages in flight) or open loop (bench_rate messages per second) */
+static void * ta_bench_gen(void * arg)
+{
+	struct ta_bench_thr * t = arg;
+	struct timespec next, now;
+	long long interval = 0; /* nanoseconds between two requests of this thread, in open loop */
+	char buf[32];
 	
-	/* Save the initial stats */
-	CHECK_POSIX_DO( pthread_mutex_lock(&ta_conf->stats_lock), );
-	memcpy(&start, &ta_conf->stats, sizeof(struct ta_stats));
-	CHECK_POSIX_DO( pthread_mutex_unlock(&ta_conf->stats_lock), );
+	snprintf(buf, sizeof(buf), "Bench generator %d", t->idx);
+	fd_log_threadname ( buf );
 	
-	/* We will run for ta_conf->bench_duration seconds */
-	LOG_N("Starting benchmark client, %ds", ta_conf->bench_duration);
-	CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &end_time), );
-	end_time.tv_sec += ta_conf->bench_duration;
+	if (ta_conf->bench_rate > 0)
+		interval = 1000000000LL * ta_conf->bench_threads / ta_conf->bench_rate;
+	
+	CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &next), return NULL );
 	
 	/* Now loop until timeout is reached */
 	do {
-		/* Do not create more that NB_CONCURRENT_MESSAGES in paralel */
-		int ret = my_sem_timedwait(&ta_sem, &end_time);
+		int ret;
+		
+		if (interval) {
+			/* Wait for the scheduled time of the next request */
+			next.tv_nsec += interval % 1000000000LL;
+			next.tv_sec  += interval / 1000000000LL + next.tv_nsec / 1000000000;
+			next.tv_nsec %= 1000000000;
+			if (!TS_IS_INFERIOR(&next, &ta_bench_end))
+				break;
+			CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &now), );
+			if (TS_IS_INFERIOR(&now, &next)) {
+				struct timespec delay;
+				delay.tv_sec  = next.tv_sec - now.tv_sec;
+				delay.tv_nsec = next.tv_nsec - now.tv_nsec;
+				if (delay.tv_nsec < 0) {
+					delay.tv_sec--;
+					delay.tv_nsec += 1000000000;
+				}
+				nanosleep(&delay, NULL);
+			}
+		}
+		
+		/* Do not create more that bench_concur messages in parallel */
+		ret = my_sem_timedwait(&ta_sem, &ta_bench_end);
 		if (ret == -1) {
 			ret = errno;
 			if (ret != ETIMEDOUT) {
@@ -275,51 +399,193 @@ static void ta_bench_start() {
 		/* Update the current time */
 		CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &now), );
 		
-		if (!TS_IS_INFERIOR(&now, &end_time))
+		if (!TS_IS_INFERIOR(&now, &ta_bench_end)) {
+			CHECK_SYS_DO( my_sem_post(&ta_sem), );
 			break;
+		}
 		
 		/* Create and send a new test message */
-		ta_bench_test_message();
+		ta_bench_test_message(t, interval ? &next : NULL);
 	} while (1);
 	
+	return NULL;
+}
+
+/* Sum the statistics of all generators */
+static void ta_bench_collect(struct ta_bench_thr * total)
+{
+	int i, j;
+	
+	memset(total, 0, sizeof(struct ta_bench_thr));
+	for (i = 0; i < ta_conf->bench_threads; i++) {
+		struct ta_bench_thr * t = &ta_thrs[i];
+		CHECK_POSIX_DO( pthread_mutex_lock(&t->lock), );
+		if (t->nb_recv) {
+			if (!total->nb_recv || (t->shortest < total->shortest))
+				total->shortest = t->shortest;
+			if (t->longest > total->longest)
+				total->longest = t->longest;
+		}
+		total->nb_sent += t->nb_sent;
+		total->nb_recv += t->nb_recv;
+		total->nb_errs += t->nb_errs;
+		total->sum     += t->sum;
+		for (j = 0; j < TA_HIST_BUCKETS; j++)
+			total->hist[j] += t->hist[j];
+		CHECK_POSIX_DO( pthread_mutex_unlock(&t->lock), );
+	}
+}
+
+/* Append the results to the bench_output file, as a JSON object or a CSV record on a single line */
+static void ta_bench_output(struct ta_bench_thr * total, double elapsed, double throughput, unsigned long p50, unsigned long p99, unsigned long p999)
+{
+	FILE * f;
+	time_t now = time(NULL);
+	unsigned long avg = total->nb_recv ? total->sum / total->nb_recv : 0;
+	
+	f = fopen(ta_conf->bench_output, "a");
+	if (!f) {
+		LOG_E("Unable to open benchmark output file '%s': %s", ta_conf->bench_output, strerror(errno));
+		return;
+	}
+	
+	if (ta_conf->bench_format == TA_BENCH_FMT_CSV) {
+		if (ftell(f) == 0)
+			fprintf(f, "timestamp,threads,rate,window,duration,sent,answers,errors,pending,throughput,min_us,avg_us,p50_us,p99_us,p999_us,max_us\n");
+		fprintf(f, "%ld,%d,%d,%d,%.6f,%llu,%llu,%llu,%llu,%.1f,%lu,%lu,%lu,%lu,%lu,%lu\n",
+			(long)now, ta_conf->bench_threads, ta_conf->bench_rate, ta_conf->bench_concur, elapsed,
+			total->nb_sent, total->nb_recv, total->nb_errs, total->nb_sent - total->nb_recv - total->nb_errs, throughput,
+			total->shortest, avg, p50, p99, p999, total->longest);
+	} else {
+		fprintf(f, "{\"timestamp\":%ld,\"threads\":%d,\"rate\":%d,\"window\":%d,\"duration\":%.6f,"
+			   "\"sent\":%llu,\"answers\":%llu,\"errors\":%llu,\"pending\":%llu,\"throughput\":%.1f,"
+			   "\"latency_us\":{\"min\":%lu,\"avg\":%lu,\"p50\":%lu,\"p99\":%lu,\"p999\":%lu,\"max\":%lu}}\n",
+			(long)now, ta_conf->bench_threads, ta_conf->bench_rate, ta_conf->bench_concur, elapsed,
+			total->nb_sent, total->nb_recv, total->nb_errs, total->nb_sent - total->nb_recv - total->nb_errs, throughput,
+			total->shortest, avg, p50, p99, p999, total->longest);
+	}
+	
+	fclose(f);
+}
+
+/* The function called when the signal is received */
+static void ta_bench_start() {
+	struct timespec start_time, now;
+	struct ta_bench_thr total;
+	double elapsed, throughput;
+	unsigned long p50, p99, p999;
+	int i, nsec = 0;
+	
+	/* Reset the statistics of the generators */
+	for (i = 0; i < ta_conf->bench_threads; i++) {
+		struct ta_bench_thr * t = &ta_thrs[i];
+		CHECK_POSIX_DO( pthread_mutex_lock(&t->lock), );
+		t->nb_sent = t->nb_recv = t->nb_errs = t->sum = 0;
+		t->shortest = t->longest = 0;
+		memset(t->hist, 0, sizeof(t->hist));
+		CHECK_POSIX_DO( pthread_mutex_unlock(&t->lock), );
+	}
+	
+	/* We will run for ta_conf->bench_duration seconds */
+	if (ta_conf->bench_rate > 0) {
+		LOG_N("Starting benchmark client, %ds, %d thread(s), open loop at %d msg/s", ta_conf->bench_duration, ta_conf->bench_threads, ta_conf->bench_rate);
+	} else {
+		LOG_N("Starting benchmark client, %ds, %d thread(s), closed loop with %d messages in flight", ta_conf->bench_duration, ta_conf->bench_threads, ta_conf->bench_concur);
+	}
+	CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &start_time), );
+	memcpy(&ta_bench_end, &start_time, sizeof(struct timespec));
+	ta_bench_end.tv_sec += ta_conf->bench_duration;
+	
+	/* Start the generators and wait for them to complete */
+	for (i = 0; i < ta_conf->bench_threads; i++) {
+		CHECK_POSIX_DO( pthread_create(&ta_thrs[i].thr, NULL, ta_bench_gen, &ta_thrs[i]), break );
+	}
+	while (i-- > 0) {
+		CHECK_POSIX_DO( pthread_join(ta_thrs[i].thr, NULL), );
+	}
+	
+	/* Wait for the pending answers, at most bench_duration seconds */
 	do {
-		CHECK_POSIX_DO( pthread_mutex_lock(&ta_conf->stats_lock), );
-		CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &now), ); /* Re-read the time because we might have spent some time wiating for the mutex */
-		memcpy(&end, &ta_conf->stats, sizeof(struct ta_stats));
-		CHECK_POSIX_DO( pthread_mutex_unlock(&ta_conf->stats_lock), );
+		ta_bench_collect(&total);
+		CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &now), );
 		
-		/* Now, display the statistics */
-		LOG_N( "------- app_test Benchmark results, end sending +%ds ---------", nsec);
-		if (now.tv_nsec >= end_time.tv_nsec) {
-			LOG_N( " Executing for: %d.%06ld sec",
-					(int)(now.tv_sec + ta_conf->bench_duration - end_time.tv_sec),
-					(long)(now.tv_nsec - end_time.tv_nsec) / 1000);
-		} else {
-			LOG_N( " Executing for: %d.%06ld sec",
-					(int)(now.tv_sec + ta_conf->bench_duration - 1 - end_time.tv_sec),
-					(long)(now.tv_nsec + 1000000000 - end_time.tv_nsec) / 1000);
-		}
-		LOG_N( "   %llu messages sent", end.nb_sent - start.nb_sent);
-		LOG_N( "   %llu error(s) received", end.nb_errs - start.nb_errs);
-		LOG_N( "   %llu answer(s) received", end.nb_recv - start.nb_recv);
-		LOG_N( "   Overall:");
-		LOG_N( "     fastest: %ld.%06ld sec.", end.shortest / 1000000, end.shortest % 1000000);
-		LOG_N( "     slowest: %ld.%06ld sec.", end.longest / 1000000, end.longest % 1000000);
-		LOG_N( "     Average: %ld.%06ld sec.", end.avg / 1000000, end.avg % 1000000);
-		LOG_N( "   Throughput: %llu messages / sec", (end.nb_recv - start.nb_recv) / (( now.tv_sec + ta_conf->bench_duration - end_time.tv_sec ) + ((now.tv_nsec - end_time.tv_nsec) / 1000000000)));
-		LOG_N( "-------------------------------------");
+		LOG_N( "------- app_test Benchmark, end sending +%ds: %llu sent, %llu answer(s), %llu error(s) ---------",
+				nsec, total.nb_sent, total.nb_recv, total.nb_errs);
+		
+		if (total.nb_sent <= total.nb_errs + total.nb_recv)
+			break;
 		
 		nsec ++;
 		sleep(1);
-	} while ( (end.nb_sent - start.nb_sent) > (end.nb_errs - start.nb_errs) + (end.nb_recv - start.nb_recv) );
+	} while ( nsec <= ta_conf->bench_duration );
+	
+	/* Now, display the statistics */
+	elapsed = (now.tv_sec - start_time.tv_sec) + (now.tv_nsec - start_time.tv_nsec) / 1000000000.0;
+	throughput = elapsed > 0 ? total.nb_recv / elapsed : 0;
+	p50  = ta_hist_percentile(total.hist, total.nb_recv, 50.0);
+	p99  = ta_hist_percentile(total.hist, total.nb_recv, 99.0);
+	p999 = ta_hist_percentile(total.hist, total.nb_recv, 99.9);
+	
+	LOG_N( "------- app_test Benchmark results ---------");
+	LOG_N( " Executing for: %.6f sec", elapsed);
+	LOG_N( "   %llu messages sent", total.nb_sent);
+	LOG_N( "   %llu error(s) received", total.nb_errs);
+	LOG_N( "   %llu answer(s) received", total.nb_recv);
+	LOG_N( "   %llu answer(s) missing", total.nb_sent - total.nb_errs - total.nb_recv);
+	LOG_N( "   Overall:");
+	LOG_N( "     fastest: %ld.%06ld sec.", total.shortest / 1000000, total.shortest % 1000000);
+	LOG_N( "     slowest: %ld.%06ld sec.", total.longest / 1000000, total.longest % 1000000);
+	if (total.nb_recv) {
+		LOG_N( "     Average: %ld.%06ld sec.", (unsigned long)(total.sum / total.nb_recv) / 1000000, (unsigned long)(total.sum / total.nb_recv) % 1000000);
+	}
+	LOG_N( "     p50:     %ld.%06ld sec.", p50 / 1000000, p50 % 1000000);
+	LOG_N( "     p99:     %ld.%06ld sec.", p99 / 1000000, p99 % 1000000);
+	LOG_N( "     p99.9:   %ld.%06ld sec.", p999 / 1000000, p999 % 1000000);
+	LOG_N( "   Throughput: %.1f messages / sec", throughput);
 	LOG_N( "--------------- Test Complete --------------");
-
+	
+	if (ta_conf->bench_output)
+		ta_bench_output(&total, elapsed, throughput, p50, p99, p999);
+	
+	/* Report also in the global statistics displayed periodically */
+	CHECK_POSIX_DO( pthread_mutex_lock(&ta_conf->stats_lock), );
+	if (total.nb_recv) {
+		unsigned long avg = total.sum / total.nb_recv;
+		if (ta_conf->stats.nb_recv) {
+			ta_conf->stats.avg = (ta_conf->stats.avg * ta_conf->stats.nb_recv + avg * total.nb_recv) / (ta_conf->stats.nb_recv + total.nb_recv);
+			if (total.shortest < ta_conf->stats.shortest)
+				ta_conf->stats.shortest = total.shortest;
+			if (total.longest > ta_conf->stats.longest)
+				ta_conf->stats.longest = total.longest;
+		} else {
+			ta_conf->stats.shortest = total.shortest;
+			ta_conf->stats.longest = total.longest;
+			ta_conf->stats.avg = avg;
+		}
+	}
+	ta_conf->stats.nb_sent += total.nb_sent;
+	ta_conf->stats.nb_recv += total.nb_recv;
+	ta_conf->stats.nb_errs += total.nb_errs;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&ta_conf->stats_lock), );
 }
 
 
 int ta_bench_init(void)
 {
+	int i;
+	
+	if (ta_conf->bench_threads < 1)
+		ta_conf->bench_threads = 1;
+	
+	CHECK_MALLOC( ta_thrs = calloc(ta_conf->bench_threads, sizeof(struct ta_bench_thr)) );
+	for (i = 0; i < ta_conf->bench_threads; i++) {
+		ta_thrs[i].idx = i;
+		CHECK_POSIX( pthread_mutex_init(&ta_thrs[i].lock, NULL) );
+	}
+	
 	CHECK_SYS( my_sem_init( &ta_sem, 0, ta_conf->bench_concur) );
+	
+	CHECK_FCT( ta_bench_tmpl_new() );
 
 	CHECK_FCT( fd_event_trig_regcb(ta_conf->signal, "test_app.bench", ta_bench_start ) );
 	
@@ -328,9 +594,24 @@ int ta_bench_init(void)
 
 void ta_bench_fini(void)
 {
+	int i;
+	
 	// CHECK_FCT_DO( fd_sig_unregister(ta_conf->signal), /* continue */ );
 	
 	CHECK_SYS_DO( my_sem_destroy(&ta_sem), );
 	
+	if (ta_tmpl) {
+		CHECK_FCT_DO( fd_msg_tmpl_free(ta_tmpl), );
+		ta_tmpl = NULL;
+	}
+	
+	if (ta_thrs) {
+		for (i = 0; i < ta_conf->bench_threads; i++) {
+			CHECK_POSIX_DO( pthread_mutex_destroy(&ta_thrs[i].lock), );
+		}
+		free(ta_thrs);
+		ta_thrs = NULL;
+	}
+	
 	return;
 };
@@ -128,6 +128,10 @@ void yyerror (YYLTYPE *ploc, char * conffile, char const *s)
 %token 		USER_NAME
 %token 		SIGNAL
 %token		BENCH
+%token		BENCH_THREADS
+%token		BENCH_RATE
+%token		BENCH_OUTPUT
+%token		BENCH_FORMAT
 
 /* Tokens and types for routing table definition */
 /* A (de)quoted string (malloc'd in lex parser; it must be freed after use) */
@@ -155,6 +159,10 @@ conffile:		/* empty grammar is OK */
 			| conffile usrname
 			| conffile signal
 			| conffile bench
+			| conffile bench_threads
+			| conffile bench_rate
+			| conffile bench_output
+			| conffile bench_format
 			;
 
 vendor:			VENDOR_ID '=' INTEGER ';'
@@ -211,6 +219,31 @@ bench:			BENCH ';'
 			}
 			;
 
+bench_threads:		BENCH_THREADS '=' INTEGER ';'
+			{
+				ta_conf->bench_threads = $3;
+			}
+			;
+
+bench_rate:		BENCH_RATE '=' INTEGER ';'
+			{
+				ta_conf->bench_rate = $3;
+			}
+			;
+
+bench_output:		BENCH_OUTPUT '=' QSTRING ';'
+			{
+				free(ta_conf->bench_output);
+				ta_conf->bench_output = $3;
+			}
+			;
+
+bench_format:		BENCH_FORMAT '=' INTEGER ';'
+			{
+				ta_conf->bench_format = $3;
+			}
+			;
+
 dstrealm:		DEST_REALM '=' QSTRING ';'
 			{
 				free(ta_conf->dest_realm);
@@ -61,6 +61,9 @@ static int ta_conf_init(void)
 	ta_conf->signal     = TEST_APP_DEFAULT_SIGNAL;
 	ta_conf->bench_concur   = 100;
 	ta_conf->bench_duration = 10;
+	ta_conf->bench_threads  = 1;
+	ta_conf->bench_rate     = 0;
+	ta_conf->bench_format   = TA_BENCH_FMT_JSON;
 	
 	/* Initialize the mutex */
 	CHECK_POSIX( pthread_mutex_init(&ta_conf->stats_lock, NULL) );
@@ -83,6 +86,14 @@ static void ta_conf_dump(void)
 	fd_log_debug( " Destination Realm .. : %s", ta_conf->dest_realm ?: "- none -");
 	fd_log_debug( " Destination Host ... : %s", ta_conf->dest_host ?: "- none -");
 	fd_log_debug( " Signal ............. : %i", ta_conf->signal);
+	if (ta_conf->mode & MODE_BENCH) {
+		fd_log_debug( " Bench threads ...... : %d", ta_conf->bench_threads);
+		if (ta_conf->bench_rate > 0)
+			fd_log_debug( " Bench rate ......... : %d msg/s (open loop)", ta_conf->bench_rate);
+		else
+			fd_log_debug( " Bench rate ......... : closed loop");
+		fd_log_debug( " Bench output ....... : %s (%s)", ta_conf->bench_output ?: "- none -", ta_conf->bench_format == TA_BENCH_FMT_CSV ? "CSV" : "JSON");
+	}
 	fd_log_debug( "------- /app_test configuration dump ---------");
 }
 
@@ -208,8 +219,12 @@ static int ta_entry(char * conffile)
 /* Unload */
 void fd_ext_fini(void)
 {
-	if (ta_conf->mode & MODE_CLI)
-		ta_cli_fini();
+	if (ta_conf->mode & MODE_CLI) {
+		if (ta_conf->mode & MODE_BENCH)
+			ta_bench_fini();
+		else
+			ta_cli_fini();
+	}
 	if (ta_conf->mode & MODE_SERV)
 		ta_serv_fini();
 	if (hookhdl[0])
@@ -53,6 +53,10 @@
 #define	MODE_CLI	0x2
 #define	MODE_BENCH	0x4
 
+/* Format of the benchmark results file */
+#define TA_BENCH_FMT_JSON	1
+#define TA_BENCH_FMT_CSV	2
+
 /* The module configuration */
 struct ta_conf {
 	uint32_t	vendor_id;	/* default 999999 */
@@ -68,6 +72,10 @@ struct ta_conf {
 	int 		signal;		/* default TEST_APP_DEFAULT_SIGNAL */
 	int		bench_concur;	/* default 100 */
 	int		bench_duration; /* default 10 */
+	int		bench_threads;	/* default 1 */
+	int		bench_rate;	/* default 0 (closed loop) */
+	char 	*	bench_output;	/* default NULL */
+	int		bench_format;	/* default TA_BENCH_FMT_JSON */
 	struct ta_stats {
 		unsigned long long	nb_echoed; /* server */
 		unsigned long long	nb_sent;   /* client */
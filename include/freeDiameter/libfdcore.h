@@ -111,6 +111,16 @@ int fd_core_wait_shutdown_complete(void);
 /*                          CONFIG                            */
 /*============================================================*/
 
+/* The classes of threads that can be bound to a set of CPUs in the configuration (CPUAffinity) */
+enum fd_thr_class {
+	FD_THR_RECV = 0,	/* the threads accepting, establishing and receiving from the connections, the PSM of the peers, the decoders */
+	FD_THR_ROUTE,		/* the routing-in and routing-out threads */
+	FD_THR_DISP,		/* the dispatch threads */
+	FD_THR_OUT,		/* the threads sending to the peers */
+	FD_THR_TIMERS,		/* the thread of the timers */
+	FD_THR_CLASSES
+};
+
 /* Structure to hold the configuration of the freeDiameter daemon */
 #define	EYEC_CONFIG	0xC011F16
 struct fd_config {
@@ -130,10 +140,18 @@ struct fd_config {
 	uint16_t	 cnf_port_tls;	/* the local port for Diameter/TLS (default: 5868) in host byte order */
 	uint16_t	 cnf_port_3436; /* Open an additional server port to listen to old TLS/SCTP clients (RFC3436, freeDiameter versions < 1.2.0) */
 	uint16_t	 cnf_sctp_str;	/* default max number of streams for SCTP associations (def: 30) */
+	uint16_t	 cnf_thr_3436;	/* Number of threads deciphering the records of all TLS/SCTP (RFC3436) associations (def: 4) */
 	struct fd_list	 cnf_endpoints;	/* the local endpoints to bind the server to. list of struct fd_endpoint. default is empty (bind all). After servers are started, this is the actual list of endpoints including port information. */
 	int		 cnf_thr_srv;	/* Number of threads per servers handling the connection state machines */
+	int		 cnf_thr_hs;	/* Number of threads performing the TLS handshakes of TCP connections (def: number of online CPUs) */
+	int		 cnf_hs_max;	/* Max number of TLS handshakes in progress, the new connections above are closed (def: 256) */
 	struct fd_list	 cnf_apps;	/* Applications locally supported (except relay, see flags). Use fd_disp_app_support to add one. list of struct fd_app. */
-	uint16_t	 cnf_dispthr;	/* Number of dispatch threads to create */
+	uint16_t	 cnf_dispthr;	/* Number of dispatch threads to create (per shard) */
+	uint16_t	 cnf_rcv_quota;	/* Max number of routable messages of a peer waiting for the routing before its connection stops being read, 0: no limit (def: 64) */
+	uint16_t	 cnf_shards;	/* Number of routing shards, each with its own queues and routing / dispatch threads (def: 1) */
+	uint16_t	 cnf_dec_thr;	/* Number of threads decoding the routable messages received from all the peers, 0: decoded by the PSM of each peer (def: 0) */
+	uint32_t	 cnf_rtcache_ttl; /* Lifetime in ms of the routing decisions saved by the routing cache, 0: no cache (def: 0) */
+	char		*cnf_cpus[FD_THR_CLASSES]; /* The CPUs ("0-3,8") where the threads of each class run, NULL: not bound (def: NULL) */
 	struct {
 		unsigned no_fwd : 1;	/* the peer does not relay messages (0xffffff app id) */
 		unsigned no_ip4 : 1;	/* disable IP */
@@ -142,6 +160,10 @@ struct fd_config {
 		unsigned no_sctp: 1;	/* disable the use of SCTP */
 		unsigned pr_tcp	: 1;	/* prefer TCP over SCTP */
 		unsigned tls_alg: 1;	/* TLS algorithm for initiated cnx. 0: separate port. 1: inband-security (old) */
+		unsigned io_uring: 1;	/* use the io_uring backend for TCP connections without TLS (requires USE_IO_URING) */
+		unsigned no_tlsres: 1;	/* do not resume the TLS sessions across reconnections of the peers */
+		unsigned rt_realm: 1;	/* the routing candidates of a request are only the peers of its Destination-Realm, its Destination-Host, the relays and Default_Route peers */
+		unsigned inl_ans: 1;	/* the answer callbacks (fd_msg_send) are called by the thread that receives the answer instead of a dispatch thread */
 	} 		 cnf_flags;
 	
 	struct {
@@ -259,6 +281,9 @@ extern const char *peer_state_str[];
 
 #define PI_PRST_NONE	0	/* the peer entry is deleted after disconnection / error */
 #define PI_PRST_ALWAYS	1	/* the peer entry is persistant (will be kept as ZOMBIE in case of error) */
+
+#define PI_RTDEF_NONE	0	/* with RouteByRealm, the peer is a routing candidate only for its realm (unless it is a relay) */
+#define PI_RTDEF_ALWAYS	1	/* the peer is a routing candidate for all requests, e.g. a default route to a proxy */
 			
 /* Information about a remote peer */
 struct peer_info {
@@ -275,6 +300,7 @@ struct peer_info {
 			unsigned	sctpsec :1;	/* PI_SCTPSEC_* */
 			unsigned	exp :1;		/* PI_EXP_* */
 			unsigned	persist :1;	/* PI_PRST_* */
+			unsigned	rtdef :1;	/* PI_RTDEF_* */
 			
 		}		pic_flags;	/* Flags influencing the connection to the remote peer */
 		
@@ -415,6 +441,25 @@ int fd_peer_get_state(struct peer_hdr *peer);
  */
 int fd_peer_cnx_proto_info(struct peer_hdr *peer, char * buf, size_t len);
 
+/* 
+ * FUNCTION:	fd_peer_cnx_rcv_stats
+ *
+ * PARAMETERS:
+ *  peer	: The peer which information to be read
+ *  msgs	: (out) number of messages received on the current connection
+ *  calls	: (out) number of recv calls that returned data on this connection
+ *
+ * DESCRIPTION: 
+ *   Read the receive statistics of the current connection to this peer. The ratio calls / msgs shows how many
+ *  system calls are needed per received message; it is below 1 when several messages are read at once.
+ *  The calls are counted for TCP connections and for SCTP connections without TLS.
+ *
+ * RETURN VALUE:
+ *  0   : the statistics were read (0 if the peer is not connected)
+ * >=0	: error code.
+ */
+int fd_peer_cnx_rcv_stats(struct peer_hdr *peer, unsigned long long * msgs, unsigned long long * calls);
+
 /* 
  * FUNCTION:	fd_peer_get_load_pending
  *
@@ -434,6 +479,29 @@ int fd_peer_cnx_proto_info(struct peer_hdr *peer, char * buf, size_t len);
  */
 int fd_peer_get_load_pending(struct peer_hdr *peer, long * to_receive, long * to_send);
 
+/* 
+ * FUNCTION:	fd_peer_get_load
+ *
+ * PARAMETERS:
+ *  peer	: The peer which load to read
+ *  load	: (out) the load of the peer.
+ *
+ * DESCRIPTION: 
+ *   Same as fd_peer_get_load_pending, with in addition the average delay of the answers received from this peer
+ *  (exponentially weighted, in microseconds, 0 until the first answer). No lock is taken, so this can be called
+ *  for each candidate of each routed message, e.g. by the load-balancing extensions.
+ *
+ * RETURN VALUE:
+ *  0  : The load parameter has been updated.
+ * !0  : An error occurred
+ */
+struct fd_peer_load {
+	long		to_receive;	/* requests sent to this peer and not answered yet */
+	long		to_send;	/* requests received from this peer and not answered yet */
+	uint32_t	latency;	/* average delay of the answers, in microseconds */
+};
+int fd_peer_get_load(struct peer_hdr *peer, struct fd_peer_load * load);
+
 /*
  * FUNCTION:	fd_peer_validate_register
  *
@@ -525,7 +593,8 @@ int fd_peer_validate_register ( int (*peer_validate)(struct peer_info * /* info
  * Otherwise, if the corresponding answer (or error) is received before the timeout date elapses, everything occurs as with fd_msg_send. 
  * Otherwise, the request is removed from the queue (meaning the matching answer will be discarded upon reception) and passed to the expirecb 
  * function. Upon return, if the *msg parameter is not NULL, it is freed (not passed to other callbacks). 
- * expirecb is called in a dedicated thread.
+ * expirecb is called by the thread of the timers that may block (see FD_TIMER_BLOCKING), which is shared by all the peers
+ * and the expiry of the sessions: it should return quickly, a callback that blocks delays the other expirations.
  * 
  *    The prototype for the expirecb callback function is:
  *     void expirecb(void * data, struct peer_hdr * sentto, struct msg ** request)
@@ -621,6 +690,10 @@ int fd_disp_app_support ( struct dict_object * app, struct dict_object * vendor,
  *  - Message is locally generated (OUT messages)
  *
  * There are three global message queues (in queues.c) and also peers-specific queues (in struct fd_peer).
+ * When RoutingShards is greater than 1 in the configuration, each shard has its own three queues and
+ * routing / dispatch threads; a message is handled in the shard selected by the hash of its Session-Id
+ * (or its End-to-End identifier), so that answers are processed in the same shard as their request.
+ * The fd_g_* names below then designate the queues of the message's shard.
  *
  * (*) IN messages processing details:
  *   - the message is received from the remote peer, a FDEVP_CNX_MSG_RECV event is generated for the peer.
@@ -799,6 +872,40 @@ int fd_rt_out_register ( int (*rt_out_cb)(void * cbdata, struct msg ** pmsg, str
  */
 int fd_rt_out_unregister ( struct fd_rt_out_hdl * handler, void ** cbdata );
 
+/*
+ * FUNCTION:	fd_rt_out_set_cacheable
+ *
+ * PARAMETERS:
+ *  handler     : The handler of a registered OUT callback.
+ *
+ * DESCRIPTION: 
+ *   Declare that the scores given by this callback only depend on the Application-Id, Command-Code, Destination-Realm
+ *  and Destination-Host of the message, and on the candidates. The callback must not modify the message or the list.
+ *  When the routing cache is enabled (RoutingCacheTTL), the scores of the cacheable callbacks are saved for the 
+ *  next requests with the same values, and these callbacks are not called for them: their saved scores are added to
+ *  the candidates at their place in the priority order instead. The other callbacks are still called for each message.
+ *
+ * RETURN VALUE:
+ *  0      	: The callback is cacheable.
+ *  EINVAL 	: A parameter is invalid.
+ */
+int fd_rt_out_set_cacheable ( struct fd_rt_out_hdl * handler );
+
+/*
+ * FUNCTION:	fd_rt_out_cache_stats
+ *
+ * PARAMETERS:
+ *  hits	: (out) Number of requests routed with scores from the routing cache.
+ *  misses	: (out) Number of requests for which the cacheable callbacks were called.
+ *
+ * DESCRIPTION: 
+ *   Retrieve the counters of the routing cache (always growing). Either parameter can be NULL.
+ *
+ * RETURN VALUE:
+ *  0      	: The counters are returned.
+ */
+int fd_rt_out_cache_stats ( unsigned long long * hits, unsigned long long * misses );
+
 
 /*============================================================*/
 /*                         EVENTS                             */
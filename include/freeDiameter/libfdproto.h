@@ -1036,6 +1036,43 @@ int fd_dict_getlistof(int criteria, void * parent, struct fd_list ** sentinel);
   In such case, the children must be removed first. */
 int fd_dict_delete(struct dict_object * obj);
 
+/* Functions to speed up the creation of many objects (e.g. by the dictionary extensions at startup).
+  Between these calls, AVPs and enumerated constants are not inserted in order in the lists returned by fd_dict_getlistof;
+  these lists are sorted once by the last fd_dict_bulk_end. Searches are not affected. The calls can be nested. */
+int fd_dict_bulk_begin(struct dictionary * dict);
+int fd_dict_bulk_end(struct dictionary * dict);
+
+/* One entry of a table of definitions for fd_dict_new_batch */
+struct dict_object_def {
+	enum dict_object_type	 type;	 /* DICT_VENDOR, DICT_APPLICATION, DICT_TYPE, DICT_ENUMVAL, DICT_AVP or DICT_COMMAND */
+	void 			*data;	 /* Points to the struct dict_*_data matching the type */
+	char			*parent; /* Name of the parent type, mandatory for DICT_ENUMVAL, optional for DICT_AVP, NULL otherwise */
+};
+
+/*
+ * FUNCTION:	fd_dict_new_batch
+ *
+ * PARAMETERS:
+ *  dict	  : Pointer to the dictionary where the objects are created.
+ *  defs	  : Table of definitions, created in this order.
+ *  nb_defs	  : Number of entries in the table.
+ *  nb_conflicts  : If not NULL, conflicting entries are skipped and counted here instead of failing the batch.
+ *
+ * DESCRIPTION:
+ *  Create all the objects described in a table (typically a static table in a dictionary extension), 
+ * with a single acquisition of the dictionary lock and a single sort of each list (see fd_dict_bulk_begin).
+ *  The parents and vendors referenced in the table are checked before any object is created; they must exist 
+ * in the dictionary already or be defined earlier in the same table. Rules are not supported, use fd_dict_new.
+ *
+ * RETURN VALUE:
+ *  0      	: All the objects have been created (or were already present with the same data).
+ *  EINVAL 	: A parameter is invalid.
+ *  ENOENT 	: A referenced parent type or vendor is not defined.
+ *  EEXIST 	: An entry conflicts with an existing object (only if nb_conflicts is NULL).
+ *  (other standard errors may be returned, too, with their standard meaning)
+ */
+int fd_dict_new_batch(struct dictionary * dict, struct dict_object_def * defs, int nb_defs, int * nb_conflicts);
+
 /*
  ***************************************************************************
  *
@@ -1896,7 +1933,7 @@ struct sess_state; /* declare this in your own extension */
 
 typedef DECLARE_FD_DUMP_PROTOTYPE((*session_state_dump), struct sess_state * st);
 
-/* The following function must be called to activate the session expiry mechanism */
+/* The following function was called to activate the session expiry mechanism. The sessions now always expire, it does nothing. */
 int fd_sess_start(void);
 
 /*
@@ -1912,6 +1949,8 @@ int fd_sess_start(void);
  *  Create a new session handler. This is needed by a module to associate a state with a session object.
  * The cleanup handler is called when the session timeout expires, or fd_sess_destroy is called. It must free
  * the state associated with the session, and eventually trig other actions (send a STR, ...).
+ * On timeout, it is called by the thread of the timers that may block (see FD_TIMER_BLOCKING), which is shared
+ * with the expiry of the requests: it should return quickly, a handler that blocks delays the other expirations.
  *
  * RETURN VALUE:
  *  0      	: The new handler has been created.
@@ -2129,6 +2168,7 @@ int fd_sess_getcount(uint32_t *cnt);
 
 /* Structure that contains the routing data for a message */
 struct rt_data;
+struct rtd_candidate;	/* defined below */
 
 /* Following functions are helpers to create the routing data of a message */
 int  fd_rtd_init(struct rt_data ** rtd);
@@ -2137,6 +2177,10 @@ void fd_rtd_free(struct rt_data ** rtd);
 /* Add a peer to the candidates list. */
 int  fd_rtd_candidate_add(struct rt_data * rtd, DiamId_t peerid, size_t peeridlen, DiamId_t realm, size_t realmlen);
 
+/* Initialize the (empty) candidates list from an array of nb peers ordered by diamid (fd_os_cmp), in one allocation. The strings are not copied:
+ they must remain valid until the routing data is freed, release(data) is called then (if not NULL). Only diamid, diamidlen, realm, realmlen and peer of the items are used. */
+int  fd_rtd_candidate_add_array(struct rt_data * rtd, struct rtd_candidate * peers, int nb, void (*release)(void *), void * data);
+
 /* Remove a peer from the candidates (if it is found). The search is case-insensitive. */
 void fd_rtd_candidate_del(struct rt_data * rtd, uint8_t * id, size_t idsz);
 
@@ -2157,6 +2201,7 @@ struct rtd_candidate {
 	DiamId_t	realm;	/* the diameter realm of the peer */
 	size_t		realmlen; /* cached size of realm */
 	int		score;	/* the current routing score for this peer, see fd_rt_out_register definition for details */
+	void *		peer;	/* the framework's peer object (struct peer_hdr *) when known, NULL otherwise. Valid as long as the routing data. */
 };
 
 /* Reorder the list of peers by score */
@@ -2369,6 +2414,7 @@ int fd_msg_avp_add ( msg_or_avp * reference, enum msg_brw_dir dir, struct avp *a
  * Note: only the first instance of the AVP is returned by this function.
  * Note: only top-level AVPs are searched, not inside grouped AVPs.
  * Use msg_browse if you need more advanced research features.
+ * On messages with many AVPs, fd_msg_parse_dict creates an index of the top-level AVPs, which is used until an AVP is added or removed.
  *
  * RETURN VALUE:
  *  0      	: The AVP has been found.
@@ -2725,6 +2771,68 @@ int fd_msg_bufferize ( struct msg * msg, uint8_t ** buffer, size_t * len );
  */
 int fd_msg_parse_buffer ( uint8_t ** buffer, size_t buflen, struct msg ** msg );
 
+/* Message templates, for applications that send many similar requests */
+struct fd_msg_tmpl;
+
+/*
+ * FUNCTION:	fd_msg_tmpl_new
+ *
+ * PARAMETERS:
+ *  msg		: A fully built message, with a model (e.g. created by fd_msg_new with a command model).
+ *  fields	: Array of AVPs of this message whose value change from one request to the other (e.g. Session-Id).
+ *  nb_fields	: Number of entries in the fields array (may be 0).
+ *  tmpl 	: Upon success, the new template is stored here.
+ *
+ * DESCRIPTION: 
+ *   Bufferize the message once and save the location of the fields in this buffer. The fields must be AVPs of the message
+ *  with a known scalar type (not Grouped); they may be located inside Grouped AVPs. The message is not modified and
+ *  can be freed after this call.
+ *
+ * RETURN VALUE:
+ *  0      	: The template has been created.
+ *  EINVAL 	: A parameter is invalid.
+ *  ENOMEM	: Memory allocation failed.
+ */
+int fd_msg_tmpl_new ( struct msg * msg, struct avp ** fields, int nb_fields, struct fd_msg_tmpl ** tmpl );
+
+/*
+ * FUNCTION:	fd_msg_tmpl_instance
+ *
+ * PARAMETERS:
+ *  tmpl	: A template created by fd_msg_tmpl_new.
+ *  values	: Array of nb_fields pointers (same order as in fd_msg_tmpl_new) to the values of this instance. A NULL entry
+ *		  (or a NULL array) keeps the value of the template. OctetString values may have a different length.
+ *  flags	: MSGFL_ALLOC_ETEID to get a new End-to-End Identifier, otherwise the one of the template is kept.
+ *  msg 	: Upon success, the new message is stored here.
+ *
+ * DESCRIPTION: 
+ *   Create a new message by copying the template buffer and patching the fields values and lengths in place, instead of
+ *  rebuilding and bufferizing the AVP tree. The returned message is similar to the result of fd_msg_parse_buffer: its AVPs
+ *  are interpreted with the dictionary only when they are searched for (fd_msg_search_avp) or fd_msg_parse_dict is called,
+ *  and the saved buffer is reused when the message is sent. The Hop-by-Hop Identifier is assigned when the message is sent.
+ *
+ * RETURN VALUE:
+ *  0      	: The message has been created.
+ *  EINVAL 	: A parameter is invalid.
+ *  ENOMEM	: Memory allocation failed.
+ */
+int fd_msg_tmpl_instance ( struct fd_msg_tmpl * tmpl, union avp_value ** values, int flags, struct msg ** msg );
+
+/*
+ * FUNCTION:	fd_msg_tmpl_free
+ *
+ * PARAMETERS:
+ *  tmpl	: A template created by fd_msg_tmpl_new.
+ *
+ * DESCRIPTION: 
+ *   Destroy a template. The messages created from it are not affected.
+ *
+ * RETURN VALUE:
+ *  0      	: The template has been destroyed.
+ *  EINVAL 	: A parameter is invalid.
+ */
+int fd_msg_tmpl_free ( struct fd_msg_tmpl * tmpl );
+
 /* Parsing Error Information structure */
 struct fd_pei {
 	char *		pei_errcode;	/* name of the error code to use */
@@ -3127,6 +3235,8 @@ int fd_fifo_length ( struct fifo * queue );
  * Since there is no destructor for the data pointer, if cleanup operations are required, they should be performed in
  * l_cb when the length of the queue is becoming < low.
  *
+ * Calling the function with high == 0 removes the thresholds and the data pointer, e.g. before fd_fifo_del.
+ *
  * Note that the callbacks are called synchronously, during fd_fifo_post or fd_fifo_get. Their operation should be quick.
  *
  * RETURN VALUE:
@@ -3247,6 +3357,101 @@ int fd_fifo_select ( struct fifo * queue, const struct timespec *abstime );
 typedef DECLARE_FD_DUMP_PROTOTYPE((*fd_fifo_dump_item_cb), void * item); /* This function should be 1 line if possible, or use indent level. Ends with '\n' */
 DECLARE_FD_DUMP_PROTOTYPE(fd_fifo_dump, char * name, struct fifo * queue, fd_fifo_dump_item_cb dump_item);
 
+
+
+/*============================================================*/
+/*                     TIMERS                                 */
+/*============================================================*/
+
+/* The timers are handled by a hierarchical timer wheel with a resolution of 1ms, served by a single thread 
+ that is created on first use. All the timers that expire together are processed in one wakeup of this thread.
+ The callbacks are called in this thread, one at a time: they must not block. They may arm or cancel any timer.
+ The callbacks that may take time (because they call the callbacks of the extensions, wait for a lock or a queue...) 
+ must be flagged FD_TIMER_BLOCKING: they are called one at a time by a second thread, so that they do not delay 
+ the expiry of the other timers. */
+
+/* A timer, embedded in the object it applies to. The fields are private. */
+struct fd_timer {
+	struct fd_list	chain;	/* link in the wheel. The "o" field points to the timer */
+	uint64_t	tick;	/* expiry date, in ms since the Epoch */
+	int		lvl;	/* level of the wheel where the timer is linked */
+	int		flags;	/* FD_TIMER_* */
+	void	     (*cb)(void *);
+	void	       *data;
+};
+#define FD_TIMER_BLOCKING	0x01	/* The callback may block, it is called by the second thread */
+#define FD_TIMER_INITIALIZER( _timer_name, _cb, _data, _flags ) \
+	{ .chain = FD_LIST_INITIALIZER_O( (_timer_name).chain, &(_timer_name) ), .tick = 0, .lvl = -1, .flags = _flags, .cb = _cb, .data = _data }
+
+/*
+ * FUNCTION:	fd_timer_init
+ *
+ * PARAMETERS:
+ *  timer	: The timer to initialize.
+ *  cb		: The function called when the timer expires.
+ *  data	: The parameter passed to cb.
+ *  flags	: FD_TIMER_BLOCKING if cb may block, 0 otherwise.
+ *
+ * DESCRIPTION: 
+ *  Initialize a timer. It is not armed.
+ *
+ * RETURN VALUE:
+ *  none.
+ */
+void fd_timer_init ( struct fd_timer * timer, void (*cb)(void *), void * data, int flags );
+
+/*
+ * FUNCTION:	fd_timer_arm
+ *
+ * PARAMETERS:
+ *  timer	: An initialized timer.
+ *  abstime	: The absolute time (CLOCK_REALTIME) when the callback must be called.
+ *
+ * DESCRIPTION: 
+ *  Arm the timer, or move it to the new date if it was already armed. A date in the past
+ * expires the timer as soon as possible. The callback is called once for each arming.
+ *
+ * RETURN VALUE:
+ *  0		: The timer is armed.
+ *  EINVAL 	: A parameter is invalid.
+ *  (other errors if the thread of the timers cannot be created)
+ */
+int fd_timer_arm ( struct fd_timer * timer, const struct timespec * abstime );
+
+/*
+ * FUNCTION:	fd_timer_cancel
+ *
+ * PARAMETERS:
+ *  timer	: An initialized timer.
+ *
+ * DESCRIPTION: 
+ *  Disarm the timer if it is armed. If its callback is being called, wait for it to complete,
+ * unless the function is called from a timer callback. The object containing the timer can then be freed.
+ * Do not call this function while holding a lock that the callback takes.
+ *
+ * RETURN VALUE:
+ *  0		: The timer is not armed anymore.
+ *  EINVAL 	: A parameter is invalid.
+ */
+int fd_timer_cancel ( struct fd_timer * timer );
+
+/*
+ * FUNCTION:	fd_timers_thr_hook
+ *
+ * PARAMETERS:
+ *  hook	: The function to call in the thread of the timers, or NULL to unregister it.
+ *
+ * DESCRIPTION: 
+ *  Register a function that the threads of the timers call once, as soon as possible, and again
+ * each time these threads are created. This is used to set its properties, like its CPU affinity.
+ * The function is called with the lock of the wheel held: it must not use the timers.
+ *
+ * RETURN VALUE:
+ *  0		: The hook is registered.
+ *  (other errors from the pthread functions)
+ */
+int fd_timers_thr_hook ( void (*hook)(void) );
+
 #ifdef __cplusplus
 }
 #endif
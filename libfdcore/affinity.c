@@ -0,0 +1,229 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+
+/* Placement of the threads of the framework on the CPUs (CPUAffinity directive) */
+
+#include "fdcore-internal.h"
+
+#ifdef HAVE_PTHREAD_SETAFFINITY
+#include <sched.h>
+#define CPUS_MAX	CPU_SETSIZE
+#else /* HAVE_PTHREAD_SETAFFINITY */
+#define CPUS_MAX	1024
+#endif /* HAVE_PTHREAD_SETAFFINITY */
+
+/* The names of the classes in the configuration, and the threads they contain for the dump */
+static struct {
+	const char * name;
+	const char * label;
+	const char * threads;
+} thr_classes[FD_THR_CLASSES] = {
+	{ "receive",  "CPUs of receive thr .... ", "servers, connections, PSM, decoders, TLS handshakes" },
+	{ "route",    "CPUs of route thr ...... ", "routing-in and routing-out" },
+	{ "dispatch", "CPUs of dispatch thr ... ", "AppServThreads" },
+	{ "out",      "CPUs of out thr ........ ", "senders of the peers" },
+	{ "timers",   "CPUs of timers thr ..... ", "timers" }
+};
+
+/* Parse a list of CPUs like "0-3,8,10-11" into map (CPUS_MAX bytes, 1 for each CPU of the list). Returns the number of CPUs, or -1 if the list is invalid */
+static int cpus_parse(const char * list, uint8_t * map)
+{
+	const char * p = list;
+	int nb = 0;
+	
+	memset(map, 0, CPUS_MAX);
+	do {
+		char * end;
+		long first, last;
+		
+		first = last = strtol(p, &end, 10);
+		if ((end == p) || (first < 0))
+			return -1;
+		if (*end == '-') {
+			p = end + 1;
+			last = strtol(p, &end, 10);
+			if ((end == p) || (last < first))
+				return -1;
+		}
+		if (last >= CPUS_MAX)
+			return -1;
+		for (; first <= last; first++) {
+			if (!map[first]) {
+				map[first] = 1;
+				nb++;
+			}
+		}
+		
+		p = end;
+		if (*p != ',')
+			break;
+		p++;
+	} while (1);
+	
+	return *p ? -1 : nb;
+}
+
+/* Search a class by its name in the configuration, -1 if unknown */
+int fd_thr_class_byname(const char * name)
+{
+	int c;
+	for (c = 0; c < FD_THR_CLASSES; c++) {
+		if (!strcasecmp(name, thr_classes[c].name))
+			return c;
+	}
+	return -1;
+}
+
+/* Check a list of CPUs from the configuration */
+int fd_thr_cpus_check(const char * list)
+{
+	uint8_t map[CPUS_MAX];
+	
+	CHECK_PARAMS( list );
+	if (cpus_parse(list, map) <= 0)
+		return EINVAL;
+	return 0;
+}
+
+/* Bind the calling thread to the CPUs of its class. When shard is not -1 and there are several shards, the CPUs
+ (the ones of the class, or all the CPUs available to the process if the class is not configured) are split in cnf_shards 
+ contiguous sets and the thread is bound to the set of its shard. The memory that the thread allocates after this call 
+ is placed by the kernel on the NUMA node of these CPUs when it is first written. */
+void fd_thr_bind(int cls, int shard)
+{
+#ifdef HAVE_PTHREAD_SETAFFINITY
+	uint8_t map[CPUS_MAX];
+	int cpus[CPUS_MAX];
+	cpu_set_t set;
+	int nb = 0, c, first, last;
+	int split = (shard >= 0) && (fd_g_config->cnf_shards > 1);
+	
+	if (fd_g_config->cnf_cpus[cls]) {
+		CHECK_PARAMS_DO( cpus_parse(fd_g_config->cnf_cpus[cls], map) > 0, return );
+		for (c = 0; c < CPUS_MAX; c++) {
+			if (map[c])
+				cpus[nb++] = c;
+		}
+	} else {
+		if (!split)
+			return;
+		CHECK_SYS_DO( sched_getaffinity(0, sizeof(set), &set), return );
+		for (c = 0; c < CPU_SETSIZE; c++) {
+			if (CPU_ISSET(c, &set))
+				cpus[nb++] = c;
+		}
+	}
+	if (nb == 0)
+		return;
+	
+	first = 0;
+	last = nb;
+	if (split) {
+		if (fd_g_config->cnf_shards >= nb) {
+			first = shard % nb;
+			last = first + 1;
+		} else {
+			first = shard * nb / fd_g_config->cnf_shards;
+			last = (shard + 1) * nb / fd_g_config->cnf_shards;
+		}
+	}
+	
+	CPU_ZERO(&set);
+	for (c = first; c < last; c++)
+		CPU_SET(cpus[c], &set);
+	
+	CHECK_POSIX_DO( pthread_setaffinity_np(pthread_self(), sizeof(set), &set), /* continue without binding */ );
+#endif /* HAVE_PTHREAD_SETAFFINITY */
+}
+
+#ifdef HAVE_PTHREAD_SETAFFINITY
+/* Called in the thread of the timers, which is created before the configuration is parsed */
+static void timers_bind(void)
+{
+	fd_thr_bind(FD_THR_TIMERS, -1);
+}
+#endif /* HAVE_PTHREAD_SETAFFINITY */
+
+/* Apply the configuration to the threads already running */
+int fd_thr_affinity_init(void)
+{
+	int c;
+	
+	TRACE_ENTRY();
+	
+	for (c = 0; c < FD_THR_CLASSES; c++) {
+		if (fd_g_config->cnf_cpus[c])
+			break;
+	}
+	if (c == FD_THR_CLASSES)
+		return 0;
+	
+#ifdef HAVE_PTHREAD_SETAFFINITY
+	if (fd_g_config->cnf_cpus[FD_THR_TIMERS]) {
+		CHECK_FCT( fd_timers_thr_hook(timers_bind) );
+	}
+#else /* HAVE_PTHREAD_SETAFFINITY */
+	LOG_N("CPUAffinity is not supported on this system, the threads are not bound to CPUs.");
+#endif /* HAVE_PTHREAD_SETAFFINITY */
+	return 0;
+}
+
+/* Dump the placement of the threads, for fd_conf_dump */
+DECLARE_FD_DUMP_PROTOTYPE(fd_thr_affinity_dump)
+{
+	int c;
+	
+	FD_DUMP_HANDLE_OFFSET();
+	
+	for (c = 0; c < FD_THR_CLASSES; c++) {
+		const char * cpus = fd_g_config->cnf_cpus[c];
+#ifdef HAVE_PTHREAD_SETAFFINITY
+		int sharded = ((c == FD_THR_ROUTE) || (c == FD_THR_DISP)) && (fd_g_config->cnf_shards > 1);
+		const char * note = "";
+#else /* HAVE_PTHREAD_SETAFFINITY */
+		int sharded = 0;
+		const char * note = cpus ? " - not supported, ignored" : "";
+#endif /* HAVE_PTHREAD_SETAFFINITY */
+		
+		CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  %s: %s%s (%s)%s\n", 
+				thr_classes[c].label,
+				cpus ?: (sharded ? "all" : "(not bound)"), 
+				sharded ? " split between the shards" : "",
+				thr_classes[c].threads,
+				note), return NULL);
+	}
+	return *buf;
+}
@@ -40,11 +40,6 @@
 #include <ifaddrs.h> /* for getifaddrs */
 #include <sys/uio.h> /* writev */
 
-/* The maximum size of Diameter message we accept to receive (<= 2^24) to avoid too big mallocs in case of trashed headers */
-#ifndef DIAMETER_MSG_SIZE_MAX
-#define DIAMETER_MSG_SIZE_MAX	65535	/* in bytes */
-#endif /* DIAMETER_MSG_SIZE_MAX */
-
 
 /* Connections contexts (cnxctx) in freeDiameter are wrappers around the sockets and TLS operations .
  * They are used to hide the details of the processing to the higher layers of the daemon.
@@ -559,6 +554,19 @@ int fd_cnx_proto_info(struct cnxctx * conn, char * buf, size_t len)
 	return 0;
 }
 
+/* Receive statistics of the connection */
+int fd_cnx_rcv_stats(struct cnxctx * conn, unsigned long long * msgs, unsigned long long * calls)
+{
+	CHECK_PARAMS( conn );
+	
+	if (msgs)
+		*msgs = conn->cc_rcv_msgs;
+	if (calls)
+		*calls = conn->cc_rcv_calls;
+	
+	return 0;
+}
+
 /* Retrieve a list of all IP addresses of the local system from the kernel, using getifaddrs */
 int fd_cnx_get_local_eps(struct fd_list * list)
 {
@@ -669,6 +677,8 @@ again:
 	if (ret <= 0) {
 		CHECK_SYS_DO(ret, /* continue, this is only used to log the error here */);
 		fd_cnx_markerror(conn);
+	} else {
+		conn->cc_rcv_calls++;
 	}
 
 	return ret;
@@ -679,6 +689,10 @@ static ssize_t fd_cnx_s_sendv(struct cnxctx * conn, const struct iovec * iov, in
 {
 	ssize_t ret = 0;
 	struct timespec ts, now;
+#ifdef USE_IO_URING
+	if (conn->cc_uring)
+		return fd_uring_sendv(conn, iov, iovcnt);
+#endif /* USE_IO_URING */
 	CHECK_SYS_DO(  clock_gettime(CLOCK_REALTIME, &ts), return -1 );
 again:
 	ret = writev(conn->cc_socket, iov, iovcnt);
@@ -740,7 +754,7 @@ static int fd_cnx_init_msg_buffer(uint8_t * buffer, size_t expected_len, struct
 	return 0;
 }
 
-static uint8_t * fd_cnx_alloc_msg_buffer(size_t expected_len, struct fd_msg_pmdl ** pmdl)
+uint8_t * fd_cnx_alloc_msg_buffer(size_t expected_len, struct fd_msg_pmdl ** pmdl)
 {
 	uint8_t * ret = NULL;
 
@@ -768,82 +782,155 @@ static void free_rcvdata(void * arg)
 	free(data->buffer);
 }
 
-/* Receiver thread (TCP & noTLS) : incoming message is directly saved into the target queue */
-static void * rcvthr_notls_tcp(void * arg)
+/* Receive more data in the buffer of rcvthr_notls_tcp. "needed" is the size of the data expected from *start.
+ If the connection does not loop, we do not read beyond these data: what follows may not be for us (e.g. TLS handshake). */
+static int rcvbuf_read(struct cnxctx * conn, uint8_t * rbuf, size_t * start, size_t * end, size_t needed)
 {
-	struct cnxctx * conn = arg;
-
-	TRACE_ENTRY("%p", arg);
-	CHECK_PARAMS_DO(conn && (conn->cc_socket > 0), goto out);
-
-	/* Set the thread name */
-	{
-		char buf[48];
-		snprintf(buf, sizeof(buf), "Receiver (%d) TCP/noTLS)", conn->cc_socket);
-		fd_log_threadname ( buf );
+	ssize_t ret;
+	size_t len;
+	
+	/* Do not read more while the reception is paused */
+	fd_cnx_recv_wait(conn);
+	
+	/* Move the pending data to the beginning of the buffer if the space left at the end is too small */
+	if ((*start > 0) && ((*start + needed > CNX_RCVBUF_SIZE) || (CNX_RCVBUF_SIZE - *end < CNX_RCVBUF_SIZE / 4))) {
+		memmove(rbuf, rbuf + *start, *end - *start);
+		*end -= *start;
+		*start = 0;
 	}
+	
+	if (conn->cc_loop)
+		len = CNX_RCVBUF_SIZE - *end;
+	else
+		len = *start + needed - *end;
+	
+	ret = fd_cnx_s_recv(conn, rbuf + *end, len);
+	if (ret <= 0)
+		return ENOTCONN; /* the event was already sent */
+	
+	*end += ret;
+	return 0;
+}
 
-	ASSERT( conn->cc_proto == IPPROTO_TCP );
-	ASSERT( ! fd_cnx_teststate(conn, CC_STATUS_TLS ) );
-	ASSERT( fd_cnx_target_queue(conn) );
-
-	/* Receive from a TCP connection: we have to rebuild the message boundaries */
+/* Rebuild the messages from the TCP stream. We read as much as possible in rbuf, and split all the complete messages it contains.
+ Returns 0 when the connection is closed or the thread must stop, an error code if the daemon must stop. */
+static int rcvthr_notls_tcp_loop(struct cnxctx * conn, uint8_t * rbuf)
+{
+	size_t start = 0, end = 0;
+	
 	do {
-		uint8_t header[4];
 		struct fd_cnx_rcvdata rcv_data;
 		struct fd_msg_pmdl *pmdl=NULL;
 		ssize_t ret = 0;
 		size_t	received = 0;
-
-		do {
-			ret = fd_cnx_s_recv(conn, &header[received], sizeof(header) - received);
-			if (ret <= 0) {
-				goto out; /* Stop the thread, the event was already sent */
-			}
-
-			received += ret;
-
-			if (header[0] != DIAMETER_VERSION)
-				break; /* No need to wait for 4 bytes in this case */
-		} while (received < sizeof(header));
-
-		rcv_data.length = ((size_t)header[1] << 16) + ((size_t)header[2] << 8) + (size_t)header[3];
-
+		
+		/* Wait for the header of the next message */
+		while ((end - start < 4) && ((end == start) || (rbuf[start] == DIAMETER_VERSION))) {
+			/* No need to wait for 4 bytes if this is not a Diameter message */
+			if (rcvbuf_read(conn, rbuf, &start, &end, 4))
+				return 0;
+		}
+		
+		rcv_data.length = 0;
+		if (end - start >= 4)
+			rcv_data.length = ((size_t)rbuf[start + 1] << 16) + ((size_t)rbuf[start + 2] << 8) + (size_t)rbuf[start + 3];
+		
 		/* Check the received word is a valid begining of a Diameter message */
-		if ((header[0] != DIAMETER_VERSION)	/* defined in <libfdproto.h> */
-		   || (rcv_data.length > DIAMETER_MSG_SIZE_MAX)) { /* to avoid too big mallocs */
+		if ((rbuf[start] != DIAMETER_VERSION)	/* defined in <libfdproto.h> */
+		   || (rcv_data.length > DIAMETER_MSG_SIZE_MAX) /* to avoid too big mallocs */
+		   || (rcv_data.length < 4)) { /* shorter than its own header */
 			/* The message is suspect */
-			LOG_E( "Received suspect header [ver: %d, size: %zd] from '%s', assuming disconnection", (int)header[0], rcv_data.length, conn->cc_remid);
+			LOG_E( "Received suspect header [ver: %d, size: %zd] from '%s', assuming disconnection", (int)rbuf[start], rcv_data.length, conn->cc_remid);
 			fd_cnx_markerror(conn);
-			goto out; /* Stop the thread, the recipient of the event will cleanup */
+			return 0; /* Stop the thread, the recipient of the event will cleanup */
 		}
-
+		
 		/* Ok, now we can really receive the data */
-		CHECK_MALLOC_DO(  rcv_data.buffer = fd_cnx_alloc_msg_buffer( rcv_data.length, &pmdl ), goto fatal );
-		memcpy(rcv_data.buffer, header, sizeof(header));
-
-		while (received < rcv_data.length) {
-			pthread_cleanup_push(free_rcvdata, &rcv_data); /* In case we are canceled, clean the partialy built buffer */
-			ret = fd_cnx_s_recv(conn, rcv_data.buffer + received, rcv_data.length - received);
-			pthread_cleanup_pop(0);
-
-			if (ret <= 0) {
-				free_rcvdata(&rcv_data);
-				goto out;
+		CHECK_MALLOC(  rcv_data.buffer = fd_cnx_alloc_msg_buffer( rcv_data.length, &pmdl ) );
+		
+		if (rcv_data.length <= CNX_RCVBUF_SIZE) {
+			/* Wait until the whole message is in the buffer */
+			while (end - start < rcv_data.length) {
+				pthread_cleanup_push(free_rcvdata, &rcv_data); /* In case we are canceled */
+				ret = rcvbuf_read(conn, rbuf, &start, &end, rcv_data.length);
+				pthread_cleanup_pop(0);
+				
+				if (ret) {
+					free_rcvdata(&rcv_data);
+					return 0;
+				}
+			}
+			memcpy(rcv_data.buffer, rbuf + start, rcv_data.length);
+			start += rcv_data.length;
+		} else {
+			/* Big message, receive the remaining part directly in its buffer */
+			received = end - start;
+			memcpy(rcv_data.buffer, rbuf + start, received);
+			start = end;
+			
+			while (received < rcv_data.length) {
+				pthread_cleanup_push(free_rcvdata, &rcv_data); /* In case we are canceled, clean the partialy built buffer */
+				ret = fd_cnx_s_recv(conn, rcv_data.buffer + received, rcv_data.length - received);
+				pthread_cleanup_pop(0);
+				
+				if (ret <= 0) {
+					free_rcvdata(&rcv_data);
+					return 0;
+				}
+				received += ret;
 			}
-			received += ret;
 		}
-
+		
+		if (start == end)
+			start = end = 0;
+		
 		fd_hook_call(HOOK_DATA_RECEIVED, NULL, NULL, &rcv_data, pmdl);
-
+		conn->cc_rcv_msgs++;
+		
 		/* We have received a complete message, pass it to the daemon */
-		CHECK_FCT_DO( fd_event_send( fd_cnx_target_queue(conn), FDEVP_CNX_MSG_RECV, rcv_data.length, rcv_data.buffer),
+		CHECK_FCT_DO( ret = fd_event_send( fd_cnx_target_queue(conn), FDEVP_CNX_MSG_RECV, rcv_data.length, rcv_data.buffer),
 			{
 				free_rcvdata(&rcv_data);
-				goto fatal;
+				return ret;
 			} );
-
+		
 	} while (conn->cc_loop);
+	
+	return 0;
+}
+
+/* Receiver thread (TCP & noTLS) : incoming message is directly saved into the target queue */
+static void * rcvthr_notls_tcp(void * arg)
+{
+	struct cnxctx * conn = arg;
+	uint8_t * rbuf = NULL;
+	int ret;
+
+	TRACE_ENTRY("%p", arg);
+	CHECK_PARAMS_DO(conn && (conn->cc_socket > 0), goto out);
+
+	/* Set the thread name */
+	{
+		char buf[48];
+		snprintf(buf, sizeof(buf), "Receiver (%d) TCP/noTLS)", conn->cc_socket);
+		fd_log_threadname ( buf );
+	}
+	fd_thr_bind(FD_THR_RECV, -1);
+
+	ASSERT( conn->cc_proto == IPPROTO_TCP );
+	ASSERT( ! fd_cnx_teststate(conn, CC_STATUS_TLS ) );
+	ASSERT( fd_cnx_target_queue(conn) );
+
+	/* Receive from a TCP connection: we have to rebuild the message boundaries. 
+	 We read as much data as available at once in a buffer, to avoid two recv calls per message. */
+	CHECK_MALLOC_DO( rbuf = malloc(CNX_RCVBUF_SIZE), goto fatal );
+	
+	pthread_cleanup_push(free, rbuf);
+	ret = rcvthr_notls_tcp_loop(conn, rbuf);
+	pthread_cleanup_pop(1);
+	
+	if (ret)
+		goto fatal;
 
 out:
 	TRACE_DEBUG(FULL, "Thread terminated");
@@ -872,6 +959,7 @@ static void * rcvthr_notls_sctp(void * arg)
 		snprintf(buf, sizeof(buf), "Receiver (%d) SCTP/noTLS)", conn->cc_socket);
 		fd_log_threadname ( buf );
 	}
+	fd_thr_bind(FD_THR_RECV, -1);
 
 	ASSERT( conn->cc_proto == IPPROTO_SCTP );
 	ASSERT( ! fd_cnx_teststate(conn, CC_STATUS_TLS ) );
@@ -879,6 +967,7 @@ static void * rcvthr_notls_sctp(void * arg)
 
 	do {
 		struct fd_msg_pmdl *pmdl=NULL;
+		fd_cnx_recv_wait(conn);
 		CHECK_FCT_DO( fd_sctp_recvmeta(conn, NULL, &rcv_data.buffer, &rcv_data.length, &event), goto fatal );
 		if (event == FDEVP_CNX_ERROR) {
 			fd_cnx_markerror(conn);
@@ -893,6 +982,7 @@ static void * rcvthr_notls_sctp(void * arg)
 		if (event == FDEVP_CNX_MSG_RECV) {
 			CHECK_MALLOC_DO( rcv_data.buffer = fd_cnx_realloc_msg_buffer(rcv_data.buffer, rcv_data.length, &pmdl), goto fatal );
 			fd_hook_call(HOOK_DATA_RECEIVED, NULL, NULL, &rcv_data, pmdl);
+			conn->cc_rcv_msgs++;
 		}
 		CHECK_FCT_DO( fd_event_send( fd_cnx_target_queue(conn), event, rcv_data.length, rcv_data.buffer), goto fatal );
 
@@ -924,6 +1014,11 @@ int fd_cnx_start_clear(struct cnxctx * conn, int loop)
 
 	switch (conn->cc_proto) {
 		case IPPROTO_TCP:
+#ifdef USE_IO_URING
+			/* The connections that stay in clear are handled by the io_uring thread, if possible */
+			if (loop && fd_g_config->cnf_flags.io_uring && (fd_uring_start(conn) == 0))
+				break;
+#endif /* USE_IO_URING */
 			/* Start the tcp_notls thread */
 			CHECK_POSIX( pthread_create( &conn->cc_rcvthr, NULL, rcvthr_notls_tcp, conn ) );
 			break;
@@ -1058,6 +1153,9 @@ int fd_tls_rcvthr_core(struct cnxctx * conn, gnutls_session_t session)
 		struct fd_msg_pmdl *pmdl=NULL;
 		ssize_t ret = 0;
 		size_t	received = 0;
+		
+		/* Do not read more while the reception is paused */
+		fd_cnx_recv_wait(conn);
 
 		do {
 			ret = fd_tls_recv_handle_error(conn, session, &header[received], sizeof(header) - received);
@@ -1072,7 +1170,8 @@ int fd_tls_rcvthr_core(struct cnxctx * conn, gnutls_session_t session)
 
 		/* Check the received word is a valid beginning of a Diameter message */
 		if ((header[0] != DIAMETER_VERSION)	/* defined in <libfreeDiameter.h> */
-		   || (rcv_data.length > DIAMETER_MSG_SIZE_MAX)) { /* to avoid too big mallocs */
+		   || (rcv_data.length > DIAMETER_MSG_SIZE_MAX) /* to avoid too big mallocs */
+		   || (rcv_data.length < sizeof(header))) { /* shorter than its own header */
 			/* The message is suspect */
 			LOG_E( "Received suspect header [ver: %d, size: %zd] from '%s', assume disconnection", (int)header[0], rcv_data.length, conn->cc_remid);
 			fd_cnx_markerror(conn);
@@ -1096,6 +1195,7 @@ int fd_tls_rcvthr_core(struct cnxctx * conn, gnutls_session_t session)
 		}
 
 		fd_hook_call(HOOK_DATA_RECEIVED, NULL, NULL, &rcv_data, pmdl);
+		conn->cc_rcv_msgs++;
 
 		/* We have received a complete message, pass it to the daemon */
 		CHECK_FCT_DO( ret = fd_event_send( fd_cnx_target_queue(conn), FDEVP_CNX_MSG_RECV, rcv_data.length, rcv_data.buffer),
@@ -1125,6 +1225,7 @@ static void * rcvthr_tls_single(void * arg)
 		snprintf(buf, sizeof(buf), "Receiver (%d) TLS/single stream", conn->cc_socket);
 		fd_log_threadname ( buf );
 	}
+	fd_thr_bind(FD_THR_RECV, -1);
 
 	ASSERT( fd_cnx_teststate(conn, CC_STATUS_TLS) );
 	ASSERT( fd_cnx_target_queue(conn) );
@@ -1615,13 +1716,24 @@ static int fd_cnx_uses_dtls(struct cnxctx * conn) {
 }
 #endif /* DISABLE_SCTP */
 
-/* TLS handshake a connection; no need to have called start_clear before. Reception is active if handhsake is successful */
-int fd_cnx_handshake(struct cnxctx * conn, int mode, int algo, char * priority, void * alt_creds)
+/* Install the transport functions of a single TLS session over the socket */
+static void set_tls_transport(struct cnxctx * conn)
 {
-	int dtls = 0;
+	#ifdef GNUTLS_VERSION_300
+	GNUTLS_TRACE( gnutls_transport_set_pull_timeout_function( conn->cc_tls_para.session, (void *)fd_cnx_s_select ) );
+	#endif /* GNUTLS_VERSION_300 */
+	GNUTLS_TRACE( gnutls_transport_set_pull_function(conn->cc_tls_para.session, (void *)fd_cnx_s_recv) );
+	#ifndef GNUTLS_VERSION_212
+	GNUTLS_TRACE( gnutls_transport_set_push_function(conn->cc_tls_para.session, (void *)fd_cnx_s_send) );
+	#else /* GNUTLS_VERSION_212 */
+	GNUTLS_TRACE( gnutls_transport_set_vec_push_function(conn->cc_tls_para.session, (void *)fd_cnx_s_sendv) );
+	#endif /* GNUTLS_VERSION_212 */
+}
 
-	TRACE_ENTRY( "%p %d %d %p %p", conn, mode, algo, priority, alt_creds);
-	CHECK_PARAMS( conn && (!fd_cnx_teststate(conn, CC_STATUS_TLS)) && ( (mode == GNUTLS_CLIENT) || (mode == GNUTLS_SERVER) ) && (!conn->cc_loop) );
+/* Prepare the master session of a connection for the handshake */
+static int handshake_prepare(struct cnxctx * conn, int mode, int algo, char * priority, void * alt_creds)
+{
+	int dtls = 0;
 
 	/* Save the mode */
 	conn->cc_tls_para.mode = mode;
@@ -1653,15 +1765,7 @@ int fd_cnx_handshake(struct cnxctx * conn, int mode, int algo, char * priority,
 
 		/* Set the push and pull callbacks */
 		if (!dtls) {
-			#ifdef GNUTLS_VERSION_300
-			GNUTLS_TRACE( gnutls_transport_set_pull_timeout_function( conn->cc_tls_para.session, (void *)fd_cnx_s_select ) );
-			#endif /* GNUTLS_VERSION_300 */
-			GNUTLS_TRACE( gnutls_transport_set_pull_function(conn->cc_tls_para.session, (void *)fd_cnx_s_recv) );
-			#ifndef GNUTLS_VERSION_212
-			GNUTLS_TRACE( gnutls_transport_set_push_function(conn->cc_tls_para.session, (void *)fd_cnx_s_send) );
-			#else /* GNUTLS_VERSION_212 */
-			GNUTLS_TRACE( gnutls_transport_set_vec_push_function(conn->cc_tls_para.session, (void *)fd_cnx_s_sendv) );
-			#endif /* GNUTLS_VERSION_212 */
+			set_tls_transport(conn);
 		} else {
 			TODO("DTLS push/pull functions");
 			return ENOTSUP;
@@ -1686,32 +1790,33 @@ int fd_cnx_handshake(struct cnxctx * conn, int mode, int algo, char * priority,
 	GNUTLS_TRACE( gnutls_handshake_set_timeout( conn->cc_tls_para.session, GNUTLS_DEFAULT_HANDSHAKE_TIMEOUT));
 	#endif /* GNUTLS_VERSION_310 */
 
+	/* Resume a previous session with this peer if possible (the multi-stream wrapper has its own mechanism) */
+	if (dtls || (conn->cc_sctp_para.pairs <= 1))
+		fd_tls_resume_prepare(conn);
+
 	/* Mark the connection as protected from here, so that the gnutls credentials will be freed */
 	fd_cnx_addstate(conn, CC_STATUS_TLS);
 
-	/* Handshake master session */
-	{
-		int ret;
+	return 0;
+}
 
-		CHECK_GNUTLS_DO( ret = gnutls_handshake(conn->cc_tls_para.session),
-			{
-				if (TRACE_BOOL(INFO)) {
-					fd_log_debug("TLS Handshake failed on socket %d (%s) : %s", conn->cc_socket, conn->cc_id, gnutls_strerror(ret));
-				}
-				fd_cnx_markerror(conn);
-				return EINVAL;
-			} );
+/* The master session handshake succeeded: check the peer, and start receiving */
+static int handshake_complete(struct cnxctx * conn, char * priority, void * alt_creds)
+{
+	int dtls = fd_cnx_may_dtls(conn);
 
-		#ifndef GNUTLS_VERSION_300
-		/* Now verify the remote credentials are valid -- only simple tests here */
-		CHECK_FCT_DO( fd_tls_verify_credentials(conn->cc_tls_para.session, conn, 1),
-			{
-				CHECK_GNUTLS_DO( gnutls_bye(conn->cc_tls_para.session, GNUTLS_SHUT_RDWR),  );
-				fd_cnx_markerror(conn);
-				return EINVAL;
-			});
-		#endif /* GNUTLS_VERSION_300 */
-	}
+	#ifndef GNUTLS_VERSION_300
+	/* Now verify the remote credentials are valid -- only simple tests here */
+	CHECK_FCT_DO( fd_tls_verify_credentials(conn->cc_tls_para.session, conn, 1),
+		{
+			CHECK_GNUTLS_DO( gnutls_bye(conn->cc_tls_para.session, GNUTLS_SHUT_RDWR),  );
+			fd_cnx_markerror(conn);
+			return EINVAL;
+		});
+	#endif /* GNUTLS_VERSION_300 */
+
+	if (dtls || (conn->cc_sctp_para.pairs <= 1))
+		fd_tls_resume_done(conn);
 
 	/* Multi-stream TLS: handshake other streams as well */
 	if ((!dtls) && (conn->cc_sctp_para.pairs > 1)) {
@@ -1739,6 +1844,131 @@ int fd_cnx_handshake(struct cnxctx * conn, int mode, int algo, char * priority,
 	return 0;
 }
 
+/* Handshake performed by the pool of threads (tls_handshake.c) */
+struct hs_async {
+	void (*cb)(struct cnxctx * conn, int ret, void * data);
+	void * data;
+};
+
+static void handshake_pooled(struct cnxctx * conn, int ret, void * data)
+{
+	struct hs_async * a = data;
+
+	if (ret == 0) {
+		/* Back to the blocking transport functions */
+		set_tls_transport(conn);
+		#ifdef GNUTLS_VERSION_310
+		GNUTLS_TRACE( gnutls_handshake_set_timeout( conn->cc_tls_para.session, GNUTLS_DEFAULT_HANDSHAKE_TIMEOUT));
+		#endif /* GNUTLS_VERSION_310 */
+		ret = handshake_complete(conn, NULL, NULL);
+	} else {
+		fd_cnx_markerror(conn);
+	}
+
+	(*a->cb)(conn, ret, a->data);
+	free(a);
+}
+
+/* Same as fd_cnx_handshake, but the handshake is performed by the pool of TLS handshake threads. cb is called from one of
+ these threads with the result (0 or an error code); it is not called if the function fails.
+ Returns ENOTSUP if the connection cannot use the pool (multi-stream SCTP, DTLS, or no pool), without changing the connection; 
+ EBUSY if too many handshakes are already in progress, in that case the caller should close the connection. */
+int fd_cnx_handshake_async(struct cnxctx * conn, int mode, int algo, char * priority, void * alt_creds, void (*cb)(struct cnxctx * conn, int ret, void * data), void * data)
+{
+	struct hs_async * a;
+	int ret;
+
+	TRACE_ENTRY( "%p %d %d %p %p %p %p", conn, mode, algo, priority, alt_creds, cb, data);
+	CHECK_PARAMS( conn && (!fd_cnx_teststate(conn, CC_STATUS_TLS)) && ( (mode == GNUTLS_CLIENT) || (mode == GNUTLS_SERVER) ) && (!conn->cc_loop) && cb );
+
+	ret = fd_tls_hs_reserve(conn);
+	if (ret)
+		return ret;
+
+	CHECK_MALLOC_DO( a = malloc(sizeof(struct hs_async)), { fd_tls_hs_release(); return ENOMEM; } );
+	a->cb = cb;
+	a->data = data;
+
+	CHECK_FCT_DO( ret = handshake_prepare(conn, mode, algo, priority, alt_creds), 
+		{
+			fd_tls_hs_release();
+			free(a);
+			return ret;
+		} );
+
+	CHECK_FCT_DO( ret = fd_tls_hs_submit(conn, handshake_pooled, a), 
+		{
+			free(a);
+			return ret;
+		} );
+
+	return 0;
+}
+
+/* Wait for a handshake performed by the pool */
+struct hs_sync {
+	pthread_mutex_t	lock;
+	pthread_cond_t	cond;
+	int		done;
+	int		ret;
+};
+
+static void handshake_sync(struct cnxctx * conn, int ret, void * data)
+{
+	struct hs_sync * s = data;
+	CHECK_POSIX_DO( pthread_mutex_lock(&s->lock), /* continue */ );
+	s->ret = ret;
+	s->done = 1;
+	CHECK_POSIX_DO( pthread_cond_signal(&s->cond), /* continue */ );
+	CHECK_POSIX_DO( pthread_mutex_unlock(&s->lock), /* continue */ );
+}
+
+/* TLS handshake a connection; no need to have called start_clear before. Reception is active if handhsake is successful */
+int fd_cnx_handshake(struct cnxctx * conn, int mode, int algo, char * priority, void * alt_creds)
+{
+	struct hs_sync s;
+	int ret;
+
+	TRACE_ENTRY( "%p %d %d %p %p", conn, mode, algo, priority, alt_creds);
+	CHECK_PARAMS( conn && (!fd_cnx_teststate(conn, CC_STATUS_TLS)) && ( (mode == GNUTLS_CLIENT) || (mode == GNUTLS_SERVER) ) && (!conn->cc_loop) );
+
+	/* Use the pool when possible. The wait is bounded by the timeout of the pool, so we do not allow cancellation meanwhile */
+	memset(&s, 0, sizeof(s));
+	CHECK_POSIX( pthread_mutex_init(&s.lock, NULL) );
+	CHECK_POSIX( pthread_cond_init(&s.cond, NULL) );
+	ret = fd_cnx_handshake_async(conn, mode, algo, priority, alt_creds, handshake_sync, &s);
+	if (ret == 0) {
+		int state;
+		CHECK_POSIX_DO( pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &state), /* continue */ );
+		CHECK_POSIX_DO( pthread_mutex_lock(&s.lock), /* continue */ );
+		while (!s.done) {
+			CHECK_POSIX_DO( pthread_cond_wait(&s.cond, &s.lock), break );
+		}
+		CHECK_POSIX_DO( pthread_mutex_unlock(&s.lock), /* continue */ );
+		CHECK_POSIX_DO( pthread_setcancelstate(state, NULL), /* continue */ );
+		ret = s.ret;
+	}
+	CHECK_POSIX_DO( pthread_cond_destroy(&s.cond), /* continue */ );
+	CHECK_POSIX_DO( pthread_mutex_destroy(&s.lock), /* continue */ );
+	if (ret != ENOTSUP)
+		return ret;
+
+	/* Otherwise, handshake in this thread */
+	CHECK_FCT( handshake_prepare(conn, mode, algo, priority, alt_creds) );
+
+	/* Handshake master session */
+	CHECK_GNUTLS_DO( ret = gnutls_handshake(conn->cc_tls_para.session),
+		{
+			if (TRACE_BOOL(INFO)) {
+				fd_log_debug("TLS Handshake failed on socket %d (%s) : %s", conn->cc_socket, conn->cc_id, gnutls_strerror(ret));
+			}
+			fd_cnx_markerror(conn);
+			return EINVAL;
+		} );
+
+	return handshake_complete(conn, priority, alt_creds);
+}
+
 /* Retrieve TLS credentials of the remote peer, after handshake */
 int fd_cnx_getcred(struct cnxctx * conn, const gnutls_datum_t **cert_list, unsigned int *cert_list_size)
 {
@@ -1769,7 +1999,7 @@ int fd_cnx_receive(struct cnxctx * conn, struct timespec * timeout, unsigned cha
 
 	TRACE_ENTRY("%p %p %p %p", conn, timeout, buf, len);
 	CHECK_PARAMS(conn && (conn->cc_socket > 0) && buf && len);
-	CHECK_PARAMS(conn->cc_rcvthr != (pthread_t)NULL);
+	CHECK_PARAMS((conn->cc_rcvthr != (pthread_t)NULL) || conn->cc_uring);
 	CHECK_PARAMS(conn->cc_alt == NULL);
 
 	/* Now, pull the first event */
@@ -1829,6 +2059,52 @@ int fd_cnx_recv_setaltfifo(struct cnxctx * conn, struct fifo * alt_fifo)
 	return ret;
 }
 
+/* The receivers waiting for their connection to be resumed. There are few of them at the same time, so they share one condition with state_lock. */
+static pthread_cond_t pause_cond = PTHREAD_COND_INITIALIZER;
+
+/* Stop reading new messages from the connection (pause != 0) or start again. The data then stays in the socket buffers, and the
+ remote peer eventually stops sending. The messages already received are delivered to the target queue as usual. */
+void fd_cnx_recv_pause(struct cnxctx * conn, int pause)
+{
+	int changed;
+	
+	TRACE_ENTRY( "%p %d", conn, pause );
+	CHECK_PARAMS_DO( conn, return );
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&state_lock), { ASSERT(0); } );
+	changed = (conn->cc_rcv_paused != !!pause);
+	conn->cc_rcv_paused = !!pause;
+	if (changed && !pause) {
+		CHECK_POSIX_DO( pthread_cond_broadcast(&pause_cond), );
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&state_lock), { ASSERT(0); } );
+	
+	if (!changed)
+		return;
+	
+	TRACE_DEBUG(FULL, "Reception %s on connection %s", pause ? "paused" : "resumed", conn->cc_id);
+	
+#ifdef USE_IO_URING
+	/* The io_uring thread is shared, it does not wait: the receive request is cancelled instead, and armed again on resume */
+	if (conn->cc_uring)
+		fd_uring_pause(conn, pause);
+#endif /* USE_IO_URING */
+}
+
+/* Called by the receiver threads before reading the next message on the connection: wait while the reception is paused */
+void fd_cnx_recv_wait(struct cnxctx * conn)
+{
+	if (!__atomic_load_n(&conn->cc_rcv_paused, __ATOMIC_RELAXED))
+		return;
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&state_lock), { ASSERT(0); } );
+	pthread_cleanup_push( fd_cleanup_mutex, &state_lock );
+	while (conn->cc_rcv_paused) {
+		CHECK_POSIX_DO( pthread_cond_wait(&pause_cond, &state_lock), break );
+	}
+	pthread_cleanup_pop( 1 );
+}
+
 /* Send function when no multi-stream is involved, or sending on stream #0 (send() always use stream 0)*/
 static int send_simple(struct cnxctx * conn, unsigned char * buf, size_t len)
 {
@@ -1927,6 +2203,47 @@ int fd_cnx_send(struct cnxctx * conn, unsigned char * buf, size_t len)
 	return 0;
 }
 
+/* Send several messages in order. On TCP connections in clear, they are passed together to the kernel. */
+int fd_cnx_send_batch(struct cnxctx * conn, struct iovec * iov, int iovcnt)
+{
+	int i = 0;
+
+	TRACE_ENTRY("%p %p %d", conn, iov, iovcnt);
+
+	CHECK_PARAMS(conn && (conn->cc_socket > 0) && (! fd_cnx_teststate(conn, CC_STATUS_ERROR)) && iov && (iovcnt > 0));
+
+	if ((conn->cc_proto != IPPROTO_TCP) || fd_cnx_teststate(conn, CC_STATUS_TLS)) {
+		/* The messages are sent one by one */
+		for (i = 0; i < iovcnt; i++) {
+			CHECK_FCT( fd_cnx_send(conn, iov[i].iov_base, iov[i].iov_len) );
+		}
+		return 0;
+	}
+
+	TRACE_DEBUG(FULL, "Sending %d messages on connection %s", iovcnt, conn->cc_id);
+
+	while (i < iovcnt) {
+		ssize_t ret;
+		CHECK_SYS_DO( ret = fd_cnx_s_sendv(conn, iov + i, iovcnt - i), );
+		if (ret <= 0)
+			return ENOTCONN;
+
+		/* Skip the messages that were completely sent */
+		while ((i < iovcnt) && ((size_t)ret >= iov[i].iov_len)) {
+			ret -= iov[i].iov_len;
+			i++;
+		}
+
+		/* And complete the one that was partially sent, if any */
+		if (ret) {
+			CHECK_FCT( send_simple(conn, (unsigned char *)iov[i].iov_base + ret, iov[i].iov_len - ret) );
+			i++;
+		}
+	}
+
+	return 0;
+}
+
 
 /**************************************/
 /*     Destruction of connection      */
@@ -1940,6 +2257,9 @@ void fd_cnx_destroy(struct cnxctx * conn)
 	CHECK_PARAMS_DO(conn, return);
 
 	fd_cnx_addstate(conn, CC_STATUS_CLOSING);
+	
+	/* The receiver must read until the end of the connection */
+	fd_cnx_recv_pause(conn, 0);
 
 	/* Initiate shutdown of the TLS session(s): call gnutls_bye(WR), then read until error */
 	if (fd_cnx_teststate(conn, CC_STATUS_TLS)) {
@@ -2006,6 +2326,18 @@ void fd_cnx_destroy(struct cnxctx * conn)
 	/* Terminate the thread in case it is not done yet -- is there any such case left ?*/
 	CHECK_FCT_DO( fd_thr_term(&conn->cc_rcvthr), /* continue */ );
 
+#ifdef USE_IO_URING
+	/* Or stop receiving with io_uring */
+	if (conn->cc_uring)
+		fd_uring_stop(conn);
+#endif /* USE_IO_URING */
+
+#ifndef DISABLE_SCTP
+	/* Free the receive buffers of the association */
+	if (conn->cc_proto == IPPROTO_SCTP)
+		fd_sctp_rcvbuf_free(conn);
+#endif /* DISABLE_SCTP */
+
 	/* Shut the connection down */
 	if (conn->cc_socket > 0) {
 		shutdown(conn->cc_socket, SHUT_RDWR);
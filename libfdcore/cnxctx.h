@@ -40,6 +40,12 @@
 
 /* Maximum time we allow a connection to be blocked because of head-of-the-line buffers. After this delay, connection is considered in error. */
 #define MAX_HOTL_BLOCKING_TIME	1000	/* ms */
+#define CNX_RCVBUF_SIZE		(64 * 1024)	/* Size of the receive buffer of TCP/noTLS connections */
+
+/* The maximum size of Diameter message we accept to receive (<= 2^24) to avoid too big mallocs in case of trashed headers */
+#ifndef DIAMETER_MSG_SIZE_MAX
+#define DIAMETER_MSG_SIZE_MAX	65535	/* in bytes */
+#endif /* DIAMETER_MSG_SIZE_MAX */
 
 /* The connection context structure */
 struct cnxctx {
@@ -62,6 +68,14 @@ struct cnxctx {
 	
 	struct fifo *	cc_incoming;	/* FIFO queue of events received on the connection, FDEVP_CNX_* */
 	struct fifo *	cc_alt;		/* alternate fifo to send FDEVP_CNX_* events to. */
+	
+	/* Statistics, only updated by the receiver thread (read without lock) */
+	unsigned long long cc_rcv_msgs;	/* Number of messages received */
+	unsigned long long cc_rcv_calls;/* Number of recv calls that returned data for these messages */
+
+	struct uring_cnx * cc_uring;	/* If not NULL, the messages are received by the io_uring thread instead of cc_rcvthr (uring.c) */
+	
+	int		cc_rcv_paused;	/* The reception is paused because the receiver of the messages is over its quota (fd_cnx_recv_pause) */
 
 	/* If cc_tls == true */
 	struct {
@@ -79,6 +93,7 @@ struct cnxctx {
 		uint16_t next;		/* # of stream the next message will be sent to */
 		int	 unordered;	/* boolean telling if use of streams > 0 is permitted */
 	} 		cc_sctp_para;
+	struct sctp_rcvbuf * cc_sctp_rcv;	/* The buffers of fd_sctp_recvmeta, allocated on first use */
 
 	/* If both conditions */
 	struct {
@@ -97,7 +112,26 @@ struct fifo * fd_cnx_target_queue(struct cnxctx * conn);
 
 /* Socket */
 ssize_t fd_cnx_s_recv(struct cnxctx * conn, void *buffer, size_t length);
+void fd_cnx_recv_wait(struct cnxctx * conn);
 void fd_cnx_s_setto(int sock);
+uint8_t * fd_cnx_alloc_msg_buffer(size_t expected_len, struct fd_msg_pmdl ** pmdl);
+
+/* TLS sessions resumption */
+void fd_tls_resume_prepare(struct cnxctx * conn);
+void fd_tls_resume_done(struct cnxctx * conn);
+
+/* Pool of threads for the TLS handshakes */
+int  fd_tls_hs_reserve(struct cnxctx * conn);
+void fd_tls_hs_release(void);
+int  fd_tls_hs_submit(struct cnxctx * conn, void (*cb)(struct cnxctx * conn, int ret, void * data), void * data);
+
+#ifdef USE_IO_URING
+/* io_uring */
+int fd_uring_start(struct cnxctx * conn);
+void fd_uring_stop(struct cnxctx * conn);
+void fd_uring_pause(struct cnxctx * conn, int pause);
+ssize_t fd_uring_sendv(struct cnxctx * conn, const struct iovec * iov, int iovcnt);
+#endif /* USE_IO_URING */
 
 /* TLS */
 int fd_tls_rcvthr_core(struct cnxctx * conn, gnutls_session_t session);
@@ -123,8 +157,18 @@ int fd_sctp_get_remote_ep(int sock, struct fd_list * list);
 int fd_sctp_get_str_info( int sock, uint16_t *in, uint16_t *out, sSS *primary );
 ssize_t fd_sctp_sendstrv(struct cnxctx * conn, uint16_t strid, const struct iovec *iov, int iovcnt);
 int fd_sctp_recvmeta(struct cnxctx * conn, uint16_t * strid, uint8_t ** buf, size_t * len, int *event);
+void fd_sctp_rcvbuf_free(struct cnxctx * conn);
 
 /* TLS over SCTP (multi-stream) */
+enum sctp3436_dec_state {
+	DEC_NONE = 0,	/* Not deciphered by the workers yet (handshake in progress) */
+	DEC_IDLE,	/* Waiting for data from the demuxer */
+	DEC_QUEUED,	/* Data available, waiting for a worker */
+	DEC_RUNNING,	/* A worker is deciphering the records */
+	DEC_AGAIN,	/* Same, and more data was received meanwhile */
+	DEC_DONE	/* The session is terminated */
+};
+
 struct sctp3436_ctx {
 	struct cnxctx 	*parent; 	/* for info such as socket, conn name, event list */
 	uint16_t	 strid;		/* Stream # of this session */
@@ -134,8 +178,15 @@ struct sctp3436_ctx {
 		size_t   bufsz;
 		size_t   offset;
 	} 		 partial;	/* If the pull function did not read the full content of first message in raw, it stores it here for next read call. */
-	pthread_t	 thr;		/* Thread to decrypt raw data in this pair of streams */
+	pthread_t	 thr;		/* Thread for the resumed handshake on this pair of streams */
 	gnutls_session_t session;	/* TLS context using this pair of streams -- except if strid == 0, in that case session is outside the array */
+	struct fd_list	 dec_chain;	/* link in the list of contexts waiting for a decipher worker */
+	enum sctp3436_dec_state dec_state; /* protected by the lock of the workers */
+	struct {
+		uint8_t  header[4];
+		size_t	 received;
+		struct fd_cnx_rcvdata rcv_data;
+	}		 dec;		/* The message being rebuilt from the deciphered records, between calls of the workers */
 };
 
 int fd_sctp3436_init(struct cnxctx * conn);
@@ -58,8 +58,15 @@ int fd_conf_init()
 	fd_g_config->cnf_port     = DIAMETER_PORT;
 	fd_g_config->cnf_port_tls = DIAMETER_SECURE_PORT;
 	fd_g_config->cnf_sctp_str = 30;
+	fd_g_config->cnf_thr_3436 = 4;
 	fd_g_config->cnf_thr_srv  = 5;
+	fd_g_config->cnf_thr_hs   = sysconf(_SC_NPROCESSORS_ONLN);
+	if (fd_g_config->cnf_thr_hs < 1)
+		fd_g_config->cnf_thr_hs = 1;
+	fd_g_config->cnf_hs_max   = 256;
 	fd_g_config->cnf_dispthr  = 4;
+	fd_g_config->cnf_shards   = 1;
+	fd_g_config->cnf_rcv_quota = 64;
 	fd_list_init(&fd_g_config->cnf_endpoints, NULL);
 	fd_list_init(&fd_g_config->cnf_apps, NULL);
 	#ifdef DISABLE_SCTP
@@ -98,8 +105,18 @@ DECLARE_FD_DUMP_PROTOTYPE(fd_conf_dump)
 		CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Local SCTP TLS port .... : %hu\n", fd_g_config->cnf_port_3436), return NULL);
 	}
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Number of SCTP streams . : %hu\n", fd_g_config->cnf_sctp_str), return NULL);
+	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Number of TLS/SCTP thr . : %hu\n", fd_g_config->cnf_thr_3436), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Number of clients thr .. : %d\n", fd_g_config->cnf_thr_srv), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Number of app threads .. : %hu\n", fd_g_config->cnf_dispthr), return NULL);
+	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Number of shards ....... : %hu\n", fd_g_config->cnf_shards), return NULL);
+	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Ingress quota per peer . : %hu%s\n", fd_g_config->cnf_rcv_quota, fd_g_config->cnf_rcv_quota ? "" : " (no limit)"), return NULL);
+	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Number of decoder thr .. : %hu%s\n", fd_g_config->cnf_dec_thr, fd_g_config->cnf_dec_thr ? "" : " (decoded by the PSM)"), return NULL);
+	if (fd_g_config->cnf_rtcache_ttl) {
+		CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Routing cache TTL ...... : %u ms\n", fd_g_config->cnf_rtcache_ttl), return NULL);
+	} else {
+		CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Routing cache TTL ...... : (disabled)\n"), return NULL);
+	}
+	CHECK_MALLOC_DO( fd_thr_affinity_dump( FD_DUMP_STD_PARAMS ), return NULL);
 	if (FD_IS_LIST_EMPTY(&fd_g_config->cnf_endpoints)) {
 		CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  Local endpoints ........ : Default (use all available)\n"), return NULL);
 	} else {
@@ -125,6 +142,8 @@ DECLARE_FD_DUMP_PROTOTYPE(fd_conf_dump)
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "\n  Flags : - IP ........... : %s\n", fd_g_config->cnf_flags.no_ip4 ? "DISABLED" : "Enabled"), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - IPv6 ......... : %s\n", fd_g_config->cnf_flags.no_ip6 ? "DISABLED" : "Enabled"), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - Relay app .... : %s\n", fd_g_config->cnf_flags.no_fwd ? "DISABLED" : "Enabled"), return NULL);
+	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - Route by realm : %s\n", fd_g_config->cnf_flags.rt_realm ? "Enabled" : "DISABLED"), return NULL);
+	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - Inline ans. cb : %s\n", fd_g_config->cnf_flags.inl_ans ? "Enabled" : "DISABLED"), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - TCP .......... : %s\n", fd_g_config->cnf_flags.no_tcp ? "DISABLED" : "Enabled"), return NULL);
 	#ifdef DISABLE_SCTP
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - SCTP ......... : DISABLED (at compilation)\n"), return NULL);
@@ -133,12 +152,29 @@ DECLARE_FD_DUMP_PROTOTYPE(fd_conf_dump)
 	#endif /* DISABLE_SCTP */
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - Pref. proto .. : %s\n", fd_g_config->cnf_flags.pr_tcp ? "TCP" : "SCTP"), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - TLS method ... : %s\n", fd_g_config->cnf_flags.tls_alg ? "INBAND" : "Separate port"), return NULL);
+	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - io_uring ..... : %s\n", fd_g_config->cnf_flags.io_uring ? "Enabled" : "DISABLED"), return NULL);
 	
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "  TLS :   - Certificate .. : %s\n", fd_g_config->cnf_sec_data.cert_file ?: "(NONE)"), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - Private key .. : %s\n", fd_g_config->cnf_sec_data.key_file ?: "(NONE)"), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - CA (trust) ... : %s (%d certs)\n", fd_g_config->cnf_sec_data.ca_file ?: "(none)", fd_g_config->cnf_sec_data.ca_file_nr), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - CRL .......... : %s\n", fd_g_config->cnf_sec_data.crl_file ?: "(none)"), return NULL);
 	CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - Priority ..... : %s\n", fd_g_config->cnf_sec_data.prio_string ?: "(default: '" GNUTLS_DEFAULT_PRIORITY "')"), return NULL);
+	if (fd_g_config->cnf_flags.no_tlsres) {
+		CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - Resumption . : DISABLED\n"), return NULL);
+	} else {
+		struct fd_tls_resume_stats st;
+		memset(&st, 0, sizeof(st));
+		fd_tls_resume_getstats(&st);
+		CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - Resumption . : server %llu resumed / %llu full, client %llu resumed / %llu full\n",
+					st.srv_hits, st.srv_misses, st.cli_hits, st.cli_misses), return NULL);
+	}
+	{
+		struct fd_tls_hs_stats st;
+		fd_tls_hs_getstats(&st);
+		CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - Handshakes . : %d thr, %d/%d active, %llu ok (avg %llums), %llu failed, %llu timed out, %llu rejected\n",
+					fd_g_config->cnf_thr_hs, st.active, fd_g_config->cnf_hs_max, st.succeeded, st.succeeded ? st.total_ms / st.succeeded : 0,
+					st.failed, st.timedout, st.rejected), return NULL);
+	}
 	if (fd_g_config->cnf_sec_data.dh_file) {
 		CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, "          - DH file ...... : %s\n", fd_g_config->cnf_sec_data.dh_file), return NULL);
 	} else {
@@ -604,6 +640,8 @@ GCC_DIAG_ON("-Wdeprecated-declarations")
 /* Destroy contents of fd_g_config structure */
 int fd_conf_deinit()
 {
+	int c;
+	
 	TRACE_ENTRY();
 	
 	if (!fd_g_config)
@@ -624,6 +662,12 @@ int fd_conf_deinit()
 	free(fd_g_config->cnf_sec_data.prio_string); fd_g_config->cnf_sec_data.prio_string = NULL;
 	free(fd_g_config->cnf_sec_data.dh_file); fd_g_config->cnf_sec_data.dh_file = NULL;
 	
+	/* Free the lists of CPUs, after the thread of the timers stops using them */
+	CHECK_FCT_DO( fd_timers_thr_hook(NULL), );
+	for (c = 0; c < FD_THR_CLASSES; c++) {
+		free(fd_g_config->cnf_cpus[c]); fd_g_config->cnf_cpus[c] = NULL;
+	}
+	
 	/* Destroy dictionary */
 	CHECK_FCT_DO( fd_dict_fini(&fd_g_config->cnf_dict), );
 	
@@ -100,9 +100,15 @@ static void core_shutdown(void)
 	fd_log_threadname("fD Core Shutdown");
 	
 	/* cleanups */
+	fd_tls_hs_fini(); /* Abort the TLS handshakes in progress, the servers are still valid for the callbacks */
 	CHECK_FCT_DO( fd_servers_stop(), /* Stop accepting new connections */ );
 	CHECK_FCT_DO( fd_rtdisp_cleanstop(), /* Stop dispatch thread(s) after a clean loop if possible */ );
+	CHECK_FCT_DO( fd_in_fini(), /* Stop passing the received messages to the routing, the peers will not wait for it */ );
 	CHECK_FCT_DO( fd_peer_fini(), /* Stop all connections */ );
+	fd_tls_resume_fini();
+#ifdef USE_IO_URING
+	fd_uring_fini(); /* All the connections are closed now */
+#endif /* USE_IO_URING */
 	CHECK_FCT_DO( fd_rtdisp_fini(), /* Stop routing threads and destroy routing queues */ );
 	
 	CHECK_FCT_DO( fd_ext_term(), /* Cleanup all extensions */ );
@@ -243,6 +249,7 @@ static int fd_core_parseconf_int(const char * conffile)
 		fd_g_config->cnf_file = conffile; /* otherwise, we use the default name */
 	
 	CHECK_FCT( fd_conf_parse() );
+	CHECK_FCT( fd_thr_affinity_init() );
 	
 	/* The following module use data from the configuration */
 	CHECK_FCT( fd_rtdisp_init() );
@@ -296,6 +303,16 @@ int fd_core_waitstartcomplete(void)
 /* Start the server & client threads */
 static int fd_core_start_int(void)
 {
+#ifdef USE_IO_URING
+	/* The connections use the threads if the ring cannot be created */
+	if (fd_g_config->cnf_flags.io_uring) {
+		CHECK_FCT_DO( fd_uring_init(), /* continue */ );
+	}
+	
+#endif /* USE_IO_URING */
+	/* The TLS handshakes are performed by the callers if the pool cannot be started */
+	CHECK_FCT_DO( fd_tls_hs_init(), /* continue */ );
+	
 	/* Start server threads */ 
 	CHECK_FCT( fd_servers_start() );
 	
@@ -48,6 +48,18 @@ int fd_event_send(struct fifo *queue, int code, size_t datasz, void * data)
 	return 0;
 }
 
+/* Same, but never wait for room in the queue. For threads shared between connections, which must not stall on one of them. */
+int fd_event_send_noblock(struct fifo *queue, int code, size_t datasz, void * data)
+{
+	struct fd_event * ev;
+	CHECK_MALLOC( ev = malloc(sizeof(struct fd_event)) );
+	ev->code = code;
+	ev->size = datasz;
+	ev->data = data;
+	CHECK_FCT_DO( fd_fifo_post_noblock(queue, (void *)&ev), { free(ev); return EINVAL; } );
+	return 0;
+}
+
 int fd_event_get(struct fifo *queue, int *code, size_t *datasz, void ** data)
 {
 	struct fd_event * ev;
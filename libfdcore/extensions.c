@@ -152,7 +152,7 @@ static int check_dependencies(struct fd_ext_info * ext)
 }
 
 /* Load all extensions in the list */
-int fd_ext_load()
+static int ext_load_all()
 {
 	int ret;
 	int (*fd_ext_init)(int, int, char *) = NULL;
@@ -249,12 +249,34 @@ int fd_ext_load()
 		}
 	}
 	
-	LOG_N("All extensions loaded.");
-	
 	/* We have finished. */
 	return 0;
 }
 
+/* Load the extensions. Most of the time is spent in the dictionary extensions, the objects they create are sorted once at the end */
+int fd_ext_load()
+{
+	int ret;
+	struct timespec start, end, diff;
+	
+	TRACE_ENTRY();
+	
+	CHECK_SYS( clock_gettime(CLOCK_REALTIME, &start) );
+	CHECK_FCT( fd_dict_bulk_begin(fd_g_config->cnf_dict) );
+	
+	ret = ext_load_all();
+	
+	CHECK_FCT( fd_dict_bulk_end(fd_g_config->cnf_dict) );
+	if (ret)
+		return ret;
+	
+	CHECK_SYS( clock_gettime(CLOCK_REALTIME, &end) );
+	TS_DIFFERENCE( &diff, &start, &end );
+	LOG_N("All extensions loaded (%ld.%03ld s).", (long)diff.tv_sec, diff.tv_nsec / 1000000);
+	
+	return 0;
+}
+
 /* Now unload the extensions and free the memory */
 int fd_ext_term( void ) 
 {
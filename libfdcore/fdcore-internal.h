@@ -103,13 +103,57 @@ extern struct dict_object * fd_dict_cmd_DWR; /* Device-Watchdog-Request */
 extern struct dict_object * fd_dict_avp_DC;  /* Disconnect-Cause */
 extern struct dict_object * fd_dict_cmd_DPR; /* Disconnect-Peer-Request */
 
-/* Global message queues */
-extern struct fifo * fd_g_incoming; /* all messages received from other peers, except local messages (CER, ...) */
-extern struct fifo * fd_g_outgoing; /* messages to be sent to other peers on the network following routing procedure */
-extern struct fifo * fd_g_local; /* messages to be handled to local extensions */
-/* Message queues */
+/* Message queues. When several routing shards are configured (cnf_shards), each shard has its own queues and routing / dispatch
+ threads; a message is processed in the shard given by fd_shard_of. The global queues are those of the shard 0. */
+#define FD_SHARDS_MAX	64
+struct fd_shard {
+	struct fifo * incoming; /* all messages received from other peers, except local messages (CER, ...) */
+	struct fifo * outgoing; /* messages to be sent to other peers on the network following routing procedure */
+	struct fifo * local; /* messages to be handled to local extensions */
+};
+extern struct fd_shard fd_g_shards[FD_SHARDS_MAX];
+#define fd_g_incoming	(fd_g_shards[0].incoming)
+#define fd_g_outgoing	(fd_g_shards[0].outgoing)
+#define fd_g_local	(fd_g_shards[0].local)
 int fd_queues_init(void);
+int fd_queues_shards_init(void);
 int fd_queues_fini(struct fifo ** queue);
+int fd_shard_of(struct msg * msg);
+#define FD_SHARD( _msg ) (&fd_g_shards[fd_shard_of(_msg)])
+
+/* Placement of the threads on the CPUs (affinity.c) */
+int fd_thr_class_byname(const char * name);
+int fd_thr_cpus_check(const char * list);
+void fd_thr_bind(int cls, int shard);
+int fd_thr_affinity_init(void);
+DECLARE_FD_DUMP_PROTOTYPE(fd_thr_affinity_dump);
+
+/* Resumption of TLS sessions across reconnections (tls_resume.c) */
+struct fd_tls_resume_stats {
+	unsigned long long srv_hits;	/* handshakes of incoming connections that resumed a session */
+	unsigned long long srv_misses;	/* full handshakes of incoming connections */
+	unsigned long long cli_hits;	/* same for the connections we initiated */
+	unsigned long long cli_misses;
+};
+void fd_tls_resume_getstats(struct fd_tls_resume_stats * stats);
+void fd_tls_resume_fini(void);
+
+/* Pool of threads for the TLS handshakes (tls_handshake.c) */
+struct fd_tls_hs_stats {
+	unsigned long long started;	/* handshakes submitted to the pool */
+	unsigned long long succeeded;
+	unsigned long long failed;	/* including the ones canceled at shutdown */
+	unsigned long long timedout;
+	unsigned long long rejected;	/* connections closed because cnf_hs_max handshakes were in progress */
+	unsigned long long total_ms;	/* cumulated duration of the successful handshakes */
+	int		   active;	/* handshakes in progress */
+};
+int  fd_tls_hs_init(void);
+void fd_tls_hs_getstats(struct fd_tls_hs_stats * stats);
+void fd_tls_hs_fini(void);
+
+/* Post an event without waiting for room in the queue (see fd_fifo_post_noblock) */
+int fd_event_send_noblock(struct fifo *queue, int code, size_t datasz, void * data);
 
 /* Trigged events */
 int fd_event_trig_call_cb(int trigger_val);
@@ -123,17 +167,19 @@ int fd_rtdisp_init(void);
 int fd_rtdisp_cleanstop(void);
 int fd_rtdisp_fini(void);
 int fd_rtdisp_cleanup(void);
+int fd_rtdisp_answer(struct msg ** pmsg);
+struct fifo * fd_rtdisp_queue(struct msg * msg);
 
 /* Sentinel for the sent requests list */
 struct sr_list {
 	struct fd_list 	srs; /* requests ordered by hop-by-hop id */
 	struct fd_list  exp; /* requests that have a timeout set, ordered by timeout */
-	long            cnt; /* number of requests in the srs list */
+	long            cnt; /* number of requests in the srs list. Modified with the mutex, read without it (__atomic_load_n) */
 	long		cnt_lost; /* number of requests that have not been answered in time. 
 				     It is decremented when an unexpected answer is received, so this may not be accurate. */
 	pthread_mutex_t	mtx; /* mutex to protect these lists */
-	pthread_cond_t  cnd; /* cond var used by the thread that handles timeouts */
-	pthread_t       thr; /* the thread that handles timeouts (expirecb called in separate forked threads) */
+	struct fd_timer tmr; /* armed at the timeout of the first request in exp, see fd_p_sr_expiry */
+	uint32_t	lat; /* average delay of the answers in microseconds, 0 before the first one. Also read without the mutex */
 };
 
 /* Peers */
@@ -146,6 +192,9 @@ struct fd_peer { /* The "real" definition of the peer structure */
 	int		 p_eyec;
 	#define EYEC_PEER	0x373C9336
 	
+	/* References: the peers list, and the snapshots of the active peers (fd_peers_snapshot_update) */
+	uint32_t	 p_refcount;
+	
 	/* Origin of this peer object, for debug */
 	char		*p_dbgorig;
 	
@@ -155,8 +204,8 @@ struct fd_peer { /* The "real" definition of the peer structure */
 	
 	/* Chaining in peers sublists */
 	struct fd_list	 p_actives;	/* list of peers in the STATE_OPEN state -- used by routing */
-	struct fd_list	 p_expiry; 	/* list of expiring peers, ordered by their timeout value */
-	struct timespec	 p_exp_timer;	/* Timestamp where the peer will expire; updated each time activity is seen on the peer (except DW) */
+	struct fd_timer	 p_exp_timer;	/* Armed at the date the peer will expire, if there was no activity since it was computed */
+	time_t		 p_activity;	/* Time of the last routable message received (fd_p_expi_activity), read when p_exp_timer expires and on Tw timeout */
 	
 	/* Some flags influencing the peer state machine */
 	struct {
@@ -176,6 +225,19 @@ struct fd_peer { /* The "real" definition of the peer structure */
 	pthread_t	 p_psm;
 	struct timespec	 p_psm_timer;
 	
+	/* Routable messages received, waiting to be passed to the routing (p_in.c) */
+	struct fifo	*p_ingress;	/* NULL if IngressQuota is 0 */
+	struct fd_list	 p_in_ready;	/* link in the list of peers to be served by the ingress threads */
+	int		 p_in_busy;	/* an ingress thread is moving the messages of this peer */
+	int		 p_in_detached;	/* the PSM is terminated, the ingress threads do not serve the peer anymore */
+	
+	/* Routable messages received, being decoded by the decoder threads before p_ingress (p_in.c). Protected by the decoders lock */
+	struct fd_list	 p_dec_jobs;	/* in reception order */
+	int		 p_dec_pending;	/* number of items in p_dec_jobs, counted in the ingress quota */
+	int		 p_dec_delivering; /* a decoder thread is passing the decoded messages of this peer to fd_in_post */
+	int		 p_dec_paused;	/* the reception was paused by fd_in_decode, it is resumed at half of the quota */
+	int		 p_dec_detached;/* the PSM is terminated, it decodes the remaining messages itself */
+	
 	/* Outgoing message queue, and thread managing sending the messages */
 	struct fifo	*p_tosend;
 	pthread_t	 p_outthr;
@@ -188,7 +250,7 @@ struct fd_peer { /* The "real" definition of the peer structure */
 	struct fifo	*p_tofailover;
 	
 	/* Pending received requests not yet answered (count only) */
-	long		 p_reqin_count; /* We use p_state_mtx to protect this value */
+	long		 p_reqin_count; /* Changed and read with atomic operations only, fd_peer_get_load reads it without lock */
 	
 	/* Data for transitional states before the peer is in OPEN state */
 	struct {
@@ -245,9 +307,12 @@ enum {
 	/* The PSM state is expired */
 	,FDEVP_PSM_TIMEOUT
 	
+	/* The ingress queue of the peer is back under its quota, the reception can be resumed */
+	,FDEVP_INGRESS_RESUME
+	
 };
 #define CHECK_PEVENT( _e ) \
-	(((int)(_e) >= FDEVP_TERMINATE) && ((int)(_e) <= FDEVP_PSM_TIMEOUT))
+	(((int)(_e) >= FDEVP_TERMINATE) && ((int)(_e) <= FDEVP_INGRESS_RESUME))
 /* The following macro is actually called in p_psm.c -- another solution would be to declare it static inline */
 #define DECLARE_PEV_STR()				\
 const char * fd_pev_str(int event)			\
@@ -261,6 +326,7 @@ const char * fd_pev_str(int event)			\
 		case_str(FDEVP_CNX_ESTABLISHED);	\
 		case_str(FDEVP_CNX_FAILED);		\
 		case_str(FDEVP_PSM_TIMEOUT);		\
+		case_str(FDEVP_INGRESS_RESUME);		\
 	}						\
 	TRACE_DEBUG(FULL, "Unknown event : %d", event);	\
 	return "Unknown event";				\
@@ -287,6 +353,8 @@ void fd_peer_failover_msg(struct fd_peer * peer);
 int fd_p_expi_init(void);
 int fd_p_expi_fini(void);
 int fd_p_expi_update(struct fd_peer * peer );
+void fd_p_expi_activity(struct fd_peer * peer );
+void fd_p_expi_timeout(void * arg);
 
 /* Peer state machine */
 int  fd_psm_start();
@@ -297,6 +365,34 @@ void fd_psm_next_timeout(struct fd_peer * peer, int add_random, int delay);
 int fd_psm_change_state(struct fd_peer * peer, int new_state);
 void fd_psm_cleanup(struct fd_peer * peer, int terminate);
 
+/* Routing decisions cache */
+struct fd_rt_cache_key {
+	uint32_t	appid;		/* Application-Id and Command-Code of the request */
+	uint32_t	cmd;
+	uint8_t *	dr;		/* Destination-Realm, may be NULL */
+	size_t		drlen;
+	uint8_t *	dh;		/* Destination-Host, may be NULL */
+	size_t		dhlen;
+	uint64_t	cands;		/* signature of the list of candidates, i.e. of the peers after the Route-Record ones are removed */
+};
+int  fd_rt_cache_init(void);
+void fd_rt_cache_fini(void);
+void fd_rt_cache_flush(void);
+int  fd_rt_cache_get(struct fd_rt_cache_key * key, uint64_t version, int * scores, int nb);
+int  fd_rt_cache_put(struct fd_rt_cache_key * key, uint64_t version, int * scores, int nb);
+void fd_rt_cache_getstats(unsigned long long * hits, unsigned long long * misses);
+
+/* Peer in */
+int  fd_in_init(void);
+int  fd_in_fini(void);
+int  fd_in_peer_init(struct fd_peer * peer);
+void fd_in_peer_fini(struct fd_peer * peer);
+int  fd_in_post(struct fd_peer * peer, struct msg ** msg);
+int  fd_in_routable(uint8_t * buf, size_t len);
+int  fd_in_decode(struct fd_peer * peer, uint8_t * buf, size_t len);
+void fd_in_resume(struct fd_peer * peer);
+void fd_in_detach(struct fd_peer * peer);
+
 /* Peer out */
 int fd_out_send(struct msg ** msg, struct cnxctx * cnx, struct fd_peer * peer, int update_reqin_cnt);
 int fd_out_start(struct fd_peer * peer);
@@ -309,6 +405,7 @@ void fd_p_cnx_abort(struct fd_peer * peer, int cleanup_all);
 /* Peer sent requests cache */
 int fd_p_sr_store(struct sr_list * srlist, struct msg **req, uint32_t *hbhloc, uint32_t hbh_restore);
 int fd_p_sr_fetch(struct sr_list * srlist, uint32_t hbh, struct msg **req);
+void fd_p_sr_expiry(void * arg);
 int fd_p_sr_start(struct sr_list * srlist);
 int fd_p_sr_stop(struct sr_list * srlist);
 void fd_p_sr_failover(struct sr_list * srlist);
@@ -330,6 +427,22 @@ int fd_p_dp_newdelay(struct fd_peer * peer);
 extern struct fd_list fd_g_activ_peers;
 extern pthread_rwlock_t fd_g_activ_peers_rw; /* protect the list */
 
+/* Immutable copy of fd_g_activ_peers, published each time a peer enters or leaves the OPEN state, used by the routing */
+struct fd_peers_snapshot {
+	uint32_t		refcount;	/* released with fd_peers_snapshot_put */
+	uint64_t		version;	/* incremented at each publication */
+	int			nb;		/* number of peers */
+	struct rtd_candidate **	by_host;	/* the nb peers ordered by diamid, case-insensitive (see fd_peers_snapshot_select) */
+	struct rtd_candidate **	by_realm;	/* the nb peers ordered by realm, case-insensitive */
+	struct rtd_candidate **	any;		/* the nb_any peers that are candidates for any realm: relays and Default_Route peers */
+	int			nb_any;
+	struct rtd_candidate	peers[];	/* ordered by diamid like fd_g_activ_peers, the indexes and strings are stored after the array */
+};
+int  fd_peers_snapshot_update(void); /* called with fd_g_activ_peers_rw write-locked */
+struct fd_peers_snapshot * fd_peers_snapshot_get(void);
+void fd_peers_snapshot_put(struct fd_peers_snapshot * snap);
+int  fd_peers_snapshot_select(struct fd_peers_snapshot * snap, uint8_t * host, size_t hostlen, uint8_t * realm, size_t realmlen, struct rtd_candidate * sel, int * nb);
+
 
 /* Server sockets */
 int  fd_servers_start();
@@ -345,9 +458,11 @@ struct cnxctx * fd_cnx_cli_connect_sctp(int no_ip6, uint16_t port, struct fd_lis
 int             fd_cnx_start_clear(struct cnxctx * conn, int loop);
 void		fd_cnx_sethostname(struct cnxctx * conn, DiamId_t hn);
 int		fd_cnx_proto_info(struct cnxctx * conn, char * buf, size_t len);
+int		fd_cnx_rcv_stats(struct cnxctx * conn, unsigned long long * msgs, unsigned long long * calls);
 #define ALGO_HANDSHAKE_DEFAULT	0 /* TLS for TCP, DTLS for SCTP */
 #define ALGO_HANDSHAKE_3436	1 /* For TLS for SCTP also */
 int             fd_cnx_handshake(struct cnxctx * conn, int mode, int algo, char * priority, void * alt_creds);
+int             fd_cnx_handshake_async(struct cnxctx * conn, int mode, int algo, char * priority, void * alt_creds, void (*cb)(struct cnxctx * conn, int ret, void * data), void * data);
 char *          fd_cnx_getid(struct cnxctx * conn);
 int		fd_cnx_getproto(struct cnxctx * conn);
 int		fd_cnx_getTLS(struct cnxctx * conn);
@@ -359,12 +474,20 @@ int             fd_cnx_getremoteeps(struct cnxctx * conn, struct fd_list * eps);
 char *          fd_cnx_getremoteid(struct cnxctx * conn);
 int             fd_cnx_receive(struct cnxctx * conn, struct timespec * timeout, unsigned char **buf, size_t * len);
 int             fd_cnx_recv_setaltfifo(struct cnxctx * conn, struct fifo * alt_fifo); /* send FDEVP_CNX_MSG_RECV event to the fifo list */
+void            fd_cnx_recv_pause(struct cnxctx * conn, int pause); /* stop / restart reading messages from the connection */
 int             fd_cnx_send(struct cnxctx * conn, unsigned char * buf, size_t len);
+int             fd_cnx_send_batch(struct cnxctx * conn, struct iovec * iov, int iovcnt);
 void            fd_cnx_destroy(struct cnxctx * conn);
 #ifdef GNUTLS_VERSION_300
 int             fd_tls_verify_credentials_2(gnutls_session_t session);
 #endif /* GNUTLS_VERSION_300 */
 
+#ifdef USE_IO_URING
+/* io_uring backend for the TCP connections in clear */
+int  fd_uring_init(void);
+void fd_uring_fini(void);
+#endif /* USE_IO_URING */
+
 /* Internal calls of the hook mechanism */
 void   fd_hook_call(enum fd_hook_type type, struct msg * msg, struct fd_peer * peer, void * other, struct fd_msg_pmdl * pmdl);
 void   fd_hook_associate(struct msg * msg, struct fd_msg_pmdl * pmdl);
@@ -103,15 +103,25 @@ struct peer_info fddpi;
 %token		NOTCP
 %token		NOSCTP
 %token		PREFERTCP
+%token		IOURING
 %token		OLDTLS
 %token		NOTLS
 %token		SCTPSTREAMS
+%token		SCTPTLSTHREADS
 %token		APPSERVTHREADS
+%token		ROUTINGSHARDS
+%token		INGRESSQUOTA
+%token		DECODERTHREADS
+%token		RTCACHETTL
+%token		CPUAFFINITY
 %token		LISTENON
 %token		THRPERSRV
 %token		TCTIMER
 %token		TWTIMER
 %token		NORELAY
+%token		ROUTEBYREALM
+%token		INLINEANSCB
+%token		DEFAULTROUTE
 %token		LOADEXT
 %token		CONNPEER
 %token		CONNTO
@@ -119,6 +129,9 @@ struct peer_info fddpi;
 %token		TLS_CA
 %token		TLS_CRL
 %token		TLS_PRIO
+%token		TLS_NORESUME
+%token		TLS_HSTHREADS
+%token		TLS_HSMAX
 %token		TLS_DH_BITS
 %token		TLS_DH_FILE
 
@@ -136,15 +149,24 @@ conffile:		/* Empty is OK -- for simplicity here, we reject in daemon later */
 			| conffile secport
 			| conffile sec3436
 			| conffile sctpstreams
+			| conffile sctptlsthreads
 			| conffile listenon
 			| conffile thrpersrv
 			| conffile norelay
+			| conffile routebyrealm
+			| conffile inlineanscb
 			| conffile appservthreads
+			| conffile routingshards
+			| conffile ingressquota
+			| conffile decoderthreads
+			| conffile rtcachettl
+			| conffile cpuaffinity
 			| conffile noip
 			| conffile noip6
 			| conffile notcp
 			| conffile nosctp
 			| conffile prefertcp
+			| conffile iouring
 			| conffile oldtls
 			| conffile loadext
 			| conffile connpeer
@@ -152,6 +174,8 @@ conffile:		/* Empty is OK -- for simplicity here, we reject in daemon later */
 			| conffile tls_ca
 			| conffile tls_crl
 			| conffile tls_prio
+			| conffile tls_noresume
+			| conffile tls_handshake
 			| conffile tls_dh
 			| conffile errors
 			{
@@ -254,6 +278,26 @@ norelay:		NORELAY ';'
 			}
 			;
 
+routebyrealm:		ROUTEBYREALM ';'
+			{
+				conf->cnf_flags.rt_realm = 1;
+			}
+			;
+
+inlineanscb:		INLINEANSCB ';'
+			{
+				conf->cnf_flags.inl_ans = 1;
+			}
+			;
+
+sctptlsthreads:		SCTPTLSTHREADS '=' INTEGER ';'
+			{
+				CHECK_PARAMS_DO( ($3 > 0) && ($3 < 256),
+					{ yyerror (&yylloc, conf, "Invalid value"); YYERROR; } );
+				conf->cnf_thr_3436 = (uint16_t)$3;
+			}
+			;
+
 appservthreads:		APPSERVTHREADS '=' INTEGER ';'
 			{
 				CHECK_PARAMS_DO( ($3 > 0) && ($3 < 256),
@@ -262,6 +306,55 @@ appservthreads:		APPSERVTHREADS '=' INTEGER ';'
 			}
 			;
 
+routingshards:		ROUTINGSHARDS '=' INTEGER ';'
+			{
+				CHECK_PARAMS_DO( ($3 > 0) && ($3 <= FD_SHARDS_MAX),
+					{ yyerror (&yylloc, conf, "Invalid value"); YYERROR; } );
+				conf->cnf_shards = (uint16_t)$3;
+			}
+			;
+
+ingressquota:		INGRESSQUOTA '=' INTEGER ';'
+			{
+				/* 1 is not allowed: the reception is resumed at half of the quota */
+				CHECK_PARAMS_DO( ($3 == 0) || (($3 > 1) && ($3 < 65536)),
+					{ yyerror (&yylloc, conf, "Invalid value"); YYERROR; } );
+				conf->cnf_rcv_quota = (uint16_t)$3;
+			}
+			;
+
+decoderthreads:		DECODERTHREADS '=' INTEGER ';'
+			{
+				CHECK_PARAMS_DO( ($3 >= 0) && ($3 < 256),
+					{ yyerror (&yylloc, conf, "Invalid value"); YYERROR; } );
+				conf->cnf_dec_thr = (uint16_t)$3;
+			}
+			;
+
+rtcachettl:		RTCACHETTL '=' INTEGER ';'
+			{
+				CHECK_PARAMS_DO( ($3 >= 0) && ($3 <= 3600000),
+					{ yyerror (&yylloc, conf, "Invalid value"); YYERROR; } );
+				conf->cnf_rtcache_ttl = (uint32_t)$3;
+			}
+			;
+
+cpuaffinity:		CPUAFFINITY '=' QSTRING ',' QSTRING ';'
+			{
+				int c = fd_thr_class_byname($3);
+				if (c < 0) {
+					TRACE_ERROR("Unknown thread class '%s', expected receive, route, dispatch, out or timers", $3);
+					yyerror (&yylloc, conf, "Invalid thread class"); 
+					YYERROR;
+				}
+				CHECK_FCT_DO( fd_thr_cpus_check($5),
+					{ yyerror (&yylloc, conf, "Invalid list of CPUs"); YYERROR; } );
+				free(conf->cnf_cpus[c]);
+				conf->cnf_cpus[c] = $5;
+				free($3);
+			}
+			;
+
 noip:			NOIP ';'
 			{
 				if (got_peer_noipv6) { 
@@ -322,6 +415,16 @@ prefertcp:		PREFERTCP ';'
 			}
 			;
 
+iouring:		IOURING ';'
+			{
+				#ifndef USE_IO_URING
+				yyerror (&yylloc, conf, "Use_IO_Uring cannot be specified for daemon compiled without USE_IO_URING option."); 
+				YYERROR; 
+				#endif
+				conf->cnf_flags.io_uring = 1;
+			}
+			;
+
 oldtls:			OLDTLS ';'
 			{
 				conf->cnf_flags.tls_alg = 1;
@@ -486,6 +589,10 @@ peerparams:		/* empty */
 					{ yyerror (&yylloc, conf, "Invalid port value"); YYERROR; } );
 				fddpi.config.pic_port = (uint16_t)$4;
 			}
+			| peerparams DEFAULTROUTE ';'
+			{
+				fddpi.config.pic_flags.rtdef = PI_RTDEF_ALWAYS;
+			}
 			| peerparams TCTIMER '=' INTEGER ';'
 			{
 				fddpi.config.pic_tctimer = $4;
@@ -646,6 +753,26 @@ tls_prio:		TLS_PRIO '=' QSTRING ';'
 			}
 			;
 			
+tls_noresume:		TLS_NORESUME ';'
+			{
+				conf->cnf_flags.no_tlsres = 1;
+			}
+			;
+			
+tls_handshake:		TLS_HSTHREADS '=' INTEGER ';'
+			{
+				CHECK_PARAMS_DO( ($3 > 0) && ($3 < 256),
+					{ yyerror (&yylloc, conf, "Invalid value"); YYERROR; } );
+				conf->cnf_thr_hs = $3;
+			}
+			| TLS_HSMAX '=' INTEGER ';'
+			{
+				CHECK_PARAMS_DO( ($3 > 0),
+					{ yyerror (&yylloc, conf, "Invalid value"); YYERROR; } );
+				conf->cnf_hs_max = $3;
+			}
+			;
+			
 tls_dh:			TLS_DH_BITS '=' INTEGER ';'
 			{
 				conf->cnf_sec_data.dh_bits = $3;
@@ -344,8 +344,8 @@ static int fd_msg_send_int( struct msg ** pmsg, void (*anscb)(void *, struct msg
 		fd_hook_call(HOOK_MESSAGE_LOCAL, *pmsg, NULL, NULL, fd_msg_pmdl_get(*pmsg));
 	}
 		
-	/* Post the message in the outgoing queue */
-	CHECK_FCT( fd_fifo_post(fd_g_outgoing, pmsg) );
+	/* Post the message in the outgoing queue of its shard */
+	CHECK_FCT( fd_fifo_post(FD_SHARD(*pmsg)->outgoing, pmsg) );
 	
 	return 0;
 }
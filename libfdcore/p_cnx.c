@@ -239,6 +239,7 @@ static void * connect_thr(void * arg)
 		snprintf(buf, sizeof(buf), "ConnTo:%s", peer->p_hdr.info.pi_diamid);
 		fd_log_threadname ( buf );
 	}
+	fd_thr_bind(FD_THR_RECV, -1);
 	
 	do {
 		/* Rebuild the list if needed, if it is empty -- but at most once */
@@ -149,6 +149,16 @@ int fd_p_dw_timeout(struct fd_peer * peer)
 {
 	TRACE_ENTRY("%p", peer);
 
+	if ((fd_peer_getstate(peer) == STATE_OPEN) && !peer->p_flags.pf_dw_pending) {
+		/* Messages received since the timer was set delay the DWR: the timer is not re-armed for each of them (fd_p_expi_activity) */
+		int tw = peer->p_hdr.info.config.pic_twtimer ?: fd_g_config->cnf_timer_tw;
+		time_t now = time(NULL), last = __atomic_load_n(&peer->p_activity, __ATOMIC_RELAXED);
+		if (last + tw - 2 > now) {
+			fd_psm_next_timeout(peer, 1, last + tw - now);
+			return 0;
+		}
+	}
+	
 	if (peer->p_flags.pf_dw_pending) {
 		/* We have sent a DWR and received no answer during TwTimer */
 		CHECK_FCT( fd_psm_change_state(peer, STATE_SUSPECT) );
@@ -38,168 +38,118 @@
 /* Delay for garbage collection of expired peers, in seconds */
 #define GC_TIME		120
 
-static pthread_t       exp_thr = (pthread_t)NULL;
-static pthread_t       gc_thr  = (pthread_t)NULL;
-static struct fd_list  exp_list = FD_LIST_INITIALIZER( exp_list );
-static pthread_cond_t  exp_cnd  = PTHREAD_COND_INITIALIZER;
-static pthread_mutex_t exp_mtx  = PTHREAD_MUTEX_INITIALIZER;
+static void gc_fct(void * arg);
+static struct fd_timer gc_tmr = FD_TIMER_INITIALIZER( gc_tmr, gc_fct, NULL, FD_TIMER_BLOCKING );
 
-static void * gc_th_fct(void * arg)
+/* Arm a timer for a delay in seconds */
+static int arm_in(struct fd_timer * timer, time_t delay)
 {
-	fd_log_threadname ( "Peers/garb. col." );
+	struct timespec ts;
+	CHECK_SYS( clock_gettime(CLOCK_REALTIME, &ts) );
+	ts.tv_sec += delay;
+	CHECK_FCT( fd_timer_arm(timer, &ts) );
+	return 0;
+}
+
+static void gc_fct(void * arg)
+{
+	struct fd_list * li, purge = FD_LIST_INITIALIZER(purge);
+	
 	TRACE_ENTRY( "%p", arg );
 	
-	do {
-		struct fd_list * li, purge = FD_LIST_INITIALIZER(purge);
+	/* Now check in the peers list if any peer can be deleted */
+	CHECK_FCT_DO( pthread_rwlock_wrlock(&fd_g_peers_rw), goto error );
+	
+	for (li = fd_g_peers.next; li != &fd_g_peers; li = li->next) {
+		struct fd_peer * peer = (struct fd_peer *)li->o;
 		
-		sleep(GC_TIME);	/* sleep is a cancellation point */
+		if (fd_peer_getstate(peer) != STATE_ZOMBIE)
+			continue;
 		
-		/* Now check in the peers list if any peer can be deleted */
-		CHECK_FCT_DO( pthread_rwlock_wrlock(&fd_g_peers_rw), goto error );
+		if (peer->p_hdr.info.config.pic_flags.persist == PI_PRST_ALWAYS)
+			continue; /* This peer was not supposed to terminate, keep it in the list for debug */
 		
-		for (li = fd_g_peers.next; li != &fd_g_peers; li = li->next) {
-			struct fd_peer * peer = (struct fd_peer *)li->o;
-			
-			if (fd_peer_getstate(peer) != STATE_ZOMBIE)
-				continue;
-			
-			if (peer->p_hdr.info.config.pic_flags.persist == PI_PRST_ALWAYS)
-				continue; /* This peer was not supposed to terminate, keep it in the list for debug */
-			
-			/* Ok, the peer was expired, let's remove it */
-			li = li->prev; /* to avoid breaking the loop */
-			fd_list_unlink(&peer->p_hdr.chain);
-			fd_list_insert_before(&purge, &peer->p_hdr.chain);
-		}
+		/* Ok, the peer was expired, let's remove it */
+		li = li->prev; /* to avoid breaking the loop */
+		fd_list_unlink(&peer->p_hdr.chain);
+		fd_list_insert_before(&purge, &peer->p_hdr.chain);
+	}
 
-		CHECK_FCT_DO( pthread_rwlock_unlock(&fd_g_peers_rw), goto error );
-		
-		/* Now delete peers that are in the purge list */
-		while (!FD_IS_LIST_EMPTY(&purge)) {
-			struct fd_peer * peer = (struct fd_peer *)(purge.next->o);
-			fd_list_unlink(&peer->p_hdr.chain);
-			TRACE_DEBUG(INFO, "Garbage Collect: delete zombie peer '%s'", peer->p_hdr.info.pi_diamid);
-			CHECK_FCT_DO( fd_peer_free(&peer), /* Continue... what else to do ? */ );
-		}
-	} while (1);
+	CHECK_FCT_DO( pthread_rwlock_unlock(&fd_g_peers_rw), goto error );
+	
+	/* Now delete peers that are in the purge list */
+	while (!FD_IS_LIST_EMPTY(&purge)) {
+		struct fd_peer * peer = (struct fd_peer *)(purge.next->o);
+		fd_list_unlink(&peer->p_hdr.chain);
+		TRACE_DEBUG(INFO, "Garbage Collect: delete zombie peer '%s'", peer->p_hdr.info.pi_diamid);
+		CHECK_FCT_DO( fd_peer_free(&peer), /* Continue... what else to do ? */ );
+	}
+	
+	/* Next collection */
+	CHECK_FCT_DO( arm_in(&gc_tmr, GC_TIME), goto error );
+	return;
 	
 error:
-	TRACE_DEBUG(INFO, "An error occurred in peers module! GC thread is terminating...");
+	TRACE_DEBUG(INFO, "An error occurred in peers module! Garbage collection is stopped...");
 	ASSERT(0);
 	CHECK_FCT_DO(fd_core_shutdown(), );
-	return NULL;
 }
 
-
-static void * exp_th_fct(void * arg)
+/* Callback of the expiry timer of a peer */
+void fd_p_expi_timeout(void * arg)
 {
-	fd_log_threadname ( "Peers/expire" );
-	TRACE_ENTRY( "%p", arg );
-	
-	CHECK_POSIX_DO( pthread_mutex_lock(&exp_mtx), { ASSERT(0); } );
-	pthread_cleanup_push( fd_cleanup_mutex, &exp_mtx );
+	struct fd_peer * peer = arg;
+	time_t left;
 	
-	do {
-		struct timespec	now;
-		struct fd_peer * first;
-		
-		/* Check if there are expiring peers available */
-		if (FD_IS_LIST_EMPTY(&exp_list)) {
-			/* Just wait for a change or cancelation */
-			CHECK_POSIX_DO( pthread_cond_wait( &exp_cnd, &exp_mtx ), { ASSERT(0); } );
-			/* Restart the loop on wakeup */
-			continue;
-		}
-		
-		/* Get the pointer to the peer that expires first */
-		first = (struct fd_peer *)(exp_list.next->o);
-		ASSERT( CHECK_PEER(first) );
-		
-		/* Get the current time */
-		CHECK_SYS_DO(  clock_gettime(CLOCK_REALTIME, &now),  { ASSERT(0); }  );
-
-		/* If first peer is not expired, we just wait until it happens */
-		if ( TS_IS_INFERIOR( &now, &first->p_exp_timer ) ) {
-			
-			CHECK_POSIX_DO2(  pthread_cond_timedwait( &exp_cnd, &exp_mtx, &first->p_exp_timer ),  
-					ETIMEDOUT, /* ETIMEDOUT is a normal return value, continue */,
-					/* on other error, */ { ASSERT(0); } );
+	TRACE_ENTRY( "%p", arg );
+	ASSERT( CHECK_PEER(peer) );
 	
-			/* on wakeup, loop */
-			continue;
-		}
-		
-		/* Now, the first peer in the list is expired; signal it */
-		fd_list_unlink( &first->p_expiry );
-		CHECK_FCT_DO( fd_event_send(first->p_events, FDEVP_TERMINATE, 0, "DO_NOT_WANT_TO_TALK_TO_YOU"), break );
-		
-	} while (1);
+	/* The timer of the peer is over, but messages may have been received since it was armed */
+	left = __atomic_load_n(&peer->p_activity, __ATOMIC_RELAXED) + peer->p_hdr.info.config.pic_lft - time(NULL);
+	if (left > 0) {
+		CHECK_FCT_DO( arm_in(&peer->p_exp_timer, left), /* continue */ );
+		return;
+	}
 	
-	pthread_cleanup_pop( 1 );
-
-	TRACE_DEBUG(INFO, "An error occurred in peers module! Expiry thread is terminating...");
-	CHECK_FCT_DO(fd_core_shutdown(), );
-	return NULL;
+	/* Now, the peer is expired; signal it. Do not wait for room in its queue, the thread of the timers is shared */
+	CHECK_FCT_DO( fd_event_send_noblock(peer->p_events, FDEVP_TERMINATE, 0, "DO_NOT_WANT_TO_TALK_TO_YOU"), /* continue */ );
 }
 
 /* Initialize peers expiry mechanism */
 int fd_p_expi_init(void)
 {
 	TRACE_ENTRY();
-	CHECK_FCT( pthread_create( &exp_thr, NULL, exp_th_fct, NULL ) );
-	CHECK_FCT( pthread_create( &gc_thr,  NULL, gc_th_fct,  NULL ) );
+	CHECK_FCT( arm_in(&gc_tmr, GC_TIME) );
 	return 0;
 }
 
 /* Finish peers expiry mechanism */
 int fd_p_expi_fini(void)
 {
-	CHECK_FCT_DO( fd_thr_term(&exp_thr), );
-	CHECK_POSIX( pthread_mutex_lock(&exp_mtx) );
-	while (!FD_IS_LIST_EMPTY(&exp_list)) {
-		struct fd_peer * peer = (struct fd_peer *)(exp_list.next->o);
-		fd_list_unlink(&peer->p_expiry );
-	}
-	CHECK_POSIX( pthread_mutex_unlock(&exp_mtx) );
-	
-	CHECK_FCT_DO( fd_thr_term(&gc_thr), );
+	CHECK_FCT_DO( fd_timer_cancel(&gc_tmr), );
 	return 0;
 }
 
-/* Add / requeue a peer in the expiry list */
+/* Arm / disarm the expiry timer of a peer */
 int fd_p_expi_update(struct fd_peer * peer )
 {
 	TRACE_ENTRY("%p", peer);
 	CHECK_PARAMS( CHECK_PEER(peer) );
 	
-	CHECK_POSIX( pthread_mutex_lock(&exp_mtx) );
-	
-	fd_list_unlink(&peer->p_expiry );
-	
 	/* if peer expires */
 	if (peer->p_hdr.info.config.pic_flags.exp) {
-		struct fd_list * li;
-		
-		/* update the p_exp_timer value */
-		CHECK_SYS_DO(  clock_gettime(CLOCK_REALTIME, &peer->p_exp_timer), { ASSERT(0); }  );
-		peer->p_exp_timer.tv_sec += peer->p_hdr.info.config.pic_lft;
-		
-		/* add to the expiry list in appropriate position (probably around the end) */
-		for (li = exp_list.prev; li != &exp_list; li = li->prev) {
-			struct fd_peer * p = (struct fd_peer *)(li->o);
-			if (TS_IS_INFERIOR( &p->p_exp_timer, &peer->p_exp_timer ) )
-				break;
-		}
-		
-		fd_list_insert_after(li, &peer->p_expiry);
-		
-		/* signal the expiry thread if we added in first position */
-		if (li == &exp_list) {
-			CHECK_POSIX( pthread_cond_signal(&exp_cnd) );
-		}
+		__atomic_store_n(&peer->p_activity, time(NULL), __ATOMIC_RELAXED);
+		CHECK_FCT( arm_in(&peer->p_exp_timer, peer->p_hdr.info.config.pic_lft) );
+	} else {
+		CHECK_FCT( fd_timer_cancel(&peer->p_exp_timer) );
 	}
 	
-	CHECK_POSIX( pthread_mutex_unlock(&exp_mtx) );
 	return 0;
 }
 
+/* Record activity on the peer, for each routable message received. The timer is not modified: 
+ fd_p_expi_timeout and the Tw timeout check this timestamp when the peer's timer is over, and re-arm it if needed. */
+void fd_p_expi_activity(struct fd_peer * peer )
+{
+	__atomic_store_n(&peer->p_activity, time(NULL), __ATOMIC_RELAXED);
+}
@@ -0,0 +1,618 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+#include "fdcore-internal.h"
+
+/* Ingress of the routable messages received from the peers.
+ *
+ * The PSM of a peer does not post the routable messages directly into the (shared) incoming queue of their shard, where it would
+ * block when the routing is late, and stop handling the watchdogs and other link-local messages of this peer meanwhile. They are
+ * saved in the p_ingress queue of the peer instead, and a small pool of threads moves them to the routing queues, taking a few
+ * messages of each peer in turn: a peer that sends much more than the others does not delay the messages of the others.
+ * The answers to the requests issued locally follow the same path, but they are moved to the local queue of their shard instead,
+ * skipping the ROUTING-IN step (fd_rtdisp_queue).
+ *
+ * The number of messages waiting in p_ingress is limited by the IngressQuota parameter: when it is reached, the connection of the
+ * peer stops being read (fd_cnx_recv_pause) until the queue is back to half of the quota. The link-local messages (CER, DWR, DPR...)
+ * are handled by the PSM and not counted.
+ *
+ * With DecoderThreads, the PSM does not parse the routable messages received in the states where they are accepted either: it only
+ * recognizes them from their header (fd_in_routable), updates the state of the peer, and passes the buffer to a pool of decoder
+ * threads shared by all the peers (fd_in_decode). The decoders parse the buffer, associate the answers with their request, add the
+ * Route-Record, and pass the messages to fd_in_post in the order they were received from the peer: a message decoded before the
+ * previous ones waits for them. The messages being decoded are counted in the quota of the peer.
+ */
+
+/* Number of messages moved from a peer before serving the next one */
+#define IN_QUANTUM	4
+
+/* The peers that have messages in p_ingress, in the order they will be served */
+static struct fd_list	in_ready = FD_LIST_INITIALIZER(in_ready);
+static pthread_mutex_t	in_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	in_cond = PTHREAD_COND_INITIALIZER;	/* signaled when a peer is added to in_ready */
+static pthread_cond_t	in_idle = PTHREAD_COND_INITIALIZER;	/* signaled when a pump releases a peer */
+
+static pthread_t      *	in_pumps = NULL;
+static int		in_nb_pumps = 0;
+
+/* A received buffer being decoded */
+struct dec_job {
+	struct fd_list	 chain;	/* link in p_dec_jobs of the peer, in reception order */
+	struct fd_list	 ready;	/* link in dec_ready until a decoder takes the job */
+	struct fd_peer	*peer;
+	uint8_t		*buf;
+	size_t		 len;
+	int		 state;
+	struct msg	*msg;	/* the decoded message, NULL if it was discarded */
+};
+#define DEC_WAITING	0
+#define DEC_RUNNING	1
+#define DEC_DONE	2
+
+/* The jobs not taken by a decoder yet, of all the peers */
+static struct fd_list	dec_ready = FD_LIST_INITIALIZER(dec_ready);
+static pthread_mutex_t	dec_lock = PTHREAD_MUTEX_INITIALIZER;	/* also protects the p_dec_* fields of the peers */
+static pthread_cond_t	dec_cond = PTHREAD_COND_INITIALIZER;	/* signaled when a job is added to dec_ready */
+static pthread_cond_t	dec_idle = PTHREAD_COND_INITIALIZER;	/* signaled when a job is done or a decoder stops delivering */
+
+static pthread_t      *	dec_thrs = NULL;
+static int		dec_nb_thrs = 0;
+
+static void dec_check_resume(struct fd_peer * peer);
+
+/* High watermark of p_ingress. fd_fifo_post is called by the PSM thread, which owns p_cnxctx */
+static void in_over_quota(struct fifo * queue, void ** data)
+{
+	struct fd_peer * peer = *data;
+	if (fd_g_config->cnf_dec_thr) {
+		/* fd_fifo_post is called by a decoder, fd_in_decode checks the quota instead */
+		return;
+	}
+	if (peer->p_cnxctx) {
+		TRACE_DEBUG(FULL, "'%s' is over its ingress quota, pausing the reception", peer->p_hdr.info.pi_diamid);
+		fd_cnx_recv_pause(peer->p_cnxctx, 1);
+	}
+}
+
+/* Low watermark of p_ingress. Called by a pump while it owns the peer, the PSM resumes the reception */
+static void in_under_quota(struct fifo * queue, void ** data)
+{
+	struct fd_peer * peer = *data;
+	if (!peer->p_in_detached) {
+		CHECK_FCT_DO( fd_event_send(peer->p_events, FDEVP_INGRESS_RESUME, 0, NULL), /* continue */ );
+	}
+}
+
+/* Pass a message to the routing, and report it if this fails */
+static void in_route(struct msg ** msg)
+{
+	CHECK_FCT_DO( fd_fifo_post_noblock(fd_rtdisp_queue(*msg), (void *)msg),
+		{
+			fd_hook_call(HOOK_MESSAGE_DROPPED, *msg, NULL, "Message lost because the routing queue is not available.", fd_msg_pmdl_get(*msg));
+			fd_msg_free(*msg);
+			*msg = NULL;
+		} );
+}
+
+/* Cancelation cleanup of a pump: release the peer it was serving */
+static void in_release(void * arg)
+{
+	struct fd_peer * peer = arg;
+	CHECK_POSIX_DO( pthread_mutex_lock(&in_lock), );
+	peer->p_in_busy = 0;
+	if ((!peer->p_in_detached) && fd_fifo_length(peer->p_ingress)) {
+		/* back at the end of the list */
+		fd_list_insert_before(&in_ready, &peer->p_in_ready);
+		CHECK_POSIX_DO( pthread_cond_signal(&in_cond), );
+	}
+	CHECK_POSIX_DO( pthread_cond_broadcast(&in_idle), );
+	CHECK_POSIX_DO( pthread_mutex_unlock(&in_lock), );
+}
+
+/* The pumps */
+static void * in_pump(void * arg)
+{
+	fd_log_threadname ( "Ingress" );
+	fd_thr_bind(FD_THR_RECV, -1);
+	
+	while (1) {
+		struct fd_peer * peer;
+		struct msg * msg;
+		int i;
+		
+		/* Take the next peer */
+		CHECK_POSIX_DO( pthread_mutex_lock(&in_lock), break );
+		pthread_cleanup_push( fd_cleanup_mutex, &in_lock );
+		while (FD_IS_LIST_EMPTY(&in_ready)) {
+			CHECK_POSIX_DO( pthread_cond_wait(&in_cond, &in_lock), break );
+		}
+		peer = in_ready.next->o; /* NULL if the wait failed */
+		if (peer) {
+			fd_list_unlink(&peer->p_in_ready);
+			peer->p_in_busy = 1;
+		}
+		pthread_cleanup_pop( 1 );
+		if (!peer)
+			break;
+		
+		/* Move a few of its messages; this blocks if the incoming (or local) queue is full */
+		pthread_cleanup_push( in_release, peer );
+		for (i = 0; i < IN_QUANTUM; i++) {
+			if (fd_fifo_tryget(peer->p_ingress, &msg))
+				break;
+			pthread_cleanup_push( (void *)fd_msg_free, msg );
+			CHECK_FCT_DO( fd_fifo_post(fd_rtdisp_queue(msg), &msg), 
+				{
+					fd_hook_call(HOOK_MESSAGE_DROPPED, msg, NULL, "Message lost because the routing queue is not available.", fd_msg_pmdl_get(msg));
+					fd_msg_free(msg);
+				} );
+			pthread_cleanup_pop( 0 );
+		}
+		dec_check_resume(peer);
+		pthread_cleanup_pop( 1 );
+	}
+	
+	TRACE_DEBUG(INFO, "An error occurred in the ingress thread, it is terminating");
+	return NULL;
+}
+
+/* Decode a received buffer. The steps are the same as in the PSM, job->msg is set if the message must be passed to the routing */
+static void dec_process(struct dec_job * job)
+{
+	struct fd_peer * peer = job->peer;
+	struct msg * msg = NULL;
+	struct msg_hdr * hdr;
+	struct fd_cnx_rcvdata rcv_data;
+	struct fd_msg_pmdl * pmdl = NULL;
+	int is_req = job->buf[4] & CMD_FLAG_REQUEST;
+	int cnx_error = 0;
+	
+	rcv_data.buffer = job->buf;
+	rcv_data.length = job->len;
+	pmdl = fd_msg_pmdl_get_inbuf(rcv_data.buffer, rcv_data.length);
+	
+	/* Parse the received buffer */
+	CHECK_FCT_DO( fd_msg_parse_buffer( &job->buf, job->len, &msg), 
+		{
+			fd_hook_call(HOOK_MESSAGE_PARSING_ERROR, NULL, peer, &rcv_data, pmdl );
+			free(job->buf);
+			job->buf = NULL;
+			cnx_error = 1;
+			goto out;
+		} );
+	
+	fd_hook_associate(msg, pmdl);
+	CHECK_FCT_DO( fd_msg_source_set( msg, peer->p_hdr.info.pi_diamid, peer->p_hdr.info.pi_diamidlen), goto error );
+	CHECK_FCT_DO( fd_msg_hdr(msg, &hdr), goto error );
+	
+	/* If it is an answer, associate with the request or drop */
+	if (!is_req) {
+		struct msg * req;
+		CHECK_FCT_DO( fd_p_sr_fetch(&peer->p_sr, hdr->msg_hbhid, &req), goto error );
+		if (req == NULL) {
+			fd_hook_call(HOOK_MESSAGE_DROPPED, msg, peer, "Answer received with no corresponding sent request.", fd_msg_pmdl_get(msg));
+			fd_msg_free(msg);
+			goto out;
+		}
+		CHECK_FCT_DO( fd_msg_answ_associate( msg, req ), { fd_msg_free(req); goto error; } );
+	}
+	
+	/* Log incoming message */
+	fd_hook_call(HOOK_MESSAGE_RECEIVED, msg, peer, NULL, fd_msg_pmdl_get(msg));
+	
+	/* Set the message source and add the Route-Record */
+	CHECK_FCT_DO( fd_msg_source_setrr( msg, peer->p_hdr.info.pi_diamid, peer->p_hdr.info.pi_diamidlen, fd_g_config->cnf_dict ), goto error );
+	
+	job->msg = msg;
+	return;
+	
+error:
+	{
+		char buf[256];
+		snprintf(buf, sizeof(buf), "%s: An unexpected error occurred while decoding a routable message", peer->p_hdr.info.pi_diamid); 
+		fd_hook_call(HOOK_MESSAGE_DROPPED, msg, peer, buf, fd_msg_pmdl_get(msg));
+		fd_msg_free(msg);
+	}
+out:
+	if (is_req) {
+		/* The PSM counted this request, it will not be answered. The count may have been reset meanwhile if the peer was closed */
+		long cnt = __atomic_load_n(&peer->p_reqin_count, __ATOMIC_RELAXED);
+		while ((cnt > 0) && !__atomic_compare_exchange_n(&peer->p_reqin_count, &cnt, cnt - 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			;
+	}
+	if (cnx_error) {
+		/* Reset the connection, as the PSM does */
+		CHECK_FCT_DO( fd_event_send(peer->p_events, FDEVP_CNX_ERROR, 0, NULL), /* continue */ );
+	}
+}
+
+/* Pass a decoded message to the ingress of its peer, and report it if this fails */
+static void dec_post(struct fd_peer * peer, struct msg ** msg)
+{
+	CHECK_FCT_DO( fd_in_post(peer, msg),
+		{
+			fd_hook_call(HOOK_MESSAGE_DROPPED, *msg, NULL, "Message lost because the routing queue is not available.", fd_msg_pmdl_get(*msg));
+			fd_msg_free(*msg);
+			*msg = NULL;
+		} );
+}
+
+/* Resume the reception of a peer paused by fd_in_decode when its messages waiting for the decoding and the routing are back to half
+ of the quota. Called by the threads that remove these messages, the peer cannot be detached meanwhile */
+static void dec_check_resume(struct fd_peer * peer)
+{
+	int resume = 0;
+	
+	if (!__atomic_load_n(&peer->p_dec_paused, __ATOMIC_RELAXED))
+		return;
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), return );
+	if (peer->p_dec_paused && (peer->p_dec_pending + fd_fifo_length(peer->p_ingress) <= fd_g_config->cnf_rcv_quota / 2)) {
+		peer->p_dec_paused = 0;
+		resume = 1;
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), return );
+	
+	if (resume) {
+		CHECK_FCT_DO( fd_event_send(peer->p_events, FDEVP_INGRESS_RESUME, 0, NULL), /* continue */ );
+	}
+}
+
+/* Cancelation cleanup of a decoder while it passes the messages of a peer */
+static void dec_release(void * arg)
+{
+	struct fd_peer * peer = arg;
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), );
+	peer->p_dec_delivering = 0;
+	CHECK_POSIX_DO( pthread_cond_broadcast(&dec_idle), );
+	CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), );
+}
+
+/* Pass the decoded messages of the peer to fd_in_post, in reception order, until one is not decoded yet. p_dec_delivering is set */
+static void dec_deliver(struct fd_peer * peer)
+{
+	pthread_cleanup_push( dec_release, peer );
+	while (1) {
+		struct dec_job * job = NULL;
+		struct msg * msg;
+		
+		CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), break );
+		if (!FD_IS_LIST_EMPTY(&peer->p_dec_jobs))
+			job = peer->p_dec_jobs.next->o;
+		if ((!job) || (job->state != DEC_DONE) || peer->p_dec_detached) {
+			/* The decoder of this job will deliver it */
+			peer->p_dec_delivering = 0;
+			CHECK_POSIX_DO( pthread_cond_broadcast(&dec_idle), );
+			CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), );
+			break;
+		}
+		fd_list_unlink(&job->chain);
+		peer->p_dec_pending--;
+		CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), );
+		
+		msg = job->msg;
+		free(job);
+		if (msg) {
+			pthread_cleanup_push( (void *)fd_msg_free, msg );
+			dec_post(peer, &msg);
+			pthread_cleanup_pop( 0 );
+		}
+		dec_check_resume(peer);
+	}
+	pthread_cleanup_pop( 0 );
+}
+
+/* The decoders */
+static void * dec_thr(void * arg)
+{
+	fd_log_threadname ( "Decoder" );
+	fd_thr_bind(FD_THR_RECV, -1);
+	
+	while (1) {
+		struct dec_job * job;
+		struct fd_peer * peer;
+		int state, deliver = 0;
+		
+		/* Take the next job */
+		CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), break );
+		pthread_cleanup_push( fd_cleanup_mutex, &dec_lock );
+		while (FD_IS_LIST_EMPTY(&dec_ready)) {
+			CHECK_POSIX_DO( pthread_cond_wait(&dec_cond, &dec_lock), break );
+		}
+		job = dec_ready.next->o; /* NULL if the wait failed */
+		if (job) {
+			fd_list_unlink(&job->ready);
+			job->state = DEC_RUNNING;
+		}
+		pthread_cleanup_pop( 1 );
+		if (!job)
+			break;
+		peer = job->peer;
+		
+		/* Once taken, the job must complete: fd_in_detach waits for it */
+		CHECK_POSIX_DO( pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &state), /* continue */ );
+		dec_process(job);
+		
+		CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), { ASSERT(0); } );
+		job->state = DEC_DONE;
+		if ((!peer->p_dec_delivering) && (!peer->p_dec_detached)) {
+			/* No other decoder is passing the messages of this peer, do it */
+			peer->p_dec_delivering = 1;
+			deliver = 1;
+		}
+		CHECK_POSIX_DO( pthread_cond_broadcast(&dec_idle), );
+		CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), { ASSERT(0); } );
+		CHECK_POSIX_DO( pthread_setcancelstate(state, NULL), /* continue */ );
+		
+		if (deliver)
+			dec_deliver(peer);
+	}
+	
+	TRACE_DEBUG(INFO, "An error occurred in the decoder thread, it is terminating");
+	return NULL;
+}
+
+/* The PSM has finished with the peer: decode and pass its remaining messages itself, the decoders do not serve it anymore */
+static void dec_detach(struct fd_peer * peer)
+{
+	int busy;
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), return );
+	pthread_cleanup_push( fd_cleanup_mutex, &dec_lock );
+	peer->p_dec_detached = 1;
+	do {
+		struct fd_list * li;
+		busy = peer->p_dec_delivering;
+		for (li = peer->p_dec_jobs.next; li != &peer->p_dec_jobs; li = li->next) {
+			struct dec_job * job = li->o;
+			fd_list_unlink(&job->ready);
+			if (job->state == DEC_RUNNING)
+				busy = 1;
+		}
+		if (busy) {
+			CHECK_POSIX_DO( pthread_cond_wait(&dec_idle, &dec_lock), break );
+		}
+	} while (busy);
+	pthread_cleanup_pop( 1 );
+	
+	while (!FD_IS_LIST_EMPTY(&peer->p_dec_jobs)) {
+		struct dec_job * job = peer->p_dec_jobs.next->o;
+		fd_list_unlink(&job->chain);
+		peer->p_dec_pending--;
+		if (job->state == DEC_WAITING)
+			dec_process(job);
+		if (job->msg)
+			dec_post(peer, &job->msg);
+		free(job);
+	}
+}
+
+/* Recognize the routable messages from their header, as fd_msg_is_routable does once they are parsed. 0 for invalid headers */
+int fd_in_routable(uint8_t * buf, size_t len)
+{
+	if ((len < 20) || (buf[0] != DIAMETER_VERSION))
+		return 0;
+	return ((buf[4] & CMD_FLAG_PROXIABLE) || buf[8] || buf[9] || buf[10] || buf[11]) ? 1 : 0;
+}
+
+/* Called by the PSM for each routable message received when there are decoder threads. The buffer is freed in all cases */
+int fd_in_decode(struct fd_peer * peer, uint8_t * buf, size_t len)
+{
+	struct dec_job * job;
+	uint16_t quota = fd_g_config->cnf_rcv_quota;
+	int pause = 0;
+	
+	TRACE_ENTRY("%p %p %zd", peer, buf, len);
+	CHECK_PARAMS_DO( peer && buf && (len >= 20) && !peer->p_dec_detached, { free(buf); return EINVAL; } );
+	
+	CHECK_MALLOC_DO( job = malloc(sizeof(struct dec_job)), { free(buf); return ENOMEM; } );
+	memset(job, 0, sizeof(struct dec_job));
+	fd_list_init(&job->chain, job);
+	fd_list_init(&job->ready, job);
+	job->peer = peer;
+	job->buf = buf;
+	job->len = len;
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), { free(buf); free(job); return EINVAL; } );
+	fd_list_insert_before(&peer->p_dec_jobs, &job->chain);
+	fd_list_insert_before(&dec_ready, &job->ready);
+	peer->p_dec_pending++;
+	if (quota && (!peer->p_dec_paused) && (peer->p_dec_pending + fd_fifo_length(peer->p_ingress) >= quota)) {
+		peer->p_dec_paused = 1;
+		pause = 1;
+	}
+	CHECK_POSIX_DO( pthread_cond_signal(&dec_cond), );
+	CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), );
+	
+	if (pause && peer->p_cnxctx) {
+		TRACE_DEBUG(FULL, "'%s' is over its ingress quota, pausing the reception", peer->p_hdr.info.pi_diamid);
+		fd_cnx_recv_pause(peer->p_cnxctx, 1);
+	}
+	
+	return 0;
+}
+
+/* Start the decoders and the pumps */
+int fd_in_init(void)
+{
+	int i;
+	
+	TRACE_ENTRY();
+	if (fd_g_config->cnf_dec_thr) {
+		CHECK_MALLOC( dec_thrs = calloc(fd_g_config->cnf_dec_thr, sizeof(pthread_t)) );
+		for (i = 0; i < fd_g_config->cnf_dec_thr; i++) {
+			CHECK_POSIX( pthread_create( &dec_thrs[i], NULL, dec_thr, NULL ) );
+			dec_nb_thrs++;
+		}
+	}
+	
+	if (!fd_g_config->cnf_rcv_quota)
+		return 0;
+	
+	/* As many as the shards, to feed their routing threads in parallel. The pumps are not bound to a shard: a pump waits when the
+	 queue of the shard of its message is full, so a shard where the routing is late ends up holding all the pumps, and the quotas
+	 of the peers then pause the reception */
+	CHECK_MALLOC( in_pumps = calloc(fd_g_config->cnf_shards, sizeof(pthread_t)) );
+	for (i = 0; i < fd_g_config->cnf_shards; i++) {
+		CHECK_POSIX( pthread_create( &in_pumps[i], NULL, in_pump, NULL ) );
+		in_nb_pumps++;
+	}
+	return 0;
+}
+
+/* Stop them, before the peers are terminated and the incoming queues destroyed */
+int fd_in_fini(void)
+{
+	int i;
+	
+	TRACE_ENTRY();
+	/* The decoders first, they feed the pumps. The jobs left are decoded by the PSM of their peer */
+	for (i = 0; i < dec_nb_thrs; i++) {
+		CHECK_FCT_DO( fd_thr_term(&dec_thrs[i]), /* continue */ );
+	}
+	free(dec_thrs);
+	dec_thrs = NULL;
+	dec_nb_thrs = 0;
+	
+	for (i = 0; i < in_nb_pumps; i++) {
+		CHECK_FCT_DO( fd_thr_term(&in_pumps[i]), /* continue */ );
+	}
+	free(in_pumps);
+	in_pumps = NULL;
+	in_nb_pumps = 0;
+	return 0;
+}
+
+/* Initialize the ingress data of a new peer */
+int fd_in_peer_init(struct fd_peer * peer)
+{
+	uint16_t quota = fd_g_config->cnf_rcv_quota;
+	
+	TRACE_ENTRY("%p", peer);
+	fd_list_init(&peer->p_in_ready, peer);
+	fd_list_init(&peer->p_dec_jobs, peer);
+	if (!quota)
+		return 0;
+	
+	CHECK_FCT( fd_fifo_new(&peer->p_ingress, 0) );
+	CHECK_FCT( fd_fifo_setthrhd(peer->p_ingress, peer, quota, in_over_quota, quota / 2, in_under_quota) );
+	return 0;
+}
+
+/* Called by the PSM for each routable message received */
+int fd_in_post(struct fd_peer * peer, struct msg ** msg)
+{
+	TRACE_ENTRY("%p %p", peer, msg);
+	
+	/* With InlineAnswerCallbacks, the answers to the local requests may be handled now */
+	CHECK_FCT( fd_rtdisp_answer(msg) );
+	if (!*msg)
+		return 0;
+	
+	if (!peer->p_ingress) {
+		/* No quota, post directly */
+		CHECK_FCT( fd_fifo_post(fd_rtdisp_queue(*msg), msg) );
+		return 0;
+	}
+	
+	CHECK_PARAMS( !peer->p_in_detached );
+	CHECK_FCT( fd_fifo_post(peer->p_ingress, msg) );
+	
+	CHECK_POSIX( pthread_mutex_lock(&in_lock) );
+	if ((!peer->p_in_busy) && FD_IS_LIST_EMPTY(&peer->p_in_ready)) {
+		fd_list_insert_before(&in_ready, &peer->p_in_ready);
+		CHECK_POSIX_DO( pthread_cond_signal(&in_cond), );
+	}
+	CHECK_POSIX( pthread_mutex_unlock(&in_lock) );
+	
+	return 0;
+}
+
+/* Called by the PSM on FDEVP_INGRESS_RESUME */
+void fd_in_resume(struct fd_peer * peer)
+{
+	int resume;
+	
+	TRACE_ENTRY("%p", peer);
+	
+	/* The queues may have grown again since the event was sent */
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), return );
+	resume = (peer->p_dec_pending + fd_fifo_length(peer->p_ingress) < fd_g_config->cnf_rcv_quota);
+	if (resume)
+		peer->p_dec_paused = 0;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), return );
+	
+	if (resume && peer->p_cnxctx) {
+		TRACE_DEBUG(FULL, "'%s' is under its ingress quota, resuming the reception", peer->p_hdr.info.pi_diamid);
+		fd_cnx_recv_pause(peer->p_cnxctx, 0);
+	}
+}
+
+/* The PSM of the peer is terminating: pass the remaining messages to the routing directly, the pumps do not serve the peer anymore */
+void fd_in_detach(struct fd_peer * peer)
+{
+	struct msg * msg;
+	
+	TRACE_ENTRY("%p", peer);
+	dec_detach(peer);
+	if (!peer->p_ingress)
+		return;
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&in_lock), return );
+	pthread_cleanup_push( fd_cleanup_mutex, &in_lock );
+	fd_list_unlink(&peer->p_in_ready);
+	while (peer->p_in_busy) {
+		/* The pump may be waiting for room in an incoming queue */
+		CHECK_POSIX_DO( pthread_cond_wait(&in_idle, &in_lock), break );
+	}
+	peer->p_in_detached = 1;
+	pthread_cleanup_pop( 1 );
+	
+	while (fd_fifo_tryget(peer->p_ingress, &msg) == 0) {
+		in_route(&msg);
+	}
+}
+
+/* Destroy the ingress data of the peer */
+void fd_in_peer_fini(struct fd_peer * peer)
+{
+	TRACE_ENTRY("%p", peer);
+	fd_in_detach(peer);
+	if (peer->p_ingress) {
+		/* The queue cannot be deleted while it has a data pointer */
+		CHECK_FCT_DO( fd_fifo_setthrhd(peer->p_ingress, NULL, 0, NULL, 0, NULL), /* continue */ );
+		CHECK_FCT_DO( fd_fifo_del(&peer->p_ingress), /* continue */ );
+	}
+}
@@ -35,18 +35,19 @@
 
 #include "fdcore-internal.h"
 
-/* Alloc a new hbh for requests, bufferize the message and send on the connection, save in sentreq if provided */
-static int do_send(struct msg ** msg, struct cnxctx * cnx, uint32_t * hbh, struct fd_peer * peer)
+/* Maximum number of messages that the out thread sends at once */
+#define OUT_BATCH_MAX	16
+
+/* Alloc a new hbh for requests, bufferize the message, save in sentreq if provided. On success, *msg is NULL if it was saved. */
+static int do_prepare(struct msg ** msg, uint32_t * hbh, struct fd_peer * peer, uint8_t ** buf, size_t * sz)
 {
 	struct msg_hdr * hdr;
 	int msg_is_a_req;
-	uint8_t * buf;
-	size_t sz;
 	int ret;
 	uint32_t bkp_hbh = 0;
 	struct msg *cpy_for_logs_only;
 	
-	TRACE_ENTRY("%p %p %p %p", msg, cnx, hbh, peer);
+	TRACE_ENTRY("%p %p %p %p %p", msg, hbh, peer, buf, sz);
 	
 	/* Retrieve the message header */
 	CHECK_FCT( fd_msg_hdr(*msg, &hdr) );
@@ -54,26 +55,45 @@ static int do_send(struct msg ** msg, struct cnxctx * cnx, uint32_t * hbh, struc
 	msg_is_a_req = (hdr->msg_flags & CMD_FLAG_REQUEST);
 	if (msg_is_a_req) {
 		CHECK_PARAMS(hbh && peer);
-		/* Alloc the hop-by-hop id and increment the value for next message */
+		/* Alloc the hop-by-hop id and increment the value for next message. The out thread and the PSM (when the 
+		 peer is not open) may both send requests, so the increment is atomic. */
 		bkp_hbh = hdr->msg_hbhid;
-		hdr->msg_hbhid = *hbh;
-		*hbh = hdr->msg_hbhid + 1;
+		hdr->msg_hbhid = __atomic_fetch_add(hbh, 1, __ATOMIC_RELAXED);
 	}
 	
 	/* Create the message buffer */
-	CHECK_FCT(fd_msg_bufferize( *msg, &buf, &sz ));
-	pthread_cleanup_push( free, buf );
+	CHECK_FCT(fd_msg_bufferize( *msg, buf, sz ));
 	
 	cpy_for_logs_only = *msg;
 	
 	/* Save a request before sending so that there is no race condition with the answer */
 	if (msg_is_a_req) {
-		CHECK_FCT_DO( ret = fd_p_sr_store(&peer->p_sr, msg, &hdr->msg_hbhid, bkp_hbh), goto out );
+		CHECK_FCT_DO( ret = fd_p_sr_store(&peer->p_sr, msg, &hdr->msg_hbhid, bkp_hbh), 
+			{
+				free(*buf);
+				*buf = NULL;
+				return ret;
+			} );
 	}
 	
 	/* Log the message */
 	fd_hook_call(HOOK_MESSAGE_SENT, cpy_for_logs_only, peer, NULL, fd_msg_pmdl_get(cpy_for_logs_only));
 	
+	return 0;
+}
+
+/* Alloc a new hbh for requests, bufferize the message and send on the connection, save in sentreq if provided */
+static int do_send(struct msg ** msg, struct cnxctx * cnx, uint32_t * hbh, struct fd_peer * peer)
+{
+	uint8_t * buf;
+	size_t sz;
+	int ret;
+	
+	TRACE_ENTRY("%p %p %p %p", msg, cnx, hbh, peer);
+	
+	CHECK_FCT( do_prepare(msg, hbh, peer, &buf, &sz) );
+	pthread_cleanup_push( free, buf );
+	
 	pthread_cleanup_push((void *)fd_msg_free, *msg /* might be NULL, no problem */);
 	
 	/* Send the message */
@@ -81,8 +101,6 @@ static int do_send(struct msg ** msg, struct cnxctx * cnx, uint32_t * hbh, struc
 	
 	pthread_cleanup_pop(0);
 	
-out:
-	;	
 	pthread_cleanup_pop(1);
 	
 	if (ret)
@@ -97,12 +115,47 @@ out:
 	return 0;
 }
 
+/* The messages sent together by the out thread */
+struct out_batch {
+	int		nb;
+	struct msg *	msgs[OUT_BATCH_MAX];	/* NULL for the requests saved in sentreq */
+	struct iovec	iov[OUT_BATCH_MAX];	/* the buffers */
+};
+
+/* Free the buffers and the remaining messages of a batch (also on cancelation) */
+static void out_batch_cleanup(void * arg)
+{
+	struct out_batch * batch = arg;
+	int i;
+	for (i = 0; i < batch->nb; i++) {
+		free(batch->iov[i].iov_base);
+		if (batch->msgs[i]) {
+			CHECK_FCT_DO( fd_msg_free(batch->msgs[i]), /* continue */ );
+		}
+	}
+	batch->nb = 0;
+}
+
+/* Report the messages of the batch that could not be sent */
+static void out_batch_dropped(struct out_batch * batch, int err)
+{
+	char buf[256];
+	int i;
+	snprintf(buf, sizeof(buf), "Error while sending this message: %s", strerror(err));
+	for (i = 0; i < batch->nb; i++) {
+		if (batch->msgs[i]) {
+			fd_hook_call(HOOK_MESSAGE_DROPPED, batch->msgs[i], NULL, buf, fd_msg_pmdl_get(batch->msgs[i]));
+		}
+	}
+}
+
 /* The code of the "out" thread */
 static void * out_thr(void * arg)
 {
 	struct fd_peer * peer = arg;
 	int stop = 0;
 	struct msg * msg;
+	struct out_batch batch;
 	ASSERT( CHECK_PEER(peer) );
 	
 	/* Set the thread name */
@@ -111,28 +164,46 @@ static void * out_thr(void * arg)
 		snprintf(buf, sizeof(buf), "OUT/%s", peer->p_hdr.info.pi_diamid);
 		fd_log_threadname ( buf );
 	}
+	fd_thr_bind(FD_THR_OUT, -1);
+	
+	batch.nb = 0;
 	
 	/* Loop until cancelation */
 	while (!stop) {
-		int ret;
+		int ret = 0;
 		
 		/* Retrieve next message to send */
 		CHECK_FCT_DO( fd_fifo_get(peer->p_tosend, &msg), goto error );
 		
-		/* Send the message, log any error */
-		CHECK_FCT_DO( ret = do_send(&msg, peer->p_cnxctx, &peer->p_hbh, peer),
-			{
-				if (msg) {
+		pthread_cleanup_push( out_batch_cleanup, &batch );
+		
+		/* Prepare it, and the messages already waiting behind it */
+		do {
+			CHECK_FCT_DO( ret = do_prepare(&msg, &peer->p_hbh, peer, (uint8_t **)&batch.iov[batch.nb].iov_base, &batch.iov[batch.nb].iov_len),
+				{
 					char buf[256];
 					snprintf(buf, sizeof(buf), "Error while sending this message: %s", strerror(ret));
 					fd_hook_call(HOOK_MESSAGE_DROPPED, msg, NULL, buf, fd_msg_pmdl_get(msg));
 					fd_msg_free(msg);
-				}
-				stop = 1;
-			} );
-			
+					stop = 1;
+					break;
+				} );
+			batch.msgs[batch.nb++] = msg;
+		} while ((batch.nb < OUT_BATCH_MAX) && (fd_fifo_tryget(peer->p_tosend, &msg) == 0));
+		
+		/* Send them, log any error */
+		if (batch.nb) {
+			CHECK_FCT_DO( ret = fd_cnx_send_batch(peer->p_cnxctx, batch.iov, batch.nb),
+				{
+					out_batch_dropped(&batch, ret);
+					stop = 1;
+				} );
+		}
+		
+		/* Free the buffers and the answers */
+		pthread_cleanup_pop(1);
 	}
-	
+
 	/* If we're here it means there was an error on the socket. We need to continue to purge the fifo & until we are canceled */
 	CHECK_FCT_DO( fd_event_send(peer->p_events, FDEVP_CNX_ERROR, 0, NULL), /* What do we do if it fails? */ );
 	
@@ -172,9 +243,7 @@ int fd_out_send(struct msg ** msg, struct cnxctx * cnx, struct fd_peer * peer, i
 		CHECK_FCT( fd_msg_hdr(*msg, &hdr) );
 		if (!(hdr->msg_flags & CMD_FLAG_REQUEST)) {
 			/* Update the count of pending answers to send */
-			CHECK_POSIX( pthread_mutex_lock(&peer->p_state_mtx) );
-			peer->p_reqin_count--;
-			CHECK_POSIX( pthread_mutex_unlock(&peer->p_state_mtx) );			
+			__atomic_sub_fetch(&peer->p_reqin_count, 1, __ATOMIC_RELAXED);
 		}
 	}
 	
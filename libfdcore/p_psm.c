@@ -181,6 +181,7 @@ static int enter_open_state(struct fd_peer * peer)
 			break;
 	}
 	fd_list_insert_before(li, &peer->p_actives);
+	CHECK_FCT_DO( fd_peers_snapshot_update(), /* the routing keeps the previous one */ );
 	CHECK_POSIX( pthread_rwlock_unlock(&fd_g_activ_peers_rw) );
 	
 	/* Callback registered when the peer was added, by fd_peer_add */
@@ -204,6 +205,7 @@ static int leave_open_state(struct fd_peer * peer, int skip_failover)
 	/* Remove from active peers list */
 	CHECK_POSIX( pthread_rwlock_wrlock(&fd_g_activ_peers_rw) );
 	fd_list_unlink( &peer->p_actives );
+	CHECK_FCT_DO( fd_peers_snapshot_update(), /* the routing keeps the previous one */ );
 	CHECK_POSIX( pthread_rwlock_unlock(&fd_g_activ_peers_rw) );
 	
 	/* Stop the "out" thread */
@@ -307,7 +309,7 @@ int fd_psm_change_state(struct fd_peer * peer, int new_state)
 		fd_psm_events_free(peer);
 		
 		/* Reset the counter of pending anwers to send */
-		peer->p_reqin_count = 0;
+		__atomic_store_n(&peer->p_reqin_count, 0, __ATOMIC_RELAXED);
 		
 		/* If the peer is not persistant, we destroy it */
 		if (peer->p_hdr.info.config.pic_flags.persist == PI_PRST_NONE) {
@@ -367,6 +369,8 @@ void fd_psm_cleanup(struct fd_peer * peer, int terminate)
 	}
 	
 	if (terminate) {
+		/* The ingress threads use p_events */
+		fd_in_detach(peer);
 		fd_psm_events_free(peer);
 		CHECK_FCT_DO( fd_fifo_del(&peer->p_events), /* continue */ );
 	}
@@ -408,6 +412,7 @@ static void * p_psm_th( void * arg )
 		snprintf(buf, sizeof(buf), "PSM/%s", peer->p_hdr.info.pi_diamid);
 		fd_log_threadname ( buf );
 	}
+	fd_thr_bind(FD_THR_RECV, -1);
 	
 	/* The state machine starts in CLOSED state */
 	CHECK_POSIX_DO( pthread_mutex_lock(&peer->p_state_mtx), goto psm_end );
@@ -478,6 +483,12 @@ psm_loop:
 		}
 	}
 	
+	/* The routing has caught up with the messages of this peer */
+	if (event == FDEVP_INGRESS_RESUME) {
+		fd_in_resume(peer);
+		goto psm_loop;
+	}
+	
 	/* A message was received */
 	if (event == FDEVP_CNX_MSG_RECV) {
 		struct msg * msg = NULL;
@@ -485,6 +496,37 @@ psm_loop:
 		struct fd_cnx_rcvdata rcv_data;
 		struct fd_msg_pmdl * pmdl = NULL;
 		
+		/* With decoder threads, only the state of the peer is updated here for the routable messages, they decode the message */
+		if (fd_g_config->cnf_dec_thr && fd_in_routable(ev_data, ev_sz)) {
+			switch (cur_state) {
+				case STATE_REOPEN:
+				case STATE_SUSPECT:
+				case STATE_CLOSING:
+				case STATE_CLOSING_GRACE:
+					TRACE_DEBUG(FULL, "Accepted a message while not in OPEN state... ");
+				case STATE_OPEN_NEW:
+				case STATE_OPEN:
+					/* Same as below, but the answers are associated with their request by the decoder */
+					fd_p_expi_activity(peer);
+					
+					if (((uint8_t *)ev_data)[4] & CMD_FLAG_REQUEST) {
+						/* The decoder decrements the count if the request is discarded */
+						__atomic_add_fetch(&peer->p_reqin_count, 1, __ATOMIC_RELAXED);
+					}
+					
+					CHECK_FCT_DO( fd_in_decode(peer, ev_data, ev_sz), goto psm_end );
+					
+					if (cur_state == STATE_OPEN_NEW) {
+						fd_psm_change_state(peer, STATE_OPEN );
+					}
+					goto psm_loop;
+				
+				default:
+					/* The message is discarded below */
+					break;
+			}
+		}
+		
 		rcv_data.buffer = ev_data;
 		rcv_data.length = ev_sz;
 		pmdl = fd_msg_pmdl_get_inbuf(rcv_data.buffer, rcv_data.length);
@@ -548,26 +590,20 @@ psm_loop:
 				/* The standard situation : */
 				case STATE_OPEN_NEW:
 				case STATE_OPEN:
-					/* We received a valid routable message, update the expiry timer */
-					CHECK_FCT_DO( fd_p_expi_update(peer), goto psm_end );
+					/* We received a valid routable message, this delays the expiry of the peer and the next DWR */
+					fd_p_expi_activity(peer);
 
 					/* Set the message source and add the Route-Record */
 					CHECK_FCT_DO( fd_msg_source_setrr( msg, peer->p_hdr.info.pi_diamid, peer->p_hdr.info.pi_diamidlen, fd_g_config->cnf_dict ), goto psm_end);
 
 					if ((hdr->msg_flags & CMD_FLAG_REQUEST)) {
 						/* Mark the incoming request so that we know we have pending answers for this peer */
-						CHECK_POSIX_DO( pthread_mutex_lock(&peer->p_state_mtx), goto psm_end  );
-						peer->p_reqin_count++;
-						CHECK_POSIX_DO( pthread_mutex_unlock(&peer->p_state_mtx), goto psm_end  );
+						__atomic_add_fetch(&peer->p_reqin_count, 1, __ATOMIC_RELAXED);
 					}
 						
-					/* Requeue to the global incoming queue */
-					CHECK_FCT_DO(fd_fifo_post(fd_g_incoming, &msg), goto psm_end );
+					/* Pass the message to the routing (through the ingress queue of the peer) */
+					CHECK_FCT_DO(fd_in_post(peer, &msg), goto psm_end );
 
-					/* Update the peer timer (only in OPEN state) */
-					if ((cur_state == STATE_OPEN) && (!peer->p_flags.pf_dw_pending)) {
-						fd_psm_next_timeout(peer, 1, peer->p_hdr.info.config.pic_twtimer ?: fd_g_config->cnf_timer_tw);
-					}
 					break;
 					
 				/* In other states, we discard the message, it is either old or invalid to send it for the remote peer */
@@ -96,90 +96,61 @@ static void srl_dump(const char * text, struct fd_list * srlist)
 	}
 }
 
-/* thread that handles messages expiring. The thread is started only when needed */
-static void * sr_expiry_th(void * arg) {
+/* Callback of the timer of the list, armed at the timeout of its first expiring request */
+void fd_p_sr_expiry(void * arg)
+{
 	struct sr_list * srlist = arg;
+	struct fd_peer * sentto = srlist->srs.o;
+	struct fd_list expired = FD_LIST_INITIALIZER(expired);
+	struct timespec	now;
 	
 	TRACE_ENTRY("%p", arg);
-	CHECK_PARAMS_DO( arg, return NULL );
+	CHECK_PARAMS_DO( arg, return );
 	
-	/* Set the thread name */
-	{
-		char buf[48];
-		snprintf(buf, sizeof(buf), "ReqExp/%s", ((struct fd_peer *)(srlist->exp.o))->p_hdr.info.pi_diamid);
-		fd_log_threadname ( buf );
-	}
+	CHECK_SYS_DO(  clock_gettime(CLOCK_REALTIME, &now),  return  );
+	CHECK_POSIX_DO( pthread_mutex_lock(&srlist->mtx),  return );
 	
-	do {
-		struct timespec	now;
-		struct sentreq * first;
-		struct msg * request;
-		struct fd_peer * sentto;
-		void (*expirecb)(void *, DiamId_t, size_t, struct msg **);
-		void * data;
-		int no_error;
-
-		CHECK_POSIX_DO( pthread_mutex_lock(&srlist->mtx),  return NULL );
-		pthread_cleanup_push( fd_cleanup_mutex, &srlist->mtx );
-
-loop:	
-		no_error = 0;
-
-		/* Check if there are expiring requests available */
-		if (FD_IS_LIST_EMPTY(&srlist->exp)) {
-			/* Just wait for a change or cancelation */
-			CHECK_POSIX_DO( pthread_cond_wait( &srlist->cnd, &srlist->mtx ), goto unlock );
-			/* Restart the loop on wakeup */
-			goto loop;
-		}
-		
+	while (!FD_IS_LIST_EMPTY(&srlist->exp)) {
 		/* Get the pointer to the request that expires first */
-		first = (struct sentreq *)(srlist->exp.next->o);
+		struct sentreq * first = (struct sentreq *)(srlist->exp.next->o);
 		
-		/* Get the current time */
-		CHECK_SYS_DO(  clock_gettime(CLOCK_REALTIME, &now),  goto unlock  );
-
-		/* If first request is not expired, we just wait until it happens */
+		/* If it is not expired, wait until it happens. The answered requests do not cancel the timer, so it may be early */
 		if ( TS_IS_INFERIOR( &now, &first->timeout ) ) {
-			
-			CHECK_POSIX_DO2(  pthread_cond_timedwait( &srlist->cnd, &srlist->mtx, &first->timeout ),  
-					ETIMEDOUT, /* ETIMEDOUT is a normal return value, continue */,
-					/* on other error, */ goto unlock );
-	
-			/* on wakeup, loop */
-			goto loop;
+			CHECK_FCT_DO( fd_timer_arm(&srlist->tmr, &first->timeout), /* continue anyway */ );
+			break;
 		}
 		
-		/* Now, the first request in the list is expired; remove it and call the expirecb for it */
-		request = first->req;
-		sentto = first->chain.head->o;
-		
 		TRACE_DEBUG(FULL, "Request %x was not answered by %s within the timer delay", *((uint32_t *)first->chain.o), sentto->p_hdr.info.pi_diamid);
 		
 		/* Restore the hbhid */
 		*((uint32_t *)first->chain.o) = first->prevhbh; 
 		
-		/* Free the sentreq information */
+		/* Remove the request from the lists, its expirecb is called below */
 		fd_list_unlink(&first->chain);
-		srlist->cnt--;
+		__atomic_sub_fetch(&srlist->cnt, 1, __ATOMIC_RELAXED);
 		srlist->cnt_lost++; /* We are not waiting for this answer anymore, but the remote peer may still be processing it. */
 		fd_list_unlink(&first->expire);
-		free(first);
+		fd_list_insert_before(&expired, &first->expire);
+	}
+	
+	CHECK_POSIX_DO( pthread_mutex_unlock(&srlist->mtx),  /* continue */ );
+	
+	while (!FD_IS_LIST_EMPTY(&expired)) {
+		struct sentreq * sr = (struct sentreq *)(expired.next->o);
+		struct msg * request = sr->req;
+		void (*expirecb)(void *, DiamId_t, size_t, struct msg **);
+		void * data;
 		
-		no_error = 1;
-unlock:
-		; /* pthread_cleanup_pop sometimes expands as "} ..." and the label before this cause some compilers to complain... */
-		pthread_cleanup_pop( 1 ); /* unlock the mutex */
-		if (!no_error)
-			break;
-
+		/* Free the sentreq information */
+		fd_list_unlink(&sr->expire);
+		free(sr);
 		
 		/* Retrieve callback in the message */
-		CHECK_FCT_DO( fd_msg_anscb_get( request, NULL, &expirecb, &data ), break);
+		CHECK_FCT_DO( fd_msg_anscb_get( request, NULL, &expirecb, &data ), continue );
 		ASSERT(expirecb);
 	
 		/* Clean up this expirecb from the message */
-		CHECK_FCT_DO( fd_msg_anscb_reset( request, 0, 1 ), break);
+		CHECK_FCT_DO( fd_msg_anscb_reset( request, 0, 1 ), continue );
 
 		/* Call it */
 		(*expirecb)(data, sentto->p_hdr.info.pi_diamid, sentto->p_hdr.info.pi_diamidlen, &request);
@@ -189,14 +160,27 @@ unlock:
 			fd_hook_call(HOOK_MESSAGE_DROPPED, request, NULL, "Expiration period completed without an answer, and the expiry callback did not dispose of the message.", fd_msg_pmdl_get(request));
 			CHECK_FCT_DO( fd_msg_free(request), /* ignore */ );
 		}
-	
-	} while (1);
-	
-	ASSERT(0); /* we have encountered a problem, maybe time to signal the framework to terminate? */
-	return NULL;
+	}
 }
 
 
+/* Account the delay of an answer in the average latency of the peer (EWMA of weight 1/8, as the smoothed RTT of TCP). Called with the mutex */
+static void sr_lat_update(struct sr_list * srlist, struct timespec * sent, struct timespec * now)
+{
+	int64_t us = (int64_t)(now->tv_sec - sent->tv_sec) * 1000000 + (now->tv_nsec - sent->tv_nsec) / 1000;
+	int64_t lat = srlist->lat;
+	
+	if (us < 1)
+		us = 1; /* 0 means no answer yet */
+	if (us > (uint32_t)-1)
+		us = (uint32_t)-1;
+	if (lat)
+		lat += (us - lat) / 8;
+	else
+		lat = us;
+	__atomic_store_n(&srlist->lat, (uint32_t)lat, __ATOMIC_RELAXED);
+}
+
 /* Store a new sent request */
 int fd_p_sr_store(struct sr_list * srlist, struct msg **req, uint32_t *hbhloc, uint32_t hbh_restore)
 {
@@ -230,7 +214,7 @@ int fd_p_sr_store(struct sr_list * srlist, struct msg **req, uint32_t *hbhloc, u
 	/* Save in the list */
 	*req = NULL;
 	fd_list_insert_after(prev, &sr->chain);
-	srlist->cnt++;
+	__atomic_add_fetch(&srlist->cnt, 1, __ATOMIC_RELAXED);
 	
 	/* In case of request with a timeout, also store in the timeout list */
 	ts = fd_msg_anscb_gettimeout( sr->req );
@@ -248,14 +232,9 @@ int fd_p_sr_store(struct sr_list * srlist, struct msg **req, uint32_t *hbhloc, u
 		
 		fd_list_insert_after(li, &sr->expire);
 	
-		/* if the thread does not exist yet, create it */
-		if (srlist->thr == (pthread_t)NULL) {
-			CHECK_POSIX_DO( pthread_create(&srlist->thr, NULL, sr_expiry_th, srlist), /* continue anyway */);
-		} else {
-			/* or, if added in first position, signal the condvar to update the sleep time of the thread */
-			if (li == &srlist->exp) {
-				CHECK_POSIX_DO( pthread_cond_signal(&srlist->cnd), /* continue anyway */);
-			}
+		/* if added in first position, the timer must expire earlier */
+		if (li == &srlist->exp) {
+			CHECK_FCT_DO( fd_timer_arm(&srlist->tmr, &sr->timeout), /* continue anyway */);
 		}
 	}
 	
@@ -268,9 +247,11 @@ int fd_p_sr_fetch(struct sr_list * srlist, uint32_t hbh, struct msg **req)
 {
 	struct sentreq * sr;
 	int match;
+	struct timespec now;
 	
 	TRACE_ENTRY("%p %x %p", srlist, hbh, req);
 	CHECK_PARAMS(srlist && req);
+	CHECK_SYS( clock_gettime(CLOCK_REALTIME, &now) );
 	
 	/* Search the request in the list */
 	CHECK_POSIX( pthread_mutex_lock(&srlist->mtx) );
@@ -287,14 +268,15 @@ int fd_p_sr_fetch(struct sr_list * srlist, uint32_t hbh, struct msg **req)
 		*((uint32_t *)sr->chain.o) = sr->prevhbh;
 		/* Unlink */
 		fd_list_unlink(&sr->chain);
-		srlist->cnt--;
+		__atomic_sub_fetch(&srlist->cnt, 1, __ATOMIC_RELAXED);
 		fd_list_unlink(&sr->expire);
 		*req = sr->req;
+		sr_lat_update(srlist, &sr->added_on, &now);
 		free(sr);
 	}
 	CHECK_POSIX( pthread_mutex_unlock(&srlist->mtx) );
 	
-	/* do not stop the expire thread here, it might cause creating/destroying it very often otherwise */
+	/* do not cancel the timer here, it is cheaper to let it expire and arm it again for the next request */
 
 	/* Done */
 	return 0;
@@ -307,7 +289,7 @@ void fd_p_sr_failover(struct sr_list * srlist)
 	while (!FD_IS_LIST_EMPTY(&srlist->srs)) {
 		struct sentreq * sr = (struct sentreq *)(srlist->srs.next);
 		fd_list_unlink(&sr->chain);
-		srlist->cnt--;
+		__atomic_sub_fetch(&srlist->cnt, 1, __ATOMIC_RELAXED);
 		fd_list_unlink(&sr->expire);
 		if (fd_msg_is_routable(sr->req)) {
 			struct msg_hdr * hdr = NULL;
@@ -324,7 +306,7 @@ void fd_p_sr_failover(struct sr_list * srlist)
 			fd_hook_call(HOOK_MESSAGE_FAILOVER, sr->req, (struct fd_peer *)srlist->srs.o, NULL, fd_msg_pmdl_get(sr->req));
 			
 			/* Requeue for sending to another peer */
-			CHECK_FCT_DO( ret = fd_fifo_post_noblock(fd_g_outgoing, (void *)&sr->req),
+			CHECK_FCT_DO( ret = fd_fifo_post_noblock(FD_SHARD(sr->req)->outgoing, (void *)&sr->req),
 				{
 					char buf[256];
 					snprintf(buf, sizeof(buf), "Internal error: error while requeuing during failover: %s", strerror(ret));
@@ -344,7 +326,7 @@ void fd_p_sr_failover(struct sr_list * srlist)
 	
 	CHECK_POSIX_DO( pthread_mutex_unlock(&srlist->mtx), /* continue anyway */ );
 	
-	/* Terminate the expiry thread (must be done when the lock can be taken) */
-	CHECK_FCT_DO( fd_thr_term(&srlist->thr), /* ignore error */ );
+	/* Cancel the timer (must be done without the lock, that its callback takes) */
+	CHECK_FCT_DO( fd_timer_cancel(&srlist->tmr), /* ignore error */ );
 }
 
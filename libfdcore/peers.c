@@ -43,6 +43,10 @@ pthread_rwlock_t fd_g_peers_rw = PTHREAD_RWLOCK_INITIALIZER;
 struct fd_list   fd_g_activ_peers = FD_LIST_INITIALIZER(fd_g_activ_peers);	/* peers linked by their p_actives oredered by p_diamid */
 pthread_rwlock_t fd_g_activ_peers_rw = PTHREAD_RWLOCK_INITIALIZER;
 
+/* Its current snapshot, protected by fd_g_activ_peers_rw as well */
+static struct fd_peers_snapshot * activ_snapshot = NULL;
+static uint64_t activ_version = 0;
+
 /* List of validation callbacks (registered with fd_peer_validate_register) */
 static struct fd_list validators = FD_LIST_INITIALIZER(validators);	/* list items are simple fd_list with "o" pointing to the callback */
 static pthread_rwlock_t validators_rw = PTHREAD_RWLOCK_INITIALIZER;
@@ -72,10 +76,12 @@ int fd_peer_alloc(struct fd_peer ** ptr)
 	fd_list_init(&p->p_hdr.info.runtime.pir_apps, p);
 	
 	p->p_eyec = EYEC_PEER;
+	p->p_refcount = 1;
 	CHECK_POSIX( pthread_mutex_init(&p->p_state_mtx, NULL) );
 	
 	fd_list_init(&p->p_actives, p);
-	fd_list_init(&p->p_expiry, p);
+	fd_timer_init(&p->p_exp_timer, fd_p_expi_timeout, p, 0);
+	CHECK_FCT( fd_in_peer_init(p) );
 	CHECK_FCT( fd_fifo_new(&p->p_tosend, 5) );
 	CHECK_FCT( fd_fifo_new(&p->p_tofailover, 0) );
 	p->p_hbh = lrand48();
@@ -83,13 +89,227 @@ int fd_peer_alloc(struct fd_peer ** ptr)
 	fd_list_init(&p->p_sr.srs, p);
 	fd_list_init(&p->p_sr.exp, p);
 	CHECK_POSIX( pthread_mutex_init(&p->p_sr.mtx, NULL) );
-	CHECK_POSIX( pthread_cond_init(&p->p_sr.cnd, NULL) );
+	fd_timer_init(&p->p_sr.tmr, fd_p_sr_expiry, &p->p_sr, FD_TIMER_BLOCKING);
 	
 	fd_list_init(&p->p_connparams, p);
 	
 	return 0;
 }
 
+/* Release a reference to the structure, the last one frees it */
+static void peer_put(struct fd_peer * p)
+{
+	if (__atomic_sub_fetch(&p->p_refcount, 1, __ATOMIC_ACQ_REL) == 0)
+		free(p);
+}
+
+/* Order of the identities in the indexes of the snapshot. Two identities are equal if fd_os_almostcasesrch finds them equal. */
+static int snap_casecmp(uint8_t * os1, size_t os1sz, uint8_t * os2, size_t os2sz)
+{
+	size_t i;
+	
+	if (os1sz != os2sz)
+		return (os1sz < os2sz) ? -1 : 1;
+	
+	for (i = 0; i < os1sz; i++) {
+		uint8_t a = os1[i], b = os2[i];
+		if ((a >= 'A') && (a <= 'Z'))
+			a += 'a' - 'A';
+		if ((b >= 'A') && (b <= 'Z'))
+			b += 'a' - 'A';
+		if (a != b)
+			return (a < b) ? -1 : 1;
+	}
+	
+	return 0;
+}
+
+static int snap_hostcmp(const void * a, const void * b)
+{
+	struct rtd_candidate * ca = *(struct rtd_candidate **)a, * cb = *(struct rtd_candidate **)b;
+	return snap_casecmp((uint8_t *)ca->diamid, ca->diamidlen, (uint8_t *)cb->diamid, cb->diamidlen);
+}
+
+static int snap_realmcmp(const void * a, const void * b)
+{
+	struct rtd_candidate * ca = *(struct rtd_candidate **)a, * cb = *(struct rtd_candidate **)b;
+	return snap_casecmp((uint8_t *)ca->realm, ca->realmlen, (uint8_t *)cb->realm, cb->realmlen);
+}
+
+/* Build a new snapshot of the active peers list and publish it. The previous one is freed once the last message routed with it releases it. */
+int fd_peers_snapshot_update(void)
+{
+	struct fd_peers_snapshot * snap;
+	struct fd_list * li;
+	size_t sz;
+	int nb = 0, i;
+	char * str;
+	
+	TRACE_ENTRY();
+	
+	/* One block for the array, the indexes and the strings */
+	sz = sizeof(struct fd_peers_snapshot);
+	for (li = fd_g_activ_peers.next; li != &fd_g_activ_peers; li = li->next) {
+		struct fd_peer * p = (struct fd_peer *)li->o;
+		sz += sizeof(struct rtd_candidate) + 3 * sizeof(struct rtd_candidate *);
+		sz += p->p_hdr.info.pi_diamidlen + 1 + p->p_hdr.info.runtime.pir_realmlen + 1;
+		nb++;
+	}
+	CHECK_MALLOC( snap = malloc(sz) );
+	memset(snap, 0, sizeof(struct fd_peers_snapshot) + nb * sizeof(struct rtd_candidate));
+	snap->refcount = 1;
+	snap->version = ++activ_version;
+	snap->by_host = (struct rtd_candidate **)&snap->peers[nb];
+	snap->by_realm = snap->by_host + nb;
+	snap->any = snap->by_realm + nb;
+	
+	str = (char *)(snap->any + nb);
+	for (li = fd_g_activ_peers.next; li != &fd_g_activ_peers; li = li->next) {
+		struct fd_peer * p = (struct fd_peer *)li->o;
+		struct rtd_candidate * c = &snap->peers[snap->nb];
+		
+		/* The peer structure remains allocated as long as the snapshot, for the routing callbacks that use c->peer */
+		__atomic_add_fetch(&p->p_refcount, 1, __ATOMIC_RELAXED);
+		c->peer = p;
+		
+		snap->by_host[snap->nb] = c;
+		snap->by_realm[snap->nb] = c;
+		snap->nb++;
+		if (p->p_hdr.info.runtime.pir_relay || (p->p_hdr.info.config.pic_flags.rtdef == PI_RTDEF_ALWAYS))
+			snap->any[snap->nb_any++] = c;
+		
+		memcpy(str, p->p_hdr.info.pi_diamid, p->p_hdr.info.pi_diamidlen);
+		str[p->p_hdr.info.pi_diamidlen] = '\0';
+		c->diamid = str;
+		c->diamidlen = p->p_hdr.info.pi_diamidlen;
+		str += c->diamidlen + 1;
+		
+		if (p->p_hdr.info.runtime.pir_realm) {
+			memcpy(str, p->p_hdr.info.runtime.pir_realm, p->p_hdr.info.runtime.pir_realmlen);
+			str[p->p_hdr.info.runtime.pir_realmlen] = '\0';
+			c->realm = str;
+			c->realmlen = p->p_hdr.info.runtime.pir_realmlen;
+			str += c->realmlen + 1;
+		}
+	}
+	
+	/* The indexes used to select the candidates of a request */
+	qsort(snap->by_host, nb, sizeof(struct rtd_candidate *), snap_hostcmp);
+	qsort(snap->by_realm, nb, sizeof(struct rtd_candidate *), snap_realmcmp);
+	for (i = 1; i < nb; i++) {
+		/* Several peers with the same identity except for the case are unexpected, but handled by fd_peers_snapshot_select */
+		if (!snap_hostcmp(&snap->by_host[i - 1], &snap->by_host[i])) {
+			TRACE_DEBUG(INFO, "Active peers '%s' and '%s' have the same identity", snap->by_host[i - 1]->diamid, snap->by_host[i]->diamid);
+		}
+	}
+	
+	if (activ_snapshot)
+		fd_peers_snapshot_put(activ_snapshot);
+	activ_snapshot = snap;
+	
+	return 0;
+}
+
+/* Get a reference to the current snapshot (NULL if no peer was ever active) */
+struct fd_peers_snapshot * fd_peers_snapshot_get(void)
+{
+	struct fd_peers_snapshot * snap;
+	
+	CHECK_POSIX_DO( pthread_rwlock_rdlock(&fd_g_activ_peers_rw), return NULL );
+	snap = activ_snapshot;
+	if (snap)
+		__atomic_add_fetch(&snap->refcount, 1, __ATOMIC_RELAXED);
+	CHECK_POSIX_DO( pthread_rwlock_unlock(&fd_g_activ_peers_rw), /* continue */ );
+	
+	return snap;
+}
+
+/* Release the reference */
+void fd_peers_snapshot_put(struct fd_peers_snapshot * snap)
+{
+	int i;
+	
+	if (snap && (__atomic_sub_fetch(&snap->refcount, 1, __ATOMIC_ACQ_REL) == 0)) {
+		for (i = 0; i < snap->nb; i++)
+			peer_put(snap->peers[i].peer);
+		free(snap);
+	}
+}
+
+/* Search the range of items of the index (ordered by cmp) that match the key */
+static void snap_range(struct rtd_candidate ** idx, int nb, struct rtd_candidate * key, int (*cmp)(const void *, const void *), int * first, int * last)
+{
+	int lo = 0, hi = nb;
+	
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (cmp(&idx[mid], &key) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	*first = lo;
+	
+	while ((lo < nb) && !cmp(&idx[lo], &key))
+		lo++;
+	*last = lo;
+}
+
+/* Order of the peers in the snapshot, i.e. by diamid */
+static int snap_ptrcmp(const void * a, const void * b)
+{
+	struct rtd_candidate * ca = *(struct rtd_candidate **)a, * cb = *(struct rtd_candidate **)b;
+	return (ca > cb) - (ca < cb);
+}
+
+/* Select in the snapshot the peers that can serve a request for the destination host (if not NULL) and realm: the Destination-Host,
+ the peers of the Destination-Realm, the relays and Default_Route peers. The nb selected peers are copied in sel (room for snap->nb items),
+ ordered by diamid as expected by fd_rtd_candidate_add_array. */
+int fd_peers_snapshot_select(struct fd_peers_snapshot * snap, uint8_t * host, size_t hostlen, uint8_t * realm, size_t realmlen, struct rtd_candidate * sel, int * nb)
+{
+	struct rtd_candidate key, * local[64], ** found = local;
+	int r_first, r_last, h_first = 0, h_last = 0, nb_found = 0, i;
+	
+	TRACE_ENTRY("%p %p %zd %p %zd %p %p", snap, host, hostlen, realm, realmlen, sel, nb);
+	CHECK_PARAMS( snap && realm && sel && nb );
+	
+	memset(&key, 0, sizeof(key));
+	key.realm = (DiamId_t)realm;
+	key.realmlen = realmlen;
+	snap_range(snap->by_realm, snap->nb, &key, snap_realmcmp, &r_first, &r_last);
+	if (host) {
+		key.diamid = (DiamId_t)host;
+		key.diamidlen = hostlen;
+		snap_range(snap->by_host, snap->nb, &key, snap_hostcmp, &h_first, &h_last);
+	}
+	
+	/* Gather them, a peer may be found several times */
+	i = (r_last - r_first) + (h_last - h_first) + snap->nb_any;
+	if (i > sizeof(local) / sizeof(local[0])) {
+		CHECK_MALLOC( found = malloc(i * sizeof(struct rtd_candidate *)) );
+	}
+	for (i = r_first; i < r_last; i++)
+		found[nb_found++] = snap->by_realm[i];
+	for (i = h_first; i < h_last; i++)
+		found[nb_found++] = snap->by_host[i];
+	for (i = 0; i < snap->nb_any; i++)
+		found[nb_found++] = snap->any[i];
+	
+	/* Order them like in the snapshot and remove the duplicates */
+	qsort(found, nb_found, sizeof(struct rtd_candidate *), snap_ptrcmp);
+	*nb = 0;
+	for (i = 0; i < nb_found; i++) {
+		if (i && (found[i] == found[i - 1]))
+			continue;
+		sel[(*nb)++] = *found[i];
+	}
+	
+	if (found != local)
+		free(found);
+	
+	return 0;
+}
+
 /* Add a new peer entry */
 int fd_peer_add ( struct peer_info * info, const char * orig_dbg, void (*cb)(struct peer_info *, void *), void * cb_data )
 {
@@ -245,7 +465,7 @@ void fd_peer_failover_msg(struct fd_peer * peer)
 		/* but only if they are routable */
 		if (fd_msg_is_routable(m)) {
 			fd_hook_call(HOOK_MESSAGE_FAILOVER, m, peer, NULL, fd_msg_pmdl_get(m));
-			CHECK_FCT_DO(fd_fifo_post_noblock(fd_g_outgoing, (void *)&m), 
+			CHECK_FCT_DO(fd_fifo_post_noblock(FD_SHARD(m)->outgoing, (void *)&m), 
 				{
 					/* fallback: destroy the message */
 					fd_hook_call(HOOK_MESSAGE_DROPPED, m, NULL, "Internal error: unable to requeue this message during failover process", fd_msg_pmdl_get(m));
@@ -261,7 +481,7 @@ void fd_peer_failover_msg(struct fd_peer * peer)
 	/* Requeue all messages in the "failover" queue */
 	while ( fd_fifo_tryget(peer->p_tofailover, &m) == 0 ) {
 		fd_hook_call(HOOK_MESSAGE_FAILOVER, m, peer, NULL, fd_msg_pmdl_get(m));
-		CHECK_FCT_DO(fd_fifo_post_noblock(fd_g_outgoing, (void *)&m), 
+		CHECK_FCT_DO(fd_fifo_post_noblock(FD_SHARD(m)->outgoing, (void *)&m), 
 			{
 				/* fallback: destroy the message */
 				fd_hook_call(HOOK_MESSAGE_DROPPED, m, NULL, "Internal error: unable to requeue this message during failover process", fd_msg_pmdl_get(m));
@@ -294,6 +514,27 @@ int fd_peer_cnx_proto_info(struct peer_hdr *peer, char * buf, size_t len)
 	return 0;
 }
 
+/* Receive statistics of the current connection */
+int fd_peer_cnx_rcv_stats(struct peer_hdr *peer, unsigned long long * msgs, unsigned long long * calls)
+{
+	struct fd_peer * p = (struct fd_peer *)peer;
+	TRACE_ENTRY("%p %p %p", peer, msgs, calls);
+	CHECK_PARAMS(CHECK_PEER(peer));
+	
+	if (p->p_cnxctx) {
+		CHECK_FCT(fd_cnx_rcv_stats(p->p_cnxctx, msgs, calls));
+	} else if (p->p_receiver) {
+		CHECK_FCT(fd_cnx_rcv_stats(p->p_receiver, msgs, calls));
+	} else {
+		if (msgs)
+			*msgs = 0;
+		if (calls)
+			*calls = 0;
+	}
+	
+	return 0;
+}
+
 /* Return the value of srlist->cnt */
 int fd_peer_get_load_pending(struct peer_hdr *peer, long * to_receive, long * to_send)
 {
@@ -301,16 +542,25 @@ int fd_peer_get_load_pending(struct peer_hdr *peer, long * to_receive, long * to
 	TRACE_ENTRY("%p %p %p", peer, to_receive, to_send);
 	CHECK_PARAMS(CHECK_PEER(peer));
 	
-	if (to_receive) {
-		CHECK_POSIX( pthread_mutex_lock(&p->p_sr.mtx) );
-		*to_receive = p->p_sr.cnt;
-		CHECK_POSIX( pthread_mutex_unlock(&p->p_sr.mtx) );
-	}
-	if (to_send) {
-		CHECK_POSIX( pthread_mutex_lock(&p->p_state_mtx) );
-		*to_send = p->p_reqin_count;
-		CHECK_POSIX( pthread_mutex_unlock(&p->p_state_mtx) );
-	}
+	/* The counters are modified atomically, no need for the locks here */
+	if (to_receive)
+		*to_receive = __atomic_load_n(&p->p_sr.cnt, __ATOMIC_RELAXED);
+	if (to_send)
+		*to_send = __atomic_load_n(&p->p_reqin_count, __ATOMIC_RELAXED);
+	
+	return 0;
+}
+
+/* Same, with the average delay of the answers */
+int fd_peer_get_load(struct peer_hdr *peer, struct fd_peer_load * load)
+{
+	struct fd_peer * p = (struct fd_peer *)peer;
+	TRACE_ENTRY("%p %p", peer, load);
+	CHECK_PARAMS(CHECK_PEER(peer) && load);
+	
+	load->to_receive = __atomic_load_n(&p->p_sr.cnt, __ATOMIC_RELAXED);
+	load->to_send = __atomic_load_n(&p->p_reqin_count, __ATOMIC_RELAXED);
+	load->latency = __atomic_load_n(&p->p_sr.lat, __ATOMIC_RELAXED);
 	
 	return 0;
 }
@@ -342,21 +592,22 @@ int fd_peer_free(struct fd_peer ** ptr)
 	
 	free_null(p->p_dbgorig);
 	
-	fd_list_unlink(&p->p_expiry);
+	CHECK_FCT_DO( fd_timer_cancel(&p->p_exp_timer), /* continue */ );
 	fd_list_unlink(&p->p_actives);
 	
+	fd_in_peer_fini(p);
 	CHECK_FCT_DO( fd_fifo_del(&p->p_tosend), /* continue */ );
 	CHECK_FCT_DO( fd_fifo_del(&p->p_tofailover), /* continue */ );
 	CHECK_POSIX_DO( pthread_mutex_destroy(&p->p_state_mtx), /* continue */);
+	CHECK_FCT_DO( fd_timer_cancel(&p->p_sr.tmr), /* continue */);
 	CHECK_POSIX_DO( pthread_mutex_destroy(&p->p_sr.mtx), /* continue */);
-	CHECK_POSIX_DO( pthread_cond_destroy(&p->p_sr.cnd), /* continue */);
 	
 	/* If the callback is still around... */
 	if (p->p_cb)
 		(*p->p_cb)(NULL, p->p_cb_data);
 	
-	/* Free the structure */
-	free(p);
+	/* Free the structure, unless a snapshot of the active peers still references it */
+	peer_put(p);
 	return 0;
 }
 
@@ -436,6 +687,12 @@ int fd_peer_fini()
 		fd_peer_free(&peer);
 	}
 	
+	/* And the snapshot of the active peers */
+	CHECK_FCT_DO( pthread_rwlock_wrlock(&fd_g_activ_peers_rw), /* continue */ );
+	fd_peers_snapshot_put(activ_snapshot);
+	activ_snapshot = NULL;
+	CHECK_FCT_DO( pthread_rwlock_unlock(&fd_g_activ_peers_rw), /* continue */ );
+	
 	/* Now empty the validators list */
 	CHECK_FCT_DO( pthread_rwlock_wrlock(&validators_rw), /* continue */ );
 	while (!FD_IS_LIST_EMPTY( &validators )) {
@@ -468,7 +725,7 @@ DECLARE_FD_DUMP_PROTOTYPE(fd_peer_dump, struct peer_hdr * p, int details)
 			}
 		}
 		if (details > 1) {
-			CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, " [from:%s] flags:%s%s%s%s%s%s%s%s lft:%ds", 
+			CHECK_MALLOC_DO( fd_dump_extend( FD_DUMP_STD_PARAMS, " [from:%s] flags:%s%s%s%s%s%s%s%s%s lft:%ds", 
 				peer->p_dbgorig ?: "unset",
 				peer->p_hdr.info.config.pic_flags.pro3 == PI_P3_DEFAULT ? "-" :
 					(peer->p_hdr.info.config.pic_flags.pro3 == PI_P3_IP ? "4" : "6"),
@@ -480,6 +737,7 @@ DECLARE_FD_DUMP_PROTOTYPE(fd_peer_dump, struct peer_hdr * p, int details)
 				peer->p_hdr.info.config.pic_flags.sctpsec & PI_SCTPSEC_3436 ? "3" :"-",
 				peer->p_hdr.info.config.pic_flags.exp ? "E" : "-",
 				peer->p_hdr.info.config.pic_flags.persist ? "P" : "-",
+				peer->p_hdr.info.config.pic_flags.rtdef ? "D" : "-",
 				peer->p_hdr.info.config.pic_lft), return NULL);
 		}
 	
@@ -35,21 +35,69 @@
 
 #include "fdcore-internal.h"
 
-/* The global message queues */
-struct fifo * fd_g_incoming = NULL;
-struct fifo * fd_g_outgoing = NULL;
-struct fifo * fd_g_local = NULL;
+/* The message queues of each routing shard */
+struct fd_shard fd_g_shards[FD_SHARDS_MAX];
 
-/* Initialize the message queues. */
+/* Used to assign the messages to the shards */
+static struct dict_object * sid_model = NULL;
+
+static int shard_queues_new(struct fd_shard * s)
+{
+	CHECK_FCT( fd_fifo_new ( &s->incoming, 20 ) );
+	CHECK_FCT( fd_fifo_new ( &s->outgoing, 30 ) );
+	CHECK_FCT( fd_fifo_new ( &s->local, 25 ) );
+	return 0;
+}
+
+/* Initialize the message queues (of the first shard, the configuration is not parsed yet). */
 int fd_queues_init(void)
 {
 	TRACE_ENTRY();
-	CHECK_FCT( fd_fifo_new ( &fd_g_incoming, 20 ) );
-	CHECK_FCT( fd_fifo_new ( &fd_g_outgoing, 30 ) );
-	CHECK_FCT( fd_fifo_new ( &fd_g_local, 25 ) );
+	CHECK_FCT( shard_queues_new(&fd_g_shards[0]) );
 	return 0;
 }
 
+/* Initialize the queues of the other shards, once the configuration is known */
+int fd_queues_shards_init(void)
+{
+	int i;
+	
+	TRACE_ENTRY();
+	CHECK_PARAMS( fd_g_config->cnf_shards <= FD_SHARDS_MAX );
+	
+	if (fd_g_config->cnf_shards > 1) {
+		CHECK_FCT( fd_dict_search( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME, "Session-Id", &sid_model, ENOENT) );
+	}
+	
+	for (i = 1; i < fd_g_config->cnf_shards; i++) {
+		CHECK_FCT( shard_queues_new(&fd_g_shards[i]) );
+	}
+	return 0;
+}
+
+/* Shard processing a message: by hash of the Session-Id, or the End-to-End identifier for messages without session. An answer
+ carries the same values as its request, so it is processed in the shard that sent the request. */
+int fd_shard_of(struct msg * msg)
+{
+	struct msg_hdr * hdr;
+	struct avp * avp = NULL;
+	struct avp_hdr * ahdr;
+	uint32_t hash;
+	
+	if (fd_g_config->cnf_shards <= 1)
+		return 0;
+	
+	CHECK_FCT_DO( fd_msg_hdr(msg, &hdr), return 0 );
+	hash = hdr->msg_eteid;
+	
+	if ((fd_msg_search_avp(msg, sid_model, &avp) == 0) && avp 
+	  && (fd_msg_avp_hdr(avp, &ahdr) == 0) && ahdr->avp_value) {
+		hash = fd_os_hash(ahdr->avp_value->os.data, ahdr->avp_value->os.len);
+	}
+	
+	return hash % fd_g_config->cnf_shards;
+}
+
 /* Destroy a queue after emptying it (and dumping the content) */
 int fd_queues_fini(struct fifo ** queue)
 {
@@ -45,6 +45,7 @@ static struct fd_list 	rt_fwd_list = FD_LIST_INITIALIZER_O(rt_fwd_list, &rt_fwd_
 
 static pthread_rwlock_t rt_out_lock = PTHREAD_RWLOCK_INITIALIZER;
 static struct fd_list 	rt_out_list = FD_LIST_INITIALIZER_O(rt_out_list, &rt_out_lock);
+static int		rt_out_cacheable = 0; /* number of cacheable handlers in rt_out_list */
 
 /* Items in the lists are the same */
 struct rt_hdl {
@@ -59,6 +60,7 @@ struct rt_hdl {
 		int (*rt_fwd_cb)(void * cbdata, struct msg ** msg);
 		int (*rt_out_cb)(void * cbdata, struct msg ** msg, struct fd_list * candidates);
 	};
+	int		cacheable; /* OUT handler whose scores can be saved in the routing cache */
 };	
 
 /* Add a new entry in the list */
@@ -154,6 +156,9 @@ int fd_rt_out_register ( int (*rt_out_cb)(void * cbdata, struct msg ** pmsg, str
 	/* Save this in the list */
 	CHECK_FCT( add_ordered(new, &rt_out_list) );
 	
+	/* The saved decisions did not include it */
+	fd_rt_cache_flush();
+	
 	/* Give it back to the extension if needed */
 	if (handler)
 		*handler = (void *)new;
@@ -161,6 +166,36 @@ int fd_rt_out_register ( int (*rt_out_cb)(void * cbdata, struct msg ** pmsg, str
 	return 0;
 }
 
+/* The scores of this OUT callback can be cached */
+int fd_rt_out_set_cacheable ( struct fd_rt_out_hdl * handler )
+{
+	struct rt_hdl * hdl;
+	TRACE_ENTRY( "%p", handler);
+	CHECK_PARAMS( handler );
+	
+	hdl = (struct rt_hdl *)handler;
+	CHECK_PARAMS( hdl->chain.head == &rt_out_list );
+	
+	CHECK_POSIX( pthread_rwlock_wrlock(&rt_out_lock) );
+	if (!hdl->cacheable) {
+		hdl->cacheable = 1;
+		rt_out_cacheable++;
+	}
+	CHECK_POSIX( pthread_rwlock_unlock(&rt_out_lock) );
+	
+	fd_rt_cache_flush();
+	
+	return 0;
+}
+
+/* Counters of the routing cache */
+int fd_rt_out_cache_stats ( unsigned long long * hits, unsigned long long * misses )
+{
+	TRACE_ENTRY( "%p %p", hits, misses);
+	fd_rt_cache_getstats(hits, misses);
+	return 0;
+}
+
 /* Remove it */
 int fd_rt_out_unregister ( struct fd_rt_out_hdl * handler, void ** cbdata )
 {
@@ -174,8 +209,13 @@ int fd_rt_out_unregister ( struct fd_rt_out_hdl * handler, void ** cbdata )
 	/* Unlink */
 	CHECK_POSIX( pthread_rwlock_wrlock(&rt_out_lock) );
 	fd_list_unlink(&del->chain);
+	if (del->cacheable)
+		rt_out_cacheable--;
 	CHECK_POSIX( pthread_rwlock_unlock(&rt_out_lock) );
 	
+	/* The saved decisions included it */
+	fd_rt_cache_flush();
+	
 	if (cbdata)
 		*cbdata = del->cbdata;
 	
@@ -220,18 +260,13 @@ static int dont_send_if_no_common_app(void * cbdata, struct msg ** pmsg, struct
 	return 0;
 }
 
-/* Detect if the Destination-Host and Destination-Realm match the peer */
-static int score_destination_avp(void * cbdata, struct msg ** pmsg, struct fd_list * candidates)
+/* Search the Destination-Host and Destination-Realm AVPs of a request (the values are NULL if not found) */
+static int get_destination(struct msg * msg, union avp_value ** pdh, union avp_value ** pdr)
 {
-	struct msg * msg = *pmsg;
-	struct fd_list * li;
 	struct avp * avp;
 	union avp_value *dh = NULL, *dr = NULL;
 	
-	TRACE_ENTRY("%p %p %p", cbdata, msg, candidates);
-	CHECK_PARAMS(msg && candidates);
-	
-	/* Search the Destination-Host and Destination-Realm AVPs -- we could also use fd_msg_search_avp here, but this one is slightly more efficient */
+	/* We could also use fd_msg_search_avp here, but this one is slightly more efficient */
 	CHECK_FCT(  fd_msg_browse(msg, MSG_BRW_FIRST_CHILD, &avp, NULL) );
 	while (avp) {
 		struct avp_hdr * ahdr;
@@ -262,6 +297,24 @@ static int score_destination_avp(void * cbdata, struct msg ** pmsg, struct fd_li
 		CHECK_FCT(  fd_msg_browse(avp, MSG_BRW_NEXT, &avp, NULL) );
 	}
 	
+	*pdh = dh;
+	*pdr = dr;
+	return 0;
+}
+
+/* Detect if the Destination-Host and Destination-Realm match the peer */
+static int score_destination_avp(void * cbdata, struct msg ** pmsg, struct fd_list * candidates)
+{
+	struct msg * msg = *pmsg;
+	struct fd_list * li;
+	union avp_value *dh = NULL, *dr = NULL;
+	
+	TRACE_ENTRY("%p %p %p", cbdata, msg, candidates);
+	CHECK_PARAMS(msg && candidates);
+	
+	/* Search the Destination-Host and Destination-Realm AVPs */
+	CHECK_FCT( get_destination(msg, &dh, &dr) );
+	
 	/* Now, check each candidate against these AVP values */
 	for (li = candidates->next; li != candidates; li = li->next) {
 		struct rtd_candidate *c = (struct rtd_candidate *) li;
@@ -412,7 +465,7 @@ static int return_error(struct msg ** pmsg, char * error_code, char * error_mess
 
 	/* Send the answer */
 	if (is_loc) {
-		CHECK_FCT( fd_fifo_post(fd_g_incoming, pmsg) );
+		CHECK_FCT( fd_fifo_post(FD_SHARD(*pmsg)->incoming, pmsg) );
 	} else {
 		CHECK_FCT( fd_out_send(pmsg, NULL, peer, 1) );
 	}
@@ -455,7 +508,7 @@ static int msg_dispatch(struct msg * msg)
 				if (!msgptr) {
 					fd_hook_call(HOOK_MESSAGE_PARSING_ERROR2, error, NULL, NULL, fd_msg_pmdl_get(error));
 					/* error now contains the answer message to send back */
-					CHECK_FCT( fd_fifo_post(fd_g_outgoing, &error) );
+					CHECK_FCT( fd_fifo_post(FD_SHARD(error)->outgoing, &error) );
 				} else if (!error) {
 					/* We have received an invalid answer to our query */
 					fd_hook_call(HOOK_MESSAGE_DROPPED, msgptr, NULL, "Received answer failed the dictionary / rules parsing", fd_msg_pmdl_get(msgptr));
@@ -508,9 +561,9 @@ static int msg_dispatch(struct msg * msg)
 			case DISP_ACT_CONT:
 				/* No callback has handled the message, let's reply with a generic error or relay it */
 				if (!fd_g_config->cnf_flags.no_fwd) {
-					/* requeue to fd_g_outgoing */
+					/* requeue to the outgoing queue */
 					fd_hook_call(HOOK_MESSAGE_ROUTING_FORWARD, msgptr, NULL, NULL, fd_msg_pmdl_get(msgptr));
-					CHECK_FCT( fd_fifo_post(fd_g_outgoing, &msgptr) );
+					CHECK_FCT( fd_fifo_post(FD_SHARD(msgptr)->outgoing, &msgptr) );
 					break;
 				}
 				/* We don't relay => reply error */
@@ -535,7 +588,7 @@ static int msg_dispatch(struct msg * msg)
 				
 			case DISP_ACT_SEND:
 				/* Now, send the message */
-				CHECK_FCT( fd_fifo_post(fd_g_outgoing, &msgptr) );
+				CHECK_FCT( fd_fifo_post(FD_SHARD(msgptr)->outgoing, &msgptr) );
 		}
 	} else if (em) {
 		fd_hook_call(HOOK_MESSAGE_DROPPED, error, NULL, em, fd_msg_pmdl_get(error));
@@ -546,6 +599,58 @@ static int msg_dispatch(struct msg * msg)
 	return 0;
 }
 
+/* Check if a received message is a normal answer to a request issued locally, and return this request */
+static struct msg * local_answer_query(struct msg * msg)
+{
+	struct msg_hdr * hdr;
+	struct msg * qry = NULL;
+	DiamId_t qry_src = NULL;
+	
+	CHECK_FCT_DO( fd_msg_hdr(msg, &hdr), return NULL );
+	if (hdr->msg_flags & (CMD_FLAG_REQUEST | CMD_FLAG_ERROR))
+		return NULL; /* The error answers are passed to the FWD callbacks (e.g. rt_busypeers) */
+	
+	CHECK_FCT_DO( fd_msg_answ_getq( msg, &qry ), return NULL );
+	if (!qry)
+		return NULL;
+	CHECK_FCT_DO( fd_msg_source_get( qry, &qry_src, NULL ), return NULL );
+	return qry_src ? NULL : qry;
+}
+
+/* Called for each routable message received, once an answer is associated with its request. With InlineAnswerCallbacks, 
+ the answers to fd_msg_send with a callback are handled by the calling thread. *pmsg is NULL on return if the message was taken. */
+int fd_rtdisp_answer(struct msg ** pmsg)
+{
+	struct msg * qry;
+	void (*anscb)(void *, struct msg **) = NULL;
+	
+	if (!fd_g_config->cnf_flags.inl_ans)
+		return 0;
+	
+	qry = local_answer_query(*pmsg);
+	if (!qry)
+		return 0;
+	CHECK_FCT( fd_msg_anscb_get( qry, &anscb, NULL, NULL ) );
+	if (!anscb)
+		return 0;
+	
+	fd_hook_call(HOOK_MESSAGE_ROUTING_LOCAL, *pmsg, NULL, NULL, fd_msg_pmdl_get(*pmsg));
+	CHECK_FCT( msg_dispatch(*pmsg) );
+	*pmsg = NULL;
+	return 0;
+}
+
+/* The queue where a routable message received from a peer is posted. The normal answers to the requests issued locally do not need
+ the ROUTING-IN step (see msg_rt_in): they are passed directly to the dispatch. */
+struct fifo * fd_rtdisp_queue(struct msg * msg)
+{
+	if (local_answer_query(msg)) {
+		fd_hook_call(HOOK_MESSAGE_ROUTING_LOCAL, msg, NULL, NULL, fd_msg_pmdl_get(msg));
+		return FD_SHARD(msg)->local;
+	}
+	return FD_SHARD(msg)->incoming;
+}
+
 /* The ROUTING-IN message processing */
 static int msg_rt_in(struct msg * msg)
 {
@@ -721,7 +826,7 @@ static int msg_rt_in(struct msg * msg)
 			if (is_local_app == YES) {
 				/* Ok, give the message to the dispatch thread */
 				fd_hook_call(HOOK_MESSAGE_ROUTING_LOCAL, msgptr, NULL, NULL, fd_msg_pmdl_get(msgptr));
-				CHECK_FCT( fd_fifo_post(fd_g_local, &msgptr) );
+				CHECK_FCT( fd_fifo_post(FD_SHARD(msgptr)->local, &msgptr) );
 			} else {
 				/* We don't support the application, reply an error */
 				fd_hook_call(HOOK_MESSAGE_PARSING_ERROR, msgptr, NULL, "Application unsupported", fd_msg_pmdl_get(msgptr));
@@ -755,14 +860,14 @@ static int msg_rt_in(struct msg * msg)
 				
 			if (is_nai) {
 				/* We have transformed the AVP, now submit it again in the queue */
-				CHECK_FCT(fd_fifo_post(fd_g_incoming, &msgptr) );
+				CHECK_FCT(fd_fifo_post(FD_SHARD(msgptr)->incoming, &msgptr) );
 				return 0;
 			}
 
 			if (is_local_app == YES) {
 				/* Handle localy since we are able to */
 				fd_hook_call(HOOK_MESSAGE_ROUTING_LOCAL, msgptr, NULL, NULL, fd_msg_pmdl_get(msgptr));
-				CHECK_FCT(fd_fifo_post(fd_g_local, &msgptr) );
+				CHECK_FCT(fd_fifo_post(FD_SHARD(msgptr)->local, &msgptr) );
 				return 0;
 			}
 
@@ -787,7 +892,7 @@ static int msg_rt_in(struct msg * msg)
 		if ((!qry_src) && (!is_err)) {
 			/* The message is a normal answer to a request issued localy, we do not call the callbacks chain on it. */
 			fd_hook_call(HOOK_MESSAGE_ROUTING_LOCAL, msgptr, NULL, NULL, fd_msg_pmdl_get(msgptr));
-			CHECK_FCT(fd_fifo_post(fd_g_local, &msgptr) );
+			CHECK_FCT(fd_fifo_post(FD_SHARD(msgptr)->local, &msgptr) );
 			return 0;
 		}
 		
@@ -836,10 +941,10 @@ static int msg_rt_in(struct msg * msg)
 	/* Now pass the message to the next step: either forward to another peer, or dispatch to local extensions */
 	if (is_req || qry_src) {
 		fd_hook_call(HOOK_MESSAGE_ROUTING_FORWARD, msgptr, NULL, NULL, fd_msg_pmdl_get(msgptr));
-		CHECK_FCT(fd_fifo_post(fd_g_outgoing, &msgptr) );
+		CHECK_FCT(fd_fifo_post(FD_SHARD(msgptr)->outgoing, &msgptr) );
 	} else {
 		fd_hook_call(HOOK_MESSAGE_ROUTING_LOCAL, msgptr, NULL, NULL, fd_msg_pmdl_get(msgptr));
-		CHECK_FCT(fd_fifo_post(fd_g_local, &msgptr) );
+		CHECK_FCT(fd_fifo_post(FD_SHARD(msgptr)->local, &msgptr) );
 	}
 
 	/* We're done with this message */
@@ -848,10 +953,104 @@ static int msg_rt_in(struct msg * msg)
 		
 
 /* The ROUTING-OUT message processing */
+/* The routing cache data of a request being routed */
+struct rt_cache_req {
+	int			lookup;		/* the cache is used for this request */
+	int			hit;		/* the scores of the cacheable callbacks were found in the cache */
+	struct fd_rt_cache_key	key;
+	uint64_t		version;	/* of the peers snapshot the candidates come from */
+	int			nb;		/* number of candidates */
+	int			ncb;		/* number of cacheable callbacks */
+	int			cur;		/* index of the next cacheable callback to be called */
+	struct rtd_candidate **	cands;		/* the candidates, in the list order */
+	int *			scores;		/* the scores given by each cacheable callback to the candidates, ncb blocks of nb values */
+	int *			before;		/* the scores before the current cacheable callback is called */
+	void *			buf;		/* the arrays, if they do not fit in the following */
+	struct rtd_candidate *	l_cands[64];
+	int			l_scores[128];
+	int			l_before[64];
+};
+
+/* Search the scores of the ncb cacheable callbacks for a request in its first routing attempt. Called with rt_out_lock held. */
+static int rt_cache_begin(struct rt_cache_req * rq, struct msg * msg, struct fd_list * candidates, uint64_t version, int ncb)
+{
+	struct msg_hdr * hdr;
+	union avp_value *dh = NULL, *dr = NULL;
+	struct fd_list * li;
+	uint64_t sig = 14695981039346656037ULL;
+	int i;
+	
+	if (!ncb)
+		return 0;
+	
+	CHECK_FCT( fd_msg_hdr(msg, &hdr) );
+	CHECK_FCT( get_destination(msg, &dh, &dr) );
+	
+	rq->nb = 0;
+	for (li = candidates->next; li != candidates; li = li->next)
+		rq->nb++;
+	rq->ncb = ncb;
+	rq->cur = 0;
+	if ((rq->nb > sizeof(rq->l_cands) / sizeof(rq->l_cands[0])) || (rq->nb * ncb > sizeof(rq->l_scores) / sizeof(rq->l_scores[0]))) {
+		CHECK_MALLOC( rq->buf = malloc(rq->nb * (sizeof(struct rtd_candidate *) + (ncb + 1) * sizeof(int))) );
+		rq->cands = rq->buf;
+		rq->scores = (int *)(rq->cands + rq->nb);
+		rq->before = rq->scores + rq->nb * ncb;
+	} else {
+		rq->cands = rq->l_cands;
+		rq->scores = rq->l_scores;
+		rq->before = rq->l_before;
+	}
+	
+	/* The strings of the candidates are those of the peers snapshot, their addresses identify the peers for this version */
+	for (i = 0, li = candidates->next; li != candidates; li = li->next, i++) {
+		rq->cands[i] = (struct rtd_candidate *)li;
+		sig = (sig ^ (unsigned long)rq->cands[i]->diamid) * 1099511628211ULL;
+	}
+	
+	rq->key.appid = hdr->msg_appl;
+	rq->key.cmd = hdr->msg_code;
+	rq->key.dr = dr ? dr->os.data : NULL;
+	rq->key.drlen = dr ? dr->os.len : 0;
+	rq->key.dh = dh ? dh->os.data : NULL;
+	rq->key.dhlen = dh ? dh->os.len : 0;
+	rq->key.cands = sig ^ rq->nb;
+	rq->version = version;
+	rq->lookup = 1;
+	
+	/* The saved scores are added to the candidates when each callback would be called, so that the others see the same scores */
+	if (fd_rt_cache_get(&rq->key, version, rq->scores, rq->nb * ncb) == 0)
+		rq->hit = 1;
+	
+	return 0;
+}
+
+/* Save the scores of the cacheable callbacks if they were called */
+static void rt_cache_end(struct rt_cache_req * rq, struct msg * msg, struct fd_list * candidates)
+{
+	struct fd_list * li;
+	int nb = 0;
+	
+	if (rq->lookup && !rq->hit && msg) {
+		/* Unless a callback changed the candidates */
+		for (li = candidates->next; li != candidates; li = li->next)
+			nb++;
+		if (nb == rq->nb) {
+			CHECK_FCT_DO( fd_rt_cache_put(&rq->key, rq->version, rq->scores, rq->nb * rq->ncb), /* continue */ );
+		}
+	}
+	
+	free(rq->buf);
+	rq->buf = NULL;
+	rq->lookup = 0;
+}
+
 static int msg_rt_out(struct msg * msg)
 {
 	struct rt_data * rtd = NULL;
 	struct msg_hdr * hdr;
+	struct rt_cache_req rq;
+	uint64_t version = 0;
 	int is_req = 0;
 	int ret;
 	struct fd_list * li, *candidates;
@@ -908,20 +1107,35 @@ static int msg_rt_out(struct msg * msg)
 
 	/* If there is no routing data already, let's create it */
 	if (rtd == NULL) {
+		struct fd_peers_snapshot * snap;
+		
 		CHECK_FCT( fd_rtd_init(&rtd) );
 
-		/* Add all peers currently in OPEN state */
-		CHECK_FCT( pthread_rwlock_rdlock(&fd_g_activ_peers_rw) );
-		for (li = fd_g_activ_peers.next; li != &fd_g_activ_peers; li = li->next) {
-			struct fd_peer * p = (struct fd_peer *)li->o;
-			CHECK_FCT_DO( ret = fd_rtd_candidate_add(rtd, 
-							p->p_hdr.info.pi_diamid, 
-							p->p_hdr.info.pi_diamidlen, 
-							p->p_hdr.info.runtime.pir_realm,
-							p->p_hdr.info.runtime.pir_realmlen), 
-				{ CHECK_FCT_DO( pthread_rwlock_unlock(&fd_g_activ_peers_rw), ); return ret; } );
+		/* Add all peers currently in OPEN state. The candidates point to the snapshot, which is released with the routing data */
+		snap = fd_peers_snapshot_get();
+		if (snap) {
+			struct rtd_candidate local[64], * sel = NULL;
+			union avp_value *dh = NULL, *dr = NULL;
+			int nb = 0;
+
+			/* Only the first routing attempt of a request uses the routing cache, the retries have other candidates */
+			if (fd_g_config->cnf_rtcache_ttl)
+				version = snap->version;
+
+			/* Or only those that can serve the Destination-Realm. If the AVPs cannot be parsed, the routing callbacks will report it */
+			if (fd_g_config->cnf_flags.rt_realm && (get_destination(msgptr, &dh, &dr) == 0) && dr) {
+				sel = (snap->nb > sizeof(local) / sizeof(local[0])) ? malloc(snap->nb * sizeof(struct rtd_candidate)) : local;
+				if (sel) {
+					CHECK_FCT_DO( fd_peers_snapshot_select(snap, dh ? dh->os.data : NULL, dh ? dh->os.len : 0, dr->os.data, dr->os.len, sel, &nb),
+						{ if (sel != local) free(sel); sel = NULL; } );
+				}
+			}
+			
+			CHECK_FCT_DO( ret = fd_rtd_candidate_add_array(rtd, sel ?: snap->peers, sel ? nb : snap->nb, (void *)fd_peers_snapshot_put, snap),
+				{ if (sel && (sel != local)) free(sel); fd_peers_snapshot_put(snap); fd_rtd_free(&rtd); return ret; } );
+			if (sel && (sel != local))
+				free(sel);
 		}
-		CHECK_FCT( pthread_rwlock_unlock(&fd_g_activ_peers_rw) );
 
 		/* Now let's remove all peers from the Route-Records */
 		CHECK_FCT(  fd_msg_browse(msgptr, MSG_BRW_FIRST_CHILD, &avp, NULL)  );
@@ -959,15 +1173,37 @@ static int msg_rt_out(struct msg * msg)
 
 	/* Ok, we have our list in rtd now, let's (re)initialize the scores */
 	fd_rtd_candidate_extract(rtd, &candidates, FD_SCORE_INI);
+	
+	rq.lookup = rq.hit = 0;
+	rq.buf = NULL;
 
 	/* Pass the list to registered callbacks (even if it is empty list) */
 	{
+		int i, * s = NULL;
+		
 		CHECK_FCT( pthread_rwlock_rdlock( &rt_out_lock ) );
 		pthread_cleanup_push( fd_cleanup_rwlock, &rt_out_lock );
+		
+		/* Use the scores saved in the routing cache if any */
+		if (version) {
+			CHECK_FCT_DO( rt_cache_begin(&rq, msgptr, candidates, version, rt_out_cacheable), { free(rq.buf); rq.buf = NULL; rq.lookup = 0; } );
+		}
 
 		/* We call the cb by reverse priority order */
 		for (	li = rt_out_list.prev ; (msgptr != NULL) && (li != &rt_out_list) ; li = li->prev ) {
 			struct rt_hdl * rh = (struct rt_hdl *)li;
+			
+			if (rh->cacheable && rq.lookup) {
+				s = rq.scores + rq.cur++ * rq.nb;
+				if (rq.hit) {
+					/* Add its saved scores instead of calling it */
+					for (i = 0; i < rq.nb; i++)
+						rq.cands[i]->score += s[i];
+					continue;
+				}
+				for (i = 0; i < rq.nb; i++)
+					rq.before[i] = rq.cands[i]->score;
+			}
 
 			TRACE_DEBUG(ANNOYING, "Calling next OUT callback on %p : %p (prio %d)", msgptr, rh->rt_out_cb, rh->prio);
 			CHECK_FCT_DO( ret = (*rh->rt_out_cb)(rh->cbdata, &msgptr, candidates),
@@ -979,7 +1215,15 @@ static int msg_rt_out(struct msg * msg)
 					fd_msg_free(msgptr);
 					msgptr = NULL;
 				} );
+			
+			if (rh->cacheable && rq.lookup && msgptr) {
+				for (i = 0; i < rq.nb; i++)
+					s[i] = rq.cands[i]->score - rq.before[i];
+			}
 		}
+		
+		/* Save the scores while the callbacks cannot change */
+		rt_cache_end(&rq, msgptr, candidates);
 
 		pthread_cleanup_pop(0);
 		CHECK_FCT( pthread_rwlock_unlock( &rt_out_lock ) );
@@ -1043,6 +1287,13 @@ static pthread_mutex_t order_state_lock = PTHREAD_MUTEX_INITIALIZER;
 
 /* Threads report their status */
 enum thread_state { NOTRUNNING = 0, RUNNING = 1 };
+
+/* A routing or dispatch thread */
+struct rd_thr {
+	enum thread_state	 state;		/* first field, the thread receives a pointer to it */
+	pthread_t		 thr;
+	int			 shard;		/* the shard whose queue the thread processes */
+};
 static void cleanup_state(void * state_loc)
 {
 	CHECK_POSIX_DO( pthread_mutex_lock(&order_state_lock), );
@@ -1131,19 +1382,25 @@ end:
 /* The dispatch thread */
 static void * dispatch_thr(void * arg)
 {
-	return process_thr(arg, msg_dispatch, fd_g_local, "Dispatch");
+	struct rd_thr * t = arg;
+	fd_thr_bind(FD_THR_DISP, t->shard);
+	return process_thr(arg, msg_dispatch, fd_g_shards[t->shard].local, "Dispatch");
 }
 
 /* The (routing-in) thread -- see description in freeDiameter.h */
 static void * routing_in_thr(void * arg)
 {
-	return process_thr(arg, msg_rt_in, fd_g_incoming, "Routing-IN");
+	struct rd_thr * t = arg;
+	fd_thr_bind(FD_THR_ROUTE, t->shard);
+	return process_thr(arg, msg_rt_in, fd_g_shards[t->shard].incoming, "Routing-IN");
 }
 
 /* The (routing-out) thread -- see description in freeDiameter.h */
 static void * routing_out_thr(void * arg)
 {
-	return process_thr(arg, msg_rt_out, fd_g_outgoing, "Routing-OUT");
+	struct rd_thr * t = arg;
+	fd_thr_bind(FD_THR_ROUTE, t->shard);
+	return process_thr(arg, msg_rt_out, fd_g_shards[t->shard].outgoing, "Routing-OUT");
 }
 
 
@@ -1151,37 +1408,50 @@ static void * routing_out_thr(void * arg)
 /*                     The functions for the other files                        */
 /********************************************************************************/
 
-static pthread_t * dispatch = NULL;
-static enum thread_state * disp_state = NULL;
-
-/* Later: make this more dynamic */
-static pthread_t rt_out = (pthread_t)NULL;
-static enum thread_state out_state = NOTRUNNING;
-
-static pthread_t rt_in  = (pthread_t)NULL;
-static enum thread_state in_state = NOTRUNNING;
+/* The threads of each shard */
+static struct rd_shard {
+	struct rd_thr	*dispatch;	/* cnf_dispthr threads */
+	struct rd_thr	 rt_out;	/* Later: make this more dynamic */
+	struct rd_thr	 rt_in;
+} * shards = NULL;
+static int nb_shards = 0;
 
 /* Initialize the routing and dispatch threads */
 int fd_rtdisp_init(void)
 {
-	int i;
+	struct fd_rt_out_hdl * hdl;
+	int i, s;
+	
+	/* The queues of the additional shards */
+	CHECK_FCT( fd_queues_shards_init() );
 	
-	/* Prepare the array for dispatch */
-	CHECK_MALLOC( disp_state = calloc(fd_g_config->cnf_dispthr, sizeof(enum thread_state)) );
-	CHECK_MALLOC( dispatch = calloc(fd_g_config->cnf_dispthr, sizeof(pthread_t)) );
+	CHECK_MALLOC( shards = calloc(fd_g_config->cnf_shards, sizeof(struct rd_shard)) );
+	nb_shards = fd_g_config->cnf_shards;
 	
 	/* Create the threads */
-	for (i=0; i < fd_g_config->cnf_dispthr; i++) {
-		CHECK_POSIX( pthread_create( &dispatch[i], NULL, dispatch_thr, &disp_state[i] ) );
+	for (s = 0; s < nb_shards; s++) {
+		CHECK_MALLOC( shards[s].dispatch = calloc(fd_g_config->cnf_dispthr, sizeof(struct rd_thr)) );
+		for (i=0; i < fd_g_config->cnf_dispthr; i++) {
+			shards[s].dispatch[i].shard = s;
+			CHECK_POSIX( pthread_create( &shards[s].dispatch[i].thr, NULL, dispatch_thr, &shards[s].dispatch[i] ) );
+		}
+		shards[s].rt_out.shard = s;
+		CHECK_POSIX( pthread_create( &shards[s].rt_out.thr, NULL, routing_out_thr, &shards[s].rt_out) );
+		shards[s].rt_in.shard = s;
+		CHECK_POSIX( pthread_create( &shards[s].rt_in.thr,  NULL, routing_in_thr,  &shards[s].rt_in) );
 	}
-	CHECK_POSIX( pthread_create( &rt_out, NULL, routing_out_thr, &out_state) );
-	CHECK_POSIX( pthread_create( &rt_in,  NULL, routing_in_thr,  &in_state) );
+	
+	/* And the threads that feed the incoming queues with the messages received from the peers */
+	CHECK_FCT( fd_in_init() );
 	
 	/* Later: TODO("Set the thresholds for the queues to create more threads as needed"); */
 	
-	/* Register the built-in callbacks */
-	CHECK_FCT( fd_rt_out_register( dont_send_if_no_common_app, NULL, 10, NULL ) );
-	CHECK_FCT( fd_rt_out_register( score_destination_avp, NULL, 10, NULL ) );
+	/* Register the built-in callbacks, they only depend on the values in the routing cache key */
+	CHECK_FCT( fd_rt_cache_init() );
+	CHECK_FCT( fd_rt_out_register( dont_send_if_no_common_app, NULL, 10, &hdl ) );
+	CHECK_FCT( fd_rt_out_set_cacheable( hdl ) );
+	CHECK_FCT( fd_rt_out_register( score_destination_avp, NULL, 10, &hdl ) );
+	CHECK_FCT( fd_rt_out_set_cacheable( hdl ) );
 	
 	return 0;
 }
@@ -1240,35 +1510,48 @@ static void stop_thread_delayed(enum thread_state *st, pthread_t * thr, char * t
 /* Stop the thread after up to one second of wait */
 int fd_rtdisp_fini(void)
 {
-	int i;
+	int i, s;
 	
-	/* Destroy the incoming queue */
-	CHECK_FCT_DO( fd_queues_fini(&fd_g_incoming), /* ignore */);
+	/* Stop feeding the incoming queues */
+	CHECK_FCT_DO( fd_in_fini(), /* ignore */);
 	
-	/* Stop the routing IN thread */
-	stop_thread_delayed(&in_state, &rt_in, "IN routing");
+	/* Destroy the incoming queues */
+	for (s = 0; s < FD_SHARDS_MAX; s++) {
+		CHECK_FCT_DO( fd_queues_fini(&fd_g_shards[s].incoming), /* ignore */);
+	}
+	
+	/* Stop the routing IN threads */
+	for (s = 0; s < nb_shards; s++) {
+		stop_thread_delayed(&shards[s].rt_in.state, &shards[s].rt_in.thr, "IN routing");
+	}
 	
-	/* Destroy the outgoing queue */
-	CHECK_FCT_DO( fd_queues_fini(&fd_g_outgoing), /* ignore */);
+	/* Destroy the outgoing queues */
+	for (s = 0; s < FD_SHARDS_MAX; s++) {
+		CHECK_FCT_DO( fd_queues_fini(&fd_g_shards[s].outgoing), /* ignore */);
+	}
 	
-	/* Stop the routing OUT thread */
-	stop_thread_delayed(&out_state, &rt_out, "OUT routing");
+	/* Stop the routing OUT threads */
+	for (s = 0; s < nb_shards; s++) {
+		stop_thread_delayed(&shards[s].rt_out.state, &shards[s].rt_out.thr, "OUT routing");
+	}
 	
-	/* Destroy the local queue */
-	CHECK_FCT_DO( fd_queues_fini(&fd_g_local), /* ignore */);
+	/* Destroy the local queues */
+	for (s = 0; s < FD_SHARDS_MAX; s++) {
+		CHECK_FCT_DO( fd_queues_fini(&fd_g_shards[s].local), /* ignore */);
+	}
 	
 	/* Stop the Dispatch threads */
-	if (dispatch != NULL) {
-		for (i=0; i < fd_g_config->cnf_dispthr; i++) {
-			stop_thread_delayed(&disp_state[i], &dispatch[i], "Dispatching");
+	for (s = 0; s < nb_shards; s++) {
+		if (shards[s].dispatch != NULL) {
+			for (i=0; i < fd_g_config->cnf_dispthr; i++) {
+				stop_thread_delayed(&shards[s].dispatch[i].state, &shards[s].dispatch[i].thr, "Dispatching");
+			}
+			free(shards[s].dispatch);
 		}
-		free(dispatch);
-		dispatch = NULL;
-	}
-	if (disp_state != NULL) {
-		free(disp_state);
-		disp_state = NULL;
 	}
+	free(shards);
+	shards = NULL;
+	nb_shards = 0;
 	
 	return 0;
 }
@@ -1285,6 +1568,8 @@ int fd_rtdisp_cleanup(void)
 	}
 	
 	fd_disp_unregister_all(); /* destroy remaining handlers */
+	
+	fd_rt_cache_fini();
 
 	return 0;
 }
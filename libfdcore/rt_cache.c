@@ -0,0 +1,279 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+
+/* Cache of the routing decisions.
+ *
+ * Many requests have the same routing inputs: same application and command, same Destination-Realm and Destination-Host,
+ * and same candidates once the Route-Record peers are removed. The scores that the cacheable OUT callbacks (fd_rt_out_set_cacheable)
+ * give to the candidates are then the same, and msg_rt_out saves them here for RoutingCacheTTL milliseconds, one block of scores
+ * per cacheable callback. The callbacks that are not cacheable (load balancing, ...) are still called for each request, and the
+ * saved blocks are added in the priority order of their callbacks, so that each callback sees the same scores as without the cache.
+ *
+ * An entry is only valid for the snapshot of the active peers it was computed with (i.e. until a peer enters or leaves the OPEN
+ * state), and the whole cache is flushed when the OUT callbacks change.
+ */
+
+#include "fdcore-internal.h"
+
+/* Size of the hash table, and number of locks protecting it (one lock for BUCKETS / LOCKS consecutive buckets) */
+#define RT_CACHE_BUCKETS	1024
+#define RT_CACHE_LOCKS		64
+/* Max number of entries in a bucket, the oldest one is removed when a new one is added */
+#define RT_CACHE_DEPTH		4
+
+struct rt_cache_entry {
+	struct fd_list		chain;		/* link in the bucket, most recent first */
+	uint32_t		hash;		/* the hash of the key */
+	struct timespec		expire;		/* the entry is not used after this time */
+	uint64_t		version;	/* version of the peers snapshot */
+	uint32_t		appid;
+	uint32_t		cmd;
+	uint64_t		cands;
+	size_t			drlen;
+	size_t			dhlen;
+	int			nb;		/* number of candidates */
+	int			scores[];	/* their scores, followed by the Destination-Realm and Destination-Host */
+};
+
+static struct fd_list	buckets[RT_CACHE_BUCKETS];
+static pthread_mutex_t	locks[RT_CACHE_LOCKS];
+static int		initialized = 0;
+
+static unsigned long long hits = 0;
+static unsigned long long misses = 0;
+
+#define BUCKET_LOCK(_b)	(&locks[(_b) / (RT_CACHE_BUCKETS / RT_CACHE_LOCKS)])
+
+/* Case-insensitive hash of the strings, since fd_os_almostcasesrch is used to compare them */
+static uint32_t hash_str(uint32_t h, uint8_t * s, size_t l)
+{
+	size_t i;
+	for (i = 0; i < l; i++) {
+		uint8_t c = s[i];
+		if ((c >= 'A') && (c <= 'Z'))
+			c += 'a' - 'A';
+		h = (h ^ c) * 16777619;
+	}
+	return (h ^ 0xff) * 16777619;
+}
+
+static uint32_t hash_key(struct fd_rt_cache_key * key)
+{
+	uint32_t h = 2166136261U;
+	h = (h ^ key->appid) * 16777619;
+	h = (h ^ key->cmd) * 16777619;
+	h = (h ^ (uint32_t)key->cands) * 16777619;
+	h = (h ^ (uint32_t)(key->cands >> 32)) * 16777619;
+	h = hash_str(h, key->dr, key->drlen);
+	return hash_str(h, key->dh, key->dhlen);
+}
+
+static int entry_match(struct rt_cache_entry * e, uint32_t hash, struct fd_rt_cache_key * key)
+{
+	uint8_t * dr = (uint8_t *)&e->scores[e->nb];
+	
+	if ((e->hash != hash) || (e->appid != key->appid) || (e->cmd != key->cmd) || (e->cands != key->cands))
+		return 0;
+	if ((e->drlen != key->drlen) || (e->dhlen != key->dhlen))
+		return 0;
+	if (e->drlen && fd_os_almostcasesrch(dr, e->drlen, key->dr, key->drlen, NULL))
+		return 0;
+	if (e->dhlen && fd_os_almostcasesrch(dr + e->drlen, e->dhlen, key->dh, key->dhlen, NULL))
+		return 0;
+	return 1;
+}
+
+static void entry_free(struct rt_cache_entry * e)
+{
+	fd_list_unlink(&e->chain);
+	free(e);
+}
+
+/* Initialize the cache */
+int fd_rt_cache_init(void)
+{
+	int i;
+	
+	TRACE_ENTRY();
+	
+	if (initialized)
+		return 0;
+	
+	for (i = 0; i < RT_CACHE_BUCKETS; i++)
+		fd_list_init(&buckets[i], NULL);
+	for (i = 0; i < RT_CACHE_LOCKS; i++) {
+		CHECK_POSIX( pthread_mutex_init(&locks[i], NULL) );
+	}
+	initialized = 1;
+	
+	return 0;
+}
+
+/* Empty the cache */
+void fd_rt_cache_flush(void)
+{
+	int i;
+	
+	TRACE_ENTRY();
+	
+	if (!initialized)
+		return;
+	
+	for (i = 0; i < RT_CACHE_BUCKETS; i++) {
+		CHECK_POSIX_DO( pthread_mutex_lock(BUCKET_LOCK(i)), { ASSERT(0); } );
+		while (!FD_IS_LIST_EMPTY(&buckets[i]))
+			entry_free((struct rt_cache_entry *)buckets[i].next);
+		CHECK_POSIX_DO( pthread_mutex_unlock(BUCKET_LOCK(i)), { ASSERT(0); } );
+	}
+}
+
+/* Destroy the cache */
+void fd_rt_cache_fini(void)
+{
+	int i;
+	
+	TRACE_ENTRY();
+	
+	if (!initialized)
+		return;
+	
+	fd_rt_cache_flush();
+	for (i = 0; i < RT_CACHE_LOCKS; i++) {
+		CHECK_POSIX_DO( pthread_mutex_destroy(&locks[i]), /* continue */ );
+	}
+	initialized = 0;
+}
+
+/* Search the scores of the nb candidates for this key. Returns 0 if they were found, ENOENT otherwise. */
+int fd_rt_cache_get(struct fd_rt_cache_key * key, uint64_t version, int * scores, int nb)
+{
+	struct fd_list * li;
+	struct timespec now;
+	uint32_t hash;
+	int b, ret = ENOENT;
+	
+	TRACE_ENTRY("%p %p %d", key, scores, nb);
+	CHECK_PARAMS( initialized && key && (scores || !nb) );
+	
+	hash = hash_key(key);
+	b = hash % RT_CACHE_BUCKETS;
+	CHECK_SYS( clock_gettime(CLOCK_REALTIME, &now) );
+	
+	CHECK_POSIX( pthread_mutex_lock(BUCKET_LOCK(b)) );
+	for (li = buckets[b].next; li != &buckets[b]; li = li->next) {
+		struct rt_cache_entry * e = (struct rt_cache_entry *)li;
+		
+		if (!entry_match(e, hash, key))
+			continue;
+		
+		if ((e->version != version) || (e->nb != nb) || TS_IS_INFERIOR(&e->expire, &now)) {
+			/* This one is outdated */
+			entry_free(e);
+		} else {
+			memcpy(scores, e->scores, nb * sizeof(int));
+			ret = 0;
+		}
+		break;
+	}
+	CHECK_POSIX( pthread_mutex_unlock(BUCKET_LOCK(b)) );
+	
+	if (ret) {
+		__atomic_add_fetch(&misses, 1, __ATOMIC_RELAXED);
+	} else {
+		__atomic_add_fetch(&hits, 1, __ATOMIC_RELAXED);
+	}
+	
+	return ret;
+}
+
+/* Save the scores of the nb candidates for this key */
+int fd_rt_cache_put(struct fd_rt_cache_key * key, uint64_t version, int * scores, int nb)
+{
+	struct rt_cache_entry * new;
+	struct fd_list * li;
+	uint32_t hash;
+	uint32_t ttl = fd_g_config->cnf_rtcache_ttl;
+	int b, count = 0;
+	
+	TRACE_ENTRY("%p %p %d", key, scores, nb);
+	CHECK_PARAMS( initialized && key && (scores || !nb) );
+	
+	hash = hash_key(key);
+	b = hash % RT_CACHE_BUCKETS;
+	
+	CHECK_MALLOC( new = malloc(sizeof(struct rt_cache_entry) + nb * sizeof(int) + key->drlen + key->dhlen) );
+	fd_list_init(&new->chain, new);
+	new->hash = hash;
+	CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &new->expire), { int err = errno; free(new); return err; } );
+	new->expire.tv_sec += ttl / 1000;
+	new->expire.tv_nsec += (ttl % 1000) * 1000000;
+	if (new->expire.tv_nsec >= 1000000000) {
+		new->expire.tv_nsec -= 1000000000;
+		new->expire.tv_sec += 1;
+	}
+	new->version = version;
+	new->appid = key->appid;
+	new->cmd = key->cmd;
+	new->cands = key->cands;
+	new->drlen = key->drlen;
+	new->dhlen = key->dhlen;
+	new->nb = nb;
+	memcpy(new->scores, scores, nb * sizeof(int));
+	memcpy((uint8_t *)&new->scores[nb], key->dr, key->drlen);
+	memcpy((uint8_t *)&new->scores[nb] + key->drlen, key->dh, key->dhlen);
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(BUCKET_LOCK(b)), { free(new); return EINVAL; } );
+	/* Replace the previous value if any, and remove the oldest entries if the bucket is full */
+	for (li = buckets[b].next; li != &buckets[b]; ) {
+		struct rt_cache_entry * e = (struct rt_cache_entry *)li;
+		li = li->next;
+		if (entry_match(e, hash, key) || (++count >= RT_CACHE_DEPTH))
+			entry_free(e);
+	}
+	fd_list_insert_after(&buckets[b], &new->chain);
+	CHECK_POSIX_DO( pthread_mutex_unlock(BUCKET_LOCK(b)), { ASSERT(0); } );
+	
+	return 0;
+}
+
+/* Retrieve the statistics */
+void fd_rt_cache_getstats(unsigned long long * h, unsigned long long * m)
+{
+	if (h)
+		*h = __atomic_load_n(&hits, __ATOMIC_RELAXED);
+	if (m)
+		*m = __atomic_load_n(&misses, __ATOMIC_RELAXED);
+}
@@ -1139,16 +1139,113 @@ again:
 	return ret;
 }
 
-/* Receive the next data from the socket, or next notification */
+/* Messages received at once, and size of the slots they are received into. Bigger messages continue in a buffer of their own. */
+#ifndef SCTP_RCV_BATCH
+#define SCTP_RCV_BATCH	8
+#endif /* SCTP_RCV_BATCH */
+#ifndef SCTP_RCV_SLOTSZ
+#define SCTP_RCV_SLOTSZ	(8 * 1024)
+#endif /* SCTP_RCV_SLOTSZ */
+
+#ifdef HAVE_RECVMMSG
+typedef struct mmsghdr rcv_mmsghdr_t;
+#else /* HAVE_RECVMMSG */
+typedef struct {
+	struct msghdr	msg_hdr;
+	unsigned int	msg_len;
+} rcv_mmsghdr_t;
+#endif /* HAVE_RECVMMSG */
+
+/* The reception state of an association, kept between the calls to fd_sctp_recvmeta so that several messages can be received at once */
+struct sctp_rcvbuf {
+	rcv_mmsghdr_t	mmsg[SCTP_RCV_BATCH];
+	struct iovec	iov[SCTP_RCV_BATCH];
+	char		anci[SCTP_RCV_BATCH][CMSG_BUF_LEN];
+	uint8_t		slots[SCTP_RCV_BATCH][SCTP_RCV_SLOTSZ];
+	int		nb;		/* number of slots received in the last call */
+	int		idx;		/* next slot to return */
+	
+	/* The record that did not fit in a slot */
+	uint8_t	*	data;
+	size_t		datasize;
+	size_t		bufsz;
+};
+
+#ifdef HAVE_RECVMMSG
+static int no_recvmmsg = 0; /* set if the kernel does not support it */
+#endif /* HAVE_RECVMMSG */
+
+/* Receive in the slots. Returns the number of slots filled, or -1 and errno */
+static int rcvbuf_fill(struct cnxctx * conn, struct sctp_rcvbuf * rb)
+{
+	int i, ret;
+	
+	for (i = 0; i < SCTP_RCV_BATCH; i++) {
+		rb->iov[i].iov_base = rb->slots[i];
+		rb->iov[i].iov_len  = SCTP_RCV_SLOTSZ;
+		memset(&rb->mmsg[i], 0, sizeof(rcv_mmsghdr_t));
+		rb->mmsg[i].msg_hdr.msg_iov        = &rb->iov[i];
+		rb->mmsg[i].msg_hdr.msg_iovlen     = 1;
+		rb->mmsg[i].msg_hdr.msg_control    = rb->anci[i];
+		rb->mmsg[i].msg_hdr.msg_controllen = CMSG_BUF_LEN;
+	}
+	
+#ifdef HAVE_RECVMMSG
+	if (!no_recvmmsg) {
+		/* Wait for the first message (or the socket timeout), then take what is already there */
+		ret = recvmmsg(conn->cc_socket, rb->mmsg, SCTP_RCV_BATCH, MSG_WAITFORONE, NULL);
+		if (ret > 0) {
+			/* Stop at the end of the stream, if it is in the batch; the next call returns 0 */
+			for (i = 0; i < ret; i++) {
+				if (rb->mmsg[i].msg_len == 0)
+					return i;
+			}
+		}
+		if ((ret >= 0) || (errno != ENOSYS))
+			return ret;
+		TRACE_DEBUG(INFO, "recvmmsg is not supported by the system, receiving SCTP messages one by one");
+		no_recvmmsg = 1;
+	}
+#endif /* HAVE_RECVMMSG */
+	
+	ret = recvmsg(conn->cc_socket, &rb->mmsg[0].msg_hdr, 0);
+	if (ret <= 0)
+		return ret;
+	rb->mmsg[0].msg_len = ret;
+	return 1;
+}
+
+/* Make room for len more bytes in the record being received */
+static int rcvbuf_grow(struct sctp_rcvbuf * rb, size_t len)
+{
+	if (rb->datasize + len <= rb->bufsz)
+		return 0;
+	while (rb->datasize + len > rb->bufsz)
+		rb->bufsz *= 2;
+	CHECK_MALLOC( rb->data = realloc(rb->data, fd_msg_pmdl_sizewithoverhead(rb->bufsz)) );
+	return 0;
+}
+
+/* Release the reception state of the association */
+void fd_sctp_rcvbuf_free(struct cnxctx * conn)
+{
+	if (conn->cc_sctp_rcv) {
+		free(conn->cc_sctp_rcv->data);
+		free(conn->cc_sctp_rcv);
+		conn->cc_sctp_rcv = NULL;
+	}
+}
+
+/* Receive the next data from the socket, or next notification.
+ * The messages are received in batches into the slots of the association, and copied from there to a buffer of their size.
+ * The buffers are allocated with room for the fd_msg_pmdl data, so that fd_cnx_realloc_msg_buffer does not need to move them. */
 int fd_sctp_recvmeta(struct cnxctx * conn, uint16_t * strid, uint8_t ** buf, size_t * len, int *event)
 {
 	ssize_t 		 ret = 0;
-	struct msghdr 		 mhdr;
-	char   			 ancidata[ CMSG_BUF_LEN ];
-	struct iovec 		 iov;
-	uint8_t			*data = NULL;
-	size_t 			 bufsz = 0, datasize = 0;
-	size_t			 mempagesz = sysconf(_SC_PAGESIZE); /* We alloc buffer by memory pages for efficiency */
+	struct sctp_rcvbuf	*rb;
+	struct msghdr 		*mhdr;
+	uint8_t			*chunk, *data = NULL;
+	size_t 			 chunklen, datasize = 0;
 	int 			 timedout = 0;
 	
 	TRACE_ENTRY("%p %p %p %p %p", conn, strid, buf, len, event);
@@ -1159,64 +1256,115 @@ int fd_sctp_recvmeta(struct cnxctx * conn, uint16_t * strid, uint8_t ** buf, siz
 	*len = 0;
 	*event = 0;
 	
-	/* Prepare header for receiving message */
-	memset(&mhdr, 0, sizeof(mhdr));
-	mhdr.msg_iov    = &iov;
-	mhdr.msg_iovlen = 1;
-	mhdr.msg_control    = &ancidata;
-	mhdr.msg_controllen = sizeof(ancidata);
+	if (!conn->cc_sctp_rcv) {
+		CHECK_MALLOC( conn->cc_sctp_rcv = calloc(1, sizeof(struct sctp_rcvbuf)) );
+	}
+	rb = conn->cc_sctp_rcv;
 	
 next_message:
-	datasize = 0;
-	
-	/* We will loop while all data is not received. */
-incomplete:
-	while (datasize >= bufsz ) {
-		/* The buffer is full, enlarge it */
-		bufsz += mempagesz;
-		CHECK_MALLOC( data = realloc(data, bufsz ) );
-	}
-	/* the new data will be received following the preceding */
-	memset(&iov,  0, sizeof(iov));
-	iov.iov_base = data + datasize ;
-	iov.iov_len  = bufsz - datasize;
-
-	/* Receive data from the socket */
-again:
-	pthread_cleanup_push(free, data);
-	ret = recvmsg(conn->cc_socket, &mhdr, 0);
-	pthread_testcancel();
-	pthread_cleanup_pop(0);
+	chunk = NULL;
+	chunklen = 0;
 	
-	/* First, handle timeouts (same as fd_cnx_s_recv) */
-	if ((ret < 0) && ((errno == EAGAIN) || (errno == EINTR))) {
-		if (! fd_cnx_teststate(conn, CC_STATUS_CLOSING ))
-			goto again; /* don't care, just ignore */
-		if (!timedout) {
-			timedout ++; /* allow for one timeout while closing */
-			goto again;
+	if (rb->idx < rb->nb) {
+		/* Next message from the last batch */
+		mhdr = &rb->mmsg[rb->idx].msg_hdr;
+		chunk = rb->slots[rb->idx];
+		chunklen = rb->mmsg[rb->idx].msg_len;
+		rb->idx++;
+		
+	} else {
+		/* We need to receive from the socket */
+		if (rb->data) {
+			/* The end of a big record is received directly in its buffer */
+			if (rb->datasize == rb->bufsz) {
+				CHECK_FCT( rcvbuf_grow(rb, rb->bufsz) );
+			}
+			mhdr = &rb->mmsg[0].msg_hdr;
+			memset(mhdr, 0, sizeof(struct msghdr));
+			rb->iov[0].iov_base = rb->data + rb->datasize;
+			rb->iov[0].iov_len  = rb->bufsz - rb->datasize;
+			mhdr->msg_iov        = &rb->iov[0];
+			mhdr->msg_iovlen     = 1;
+			mhdr->msg_control    = rb->anci[0];
+			mhdr->msg_controllen = CMSG_BUF_LEN;
+		}
+again:
+		if (rb->data)
+			ret = recvmsg(conn->cc_socket, mhdr, 0);
+		else
+			ret = rcvbuf_fill(conn, rb);
+		pthread_testcancel();
+		
+		/* First, handle timeouts (same as fd_cnx_s_recv) */
+		if ((ret < 0) && ((errno == EAGAIN) || (errno == EINTR))) {
+			if (! fd_cnx_teststate(conn, CC_STATUS_CLOSING ))
+				goto again; /* don't care, just ignore */
+			if (!timedout) {
+				timedout ++; /* allow for one timeout while closing */
+				goto again;
+			}
+			/* fallback to normal handling */
+		}
+		
+		/* Handle errors */
+		if (ret <= 0) { /* Socket timedout, closed, or an error occurred */
+			CHECK_SYS_DO(ret, /* to log in case of error */);
+			free(rb->data);
+			rb->data = NULL;
+			rb->nb = rb->idx = 0;
+			*event = FDEVP_CNX_ERROR;
+			return 0;
+		}
+		conn->cc_rcv_calls++;
+		
+		if (!rb->data) {
+			rb->nb = ret;
+			rb->idx = 0;
+			goto next_message;
 		}
-		/* fallback to normal handling */
+		
+		rb->datasize += ret;
 	}
 	
-	/* Handle errors */
-	if (ret <= 0) { /* Socket timedout, closed, or an error occurred */
-		CHECK_SYS_DO(ret, /* to log in case of error */);
-		free(data);
-		*event = FDEVP_CNX_ERROR;
-		return 0;
+	if (chunk) {
+		if (!rb->data && (mhdr->msg_flags & MSG_EOR)) {
+			/* The whole record is in the slot */
+			CHECK_MALLOC( data = malloc(fd_msg_pmdl_sizewithoverhead(chunklen)) );
+			memcpy(data, chunk, chunklen);
+			datasize = chunklen;
+			goto received;
+		}
+		
+		if (!rb->data) {
+			/* Beginning of a record bigger than the slot. For Diameter messages, we know the size to expect from the header. */
+			rb->bufsz = 2 * chunklen;
+			if (!(mhdr->msg_flags & MSG_NOTIFICATION) && (chunklen >= 4) && (chunk[0] == DIAMETER_VERSION)) {
+				size_t msglen = ((size_t)chunk[1] << 16) + ((size_t)chunk[2] << 8) + (size_t)chunk[3];
+				if ((msglen > chunklen) && (msglen <= DIAMETER_MSG_SIZE_MAX))
+					rb->bufsz = msglen;
+			}
+			CHECK_MALLOC( rb->data = malloc(fd_msg_pmdl_sizewithoverhead(rb->bufsz)) );
+			rb->datasize = 0;
+		}
+		
+		/* Append the data of the slot */
+		CHECK_FCT( rcvbuf_grow(rb, chunklen) );
+		memcpy(rb->data + rb->datasize, chunk, chunklen);
+		rb->datasize += chunklen;
 	}
 	
-	/* Update the size of data we received */
-	datasize += ret;
-
 	/* SCTP provides an indication when we received a full record; loop if it is not the case */
-	if ( ! (mhdr.msg_flags & MSG_EOR) ) {
-		goto incomplete;
+	if ( ! (mhdr->msg_flags & MSG_EOR) ) {
+		goto next_message;
 	}
 	
+	data = rb->data;
+	datasize = rb->datasize;
+	rb->data = NULL;
+	
+received:
 	/* Handle the case where the data received is a notification */
-	if (mhdr.msg_flags & MSG_NOTIFICATION) {
+	if (mhdr->msg_flags & MSG_NOTIFICATION) {
 		union sctp_notification * notif = (union sctp_notification *) data;
 		
 		TRACE_DEBUG(FULL, "Received %zdb data of notification on socket %d", datasize, conn->cc_socket);
@@ -1279,6 +1427,8 @@ again:
 			
 			default:	
 				TRACE_DEBUG(FULL, "Received unknown notification %d, ignored", notif->sn_header.sn_type);
+				free(data);
+				data = NULL;
 				goto next_message;
 		}
 		
@@ -1300,7 +1450,7 @@ again:
 #endif /*  OLD_SCTP_SOCKET_API */
 		
 		/* Handle the anciliary data */
-		for (hdr = CMSG_FIRSTHDR(&mhdr); hdr; hdr = CMSG_NXTHDR(&mhdr, hdr)) {
+		for (hdr = CMSG_FIRSTHDR(mhdr); hdr; hdr = CMSG_NXTHDR(mhdr, hdr)) {
 
 			/* We deal only with anciliary data at SCTP level */
 			if (hdr->cmsg_level != IPPROTO_SCTP) {
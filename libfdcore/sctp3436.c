@@ -51,7 +51,11 @@ Architecture of this wrapper:
  - the push function sends the data on a certain stream.
  We also have a demux thread that reads the socket and store received data in the appropriate fifo
  
- We have one gnutls_session per stream pair, and as many threads that read the gnutls records and save incoming data to the target queue.
+ We have one gnutls_session per stream pair. Once the handshake is done, the records of all the sessions of all the associations
+ are deciphered by a small pool of worker threads (cnf_thr_3436), which save incoming data to the target queue.
+ The demux thread schedules a stream pair each time it stores data in its fifo; a stream pair is handled by at most one worker
+ at a time, and the pull function does not block in that case (the worker moves to another stream pair when the fifo is empty).
+ This preserves the order of the messages within each stream.
  
 This complexity is required because we cannot read a socket for a given stream only; we can only get the next message and find its stream.
 */
@@ -62,6 +66,271 @@ This complexity is required because we cannot read a socket for a given stream o
 /*                      threads                              */
 /*************************************************************/
 
+/* The decipher workers, shared by all the associations */
+static struct fd_list	dec_ready = FD_LIST_INITIALIZER(dec_ready);	/* contexts in DEC_QUEUED state */
+static pthread_mutex_t	dec_lock  = PTHREAD_MUTEX_INITIALIZER;		/* protects dec_ready, dec_state of all contexts, and dec_stop */
+static pthread_cond_t	dec_cond  = PTHREAD_COND_INITIALIZER;		/* signaled when a context is queued */
+static pthread_cond_t	dec_done  = PTHREAD_COND_INITIALIZER;		/* signaled when a worker releases a context */
+static int		dec_stop  = 0;
+
+/* The workers are created with the first association and terminated with the last one */
+static pthread_mutex_t	pool_lock  = PTHREAD_MUTEX_INITIALIZER;
+static int		pool_users = 0;
+static pthread_t       *pool_thr   = NULL;
+static int		pool_nb    = 0;
+
+/* Maximum number of messages a worker extracts from a stream pair before giving the other ones a chance */
+#define DEC_BATCH	16
+
+/* Called by the demuxer when it has stored data for a stream pair */
+static void decipher_schedule(struct sctp3436_ctx * ctx)
+{
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), return );
+	switch (ctx->dec_state) {
+		case DEC_IDLE:
+			ctx->dec_state = DEC_QUEUED;
+			fd_list_insert_before(&dec_ready, &ctx->dec_chain);
+			CHECK_POSIX_DO( pthread_cond_signal(&dec_cond), /* continue */ );
+			break;
+		
+		case DEC_RUNNING:
+			/* The worker will queue the context again when it is done with it */
+			ctx->dec_state = DEC_AGAIN;
+			break;
+		
+		default:
+			/* The handshake thread pulls the data itself, or the context is already scheduled, or terminated */
+			break;
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), /* continue */ );
+}
+
+/* Wrapper around gnutls_record_recv for the workers. Returns the size of received data, 0 if more data is needed, -1 if the session is over */
+static ssize_t decipher_recv(struct cnxctx * conn, struct sctp3436_ctx * ctx, gnutls_session_t session, void * data, size_t sz)
+{
+	ssize_t ret;
+again:
+	ret = gnutls_record_recv(session, data, sz);
+	if (ret > 0)
+		return ret;
+	
+	switch (ret) {
+		case GNUTLS_E_AGAIN:
+			/* The fifo of this stream pair is empty */
+			return 0;
+		
+		case GNUTLS_E_INTERRUPTED:
+			goto again;
+		
+		case GNUTLS_E_REHANDSHAKE:
+			/* A worker cannot wait for a new handshake on one stream pair; the client is allowed to refuse it, so we just ignore the request */
+			LOG_N("Ignoring TLS re-handshake request on stream %hu of '%s'", ctx->strid, conn->cc_id);
+			goto again;
+		
+		case 0:
+			/* The remote peer closed the session */
+			if (!fd_cnx_teststate(conn, CC_STATUS_CLOSING)) {
+				CHECK_GNUTLS_DO( gnutls_bye(session, GNUTLS_SHUT_WR),  );
+			}
+			break;
+		
+		case GNUTLS_E_UNEXPECTED_PACKET_LENGTH:
+			/* The connection is closed */
+			TRACE_DEBUG(FULL, "Got 0 size while reading the socket, probably connection closed...");
+			break;
+		
+		default:
+			if (gnutls_error_is_fatal (ret) == 0) {
+				LOG_N("Ignoring non-fatal GNU TLS error: %s", gnutls_strerror (ret));
+				goto again;
+			}
+			LOG_E("Fatal GNUTLS error: %s", gnutls_strerror (ret));
+	}
+	
+	fd_cnx_markerror(conn);
+	return -1;
+}
+
+/* Free the message being rebuilt on a stream pair, if any */
+static void decipher_free_partial(struct sctp3436_ctx * ctx)
+{
+	if (ctx->dec.rcv_data.buffer) {
+		struct fd_msg_pmdl * pmdl = fd_msg_pmdl_get_inbuf(ctx->dec.rcv_data.buffer, ctx->dec.rcv_data.length);
+		(void) pthread_mutex_destroy(&pmdl->lock);
+		free(ctx->dec.rcv_data.buffer);
+	}
+	memset(&ctx->dec, 0, sizeof(ctx->dec));
+}
+
+/* Decrypt the data received in this stream pair and store the complete messages in the target queue.
+ * Returns 0 when all the received data was processed, EAGAIN if the worker should come back later, an error code when the session is over. */
+static int decipher_run(struct sctp3436_ctx * ctx)
+{
+	struct cnxctx * conn = ctx->parent;
+	gnutls_session_t session = ctx->strid ? ctx->session : conn->cc_tls_para.session;
+	int nb;
+	
+	TRACE_ENTRY("%p", ctx);
+	
+	/* No guarantee that GnuTLS preserves the message boundaries, so we re-build it as in TCP. */
+	for (nb = 0; nb < DEC_BATCH; nb++) {
+		struct fd_cnx_rcvdata * rcv_data = &ctx->dec.rcv_data;
+		struct fd_msg_pmdl *pmdl=NULL;
+		ssize_t ret;
+		int err;
+		
+		while (ctx->dec.received < sizeof(ctx->dec.header)) {
+			ret = decipher_recv(conn, ctx, session, &ctx->dec.header[ctx->dec.received], sizeof(ctx->dec.header) - ctx->dec.received);
+			if (ret <= 0)
+				return ret ? ENOTCONN : 0;
+			ctx->dec.received += ret;
+		}
+		
+		if (!rcv_data->buffer) {
+			size_t length = ((size_t)ctx->dec.header[1] << 16) + ((size_t)ctx->dec.header[2] << 8) + (size_t)ctx->dec.header[3];
+			
+			/* Check the received word is a valid beginning of a Diameter message */
+			if ((ctx->dec.header[0] != DIAMETER_VERSION)	/* defined in <libfreeDiameter.h> */
+			   || (length > DIAMETER_MSG_SIZE_MAX) /* to avoid too big mallocs */
+			   || (length < sizeof(ctx->dec.header))) {
+				/* The message is suspect */
+				LOG_E( "Received suspect header [ver: %d, size: %zd] from '%s', assume disconnection", (int)ctx->dec.header[0], length, conn->cc_remid);
+				fd_cnx_markerror(conn);
+				return ENOTCONN;
+			}
+			
+			/* Ok, now we can really receive the data */
+			CHECK_MALLOC_DO( rcv_data->buffer = fd_cnx_alloc_msg_buffer( length, &pmdl ), { fd_cnx_markerror(conn); return ENOMEM; } );
+			rcv_data->length = length;
+			memcpy(rcv_data->buffer, ctx->dec.header, sizeof(ctx->dec.header));
+		}
+		
+		while (ctx->dec.received < rcv_data->length) {
+			ret = decipher_recv(conn, ctx, session, rcv_data->buffer + ctx->dec.received, rcv_data->length - ctx->dec.received);
+			if (ret <= 0)
+				return ret ? ENOTCONN : 0;
+			ctx->dec.received += ret;
+		}
+		
+		pmdl = fd_msg_pmdl_get_inbuf(rcv_data->buffer, rcv_data->length);
+		fd_hook_call(HOOK_DATA_RECEIVED, NULL, NULL, rcv_data, pmdl);
+		conn->cc_rcv_msgs++;
+		
+		/* We have received a complete message, pass it to the daemon. The workers are shared, so do not wait for room in the queue. */
+		CHECK_FCT_DO( err = fd_event_send_noblock( fd_cnx_target_queue(conn), FDEVP_CNX_MSG_RECV, rcv_data->length, rcv_data->buffer),
+			{
+				decipher_free_partial(ctx);
+				CHECK_FCT_DO(fd_core_shutdown(), );
+				return err;
+			} );
+		memset(&ctx->dec, 0, sizeof(ctx->dec));
+	}
+	
+	/* There may be more messages, but let the other stream pairs progress */
+	return EAGAIN;
+}
+
+/* Worker thread: decipher the stream pairs as they are scheduled */
+static void * decipher_worker(void * arg)
+{
+	TRACE_ENTRY("%p", arg);
+	
+	/* Set the thread name */
+	{
+		char buf[48];
+		snprintf(buf, sizeof(buf), "Decipher (%ld)", (long)arg);
+		fd_log_threadname ( buf );
+	}
+	fd_thr_bind(FD_THR_RECV, -1);
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), return NULL );
+	pthread_cleanup_push( fd_cleanup_mutex, &dec_lock );
+	
+	while (!dec_stop) {
+		struct sctp3436_ctx * ctx;
+		int ret;
+		
+		if (FD_IS_LIST_EMPTY(&dec_ready)) {
+			CHECK_POSIX_DO( pthread_cond_wait(&dec_cond, &dec_lock), break );
+			continue;
+		}
+		
+		ctx = dec_ready.next->o;
+		fd_list_unlink(&ctx->dec_chain);
+		ctx->dec_state = DEC_RUNNING;
+		CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), break );
+		
+		ret = decipher_run(ctx);
+		
+		CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), break );
+		if (ret && (ret != EAGAIN)) {
+			ctx->dec_state = DEC_DONE;
+		} else if ((ret == EAGAIN) || (ctx->dec_state == DEC_AGAIN)) {
+			ctx->dec_state = DEC_QUEUED;
+			fd_list_insert_before(&dec_ready, &ctx->dec_chain);
+		} else {
+			ctx->dec_state = DEC_IDLE;
+		}
+		CHECK_POSIX_DO( pthread_cond_broadcast(&dec_done), /* continue */ );
+	}
+	
+	pthread_cleanup_pop( 1 );
+	TRACE_DEBUG(FULL, "Thread terminated");	
+	return NULL;
+}
+
+/* Terminate the workers; there is no more context at this point */
+static void decipher_pool_stop(void)
+{
+	int i;
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), /* continue */ );
+	dec_stop = 1;
+	CHECK_POSIX_DO( pthread_cond_broadcast(&dec_cond), /* continue */ );
+	CHECK_POSIX_DO( pthread_mutex_unlock(&dec_lock), /* continue */ );
+	
+	for (i = 0; i < pool_nb; i++) {
+		CHECK_POSIX_DO( pthread_join(pool_thr[i], NULL), /* continue */ );
+	}
+	free(pool_thr);
+	pool_thr = NULL;
+	pool_nb = 0;
+}
+
+/* A new association uses the workers */
+static int decipher_pool_get(void)
+{
+	int ret = 0;
+	
+	CHECK_POSIX( pthread_mutex_lock(&pool_lock) );
+	if (pool_users == 0) {
+		long i;
+		dec_stop = 0;
+		CHECK_MALLOC_DO( pool_thr = calloc(fd_g_config->cnf_thr_3436, sizeof(pthread_t)), { ret = ENOMEM; goto out; } );
+		for (i = 0; i < fd_g_config->cnf_thr_3436; i++) {
+			CHECK_POSIX_DO( ret = pthread_create( &pool_thr[i], NULL, decipher_worker, (void *)i ), break );
+			pool_nb++;
+		}
+		if (ret) {
+			decipher_pool_stop();
+			goto out;
+		}
+	}
+	pool_users++;
+out:
+	CHECK_POSIX( pthread_mutex_unlock(&pool_lock) );
+	return ret;
+}
+
+/* An association does not use the workers anymore */
+static void decipher_pool_put(void)
+{
+	CHECK_POSIX_DO( pthread_mutex_lock(&pool_lock), return );
+	if (--pool_users == 0)
+		decipher_pool_stop();
+	CHECK_POSIX_DO( pthread_mutex_unlock(&pool_lock), /* continue */ );
+}
+
 /* Demux received data and store in the appropriate fifo */
 static void * demuxer(void * arg)
 {
@@ -80,18 +349,22 @@ static void * demuxer(void * arg)
 		snprintf(buf, sizeof(buf), "Demuxer (%d:%s)", conn->cc_socket, conn->cc_remid);
 		fd_log_threadname ( buf );
 	}
+	fd_thr_bind(FD_THR_RECV, -1);
 	
 	ASSERT( conn->cc_proto == IPPROTO_SCTP );
 	ASSERT( fd_cnx_target_queue(conn) );
 	ASSERT( conn->cc_sctp3436_data.array );
 	
 	do {
+		/* Do not read more while the reception is paused */
+		fd_cnx_recv_wait(conn);
 		CHECK_FCT_DO( fd_sctp_recvmeta(conn, &strid, &buf, &bufsz, &event), goto fatal );
 		switch (event) {
 			case FDEVP_CNX_MSG_RECV:
 				/* Demux this message to the appropriate fifo, another thread will pull, gnutls process, and send to target queue */
 				if (strid < conn->cc_sctp_para.pairs) {
 					CHECK_FCT_DO(fd_event_send(conn->cc_sctp3436_data.array[strid].raw_recv, event, bufsz, buf), goto fatal );
+					decipher_schedule(&conn->cc_sctp3436_data.array[strid]);
 				} else {
 					TRACE_DEBUG(INFO, "Received packet (%zd bytes) on out-of-range stream #%d from %s, discarded.", bufsz, strid, conn->cc_remid);
 					free(buf);
@@ -117,10 +390,11 @@ static void * demuxer(void * arg)
 	} while (conn->cc_loop);
 	
 out:
-	/* Signal termination of the connection to all decipher threads */
+	/* Signal termination of the connection to all decipher workers */
 	for (strid = 0; strid < conn->cc_sctp_para.pairs; strid++) {
 		if (conn->cc_sctp3436_data.array[strid].raw_recv) {
 			CHECK_FCT_DO(fd_event_send(conn->cc_sctp3436_data.array[strid].raw_recv, FDEVP_CNX_ERROR, 0, NULL), goto fatal );
+			decipher_schedule(&conn->cc_sctp3436_data.array[strid]);
 		}
 	}
 	fd_cnx_markerror(conn);
@@ -133,32 +407,6 @@ fatal:
 	goto out;
 }
 
-/* Decrypt the data received in this stream pair and store it in the target queue */
-static void * decipher(void * arg)
-{
-	struct sctp3436_ctx * ctx = arg;
-	struct cnxctx 	 *cnx;
-	
-	TRACE_ENTRY("%p", arg);
-	CHECK_PARAMS_DO(ctx && ctx->raw_recv && ctx->parent, goto error);
-	cnx = ctx->parent;
-	ASSERT( fd_cnx_target_queue(cnx) );
-	
-	/* Set the thread name */
-	{
-		char buf[48];
-		snprintf(buf, sizeof(buf), "Decipher (%hu@%d:%s)", ctx->strid, cnx->cc_socket, cnx->cc_remid);
-		fd_log_threadname ( buf );
-	}
-	
-	/* The next function loops while there is no error */
-	CHECK_FCT_DO(fd_tls_rcvthr_core(cnx, ctx->strid ? ctx->session : cnx->cc_tls_para.session), /* continue */);
-error:
-	fd_cnx_markerror(cnx);
-	TRACE_DEBUG(FULL, "Thread terminated");	
-	return NULL;
-}
-
 /*************************************************************/
 /*                     push / pull                           */
 /*************************************************************/
@@ -176,7 +424,8 @@ static int sctp3436_pull_timeout(gnutls_transport_ptr_t tr, unsigned int ms)
 	if (ctx->partial.buf)
 		return 1; /* data is already available for pull */
 	
-	if (ms) {
+	/* The workers never wait for data */
+	if (ms && (ctx->dec_state == DEC_NONE)) {
 		CHECK_SYS_DO(  clock_gettime(CLOCK_REALTIME, &tsstore),  return -1  );
 		tsstore.tv_nsec += (long)ms * 1000000;
 		tsstore.tv_sec += tsstore.tv_nsec / 1000000000L;
@@ -231,11 +480,31 @@ static ssize_t sctp3436_pull(gnutls_transport_ptr_t tr, void * buf, size_t len)
 	TRACE_ENTRY("%p %p %zd", tr, buf, len);
 	CHECK_PARAMS_DO( tr && buf, { errno = EINVAL; goto error; } );
 	
-	/* If we don't have data available now, pull new message from the fifo -- this is blocking (until the queue is destroyed) */
+	/* If we don't have data available now, pull new message from the fifo -- this is blocking (until the queue is destroyed) during the handshake.
+	 The workers only take what is available; the demuxer schedules the stream pair again when it receives more data. */
 	if (!ctx->partial.buf) {
 		int ev;
-		CHECK_FCT_DO( errno = fd_event_get(ctx->raw_recv, &ev, &ctx->partial.bufsz, (void *)&ctx->partial.buf), goto error );
+		if (ctx->dec_state != DEC_NONE) {
+			struct fd_event * e;
+			int ret = fd_fifo_tryget(ctx->raw_recv, &e);
+			if (ret == EWOULDBLOCK) {
+				errno = EAGAIN;
+				goto error;
+			}
+			CHECK_FCT_DO( errno = ret, goto error );
+			ev = e->code;
+			ctx->partial.bufsz = e->size;
+			ctx->partial.buf = e->data;
+			free(e);
+		} else {
+			CHECK_FCT_DO( errno = fd_event_get(ctx->raw_recv, &ev, &ctx->partial.bufsz, (void *)&ctx->partial.buf), goto error );
+		}
 		if (ev == FDEVP_CNX_ERROR) {
+			if (ctx->dec_state != DEC_NONE) {
+				/* Make sure the worker does not take it for EAGAIN */
+				errno = ENOTCONN;
+				goto error;
+			}
 			/* Documentations says to return 0 on connection closed, but it does hang within gnutls_handshake */
 			return -1;
 		}
@@ -265,7 +534,7 @@ static ssize_t sctp3436_pull(gnutls_transport_ptr_t tr, void * buf, size_t len)
 	return pulled;
 	
 error:
-	gnutls_transport_set_errno (ctx->session, errno);
+	gnutls_transport_set_errno (ctx->strid ? ctx->session : ctx->parent->cc_tls_para.session, errno);
 	return -1;
 }
 
@@ -564,9 +833,11 @@ int fd_sctp3436_init(struct cnxctx * conn)
 	
 	/* First, alloc the array and initialize the non-TLS data */
 	CHECK_MALLOC( conn->cc_sctp3436_data.array = calloc(conn->cc_sctp_para.pairs, sizeof(struct sctp3436_ctx))  );
+	CHECK_FCT_DO( decipher_pool_get(), { free(conn->cc_sctp3436_data.array); conn->cc_sctp3436_data.array = NULL; return ENOMEM; } );
 	for (i = 0; i < conn->cc_sctp_para.pairs; i++) {
 		conn->cc_sctp3436_data.array[i].parent = conn;
 		conn->cc_sctp3436_data.array[i].strid  = i;
+		fd_list_init(&conn->cc_sctp3436_data.array[i].dec_chain, &conn->cc_sctp3436_data.array[i]);
 		CHECK_FCT( fd_fifo_new(&conn->cc_sctp3436_data.array[i].raw_recv, 10) );
 	}
 	
@@ -675,6 +946,18 @@ int fd_sctp3436_handshake_others(struct cnxctx * conn, char * priority, void * a
 	return 0;
 }
 
+/* Hand a stream pair over to the workers, once its handshake is complete */
+static int decipher_start(struct sctp3436_ctx * ctx)
+{
+	CHECK_POSIX( pthread_mutex_lock(&dec_lock) );
+	/* Some data may have been received already */
+	ctx->dec_state = DEC_QUEUED;
+	fd_list_insert_before(&dec_ready, &ctx->dec_chain);
+	CHECK_POSIX( pthread_cond_signal(&dec_cond) );
+	CHECK_POSIX( pthread_mutex_unlock(&dec_lock) );
+	return 0;
+}
+
 /* Receive messages from others ? all other stream pairs : the master pair */
 int fd_sctp3436_startthreads(struct cnxctx * conn, int others)
 {
@@ -685,12 +968,10 @@ int fd_sctp3436_startthreads(struct cnxctx * conn, int others)
 	
 	if (others) {
 		for (i = 1; i < conn->cc_sctp_para.pairs; i++) {
-
-			/* Start the decipher thread */
-			CHECK_POSIX( pthread_create( &conn->cc_sctp3436_data.array[i].thr, NULL, decipher, &conn->cc_sctp3436_data.array[i] ) );
+			CHECK_FCT( decipher_start(&conn->cc_sctp3436_data.array[i]) );
 		}
 	} else {
-		CHECK_POSIX( pthread_create( &conn->cc_sctp3436_data.array[0].thr, NULL, decipher, &conn->cc_sctp3436_data.array[0] ) );
+		CHECK_FCT( decipher_start(&conn->cc_sctp3436_data.array[0]) );
 	}
 	return 0;
 }
@@ -718,12 +999,15 @@ void fd_sctp3436_waitthreadsterm(struct cnxctx * conn)
 	TRACE_ENTRY("%p", conn);
 	CHECK_PARAMS_DO( conn && conn->cc_sctp3436_data.array, return );
 	
+	/* The workers terminate the stream pairs when they receive the "bye" from the peer, or an error */
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), return );
+	pthread_cleanup_push( fd_cleanup_mutex, &dec_lock );
 	for (i = 0; i < conn->cc_sctp_para.pairs; i++) {
-		if (conn->cc_sctp3436_data.array[i].thr != (pthread_t)NULL) {
-			CHECK_POSIX_DO( pthread_join(conn->cc_sctp3436_data.array[i].thr, NULL), /* continue */ );
-			conn->cc_sctp3436_data.array[i].thr = (pthread_t)NULL;
+		while ((conn->cc_sctp3436_data.array[i].dec_state != DEC_NONE) && (conn->cc_sctp3436_data.array[i].dec_state != DEC_DONE)) {
+			CHECK_POSIX_DO( pthread_cond_wait(&dec_done, &dec_lock), break );
 		}
 	}
+	pthread_cleanup_pop( 1 );
 	return;
 }
 
@@ -744,7 +1028,7 @@ void fd_sctp3436_gnutls_deinit_others(struct cnxctx * conn)
 }
 
 
-/* Stop all receiver threads */
+/* Stop deciphering all stream pairs */
 void fd_sctp3436_stopthreads(struct cnxctx * conn)
 {
 	uint16_t i;
@@ -752,9 +1036,18 @@ void fd_sctp3436_stopthreads(struct cnxctx * conn)
 	TRACE_ENTRY("%p", conn);
 	CHECK_PARAMS_DO( conn && conn->cc_sctp3436_data.array, return );
 	
+	CHECK_POSIX_DO( pthread_mutex_lock(&dec_lock), return );
+	pthread_cleanup_push( fd_cleanup_mutex, &dec_lock );
 	for (i = 0; i < conn->cc_sctp_para.pairs; i++) {
-		CHECK_FCT_DO( fd_thr_term(&conn->cc_sctp3436_data.array[i].thr), /* continue */ );
+		struct sctp3436_ctx * ctx = &conn->cc_sctp3436_data.array[i];
+		/* Let the worker finish with this context */
+		while ((ctx->dec_state == DEC_RUNNING) || (ctx->dec_state == DEC_AGAIN)) {
+			CHECK_POSIX_DO( pthread_cond_wait(&dec_done, &dec_lock), break );
+		}
+		fd_list_unlink(&ctx->dec_chain);
+		ctx->dec_state = DEC_DONE;
 	}
+	pthread_cleanup_pop( 1 );
 	return;
 }
 
@@ -765,17 +1058,21 @@ void fd_sctp3436_destroy(struct cnxctx * conn)
 	
 	CHECK_PARAMS_DO( conn && conn->cc_sctp3436_data.array, return );
 	
-	/* Terminate all receiving threads in case we did not do it yet */
+	/* Stop deciphering in case we did not do it yet */
 	fd_sctp3436_stopthreads(conn);
 	
 	/* Now, stop the demux thread */
 	CHECK_FCT_DO( fd_thr_term(&conn->cc_rcvthr), /* continue */ );
 	
+	/* This association does not need the workers anymore */
+	decipher_pool_put();
+	
 	/* Free remaining data in the array */
 	for (i = 0; i < conn->cc_sctp_para.pairs; i++) {
 		if (conn->cc_sctp3436_data.array[i].raw_recv)
 			fd_event_destroy( &conn->cc_sctp3436_data.array[i].raw_recv, free );
 		free(conn->cc_sctp3436_data.array[i].partial.buf);
+		decipher_free_partial(&conn->cc_sctp3436_data.array[i]);
 		if (conn->cc_sctp3436_data.array[i].session) {
 			GNUTLS_TRACE( gnutls_deinit(conn->cc_sctp3436_data.array[i].session) );
 			conn->cc_sctp3436_data.array[i].session = NULL;
@@ -149,6 +149,7 @@ static void * client_worker(void * arg)
 		snprintf(buf, sizeof(buf), "Worker#%d[%s%s]", pw->id, IPPROTO_NAME(s->proto), s->secur?", Sec" : "");
 		fd_log_threadname ( buf );
 	}
+	fd_thr_bind(FD_THR_RECV, -1);
 	
 	/* Loop until canceled / error */
 next_client:
@@ -159,8 +160,8 @@ next_client:
 	/* Get the next connection */
 	CHECK_FCT_DO( fd_fifo_get( s->pending, &c ), { fatal = 1; goto cleanup; } );
 
-	/* Handshake if we are a secure server port, or start clear otherwise */
-	if (s->secur) {
+	/* Handshake if we are a secure server port (unless already done by the handshake pool), or start clear otherwise */
+	if (s->secur && !fd_cnx_getTLS(c)) {
 		LOG_D("Starting handshake with %s", fd_cnx_getid(c));
 
 		int ret = fd_cnx_handshake(c, GNUTLS_SERVER, (s->secur == 1) ? ALGO_HANDSHAKE_DEFAULT : ALGO_HANDSHAKE_3436, NULL, NULL);
@@ -272,6 +273,25 @@ cleanup:
 	return NULL;
 }	
 
+/* End of a handshake performed by the pool, for a secure server */
+static void serv_handshake_done(struct cnxctx * conn, int ret, void * data)
+{
+	struct server *s = (struct server *)data;
+	
+	if (ret != 0) {
+		char buf[1024];
+		snprintf(buf, sizeof(buf), "TLS handshake %s for connection '%s', connection closed.", (ret == ETIMEDOUT) ? "timed out" : "failed", fd_cnx_getid(conn));
+
+		fd_hook_call(HOOK_PEER_CONNECT_FAILED, NULL, NULL, buf, NULL);
+		
+		fd_cnx_destroy(conn);
+		return;
+	}
+	
+	/* Do not block the pool: the number of connections in excess is limited by cnf_hs_max */
+	CHECK_FCT_DO( fd_fifo_post_noblock( s->pending, (void *)&conn ), fd_cnx_destroy(conn) );
+}
+
 /* The thread managing a server */
 static void * serv_th(void * arg)
 {
@@ -279,6 +299,7 @@ static void * serv_th(void * arg)
 	
 	CHECK_PARAMS_DO(s, goto error);
 	fd_log_threadname ( fd_cnx_getid(s->conn) );
+	fd_thr_bind(FD_THR_RECV, -1);
 	
 	set_status(s, RUNNING);
 	
@@ -291,6 +312,26 @@ static void * serv_th(void * arg)
 		/* Wait for a new client or cancel */
 		CHECK_MALLOC_DO( conn = fd_cnx_serv_accept(s->conn), break );
 		
+		/* Secure server: the handshake is performed by the pool of TLS threads when possible */
+		if (s->secur) {
+			int ret = fd_cnx_handshake_async(conn, GNUTLS_SERVER, (s->secur == 1) ? ALGO_HANDSHAKE_DEFAULT : ALGO_HANDSHAKE_3436, NULL, NULL, serv_handshake_done, s);
+			if (ret == 0)
+				continue;
+			if (ret != ENOTSUP) {
+				char buf[1024];
+				if (ret == EBUSY)
+					snprintf(buf, sizeof(buf), "Too many TLS handshakes in progress, connection '%s' closed.", fd_cnx_getid(conn));
+				else
+					snprintf(buf, sizeof(buf), "TLS handshake failed for connection '%s', connection closed.", fd_cnx_getid(conn));
+				
+				fd_hook_call(HOOK_PEER_CONNECT_FAILED, NULL, NULL, buf, NULL);
+				
+				fd_cnx_destroy(conn);
+				continue;
+			}
+			/* Otherwise the worker will handshake */
+		}
+		
 		/* Store this connection in the fifo for processing by the worker pool. Will block when the fifo is full */
 		pthread_cleanup_push((void *)fd_cnx_destroy, conn);
 		CHECK_FCT_DO( fd_fifo_post( s->pending, &conn ), break );
@@ -0,0 +1,458 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+
+/* Pool of threads for the TLS handshakes of the TCP connections.
+ *
+ * The handshakes are run as non-blocking state machines: the transport functions installed on the session never wait, and
+ * gnutls_handshake returns GNUTLS_E_AGAIN when it needs more data or room in the socket. The socket is then watched by the
+ * poller thread (epoll, one-shot), which gives the handshake back to the workers when the socket is ready. The workers
+ * (cnf_thr_hs, by default one per online CPU) only perform the computing part of the handshakes, so a slow or silent peer
+ * does not hold a thread.
+ *
+ * At most cnf_hs_max handshakes are in progress at the same time: fd_tls_hs_reserve fails with EBUSY above this limit and
+ * the caller closes the connection. A handshake that is not complete after HS_TIMEOUT seconds fails with ETIMEDOUT.
+ *
+ * The multi-stream SCTP associations (sctp3436.c) and DTLS keep blocking handshakes, performed by the caller.
+ */
+
+#include "fdcore-internal.h"
+#include "cnxctx.h"
+
+#if defined(HAVE_EPOLL) && defined(GNUTLS_VERSION_300)
+#define HS_POOL
+#endif /* HAVE_EPOLL && GNUTLS_VERSION_300 */
+
+#ifdef HS_POOL
+#include <sys/epoll.h>
+#include <poll.h>
+
+#define HS_TIMEOUT	10	/* seconds to complete a handshake */
+#define HS_TICK		500	/* ms between two checks of the timeouts */
+#define HS_EVENTS	64	/* events retrieved by one epoll_wait call */
+
+/* A handshake in progress */
+struct hs_ctx {
+	struct fd_list	 chain;		/* link in hs_waiting while the socket is watched */
+	struct cnxctx	*conn;
+	void	       (*cb)(struct cnxctx *, int, void *);
+	void		*data;
+	struct timespec	 start;
+	time_t		 deadline;
+	int		 registered;	/* the socket is in the epoll set */
+	int		 timedout;	/* set by the poller */
+};
+
+static pthread_mutex_t	 hs_lock = PTHREAD_MUTEX_INITIALIZER; /* protects the following data */
+static int		 hs_running = 0;
+static struct fd_list	 hs_waiting = FD_LIST_INITIALIZER(hs_waiting); /* handshakes waiting for their socket, not ordered */
+static int		 hs_count = 0;	/* reserved slots */
+static struct fd_tls_hs_stats hs_stats;
+
+static int		 hs_epfd = -1;
+static struct fifo	*hs_work = NULL; /* handshakes ready for the next step */
+static volatile int	 hs_stop = 0;
+static pthread_t	 hs_poller = (pthread_t)NULL;
+static pthread_t	*hs_workers = NULL;
+static int		 hs_nb = 0;
+static struct hs_ctx	 hs_sentinel;	/* posted to a worker to terminate it */
+
+/* The transport functions during the handshake: same as fd_cnx_s_recv / fd_cnx_s_sendv / fd_cnx_s_select, without waiting */
+static ssize_t hs_pull(gnutls_transport_ptr_t tr, void * buf, size_t len)
+{
+	struct cnxctx * conn = (struct cnxctx *)tr;
+	ssize_t ret = recv(conn->cc_socket, buf, len, MSG_DONTWAIT);
+	if (ret < 0)
+		gnutls_transport_set_errno(conn->cc_tls_para.session, errno);
+	return ret;
+}
+
+static ssize_t hs_pushv(gnutls_transport_ptr_t tr, const giovec_t * iov, int iovcnt)
+{
+	struct cnxctx * conn = (struct cnxctx *)tr;
+	struct msghdr mhdr;
+	ssize_t ret;
+
+	memset(&mhdr, 0, sizeof(mhdr));
+	mhdr.msg_iov = (struct iovec *)iov;
+	mhdr.msg_iovlen = iovcnt;
+	ret = sendmsg(conn->cc_socket, &mhdr, MSG_DONTWAIT | MSG_NOSIGNAL);
+	if (ret < 0)
+		gnutls_transport_set_errno(conn->cc_tls_para.session, errno);
+	return ret;
+}
+
+static int hs_pull_timeout(gnutls_transport_ptr_t tr, unsigned int ms)
+{
+	struct cnxctx * conn = (struct cnxctx *)tr;
+	struct pollfd pfd;
+
+	pfd.fd = conn->cc_socket;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	return poll(&pfd, 1, 0);
+}
+
+/* Account for the end of a handshake, and report it */
+static void hs_complete(struct hs_ctx * hs, int ret)
+{
+	struct timespec now;
+	unsigned long long ms;
+
+	if (hs->registered) {
+		CHECK_SYS_DO( epoll_ctl(hs_epfd, EPOLL_CTL_DEL, hs->conn->cc_socket, NULL), /* continue */ );
+	}
+
+	CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &now), now = hs->start );
+	ms = (now.tv_sec - hs->start.tv_sec) * 1000 + (now.tv_nsec - hs->start.tv_nsec) / 1000000;
+
+	CHECK_POSIX_DO( pthread_mutex_lock(&hs_lock), /* continue */ );
+	hs_count--;
+	switch (ret) {
+		case 0:
+			hs_stats.succeeded++;
+			hs_stats.total_ms += ms;
+			break;
+		case ETIMEDOUT:
+			hs_stats.timedout++;
+			break;
+		default:
+			hs_stats.failed++;
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&hs_lock), /* continue */ );
+
+	(*hs->cb)(hs->conn, ret, hs->data);
+	free(hs);
+}
+
+/* Watch the socket until it is ready for the direction the handshake is blocked on */
+static int hs_arm(struct hs_ctx * hs)
+{
+	struct epoll_event ev;
+	int ret = 0;
+
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLONESHOT | (gnutls_record_get_direction(hs->conn->cc_tls_para.session) ? EPOLLOUT : EPOLLIN);
+	ev.data.ptr = hs;
+
+	/* The handshake must be in the list before the poller can receive the event */
+	CHECK_POSIX( pthread_mutex_lock(&hs_lock) );
+	if (epoll_ctl(hs_epfd, hs->registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, hs->conn->cc_socket, &ev) < 0) {
+		ret = errno;
+	} else {
+		hs->registered = 1;
+		fd_list_insert_before(&hs_waiting, &hs->chain);
+	}
+	CHECK_POSIX( pthread_mutex_unlock(&hs_lock) );
+
+	return ret;
+}
+
+/* Run the handshake until it completes or needs to wait for the socket */
+static void hs_step(struct hs_ctx * hs)
+{
+	struct cnxctx * conn = hs->conn;
+	int ret;
+
+	if (hs->timedout) {
+		if (TRACE_BOOL(INFO)) {
+			fd_log_debug("TLS Handshake timed out on socket %d (%s)", conn->cc_socket, conn->cc_id);
+		}
+		hs_complete(hs, ETIMEDOUT);
+		return;
+	}
+
+	do {
+		ret = gnutls_handshake(conn->cc_tls_para.session);
+	} while ((ret < 0) && (ret != GNUTLS_E_AGAIN) && !gnutls_error_is_fatal(ret));
+
+	switch (ret) {
+		case GNUTLS_E_SUCCESS:
+			hs_complete(hs, 0);
+			break;
+
+		case GNUTLS_E_AGAIN:
+			CHECK_FCT_DO( ret = hs_arm(hs), hs_complete(hs, ret) );
+			break;
+
+		default:
+			if (TRACE_BOOL(INFO)) {
+				fd_log_debug("TLS Handshake failed on socket %d (%s) : %s", conn->cc_socket, conn->cc_id, gnutls_strerror(ret));
+			}
+			hs_complete(hs, EINVAL);
+	}
+}
+
+static void * hs_worker(void * arg)
+{
+	char buf[48];
+	snprintf(buf, sizeof(buf), "TLS handshake (%d)", (int)(long)arg);
+	fd_log_threadname ( buf );
+	fd_thr_bind(FD_THR_RECV, -1);
+
+	while (1) {
+		struct hs_ctx * hs;
+
+		CHECK_FCT_DO( fd_fifo_get(hs_work, &hs), break );
+		if (hs == &hs_sentinel)
+			break;
+
+		hs_step(hs);
+	}
+
+	TRACE_DEBUG(FULL, "Thread terminated");
+	return NULL;
+}
+
+/* Dispatch the sockets that became ready, and the handshakes that timed out */
+static void * hs_poll(void * arg)
+{
+	struct epoll_event events[HS_EVENTS];
+
+	fd_log_threadname ( "TLS handshake poller" );
+
+	while (!hs_stop) {
+		struct fd_list * li, * next;
+		time_t now;
+		int n, i;
+
+		n = epoll_wait(hs_epfd, events, HS_EVENTS, HS_TICK);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			LOG_E("epoll_wait failed on the TLS handshakes: %s", strerror(errno));
+			break;
+		}
+
+		now = time(NULL);
+
+		CHECK_POSIX_DO( pthread_mutex_lock(&hs_lock), break );
+		for (i = 0; i < n; i++) {
+			struct hs_ctx * hs = events[i].data.ptr;
+			fd_list_unlink(&hs->chain);
+			CHECK_FCT_DO( fd_fifo_post(hs_work, &hs), /* the handshake will time out */ fd_list_insert_before(&hs_waiting, &hs->chain) );
+		}
+		for (li = hs_waiting.next; li != &hs_waiting; li = next) {
+			struct hs_ctx * hs = li->o;
+			next = li->next;
+			if (hs->deadline > now)
+				continue;
+			CHECK_SYS_DO( epoll_ctl(hs_epfd, EPOLL_CTL_DEL, hs->conn->cc_socket, NULL), /* continue */ );
+			hs->registered = 0;
+			hs->timedout = 1;
+			fd_list_unlink(&hs->chain);
+			CHECK_FCT_DO( fd_fifo_post(hs_work, &hs), fd_list_insert_before(&hs_waiting, &hs->chain) );
+		}
+		CHECK_POSIX_DO( pthread_mutex_unlock(&hs_lock), break );
+	}
+
+	TRACE_DEBUG(FULL, "Thread terminated");
+	return NULL;
+}
+
+#endif /* HS_POOL */
+
+/* Start the pool. Returns ENOTSUP if the system does not allow it, the handshakes are then performed by the callers. */
+int fd_tls_hs_init(void)
+{
+#ifndef HS_POOL
+	return ENOTSUP;
+#else /* HS_POOL */
+	TRACE_ENTRY();
+	CHECK_PARAMS( hs_running == 0 );
+
+	CHECK_SYS( hs_epfd = epoll_create1(EPOLL_CLOEXEC) );
+	CHECK_FCT( fd_fifo_new(&hs_work, 0) );
+	hs_stop = 0;
+	CHECK_POSIX( pthread_create(&hs_poller, NULL, hs_poll, NULL) );
+
+	CHECK_MALLOC( hs_workers = calloc(fd_g_config->cnf_thr_hs, sizeof(pthread_t)) );
+	for (hs_nb = 0; hs_nb < fd_g_config->cnf_thr_hs; hs_nb++) {
+		CHECK_POSIX( pthread_create(&hs_workers[hs_nb], NULL, hs_worker, (void *)(long)hs_nb) );
+	}
+
+	CHECK_POSIX( pthread_mutex_lock(&hs_lock) );
+	hs_running = 1;
+	CHECK_POSIX( pthread_mutex_unlock(&hs_lock) );
+
+	return 0;
+#endif /* HS_POOL */
+}
+
+/* Reserve a slot for the handshake of conn. Returns ENOTSUP if the connection cannot use the pool, EBUSY if the limit is reached. */
+int fd_tls_hs_reserve(struct cnxctx * conn)
+{
+#ifndef HS_POOL
+	return ENOTSUP;
+#else /* HS_POOL */
+	int ret = 0;
+
+	TRACE_ENTRY("%p", conn);
+	CHECK_PARAMS( conn );
+
+	if (conn->cc_proto != IPPROTO_TCP)
+		return ENOTSUP;
+
+	CHECK_POSIX( pthread_mutex_lock(&hs_lock) );
+	if (!hs_running) {
+		ret = ENOTSUP;
+	} else if (hs_count >= fd_g_config->cnf_hs_max) {
+		hs_stats.rejected++;
+		ret = EBUSY;
+	} else {
+		hs_count++;
+	}
+	CHECK_POSIX( pthread_mutex_unlock(&hs_lock) );
+
+	return ret;
+#endif /* HS_POOL */
+}
+
+/* Give back a reserved slot that will not be used */
+void fd_tls_hs_release(void)
+{
+#ifdef HS_POOL
+	CHECK_POSIX_DO( pthread_mutex_lock(&hs_lock), /* continue */ );
+	hs_count--;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&hs_lock), /* continue */ );
+#endif /* HS_POOL */
+}
+
+/* Handshake conn, whose session is prepared, in the pool. A slot must have been reserved.
+ * If the function returns 0, cb is called exactly once from a thread of the pool (or from fd_tls_hs_fini) with the result.
+ * Otherwise, the slot is released and cb is not called. The transport functions of the session are replaced. */
+int fd_tls_hs_submit(struct cnxctx * conn, void (*cb)(struct cnxctx * conn, int ret, void * data), void * data)
+{
+#ifndef HS_POOL
+	return ENOTSUP;
+#else /* HS_POOL */
+	struct hs_ctx * hs;
+
+	TRACE_ENTRY("%p %p %p", conn, cb, data);
+	CHECK_PARAMS_DO( conn && conn->cc_tls_para.session && cb, { fd_tls_hs_release(); return EINVAL; } );
+
+	CHECK_MALLOC_DO( hs = malloc(sizeof(struct hs_ctx)), { fd_tls_hs_release(); return ENOMEM; } );
+	memset(hs, 0, sizeof(struct hs_ctx));
+	fd_list_init(&hs->chain, hs);
+	hs->conn = conn;
+	hs->cb = cb;
+	hs->data = data;
+	CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &hs->start), /* continue */ );
+	hs->deadline = time(NULL) + HS_TIMEOUT;
+
+	GNUTLS_TRACE( gnutls_transport_set_pull_timeout_function( conn->cc_tls_para.session, hs_pull_timeout ) );
+	GNUTLS_TRACE( gnutls_transport_set_pull_function(conn->cc_tls_para.session, hs_pull) );
+	GNUTLS_TRACE( gnutls_transport_set_vec_push_function(conn->cc_tls_para.session, hs_pushv) );
+	#ifdef GNUTLS_VERSION_310
+	/* We manage the timeout ourselves */
+	GNUTLS_TRACE( gnutls_handshake_set_timeout( conn->cc_tls_para.session, 0) );
+	#endif /* GNUTLS_VERSION_310 */
+
+	CHECK_POSIX_DO( pthread_mutex_lock(&hs_lock), /* continue */ );
+	hs_stats.started++;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&hs_lock), /* continue */ );
+
+	/* The first step is done by a worker, the client sends its Hello without waiting */
+	CHECK_FCT_DO( fd_fifo_post(hs_work, &hs),
+		{
+			hs_complete(hs, EINVAL);
+		} );
+
+	return 0;
+#endif /* HS_POOL */
+}
+
+/* Retrieve the counters of the pool */
+void fd_tls_hs_getstats(struct fd_tls_hs_stats * stats)
+{
+#ifdef HS_POOL
+	CHECK_POSIX_DO( pthread_mutex_lock(&hs_lock), /* continue */ );
+	*stats = hs_stats;
+	stats->active = hs_count;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&hs_lock), /* continue */ );
+#else /* HS_POOL */
+	memset(stats, 0, sizeof(struct fd_tls_hs_stats));
+#endif /* HS_POOL */
+}
+
+/* Stop the pool. The handshakes in progress complete with ECANCELED. */
+void fd_tls_hs_fini(void)
+{
+#ifdef HS_POOL
+	struct hs_ctx * hs;
+	int i, was;
+
+	TRACE_ENTRY();
+
+	/* No new handshake from here */
+	CHECK_POSIX_DO( pthread_mutex_lock(&hs_lock), /* continue */ );
+	was = hs_running;
+	hs_running = 0;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&hs_lock), /* continue */ );
+	if (!was)
+		return;
+
+	/* The poller notices within HS_TICK */
+	hs_stop = 1;
+	CHECK_POSIX_DO( pthread_join(hs_poller, NULL), /* continue */ );
+	hs_poller = (pthread_t)NULL;
+
+	/* The workers terminate after the steps already queued */
+	for (i = 0; i < hs_nb; i++) {
+		hs = &hs_sentinel;
+		CHECK_FCT_DO( fd_fifo_post(hs_work, &hs), /* continue */ );
+	}
+	for (i = 0; i < hs_nb; i++) {
+		CHECK_POSIX_DO( pthread_join(hs_workers[i], NULL), /* continue */ );
+	}
+	free(hs_workers);
+	hs_workers = NULL;
+	hs_nb = 0;
+
+	/* Abort the remaining handshakes */
+	while (!FD_IS_LIST_EMPTY(&hs_waiting)) {
+		hs = hs_waiting.next->o;
+		fd_list_unlink(&hs->chain);
+		hs_complete(hs, ECANCELED);
+	}
+	while (fd_fifo_tryget(hs_work, &hs) == 0) {
+		if (hs != &hs_sentinel)
+			hs_complete(hs, ECANCELED);
+	}
+	CHECK_FCT_DO( fd_fifo_del(&hs_work), /* continue */ );
+	close(hs_epfd);
+	hs_epfd = -1;
+#endif /* HS_POOL */
+}
@@ -0,0 +1,238 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+
+/* Resumption of the TLS sessions across reconnections of the peers (TCP, and SCTP associations with a single stream).
+ *
+ * On the server side, we issue session tickets (RFC5077, or their TLS 1.3 equivalent), encrypted with a key created the
+ * first time it is needed. Nothing is stored for the clients.
+ * On the client side, the session data received from a peer is saved in a cache keyed by the Diameter Identity of the peer,
+ * and proposed on the next connection to the same peer. The cache holds at most TLS_RESUME_MAX peers (the oldest entry is
+ * dropped), and its entries expire after TLS_RESUME_LIFETIME seconds, which is also the lifetime of the tickets we issue.
+ *
+ * The multi-stream SCTP wrapper (sctp3436.c) keeps its own store, to resume the master session on the other streams.
+ */
+
+#include "fdcore-internal.h"
+#include "cnxctx.h"
+
+#define TLS_RESUME_MAX		1024
+#define TLS_RESUME_LIFETIME	7200	/* seconds */
+
+/* Session data of one peer */
+struct resume_entry {
+	struct fd_list	chain;		/* link in resume_list */
+	DiamId_t	diamid;		/* the peer */
+	gnutls_datum_t	data;		/* allocated by gnutls */
+	time_t		expire;
+};
+
+/* The entries are ordered by expiration time, since they all have the same lifetime */
+static struct fd_list			resume_list = FD_LIST_INITIALIZER(resume_list);
+static int				resume_count = 0;
+static gnutls_datum_t			ticket_key = { NULL, 0 };
+static struct fd_tls_resume_stats	resume_stats;
+static pthread_mutex_t			resume_lock = PTHREAD_MUTEX_INITIALIZER; /* protects all the above */
+
+static void entry_free(struct resume_entry * e)
+{
+	fd_list_unlink(&e->chain);
+	resume_count--;
+	free(e->diamid);
+	GNUTLS_TRACE( gnutls_free(e->data.data) );
+	free(e);
+}
+
+/* Drop the expired entries and search the entry of a peer. Called with the lock held. */
+static struct resume_entry * entry_find(DiamId_t diamid)
+{
+	time_t now = time(NULL);
+	size_t len = strlen(diamid);
+	struct fd_list * li;
+	
+	while (!FD_IS_LIST_EMPTY(&resume_list) && (((struct resume_entry *)resume_list.next)->expire <= now))
+		entry_free((struct resume_entry *)resume_list.next);
+	
+	for (li = resume_list.next; li != &resume_list; li = li->next) {
+		struct resume_entry * e = (struct resume_entry *)li;
+		if (!fd_os_almostcasesrch(e->diamid, strlen(e->diamid), diamid, len, NULL))
+			return e;
+	}
+	return NULL;
+}
+
+/* Save the session data for the next connection to this peer */
+static void resume_save(struct cnxctx * conn, gnutls_session_t session)
+{
+	struct resume_entry * e, * old;
+	
+	CHECK_MALLOC_DO( e = malloc(sizeof(struct resume_entry)), return );
+	memset(e, 0, sizeof(struct resume_entry));
+	fd_list_init(&e->chain, e);
+	CHECK_MALLOC_DO( e->diamid = strdup(conn->cc_tls_para.cn), { free(e); return; } );
+	CHECK_GNUTLS_DO( gnutls_session_get_data2(session, &e->data), { free(e->diamid); free(e); return; } );
+	e->expire = time(NULL) + TLS_RESUME_LIFETIME;
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&resume_lock), { free(e->diamid); GNUTLS_TRACE( gnutls_free(e->data.data) ); free(e); return; } );
+	old = entry_find(e->diamid);
+	if (old)
+		entry_free(old);
+	else if (resume_count >= TLS_RESUME_MAX)
+		entry_free((struct resume_entry *)resume_list.next);
+	fd_list_insert_before(&resume_list, &e->chain);
+	resume_count++;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&resume_lock), /* continue */ );
+	
+	TRACE_DEBUG(FULL, "Saved TLS session data for '%s' (%u bytes)", e->diamid, e->data.size);
+}
+
+#ifdef GNUTLS_VERSION_310
+/* In TLS 1.3, the server sends the tickets after the handshake; the client saves the session data when it receives one */
+static int ticket_received(gnutls_session_t session, unsigned int htype, unsigned when, unsigned int incoming, const gnutls_datum_t *msg)
+{
+	struct cnxctx * conn = gnutls_session_get_ptr(session);
+	
+	/* Up to TLS 1.2, the ticket is part of the handshake, and fd_tls_resume_done takes care of it */
+	if (conn && incoming && (gnutls_protocol_get_version(session) > GNUTLS_TLS1_2))
+		resume_save(conn, session);
+	
+	return 0;
+}
+#endif /* GNUTLS_VERSION_310 */
+
+/* Called before the handshake of a connection */
+void fd_tls_resume_prepare(struct cnxctx * conn)
+{
+	gnutls_session_t session;
+	
+	TRACE_ENTRY("%p", conn);
+	CHECK_PARAMS_DO( conn && conn->cc_tls_para.session, return );
+	session = conn->cc_tls_para.session;
+	
+	if (fd_g_config->cnf_flags.no_tlsres)
+		return;
+	
+	if (conn->cc_tls_para.mode == GNUTLS_SERVER) {
+		int ret = 0;
+		
+		CHECK_POSIX_DO( pthread_mutex_lock(&resume_lock), return );
+		if (!ticket_key.data) {
+			CHECK_GNUTLS_DO( ret = gnutls_session_ticket_key_generate(&ticket_key), /* continue without tickets */ );
+		}
+		CHECK_POSIX_DO( pthread_mutex_unlock(&resume_lock), /* continue */ );
+		
+		if (ret == 0) {
+			CHECK_GNUTLS_DO( gnutls_session_ticket_enable_server(session, &ticket_key), /* continue */ );
+			GNUTLS_TRACE( gnutls_db_set_cache_expiration(session, TLS_RESUME_LIFETIME) );
+		}
+		return;
+	}
+	
+	/* Client side, we need to know the peer */
+	if (!conn->cc_tls_para.cn)
+		return;
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&resume_lock), return );
+	{
+		struct resume_entry * e = entry_find(conn->cc_tls_para.cn);
+		if (e) {
+			CHECK_GNUTLS_DO( gnutls_session_set_data(session, e->data.data, e->data.size), /* full handshake */ );
+		}
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&resume_lock), /* continue */ );
+	
+	#ifdef GNUTLS_VERSION_310
+	GNUTLS_TRACE( gnutls_handshake_set_hook_function(session, GNUTLS_HANDSHAKE_NEW_SESSION_TICKET, GNUTLS_HOOK_POST, ticket_received) );
+	#endif /* GNUTLS_VERSION_310 */
+}
+
+/* Called after a successful handshake */
+void fd_tls_resume_done(struct cnxctx * conn)
+{
+	gnutls_session_t session;
+	int resumed;
+	
+	TRACE_ENTRY("%p", conn);
+	CHECK_PARAMS_DO( conn && conn->cc_tls_para.session, return );
+	session = conn->cc_tls_para.session;
+	
+	if (fd_g_config->cnf_flags.no_tlsres)
+		return;
+	
+	GNUTLS_TRACE( resumed = gnutls_session_is_resumed(session) );
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&resume_lock), return );
+	if (conn->cc_tls_para.mode == GNUTLS_SERVER) {
+		if (resumed)
+			resume_stats.srv_hits++;
+		else
+			resume_stats.srv_misses++;
+	} else {
+		if (resumed)
+			resume_stats.cli_hits++;
+		else
+			resume_stats.cli_misses++;
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&resume_lock), /* continue */ );
+	
+	TRACE_DEBUG(FULL, "TLS session %s on connection '%s'", resumed ? "resumed" : "negotiated", conn->cc_id);
+	
+	if ((conn->cc_tls_para.mode == GNUTLS_CLIENT) && conn->cc_tls_para.cn && (gnutls_protocol_get_version(session) <= GNUTLS_TLS1_2))
+		resume_save(conn, session);
+}
+
+/* Retrieve the counters */
+void fd_tls_resume_getstats(struct fd_tls_resume_stats * stats)
+{
+	CHECK_PARAMS_DO( stats, return );
+	CHECK_POSIX_DO( pthread_mutex_lock(&resume_lock), return );
+	memcpy(stats, &resume_stats, sizeof(struct fd_tls_resume_stats));
+	CHECK_POSIX_DO( pthread_mutex_unlock(&resume_lock), /* continue */ );
+}
+
+/* Free the cache and the tickets key, at shutdown */
+void fd_tls_resume_fini(void)
+{
+	CHECK_POSIX_DO( pthread_mutex_lock(&resume_lock), return );
+	while (!FD_IS_LIST_EMPTY(&resume_list))
+		entry_free((struct resume_entry *)resume_list.next);
+	if (ticket_key.data) {
+		memset(ticket_key.data, 0, ticket_key.size);
+		GNUTLS_TRACE( gnutls_free(ticket_key.data) );
+		ticket_key.data = NULL;
+		ticket_key.size = 0;
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&resume_lock), /* continue */ );
+}
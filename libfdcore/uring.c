@@ -0,0 +1,624 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+
+/* io_uring backend for TCP connections without TLS.
+ *
+ * When enabled (USE_IO_URING at compile time, Use_IO_Uring in the configuration), the connections in clear TCP
+ * that have been started with loop = 1 (i.e. after the capabilities exchange) do not use a receiver thread anymore.
+ * Instead, a multishot receive request is armed on a single ring for each of them. The data is received in a ring of 
+ * provided buffers, and one thread (uring_thr) rebuilds the messages of all these connections and posts them to their
+ * target queue as the receiver threads do. The sockets are registered in the fixed files table of the ring.
+ *
+ * The sending functions submit one send request per chunk of the buffers, linked together so that the kernel processes them
+ * in order, and wait for their completion. p_out.c drains the queue of messages to send and sends them in one batch.
+ *
+ * The TLS and SCTP connections, and the TCP connections before the capabilities exchange, keep using the threads.
+ */
+
+#include "fdcore-internal.h"
+#include "cnxctx.h"
+
+#include <liburing.h>
+
+/* Size of the submission queue */
+#define URING_ENTRIES		1024
+/* Number of registered file slots, i.e. maximum number of connections handled at the same time. Others use the threads. */
+#define URING_FILES		1024
+/* The provided buffers for receiving */
+#define URING_BUF_GROUP		0
+#define URING_NBUFS		128	/* must be a power of 2 */
+#define URING_BUFSZ		(16 * 1024)
+/* Maximum number of send requests linked in one call */
+#define URING_SEND_MAX		32
+/* Maximum size of a send request: the connection is closed when none completes for MAX_HOTL_BLOCKING_TIME */
+#define URING_SEND_CHUNK	(64 * 1024)
+
+/* The types of requests, the user_data of the requests points to a structure starting with this */
+enum uring_op_type {
+	URING_OP_RECV = 1,
+	URING_OP_SEND
+};
+
+/* The state associated with a connection (conn->cc_uring) */
+struct uring_cnx {
+	enum uring_op_type	type;		/* URING_OP_RECV */
+	struct cnxctx	*	conn;
+	int			slot;		/* index in the fixed files table */
+	int			armed;		/* a multishot receive is pending. Protected by uring_lock */
+	int			stopping;	/* the connection is being destroyed. Protected by uring_lock */
+	int			paused;		/* the reception is paused (fd_cnx_recv_pause), do not re-arm. Protected by uring_lock */
+	pthread_cond_t		cond;		/* signaled when armed becomes 0 */
+	
+	/* The message being rebuilt, accessed only by uring_thr */
+	uint8_t			header[4];
+	size_t			hdr_len;
+	struct fd_cnx_rcvdata	rcv_data;
+	struct fd_msg_pmdl *	pmdl;
+	size_t			received;
+};
+
+/* A batch of send requests, the waiting thread owns it */
+struct uring_send {
+	enum uring_op_type	type;		/* URING_OP_SEND */
+	int			nb;		/* number of requests */
+	int			pending;	/* number of requests not completed yet. Protected by uring_lock */
+	int			res[URING_SEND_MAX]; /* result of each request */
+	pthread_cond_t		cond;		/* signaled when a request completes */
+};
+
+static struct io_uring		uring;
+static struct io_uring_buf_ring *uring_br = NULL;
+static uint8_t		      *	uring_bufs = NULL;
+static uint8_t			uring_slots[URING_FILES];	/* 1 if the fixed file slot is used */
+static pthread_t		uring_thr_id = (pthread_t)NULL;
+static int			uring_ready = 0;
+static int			uring_exit = 0;
+
+/* Protects the submission queue, the slots, and the armed/stopping/pending fields */
+static pthread_mutex_t		uring_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Arm a multishot receive on a connection. uring_lock is held. */
+static int uring_arm_recv(struct uring_cnx * u)
+{
+	struct io_uring_sqe * sqe;
+	int ret;
+	
+	CHECK_PARAMS( sqe = io_uring_get_sqe(&uring) );
+	io_uring_prep_recv_multishot(sqe, u->slot, NULL, 0, 0);
+	sqe->flags |= IOSQE_FIXED_FILE | IOSQE_BUFFER_SELECT;
+	sqe->buf_group = URING_BUF_GROUP;
+	io_uring_sqe_set_data(sqe, u);
+	
+	ret = io_uring_submit(&uring);
+	if (ret < 0) {
+		TRACE_DEBUG(INFO, "io_uring_submit failed: %s", strerror(-ret));
+		return -ret;
+	}
+	u->armed = 1;
+	return 0;
+}
+
+/* Free a partially received message */
+static void uring_free_partial(struct uring_cnx * u)
+{
+	if (u->rcv_data.buffer) {
+		(void) pthread_mutex_destroy(&u->pmdl->lock);
+		free(u->rcv_data.buffer);
+		u->rcv_data.buffer = NULL;
+	}
+	u->hdr_len = 0;
+}
+
+/* Rebuild the messages from the received data, as rcvthr_notls_tcp. Returns 0 or an error if the connection must be closed. */
+static int uring_rcv_data(struct uring_cnx * u, uint8_t * data, size_t len)
+{
+	struct cnxctx * conn = u->conn;
+	size_t sz;
+	
+	while (len) {
+		if (!u->rcv_data.buffer) {
+			/* Header */
+			sz = sizeof(u->header) - u->hdr_len;
+			if (sz > len)
+				sz = len;
+			memcpy(u->header + u->hdr_len, data, sz);
+			u->hdr_len += sz;
+			data += sz;
+			len -= sz;
+			
+			if (u->header[0] != DIAMETER_VERSION) {
+				LOG_E( "Received suspect header [ver: %d] from '%s', assuming disconnection", (int)u->header[0], conn->cc_remid);
+				return EBADMSG;
+			}
+			if (u->hdr_len < sizeof(u->header))
+				return 0;
+			
+			u->rcv_data.length = ((size_t)u->header[1] << 16) + ((size_t)u->header[2] << 8) + (size_t)u->header[3];
+			if ((u->rcv_data.length > DIAMETER_MSG_SIZE_MAX) || (u->rcv_data.length < sizeof(u->header))) {
+				LOG_E( "Received suspect header [ver: %d, size: %zd] from '%s', assuming disconnection", (int)u->header[0], u->rcv_data.length, conn->cc_remid);
+				return EBADMSG;
+			}
+			
+			CHECK_MALLOC( u->rcv_data.buffer = fd_cnx_alloc_msg_buffer( u->rcv_data.length, &u->pmdl ) );
+			memcpy(u->rcv_data.buffer, u->header, sizeof(u->header));
+			u->received = sizeof(u->header);
+		}
+		
+		/* Body */
+		sz = u->rcv_data.length - u->received;
+		if (sz > len)
+			sz = len;
+		memcpy(u->rcv_data.buffer + u->received, data, sz);
+		u->received += sz;
+		data += sz;
+		len -= sz;
+		
+		if (u->received == u->rcv_data.length) {
+			fd_hook_call(HOOK_DATA_RECEIVED, NULL, NULL, &u->rcv_data, u->pmdl);
+			conn->cc_rcv_msgs++;
+			
+			/* We have received a complete message, pass it to the daemon. This thread is shared by all the connections so it must not block
+			 on one queue; in the daemon the target is the events queue of the peer (no limit) anyway. */
+			CHECK_FCT_DO( fd_event_send_noblock( fd_cnx_target_queue(conn), FDEVP_CNX_MSG_RECV, u->rcv_data.length, u->rcv_data.buffer),
+				{
+					uring_free_partial(u);
+					CHECK_FCT_DO(fd_core_shutdown(), );
+					return ENOTCONN;
+				} );
+			u->rcv_data.buffer = NULL;
+			u->hdr_len = 0;
+		}
+	}
+	
+	return 0;
+}
+
+/* Handle the completion of a receive request. Returns the number of buffers to give back to the kernel. */
+static int uring_rcv_cqe(struct uring_cnx * u, struct io_uring_cqe * cqe)
+{
+	int ret = 0;
+	int nbuf = 0;
+	int err = 0;
+	
+	if (cqe->flags & IORING_CQE_F_BUFFER) {
+		int bid = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+		uint8_t * buf = uring_bufs + (size_t)bid * URING_BUFSZ;
+		
+		if ((cqe->res > 0) && (!u->stopping)) {
+			u->conn->cc_rcv_calls++;
+			err = uring_rcv_data(u, buf, cqe->res);
+		}
+		
+		/* Give the buffer back */
+		io_uring_buf_ring_add(uring_br, buf, URING_BUFSZ, bid, io_uring_buf_ring_mask(URING_NBUFS), nbuf);
+		nbuf++;
+	}
+	
+	if (cqe->res == 0) {
+		err = ENOTCONN; /* connection closed by the peer */
+	} else if ((cqe->res < 0) && (cqe->res != -ENOBUFS) && (cqe->res != -ECANCELED)) {
+		TRACE_DEBUG(FULL, "Receive error on connection %s: %s", u->conn->cc_id, strerror(-cqe->res));
+		err = -cqe->res;
+	}
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&uring_lock), );
+	if (err && !u->stopping && !fd_cnx_teststate(u->conn, CC_STATUS_ERROR)) {
+		/* the pending request will be cancelled by fd_uring_stop */
+		fd_cnx_markerror(u->conn);
+	}
+	if (!(cqe->flags & IORING_CQE_F_MORE)) {
+		/* The multishot request has terminated (e.g. out of buffers): re-arm it unless we are done */
+		u->armed = 0;
+		if (!u->stopping && !u->paused && !err && !fd_cnx_teststate(u->conn, CC_STATUS_ERROR)) {
+			CHECK_FCT_DO( ret = uring_arm_recv(u), fd_cnx_markerror(u->conn) );
+		}
+		if (!u->armed)
+			CHECK_POSIX_DO( pthread_cond_signal(&u->cond), );
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&uring_lock), );
+	
+	return nbuf;
+}
+
+/* Handle the completion of a send request */
+static void uring_send_cqe(struct uring_send * s, struct io_uring_cqe * cqe)
+{
+	CHECK_POSIX_DO( pthread_mutex_lock(&uring_lock), );
+	s->res[s->nb - s->pending] = cqe->res;
+	s->pending--;
+	CHECK_POSIX_DO( pthread_cond_signal(&s->cond), );
+	CHECK_POSIX_DO( pthread_mutex_unlock(&uring_lock), );
+}
+
+/* The thread that handles all the completions */
+static void * uring_thr(void * arg)
+{
+	fd_log_threadname ( "io_uring" );
+	fd_thr_bind(FD_THR_RECV, -1);
+	
+	while (!uring_exit) {
+		struct io_uring_cqe * cqe;
+		unsigned head, count = 0;
+		int nbuf = 0;
+		int ret;
+		
+		ret = io_uring_wait_cqe(&uring, &cqe);
+		if (ret == -EINTR)
+			continue;
+		if (ret < 0) {
+			TRACE_DEBUG(INFO, "io_uring_wait_cqe failed: %s", strerror(-ret));
+			break;
+		}
+		
+		io_uring_for_each_cqe(&uring, head, cqe) {
+			enum uring_op_type * type = io_uring_cqe_get_data(cqe);
+			count++;
+			if (!type)
+				continue; /* cancel requests, wake up */
+			switch (*type) {
+				case URING_OP_RECV:
+					nbuf += uring_rcv_cqe((struct uring_cnx *)type, cqe);
+					break;
+				case URING_OP_SEND:
+					uring_send_cqe((struct uring_send *)type, cqe);
+					break;
+			}
+		}
+		io_uring_cq_advance(&uring, count);
+		if (nbuf)
+			io_uring_buf_ring_advance(uring_br, nbuf);
+	}
+	
+	TRACE_DEBUG(FULL, "Thread terminated");
+	return NULL;
+}
+
+/* Initialize the ring and start the completion thread. Called at startup when the configuration enables io_uring. */
+int fd_uring_init(void)
+{
+	struct io_uring_params params;
+	int ret, i;
+	
+	TRACE_ENTRY("");
+	
+	if (uring_ready)
+		return 0;
+	
+	memset(&params, 0, sizeof(params));
+	params.flags = IORING_SETUP_SUBMIT_ALL;
+	ret = io_uring_queue_init_params(URING_ENTRIES, &uring, &params);
+	if (ret < 0) {
+		LOG_E("Unable to initialize io_uring: %s", strerror(-ret));
+		return -ret;
+	}
+	
+	/* Sockets are registered in the fixed files table as the connections are started */
+	ret = io_uring_register_files_sparse(&uring, URING_FILES);
+	if (ret < 0) {
+		LOG_E("Unable to register the io_uring files table: %s", strerror(-ret));
+		goto error;
+	}
+	memset(uring_slots, 0, sizeof(uring_slots));
+	
+	/* The buffers for receiving */
+	CHECK_MALLOC_DO( uring_bufs = malloc((size_t)URING_NBUFS * URING_BUFSZ), { ret = -ENOMEM; goto error; } );
+	uring_br = io_uring_setup_buf_ring(&uring, URING_NBUFS, URING_BUF_GROUP, 0, &ret);
+	if (!uring_br) {
+		LOG_E("Unable to register the io_uring buffers ring: %s", strerror(-ret));
+		goto error;
+	}
+	for (i = 0; i < URING_NBUFS; i++)
+		io_uring_buf_ring_add(uring_br, uring_bufs + (size_t)i * URING_BUFSZ, URING_BUFSZ, i, io_uring_buf_ring_mask(URING_NBUFS), i);
+	io_uring_buf_ring_advance(uring_br, URING_NBUFS);
+	
+	uring_exit = 0;
+	CHECK_POSIX_DO( ret = pthread_create(&uring_thr_id, NULL, uring_thr, NULL), { ret = -ret; goto error; } );
+	
+	uring_ready = 1;
+	LOG_N("Using io_uring for TCP connections without TLS");
+	return 0;
+	
+error:
+	if (uring_br) {
+		io_uring_free_buf_ring(&uring, uring_br, URING_NBUFS, URING_BUF_GROUP);
+		uring_br = NULL;
+	}
+	free(uring_bufs);
+	uring_bufs = NULL;
+	io_uring_queue_exit(&uring);
+	return -ret;
+}
+
+/* Stop the thread and release the ring. All the connections must have been destroyed. */
+void fd_uring_fini(void)
+{
+	struct io_uring_sqe * sqe;
+	
+	TRACE_ENTRY("");
+	
+	if (!uring_ready)
+		return;
+	
+	/* Wake up the thread with a NOP */
+	CHECK_POSIX_DO( pthread_mutex_lock(&uring_lock), );
+	uring_exit = 1;
+	sqe = io_uring_get_sqe(&uring);
+	if (sqe) {
+		io_uring_prep_nop(sqe);
+		io_uring_sqe_set_data(sqe, NULL);
+		io_uring_submit(&uring);
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&uring_lock), );
+	if (sqe) {
+		CHECK_POSIX_DO( pthread_join(uring_thr_id, NULL), );
+	} else {
+		CHECK_FCT_DO( fd_thr_term(&uring_thr_id), );
+	}
+	uring_thr_id = (pthread_t)NULL;
+	
+	io_uring_free_buf_ring(&uring, uring_br, URING_NBUFS, URING_BUF_GROUP);
+	uring_br = NULL;
+	io_uring_queue_exit(&uring);
+	free(uring_bufs);
+	uring_bufs = NULL;
+	uring_ready = 0;
+}
+
+/* Start receiving on a connection with io_uring instead of a thread. Returns ENOTSUP if the connection cannot use it, the caller falls back to the thread then. */
+int fd_uring_start(struct cnxctx * conn)
+{
+	struct uring_cnx * u;
+	int ret = 0, slot;
+	
+	TRACE_ENTRY("%p", conn);
+	CHECK_PARAMS( conn && (conn->cc_proto == IPPROTO_TCP) && !fd_cnx_teststate(conn, CC_STATUS_TLS) && conn->cc_loop && !conn->cc_uring );
+	
+	if (!uring_ready)
+		return ENOTSUP;
+	
+	CHECK_MALLOC( u = calloc(1, sizeof(struct uring_cnx)) );
+	u->type = URING_OP_RECV;
+	u->conn = conn;
+	CHECK_POSIX_DO( ret = pthread_cond_init(&u->cond, NULL), { free(u); return ret; } );
+	
+	CHECK_POSIX_DO( ret = pthread_mutex_lock(&uring_lock), goto error );
+	for (slot = 0; (slot < URING_FILES) && uring_slots[slot]; slot++)
+		;
+	if (slot == URING_FILES) {
+		TRACE_DEBUG(INFO, "No free io_uring file slot for connection %s, using a receiver thread", conn->cc_id);
+		ret = ENOTSUP;
+		goto error_unlock;
+	}
+	ret = io_uring_register_files_update(&uring, slot, &conn->cc_socket, 1);
+	if (ret < 0) {
+		TRACE_DEBUG(INFO, "io_uring_register_files_update failed: %s", strerror(-ret));
+		ret = ENOTSUP;
+		goto error_unlock;
+	}
+	uring_slots[slot] = 1;
+	u->slot = slot;
+	
+	CHECK_FCT_DO( ret = uring_arm_recv(u),
+		{
+			int fd = -1;
+			io_uring_register_files_update(&uring, slot, &fd, 1);
+			uring_slots[slot] = 0;
+			goto error_unlock;
+		} );
+	conn->cc_uring = u;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&uring_lock), );
+	
+	return 0;
+	
+error_unlock:
+	CHECK_POSIX_DO( pthread_mutex_unlock(&uring_lock), );
+error:
+	(void) pthread_cond_destroy(&u->cond);
+	free(u);
+	return ret;
+}
+
+/* Stop receiving on the connection and release the associated resources, before the socket is closed */
+void fd_uring_stop(struct cnxctx * conn)
+{
+	struct uring_cnx * u;
+	int fd = -1;
+	int state;
+	
+	TRACE_ENTRY("%p", conn);
+	CHECK_PARAMS_DO( conn && conn->cc_uring, return );
+	u = conn->cc_uring;
+	
+	/* The completion thread references our data until the request is terminated, do not let us be canceled while waiting */
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &state);
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&uring_lock), );
+	u->stopping = 1;
+	if (u->armed) {
+		struct io_uring_sqe * sqe = io_uring_get_sqe(&uring);
+		if (sqe) {
+			io_uring_prep_cancel(sqe, u, 0);
+			io_uring_sqe_set_data(sqe, NULL);
+			io_uring_submit(&uring);
+		}
+		while (u->armed) {
+			CHECK_POSIX_DO( pthread_cond_wait(&u->cond, &uring_lock), break );
+		}
+	}
+	io_uring_register_files_update(&uring, u->slot, &fd, 1);
+	uring_slots[u->slot] = 0;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&uring_lock), );
+	
+	pthread_setcancelstate(state, NULL);
+	
+	uring_free_partial(u);
+	(void) pthread_cond_destroy(&u->cond);
+	free(u);
+	conn->cc_uring = NULL;
+}
+
+/* Pause or resume the reception on the connection: the multishot receive request is cancelled, and armed again on resume */
+void fd_uring_pause(struct cnxctx * conn, int pause)
+{
+	struct uring_cnx * u;
+	
+	TRACE_ENTRY("%p %d", conn, pause);
+	CHECK_PARAMS_DO( conn && conn->cc_uring, return );
+	u = conn->cc_uring;
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&uring_lock), return );
+	u->paused = pause;
+	if (pause && u->armed) {
+		/* The data already received is still delivered; the request terminates with -ECANCELED and is not re-armed */
+		struct io_uring_sqe * sqe = io_uring_get_sqe(&uring);
+		if (sqe) {
+			io_uring_prep_cancel(sqe, u, 0);
+			io_uring_sqe_set_data(sqe, NULL);
+			io_uring_submit(&uring);
+		}
+	}
+	if (!pause && !u->armed && !u->stopping && !fd_cnx_teststate(conn, CC_STATUS_ERROR)) {
+		CHECK_FCT_DO( uring_arm_recv(u), fd_cnx_markerror(conn) );
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&uring_lock), );
+}
+
+/* Send the buffers of iov in order, with linked requests. Same semantics as writev (the returned value may be less than the total size) */
+ssize_t fd_uring_sendv(struct cnxctx * conn, const struct iovec * iov, int iovcnt)
+{
+	struct uring_cnx * u = conn->cc_uring;
+	struct uring_send s;
+	struct iovec req[URING_SEND_MAX];
+	struct timespec ts;
+	ssize_t sent = 0;
+	size_t off;
+	int i, nb = 0, pending, ret = 0, state;
+	
+	/* Split the buffers in chunks, so that a peer that reads slowly completes some of them before the timeout */
+	for (i = 0; (i < iovcnt) && (nb < URING_SEND_MAX); i++) {
+		for (off = 0; (off < iov[i].iov_len) && (nb < URING_SEND_MAX); off += URING_SEND_CHUNK, nb++) {
+			req[nb].iov_base = (uint8_t *)iov[i].iov_base + off;
+			req[nb].iov_len = iov[i].iov_len - off;
+			if (req[nb].iov_len > URING_SEND_CHUNK)
+				req[nb].iov_len = URING_SEND_CHUNK;
+		}
+	}
+	if (!nb)
+		return 0;
+	
+	memset(&s, 0, sizeof(s));
+	s.type = URING_OP_SEND;
+	CHECK_POSIX_DO( ret = pthread_cond_init(&s.cond, NULL), { errno = ret; return -1; } );
+	
+	/* s is referenced by the completion thread until all the requests completed */
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &state);
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&uring_lock), );
+	for (i = 0; i < nb; i++) {
+		struct io_uring_sqe * sqe = io_uring_get_sqe(&uring);
+		ASSERT(sqe); /* we hold the lock and the queue is flushed by each submitter */
+		io_uring_prep_send(sqe, u->slot, req[i].iov_base, req[i].iov_len, MSG_NOSIGNAL | MSG_WAITALL);
+		sqe->flags |= IOSQE_FIXED_FILE;
+		if (i < nb - 1)
+			sqe->flags |= IOSQE_IO_LINK;
+		io_uring_sqe_set_data(sqe, &s);
+	}
+	s.nb = s.pending = nb;
+	ret = io_uring_submit(&uring);
+	if (ret < nb) {
+		/* should not happen with IORING_SETUP_SUBMIT_ALL, the completions of the submitted requests will arrive anyway */
+		TRACE_DEBUG(INFO, "io_uring_submit: %d / %d", ret, nb);
+		s.pending -= (ret < 0) ? nb : nb - ret;
+	}
+	
+	/* Wait for the completions, and give up on a peer that does not read anymore as fd_cnx_s_sendv: when no request completes
+	 for MAX_HOTL_BLOCKING_TIME */
+	pending = -1;
+	while (s.pending) {
+		if (s.pending != pending) {
+			pending = s.pending;
+			CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &ts), { ASSERT(0); } );
+			ts.tv_sec += MAX_HOTL_BLOCKING_TIME / 1000;
+			ts.tv_nsec += (MAX_HOTL_BLOCKING_TIME % 1000) * 1000000;
+			if (ts.tv_nsec >= 1000000000) {
+				ts.tv_nsec -= 1000000000;
+				ts.tv_sec += 1;
+			}
+		}
+		ret = pthread_cond_timedwait(&s.cond, &uring_lock, &ts);
+		if (ret == ETIMEDOUT) {
+			struct io_uring_sqe * sqe = io_uring_get_sqe(&uring);
+			LOG_D("Unable to send any data for %dms, closing the connection", MAX_HOTL_BLOCKING_TIME);
+			if (sqe) {
+				io_uring_prep_cancel(sqe, &s, IORING_ASYNC_CANCEL_ALL);
+				io_uring_sqe_set_data(sqe, NULL);
+				io_uring_submit(&uring);
+			}
+			while (s.pending) {
+				CHECK_POSIX_DO( pthread_cond_wait(&s.cond, &uring_lock), break );
+			}
+			sent = -1;
+			errno = ETIMEDOUT;
+		}
+	}
+	CHECK_POSIX_DO( pthread_mutex_unlock(&uring_lock), );
+	
+	pthread_setcancelstate(state, NULL);
+	(void) pthread_cond_destroy(&s.cond);
+	
+	if (sent == 0) {
+		/* The completions arrive in order for linked requests. Stop at the first incomplete one, the next were cancelled */
+		for (i = 0; i < nb; i++) {
+			if (s.res[i] < 0) {
+				if (sent == 0) {
+					errno = -s.res[i];
+					sent = -1;
+				}
+				break;
+			}
+			sent += s.res[i];
+			if ((size_t)s.res[i] < req[i].iov_len)
+				break;
+		}
+	}
+	
+	if (sent <= 0) {
+		CHECK_SYS_DO(sent, /* continue */);
+		fd_cnx_markerror(conn);
+	}
+	
+	return sent;
+}
@@ -198,6 +198,8 @@ struct dictionary {
 	struct dict_object	dict_cmd_error;		/* Special command object for answers with the 'E' bit set */
 	
 	int			dict_count[DICT_TYPE_MAX + 1]; /* Number of objects of each type */
+	
+	int			dict_bulk;		/* > 0 during fd_dict_bulk_begin / fd_dict_bulk_end, see there */
 };
 
 /* Forward declarations of dump functions */
@@ -684,6 +686,70 @@ static int order_rule_by_avpvc ( struct dict_object *o1, struct dict_object *o2
 		?: ORDER_scalar(o1->data.rule.rule_avp->data.avp.avp_code, o2->data.rule.rule_avp->data.avp.avp_code) ;
 }
 
+#if USE_HASHLIST
+/* Merge two NULL-terminated chains of list items, already sorted. On equality, the items from "a" come first. */
+static struct fd_list * merge_sorted ( struct fd_list * a, struct fd_list * b, int (*cmp_fct)(struct dict_object *, struct dict_object *) )
+{
+	struct fd_list head, *tail = &head;
+	
+	while (a && b) {
+		if (cmp_fct(_O(a->o), _O(b->o)) <= 0) {
+			tail->next = a;
+			a = a->next;
+		} else {
+			tail->next = b;
+			b = b->next;
+		}
+		tail = tail->next;
+	}
+	tail->next = a ?: b;
+	
+	return head.next;
+}
+
+/* Sort a list of objects that were appended during a bulk load (bottom-up merge sort, stable) */
+static void sort_list ( struct fd_list * sentinel, int (*cmp_fct)(struct dict_object *, struct dict_object *) )
+{
+	struct fd_list * parts[sizeof(size_t) * 8]; /* parts[i] holds a sorted chain of 2^i items, or NULL */
+	struct fd_list * li, * next, * prev;
+	int i;
+	
+	if (FD_IS_LIST_EMPTY(sentinel))
+		return;
+	
+	memset(parts, 0, sizeof(parts));
+	
+	/* Break the ring, then merge the items one by one */
+	sentinel->prev->next = NULL;
+	for (li = sentinel->next; li != NULL; li = next) {
+		next = li->next;
+		li->next = NULL;
+		for (i = 0; parts[i] != NULL; i++) {
+			li = merge_sorted(parts[i], li, cmp_fct);
+			parts[i] = NULL;
+		}
+		parts[i] = li;
+	}
+	
+	/* The higher parts hold the earlier items */
+	li = NULL;
+	for (i = 0; i < sizeof(parts) / sizeof(parts[0]); i++) {
+		if (parts[i])
+			li = li ? merge_sorted(parts[i], li, cmp_fct) : parts[i];
+	}
+	
+	/* Restore the ring */
+	prev = sentinel;
+	for (; li != NULL; li = li->next) {
+		li->prev = prev;
+		prev->next = li;
+		prev = li;
+	}
+	prev->next = sentinel;
+	sentinel->prev = prev;
+}
+#endif /* USE_HASHLIST */
+
 /*******************************************************************************************************/
 /*******************************************************************************************************/
 /*                                                                                                     */
@@ -1212,10 +1278,16 @@ static int search_avp ( struct dictionary * dict, int criteria, const void * wha
 		case AVP_BY_NAME_ALL_VENDORS:
 			{
 				struct fd_list * li;
+#if USE_HASHLIST
+				/* First, search for vendor 0 */
+				if (findStringHashList(what, dict->dict_vendors.hashlist[1], (void**)result) == 0)
+					goto end;
+#else
 				size_t wl = strlen((char *)what);
 				
 				/* First, search for vendor 0 */
 				SEARCH_os0_l( what, wl, &dict->dict_vendors.list[2], avp.avp_name, 1);
+#endif
 				
 				/* If not found, loop for all vendors, until found */
 				for (li = dict->dict_vendors.list[0].next; li != &dict->dict_vendors.list[0]; li = li->next) {
@@ -1797,19 +1869,26 @@ int fd_dict_getval ( struct dict_object * object, void * val)
 }
 
 /* Add a new object in the dictionary */
-int fd_dict_new ( struct dictionary * dict, enum dict_object_type type, void * data, struct dict_object * parent, struct dict_object **ref )
+/* Create a new object. If locked is set, the caller already holds the write lock (fd_dict_new_batch) */
+static int dict_new ( struct dictionary * dict, enum dict_object_type type, void * data, struct dict_object * parent, struct dict_object **ref, int locked )
 {
 	int ret = 0;
 	int dupos = 0;
+	int lock = !locked;
 	struct dict_object * new = NULL;
 	struct dict_object * vendor = NULL;
 	struct dict_object * locref = NULL;
 	
-	TRACE_ENTRY("%p %d(%s) %p %p %p", dict, type, dict_obj_info[CHECK_TYPE(type) ? type : 0].name, data, parent, ref);
+	TRACE_ENTRY("%p %d(%s) %p %p %p %d", dict, type, dict_obj_info[CHECK_TYPE(type) ? type : 0].name, data, parent, ref, locked);
 	
 	/* Check parameters */
 	CHECK_PARAMS( dict && (dict->dict_eyec == DICT_EYECATCHER) && CHECK_TYPE(type) && data  );
 	
+#if ENABLE_LOCK_BYPASS
+	if (dict->dict_bypass_lock)
+		lock = 0;
+#endif
+	
 	/* Check the "parent" parameter */
 	switch (dict_obj_info[type].parent) {
 		case 0:	/* parent is forbidden */
@@ -1832,8 +1911,14 @@ int fd_dict_new ( struct dictionary * dict, enum dict_object_type type, void * d
 	
 	/* For AVP object, we must also check that the "vendor" referenced exists */
 	if (type == DICT_AVP) {
-		CHECK_FCT_DO(  fd_dict_search( dict, DICT_VENDOR, VENDOR_BY_ID, &(((struct dict_avp_data *)data)->avp_vendor), (void*)&vendor, ENOENT ),
-			{ TRACE_DEBUG(INFO, "Unable to find vendor '%d' referenced in the AVP data", ((struct dict_avp_data *)data)->avp_vendor); goto error_param; }  );
+		if (locked)
+			ret = search_vendor( dict, VENDOR_BY_ID, &(((struct dict_avp_data *)data)->avp_vendor), &vendor );
+		else
+			ret = fd_dict_search( dict, DICT_VENDOR, VENDOR_BY_ID, &(((struct dict_avp_data *)data)->avp_vendor), (void*)&vendor, ENOENT );
+		if (ret || !vendor) {
+			TRACE_DEBUG(INFO, "Unable to find vendor '%d' referenced in the AVP data", ((struct dict_avp_data *)data)->avp_vendor);
+			goto error_param;
+		}
 		
 		/* Also check if a parent is provided, that the type are the same */
 		if (parent) {
@@ -1876,10 +1961,8 @@ int fd_dict_new ( struct dictionary * dict, enum dict_object_type type, void * d
 	init_object_data(new, data, type, dupos);
 
 	/* We will change the dictionary => acquire the write lock */
-#if ENABLE_LOCK_BYPASS
-	if (!dict->dict_bypass_lock)
-#endif
-	CHECK_POSIX_DO(  ret = pthread_rwlock_wrlock(&dict->dict_lock),  goto error_free  );
+	if (lock)
+		CHECK_POSIX_DO(  ret = pthread_rwlock_wrlock(&dict->dict_lock),  goto error_free  );
 	
 	/* Now link the object -- this also checks that no object with same keys already exists */
 	switch (type) {
@@ -1932,6 +2015,10 @@ int fd_dict_new ( struct dictionary * dict, enum dict_object_type type, void * d
                ret = insertFloat64HashList(new->data.enumval.enum_value.f64, new, parent->hashlist[0], (void**)&locref);
                break;
 
+            case AVP_TYPE_OCTETSTRING:
+               /* No hashlist, the values are searched in the ordered list */
+               break;
+
             default:
                /* Invalid parent type basetype */
                CHECK_PARAMS( parent = NULL );
@@ -1967,21 +2054,39 @@ int fd_dict_new ( struct dictionary * dict, enum dict_object_type type, void * d
                   deleteEntryFloat64HashList(new->data.enumval.enum_value.f64, parent->hashlist[0]);
                   break;
 
+               case AVP_TYPE_OCTETSTRING:
+                  break;
+
                default:
                   /* Invalid parent type basetype */
                   CHECK_PARAMS( parent = NULL );
             }
             goto error_unlock;
          }
+         
+			if (dict->dict_bulk) {
+				/* The keys were checked by the hashlists, the lists are sorted in fd_dict_bulk_end */
+				fd_list_insert_before( &parent->list[1], &new->list[0] );
+				if (parent->data.type.type_base != AVP_TYPE_OCTETSTRING) {
+					fd_list_insert_before( &parent->list[2], &new->list[1] );
+					break;
+				}
+			} else
 #endif
+			{
 			/* A type_enum object is linked in it's parent 'type' object lists 1 and 2 by its name and values */
 			ret = fd_list_insert_ordered ( &parent->list[1], &new->list[0], (int (*)(void*, void *))order_enum_by_name, (void **)&locref );
 			if (ret)
 				goto error_unlock;
+			}
 			
 			ret = fd_list_insert_ordered ( &parent->list[2], &new->list[1], (int (*)(void*, void *))order_enum_by_val, (void **)&locref );
 			if (ret) { 
 				fd_list_unlink(&new->list[0]); 
+#if USE_HASHLIST
+				if (parent->data.type.type_base == AVP_TYPE_OCTETSTRING)
+					deleteEntryStringHashList(new->data.enumval.enum_name, parent->hashlist[1]);
+#endif
 				goto error_unlock; 
 			}
 			break;
@@ -1997,6 +2102,13 @@ int fd_dict_new ( struct dictionary * dict, enum dict_object_type type, void * d
 		      deleteEntryUInt32HashList(new->data.avp.avp_code, vendor->hashlist[0]);
 		      goto error_unlock;
 		   }
+		   
+			if (dict->dict_bulk) {
+				/* The keys were checked by the hashlists, the lists are sorted in fd_dict_bulk_end */
+				fd_list_insert_before( &vendor->list[1], &new->list[0] );
+				fd_list_insert_before( &vendor->list[2], &new->list[1] );
+				break;
+			}
 #endif
 			/* An avp object is linked in lists 1 and 2 of its vendor, by code and name */
 			ret = fd_list_insert_ordered ( &vendor->list[1], &new->list[0], (int (*)(void*, void *))order_avp_by_code, (void **)&locref );
@@ -2044,10 +2156,8 @@ int fd_dict_new ( struct dictionary * dict, enum dict_object_type type, void * d
 	dict->dict_count[type]++;
 	
 	/* Unlock the dictionary */
-#if ENABLE_LOCK_BYPASS
-	if (!dict->dict_bypass_lock)
-#endif
-	CHECK_POSIX_DO(  ret = pthread_rwlock_unlock(&dict->dict_lock),  goto error_free  );
+	if (lock)
+		CHECK_POSIX_DO(  ret = pthread_rwlock_unlock(&dict->dict_lock),  goto error_free  );
 	
 	/* Save the pointer to the new object */
 	if (ref)
@@ -2060,10 +2170,8 @@ error_param:
 	goto all_errors;
 
 error_unlock:
-#if ENABLE_LOCK_BYPASS
-   if (!dict->dict_bypass_lock)
-#endif
-	CHECK_POSIX_DO(  pthread_rwlock_unlock(&dict->dict_lock),  /* continue */  );
+	if (lock)
+		CHECK_POSIX_DO(  pthread_rwlock_unlock(&dict->dict_lock),  /* continue */  );
 	if (ret == EEXIST) {
 		/* We have a duplicate key in locref. Check if the pointed object is the same or not */
 		switch (type) {
@@ -2241,6 +2349,11 @@ error_free:
 	return ret;
 }
 
+int fd_dict_new ( struct dictionary * dict, enum dict_object_type type, void * data, struct dict_object * parent, struct dict_object **ref )
+{
+	return dict_new( dict, type, data, parent, ref, 0 );
+}
+
 
 int fd_dict_delete(struct dict_object * obj)
 {
@@ -2284,6 +2397,217 @@ int fd_dict_delete(struct dict_object * obj)
 	return ret;
 }
 
+#if USE_HASHLIST
+/* Sort the lists that were appended to during the bulk load. The write lock must be held. */
+static void bulk_sort( struct dictionary *dict )
+{
+	struct fd_list * li;
+	
+	/* Sort the AVPs of each vendor, starting with vendor 0 */
+	sort_list(&dict->dict_vendors.list[1], order_avp_by_code);
+	sort_list(&dict->dict_vendors.list[2], order_avp_by_name);
+	for (li = dict->dict_vendors.list[0].next; li != &dict->dict_vendors.list[0]; li = li->next) {
+		sort_list(&_O(li->o)->list[1], order_avp_by_code);
+		sort_list(&_O(li->o)->list[2], order_avp_by_name);
+	}
+	
+	/* And the constants of each type. OctetString values were inserted in order already. */
+	for (li = dict->dict_types.next; li != &dict->dict_types; li = li->next) {
+		sort_list(&_O(li->o)->list[1], order_enum_by_name);
+		if (_O(li->o)->data.type.type_base != AVP_TYPE_OCTETSTRING)
+			sort_list(&_O(li->o)->list[2], order_enum_by_val);
+	}
+}
+#endif /* USE_HASHLIST */
+
+/* During a bulk load (typically while the extensions are initialized), the AVPs and enumerated values are appended to the lists
+ of their vendor or type instead of being inserted in order; the hashlists are used to detect duplicates and to search them.
+ The lists are sorted once, when the outermost fd_dict_bulk_end is called. Without hashlists, these functions have no effect. */
+int fd_dict_bulk_begin( struct dictionary *dict )
+{
+	TRACE_ENTRY("%p", dict);
+	
+	CHECK_PARAMS( dict && (dict->dict_eyec == DICT_EYECATCHER) );
+	
+#if USE_HASHLIST
+#if ENABLE_LOCK_BYPASS
+	if (!dict->dict_bypass_lock)
+#endif
+	CHECK_POSIX(  pthread_rwlock_wrlock(&dict->dict_lock)  );
+	
+	dict->dict_bulk++;
+	
+#if ENABLE_LOCK_BYPASS
+	if (!dict->dict_bypass_lock)
+#endif
+	CHECK_POSIX(  pthread_rwlock_unlock(&dict->dict_lock)  );
+#endif /* USE_HASHLIST */
+	
+	return 0;
+}
+
+int fd_dict_bulk_end( struct dictionary *dict )
+{
+#if USE_HASHLIST
+	int ret = 0;
+#endif
+	
+	TRACE_ENTRY("%p", dict);
+	
+	CHECK_PARAMS( dict && (dict->dict_eyec == DICT_EYECATCHER) );
+	
+#if USE_HASHLIST
+#if ENABLE_LOCK_BYPASS
+	if (!dict->dict_bypass_lock)
+#endif
+	CHECK_POSIX(  pthread_rwlock_wrlock(&dict->dict_lock)  );
+	
+	if (dict->dict_bulk <= 0) {
+		ret = EINVAL;
+	} else if (--dict->dict_bulk == 0) {
+		bulk_sort(dict);
+	}
+	
+#if ENABLE_LOCK_BYPASS
+	if (!dict->dict_bypass_lock)
+#endif
+	CHECK_POSIX(  pthread_rwlock_unlock(&dict->dict_lock)  );
+	
+	CHECK_PARAMS( ret == 0 );
+#endif /* USE_HASHLIST */
+	
+	return 0;
+}
+
+/* Check that the references of defs[idx] can be resolved, in the dictionary or in the previous entries of the table. The lock is held. */
+static int batch_check_def( struct dictionary *dict, struct dict_object_def * defs, int idx )
+{
+	struct dict_object_def * def = &defs[idx];
+	struct dict_object * obj = NULL;
+	int i;
+	
+	switch (def->type) {
+		case DICT_VENDOR:
+		case DICT_APPLICATION:
+		case DICT_TYPE:
+		case DICT_COMMAND:
+			if (def->parent) {
+				TRACE_DEBUG(INFO, "Entry %d: no parent can be given for objects of type %s", idx, dict_obj_info[def->type].name);
+				return EINVAL;
+			}
+			return 0;
+		
+		case DICT_ENUMVAL:
+			if (!def->parent) {
+				TRACE_DEBUG(INFO, "Entry %d: the parent type name is mandatory for enumerated values", idx);
+				return EINVAL;
+			}
+			break;
+		
+		case DICT_AVP:
+			{
+				vendor_id_t vid = ((struct dict_avp_data *)def->data)->avp_vendor;
+				CHECK_FCT( search_vendor( dict, VENDOR_BY_ID, &vid, &obj ) );
+				for (i = 0; !obj && (i < idx); i++) {
+					if ((defs[i].type == DICT_VENDOR) && (((struct dict_vendor_data *)defs[i].data)->vendor_id == vid))
+						break;
+				}
+				if (!obj && (i == idx)) {
+					TRACE_DEBUG(INFO, "Entry %d: vendor %u of AVP '%s' is not defined", idx, vid, ((struct dict_avp_data *)def->data)->avp_name);
+					return ENOENT;
+				}
+			}
+			if (!def->parent)
+				return 0;
+			break;
+		
+		default:
+			TRACE_DEBUG(INFO, "Entry %d: objects of type %s cannot be created with fd_dict_new_batch", idx, dict_obj_info[CHECK_TYPE(def->type) ? def->type : 0].name);
+			return EINVAL;
+	}
+	
+	/* Check the parent type */
+	obj = NULL;
+	CHECK_FCT( search_type( dict, TYPE_BY_NAME, def->parent, &obj ) );
+	if (obj)
+		return 0;
+	for (i = 0; i < idx; i++) {
+		if ((defs[i].type == DICT_TYPE) && !strcmp(((struct dict_type_data *)defs[i].data)->type_name, def->parent))
+			return 0;
+	}
+	TRACE_DEBUG(INFO, "Entry %d: parent type '%s' is not defined", idx, def->parent);
+	return ENOENT;
+}
+
+/* Create all the objects of a table with a single acquisition of the lock. See libfdproto.h */
+int fd_dict_new_batch( struct dictionary *dict, struct dict_object_def * defs, int nb_defs, int * nb_conflicts )
+{
+	int ret = 0;
+	int i;
+	int lock = 1;
+	int conflicts = 0;
+	
+	TRACE_ENTRY("%p %p %d %p", dict, defs, nb_defs, nb_conflicts);
+	
+	CHECK_PARAMS( dict && (dict->dict_eyec == DICT_EYECATCHER) && (defs || !nb_defs) && (nb_defs >= 0) );
+	for (i = 0; i < nb_defs; i++) {
+		CHECK_PARAMS( CHECK_TYPE(defs[i].type) && defs[i].data );
+	}
+	
+#if ENABLE_LOCK_BYPASS
+	if (dict->dict_bypass_lock)
+		lock = 0;
+#endif
+	if (lock)
+		CHECK_POSIX(  pthread_rwlock_wrlock(&dict->dict_lock)  );
+	
+	/* Validate all the references first, so that nothing is created if the table is inconsistent */
+	for (i = 0; i < nb_defs; i++) {
+		CHECK_FCT_DO( ret = batch_check_def( dict, defs, i ), goto out );
+	}
+	
+#if USE_HASHLIST
+	dict->dict_bulk++;
+#endif
+	for (i = 0; i < nb_defs; i++) {
+		struct dict_object * parent = NULL;
+		
+		if (defs[i].parent) {
+			CHECK_FCT_DO( ret = search_type( dict, TYPE_BY_NAME, defs[i].parent, &parent ), break );
+			if (!parent) {
+				/* The parent was not created, because of a conflict */
+				TRACE_DEBUG(INFO, "Entry %d: parent type '%s' was not created", i, defs[i].parent);
+				ret = ENOENT;
+				break;
+			}
+		}
+		
+		ret = dict_new( dict, defs[i].type, defs[i].data, parent, NULL, 1 );
+		if ((ret == EEXIST) && nb_conflicts) {
+			/* Already logged by dict_new */
+			conflicts++;
+			ret = 0;
+		}
+		if (ret) {
+			TRACE_DEBUG(INFO, "Entry %d of the table could not be created: %s", i, strerror(ret));
+			break;
+		}
+	}
+#if USE_HASHLIST
+	if (--dict->dict_bulk == 0)
+		bulk_sort(dict);
+#endif
+	
+out:
+	if (lock)
+		CHECK_POSIX_DO(  pthread_rwlock_unlock(&dict->dict_lock),  /* continue */  );
+	
+	if (nb_conflicts)
+		*nb_conflicts = conflicts;
+	
+	return ret;
+}
+
 void fd_dict_bypass_lock( struct dictionary *dict, int bypass )
 {
 #if ENABLE_LOCK_BYPASS
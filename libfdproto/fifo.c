@@ -338,7 +338,13 @@ int fd_fifo_setthrhd ( struct fifo * queue, void * data, uint16_t high, void (*h
 	TRACE_ENTRY( "%p %p %hu %p %hu %p", queue, data, high, h_cb, low, l_cb );
 	
 	/* Check the parameters */
-	CHECK_PARAMS( CHECK_FIFO( queue ) && (high > low) && (queue->data == NULL) );
+	CHECK_PARAMS( CHECK_FIFO( queue ) );
+	if (high == 0) {
+		/* Remove the thresholds */
+		CHECK_PARAMS( (low == 0) && (data == NULL) && (h_cb == NULL) && (l_cb == NULL) );
+	} else {
+		CHECK_PARAMS( (high > low) && (queue->data == NULL) );
+	}
 	
 	/* lock the queue */
 	CHECK_POSIX(  pthread_mutex_lock( &queue->mtx )  );
@@ -111,6 +111,20 @@ struct avp {
 /* Check the type and eyecatcher */
 #define CHECK_AVP(_x) ((_x) && (_C(_x)->type == MSG_AVP) && (_A(_x)->avp_eyec == MSG_AVP_EYEC))
 
+/* Index of the top-level AVPs of a message, to speed up fd_msg_search_avp on big messages. 
+ * It is an open-addressed hash table from (code, vendor) to the first AVP with these values. It is created when a message with at
+ * least MSG_INDEX_MIN top-level AVPs is parsed by fd_msg_parse_dict (by the thread that owns the message, fd_msg_search_avp only
+ * reads it), and dropped when an AVP is added to or removed from the top level until the message is parsed again. */
+#define MSG_INDEX_MIN	8
+struct msg_index {
+	size_t		 mask;		/* number of slots - 1, the number of slots is a power of 2 */
+	struct {
+		avp_code_t	 code;
+		vendor_id_t	 vendor;
+		struct avp	*avp;		/* NULL for a free slot */
+	}		 slots[];
+};
+
 /* The following structure represents an instance of a message (command and children AVPs). */
 struct msg {
 	struct msg_avp_chain	 msg_chain;		/* List of the AVPs in the message */
@@ -137,6 +151,7 @@ struct msg {
 	DiamId_t		 msg_src_id;		/* Diameter Id of the peer this message was received from. This string is malloc'd and must be freed */
 	size_t			 msg_src_id_len;	/* cached length of this string */
 	struct fd_msg_pmdl	 msg_pmdl;		/* list of permessagedata structures. */
+	struct msg_index	*msg_index;		/* Index of the top-level AVPs, if any */
 };
 
 /* Macro to compute the message header size */
@@ -183,6 +198,17 @@ static void init_chain(struct msg_avp_chain * chain, int type)
 	chain->type = type;
 }
 
+/* The list of top-level AVPs of the message containing obj (if any) changes: drop the index */
+static void index_invalidate(struct msg_avp_chain * obj)
+{
+	struct msg_avp_chain * parent = obj->chaining.head->o;
+	
+	if (parent && (parent->type == MSG_MSG) && (_M(parent)->msg_index != NULL)) {
+		free(_M(parent)->msg_index);
+		_M(parent)->msg_index = NULL;
+	}
+}
+
 /* Initialize a new AVP object */
 static void init_avp ( struct avp * avp )
 {
@@ -600,11 +626,55 @@ int fd_msg_avp_add ( msg_or_avp * reference, enum msg_brw_dir dir, struct avp *a
 			/* Other directions are invalid */
 			CHECK_PARAMS( dir = 0 );
 	}
+	
+	index_invalidate(&avp->avp_chain);
 			
 	return 0;
 }
 
 /* Search a given AVP model in a message */
+static inline size_t index_hash(avp_code_t code, vendor_id_t vendor)
+{
+	return (size_t)((code * 2654435761U) ^ (vendor * 40503U));
+}
+
+/* Create the index of the top-level AVPs of a message. Returns NULL if the message is too small or on memory error */
+static struct msg_index * index_build(struct msg * msg)
+{
+	struct fd_list * li;
+	struct msg_index * idx;
+	size_t count = 0, size = 16;
+	
+	for (li = msg->msg_chain.children.next; li != &msg->msg_chain.children; li = li->next)
+		count++;
+	if (count < MSG_INDEX_MIN)
+		return NULL;
+	
+	/* Keep the table at most half full */
+	while (size < 2 * count)
+		size <<= 1;
+	CHECK_MALLOC_DO( idx = calloc(1, sizeof(struct msg_index) + size * sizeof(idx->slots[0])), return NULL );
+	idx->mask = size - 1;
+	
+	for (li = msg->msg_chain.children.next; li != &msg->msg_chain.children; li = li->next) {
+		struct avp * a = _A(li->o);
+		size_t s = index_hash(a->avp_public.avp_code, a->avp_public.avp_vendor) & idx->mask;
+		
+		while (idx->slots[s].avp 
+		    && ((idx->slots[s].code != a->avp_public.avp_code) || (idx->slots[s].vendor != a->avp_public.avp_vendor)))
+			s = (s + 1) & idx->mask;
+		
+		/* Only the first occurrence is saved */
+		if (!idx->slots[s].avp) {
+			idx->slots[s].code   = a->avp_public.avp_code;
+			idx->slots[s].vendor = a->avp_public.avp_vendor;
+			idx->slots[s].avp    = a;
+		}
+	}
+	
+	return idx;
+}
+
 int fd_msg_search_avp ( struct msg * msg, struct dict_object * what, struct avp ** avp )
 {
 	struct avp * nextavp;
@@ -618,16 +688,27 @@ int fd_msg_search_avp ( struct msg * msg, struct dict_object * what, struct avp
 	CHECK_PARAMS( (fd_dict_gettype(what, &dicttype) == 0) && (dicttype == DICT_AVP) );
 	CHECK_FCT(  fd_dict_getval(what, &dictdata)  );
 	
-	/* Loop on all top AVPs */
-	CHECK_FCT(  fd_msg_browse(msg, MSG_BRW_FIRST_CHILD, (void *)&nextavp, NULL)  );
-	while (nextavp) {
-		
-		if ( (nextavp->avp_public.avp_code   == dictdata.avp_code)
-		  && (nextavp->avp_public.avp_vendor == dictdata.avp_vendor) ) /* always 0 if no V flag */
-			break;
+	if (msg->msg_index != NULL) {
+		/* Use the index */
+		struct msg_index * idx = msg->msg_index;
+		size_t s = index_hash(dictdata.avp_code, dictdata.avp_vendor) & idx->mask;
 		
-		/* Otherwise move to next AVP in the message */
-		CHECK_FCT( fd_msg_browse(nextavp, MSG_BRW_NEXT, (void *)&nextavp, NULL) );
+		while (idx->slots[s].avp 
+		    && ((idx->slots[s].code != dictdata.avp_code) || (idx->slots[s].vendor != dictdata.avp_vendor)))
+			s = (s + 1) & idx->mask;
+		nextavp = idx->slots[s].avp;
+	} else {
+		/* Loop on all top AVPs */
+		CHECK_FCT(  fd_msg_browse(msg, MSG_BRW_FIRST_CHILD, (void *)&nextavp, NULL)  );
+		while (nextavp) {
+
+			if ( (nextavp->avp_public.avp_code   == dictdata.avp_code)
+			  && (nextavp->avp_public.avp_vendor == dictdata.avp_vendor) ) /* always 0 if no V flag */
+				break;
+
+			/* Otherwise move to next AVP in the message */
+			CHECK_FCT( fd_msg_browse(nextavp, MSG_BRW_NEXT, (void *)&nextavp, NULL) );
+		}
 	}
 	
 	if (avp)
@@ -658,6 +739,7 @@ static int destroy_obj (struct msg_avp_chain * obj )
 	CHECK_PARAMS(  VALIDATE_OBJ(obj) && FD_IS_LIST_EMPTY( &obj->children ) );
 
 	/* Unlink this object if needed */
+	index_invalidate(obj);
 	fd_list_unlink( &obj->chaining );
 	
 	/* Free the octetstring if needed */
@@ -676,6 +758,10 @@ static int destroy_obj (struct msg_avp_chain * obj )
 		free(_M(obj)->msg_src_id);
 	}
 	
+	if ((obj->type == MSG_MSG) && (_M(obj)->msg_index != NULL)) {
+		free(_M(obj)->msg_index);
+	}
+	
 	if ((obj->type == MSG_MSG) && (_M(obj)->msg_rtdata != NULL)) {
 		fd_rtd_free(&_M(obj)->msg_rtdata);
 	}
@@ -1545,8 +1631,7 @@ struct fd_msg_pmdl * fd_msg_pmdl_get(struct msg * msg)
 
 
 /******************* End-to-end counter *********************/
-static uint32_t fd_eteid;
-static pthread_mutex_t fd_eteid_lck = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t fd_eteid; /* incremented atomically, the threads creating requests do not wait for each other */
 
 void fd_msg_eteid_init(void)
 {
@@ -1557,15 +1642,7 @@ void fd_msg_eteid_init(void)
 
 uint32_t fd_msg_eteid_get ( void )
 {
-	uint32_t ret;
-	
-	CHECK_POSIX_DO( pthread_mutex_lock(&fd_eteid_lck), /* continue */ );
-	
-	ret = fd_eteid ++;
-	
-	CHECK_POSIX_DO( pthread_mutex_unlock(&fd_eteid_lck), /* continue */ );
-	
-	return ret;
+	return __atomic_fetch_add(&fd_eteid, 1, __ATOMIC_RELAXED);
 }
 
 /***************************************************************************************************************/
@@ -2028,6 +2105,309 @@ int fd_msg_parse_buffer ( unsigned char ** buffer, size_t buflen, struct msg **
 }
 
 		
+/***************************************************************************************************************/
+/* Message templates: the message is bufferized once, instances are created by copying and patching this buffer */
+
+/* An AVP of the template whose value can be changed for each instance */
+struct tmpl_field {
+	int			idx;		/* index of the AVP in the fields parameter of fd_msg_tmpl_new */
+	size_t			hdr_off;	/* offset of the AVP header in the template buffer */
+	size_t			data_off;	/* offset of the AVP data in the template buffer */
+	size_t			data_len;	/* length of the data in the template, without padding */
+	enum dict_avp_basetype	type;		/* base type of the AVP */
+};
+
+/* A Grouped AVP that contains at least one field; its length is updated when the size of a field changes */
+struct tmpl_group {
+	size_t			hdr_off;	/* offset of the AVP header in the template buffer */
+	size_t			len;		/* AVP Length in the template */
+};
+
+#define MSG_TMPL_EYEC	(0x11355469)
+#define CHECK_TMPL(_x) ((_x) && ((_x)->tmpl_eyec == MSG_TMPL_EYEC))
+
+struct fd_msg_tmpl {
+	int			 tmpl_eyec;	/* Must be MSG_TMPL_EYEC */
+	struct dict_object	*tmpl_model;	/* The command of the template */
+	unsigned char		*tmpl_buf;	/* The bufferized message */
+	size_t			 tmpl_len;	/* and its length */
+	int			 tmpl_nbfields;
+	struct tmpl_field	*tmpl_fields;	/* ordered by offset in the buffer */
+	int			 tmpl_nbgroups;
+	struct tmpl_group	*tmpl_groups;
+};
+
+/* Browse a list of AVPs as bufferize_chain would write it, and save the location of the fields */
+static int tmpl_locate(struct fd_msg_tmpl * tmpl, struct fd_list * list, size_t * offset, struct avp ** fields, int nb_fields, int * found)
+{
+	struct fd_list * avpch;
+	
+	TRACE_ENTRY("%p %p %p %p %d %p", tmpl, list, offset, fields, nb_fields, found);
+	
+	for (avpch = list->next; avpch != list; avpch = avpch->next) {
+		struct avp * avp = _A(avpch->o);
+		size_t hdrsz = GETAVPHDRSZ(avp->avp_public.avp_flags);
+		int i;
+		
+		for (i = 0; i < nb_fields; i++) {
+			struct dict_avp_data dictdata;
+			struct tmpl_field * f;
+			
+			if (fields[i] != avp)
+				continue;
+			
+			/* Only AVPs with a known scalar type can be patched */
+			CHECK_PARAMS( avp->avp_model && (*found < nb_fields) );
+			CHECK_FCT( fd_dict_getval(avp->avp_model, &dictdata) );
+			CHECK_PARAMS( dictdata.avp_basetype != AVP_TYPE_GROUPED );
+			
+			f = &tmpl->tmpl_fields[(*found)++];
+			f->idx      = i;
+			f->hdr_off  = *offset;
+			f->data_off = *offset + hdrsz;
+			f->data_len = avp->avp_public.avp_len - hdrsz;
+			f->type     = dictdata.avp_basetype;
+		}
+		
+		if (!FD_IS_LIST_EMPTY(&avp->avp_chain.children)) {
+			size_t sub = *offset + hdrsz;
+			int before = *found;
+			
+			CHECK_FCT( tmpl_locate(tmpl, &avp->avp_chain.children, &sub, fields, nb_fields, found) );
+			
+			if (*found > before) {
+				/* This Grouped AVP encloses some fields */
+				CHECK_MALLOC( tmpl->tmpl_groups = realloc(tmpl->tmpl_groups, (tmpl->tmpl_nbgroups + 1) * sizeof(struct tmpl_group)) );
+				tmpl->tmpl_groups[tmpl->tmpl_nbgroups].hdr_off = *offset;
+				tmpl->tmpl_groups[tmpl->tmpl_nbgroups].len = avp->avp_public.avp_len;
+				tmpl->tmpl_nbgroups++;
+			}
+		}
+		
+		*offset += PAD4(avp->avp_public.avp_len);
+	}
+	
+	return 0;
+}
+
+/* Create a template from a message */
+int fd_msg_tmpl_new ( struct msg * msg, struct avp ** fields, int nb_fields, struct fd_msg_tmpl ** tmpl )
+{
+	struct fd_msg_tmpl * new = NULL;
+	size_t offset = GETMSGHDRSZ();
+	int found = 0;
+	int ret = 0;
+	int i, j;
+	
+	TRACE_ENTRY("%p %p %d %p", msg, fields, nb_fields, tmpl);
+	
+	/* Check the parameters */
+	CHECK_PARAMS(  CHECK_MSG(msg) && msg->msg_model && tmpl && (nb_fields >= 0) && (fields || !nb_fields)  );
+	for (i = 0; i < nb_fields; i++) {
+		CHECK_PARAMS( CHECK_AVP(fields[i]) );
+		for (j = 0; j < i; j++) {
+			CHECK_PARAMS( fields[i] != fields[j] );
+		}
+	}
+	
+	/* Create the template object */
+	CHECK_MALLOC( new = malloc(sizeof(struct fd_msg_tmpl)) );
+	memset(new, 0, sizeof(struct fd_msg_tmpl));
+	new->tmpl_eyec = MSG_TMPL_EYEC;
+	new->tmpl_model = msg->msg_model;
+	
+	/* Render the message once */
+	CHECK_FCT_DO( ret = fd_msg_bufferize(msg, &new->tmpl_buf, &new->tmpl_len), goto error );
+	
+	/* And find the fields in this buffer */
+	if (nb_fields) {
+		CHECK_MALLOC_DO( new->tmpl_fields = calloc(nb_fields, sizeof(struct tmpl_field)), { ret = ENOMEM; goto error; } );
+		CHECK_FCT_DO( ret = tmpl_locate(new, &msg->msg_chain.children, &offset, fields, nb_fields, &found), goto error );
+		ASSERT(offset == new->tmpl_len);
+		
+		/* All the fields must be in the message */
+		CHECK_PARAMS_DO( found == nb_fields, { ret = EINVAL; goto error; } );
+	}
+	new->tmpl_nbfields = nb_fields;
+	
+	*tmpl = new;
+	return 0;
+	
+error:
+	free(new->tmpl_buf);
+	free(new->tmpl_fields);
+	free(new->tmpl_groups);
+	free(new);
+	return ret;
+}
+
+/* Write the 24 bits Length field of an AVP or message header */
+static void tmpl_put_len(unsigned char * hdr, size_t len)
+{
+	hdr[1] = (len >> 16) & 0xff;
+	hdr[2] = (len >> 8) & 0xff;
+	hdr[3] = len & 0xff;
+}
+
+/* Create the buffer of an instance: copy the template, with new values for the fields */
+static int tmpl_stamp(struct fd_msg_tmpl * tmpl, union avp_value ** values, unsigned char ** buffer, size_t * len)
+{
+	unsigned char * buf;
+	size_t newlen = tmpl->tmpl_len;
+	size_t src = 0, dst = 0;
+	int i, j;
+	
+	/* Compute the size of the instance */
+	for (i = 0; i < tmpl->tmpl_nbfields; i++) {
+		struct tmpl_field * f = &tmpl->tmpl_fields[i];
+		union avp_value * v = values ? values[f->idx] : NULL;
+		if (v && (f->type == AVP_TYPE_OCTETSTRING)) {
+			CHECK_PARAMS( v->os.data || !v->os.len );
+			newlen = newlen - PAD4(f->data_len) + PAD4(v->os.len);
+		}
+	}
+	CHECK_PARAMS( newlen <= 0xffffff );
+	
+	CHECK_MALLOC( buf = malloc(newlen) );
+	
+	/* Copy the buffer, replacing the fields values */
+	for (i = 0; i < tmpl->tmpl_nbfields; i++) {
+		struct tmpl_field * f = &tmpl->tmpl_fields[i];
+		union avp_value * v = values ? values[f->idx] : NULL;
+		size_t sz = f->data_len;
+		
+		memcpy(buf + dst, tmpl->tmpl_buf + src, f->data_off - src);
+		dst += f->data_off - src;
+		src = f->data_off + PAD4(f->data_len);
+		
+		if (!v) {
+			/* Keep the value of the template */
+			memcpy(buf + dst, tmpl->tmpl_buf + f->data_off, PAD4(sz));
+			dst += PAD4(sz);
+			continue;
+		}
+		
+		switch (f->type) {
+			case AVP_TYPE_OCTETSTRING:
+				sz = v->os.len;
+				if (sz)
+					memcpy(buf + dst, v->os.data, sz);
+				memset(buf + dst + sz, 0, PAD4(sz) - sz);
+				/* Update the AVP Length */
+				tmpl_put_len(buf + dst - f->data_off + f->hdr_off + 4, f->data_off - f->hdr_off + sz);
+				break;
+			
+			case AVP_TYPE_INTEGER32:
+				PUT_in_buf_32(v->i32, buf + dst);
+				break;
+			
+			case AVP_TYPE_INTEGER64:
+				PUT_in_buf_64(v->i64, buf + dst);
+				break;
+			
+			case AVP_TYPE_UNSIGNED32:
+				PUT_in_buf_32(v->u32, buf + dst);
+				break;
+			
+			case AVP_TYPE_UNSIGNED64:
+				PUT_in_buf_64(v->u64, buf + dst);
+				break;
+			
+			case AVP_TYPE_FLOAT32:
+				/* We read the f32 as "u32" here to avoid casting to uint make decimals go away. */
+				PUT_in_buf_32(v->u32, buf + dst);
+				break;
+			
+			case AVP_TYPE_FLOAT64:
+				PUT_in_buf_64(v->u64, buf + dst);
+				break;
+			
+			default:
+				ASSERT(0);
+		}
+		dst += PAD4(sz);
+	}
+	memcpy(buf + dst, tmpl->tmpl_buf + src, tmpl->tmpl_len - src);
+	ASSERT(dst + tmpl->tmpl_len - src == newlen);
+	
+	if (newlen != tmpl->tmpl_len) {
+		/* Update the Length of the enclosing Grouped AVPs, at their new location */
+		for (i = 0; i < tmpl->tmpl_nbgroups; i++) {
+			struct tmpl_group * g = &tmpl->tmpl_groups[i];
+			ssize_t shift = 0, inner = 0;
+			
+			for (j = 0; j < tmpl->tmpl_nbfields; j++) {
+				struct tmpl_field * f = &tmpl->tmpl_fields[j];
+				union avp_value * v = values ? values[f->idx] : NULL;
+				ssize_t delta;
+				
+				if (!v || (f->type != AVP_TYPE_OCTETSTRING))
+					continue;
+				
+				delta = (ssize_t)PAD4(v->os.len) - (ssize_t)PAD4(f->data_len);
+				if (f->hdr_off < g->hdr_off)
+					shift += delta;
+				else if (f->hdr_off < g->hdr_off + g->len)
+					inner += delta;
+			}
+			
+			tmpl_put_len(buf + g->hdr_off + shift + 4, g->len + inner);
+		}
+		
+		/* And the message Length */
+		tmpl_put_len(buf, newlen);
+	}
+	
+	*buffer = buf;
+	*len = newlen;
+	return 0;
+}
+
+/* Create a new message from a template */
+int fd_msg_tmpl_instance ( struct fd_msg_tmpl * tmpl, union avp_value ** values, int flags, struct msg ** msg )
+{
+	unsigned char * buf = NULL;
+	size_t len = 0;
+	struct msg * new = NULL;
+	int ret = 0;
+	
+	TRACE_ENTRY("%p %p %x %p", tmpl, values, flags, msg);
+	
+	/* Check the parameters */
+	CHECK_PARAMS(  CHECK_TMPL(tmpl) && msg && CHECK_MSGFL(flags)  );
+	
+	/* Create the buffer of the new message */
+	CHECK_FCT( tmpl_stamp(tmpl, values, &buf, &len) );
+	
+	if (flags & MSGFL_ALLOC_ETEID) {
+		PUT_in_buf_32(fd_msg_eteid_get(), buf + 16);
+	}
+	
+	/* Create the AVP objects; their values are interpreted only when the application or the routing looks for them */
+	CHECK_FCT_DO( ret = fd_msg_parse_buffer(&buf, len, &new), { free(buf); return ret; } );
+	
+	/* We already know the command, no need to search it in the dictionary later */
+	new->msg_model = tmpl->tmpl_model;
+	
+	*msg = new;
+	return 0;
+}
+
+/* Destroy a template */
+int fd_msg_tmpl_free ( struct fd_msg_tmpl * tmpl )
+{
+	TRACE_ENTRY("%p", tmpl);
+	
+	CHECK_PARAMS( CHECK_TMPL(tmpl) );
+	
+	tmpl->tmpl_eyec = 0xdead;
+	free(tmpl->tmpl_buf);
+	free(tmpl->tmpl_fields);
+	free(tmpl->tmpl_groups);
+	free(tmpl);
+	return 0;
+}
+
 /***************************************************************************************************************/
 /* Parsing messages and AVP with dictionary information */
 
@@ -2356,8 +2736,14 @@ int fd_msg_parse_dict ( msg_or_avp * object, struct dictionary * dict, struct fd
 		memset(error_info, 0, sizeof(struct fd_pei));
 	
 	switch (_C(object)->type) {
-		case MSG_MSG:
-			return parsedict_do_msg(dict, _M(object), 0, error_info);
+		case MSG_MSG: {
+			int ret = parsedict_do_msg(dict, _M(object), 0, error_info);
+			
+			/* Index the top-level AVPs for fd_msg_search_avp */
+			if ((ret == 0) && (_M(object)->msg_index == NULL))
+				_M(object)->msg_index = index_build(_M(object));
+			return ret;
+		}
 		
 		case MSG_AVP:
 			return parsedict_do_avp(dict, _A(object), 0, error_info);
@@ -45,8 +45,24 @@ struct rt_data {
 	int		extracted;	/* if 0, candidates is ordered by diamid, otherwise the order is unspecified. This also counts the number of times the message was (re-)sent, as a side effect */
 	struct fd_list	candidates;	/* All the candidates. Items are struct rtd_candidate. */
 	struct fd_list	errors;		/* All errors received from other peers for this message */
+	
+	/* The candidates added by fd_rtd_candidate_add_array: they are not freed individually, and their strings belong to the caller */
+	struct rtd_candidate * array;
+	int		array_nb;
+	void	     (*	release)(void *);
+	void	      *	release_data;
 };
 
+/* Free a candidate unlinked from the list */
+static void candidate_free(struct rt_data * rtd, struct rtd_candidate * c)
+{
+	if (rtd->array && (c >= rtd->array) && (c < rtd->array + rtd->array_nb))
+		return;
+	free(c->diamid);
+	free(c->realm);
+	free(c);
+}
+
 /* Items of the errors list */
 struct rtd_error {
 	struct fd_list	chain;	/* link in the list, ordered by nexthop (fd_os_cmp) */
@@ -89,10 +105,11 @@ void fd_rtd_free(struct rt_data ** rtd)
 		struct rtd_candidate * c = (struct rtd_candidate *) old->candidates.next;
 		
 		fd_list_unlink(&c->chain);
-		free(c->diamid);
-		free(c->realm);
-		free(c);
+		candidate_free(old, c);
 	}
+	free(old->array);
+	if (old->release)
+		(*old->release)(old->release_data);
 	
 	while (!FD_IS_LIST_EMPTY(&old->errors)) {
 		struct rtd_error * c = (struct rtd_error *) old->errors.next;
@@ -145,6 +162,35 @@ int  fd_rtd_candidate_add(struct rt_data * rtd, DiamId_t peerid, size_t peeridle
 	return 0;
 }
 
+/* Initialize the candidates from an array of peers, without copying the strings */
+int  fd_rtd_candidate_add_array(struct rt_data * rtd, struct rtd_candidate * peers, int nb, void (*release)(void *), void * data)
+{
+	int i;
+	
+	TRACE_ENTRY("%p %p %d %p %p", rtd, peers, nb, release, data);
+	CHECK_PARAMS( rtd && FD_IS_LIST_EMPTY(&rtd->candidates) && (!rtd->array) && (!rtd->release) && (nb >= 0) && (peers || !nb) );
+	
+	if (nb) {
+		CHECK_MALLOC( rtd->array = malloc(nb * sizeof(struct rtd_candidate)) );
+		for (i = 0; i < nb; i++) {
+			struct rtd_candidate * c = &rtd->array[i];
+			fd_list_init(&c->chain, c);
+			c->diamid    = peers[i].diamid;
+			c->diamidlen = peers[i].diamidlen;
+			c->realm     = peers[i].realm;
+			c->realmlen  = peers[i].realmlen;
+			c->score     = 0;
+			c->peer      = peers[i].peer;
+			fd_list_insert_before(&rtd->candidates, &c->chain);
+		}
+		rtd->array_nb = nb;
+	}
+	rtd->release = release;
+	rtd->release_data = data;
+	
+	return 0;
+}
+
 /* Remove a peer from the candidates (if it is found). Case insensitive search since the names are received from other peers */
 void fd_rtd_candidate_del(struct rt_data * rtd, uint8_t * id, size_t idsz)
 {
@@ -165,9 +211,7 @@ void fd_rtd_candidate_del(struct rt_data * rtd, uint8_t * id, size_t idsz)
 		if (!cmp) {
 			/* Found it! Remove it */
 			fd_list_unlink(&c->chain);
-			free(c->diamid);
-			free(c->realm);
-			free(c);
+			candidate_free(rtd, c);
 			break;
 		}
 		
@@ -281,57 +325,55 @@ void fd_rtd_candidate_extract(struct rt_data * rtd, struct fd_list ** candidates
 	return;
 }
 
+/* Order the candidates by increasing score */
+static int candidate_cmp(const void * a, const void * b)
+{
+	int sa = (*(struct rtd_candidate **)a)->score;
+	int sb = (*(struct rtd_candidate **)b)->score;
+	return (sa > sb) - (sa < sb);
+}
+
 /* Reorder the list of peers. If several peer have the same highest score, they are randomized. */
 int  fd_rtd_candidate_reorder(struct fd_list * candidates)
 {
-	struct fd_list unordered = FD_LIST_INITIALIZER(unordered), *li;
-	struct fd_list highest = FD_LIST_INITIALIZER(highest);
-	int hs = -1;
+	struct rtd_candidate * local[64], ** sorted = local;
+	struct fd_list * li;
+	int nb = 0, i, hi;
 	
 	TRACE_ENTRY("%p", candidates);
 	CHECK_PARAMS( candidates );
 	
-	/* First, move all items from candidates to the undordered list */
-	fd_list_move_end(&unordered, candidates);
+	for (li = candidates->next; li != candidates; li = li->next)
+		nb++;
+	if (nb < 2)
+		return 0;
 	
-	/* Now extract each element from unordered and add it back to list ordered by score */
-	while (!FD_IS_LIST_EMPTY(&unordered)) {
-		struct rtd_candidate * c = (struct rtd_candidate *) unordered.next;
-		
-		fd_list_unlink(&c->chain);
-		
-		/* If this candidate has a higher score than the previous ones */
-		if (c->score > hs) {
-			/* Then we move the previous high score items at end of the list */
-			fd_list_move_end(candidates, &highest);
-			
-			/* And the new high score is set */
-			hs = c->score;
-		}
-		
-		/* If this candidate equals the higher score, add it into highest list at a random place */
-		if (c->score == hs) {
-			if (rand() & 1) {
-				fd_list_insert_after(&highest, &c->chain);
-			} else {
-				fd_list_insert_before(&highest, &c->chain);
-			}
-		/* Otherwise, insert at normal place in the list */
-		} else {
-			/* Find the position in ordered candidates list */
-			for (li = candidates->next; li != candidates; li = li->next) {
-				struct rtd_candidate * cnext = (struct rtd_candidate *) li;
-				if (cnext->score >= c->score)
-					break;
-			}
-
-			/* Add the element there */
-			fd_list_insert_before(li, &c->chain);
-		}
+	/* Sort an array of the items, then rebuild the list in this order */
+	if (nb > sizeof(local) / sizeof(local[0])) {
+		CHECK_MALLOC( sorted = malloc(nb * sizeof(struct rtd_candidate *)) );
+	}
+	for (i = 0, li = candidates->next; li != candidates; li = li->next)
+		sorted[i++] = (struct rtd_candidate *) li;
+	
+	qsort(sorted, nb, sizeof(struct rtd_candidate *), candidate_cmp);
+	
+	/* Shuffle the candidates with the highest score, they are at the end */
+	for (hi = nb - 1; (hi > 0) && (sorted[hi - 1]->score == sorted[nb - 1]->score); hi--)
+		;
+	for (i = nb - 1; i > hi; i--) {
+		int j = hi + rand() % (i - hi + 1);
+		struct rtd_candidate * tmp = sorted[i];
+		sorted[i] = sorted[j];
+		sorted[j] = tmp;
+	}
+	
+	for (i = 0; i < nb; i++) {
+		fd_list_unlink(&sorted[i]->chain);
+		fd_list_insert_before(candidates, &sorted[i]->chain);
 	}
 	
-	/* Now simply move back all the "highest" candidates at the end of the list */
-	fd_list_move_end(candidates, &highest);
+	if (sorted != local)
+		free(sorted);
 	
 	return 0;
 }
@@ -117,16 +117,16 @@ static struct {
 
 static uint32_t		sess_cnt = 0; /* counts all active session (that are in the expiry list) */
 
-/* The following are used to generate sid values that are eternaly unique */
-static uint32_t   	sid_h;	/* initialized to the current time in fd_sess_init */
-static uint32_t   	sid_l;	/* incremented each time a session id is created */
-static pthread_mutex_t 	sid_lock = PTHREAD_MUTEX_INITIALIZER;
+/* The following is used to generate sid values that are eternaly unique: the high 32 bits (<high32> in the sid) are initialized
+ to the current time in fd_sess_init, the low 32 bits (<low32>) are incremented each time a session id is created. The increment 
+ is atomic, so that the threads creating sessions do not contend on a lock. */
+static uint64_t   	sid_hl;
 
 /* Expiring sessions management */
 static struct fd_list	exp_sentinel = FD_LIST_INITIALIZER(exp_sentinel);	/* list of sessions ordered by their timeout date */
 static pthread_mutex_t	exp_lock = PTHREAD_MUTEX_INITIALIZER;	/* lock protecting the list. */
-static pthread_cond_t	exp_cond = PTHREAD_COND_INITIALIZER;	/* condvar used by the expiry mecahinsm. */
-static pthread_t	exp_thr = (pthread_t)NULL; 	/* The expiry thread that handles cleanup of expired sessions */
+static void		exp_fct(void * arg);
+static struct fd_timer	exp_tmr = FD_TIMER_INITIALIZER(exp_tmr, exp_fct, NULL, FD_TIMER_BLOCKING); /* The timer that handles cleanup of expired sessions, armed at the timeout of the first one */
 
 /* Hierarchy of the locks, to avoid deadlocks:
  *  hash lock > state lock > expiry lock
@@ -175,26 +175,22 @@ static void del_session(struct session * s)
 	free(s);
 }
 	
-/* The expiry thread */
-static void * exp_fct(void * arg)
+/* The expiry timer callback */
+static void exp_fct(void * arg)
 {
-	fd_log_threadname ( "Session/expire" );
-	TRACE_ENTRY( "" );
-	
+	TRACE_ENTRY( "%p", arg );
 	
 	do {
 		struct timespec	now;
 		struct session * first;
 		
 		CHECK_POSIX_DO( pthread_mutex_lock(&exp_lock),  break );
-		pthread_cleanup_push( fd_cleanup_mutex, &exp_lock );
-again:		
+		
 		/* Check if there are expiring sessions available */
 		if (FD_IS_LIST_EMPTY(&exp_sentinel)) {
-			/* Just wait for a change or cancelation */
-			CHECK_POSIX_DO( pthread_cond_wait( &exp_cond, &exp_lock ), break /* this might not pop the cleanup handler, but since we ASSERT(0), it is not the big issue... */ );
-			/* Restart the loop on wakeup */
-			goto again;
+			/* The timer is armed again when a session is added */
+			CHECK_POSIX_DO( pthread_mutex_unlock(&exp_lock),  break );
+			return;
 		}
 		
 		/* Get the pointer to the session that expires first */
@@ -202,30 +198,24 @@ again:
 		ASSERT( VALIDATE_SI(first) );
 		
 		/* Get the current time */
-		CHECK_SYS_DO(  clock_gettime(CLOCK_REALTIME, &now),  break  );
+		CHECK_SYS_DO(  clock_gettime(CLOCK_REALTIME, &now),  { pthread_mutex_unlock(&exp_lock); break; }  );
 
 		/* If first session is not expired, we just wait until it happens */
 		if ( TS_IS_INFERIOR( &now, &first->timeout ) ) {
-			
-			CHECK_POSIX_DO2(  pthread_cond_timedwait( &exp_cond, &exp_lock, &first->timeout ),  
-					ETIMEDOUT, /* ETIMEDOUT is a normal error, continue */,
-					/* on other error, */ break );
-	
-			/* on wakeup, loop */
-			goto again;
+			CHECK_FCT_DO( fd_timer_arm( &exp_tmr, &first->timeout ), { pthread_mutex_unlock(&exp_lock); break; } );
+			CHECK_POSIX_DO( pthread_mutex_unlock(&exp_lock),  break );
+			return;
 		}
 		
 		/* Now, the first session in the list is expired; destroy it */
-		pthread_cleanup_pop( 0 );
 		CHECK_POSIX_DO( pthread_mutex_unlock(&exp_lock),  break );
 		
 		CHECK_FCT_DO( fd_sess_destroy( &first ), break );
 		
 	} while (1);
 	
-	TRACE_DEBUG(INFO, "A system error occurred in session module! Expiry thread is terminating...");
+	TRACE_DEBUG(INFO, "A system error occurred in session module! Expiry is stopped...");
 	ASSERT(0);
-	return NULL;
 }
 	
 	
@@ -240,8 +230,7 @@ int fd_sess_init(void)
 	TRACE_ENTRY( "" );
 	
 	/* Initialize the global counters */
-	sid_h = (uint32_t) time(NULL);
-	sid_l = 0;
+	sid_hl = ((uint64_t)(uint32_t) time(NULL)) << 32;
 	
 	/* Initialize the hash table */
 	for (i = 0; i < sizeof(sess_hash) / sizeof(sess_hash[0]); i++) {
@@ -255,9 +244,7 @@ int fd_sess_init(void)
 /* Run this when initializations are complete. */
 int fd_sess_start(void)
 {
-	/* Start session garbage collector (expiry) */
-	CHECK_POSIX(  pthread_create(&exp_thr, NULL, exp_fct, NULL)  );
-	
+	/* Nothing to do: the sessions expire with the timers (fd_timer_arm), since they are created */
 	return 0;
 }
 
@@ -265,7 +252,7 @@ int fd_sess_start(void)
 void fd_sess_fini(void)
 {
 	TRACE_ENTRY("");
-	CHECK_FCT_DO( fd_thr_term(&exp_thr), /* continue */ );
+	CHECK_FCT_DO( fd_timer_cancel(&exp_tmr), /* continue */ );
 	
 	/* Destroy all sessions in the hash table, and the hash table itself? -- How to do it without a race condition ? */
 	
@@ -400,6 +387,7 @@ int fd_sess_new ( struct session ** session, DiamId_t diamid, size_t diamidlen,
 		CHECK_MALLOC( sid = os0dup(opt, optlen) );
 		sidlen = optlen;
 	} else {
+		uint64_t sid_hl_cpy;
 		uint32_t sid_h_cpy;
 		uint32_t sid_l_cpy;
 		/* "<diamId>;<high32>;<low32>[;opt]" */
@@ -410,12 +398,10 @@ int fd_sess_new ( struct session ** session, DiamId_t diamid, size_t diamidlen,
 		sidlen++; /* space for the final \0 also */
 		CHECK_MALLOC( sid = malloc(sidlen) );
 		
-		CHECK_POSIX( pthread_mutex_lock(&sid_lock) );
-		if ( ++sid_l == 0 ) /* overflow */
-			++sid_h;
-		sid_h_cpy = sid_h;
-		sid_l_cpy = sid_l;
-		CHECK_POSIX( pthread_mutex_unlock(&sid_lock) );
+		/* An overflow of the low part increments the high part */
+		sid_hl_cpy = __atomic_add_fetch(&sid_hl, 1, __ATOMIC_RELAXED);
+		sid_h_cpy = (uint32_t)(sid_hl_cpy >> 32);
+		sid_l_cpy = (uint32_t)sid_hl_cpy;
 		
 		if (opt) {
 			sidlen = snprintf((char*)sid, sidlen, "%.*s;%u;%u;%.*s", (int)diamidlen, diamid, sid_h_cpy, sid_l_cpy, (int)optlen, opt);
@@ -498,9 +484,9 @@ int fd_sess_new ( struct session ** session, DiamId_t diamid, size_t diamidlen,
 	fd_list_insert_after( li, &sess->expire );
 	sess_cnt++;
 
-	/* We added a new expiring element, we must signal */
+	/* We added a new expiring element, we must arm the timer */
 	if (li == &exp_sentinel) {
-		CHECK_POSIX_DO( pthread_cond_signal(&exp_cond), { ASSERT(0); } ); /* if it fails, we might not pop the cleanup handlers, but this should not happen -- and we'd have a serious problem otherwise */
+		CHECK_FCT_DO( fd_timer_arm(&exp_tmr, &sess->timeout), { ASSERT(0); } ); /* if it fails, we might not pop the cleanup handlers, but this should not happen -- and we'd have a serious problem otherwise */
 	}
 
 	/* We're done with the locked part */
@@ -589,9 +575,9 @@ int fd_sess_settimeout( struct session * session, const struct timespec * timeou
 	}
 	fd_list_insert_before( li, &session->expire );
 
-	/* We added a new expiring element, we must signal if it was in first position */
+	/* We added a new expiring element, we must arm the timer if it was in first position */
 	if (session->expire.prev == &exp_sentinel) {
-		CHECK_POSIX_DO( pthread_cond_signal(&exp_cond), { ASSERT(0); /* so that we don't have a pending cancellation handler */ } );
+		CHECK_FCT_DO( fd_timer_arm(&exp_tmr, &session->timeout), { ASSERT(0); /* so that we don't have a pending cancellation handler */ } );
 	}
 
 	/* We're done */
@@ -0,0 +1,430 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+/* Timers module.
+ *
+ * The armed timers are linked in a hierarchical wheel, as in the Linux kernel. The level 0 has one slot per ms for
+ * the next 256 ms; each following level has 64 slots, each covering the whole range of the previous level:
+ *   - level 1: 256 ms per slot, up to 16 s;
+ *   - level 2: 16 s per slot, up to 17 min;
+ *   - level 3: 17 min per slot, up to 18 hours;
+ *   - level 4: 18 hours per slot, up to 49 days. The timers further away are kept in the last slot, and linked again from there.
+ * When the level 0 wraps, the timers of the next slot of the level 1 are spread in the level 0, and so on for the
+ * upper levels. Arming and canceling a timer is done in constant time, and the thread only wakes up when a slot of the level 0
+ * contains timers, or when a slot of an upper level must be spread.
+ * The expired timers flagged FD_TIMER_BLOCKING are passed to a second thread, created when the first one expires, which
+ * calls their callbacks.
+ */
+
+#include "fdproto-internal.h"
+
+#define TMR_LVLS	5
+#define TMR_BITS0	8	/* 256 slots in level 0 */
+#define TMR_BITS	6	/* 64 slots in the other levels */
+#define LVL_SHIFT(_l)	((_l) ? (TMR_BITS0 + ((_l) - 1) * TMR_BITS) : 0)
+#define LVL_SLOTS(_l)	((_l) ? (1 << TMR_BITS) : (1 << TMR_BITS0))
+
+#define TMR_NEVER	((uint64_t)-1)
+#define TS_TICK(_ts)	((uint64_t)(_ts)->tv_sec * 1000 + (_ts)->tv_nsec / 1000000)
+
+static struct fd_list	tmr_wheel[TMR_LVLS][1 << TMR_BITS0];	/* The slots. Only the LVL_SLOTS first ones are used in each level */
+static int		tmr_cnt[TMR_LVLS];	/* Number of timers in each level */
+static uint64_t		tmr_now;	/* All the slots before this tick have been processed */
+static struct fd_list	tmr_expired = FD_LIST_INITIALIZER(tmr_expired); /* The timers whose callback must be called now */
+static struct fd_timer *tmr_running;	/* The timer whose callback is being called */
+static struct fd_list	tmr_slow = FD_LIST_INITIALIZER(tmr_slow); /* The expired FD_TIMER_BLOCKING timers, for the second thread */
+static struct fd_timer *tmr_slow_running;	/* The timer whose callback is being called by the second thread */
+static uint64_t		tmr_wake;	/* The tick when the thread wakes up, TMR_NEVER if only on signal, 0 if it is not sleeping */
+static pthread_t	tmr_thr = (pthread_t)NULL;
+static pthread_t	tmr_slow_thr = (pthread_t)NULL;
+static pthread_mutex_t	tmr_mtx  = PTHREAD_MUTEX_INITIALIZER;	/* Protects all the above */
+static pthread_cond_t	tmr_cnd  = PTHREAD_COND_INITIALIZER;	/* Signaled to wake up the thread */
+static pthread_cond_t	tmr_slow_cnd = PTHREAD_COND_INITIALIZER;	/* Signaled to wake up the second thread */
+static pthread_cond_t	tmr_done = PTHREAD_COND_INITIALIZER;	/* Broadcast when a callback completes */
+static void	      (*tmr_hook)(void);	/* Called by the threads when they start, and once when it is registered */
+static int		tmr_hook_new;	/* The hook must be called before the next processing of the wheel */
+static int		tmr_slow_hook_new;	/* Same for the second thread */
+
+/* Link a timer in the appropriate slot of the wheel. Called with the lock */
+static void tmr_link(struct fd_timer * t)
+{
+	uint64_t tick = t->tick;
+	uint64_t delta;
+	int l;
+	
+	if (tick < tmr_now)
+		tick = tmr_now; /* expires in the next processed slot */
+	delta = tick - tmr_now;
+	if (delta >= ((uint64_t)1 << LVL_SHIFT(TMR_LVLS))) {
+		/* Too far, keep it in the last slot of the top level */
+		delta = ((uint64_t)1 << LVL_SHIFT(TMR_LVLS)) - 1;
+		tick = tmr_now + delta;
+	}
+	
+	for (l = 0; l < TMR_LVLS - 1; l++) {
+		if (delta < ((uint64_t)1 << LVL_SHIFT(l + 1)))
+			break;
+	}
+	
+	fd_list_insert_before(&tmr_wheel[l][(tick >> LVL_SHIFT(l)) & (LVL_SLOTS(l) - 1)], &t->chain);
+	t->lvl = l;
+	tmr_cnt[l]++;
+}
+
+/* Unlink a timer if it is armed. Called with the lock */
+static void tmr_unlink(struct fd_timer * t)
+{
+	if (FD_IS_LIST_EMPTY(&t->chain))
+		return;
+	if (t->lvl >= 0)
+		tmr_cnt[t->lvl]--;
+	fd_list_unlink(&t->chain);
+}
+
+/* Check if no timer is armed. Called with the lock */
+static int tmr_empty(void)
+{
+	int l;
+	for (l = 0; l < TMR_LVLS; l++) {
+		if (tmr_cnt[l])
+			return 0;
+	}
+	return FD_IS_LIST_EMPTY(&tmr_expired);
+}
+
+/* Spread the timers of the current slot of level l in the lower levels, and return the index of this slot */
+static int tmr_cascade(int l)
+{
+	int idx = (tmr_now >> LVL_SHIFT(l)) & (LVL_SLOTS(l) - 1);
+	struct fd_list spread = FD_LIST_INITIALIZER(spread);
+	
+	fd_list_move_end(&spread, &tmr_wheel[l][idx]);
+	while (!FD_IS_LIST_EMPTY(&spread)) {
+		struct fd_timer * t = spread.next->o;
+		fd_list_unlink(&t->chain);
+		tmr_cnt[l]--;
+		tmr_link(t);
+	}
+	
+	return idx;
+}
+
+/* Process the slots until the tick target (included): the timers found there are moved to tmr_expired */
+static void tmr_advance(uint64_t target)
+{
+	while (tmr_now <= target) {
+		int idx = tmr_now & (LVL_SLOTS(0) - 1);
+		int l;
+		
+		if (!idx) {
+			for (l = 1; l < TMR_LVLS; l++) {
+				if (tmr_cascade(l))
+					break;
+			}
+		}
+		
+		while (!FD_IS_LIST_EMPTY(&tmr_wheel[0][idx])) {
+			struct fd_timer * t = tmr_wheel[0][idx].next->o;
+			fd_list_unlink(&t->chain);
+			fd_list_insert_before(&tmr_expired, &t->chain);
+			t->lvl = -1;
+			tmr_cnt[0]--;
+		}
+		
+		tmr_now++;
+		
+		/* When the level 0 is empty, skip to the next cascade */
+		if (!tmr_cnt[0] && (tmr_now & (LVL_SLOTS(0) - 1))) {
+			uint64_t next = (tmr_now | (LVL_SLOTS(0) - 1)) + 1;
+			tmr_now = (next <= target) ? next : target + 1;
+		}
+	}
+}
+
+/* Compute the next tick when the thread must process the wheel. A timer of an upper level may expire before the
+ timers of the level 0 (it was linked when tmr_now was earlier), so its cascade may come first. */
+static uint64_t tmr_next(void)
+{
+	uint64_t next = TMR_NEVER;
+	int l, m;
+	
+	if (tmr_cnt[0]) {
+		for (m = 0; m < LVL_SLOTS(0); m++) {
+			if (!FD_IS_LIST_EMPTY(&tmr_wheel[0][(tmr_now + m) & (LVL_SLOTS(0) - 1)])) {
+				next = tmr_now + m;
+				break;
+			}
+		}
+	}
+	
+	for (l = 1; l < TMR_LVLS; l++) {
+		uint64_t blk = tmr_now >> LVL_SHIFT(l);
+		
+		if (!tmr_cnt[l])
+			continue;
+		
+		/* The current slot is still to spread only if we are at its beginning */
+		for (m = (tmr_now & (((uint64_t)1 << LVL_SHIFT(l)) - 1)) ? 1 : 0; m <= LVL_SLOTS(l); m++) {
+			if (!FD_IS_LIST_EMPTY(&tmr_wheel[l][(blk + m) & (LVL_SLOTS(l) - 1)])) {
+				if (((blk + m) << LVL_SHIFT(l)) < next)
+					next = (blk + m) << LVL_SHIFT(l);
+				break;
+			}
+		}
+	}
+	
+	return next;
+}
+
+/* Call the callback of an expired timer, without the lock. The thread cannot be canceled in the middle of a callback. Called with the lock */
+static void tmr_call(struct fd_timer * t, struct fd_timer ** running)
+{
+	int state;
+	
+	fd_list_unlink(&t->chain);
+	*running = t;
+	CHECK_POSIX_DO( pthread_mutex_unlock(&tmr_mtx), { ASSERT(0); } );
+	
+	CHECK_POSIX_DO( pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &state), /* continue */ );
+	TRACE_DEBUG(ANNOYING, "Calling timer callback %p(%p)", t->cb, t->data);
+	(*t->cb)(t->data);
+	CHECK_POSIX_DO( pthread_setcancelstate(state, NULL), /* continue */ );
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&tmr_mtx), { ASSERT(0); } );
+	*running = NULL;
+	CHECK_POSIX_DO( pthread_cond_broadcast(&tmr_done), /* continue */ );
+}
+
+/* The second thread, that calls the callbacks of the FD_TIMER_BLOCKING timers */
+static void * tmr_slow_th(void * arg)
+{
+	fd_log_threadname ( "Timers (blocking)" );
+	TRACE_ENTRY( "%p", arg );
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&tmr_mtx), { ASSERT(0); } );
+	pthread_cleanup_push( fd_cleanup_mutex, &tmr_mtx );
+	
+	if (tmr_hook)
+		tmr_slow_hook_new = 1;
+	
+	do {
+		if (tmr_slow_hook_new) {
+			tmr_slow_hook_new = 0;
+			(*tmr_hook)();
+		}
+		
+		if (FD_IS_LIST_EMPTY(&tmr_slow)) {
+			CHECK_POSIX_DO( pthread_cond_wait( &tmr_slow_cnd, &tmr_mtx ), { ASSERT(0); } );
+			continue;
+		}
+		
+		tmr_call(tmr_slow.next->o, &tmr_slow_running);
+	} while (1);
+	
+	pthread_cleanup_pop( 1 );
+	return NULL;
+}
+
+/* The thread that processes the wheel and calls the callbacks */
+static void * tmr_th(void * arg)
+{
+	fd_log_threadname ( "Timers" );
+	TRACE_ENTRY( "%p", arg );
+	
+	CHECK_POSIX_DO( pthread_mutex_lock(&tmr_mtx), { ASSERT(0); } );
+	pthread_cleanup_push( fd_cleanup_mutex, &tmr_mtx );
+	
+	if (tmr_hook)
+		tmr_hook_new = 1;
+	
+	do {
+		struct timespec	ts;
+		
+		if (tmr_hook_new) {
+			tmr_hook_new = 0;
+			(*tmr_hook)();
+		}
+		
+		CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &ts), { ASSERT(0); } );
+		tmr_advance(TS_TICK(&ts));
+		
+		if (FD_IS_LIST_EMPTY(&tmr_expired)) {
+			/* Sleep until the next slot to process, or until a timer is armed before that */
+			tmr_wake = tmr_next();
+			if (tmr_wake == TMR_NEVER) {
+				CHECK_POSIX_DO( pthread_cond_wait( &tmr_cnd, &tmr_mtx ), { ASSERT(0); } );
+			} else {
+				ts.tv_sec  = tmr_wake / 1000;
+				ts.tv_nsec = (tmr_wake % 1000) * 1000000;
+				CHECK_POSIX_DO2(  pthread_cond_timedwait( &tmr_cnd, &tmr_mtx, &ts ),  
+						ETIMEDOUT, /* ETIMEDOUT is a normal return value, continue */,
+						/* on other error, */ { ASSERT(0); } );
+			}
+			tmr_wake = 0;
+			continue;
+		}
+		
+		while (!FD_IS_LIST_EMPTY(&tmr_expired)) {
+			struct fd_timer * t = tmr_expired.next->o;
+			
+			if ((t->flags & FD_TIMER_BLOCKING) && (tmr_slow_thr == (pthread_t)NULL)) {
+				CHECK_POSIX_DO( pthread_create(&tmr_slow_thr, NULL, tmr_slow_th, NULL), tmr_slow_thr = (pthread_t)NULL );
+			}
+			
+			/* Pass it to the second thread, or call it here if this thread could not be created */
+			if ((t->flags & FD_TIMER_BLOCKING) && (tmr_slow_thr != (pthread_t)NULL)) {
+				fd_list_unlink(&t->chain);
+				fd_list_insert_before(&tmr_slow, &t->chain);
+				CHECK_POSIX_DO( pthread_cond_signal(&tmr_slow_cnd), /* continue */ );
+			} else {
+				tmr_call(t, &tmr_running);
+			}
+		}
+	} while (1);
+	
+	pthread_cleanup_pop( 1 );
+	return NULL;
+}
+
+/********************************************************************************************************/
+
+/* Initialize the wheel */
+int fd_timers_init(void)
+{
+	int l, i;
+	
+	for (l = 0; l < TMR_LVLS; l++)
+		for (i = 0; i < LVL_SLOTS(l); i++)
+			fd_list_init(&tmr_wheel[l][i], NULL);
+	
+	return 0;
+}
+
+/* Stop the threads. The timers still armed do not expire anymore, unless a timer is armed again */
+void fd_timers_fini(void)
+{
+	CHECK_FCT_DO( fd_thr_term(&tmr_thr), /* continue */ );
+	CHECK_FCT_DO( fd_thr_term(&tmr_slow_thr), /* continue */ );
+}
+
+/* Register the function called in the thread of the timers */
+int fd_timers_thr_hook ( void (*hook)(void) )
+{
+	TRACE_ENTRY("%p", hook);
+	
+	CHECK_POSIX( pthread_mutex_lock(&tmr_mtx) );
+	tmr_hook = hook;
+	tmr_hook_new = tmr_slow_hook_new = hook ? 1 : 0;
+	/* If the threads are sleeping, wake them up so that the hook is called now */
+	if (hook && tmr_wake) {
+		CHECK_POSIX_DO( pthread_cond_signal(&tmr_cnd), /* continue */ );
+	}
+	if (hook && (tmr_slow_thr != (pthread_t)NULL)) {
+		CHECK_POSIX_DO( pthread_cond_signal(&tmr_slow_cnd), /* continue */ );
+	}
+	CHECK_POSIX( pthread_mutex_unlock(&tmr_mtx) );
+	
+	return 0;
+}
+
+/* Initialize a timer */
+void fd_timer_init ( struct fd_timer * timer, void (*cb)(void *), void * data, int flags )
+{
+	TRACE_ENTRY("%p %p %p %x", timer, cb, data, flags);
+	memset(timer, 0, sizeof(struct fd_timer));
+	fd_list_init(&timer->chain, timer);
+	timer->lvl = -1;
+	timer->flags = flags;
+	timer->cb = cb;
+	timer->data = data;
+}
+
+/* Arm or move a timer */
+int fd_timer_arm ( struct fd_timer * timer, const struct timespec * abstime )
+{
+	int ret = 0;
+	
+	TRACE_ENTRY("%p %p", timer, abstime);
+	CHECK_PARAMS( timer && timer->cb && abstime );
+	
+	CHECK_POSIX( pthread_mutex_lock(&tmr_mtx) );
+	
+	tmr_unlink(timer);
+	
+	/* When the wheel is empty, it may not have been processed for a while: start from now */
+	if (tmr_empty()) {
+		struct timespec now;
+		CHECK_SYS_DO( clock_gettime(CLOCK_REALTIME, &now), { ret = errno; goto out; } );
+		if (TS_TICK(&now) > tmr_now)
+			tmr_now = TS_TICK(&now);
+	}
+	
+	/* Round up, the timer must not expire before abstime */
+	timer->tick = (uint64_t)abstime->tv_sec * 1000 + (abstime->tv_nsec + 999999) / 1000000;
+	tmr_link(timer);
+	
+	if (tmr_thr == (pthread_t)NULL) {
+		CHECK_POSIX_DO( ret = pthread_create(&tmr_thr, NULL, tmr_th, NULL), tmr_unlink(timer) );
+	} else if (tmr_wake && (timer->tick < tmr_wake)) {
+		/* The thread is sleeping longer than this timer */
+		CHECK_POSIX_DO( ret = pthread_cond_signal(&tmr_cnd), /* unlock below */ );
+	}
+out:	
+	CHECK_POSIX( pthread_mutex_unlock(&tmr_mtx) );
+	return ret;
+}
+
+/* Disarm a timer, and wait for its callback to complete */
+int fd_timer_cancel ( struct fd_timer * timer )
+{
+	TRACE_ENTRY("%p", timer);
+	CHECK_PARAMS( timer && timer->cb );
+	
+	CHECK_POSIX( pthread_mutex_lock(&tmr_mtx) );
+	pthread_cleanup_push( fd_cleanup_mutex, &tmr_mtx );
+	
+	/* Wait first, the callback may arm the timer again. Not in the callbacks, the threads would wait for each other */
+	if (!pthread_equal(pthread_self(), tmr_thr) && !pthread_equal(pthread_self(), tmr_slow_thr)) {
+		while ((tmr_running == timer) || (tmr_slow_running == timer)) {
+			CHECK_POSIX_DO( pthread_cond_wait(&tmr_done, &tmr_mtx), break );
+		}
+	}
+	
+	tmr_unlink(timer);
+	
+	pthread_cleanup_pop( 0 );
+	CHECK_POSIX( pthread_mutex_unlock(&tmr_mtx) );
+	return 0;
+}
@@ -561,6 +561,24 @@ static void * handshake_thr(void * arg)
 	return NULL;
 }
 
+/* Result of a handshake performed by the pool */
+struct hs_wait {
+	pthread_mutex_t	lock;
+	pthread_cond_t	cond;
+	int		done;
+	int		ret;
+};
+
+static void hs_wait_cb(struct cnxctx * conn, int ret, void * data)
+{
+	struct hs_wait * hw = data;
+	CHECK( 0, pthread_mutex_lock(&hw->lock) );
+	hw->ret = ret;
+	hw->done = 1;
+	CHECK( 0, pthread_cond_signal(&hw->cond) );
+	CHECK( 0, pthread_mutex_unlock(&hw->lock) );
+}
+
 /* Terminate the client's connection side */
 static void * destroy_thr(void * arg)
 {
@@ -756,10 +774,191 @@ int main(int argc, char *argv[])
 		CHECK( 0, memcmp( rcv_buf, cer_buf, cer_sz ) );
 		free(rcv_buf);
 		
+		/* Several messages received at once */
+		{
+			uint8_t * many, * big;
+			size_t big_sz = 65535; /* the biggest message accepted */
+			unsigned long long msgs, calls, msgs2, calls2;
+			int i;
+			
+			CHECK( 1, (many = malloc(20 * cer_sz)) ? 1 : 0 );
+			for (i = 0; i < 20; i++)
+				memcpy(many + i * cer_sz, cer_buf, cer_sz);
+			CHECK( 0, fd_cnx_send(client_side, many, 20 * cer_sz));
+			CHECK( 0, fd_cnx_rcv_stats(server_side, &msgs, &calls) );
+			
+			/* The data is already waiting in the socket */
+			CHECK( 0, fd_cnx_start_clear(server_side, 1) );
+			for (i = 0; i < 20; i++) {
+				CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+				CHECK( cer_sz, rcv_sz );
+				CHECK( 0, memcmp( rcv_buf, cer_buf, cer_sz ) );
+				free(rcv_buf);
+			}
+			CHECK( 0, fd_cnx_rcv_stats(server_side, &msgs2, &calls2) );
+			CHECK( 20, msgs2 - msgs );
+			CHECK( 1, (calls2 - calls < 20) ? 1 : 0 );
+			free(many);
+			
+			/* A big message, that does not fit in the receive buffer after the previous one */
+			CHECK( 1, (big = malloc(big_sz)) ? 1 : 0 );
+			for (i = 0; i < big_sz; i++)
+				big[i] = (uint8_t)i;
+			big[0] = DIAMETER_VERSION;
+			big[1] = (big_sz >> 16) & 0xff;
+			big[2] = (big_sz >> 8) & 0xff;
+			big[3] = big_sz & 0xff;
+			CHECK( 0, fd_cnx_send(client_side, cer_buf, cer_sz));
+			CHECK( 0, fd_cnx_send(client_side, big, big_sz));
+			CHECK( 0, fd_cnx_send(client_side, cer_buf, cer_sz));
+			CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( cer_sz, rcv_sz );
+			free(rcv_buf);
+			CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( big_sz, rcv_sz );
+			CHECK( 0, memcmp( rcv_buf, big, big_sz ) );
+			free(rcv_buf);
+			CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( cer_sz, rcv_sz );
+			CHECK( 0, memcmp( rcv_buf, cer_buf, cer_sz ) );
+			free(rcv_buf);
+			free(big);
+		}
+		
+		/* Pause the reception */
+		{
+			struct timespec ts;
+			int pending = 0;
+			
+			fd_cnx_recv_pause(server_side, 1);
+			
+			/* The receiver thread may already be waiting for this one, or not */
+			CHECK( 0, fd_cnx_send(client_side, cer_buf, cer_sz));
+			CHECK( 0, clock_gettime(CLOCK_REALTIME, &ts) );
+			ts.tv_nsec += 300000000;
+			if (ts.tv_nsec >= 1000000000) {
+				ts.tv_nsec -= 1000000000;
+				ts.tv_sec += 1;
+			}
+			ret = fd_cnx_receive(server_side, &ts, &rcv_buf, &rcv_sz);
+			if (ret == ETIMEDOUT) {
+				pending++;
+			} else {
+				CHECK( 0, ret );
+				CHECK( cer_sz, rcv_sz );
+				free(rcv_buf);
+			}
+			
+			/* But the receiver is now waiting for the resume before reading the next one */
+			CHECK( 0, fd_cnx_send(client_side, cer_buf, cer_sz));
+			pending++;
+			CHECK( 0, clock_gettime(CLOCK_REALTIME, &ts) );
+			ts.tv_nsec += 300000000;
+			if (ts.tv_nsec >= 1000000000) {
+				ts.tv_nsec -= 1000000000;
+				ts.tv_sec += 1;
+			}
+			CHECK( ETIMEDOUT, fd_cnx_receive(server_side, &ts, &rcv_buf, &rcv_sz));
+			
+			/* They are received once resumed */
+			fd_cnx_recv_pause(server_side, 0);
+			while (pending--) {
+				CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+				CHECK( cer_sz, rcv_sz );
+				CHECK( 0, memcmp( rcv_buf, cer_buf, cer_sz ) );
+				free(rcv_buf);
+			}
+			
+			/* The connection can be destroyed while paused */
+			fd_cnx_recv_pause(server_side, 1);
+		}
+		
 		/* Now close the connections */
 		fd_cnx_destroy(client_side);
 		fd_cnx_destroy(server_side);
 	}
+	
+#ifdef USE_IO_URING
+	/* Same with the io_uring backend */
+	{
+		struct connect_flags cf;
+		struct iovec iov[20];
+		unsigned long long msgs, calls;
+		int i;
+		
+		fd_g_config->cnf_flags.io_uring = 1;
+		CHECK( 0, fd_uring_init() );
+		
+		memset(&cf, 0, sizeof(cf));
+		cf.proto = IPPROTO_TCP;
+		
+		/* Start the client thread */
+		CHECK( 0, pthread_create(&thr, NULL, connect_thr, &cf) );
+
+		/* Accept the connection of the client */
+		server_side = fd_cnx_serv_accept(listener);
+		CHECK( 1, server_side ? 1 : 0 );
+		CHECK( 0, fd_cnx_start_clear(server_side, 1) );
+		
+		/* Retrieve the client connection object */
+		CHECK( 0, pthread_join( thr, (void *)&client_side ) );
+		CHECK( 1, client_side ? 1 : 0 );
+		CHECK( 0, fd_cnx_start_clear(client_side, 1) );
+		
+		/* Send a message and receive it */
+		CHECK( 0, fd_cnx_send(server_side, cer_buf, cer_sz));
+		CHECK( 0, fd_cnx_receive(client_side, NULL, &rcv_buf, &rcv_sz));
+		CHECK( cer_sz, rcv_sz );
+		CHECK( 0, memcmp( rcv_buf, cer_buf, cer_sz ) );
+		free(rcv_buf);
+		
+		/* Several messages sent at once in the other direction */
+		for (i = 0; i < 20; i++) {
+			iov[i].iov_base = cer_buf;
+			iov[i].iov_len = cer_sz;
+		}
+		CHECK( 0, fd_cnx_send_batch(client_side, iov, 20));
+		for (i = 0; i < 20; i++) {
+			CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( cer_sz, rcv_sz );
+			CHECK( 0, memcmp( rcv_buf, cer_buf, cer_sz ) );
+			free(rcv_buf);
+		}
+		CHECK( 0, fd_cnx_rcv_stats(server_side, &msgs, &calls) );
+		CHECK( 20, msgs );
+		CHECK( 1, ((calls > 0) && (calls <= 20)) ? 1 : 0 );
+		
+		/* A message received in several buffers */
+		{
+			uint8_t * big;
+			size_t big_sz = 65535;
+			CHECK( 1, (big = malloc(big_sz)) ? 1 : 0 );
+			for (i = 0; i < big_sz; i++)
+				big[i] = (uint8_t)i;
+			big[0] = DIAMETER_VERSION;
+			big[1] = (big_sz >> 16) & 0xff;
+			big[2] = (big_sz >> 8) & 0xff;
+			big[3] = big_sz & 0xff;
+			CHECK( 0, fd_cnx_send(client_side, big, big_sz));
+			CHECK( 0, fd_cnx_send(client_side, cer_buf, cer_sz));
+			CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( big_sz, rcv_sz );
+			CHECK( 0, memcmp( rcv_buf, big, big_sz ) );
+			free(rcv_buf);
+			CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( cer_sz, rcv_sz );
+			free(rcv_buf);
+			free(big);
+		}
+		
+		/* Now close the connections */
+		fd_cnx_destroy(client_side);
+		fd_cnx_destroy(server_side);
+		
+		fd_uring_fini();
+		fd_g_config->cnf_flags.io_uring = 0;
+	}
+#endif /* USE_IO_URING */
 		
 #ifndef DISABLE_SCTP
 	/* Simple SCTP client / server test (no TLS) */
@@ -1046,6 +1245,193 @@ int main(int argc, char *argv[])
 		gnutls_certificate_free_credentials(hf.creds);
 	}
 	
+	/* TLS session resumption across reconnections (TLS 1.3, then TLS 1.2) */
+	{
+		struct connect_flags cf;
+		struct handshake_flags hf;
+		struct fd_tls_resume_stats before, after;
+		char * prio[] = { NULL, NULL, "NORMAL:-VERS-TLS1.3", "NORMAL:-VERS-TLS1.3" };
+		int resumed[] = { 0, 1, 0, 1 };
+		int r;
+		
+		memset(&cf, 0, sizeof(cf));
+		cf.proto = IPPROTO_TCP;
+		
+		memset(&hf, 0, sizeof(hf));
+		
+		/* Initialize remote certificate */
+		CHECK_GNUTLS_DO( ret = gnutls_certificate_allocate_credentials (&hf.creds), );
+		CHECK( GNUTLS_E_SUCCESS, ret );
+		/* Set the CA */
+		CHECK_GNUTLS_DO( ret = gnutls_certificate_set_x509_trust_mem( hf.creds, &ca, GNUTLS_X509_FMT_PEM), );
+		CHECK( 1, ret );
+		/* Set the key */
+		CHECK_GNUTLS_DO( ret = gnutls_certificate_set_x509_key_mem( hf.creds, &client_cert, &client_priv, GNUTLS_X509_FMT_PEM), );
+		CHECK( GNUTLS_E_SUCCESS, ret );
+		
+		for (r = 0; r < sizeof(resumed) / sizeof(resumed[0]); r++) {
+			fd_tls_resume_getstats(&before);
+			
+			/* Start the client thread */
+			CHECK( 0, pthread_create(&thr, NULL, connect_thr, &cf) );
+
+			/* Accept the connection of the client */
+			server_side = fd_cnx_serv_accept(listener);
+			CHECK( 1, server_side ? 1 : 0 );
+
+			/* Retrieve the client connection object */
+			CHECK( 0, pthread_join( thr, (void *)&client_side ) );
+			CHECK( 1, client_side ? 1 : 0 );
+			hf.cnx = client_side;
+			
+			/* The client caches the sessions by peer */
+			fd_cnx_sethostname(client_side, "serv.test");
+
+			/* Start the handshake directly */
+			CHECK( 0, pthread_create(&thr, NULL, handshake_thr, &hf) );
+			CHECK( 0, fd_cnx_handshake(server_side, GNUTLS_SERVER, ALGO_HANDSHAKE_DEFAULT, prio[r], NULL) );
+			CHECK( 0, pthread_join(thr, NULL) );
+			CHECK( 0, hf.ret );
+			
+			/* Exchange a message, so that the client receives the TLS 1.3 ticket */
+			CHECK( 0, fd_cnx_send(server_side, cer_buf, cer_sz));
+			CHECK( 0, fd_cnx_receive(client_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( cer_sz, rcv_sz );
+			free(rcv_buf);
+			CHECK( 0, fd_cnx_send(client_side, cer_buf, cer_sz));
+			CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( cer_sz, rcv_sz );
+			free(rcv_buf);
+			
+			fd_tls_resume_getstats(&after);
+			CHECK( before.srv_hits + resumed[r], after.srv_hits );
+			CHECK( before.cli_hits + resumed[r], after.cli_hits );
+			CHECK( before.srv_misses + 1 - resumed[r], after.srv_misses );
+			CHECK( before.cli_misses + 1 - resumed[r], after.cli_misses );
+
+			/* Now close the connection */
+			CHECK( 0, pthread_create(&thr, NULL, destroy_thr, client_side) );
+			fd_cnx_destroy(server_side);
+			CHECK( 0, pthread_join(thr, NULL) );
+		}
+		
+		/* Free the credentials */
+		gnutls_certificate_free_keys(hf.creds);
+		gnutls_certificate_free_cas(hf.creds);
+		gnutls_certificate_free_credentials(hf.creds);
+	}
+	
+	/* TLS handshakes performed by the pool of threads */
+	if (fd_tls_hs_init() == 0) {
+		struct connect_flags cf;
+		struct handshake_flags hf;
+		struct fd_tls_hs_stats before, after;
+		struct hs_wait hw;
+		struct cnxctx * idle_server, * idle_client;
+		
+		memset(&cf, 0, sizeof(cf));
+		cf.proto = IPPROTO_TCP;
+		
+		memset(&hf, 0, sizeof(hf));
+		
+		/* Initialize remote certificate */
+		CHECK_GNUTLS_DO( ret = gnutls_certificate_allocate_credentials (&hf.creds), );
+		CHECK( GNUTLS_E_SUCCESS, ret );
+		/* Set the CA */
+		CHECK_GNUTLS_DO( ret = gnutls_certificate_set_x509_trust_mem( hf.creds, &ca, GNUTLS_X509_FMT_PEM), );
+		CHECK( 1, ret );
+		/* Set the key */
+		CHECK_GNUTLS_DO( ret = gnutls_certificate_set_x509_key_mem( hf.creds, &client_cert, &client_priv, GNUTLS_X509_FMT_PEM), );
+		CHECK( GNUTLS_E_SUCCESS, ret );
+		
+		fd_tls_hs_getstats(&before);
+		
+		/* Both sides of the handshake go through the pool */
+		CHECK( 0, pthread_create(&thr, NULL, connect_thr, &cf) );
+		server_side = fd_cnx_serv_accept(listener);
+		CHECK( 1, server_side ? 1 : 0 );
+		CHECK( 0, pthread_join( thr, (void *)&client_side ) );
+		CHECK( 1, client_side ? 1 : 0 );
+		hf.cnx = client_side;
+		
+		CHECK( 0, pthread_create(&thr, NULL, handshake_thr, &hf) );
+		CHECK( 0, fd_cnx_handshake(server_side, GNUTLS_SERVER, ALGO_HANDSHAKE_DEFAULT, NULL, NULL) );
+		CHECK( 0, pthread_join(thr, NULL) );
+		CHECK( 0, hf.ret );
+		
+		/* The connection is usable afterwards */
+		for (i = 0; i < 2 * NB_STREAMS; i++) {
+			CHECK( 0, fd_cnx_send(server_side, cer_buf, cer_sz));
+			CHECK( 0, fd_cnx_receive(client_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( cer_sz, rcv_sz );
+			CHECK( 0, memcmp( rcv_buf, cer_buf, cer_sz ) );
+			free(rcv_buf);
+
+			CHECK( 0, fd_cnx_send(client_side, cer_buf, cer_sz));
+			CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz));
+			CHECK( cer_sz, rcv_sz );
+			CHECK( 0, memcmp( rcv_buf, cer_buf, cer_sz ) );
+			free(rcv_buf);
+		}
+		
+		CHECK( 0, pthread_create(&thr, NULL, destroy_thr, client_side) );
+		fd_cnx_destroy(server_side);
+		CHECK( 0, pthread_join(thr, NULL) );
+		
+		fd_tls_hs_getstats(&after);
+		CHECK( before.started + 2, after.started );
+		CHECK( before.succeeded + 2, after.succeeded );
+		CHECK( 0, after.active );
+		
+		/* Admission control: a client that does not send its Hello holds the only slot */
+		fd_g_config->cnf_hs_max = 1;
+		memset(&hw, 0, sizeof(hw));
+		CHECK( 0, pthread_mutex_init(&hw.lock, NULL) );
+		CHECK( 0, pthread_cond_init(&hw.cond, NULL) );
+		
+		CHECK( 0, pthread_create(&thr, NULL, connect_thr, &cf) );
+		idle_server = fd_cnx_serv_accept(listener);
+		CHECK( 1, idle_server ? 1 : 0 );
+		CHECK( 0, pthread_join( thr, (void *)&idle_client ) );
+		CHECK( 1, idle_client ? 1 : 0 );
+		CHECK( 0, fd_cnx_handshake_async(idle_server, GNUTLS_SERVER, ALGO_HANDSHAKE_DEFAULT, NULL, NULL, hs_wait_cb, &hw) );
+		
+		CHECK( 0, pthread_create(&thr, NULL, connect_thr, &cf) );
+		server_side = fd_cnx_serv_accept(listener);
+		CHECK( 1, server_side ? 1 : 0 );
+		CHECK( 0, pthread_join( thr, (void *)&client_side ) );
+		CHECK( 1, client_side ? 1 : 0 );
+		CHECK( EBUSY, fd_cnx_handshake_async(server_side, GNUTLS_SERVER, ALGO_HANDSHAKE_DEFAULT, NULL, NULL, hs_wait_cb, &hw) );
+		fd_cnx_destroy(client_side);
+		fd_cnx_destroy(server_side);
+		
+		/* The handshake fails when the client goes away */
+		fd_cnx_destroy(idle_client);
+		CHECK( 0, pthread_mutex_lock(&hw.lock) );
+		while (!hw.done) {
+			CHECK( 0, pthread_cond_wait(&hw.cond, &hw.lock) );
+		}
+		CHECK( 0, pthread_mutex_unlock(&hw.lock) );
+		CHECK( EINVAL, hw.ret );
+		fd_cnx_destroy(idle_server);
+		
+		fd_tls_hs_getstats(&after);
+		CHECK( before.started + 3, after.started );
+		CHECK( before.failed + 1, after.failed );
+		CHECK( before.rejected + 1, after.rejected );
+		CHECK( 0, after.active );
+		
+		fd_g_config->cnf_hs_max = 256;
+		CHECK( 0, pthread_cond_destroy(&hw.cond) );
+		CHECK( 0, pthread_mutex_destroy(&hw.lock) );
+		fd_tls_hs_fini();
+		
+		/* Free the credentials */
+		gnutls_certificate_free_keys(hf.creds);
+		gnutls_certificate_free_cas(hf.creds);
+		gnutls_certificate_free_credentials(hf.creds);
+	}
+	
 #ifndef DISABLE_SCTP
 	
 	
@@ -0,0 +1,215 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+#include "tests.h"
+
+/* Loopback benchmark of the TCP connections in clear, with the receiver threads and with the io_uring backend if available. */
+
+#ifndef TEST_PORT
+#define TEST_PORT	3869
+#endif /* TEST_PORT */
+
+/* The number of messages sent in each test */
+#define DEFAULT_NUMBER_OF_SAMPLES	100000
+
+/* The size of the messages */
+#define MSG_SIZE	512
+
+/* The number of messages the sender passes at once, as the out thread of the peers */
+#define BATCH_SIZE	16
+
+static struct fd_list eps = FD_LIST_INITIALIZER(eps);
+static struct cnxctx * listener = NULL;
+static uint8_t msg_buf[MSG_SIZE];
+
+static void display_result(int nr, struct timespec * start, struct timespec * end, char * fct, char * type, char *op)
+{
+	long double dur = (long double)end->tv_sec + (long double)end->tv_nsec/1000000000;
+	dur -= (long double)start->tv_sec + (long double)start->tv_nsec/1000000000;
+	long double thrp = (long double)nr / dur;
+	printf("%-19s: %d %-8s %-7s in %.6LFs (%.1LFmsg/s)\n", fct, nr, type, op, dur, thrp);
+}
+
+static void * connect_thr(void * arg)
+{
+	struct fd_endpoint * ep = (struct fd_endpoint *)(eps.next);
+	fd_log_threadname ( "testcnx_stress:connect" );
+	return fd_cnx_cli_connect_tcp( &ep->sa, sSAlen(&ep->ss) );
+}
+
+/* Send test_parameter messages in batches */
+static void * send_thr(void * arg)
+{
+	struct cnxctx * cnx = arg;
+	struct iovec iov[BATCH_SIZE];
+	int i, sent = 0;
+	
+	fd_log_threadname ( "testcnx_stress:send" );
+	
+	for (i = 0; i < BATCH_SIZE; i++) {
+		iov[i].iov_base = msg_buf;
+		iov[i].iov_len = sizeof(msg_buf);
+	}
+	while (sent < test_parameter) {
+		int nb = test_parameter - sent;
+		if (nb > BATCH_SIZE)
+			nb = BATCH_SIZE;
+		CHECK( 0, fd_cnx_send_batch(cnx, iov, nb) );
+		sent += nb;
+	}
+	return NULL;
+}
+
+/* Send back the messages received */
+static void * echo_thr(void * arg)
+{
+	struct cnxctx * cnx = arg;
+	uint8_t * rcv_buf;
+	size_t rcv_sz;
+	int i;
+	
+	fd_log_threadname ( "testcnx_stress:echo" );
+	
+	for (i = 0; i < test_parameter / 10; i++) {
+		CHECK( 0, fd_cnx_receive(cnx, NULL, &rcv_buf, &rcv_sz) );
+		CHECK( 0, fd_cnx_send(cnx, rcv_buf, rcv_sz) );
+		free(rcv_buf);
+	}
+	return NULL;
+}
+
+/* Run the tests on a new connection */
+static void run_bench(char * name)
+{
+	struct cnxctx * client_side, * server_side;
+	struct timespec start, end;
+	pthread_t thr;
+	uint8_t * rcv_buf;
+	size_t rcv_sz;
+	char title[32];
+	int i;
+	
+	/* Establish the connection */
+	CHECK( 0, pthread_create(&thr, NULL, connect_thr, NULL) );
+	server_side = fd_cnx_serv_accept(listener);
+	CHECK( 1, server_side ? 1 : 0 );
+	CHECK( 0, pthread_join( thr, (void *)&client_side ) );
+	CHECK( 1, client_side ? 1 : 0 );
+	CHECK( 0, fd_cnx_start_clear(server_side, 1) );
+	CHECK( 0, fd_cnx_start_clear(client_side, 1) );
+	
+	/* Throughput in one direction */
+	CHECK( 0, clock_gettime(CLOCK_REALTIME, &start) );
+	CHECK( 0, pthread_create(&thr, NULL, send_thr, client_side) );
+	for (i = 0; i < test_parameter; i++) {
+		CHECK( 0, fd_cnx_receive(server_side, NULL, &rcv_buf, &rcv_sz) );
+		CHECK( sizeof(msg_buf), rcv_sz );
+		free(rcv_buf);
+	}
+	CHECK( 0, pthread_join( thr, NULL ) );
+	CHECK( 0, clock_gettime(CLOCK_REALTIME, &end) );
+	snprintf(title, sizeof(title), "%s (stream)", name);
+	display_result(test_parameter, &start, &end, title, "messages", "received");
+	
+	/* Round trips, one message at a time */
+	CHECK( 0, clock_gettime(CLOCK_REALTIME, &start) );
+	CHECK( 0, pthread_create(&thr, NULL, echo_thr, server_side) );
+	for (i = 0; i < test_parameter / 10; i++) {
+		CHECK( 0, fd_cnx_send(client_side, msg_buf, sizeof(msg_buf)) );
+		CHECK( 0, fd_cnx_receive(client_side, NULL, &rcv_buf, &rcv_sz) );
+		CHECK( sizeof(msg_buf), rcv_sz );
+		free(rcv_buf);
+	}
+	CHECK( 0, pthread_join( thr, NULL ) );
+	CHECK( 0, clock_gettime(CLOCK_REALTIME, &end) );
+	snprintf(title, sizeof(title), "%s (echo)", name);
+	display_result(test_parameter / 10, &start, &end, title, "messages", "echoed");
+	
+	fd_cnx_destroy(client_side);
+	fd_cnx_destroy(server_side);
+}
+
+/* Main test routine */
+int main(int argc, char *argv[])
+{
+	test_parameter = DEFAULT_NUMBER_OF_SAMPLES;
+	
+	/* First, initialize the daemon modules */
+	INIT_FD();
+	
+	/* The messages, only the header matters */
+	memset(msg_buf, 0, sizeof(msg_buf));
+	msg_buf[0] = DIAMETER_VERSION;
+	msg_buf[1] = (sizeof(msg_buf) >> 16) & 0xff;
+	msg_buf[2] = (sizeof(msg_buf) >> 8) & 0xff;
+	msg_buf[3] = sizeof(msg_buf) & 0xff;
+	
+	/* Loopback server */
+	{
+		struct addrinfo hints, *ai, *aip;
+		memset(&hints, 0, sizeof(hints));
+		hints.ai_flags  = AI_NUMERICSERV;
+		hints.ai_family = AF_INET;
+		CHECK( 0, getaddrinfo("localhost", _stringize(TEST_PORT), &hints, &ai) );
+		aip = ai;
+		while (aip) {
+			CHECK( 0, fd_ep_add_merge( &eps, aip->ai_addr, aip->ai_addrlen, EP_FL_DISC | EP_ACCEPTALL ));
+			aip = aip->ai_next;
+		};
+		freeaddrinfo(ai);
+		CHECK( 0, FD_IS_LIST_EMPTY(&eps) ? 1 : 0 );
+		
+		listener = fd_cnx_serv_tcp(TEST_PORT, 0, (struct fd_endpoint *)(eps.next));
+		CHECK( 1, listener ? 1 : 0 );
+		CHECK( 0, fd_cnx_serv_listen(listener));
+	}
+	
+	/* With the receiver threads */
+	run_bench("threads");
+	
+#ifdef USE_IO_URING
+	/* With io_uring */
+	fd_g_config->cnf_flags.io_uring = 1;
+	CHECK( 0, fd_uring_init() );
+	run_bench("io_uring");
+	fd_uring_fini();
+	fd_g_config->cnf_flags.io_uring = 0;
+#endif /* USE_IO_URING */
+	
+	fd_cnx_destroy(listener);
+	
+	/* That's all for the tests yet */
+	PASSTEST();
+}
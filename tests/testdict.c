@@ -205,6 +205,166 @@ int main(int argc, char *argv[])
 	
 	LOG_D( "Dictionary at the end of %s: %s", __FILE__, fd_dict_dump(FD_DUMP_TEST_PARAMS, fd_g_config->cnf_dict) ?: "error");
 	
+	/* Test bulk load */
+	{
+		struct dict_object * vnd = NULL, * typ = NULL, * obj = NULL;
+		struct dict_vendor_data vnd_data = { 73570, "Bulk test vendor" };
+		struct dict_type_data typ_data = { AVP_TYPE_UNSIGNED32, "Bulk test enum type" };
+		struct fd_list * li = NULL;
+		struct fd_list * sentinel = NULL;
+		char name[32];
+		uint32_t prev;
+		int i;
+		
+		CHECK( EINVAL, fd_dict_bulk_end(fd_g_config->cnf_dict) );
+		CHECK( 0, fd_dict_bulk_begin(fd_g_config->cnf_dict) );
+		CHECK( 0, fd_dict_bulk_begin(fd_g_config->cnf_dict) );
+		
+		CHECK( 0, fd_dict_new ( fd_g_config->cnf_dict, DICT_VENDOR, &vnd_data, NULL, &vnd ) );
+		CHECK( 0, fd_dict_new ( fd_g_config->cnf_dict, DICT_TYPE, &typ_data, NULL, &typ ) );
+		
+		/* Create the objects in an order different from the lists order */
+		for (i = 0; i < 100; i++) {
+			struct dict_avp_data avp_data = { 0, 73570, name, AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 };
+			struct dict_enumval_data enum_data = { name, { .u32 = 0 } };
+			avp_data.avp_code = (i * 37) % 100 + 1;
+			snprintf(name, sizeof(name), "Bulk-%03d", 99 - i);
+			CHECK( 0, fd_dict_new ( fd_g_config->cnf_dict, DICT_AVP, &avp_data, typ, NULL ) );
+			enum_data.enum_value.u32 = avp_data.avp_code;
+			CHECK( 0, fd_dict_new ( fd_g_config->cnf_dict, DICT_ENUMVAL, &enum_data, typ, NULL ) );
+		}
+		
+		/* Duplicates are detected, and searches work */
+		{
+			struct dict_avp_data avp_data = { 38, 73570, "Bulk-other", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 };
+			struct dict_avp_request req = { 73570, 0, "Bulk-042" };
+			CHECK( EEXIST, fd_dict_new ( fd_g_config->cnf_dict, DICT_AVP, &avp_data, typ, NULL ) );
+			CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME_AND_VENDOR, &req, &obj, ENOENT ) );
+			CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME_ALL_VENDORS, "Bulk-042", &obj, ENOENT ) );
+		}
+		
+		CHECK( 0, fd_dict_bulk_end(fd_g_config->cnf_dict) );
+		CHECK( 0, fd_dict_bulk_end(fd_g_config->cnf_dict) );
+		
+		/* Now the lists are ordered */
+		CHECK( 0, fd_dict_getlistof(AVP_BY_CODE, vnd, &sentinel));
+		prev = 0;
+		i = 0;
+		for (li = sentinel->next; li != sentinel; li = li->next) {
+			struct dict_avp_data data;
+			CHECK( 0, fd_dict_getval(li->o, &data) );
+			CHECK( 1, data.avp_code > prev ? 1 : 0 );
+			prev = data.avp_code;
+			i++;
+		}
+		CHECK( 100, i );
+		
+		CHECK( 0, fd_dict_getlistof(AVP_BY_NAME, vnd, &sentinel));
+		i = 0;
+		for (li = sentinel->next; li != sentinel; li = li->next) {
+			struct dict_avp_data data;
+			CHECK( 0, fd_dict_getval(li->o, &data) );
+			snprintf(name, sizeof(name), "Bulk-%03d", i);
+			CHECK( 0, strcmp(name, data.avp_name) );
+			i++;
+		}
+		CHECK( 100, i );
+		
+		CHECK( 0, fd_dict_getlistof(ENUMVAL_BY_VALUE, typ, &sentinel));
+		prev = 0;
+		for (li = sentinel->next; li != sentinel; li = li->next) {
+			struct dict_enumval_data data;
+			CHECK( 0, fd_dict_getval(li->o, &data) );
+			CHECK( 1, data.enum_value.u32 > prev ? 1 : 0 );
+			prev = data.enum_value.u32;
+		}
+		CHECK( 100, prev );
+	}
+	
+	/* Test the creation of objects from a table */
+	{
+		struct dict_object * obj = NULL, * typ = NULL;
+		struct fd_list * sentinel, * li;
+		int conflicts = -1;
+		int32_t prev;
+		struct dict_object_def defs[] = {
+			{ DICT_VENDOR, &(struct dict_vendor_data){ 73571, "Batch vendor" }, NULL },
+			{ DICT_TYPE, &(struct dict_type_data){ AVP_TYPE_INTEGER32, "Enumerated(Batch-Enum)", NULL, NULL, NULL }, NULL },
+			{ DICT_ENUMVAL, &(struct dict_enumval_data){ "THIRD", { .i32 = 3 } }, "Enumerated(Batch-Enum)" },
+			{ DICT_ENUMVAL, &(struct dict_enumval_data){ "FIRST", { .i32 = 1 } }, "Enumerated(Batch-Enum)" },
+			{ DICT_ENUMVAL, &(struct dict_enumval_data){ "SECOND", { .i32 = 2 } }, "Enumerated(Batch-Enum)" },
+			{ DICT_AVP, &(struct dict_avp_data){ 12, 73571, "Batch-Enum", AVP_FLAG_VENDOR | AVP_FLAG_MANDATORY, AVP_FLAG_VENDOR, AVP_TYPE_INTEGER32 }, "Enumerated(Batch-Enum)" },
+			{ DICT_AVP, &(struct dict_avp_data){ 11, 73571, "Batch-Plain", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+			{ DICT_AVP, &(struct dict_avp_data){ 10, 73571, "Batch-Octets", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_OCTETSTRING }, "UTF8String" },
+		};
+		struct dict_object_def bad_parent[] = {
+			{ DICT_AVP, &(struct dict_avp_data){ 20, 73571, "Batch-Bad-1", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+			{ DICT_ENUMVAL, &(struct dict_enumval_data){ "NONE", { .i32 = 0 } }, "Enumerated(Batch-Undefined)" },
+		};
+		struct dict_object_def bad_vendor[] = {
+			{ DICT_AVP, &(struct dict_avp_data){ 21, 73572, "Batch-Bad-2", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+		};
+		struct dict_object_def conflict[] = {
+			{ DICT_AVP, &(struct dict_avp_data){ 11, 73571, "Batch-Plain", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+			{ DICT_AVP, &(struct dict_avp_data){ 13, 73571, "Batch-Plain", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+			{ DICT_AVP, &(struct dict_avp_data){ 14, 73571, "Batch-Last", AVP_FLAG_VENDOR, AVP_FLAG_VENDOR, AVP_TYPE_UNSIGNED32 }, NULL },
+		};
+		
+		CHECK( 0, fd_dict_new_batch ( fd_g_config->cnf_dict, defs, sizeof(defs) / sizeof(defs[0]), NULL ) );
+		
+		/* The objects can be found */
+		{
+			struct dict_avp_request req = { 73571, 0, "Batch-Enum" };
+			struct dict_enumval_request ereq;
+			struct dict_avp_data data;
+			
+			CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME_AND_VENDOR, &req, &obj, ENOENT ) );
+			CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_TYPE, TYPE_OF_AVP, obj, &typ, ENOENT ) );
+			memset(&ereq, 0, sizeof(ereq));
+			ereq.type_obj = typ;
+			ereq.search.enum_name = "SECOND";
+			CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_ENUMVAL, ENUMVAL_BY_STRUCT, &ereq, &obj, ENOENT ) );
+			req.avp_name = "Batch-Octets";
+			CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME_AND_VENDOR, &req, &obj, ENOENT ) );
+			CHECK( 0, fd_dict_getval(obj, &data) );
+			CHECK( 10, data.avp_code );
+		}
+		
+		/* The lists are ordered */
+		CHECK( 0, fd_dict_getlistof(ENUMVAL_BY_VALUE, typ, &sentinel));
+		prev = 0;
+		for (li = sentinel->next; li != sentinel; li = li->next) {
+			struct dict_enumval_data data;
+			CHECK( 0, fd_dict_getval(li->o, &data) );
+			CHECK( prev + 1, data.enum_value.i32 );
+			prev = data.enum_value.i32;
+		}
+		CHECK( 3, prev );
+		
+		/* Loading the same table again is harmless */
+		CHECK( 0, fd_dict_new_batch ( fd_g_config->cnf_dict, defs, sizeof(defs) / sizeof(defs[0]), &conflicts ) );
+		CHECK( 0, conflicts );
+		
+		/* Tables with undefined references are rejected before anything is created */
+		CHECK( ENOENT, fd_dict_new_batch ( fd_g_config->cnf_dict, bad_parent, sizeof(bad_parent) / sizeof(bad_parent[0]), NULL ) );
+		CHECK( ENOENT, fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME_ALL_VENDORS, "Batch-Bad-1", &obj, ENOENT ) );
+		CHECK( ENOENT, fd_dict_new_batch ( fd_g_config->cnf_dict, bad_vendor, sizeof(bad_vendor) / sizeof(bad_vendor[0]), NULL ) );
+		
+		/* Conflicts */
+		CHECK( EEXIST, fd_dict_new_batch ( fd_g_config->cnf_dict, conflict, sizeof(conflict) / sizeof(conflict[0]), NULL ) );
+		CHECK( ENOENT, fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME_ALL_VENDORS, "Batch-Last", &obj, ENOENT ) );
+		CHECK( 0, fd_dict_new_batch ( fd_g_config->cnf_dict, conflict, sizeof(conflict) / sizeof(conflict[0]), &conflicts ) );
+		CHECK( 1, conflicts );
+		CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME_ALL_VENDORS, "Batch-Last", &obj, ENOENT ) );
+		
+		/* Rules are not supported */
+		{
+			struct dict_rule_data rdata = { obj, RULE_OPTIONAL, 0, 0, 1 };
+			struct dict_object_def rule[] = { { DICT_RULE, &rdata, NULL } };
+			CHECK( EINVAL, fd_dict_new_batch ( fd_g_config->cnf_dict, rule, 1, NULL ) );
+		}
+	}
+	
 	/* That's all for the tests yet */
 	PASSTEST();
 } 
@@ -36,6 +36,12 @@
 #include "tests.h"
 
 /* Main test routine */
+/* Release callback of the routing candidates array */
+static void test_release(void * data)
+{
+	(*(int *)data)++;
+}
+
 int main(int argc, char *argv[])
 {
 	struct msg * acr = NULL;
@@ -695,6 +701,52 @@ int main(int argc, char *argv[])
 			CHECK( 0, fd_msg_avp_hdr ( found, &avpdata ) );
 			CHECK( 3.1415F, avpdata->avp_value->f32 );
 			
+			/* Grow the message so that the searches use the index */
+			{
+				struct dict_object * f64_model, * absent_model;
+				struct avp * first, * avpi;
+				int i;
+				union avp_value value;
+				
+				CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME, "AVP Test - no vendor - f64", &f64_model, ENOENT ) );
+				for (i = 0; i < 10; i++) {
+					CHECK( 0, fd_msg_avp_new ( f64_model, 0, &avpi ) );
+					value.f64 = (double)i;
+					CHECK( 0, fd_msg_avp_setvalue ( avpi, &value ) );
+					CHECK( 0, fd_msg_avp_add ( msg, MSG_BRW_LAST_CHILD, avpi ) );
+				}
+				CHECK( 0, fd_msg_parse_dict( msg, fd_g_config->cnf_dict, NULL ) );
+				CHECK( 0, fd_msg_search_avp( msg, f64_model, &found ) );
+				CHECK( 0, fd_msg_avp_hdr ( found, &avpdata ) );
+				CHECK( 0.0, avpdata->avp_value->f64 );
+				CHECK( 0, fd_msg_search_avp( msg, avp_model, &found ) );
+				CHECK( 0, fd_msg_avp_hdr ( found, &avpdata ) );
+				CHECK( 3.1415F, avpdata->avp_value->f32 );
+				
+				/* An AVP added before the others is found first */
+				CHECK( 0, fd_msg_avp_new ( avp_model, 0, &first ) );
+				value.f32 = 2.0F;
+				CHECK( 0, fd_msg_avp_setvalue ( first, &value ) );
+				CHECK( 0, fd_msg_avp_add ( msg, MSG_BRW_FIRST_CHILD, first ) );
+				CHECK( 0, fd_msg_search_avp( msg, avp_model, &found ) );
+				CHECK( first, found );
+				CHECK( 0, fd_msg_parse_dict( msg, fd_g_config->cnf_dict, NULL ) );
+				CHECK( 0, fd_msg_search_avp( msg, avp_model, &found ) );
+				CHECK( first, found );
+				
+				/* And no longer once removed */
+				CHECK( 0, fd_msg_free ( first ) );
+				CHECK( 0, fd_msg_search_avp( msg, avp_model, &found ) );
+				CHECK( 0, fd_msg_avp_hdr ( found, &avpdata ) );
+				CHECK( 3.1415F, avpdata->avp_value->f32 );
+				
+				/* Not found */
+				CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME, "Error-Reporting-Host", &absent_model, ENOENT ) );
+				CHECK( 0, fd_msg_search_avp( msg, absent_model, &found ) );
+				CHECK( NULL, found );
+				CHECK( ENOENT, fd_msg_search_avp( msg, absent_model, NULL ) );
+			}
+			
 			/* reinit the msg */
 			CHECK( 0, fd_msg_free ( msg ) );
 				
@@ -981,6 +1033,7 @@ int main(int argc, char *argv[])
 			char * host1="host1", * host2="host2";
 			union avp_value      value;
 			struct msg_hdr * msgdata = NULL;
+			int shard;
 			
 			CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_COMMAND, CMD_BY_NAME, "Test-Command-Request", &cmd_model, ENOENT ) );
 			
@@ -1022,9 +1075,20 @@ int main(int argc, char *argv[])
 				CHECK( 0, fd_msg_avp_setvalue ( avp, &value ) );
 				
 				
+				/* Use several routing shards to check the answer follows its request */
+				fd_g_config->cnf_shards = 8;
+				CHECK( 0, fd_queues_shards_init() );
+				shard = fd_shard_of(msg);
+				CHECK( 1, ((shard >= 0) && (shard < 8)) ? 1 : 0 );
+				
 				/* Now call the fd_msg_new_answer_from_req function */
 				CHECK( 0, fd_msg_new_answer_from_req ( fd_g_config->cnf_dict, &msg, 0 ) );
 				
+				/* The answer is handled in the same shard as the request */
+				CHECK( shard, fd_shard_of(msg) );
+				fd_g_config->cnf_shards = 1;
+				CHECK( 0, fd_shard_of(msg) );
+				
 				/* Check there is a Session-Id AVP */
 				{
 					struct session * sess;
@@ -1449,6 +1513,237 @@ int main(int argc, char *argv[])
 		}
 	}
 	
+	/* Test the message templates */
+	{
+		struct dict_object * cmd_model = NULL;
+		struct msg         * msg = NULL, * inst = NULL;
+		struct avp         * avpi = NULL, * pi = NULL;
+		struct avp         * fields[3];
+		union avp_value      value, v0, v1, v2;
+		union avp_value    * values[3];
+		struct fd_msg_tmpl * tmpl = NULL;
+		struct msg_hdr     * msgdata = NULL;
+		struct avp_hdr     * avpdata = NULL;
+		unsigned char      * buf2 = NULL;
+		size_t               len, len2;
+		
+		CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_COMMAND, CMD_BY_NAME, "Test-Command-Request", &cmd_model, ENOENT ) );
+		
+		/* Create a message with (os) Proxy-Info { Proxy-Host, (Proxy-State) } (u32) i64, fields between () */
+		#define TMPL_MSG( _os, _state, _u32 ) {								\
+			CHECK( 0, fd_msg_new ( cmd_model, 0, &msg ) );						\
+			ADD_AVP( msg, MSG_BRW_LAST_CHILD, avpi, 0, "AVP Test 2 - os" );				\
+			value.os.data = (unsigned char *) (_os);						\
+			value.os.len = strlen(_os);								\
+			CHECK( 0, fd_msg_avp_setvalue ( avpi, &value ) );					\
+			fields[0] = avpi;									\
+			ADD_AVP( msg, MSG_BRW_LAST_CHILD, pi, 0, "Proxy-Info" );				\
+			ADD_AVP( pi, MSG_BRW_LAST_CHILD, avpi, 0, "Proxy-Host" );				\
+			value.os.data = (unsigned char *) "proxy.example.net";					\
+			value.os.len = strlen("proxy.example.net");						\
+			CHECK( 0, fd_msg_avp_setvalue ( avpi, &value ) );					\
+			ADD_AVP( pi, MSG_BRW_LAST_CHILD, avpi, 0, "Proxy-State" );				\
+			value.os.data = (unsigned char *) (_state);						\
+			value.os.len = strlen(_state);								\
+			CHECK( 0, fd_msg_avp_setvalue ( avpi, &value ) );					\
+			fields[1] = avpi;									\
+			ADD_AVP( msg, MSG_BRW_LAST_CHILD, avpi, 0, "AVP Test 2 - u32" );			\
+			value.u32 = (_u32);									\
+			CHECK( 0, fd_msg_avp_setvalue ( avpi, &value ) );					\
+			fields[2] = avpi;									\
+			ADD_AVP( msg, MSG_BRW_LAST_CHILD, avpi, 0, "AVP Test 2 - i64" );			\
+			value.i64 = -0x11223344556677LL;							\
+			CHECK( 0, fd_msg_avp_setvalue ( avpi, &value ) );					\
+		}
+		
+		TMPL_MSG( "waaad", "state", 0x1234 );
+		
+		/* Invalid templates */
+		CHECK( EINVAL, fd_msg_tmpl_new ( msg, &pi, 1, &tmpl ) ); /* Grouped AVP */
+		avpi = fields[1];
+		fields[1] = fields[0];
+		CHECK( EINVAL, fd_msg_tmpl_new ( msg, fields, 2, &tmpl ) ); /* duplicate */
+		fields[1] = avpi;
+		
+		/* Create the template */
+		CHECK( 0, fd_msg_tmpl_new ( msg, fields, 3, &tmpl ) );
+		CHECK( 0, fd_msg_free( msg ) );
+		
+		/* An instance without new values is the same as the template */
+		CHECK( 0, fd_msg_tmpl_instance ( tmpl, NULL, 0, &inst ) );
+		CHECK( 0, fd_msg_bufferize( inst, &buf, &len ) );
+		CHECK( 0, fd_msg_free( inst ) );
+		TMPL_MSG( "waaad", "state", 0x1234 );
+		CHECK( 0, fd_msg_bufferize( msg, &buf2, &len2 ) );
+		CHECK( len2, len );
+		CHECK( 0, memcmp(buf, buf2, len) );
+		free(buf);
+		free(buf2);
+		CHECK( 0, fd_msg_free( msg ) );
+		
+		/* Now change the values, including the length of the strings */
+		v0.os.data = (unsigned char *) "a longer string";
+		v0.os.len  = strlen("a longer string");
+		v1.os.data = (unsigned char *) "st";
+		v1.os.len  = 2;
+		v2.u32 = 0xFEDCBA98;
+		values[0] = &v0; values[1] = &v1; values[2] = &v2;
+		CHECK( 0, fd_msg_tmpl_instance ( tmpl, values, MSGFL_ALLOC_ETEID, &inst ) );
+		CHECK( 0, fd_msg_hdr ( inst, &msgdata ) );
+		CHECK( 0, fd_msg_bufferize( inst, &buf, &len ) );
+		CHECK( len, msgdata->msg_length );
+		
+		TMPL_MSG( "a longer string", "st", 0xFEDCBA98 );
+		CHECK( 0, fd_msg_bufferize( msg, &buf2, &len2 ) );
+		CHECK( len2, len );
+		CHECK( 0, memcmp(buf, buf2, 16) ); /* header, except End-to-End Identifier */
+		CHECK( 0, memcmp(buf + 20, buf2 + 20, len - 20) );
+		free(buf);
+		free(buf2);
+		CHECK( 0, fd_msg_free( msg ) );
+		
+		/* The AVPs of the instance are interpreted on demand */
+		{
+			struct dict_object * avp_model = NULL;
+			struct dict_avp_request req = { 0, 0, "AVP Test 2 - u32" };
+			CHECK( 0, fd_dict_search( fd_g_config->cnf_dict, DICT_AVP, AVP_BY_NAME_AND_VENDOR, &req, &avp_model, ENOENT));
+			CHECK( 0, fd_msg_search_avp ( inst, avp_model, &avpi ) );
+			CHECK( 0, fd_msg_avp_hdr ( avpi, &avpdata ) );
+			CHECK( 0xFEDCBA98, avpdata->avp_value->u32 );
+		}
+		CHECK( 0, fd_msg_parse_dict ( inst, fd_g_config->cnf_dict, NULL ) );
+		CHECK( 0, fd_msg_browse ( inst, MSG_BRW_FIRST_CHILD, &avpi, NULL) );
+		CHECK( 0, fd_msg_avp_hdr ( avpi, &avpdata ) );
+		CHECK( v0.os.len, avpdata->avp_value->os.len );
+		CHECK( 0, memcmp(v0.os.data, avpdata->avp_value->os.data, v0.os.len) );
+		CHECK( 0, fd_msg_free( inst ) );
+		
+		CHECK( 0, fd_msg_tmpl_free( tmpl ) );
+	}
+	
+	/* Test the routing candidates built from an array of peers */
+	{
+		struct rt_data * rtd = NULL;
+		struct rtd_candidate peers[4];
+		struct fd_list * candidates, * li;
+		char * ids[] = { "peer1.localdomain", "peer2.localdomain", "peer3.localdomain", "peer4.localdomain" };
+		int released = 0, i, seen[4] = { 0, 0, 0, 0 };
+		
+		memset(peers, 0, sizeof(peers));
+		for (i = 0; i < 4; i++) {
+			peers[i].diamid = (DiamId_t)ids[i];
+			peers[i].diamidlen = strlen(ids[i]);
+			peers[i].realm = (DiamId_t)"localdomain";
+			peers[i].realmlen = strlen("localdomain");
+		}
+		
+		CHECK( 0, fd_rtd_init(&rtd) );
+		CHECK( 0, fd_rtd_candidate_add_array(rtd, peers, 4, test_release, &released) );
+		/* The list must be empty for this function */
+		CHECK( EINVAL, fd_rtd_candidate_add_array(rtd, peers, 4, NULL, NULL) );
+		
+		/* Items of the array and added items can be removed alike */
+		CHECK( 0, fd_rtd_candidate_add(rtd, (DiamId_t)"peer5.localdomain", strlen("peer5.localdomain"), (DiamId_t)"localdomain", strlen("localdomain")) );
+		fd_rtd_candidate_del(rtd, (uint8_t *)"PEER2.localdomain", strlen("PEER2.localdomain"));
+		
+		fd_rtd_candidate_extract(rtd, &candidates, 0);
+		i = 0;
+		for (li = candidates->next; li != candidates; li = li->next) {
+			struct rtd_candidate * c = (struct rtd_candidate *) li;
+			CHECK( 1, strcmp((char *)c->diamid, "peer2.localdomain") ? 1 : 0 );
+			if (!strcmp((char *)c->diamid, "peer3.localdomain"))
+				c->score = 10;
+			else if (!strcmp((char *)c->diamid, "peer1.localdomain"))
+				c->score = -1;
+			else
+				c->score = 5;
+			i++;
+		}
+		CHECK( 4, i );
+		
+		/* The candidates are ordered by increasing score, and those with the highest score are randomized */
+		for (i = 0; i < 100; i++) {
+			struct rtd_candidate * c;
+			CHECK( 0, fd_rtd_candidate_reorder(candidates) );
+			c = (struct rtd_candidate *) candidates->next;
+			CHECK( -1, c->score );
+			c = (struct rtd_candidate *) candidates->prev;
+			CHECK( 10, c->score );
+			/* Now two peers with the highest score */
+			c->score = 5;
+			CHECK( 0, fd_rtd_candidate_reorder(candidates) );
+			c = (struct rtd_candidate *) candidates->prev;
+			CHECK( 5, c->score );
+			seen[ strcmp((char *)c->diamid, "peer5.localdomain") ? (strcmp((char *)c->diamid, "peer4.localdomain") ? 2 : 3) : 1 ]++;
+			for (li = candidates->next; li != candidates; li = li->next) {
+				c = (struct rtd_candidate *) li;
+				if (!strcmp((char *)c->diamid, "peer3.localdomain"))
+					c->score = 10;
+			}
+		}
+		CHECK( 0, seen[0] );
+		CHECK( 1, (seen[1] && seen[2] && seen[3]) ? 1 : 0 );
+		
+		/* The owner of the array is notified when the routing data is freed */
+		CHECK( 0, released );
+		fd_rtd_free(&rtd);
+		CHECK( 1, released );
+	}
+	
+	/* Test the routing cache */
+	{
+		struct fd_rt_cache_key key;
+		int scores[3] = { 15, -70, 20 }, out[3];
+		unsigned long long hits, misses, h, m;
+		
+		fd_g_config->cnf_rtcache_ttl = 60000;
+		CHECK( 0, fd_rt_cache_init() );
+		CHECK( 0, fd_rt_out_cache_stats(&hits, &misses) );
+		
+		memset(&key, 0, sizeof(key));
+		key.appid = 73566;
+		key.cmd = 73573;
+		key.dr = (uint8_t *)"realm.test";
+		key.drlen = strlen("realm.test");
+		key.cands = 0x1234;
+		
+		CHECK( ENOENT, fd_rt_cache_get(&key, 1, out, 3) );
+		CHECK( 0, fd_rt_cache_put(&key, 1, scores, 3) );
+		memset(out, 0, sizeof(out));
+		CHECK( 0, fd_rt_cache_get(&key, 1, out, 3) );
+		CHECK( 0, memcmp(out, scores, sizeof(scores)) );
+		
+		/* The realm is compared without case, but not the other values */
+		key.dr = (uint8_t *)"REALM.Test";
+		CHECK( 0, fd_rt_cache_get(&key, 1, out, 3) );
+		key.dh = (uint8_t *)"host.realm.test";
+		key.dhlen = strlen("host.realm.test");
+		CHECK( ENOENT, fd_rt_cache_get(&key, 1, out, 3) );
+		key.dh = NULL;
+		key.dhlen = 0;
+		key.cmd++;
+		CHECK( ENOENT, fd_rt_cache_get(&key, 1, out, 3) );
+		key.cmd--;
+		key.cands++;
+		CHECK( ENOENT, fd_rt_cache_get(&key, 1, out, 3) );
+		key.cands--;
+		
+		/* The entry is discarded when the active peers changed */
+		CHECK( ENOENT, fd_rt_cache_get(&key, 2, out, 3) );
+		CHECK( ENOENT, fd_rt_cache_get(&key, 1, out, 3) );
+		
+		/* And when the callbacks changed */
+		CHECK( 0, fd_rt_cache_put(&key, 2, scores, 3) );
+		CHECK( 0, fd_rt_cache_get(&key, 2, out, 3) );
+		fd_rt_cache_flush();
+		CHECK( ENOENT, fd_rt_cache_get(&key, 2, out, 3) );
+		
+		CHECK( 0, fd_rt_out_cache_stats(&h, &m) );
+		CHECK( 3, (int)(h - hits) );
+		CHECK( 7, (int)(m - misses) );
+		fd_g_config->cnf_rtcache_ttl = 0;
+	}
+	
 	/* That's all for the tests yet */
 	PASSTEST();
 } 
@@ -187,6 +187,37 @@ static void load_all_extensions(char * prefix)
 	/* We should probably clean the list here ? */
 }
 
+/* Generation of identifiers from several threads at once */
+#define ID_THREADS	8
+struct id_thr_arg {
+	uint32_t	 *eteids;
+	struct session	**sess;
+	int		  nb;
+	int		  ret;
+};
+
+static void * id_thr(void * arg)
+{
+	struct id_thr_arg * a = arg;
+	int i;
+	
+	for (i = 0; i < a->nb; i++) {
+		a->eteids[i] = fd_msg_eteid_get();
+		/* fd_sess_new fails with EALREADY if the same Session-Id was generated twice */
+		a->ret = fd_sess_new( &a->sess[i], (DiamId_t)"stress.test", CONSTSTRLEN("stress.test"), (os0_t)"ids", CONSTSTRLEN("ids") );
+		if (a->ret)
+			break;
+	}
+	
+	return NULL;
+}
+
+static int cmp_u32(const void * a, const void * b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+	return (x > y) - (x < y);
+}
+
 /* Main test routine */
 int main(int argc, char *argv[])
 {
@@ -522,6 +553,48 @@ int main(int argc, char *argv[])
 		
 	}
 	
+	/* End-to-End identifiers and Session-Ids created in parallel must all be unique */
+	{
+		pthread_t thr[ID_THREADS];
+		struct id_thr_arg args[ID_THREADS];
+		uint32_t * eteids;
+		struct session ** sess;
+		struct timespec start, end;
+		int per = test_parameter / ID_THREADS;
+		int i, dup = 0;
+		
+		CHECK( 1, (eteids = calloc(per * ID_THREADS, sizeof(uint32_t))) ? 1 : 0 );
+		CHECK( 1, (sess = calloc(per * ID_THREADS, sizeof(struct session *))) ? 1 : 0 );
+		
+		CHECK( 0, clock_gettime(CLOCK_REALTIME, &start) );
+		for (i = 0; i < ID_THREADS; i++) {
+			args[i].eteids = eteids + i * per;
+			args[i].sess = sess + i * per;
+			args[i].nb = per;
+			args[i].ret = 0;
+			CHECK( 0, pthread_create(&thr[i], NULL, id_thr, &args[i]) );
+		}
+		for (i = 0; i < ID_THREADS; i++) {
+			CHECK( 0, pthread_join(thr[i], NULL) );
+			CHECK( 0, args[i].ret );
+		}
+		CHECK( 0, clock_gettime(CLOCK_REALTIME, &end) );
+		display_result(per * ID_THREADS, &start, &end, "parallel ids", "ids", "created");
+		
+		qsort(eteids, per * ID_THREADS, sizeof(uint32_t), cmp_u32);
+		for (i = 1; i < per * ID_THREADS; i++) {
+			if (eteids[i] == eteids[i - 1])
+				dup++;
+		}
+		CHECK( 0, dup );
+		
+		for (i = 0; i < per * ID_THREADS; i++) {
+			CHECK( 0, fd_sess_destroy( &sess[i] ) );
+		}
+		free(sess);
+		free(eteids);
+	}
+	
 	/* We have our "buf" now, length is 344 -- cf. testmesg.c. */
 redo:	
 	/* Test the throughput of the different functions function */
@@ -38,6 +38,43 @@
 const char * ids[] = { "b11", "b14", "b1", "b4" };
 #define DomainName "localdomain"
 
+/* A buffer as received from a peer, with the header of a message (application 3, command 272) followed by zeros */
+static uint8_t * raw_msg(uint8_t flags, uint32_t hbh, size_t len)
+{
+	uint8_t * buf;
+	struct fd_msg_pmdl * pmdl;
+	CHECK( 1, (buf = malloc(fd_msg_pmdl_sizewithoverhead(len))) ? 1 : 0 );
+	memset(buf, 0, len);
+	buf[0] = 1;
+	buf[3] = len;
+	buf[4] = flags;
+	buf[6] = 1; buf[7] = 16;
+	buf[11] = 3;
+	*(uint32_t *)(buf + 12) = htonl(hbh);
+	*(uint32_t *)(buf + 16) = htonl(hbh);
+	pmdl = fd_msg_pmdl_get_inbuf(buf, len);
+	fd_list_init(&pmdl->sentinel, NULL);
+	CHECK( 0, pthread_mutex_init(&pmdl->lock, NULL) );
+	return buf;
+}
+
+/* Answer callback of the requests sent locally */
+static void anscb(void * data, struct msg ** msg)
+{
+	(*(int *)data)++;
+	CHECK( 0, fd_msg_free(*msg) );
+	*msg = NULL;
+}
+
+/* Expiry callback of the requests sent locally */
+static void expirecb(void * data, DiamId_t sentto, size_t senttolen, struct msg ** msg)
+{
+	(*(int *)data)++;
+	CHECK( 0, strcmp((char *)sentto, "b1." DomainName) );
+	CHECK( 0, fd_msg_free(*msg) );
+	*msg = NULL;
+}
+
 /* Main test routine */
 int main(int argc, char *argv[])
 {
@@ -71,6 +108,274 @@ int main(int argc, char *argv[])
 		}
 	}
 	
+	/* Check the selection of the routing candidates by realm */
+	{
+		/* Realm of each peer of ids, and whether it advertises the relay application */
+		const char * realms[] = { "realm.one", "REALM.two", "realm.Two", "realm.three" };
+		int relays[] = { 0, 0, 0, 1 };
+		struct fd_peers_snapshot * snap;
+		struct rtd_candidate sel[4];
+		int i, nb;
+		char locid[255];
+		struct peer_hdr *p;
+		
+		CHECK( 0, pthread_rwlock_wrlock(&fd_g_activ_peers_rw) );
+		for (i=0; i < sizeof(ids) / sizeof(ids[0]); i++) {
+			struct fd_peer * peer;
+			struct fd_list * li;
+			snprintf(locid, sizeof(locid), "%s." DomainName, ids[i]);
+			CHECK( 0, fd_peer_getbyid((DiamId_t)locid, strlen((char *)locid), 0, &p));
+			peer = (struct fd_peer *)p;
+			CHECK( 1, (peer->p_hdr.info.runtime.pir_realm = strdup(realms[i])) ? 1 : 0 );
+			peer->p_hdr.info.runtime.pir_realmlen = strlen(realms[i]);
+			peer->p_hdr.info.runtime.pir_relay = relays[i];
+			/* Ordered as in the PSM */
+			for (li = fd_g_activ_peers.next; li != &fd_g_activ_peers; li = li->next) {
+				struct fd_peer * next_p = (struct fd_peer *)li->o;
+				if (fd_os_cmp(peer->p_hdr.info.pi_diamid, peer->p_hdr.info.pi_diamidlen, next_p->p_hdr.info.pi_diamid, next_p->p_hdr.info.pi_diamidlen) < 0)
+					break;
+			}
+			fd_list_insert_before(li, &peer->p_actives);
+		}
+		CHECK( 0, fd_peers_snapshot_update() );
+		CHECK( 0, pthread_rwlock_unlock(&fd_g_activ_peers_rw) );
+		
+		snap = fd_peers_snapshot_get();
+		CHECK( 1, snap ? 1 : 0 );
+		CHECK( 4, snap->nb );
+		CHECK( 1, snap->nb_any );
+		
+		/* The peers of the realm (case-insensitive) and the relay */
+		CHECK( 0, fd_peers_snapshot_select(snap, NULL, 0, (uint8_t *)"Realm.Two", strlen("Realm.Two"), sel, &nb) );
+		CHECK( 3, nb );
+		for (i = 1; i < nb; i++) {
+			CHECK( 1, fd_os_cmp(sel[i - 1].diamid, sel[i - 1].diamidlen, sel[i].diamid, sel[i].diamidlen) < 0 ? 1 : 0 );
+		}
+		for (i = 0; i < nb; i++) {
+			CHECK( 1, (!strcmp((char *)sel[i].diamid, "b14." DomainName) || !strcmp((char *)sel[i].diamid, "b1." DomainName) || !strcmp((char *)sel[i].diamid, "b4." DomainName)) ? 1 : 0 );
+		}
+		
+		/* The Destination-Host is selected even if it is in another realm, only once */
+		CHECK( 0, fd_peers_snapshot_select(snap, (uint8_t *)"B11.LocalDomain", strlen("B11.LocalDomain"), (uint8_t *)"realm.unknown", strlen("realm.unknown"), sel, &nb) );
+		CHECK( 2, nb );
+		CHECK( 0, fd_peers_snapshot_select(snap, (uint8_t *)"b4." DomainName, strlen("b4." DomainName), (uint8_t *)"realm.three", strlen("realm.three"), sel, &nb) );
+		CHECK( 1, nb );
+		CHECK( 0, strcmp((char *)sel[0].diamid, "b4." DomainName) );
+		
+		/* The snapshot remains valid after the peers leave the OPEN state */
+		CHECK( 0, pthread_rwlock_wrlock(&fd_g_activ_peers_rw) );
+		while (!FD_IS_LIST_EMPTY(&fd_g_activ_peers))
+			fd_list_unlink(fd_g_activ_peers.next);
+		CHECK( 0, fd_peers_snapshot_update() );
+		CHECK( 0, pthread_rwlock_unlock(&fd_g_activ_peers_rw) );
+		CHECK( 0, fd_peers_snapshot_select(snap, NULL, 0, (uint8_t *)"realm.one", strlen("realm.one"), sel, &nb) );
+		CHECK( 2, nb );
+		fd_peers_snapshot_put(snap);
+		
+		snap = fd_peers_snapshot_get();
+		CHECK( 0, snap->nb );
+		fd_peers_snapshot_put(snap);
+	}
+	
+	/* Load of a peer, read without locks */
+	{
+		struct peer_hdr * phdr;
+		struct fd_peer * peer;
+		struct fd_peer_load load;
+		struct msg * msg, * req;
+		struct msg_hdr * mhdr;
+		
+		CHECK( 0, fd_peer_getbyid( "b1." DomainName, strlen("b1." DomainName), 0, &phdr ) );
+		peer = (struct fd_peer *)phdr;
+		CHECK( 0, fd_peer_get_load(phdr, &load) );
+		CHECK( 0, load.to_receive );
+		CHECK( 0, load.to_send );
+		CHECK( 0, load.latency );
+		
+		CHECK( 0, fd_msg_new(NULL, 0, &msg) );
+		CHECK( 0, fd_msg_hdr(msg, &mhdr) );
+		mhdr->msg_flags = CMD_FLAG_REQUEST;
+		mhdr->msg_hbhid = 1234;
+		req = msg;
+		CHECK( 0, fd_p_sr_store(&peer->p_sr, &req, &mhdr->msg_hbhid, 1234) );
+		CHECK( 0, fd_peer_get_load(phdr, &load) );
+		CHECK( 1, load.to_receive );
+		
+		/* The first answer gives the average latency */
+		usleep(2000);
+		CHECK( 0, fd_p_sr_fetch(&peer->p_sr, 1234, &req) );
+		CHECK( msg, req );
+		CHECK( 0, fd_peer_get_load(phdr, &load) );
+		CHECK( 0, load.to_receive );
+		CHECK( 1, load.latency >= 2000 ? 1 : 0 );
+		CHECK( 0, fd_msg_free(msg) );
+	}
+	
+	/* The requests that are not answered in time expire */
+	{
+		struct peer_hdr * phdr;
+		struct fd_peer * peer;
+		struct msg * msg[3], * req;
+		struct msg_hdr * mhdr;
+		struct timespec ts;
+		int i, expired = 0;
+		
+		CHECK( 0, fd_peer_getbyid( "b1." DomainName, strlen("b1." DomainName), 0, &phdr ) );
+		peer = (struct fd_peer *)phdr;
+		
+		/* Timeouts of 100ms, 50ms, and none */
+		for (i = 0; i < 3; i++) {
+			CHECK( 0, fd_msg_new(NULL, 0, &msg[i]) );
+			CHECK( 0, fd_msg_hdr(msg[i], &mhdr) );
+			mhdr->msg_flags = CMD_FLAG_REQUEST;
+			mhdr->msg_hbhid = 2000 + i;
+			if (i < 2) {
+				CHECK( 0, clock_gettime(CLOCK_REALTIME, &ts) );
+				ts.tv_nsec += (100 - 50 * i) * 1000000;
+				if (ts.tv_nsec >= 1000000000) {
+					ts.tv_sec++;
+					ts.tv_nsec -= 1000000000;
+				}
+				CHECK( 0, fd_msg_anscb_associate(msg[i], anscb, &expired, expirecb, &ts) );
+			}
+			req = msg[i];
+			CHECK( 0, fd_p_sr_store(&peer->p_sr, &req, &mhdr->msg_hbhid, 2000 + i) );
+		}
+		
+		usleep(75000);
+		CHECK( 1, expired );
+		CHECK( 2, peer->p_sr.cnt );
+		usleep(100000);
+		CHECK( 2, expired );
+		CHECK( 1, peer->p_sr.cnt );
+		CHECK( 2, peer->p_sr.cnt_lost );
+		
+		/* An answer to an expired request is not matched */
+		CHECK( 0, fd_p_sr_fetch(&peer->p_sr, 2000, &req) );
+		CHECK( NULL, req );
+		CHECK( 1, peer->p_sr.cnt_lost );
+		CHECK( 0, fd_p_sr_fetch(&peer->p_sr, 2002, &req) );
+		CHECK( msg[2], req );
+		CHECK( 0, fd_msg_free(req) );
+	}
+	
+	/* Decoding of the received messages by the decoder threads */
+	{
+		#define NB_DEC	200
+		struct peer_hdr * phdr;
+		struct fd_peer * peer;
+		struct msg * msg;
+		struct msg_hdr * mhdr;
+		DiamId_t src;
+		size_t srcsz;
+		uint8_t * buf;
+		int i, code;
+		
+		CHECK( 0, fd_queues_init() );
+		fd_g_config->cnf_dec_thr = 4;
+		CHECK( 0, fd_in_init() );
+		
+		CHECK( 0, fd_peer_getbyid( "b1." DomainName, strlen("b1." DomainName), 0, &phdr ) );
+		peer = (struct fd_peer *)phdr;
+		CHECK( 0, fd_fifo_new(&peer->p_events, 0) );
+		
+		/* The requests are decoded in parallel, but passed to the routing in order */
+		for (i = 0; i < NB_DEC; i++) {
+			buf = raw_msg(CMD_FLAG_REQUEST | CMD_FLAG_PROXIABLE, i, 20);
+			CHECK( 1, fd_in_routable(buf, 20) );
+			peer->p_reqin_count++; /* as the PSM does */
+			CHECK( 0, fd_in_decode(peer, buf, 20) );
+		}
+		for (i = 0; i < NB_DEC; i++) {
+			CHECK( 0, fd_fifo_get(fd_g_shards[0].incoming, &msg) );
+			CHECK( 0, fd_msg_hdr(msg, &mhdr) );
+			CHECK( i, mhdr->msg_hbhid );
+			CHECK( 0, fd_msg_source_get(msg, &src, &srcsz) );
+			CHECK( 0, strcmp((char *)src, "b1." DomainName) );
+			CHECK( 0, fd_msg_free(msg) );
+		}
+		
+		/* An answer without request is discarded, and an invalid message resets the connection */
+		buf = raw_msg(CMD_FLAG_PROXIABLE, 12345, 20);
+		CHECK( 0, fd_in_decode(peer, buf, 20) );
+		buf = raw_msg(CMD_FLAG_REQUEST | CMD_FLAG_PROXIABLE, 12346, 24); /* truncated AVP */
+		peer->p_reqin_count++;
+		CHECK( 0, fd_in_decode(peer, buf, 24) );
+		do {
+			/* The reception was paused when the quota was reached */
+			CHECK( 0, fd_event_get(peer->p_events, &code, NULL, NULL) );
+		} while (code == FDEVP_INGRESS_RESUME);
+		CHECK( FDEVP_CNX_ERROR, code );
+		CHECK( NB_DEC, peer->p_reqin_count );
+		
+		/* The link-local messages are not routable */
+		buf = raw_msg(CMD_FLAG_REQUEST, 0, 20);
+		buf[6] = 1; buf[7] = 24; buf[11] = 0; /* DWR */
+		CHECK( 0, fd_in_routable(buf, 20) );
+		free(buf);
+		
+		/* Without decoder, the PSM decodes the remaining messages when it terminates */
+		CHECK( 0, fd_in_fini() );
+		for (i = 0; i < 3; i++) {
+			buf = raw_msg(CMD_FLAG_REQUEST | CMD_FLAG_PROXIABLE, NB_DEC + i, 20);
+			CHECK( 0, fd_in_decode(peer, buf, 20) );
+		}
+		CHECK( 0, fd_fifo_length(fd_g_shards[0].incoming) );
+		fd_in_detach(peer);
+		for (i = 0; i < 3; i++) {
+			CHECK( 0, fd_fifo_tryget(fd_g_shards[0].incoming, &msg) );
+			CHECK( 0, fd_msg_hdr(msg, &mhdr) );
+			CHECK( NB_DEC + i, mhdr->msg_hbhid );
+			CHECK( 0, fd_msg_free(msg) );
+		}
+		CHECK( 0, fd_fifo_length(fd_g_shards[0].incoming) );
+		CHECK( 0, peer->p_dec_pending );
+		CHECK( 0, fd_fifo_del(&peer->p_events) );
+	}
+	
+	/* The answers to the local requests skip the routing */
+	{
+		struct dict_object * str_model;
+		struct peer_hdr * phdr;
+		struct msg * qry, * msg, * ans;
+		int called = 0;
+		
+		fd_g_config->cnf_diamid = strdup("local." DomainName);
+		fd_g_config->cnf_diamid_len = strlen(fd_g_config->cnf_diamid);
+		fd_g_config->cnf_diamrlm = strdup(DomainName);
+		fd_g_config->cnf_diamrlm_len = strlen(fd_g_config->cnf_diamrlm);
+		CHECK( 0, fd_msg_init() );
+		CHECK( 0, fd_dict_search ( fd_g_config->cnf_dict, DICT_COMMAND, CMD_BY_NAME, "Session-Termination-Request", &str_model, ENOENT ) );
+		CHECK( 0, fd_peer_getbyid( "b4." DomainName, strlen("b4." DomainName), 0, &phdr ) );
+		CHECK( 1, ((struct fd_peer *)phdr)->p_ingress ? 1 : 0 );
+		fd_g_config->cnf_dec_thr = 0;
+		CHECK( 0, fd_in_init() );
+		
+		CHECK( 0, fd_msg_new ( str_model, MSGFL_ALLOC_ETEID, &qry ) );
+		CHECK( 0, fd_msg_new_session ( qry, NULL, 0 ) );
+		CHECK( 0, fd_msg_anscb_associate ( qry, anscb, &called, NULL, NULL ) );
+		msg = qry;
+		CHECK( 0, fd_msg_new_answer_from_req ( fd_g_config->cnf_dict, &msg, 0 ) );
+		CHECK( 0, fd_msg_rescode_set ( msg, "DIAMETER_SUCCESS", NULL, NULL, 1 ) );
+		
+		/* By default, the answer is passed to the dispatch threads, through the ingress queue of the peer */
+		ans = msg;
+		CHECK( 0, fd_in_post((struct fd_peer *)phdr, &msg) );
+		CHECK( NULL, msg );
+		CHECK( 0, fd_fifo_get(fd_g_shards[0].local, &msg) );
+		CHECK( ans, msg );
+		CHECK( 0, fd_fifo_length(fd_g_shards[0].incoming) );
+		CHECK( 0, called );
+		
+		/* With InlineAnswerCallbacks, the callback is called directly */
+		fd_g_config->cnf_flags.inl_ans = 1;
+		CHECK( 0, fd_in_post((struct fd_peer *)phdr, &msg) );
+		CHECK( NULL, msg );
+		CHECK( 1, called );
+		CHECK( 0, fd_fifo_length(fd_g_shards[0].local) );
+		fd_g_config->cnf_flags.inl_ans = 0;
+		CHECK( 0, fd_in_fini() );
+	}
 	
 	/* That's all for the tests yet */
 	PASSTEST();
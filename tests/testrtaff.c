@@ -0,0 +1,208 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+#include "tests.h"
+
+/* The hashing of the rt_affinity extension, compiled with the test (see CMakeLists.txt) */
+#include "rt_affinity.h"
+
+#define NB_PEERS	11
+#define NB_SESSIONS	100000
+
+static struct rtd_candidate cands[NB_PEERS];
+static char ids[NB_PEERS][32];
+static struct fd_list candidates = FD_LIST_INITIALIZER(candidates);
+static unsigned char choice[NB_SESSIONS];
+
+/* Reset the candidates list with the first nb peers, except the one skipped (if >= 0) */
+static void set_cands(int nb, int skip)
+{
+	int i;
+	fd_list_init(&candidates, NULL);
+	for (i = 0; i < nb; i++) {
+		fd_list_init(&cands[i].chain, &cands[i]);
+		cands[i].score = 0;
+		if (i != skip)
+			fd_list_insert_before(&candidates, &cands[i].chain);
+	}
+}
+
+/* The peer that would receive the session */
+static int route(int session, int nb, int skip)
+{
+	char sid[64];
+	int i, best = -1;
+	
+	snprintf(sid, sizeof(sid), "client.example.net;%d;%d", 1234567 + session / 1000, session);
+	set_cands(nb, skip);
+	CHECK( 0, rtaff_choose((uint8_t *)sid, strlen(sid), &candidates) );
+	for (i = 0; i < nb; i++) {
+		if ((i == skip) || (cands[i].score < 0))
+			continue;
+		CHECK( -1, best ); /* only one peer keeps its score */
+		best = i;
+	}
+	return best;
+}
+
+/* Map all the sessions, return the number of sessions mapped differently than in the previous call, and display the distribution */
+static int map_sessions(char * what, int nb, int skip, int * count)
+{
+	int s, i, moved = 0;
+	
+	memset(count, 0, NB_PEERS * sizeof(int));
+	for (s = 0; s < NB_SESSIONS; s++) {
+		int p = route(s, nb, skip);
+		if (p != choice[s])
+			moved++;
+		choice[s] = p;
+		count[p]++;
+	}
+	printf("%-22s:", what);
+	for (i = 0; i < nb; i++)
+		printf(" %4.1f%%", count[i] * 100.0 / NB_SESSIONS);
+	printf(", moved %4.1f%%\n", moved * 100.0 / NB_SESSIONS);
+	return moved;
+}
+
+/* Main test routine */
+int main(int argc, char *argv[])
+{
+	int count[NB_PEERS], i, s, moved;
+	unsigned char previous[NB_SESSIONS];
+	
+	/* First, initialize the daemon modules */
+	INIT_FD();
+	
+	for (i = 0; i < NB_PEERS; i++) {
+		snprintf(ids[i], sizeof(ids[i]), "peer%d.example.net", i);
+		cands[i].diamid = ids[i];
+		cands[i].diamidlen = strlen(ids[i]);
+	}
+	
+	/* The weights */
+	{
+		CHECK( 1, rtaff_weight_get("peer0.example.net", strlen("peer0.example.net")) );
+		CHECK( 0, rtaff_weight_add("peer1.example.net", 5) );
+		CHECK( 0, rtaff_weight_add("PEER0.example.net", 2) );
+		CHECK( 2, rtaff_weight_get("peer0.example.net", strlen("peer0.example.net")) );
+		CHECK( 5, rtaff_weight_get("Peer1.Example.Net", strlen("Peer1.Example.Net")) );
+		CHECK( 1, rtaff_weight_get("peer2.example.net", strlen("peer2.example.net")) );
+		CHECK( EINVAL, rtaff_weight_add("peer2.example.net", RTAFF_MAX_WEIGHT + 1) );
+		rtaff_weight_fini();
+		CHECK( 1, rtaff_weight_get("peer0.example.net", strlen("peer0.example.net")) );
+	}
+	
+	/* Only the candidates with the best score are considered */
+	{
+		int scores[] = { 2, 1, 2, -1 };
+		set_cands(4, -1);
+		for (i = 0; i < 4; i++)
+			cands[i].score = scores[i];
+		CHECK( 0, rtaff_choose((uint8_t *)"session", 7, &candidates) );
+		CHECK( 1, cands[1].score );
+		CHECK( -1, cands[3].score );
+		CHECK( 3, cands[0].score + cands[2].score );
+		
+		/* A session always goes to the same peer */
+		s = route(42, 10, -1);
+		for (i = 0; i < 10; i++) {
+			CHECK( s, route(42, 10, -1) );
+		}
+	}
+	
+	/* The sessions are evenly distributed, and a peer leaving or joining only remaps its own sessions */
+	memset(choice, 0xff, sizeof(choice));
+	map_sessions("10 peers", 10, -1, count);
+	for (i = 0; i < 10; i++) {
+		CHECK( 1, ((count[i] > NB_SESSIONS / 10 * 0.9) && (count[i] < NB_SESSIONS / 10 * 1.1)) ? 1 : 0 );
+	}
+	memcpy(previous, choice, sizeof(choice));
+	
+	moved = map_sessions("peer3 leaves", 10, 3, count);
+	CHECK( 0, count[3] );
+	for (s = 0; s < NB_SESSIONS; s++) {
+		if (previous[s] != 3) {
+			CHECK( previous[s], choice[s] );
+		}
+	}
+	CHECK( 1, ((moved > NB_SESSIONS / 10 * 0.9) && (moved < NB_SESSIONS / 10 * 1.1)) ? 1 : 0 );
+	
+	moved = map_sessions("peer3 comes back", 10, -1, count);
+	CHECK( 0, memcmp(previous, choice, sizeof(choice)) );
+	
+	moved = map_sessions("peer10 joins", 11, -1, count);
+	for (s = 0; s < NB_SESSIONS; s++) {
+		if (previous[s] != choice[s]) {
+			CHECK( 10, choice[s] );
+		}
+	}
+	CHECK( 1, ((moved > NB_SESSIONS / 11 * 0.9) && (moved < NB_SESSIONS / 11 * 1.1)) ? 1 : 0 );
+	
+	/* The weights */
+	{
+		memset(choice, 0xff, sizeof(choice));
+		CHECK( 0, rtaff_weight_add("peer0.example.net", 3) );
+		map_sessions("peer0 weight 3", 4, -1, count);
+		CHECK( 1, ((count[0] > NB_SESSIONS / 2 * 0.9) && (count[0] < NB_SESSIONS / 2 * 1.1)) ? 1 : 0 );
+		for (i = 1; i < 4; i++) {
+			CHECK( 1, ((count[i] > NB_SESSIONS / 6 * 0.9) && (count[i] < NB_SESSIONS / 6 * 1.1)) ? 1 : 0 );
+		}
+		memcpy(previous, choice, sizeof(choice));
+		
+		/* Draining a peer only moves its sessions */
+		CHECK( 0, rtaff_weight_add("peer1.example.net", 0) );
+		map_sessions("peer1 weight 0", 4, -1, count);
+		CHECK( 0, count[1] );
+		for (s = 0; s < NB_SESSIONS; s++) {
+			if (previous[s] != 1) {
+				CHECK( previous[s], choice[s] );
+			}
+		}
+		
+		/* Unless all the candidates have a weight 0 */
+		CHECK( 0, rtaff_weight_add("peer0.example.net", 0) );
+		CHECK( 0, rtaff_weight_add("peer2.example.net", 0) );
+		CHECK( 0, rtaff_weight_add("peer3.example.net", 0) );
+		map_sessions("all weights 0", 4, -1, count);
+		for (i = 0; i < 4; i++) {
+			CHECK( 1, count[i] > 0 ? 1 : 0 );
+		}
+		rtaff_weight_fini();
+	}
+	
+	/* That's all for the tests yet */
+	PASSTEST();
+} 
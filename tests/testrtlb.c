@@ -0,0 +1,338 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+#include "tests.h"
+
+/* The policies of the rt_load_balance extension, compiled with the test (see CMakeLists.txt) */
+#include "rt_load_balance.h"
+
+#define NB_PEERS	4
+#define MAX_WORKERS	8
+#define QUEUE_SIZE	(1 << 16)
+#define SIM_TICKS	200000
+
+/* A simulated peer: it processes up to "workers" requests in parallel, each during "service" ticks. The other requests wait in a queue. */
+struct sim_peer {
+	int		workers;
+	int		service;
+	long		outstanding;		/* queued and processed requests, what fd_peer_get_load returns in to_receive */
+	uint32_t	latency;		/* average delay of the answers, computed like in p_sr.c */
+	long		arrival[MAX_WORKERS];	/* tick when the processed request was sent, -1 if the worker is idle */
+	long		end[MAX_WORKERS];	/* tick when the processing is over */
+	long		queue[QUEUE_SIZE];	/* tick when the waiting requests were sent */
+	int		qhead, qlen;
+	
+	/* statistics */
+	long		sent;
+	long		max_outstanding;
+	double		delay_sum;
+	long		answered;
+};
+
+/* Small, medium and slow peers, 1.45 requests per tick in total */
+static struct sim_peer peers[NB_PEERS] = {
+	{ 8, 10 },	/* 0.8 requests / tick */
+	{ 4, 10 },	/* 0.4 */
+	{ 4, 20 },	/* 0.2 */
+	{ 2, 40 }	/* 0.05 */
+};
+
+static struct rtd_candidate cands[NB_PEERS];
+static struct fd_list candidates = FD_LIST_INITIALIZER(candidates);
+static long testload[NB_PEERS];
+static uint32_t testlat[NB_PEERS];
+
+/* For the checks of the policies */
+static int test_getload(struct rtd_candidate * cand, struct fd_peer_load * load)
+{
+	int i = cand - cands;
+	load->to_receive = testload[i];
+	load->to_send = 0;
+	load->latency = testlat[i];
+	return 0;
+}
+
+/* For the simulation */
+static int sim_getload(struct rtd_candidate * cand, struct fd_peer_load * load)
+{
+	struct sim_peer * p = cand->peer;
+	load->to_receive = p->outstanding;
+	load->to_send = 0;
+	load->latency = p->latency;
+	return 0;
+}
+
+/* Reset the candidates list with the scores */
+static void set_cands(int nb, int * scores)
+{
+	int i;
+	fd_list_init(&candidates, NULL);
+	for (i = 0; i < nb; i++) {
+		fd_list_init(&cands[i].chain, &cands[i]);
+		cands[i].score = scores ? scores[i] : 0;
+		fd_list_insert_before(&candidates, &cands[i].chain);
+	}
+}
+
+/* Choose the peer like the routing does: the best score, randomly among the ties (fd_rtd_candidate_reorder) */
+static int sim_choose(unsigned int * seed)
+{
+	int i, max = cands[0].score, nb = 0, pick;
+	for (i = 1; i < NB_PEERS; i++)
+		if (cands[i].score > max)
+			max = cands[i].score;
+	for (i = 0; i < NB_PEERS; i++)
+		if (cands[i].score == max)
+			nb++;
+	pick = rand_r(seed) % nb;
+	for (i = 0; i < NB_PEERS; i++)
+		if ((cands[i].score == max) && !pick--)
+			break;
+	return i;
+}
+
+/* Run the simulation with 1.2 requests per tick on average (83% of the capacity); return the mean delay of the answers */
+static double simulate(enum rtlb_policy policy)
+{
+	unsigned int seed = 1;
+	long t;
+	int i, w, k;
+	long answered = 0;
+	double delay_sum = 0;
+	
+	for (i = 0; i < NB_PEERS; i++) {
+		struct sim_peer * p = &peers[i];
+		memset(&p->outstanding, 0, sizeof(struct sim_peer) - offsetof(struct sim_peer, outstanding));
+		for (w = 0; w < p->workers; w++)
+			p->arrival[w] = -1;
+		cands[i].peer = p;
+	}
+	
+	for (t = 0; t < SIM_TICKS; t++) {
+		/* The answers */
+		for (i = 0; i < NB_PEERS; i++) {
+			struct sim_peer * p = &peers[i];
+			for (w = 0; w < p->workers; w++) {
+				if ((p->arrival[w] >= 0) && (p->end[w] <= t)) {
+					int64_t d = t - p->arrival[w];
+					if (p->latency)
+						p->latency += (d - (int64_t)p->latency) / 8;
+					else
+						p->latency = d;
+					p->outstanding--;
+					p->delay_sum += d;
+					p->answered++;
+					p->arrival[w] = -1;
+				}
+			}
+		}
+		
+		/* The new requests */
+		for (k = 0; k < 4; k++) {
+			struct sim_peer * p;
+			if (rand_r(&seed) % 1000 >= 300)
+				continue;
+			set_cands(NB_PEERS, NULL);
+			CHECK( 0, rtlb_apply(policy, &candidates, sim_getload, &seed) );
+			p = &peers[sim_choose(&seed)];
+			CHECK( 1, p->qlen < QUEUE_SIZE ? 1 : 0 );
+			p->queue[(p->qhead + p->qlen++) % QUEUE_SIZE] = t;
+			p->outstanding++;
+			p->sent++;
+			if (p->outstanding > p->max_outstanding)
+				p->max_outstanding = p->outstanding;
+		}
+		
+		/* The processing */
+		for (i = 0; i < NB_PEERS; i++) {
+			struct sim_peer * p = &peers[i];
+			for (w = 0; (w < p->workers) && p->qlen; w++) {
+				if (p->arrival[w] < 0) {
+					p->arrival[w] = p->queue[p->qhead];
+					p->end[w] = t + p->service;
+					p->qhead = (p->qhead + 1) % QUEUE_SIZE;
+					p->qlen--;
+				}
+			}
+		}
+	}
+	
+	for (i = 0; i < NB_PEERS; i++) {
+		answered += peers[i].answered;
+		delay_sum += peers[i].delay_sum;
+	}
+	
+	printf("%-8s: share %5.1f%% %5.1f%% %5.1f%% %5.1f%%, max outstanding %4ld %4ld %4ld %4ld, mean delay %6.1f ticks\n",
+		rtlb_policy_name(policy),
+		peers[0].sent * 100.0 / (peers[0].sent + peers[1].sent + peers[2].sent + peers[3].sent),
+		peers[1].sent * 100.0 / (peers[0].sent + peers[1].sent + peers[2].sent + peers[3].sent),
+		peers[2].sent * 100.0 / (peers[0].sent + peers[1].sent + peers[2].sent + peers[3].sent),
+		peers[3].sent * 100.0 / (peers[0].sent + peers[1].sent + peers[2].sent + peers[3].sent),
+		peers[0].max_outstanding, peers[1].max_outstanding, peers[2].max_outstanding, peers[3].max_outstanding,
+		delay_sum / answered);
+	
+	return delay_sum / answered;
+}
+
+/* Main test routine */
+int main(int argc, char *argv[])
+{
+	enum rtlb_policy policy;
+	unsigned int seed = 1;
+	
+	/* First, initialize the daemon modules */
+	INIT_FD();
+	
+	/* The policy names */
+	{
+		CHECK( 0, rtlb_policy_parse(NULL, &policy) );
+		CHECK( RTLB_LOG2, policy );
+		CHECK( 0, rtlb_policy_parse("Least", &policy) );
+		CHECK( RTLB_LEAST, policy );
+		CHECK( 0, rtlb_policy_parse("p2c", &policy) );
+		CHECK( RTLB_P2C, policy );
+		CHECK( 0, rtlb_policy_parse("latency", &policy) );
+		CHECK( RTLB_LATENCY, policy );
+		CHECK( EINVAL, rtlb_policy_parse("roundrobin", &policy) );
+		CHECK( 10, RTLB_PRIO(RTLB_LOG2) );
+		CHECK( 0, RTLB_PRIO(RTLB_P2C) );
+	}
+	
+	/* The choices of the policies */
+	{
+		int i;
+		for (i = 0; i < NB_PEERS; i++) {
+			cands[i].diamid = "peer.test";
+			cands[i].diamidlen = CONSTSTRLEN("peer.test");
+		}
+		
+		/* log2 penalizes all the candidates */
+		testload[0] = 0; testload[1] = 1; testload[2] = 4; testload[3] = 7;
+		set_cands(4, NULL);
+		CHECK( 0, rtlb_apply(RTLB_LOG2, &candidates, test_getload, &seed) );
+		CHECK( 0, cands[0].score );
+		CHECK( -1, cands[1].score );
+		CHECK( -3, cands[2].score );
+		CHECK( -3, cands[3].score );
+		
+		/* least only chooses among the best scores, and keeps the ties */
+		{
+			int scores[] = { 1, 1, 1, 0 };
+			testload[0] = 5; testload[1] = 2; testload[2] = 2; testload[3] = 0;
+			set_cands(4, scores);
+			CHECK( 0, rtlb_apply(RTLB_LEAST, &candidates, test_getload, &seed) );
+			CHECK( 0, cands[0].score );
+			CHECK( 1, cands[1].score );
+			CHECK( 1, cands[2].score );
+			CHECK( 0, cands[3].score );
+		}
+		
+		/* A single best candidate is left alone, as the negative scores */
+		{
+			int scores[] = { 2, 1 };
+			testload[0] = 5; testload[1] = 0;
+			set_cands(2, scores);
+			CHECK( 0, rtlb_apply(RTLB_LEAST, &candidates, test_getload, &seed) );
+			CHECK( 2, cands[0].score );
+			CHECK( 1, cands[1].score );
+		}
+		{
+			int scores[] = { -1, -1 };
+			set_cands(2, scores);
+			CHECK( 0, rtlb_apply(RTLB_LEAST, &candidates, test_getload, &seed) );
+			CHECK( -1, cands[0].score );
+			CHECK( -1, cands[1].score );
+		}
+		
+		/* p2c with two candidates always compares both */
+		for (i = 0; i < 10; i++) {
+			testload[0] = 4; testload[1] = 1;
+			set_cands(2, NULL);
+			CHECK( 0, rtlb_apply(RTLB_P2C, &candidates, test_getload, &seed) );
+			CHECK( -1, cands[0].score );
+			CHECK( 0, cands[1].score );
+		}
+		
+		/* p2c with more candidates keeps exactly one, never the most loaded */
+		for (i = 0; i < 20; i++) {
+			int j, nb = 0;
+			testload[0] = 1; testload[1] = 2; testload[2] = 3; testload[3] = 4;
+			set_cands(4, NULL);
+			CHECK( 0, rtlb_apply(RTLB_P2C, &candidates, test_getload, &seed) );
+			for (j = 0; j < 4; j++)
+				if (cands[j].score == 0)
+					nb++;
+			CHECK( 1, nb );
+			CHECK( -1, cands[3].score );
+		}
+		
+		/* latency weights the outstanding requests; a peer that did not answer yet counts with the average latency */
+		testload[0] = 0; testload[1] = 0; testload[2] = 0;
+		testlat[0] = 100; testlat[1] = 0; testlat[2] = 50;
+		set_cands(3, NULL);
+		CHECK( 0, rtlb_apply(RTLB_LATENCY, &candidates, test_getload, &seed) );
+		CHECK( -1, cands[0].score );
+		CHECK( -1, cands[1].score );
+		CHECK( 0, cands[2].score );
+		
+		testload[0] = 0; testload[1] = 0; testload[2] = 3;
+		set_cands(3, NULL);
+		CHECK( 0, rtlb_apply(RTLB_LATENCY, &candidates, test_getload, &seed) );
+		CHECK( -1, cands[0].score );
+		CHECK( 0, cands[1].score );
+		CHECK( -1, cands[2].score );
+	}
+	
+	/* Simulate the load distribution of each policy over peers of different capacities */
+	{
+		double log2, least, p2c, latency;
+		
+		log2 = simulate(RTLB_LOG2);
+		least = simulate(RTLB_LEAST);
+		CHECK( 1, peers[0].sent > peers[3].sent ? 1 : 0 );
+		p2c = simulate(RTLB_P2C);
+		CHECK( 1, peers[0].sent > peers[3].sent ? 1 : 0 );
+		latency = simulate(RTLB_LATENCY);
+		CHECK( 1, peers[0].sent > peers[3].sent ? 1 : 0 );
+		
+		/* The delays with the real policies are not worse than with the log2 approximation */
+		CHECK( 1, least <= log2 ? 1 : 0 );
+		CHECK( 1, latency <= log2 ? 1 : 0 );
+		(void)p2c;
+	}
+	
+	/* That's all for the tests yet */
+	PASSTEST();
+} 
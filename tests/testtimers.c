@@ -0,0 +1,308 @@
+/*********************************************************************************************************
+* Software License Agreement (BSD License)                                                               *
+* Author: agent <agent@local>                                                                            *
+*													 *
+* Copyright (c) 2026, agent                                                                              *
+* All rights reserved.											 *
+* 													 *
+* Redistribution and use of this software in source and binary forms, with or without modification, are  *
+* permitted provided that the following conditions are met:						 *
+* 													 *
+* * Redistributions of source code must retain the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer.										 *
+*    													 *
+* * Redistributions in binary form must reproduce the above 						 *
+*   copyright notice, this list of conditions and the 							 *
+*   following disclaimer in the documentation and/or other						 *
+*   materials provided with the distribution.								 *
+* 													 *
+* * Neither the name of the WIDE Project or NICT nor the 						 *
+*   names of its contributors may be used to endorse or 						 *
+*   promote products derived from this software without 						 *
+*   specific prior written permission of WIDE Project and 						 *
+*   NICT.												 *
+* 													 *
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A *
+* PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR *
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 	 *
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS 	 *
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR *
+* TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF   *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.								 *
+*********************************************************************************************************/
+
+#include "tests.h"
+
+#define NB_TIMERS	200
+#define MAX_DELAY	600	/* ms, the upper ones are in the level 1 of the wheel */
+#define LATE		250	/* ms, tolerance on a loaded machine */
+
+struct test_timer {
+	struct fd_timer	tmr;
+	struct timespec	expire;	/* when the callback must be called */
+	int		called;	/* number of calls */
+	int		late;	/* the delay after expire when it was called, in ms */
+	int		rearm;	/* number of times the callback arms the timer again */
+	int		sleep;	/* the callback waits this number of ms */
+	int		done;	/* set at the end of the callback */
+};
+
+/* ms between two dates, negative if b is before a */
+static long diff_ms(struct timespec * a, struct timespec * b)
+{
+	return (long)(b->tv_sec - a->tv_sec) * 1000 + (b->tv_nsec - a->tv_nsec) / 1000000;
+}
+
+static void set_in(struct timespec * ts, long ms)
+{
+	CHECK( 0, clock_gettime(CLOCK_REALTIME, ts) );
+	ts->tv_sec += ms / 1000;
+	ts->tv_nsec += (ms % 1000) * 1000000;
+	if (ts->tv_nsec >= 1000000000) {
+		ts->tv_sec++;
+		ts->tv_nsec -= 1000000000;
+	}
+}
+
+static void wait_ms(long ms)
+{
+	struct timespec ts = { ms / 1000, (ms % 1000) * 1000000 };
+	CHECK( 0, nanosleep(&ts, NULL) );
+}
+
+static void test_cb(void * data)
+{
+	struct test_timer * t = data;
+	struct timespec now;
+	
+	CHECK( 0, clock_gettime(CLOCK_REALTIME, &now) );
+	t->late = diff_ms(&t->expire, &now);
+	t->called++;
+	
+	if (t->sleep)
+		wait_ms(t->sleep);
+	
+	if (t->rearm) {
+		t->rearm--;
+		set_in(&t->expire, 10);
+		CHECK( 0, fd_timer_arm(&t->tmr, &t->expire) );
+	}
+	t->done = 1;
+}
+
+static pthread_t hook_thr;
+static int hook_called = 0;
+static void test_hook(void)
+{
+	hook_thr = pthread_self();
+	hook_called++;
+}
+
+static void thr_cb(void * data)
+{
+	*(pthread_t *)data = pthread_self();
+}
+
+static void init_timer(struct test_timer * t)
+{
+	memset(t, 0, sizeof(struct test_timer));
+	fd_timer_init(&t->tmr, test_cb, t, 0);
+}
+
+/* Main test routine */
+int main(int argc, char *argv[])
+{
+	/* First, initialize the daemon modules */
+	INIT_FD();
+	
+	/* The timers expire in time, at random dates */
+	{
+		static struct test_timer tt[NB_TIMERS];
+		int i;
+		
+		for (i = 0; i < NB_TIMERS; i++) {
+			init_timer(&tt[i]);
+			set_in(&tt[i].expire, random() % MAX_DELAY);
+			CHECK( 0, fd_timer_arm(&tt[i].tmr, &tt[i].expire) );
+		}
+		
+		wait_ms(MAX_DELAY + LATE);
+		
+		for (i = 0; i < NB_TIMERS; i++) {
+			CHECK( 1, tt[i].called );
+			CHECK( 1, tt[i].late >= 0 ? 1 : 0 );
+			CHECK( 1, tt[i].late < LATE ? 1 : 0 );
+		}
+	}
+	
+	/* A timer armed again is moved, a canceled timer does not expire, a date in the past expires now */
+	{
+		struct test_timer t1, t2, t3, t4;
+		
+		init_timer(&t1);
+		set_in(&t1.expire, 20);
+		CHECK( 0, fd_timer_arm(&t1.tmr, &t1.expire) );
+		set_in(&t1.expire, 300);
+		CHECK( 0, fd_timer_arm(&t1.tmr, &t1.expire) );
+		
+		init_timer(&t2);
+		set_in(&t2.expire, 300);
+		CHECK( 0, fd_timer_arm(&t2.tmr, &t2.expire) );
+		set_in(&t2.expire, 20);
+		CHECK( 0, fd_timer_arm(&t2.tmr, &t2.expire) );
+		
+		init_timer(&t3);
+		set_in(&t3.expire, 20);
+		CHECK( 0, fd_timer_arm(&t3.tmr, &t3.expire) );
+		CHECK( 0, fd_timer_cancel(&t3.tmr) );
+		
+		init_timer(&t4);
+		set_in(&t4.expire, -1000);
+		CHECK( 0, fd_timer_arm(&t4.tmr, &t4.expire) );
+		
+		wait_ms(150);
+		CHECK( 0, t1.called );
+		CHECK( 1, t2.called );
+		CHECK( 0, t3.called );
+		CHECK( 1, t4.called );
+		
+		wait_ms(300);
+		CHECK( 1, t1.called );
+		CHECK( 1, t1.late >= 0 ? 1 : 0 );
+		CHECK( 1, t2.called );
+		CHECK( 0, t3.called );
+	}
+	
+	/* The timers far away do not expire, and do not prevent the others from expiring */
+	{
+		struct test_timer t1, t2, t3;
+		
+		init_timer(&t1);
+		set_in(&t1.expire, 3600 * 1000); /* level 3 */
+		CHECK( 0, fd_timer_arm(&t1.tmr, &t1.expire) );
+		init_timer(&t2);
+		set_in(&t2.expire, 100 * 86400 * 1000L); /* beyond the wheel */
+		CHECK( 0, fd_timer_arm(&t2.tmr, &t2.expire) );
+		init_timer(&t3);
+		set_in(&t3.expire, 50);
+		CHECK( 0, fd_timer_arm(&t3.tmr, &t3.expire) );
+		
+		wait_ms(300);
+		CHECK( 0, t1.called );
+		CHECK( 0, t2.called );
+		CHECK( 1, t3.called );
+		CHECK( 0, fd_timer_cancel(&t1.tmr) );
+		CHECK( 0, fd_timer_cancel(&t2.tmr) );
+	}
+	
+	/* A timer of the level 1 expires in time even when a later timer is in the level 0 */
+	{
+		struct test_timer t1, t2, t3, t4;
+		struct timespec now;
+		
+		/* Start 1ms after the beginning of a slot of the level 1 (256ms) */
+		CHECK( 0, clock_gettime(CLOCK_REALTIME, &now) );
+		wait_ms(256 - ((uint64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000) % 256 + 1);
+		
+		/* Expires just after the next slot of the level 1 begins: it is linked in this level */
+		init_timer(&t1);
+		set_in(&t1.expire, 256);
+		CHECK( 0, fd_timer_arm(&t1.tmr, &t1.expire) );
+		
+		/* Make the wheel move forward, but stay in the same slot of the level 1 */
+		init_timer(&t2);
+		set_in(&t2.expire, 200);
+		CHECK( 0, fd_timer_arm(&t2.tmr, &t2.expire) );
+		wait_ms(230);
+		CHECK( 1, t2.called );
+		
+		/* Less than 256ms after the position of the wheel: it is linked in the level 0 */
+		init_timer(&t3);
+		set_in(&t3.expire, 220);
+		CHECK( 0, fd_timer_arm(&t3.tmr, &t3.expire) );
+		
+		/* The thread computes its next wakeup again after this one, with both timers linked */
+		init_timer(&t4);
+		set_in(&t4.expire, 5);
+		CHECK( 0, fd_timer_arm(&t4.tmr, &t4.expire) );
+		
+		wait_ms(300);
+		CHECK( 1, t1.called );
+		CHECK( 1, t3.called );
+		CHECK( 1, t1.late < 100 ? 1 : 0 );
+	}
+	
+	/* A callback can arm its timer again, and the cancellation waits for the callback */
+	{
+		struct test_timer t1, t2;
+		
+		init_timer(&t1);
+		t1.rearm = 5;
+		set_in(&t1.expire, 10);
+		CHECK( 0, fd_timer_arm(&t1.tmr, &t1.expire) );
+		
+		init_timer(&t2);
+		t2.sleep = 200;
+		t2.rearm = 1;
+		set_in(&t2.expire, 10);
+		CHECK( 0, fd_timer_arm(&t2.tmr, &t2.expire) );
+		
+		wait_ms(100);
+		CHECK( 1, t2.called );
+		CHECK( 0, fd_timer_cancel(&t2.tmr) );
+		CHECK( 1, t2.done );
+		
+		wait_ms(250);
+		CHECK( 6, t1.called );
+		CHECK( 1, t2.called ); /* armed again by the callback, but canceled */
+	}
+	
+	/* The hook is called once, in the thread that calls the callbacks */
+	{
+		struct fd_timer tmr;
+		struct timespec ts;
+		pthread_t cb_thr;
+		
+		CHECK( 0, fd_timers_thr_hook(test_hook) );
+		wait_ms(50);
+		CHECK( 1, hook_called );
+		
+		fd_timer_init(&tmr, thr_cb, &cb_thr, 0);
+		set_in(&ts, 10);
+		CHECK( 0, fd_timer_arm(&tmr, &ts) );
+		wait_ms(100);
+		CHECK( 1, pthread_equal(cb_thr, hook_thr) ? 1 : 0 );
+		CHECK( 1, hook_called );
+		
+		CHECK( 0, fd_timers_thr_hook(NULL) );
+	}
+	
+	/* A blocking callback does not delay the other timers, and its cancellation waits for it */
+	{
+		struct test_timer t1, t2;
+		
+		init_timer(&t1);
+		fd_timer_init(&t1.tmr, test_cb, &t1, FD_TIMER_BLOCKING);
+		t1.sleep = 300;
+		set_in(&t1.expire, 10);
+		CHECK( 0, fd_timer_arm(&t1.tmr, &t1.expire) );
+		
+		init_timer(&t2);
+		set_in(&t2.expire, 50);
+		CHECK( 0, fd_timer_arm(&t2.tmr, &t2.expire) );
+		
+		wait_ms(150);
+		CHECK( 1, t1.called );
+		CHECK( 0, t1.done );
+		CHECK( 1, t2.called );
+		CHECK( 1, t2.late < 100 ? 1 : 0 );
+		
+		CHECK( 0, fd_timer_cancel(&t1.tmr) );
+		CHECK( 1, t1.done );
+	}
+	
+	/* That's all for the tests yet */
+	PASSTEST();
+} 